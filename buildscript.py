@@ -7,12 +7,17 @@ except ImportError:
 
 import datetime
 import settings.defaultsettings as DefaultSettings
+import webassets.staticassets as StaticAssets
 
 
 FILENAME_BUILDNO = 'versioning'
 FILENAME_VERSION_H = 'include/version.h'
 FILENAME_DEFAULT_SETTINGS_CPP = "src/Core/DefaultSettings.cpp"
 FILENAME_DEFAULT_SETTINGS_YAML = "settings/default.yaml"
+FILENAME_SETTINGS_IDS_H = "include/Core/SettingsIds.h"
+FILENAME_STATIC_ASSETS_YAML = "webassets/assets.yaml"
+FILENAME_STATIC_ASSETS_CPP = "src/WebServer/StaticAssetsData.cpp"
+FILENAME_STATIC_ASSETS_H = "include/WebServer/StaticAssetsData.h"
 
 MAJOR = 0
 MINOR = 1
@@ -63,8 +68,13 @@ def update_versioning():
 
 def generate_default_settings():
     DefaultSettings.GenerateDerfaultSettings(FILENAME_DEFAULT_SETTINGS_YAML, FILENAME_DEFAULT_SETTINGS_CPP)
+    DefaultSettings.GenerateSettingIds(FILENAME_DEFAULT_SETTINGS_YAML, FILENAME_SETTINGS_IDS_H)
+
+def generate_static_assets():
+    StaticAssets.GenerateStaticAssets(FILENAME_STATIC_ASSETS_YAML, FILENAME_STATIC_ASSETS_CPP, FILENAME_STATIC_ASSETS_H)
 
 if is_pio_build():
 
     generate_default_settings()
+    generate_static_assets()
     update_versioning()
\ No newline at end of file
@@ -21,8 +21,9 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <string>       /* Standard strings */
 #include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIRequest.h> /* API call parameters */
 
 /*******************************************************************************
  * CONSTANTS
@@ -50,6 +51,24 @@ typedef enum {
     API_RES_WIFI_SET_UNKNOWN = 3,
     /** @brief Error while setting the wifi settings  */
     API_RES_WIFI_SET_ACTION_ERR = 4,
+    /** @brief The response did not fit in the response buffer. */
+    API_RES_RESPONSE_OVERFLOW = 5,
+    /** @brief Invalid or too many batched requests. */
+    API_RES_BATCH_INVALID = 6,
+    /** @brief Invalid history query or unavailable history. */
+    API_RES_HISTORY_INVALID = 7,
+    /** @brief Unknown task or invalid task configuration. */
+    API_RES_TASK_INVALID = 8,
+    /** @brief Invalid or failed firmware update request. */
+    API_RES_OTA_ERROR = 9,
+    /** @brief Invalid or too large request body. */
+    API_RES_BODY_INVALID = 10,
+    /** @brief Metrics requested in a batch. */
+    API_RES_METRICS_INVALID = 11,
+    /** @brief Invalid tracing state or failed tracing start. */
+    API_RES_TRACE_INVALID = 12,
+    /** @brief Invalid telemetry configuration. */
+    API_RES_TELEMETRY_INVALID = 13,
 } E_APIResult;
 
 /*******************************************************************************
@@ -103,12 +122,12 @@ class APIHandler {
          * @details Generate the page. The function should generate API response
          * and process the API call.
          *
-         * @param[out] rResponse The response to the API call.
-         * @param[in] pServer The server that received the call. Used to
-         * retrieve the call parameters.
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
          */
-        virtual void Handle(std::string& rResponse, WebServer* pServer)
-            noexcept = 0;
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept = 0;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -0,0 +1,346 @@
+/*******************************************************************************
+ * @file APIRequest.h
+ *
+ * @see APIRequest.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief API call parameters.
+ *
+ * @details API call parameters. The API handlers retrieve the parameters of a
+ * call through this interface, the parameters come either from the server
+ * request or from a sub-request of a batch call.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __API_REQUEST_H__
+#define __API_REQUEST_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>     /* Standard integer definitions */
+#include <cstddef>     /* Standard size type */
+#include <Arduino.h>   /* Arduino Framework */
+#include <WebServer.h> /* Web server services */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef API_REQUEST_MAX_ARGS
+/** @brief Defines the maximal number of parameters of a query request. */
+#define API_REQUEST_MAX_ARGS 16
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The APIRequest interface.
+ *
+ * @details The APIRequest interface gives access to the parameters of an API
+ * call.
+ */
+class APIRequest {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief APIRequest destructor.
+         */
+        virtual ~APIRequest(void) noexcept {};
+
+        /**
+         * @brief Returns the number of parameters.
+         *
+         * @return The number of parameters of the call is returned.
+         */
+        virtual uint32_t GetArgCount(void) const noexcept = 0;
+
+        /**
+         * @brief Returns the name of a parameter.
+         *
+         * @param[in] kIndex The index of the parameter.
+         *
+         * @return The name of the parameter is returned, an empty string if
+         * the index is invalid.
+         */
+        virtual String GetArgName(const uint32_t kIndex) const noexcept = 0;
+
+        /**
+         * @brief Returns the value of a parameter.
+         *
+         * @param[in] kIndex The index of the parameter.
+         *
+         * @return The value of the parameter is returned, an empty string if
+         * the index is invalid.
+         */
+        virtual String GetArg(const uint32_t kIndex) const noexcept = 0;
+
+        /**
+         * @brief Returns the value of a named parameter.
+         *
+         * @param[in] kpName The name of the parameter.
+         *
+         * @return The value of the first parameter with this name is
+         * returned, an empty string if there is none.
+         */
+        virtual String GetNamedArg(const char* kpName) const noexcept = 0;
+
+        /**
+         * @brief Returns the raw body of the call.
+         *
+         * @param[out] rpkData The body buffer.
+         * @param[out] rSize The body size in bytes.
+         *
+         * @return true is returned when the call carries a raw body, the
+         * outputs are left untouched otherwise.
+         */
+        virtual bool GetBody(const uint8_t*& rpkData,
+                             size_t&         rSize) const noexcept = 0;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /* None */
+};
+
+/**
+ * @brief The ServerAPIRequest class.
+ *
+ * @details The ServerAPIRequest class gives access to the parameters of the
+ * request being served by a server.
+ */
+class ServerAPIRequest : public APIRequest {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief ServerAPIRequest constructor.
+         *
+         * @param[in] pServer The server serving the request.
+         */
+        ServerAPIRequest(WebServer* pServer) noexcept;
+
+        /**
+         * @brief ServerAPIRequest destructor.
+         */
+        virtual ~ServerAPIRequest(void) noexcept;
+
+        /**
+         * @brief Returns the number of parameters.
+         *
+         * @return The number of parameters of the call is returned.
+         */
+        virtual uint32_t GetArgCount(void) const noexcept override;
+
+        /**
+         * @brief Returns the name of a parameter.
+         *
+         * @param[in] kIndex The index of the parameter.
+         *
+         * @return The name of the parameter is returned, an empty string if
+         * the index is invalid.
+         */
+        virtual String GetArgName(const uint32_t kIndex) const noexcept
+        override;
+
+        /**
+         * @brief Returns the value of a parameter.
+         *
+         * @param[in] kIndex The index of the parameter.
+         *
+         * @return The value of the parameter is returned, an empty string if
+         * the index is invalid.
+         */
+        virtual String GetArg(const uint32_t kIndex) const noexcept override;
+
+        /**
+         * @brief Returns the value of a named parameter.
+         *
+         * @param[in] kpName The name of the parameter.
+         *
+         * @return The value of the first parameter with this name is
+         * returned, an empty string if there is none.
+         */
+        virtual String GetNamedArg(const char* kpName) const noexcept override;
+
+        /**
+         * @brief Returns the raw body of the call.
+         *
+         * @param[out] rpkData The body buffer.
+         * @param[out] rSize The body size in bytes.
+         *
+         * @return true is returned when the call carries a raw body, the
+         * outputs are left untouched otherwise.
+         */
+        virtual bool GetBody(const uint8_t*& rpkData,
+                             size_t&         rSize) const noexcept override;
+
+        /**
+         * @brief Sets the raw body of the call.
+         *
+         * @details Sets the raw body of the call, received by the route raw
+         * handler. The body must outlive the object.
+         *
+         * @param[in] kpData The body buffer.
+         * @param[in] kSize The body size in bytes.
+         */
+        void SetBody(const uint8_t* kpData, const size_t kSize) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The server serving the request. */
+        WebServer* _pServer;
+        /** @brief The raw body of the call, nullptr if none. */
+        const uint8_t* _pkBody;
+        /** @brief The raw body size in bytes. */
+        size_t _bodySize;
+};
+
+/**
+ * @brief The QueryAPIRequest class.
+ *
+ * @details The QueryAPIRequest class gives access to the parameters of an URL
+ * query string, "name=value" pairs separated by '&'. The names and values are
+ * URL decoded. Queries never carry a raw body.
+ */
+class QueryAPIRequest : public APIRequest {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief QueryAPIRequest constructor.
+         *
+         * @details QueryAPIRequest constructor. The query is split and
+         * decoded in place, it must outlive the object.
+         *
+         * @param[in, out] pQuery The null terminated query, without the '?'.
+         */
+        QueryAPIRequest(char* pQuery) noexcept;
+
+        /**
+         * @brief QueryAPIRequest destructor.
+         */
+        virtual ~QueryAPIRequest(void) noexcept;
+
+        /**
+         * @brief Tells if the query has too many parameters.
+         *
+         * @return true if the query has more than API_REQUEST_MAX_ARGS
+         * parameters, the extra parameters are then ignored.
+         */
+        bool IsOverflowed(void) const noexcept;
+
+        /**
+         * @brief Returns the number of parameters.
+         *
+         * @return The number of parameters of the call is returned.
+         */
+        virtual uint32_t GetArgCount(void) const noexcept override;
+
+        /**
+         * @brief Returns the name of a parameter.
+         *
+         * @param[in] kIndex The index of the parameter.
+         *
+         * @return The name of the parameter is returned, an empty string if
+         * the index is invalid.
+         */
+        virtual String GetArgName(const uint32_t kIndex) const noexcept
+        override;
+
+        /**
+         * @brief Returns the value of a parameter.
+         *
+         * @param[in] kIndex The index of the parameter.
+         *
+         * @return The value of the parameter is returned, an empty string if
+         * the index is invalid.
+         */
+        virtual String GetArg(const uint32_t kIndex) const noexcept override;
+
+        /**
+         * @brief Returns the value of a named parameter.
+         *
+         * @param[in] kpName The name of the parameter.
+         *
+         * @return The value of the first parameter with this name is
+         * returned, an empty string if there is none.
+         */
+        virtual String GetNamedArg(const char* kpName) const noexcept override;
+
+        /**
+         * @brief Returns the raw body of the call.
+         *
+         * @param[out] rpkData The body buffer.
+         * @param[out] rSize The body size in bytes.
+         *
+         * @return true is returned when the call carries a raw body, the
+         * outputs are left untouched otherwise.
+         */
+        virtual bool GetBody(const uint8_t*& rpkData,
+                             size_t&         rSize) const noexcept override;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The names of the parameters. */
+        const char* _pkNames[API_REQUEST_MAX_ARGS];
+        /** @brief The values of the parameters. */
+        const char* _pkValues[API_REQUEST_MAX_ARGS];
+        /** @brief The number of parameters. */
+        uint32_t _count;
+        /** @brief Tells if the query has too many parameters. */
+        bool _isOverflowed;
+};
+
+#endif /* #ifndef __API_REQUEST_H__ */
@@ -23,16 +23,36 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <Errors.h>      /* Errors definitions */
-#include <Arduino.h>     /* Arduino Framework */
-#include <WebServer.h>   /* Web server services */
-#include <APIHandler.h>  /* API Handlers */
-#include <unordered_map> /* Standard unordered maps */
+#include <Errors.h>          /* Errors definitions */
+#include <Arduino.h>         /* Arduino Framework */
+#include <WebServer.h>       /* Web server services */
+#include <APIHandler.h>      /* API Handlers */
+#include <JsonWriter.h>      /* JSON response writer */
+#include <RouteTable.h>      /* Route table */
+#include <KeepAliveServer.h> /* Persistent connections server */
 
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/* None */
+#ifndef API_RESPONSE_BUFFER_SIZE
+/** @brief Defines the size of the API response buffer in bytes. */
+#define API_RESPONSE_BUFFER_SIZE 4096
+#endif
+
+#ifndef API_BATCH_MAX_REQUESTS
+/** @brief Defines the maximal number of requests of a batch call. */
+#define API_BATCH_MAX_REQUESTS 8
+#endif
+
+#ifndef API_BATCH_REQUEST_SIZE
+/** @brief Defines the maximal size of a batched request in bytes. */
+#define API_BATCH_REQUEST_SIZE 256
+#endif
+
+#ifndef API_REQUEST_BODY_SIZE
+/** @brief Defines the maximal size of a CBOR request body in bytes. */
+#define API_REQUEST_BODY_SIZE 512
+#endif
 
 /*******************************************************************************
  * MACROS
@@ -43,7 +63,41 @@
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-/* None */
+/** @brief Defines the API routes identifiers. */
+typedef enum {
+    /** @brief Ping API. */
+    API_ROUTE_PING = 0,
+    /** @brief Timing statistics API. */
+    API_ROUTE_TIMING = 1,
+    /** @brief WiFi settings API. */
+    API_ROUTE_WIFI = 2,
+    /** @brief Batch API, dispatching the other APIs. */
+    API_ROUTE_BATCH = 3,
+    /** @brief Boot trace API. */
+    API_ROUTE_BOOT = 4,
+    /** @brief WiFi power-save API. */
+    API_ROUTE_POWER = 5,
+    /** @brief Streamed history API. */
+    API_ROUTE_HISTORY = 6,
+    /** @brief System monitor API. */
+    API_ROUTE_MONITOR = 7,
+    /** @brief Load statistics API. */
+    API_ROUTE_LOAD = 8,
+    /** @brief Tasks placement API. */
+    API_ROUTE_TASKS = 9,
+    /** @brief Firmware update API. */
+    API_ROUTE_OTA = 10,
+    /** @brief Firmware update data API, receiving the raw image. */
+    API_ROUTE_OTA_DATA = 11,
+    /** @brief Prometheus metrics API. */
+    API_ROUTE_METRICS = 12,
+    /** @brief Events trace API. */
+    API_ROUTE_TRACE = 13,
+    /** @brief Telemetry settings API. */
+    API_ROUTE_TELEMETRY = 14,
+    /** @brief Number of API routes. */
+    API_ROUTE_COUNT = 15
+} E_APIRoute;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -91,7 +145,7 @@ class APIServerHandlers {
          *
          * @param[in] pServer The server to use.
          */
-        APIServerHandlers(WebServer* pServer) noexcept;
+        APIServerHandlers(KeepAliveServer* pServer) noexcept;
 
         /**
          * @brief Destroys a APIServerHandlers.
@@ -116,12 +170,70 @@ class APIServerHandlers {
         static void HandleNotFound(void) noexcept;
 
         /**
-         * @brief Handles the registered URLs.
+         * @brief Handles the routed URLs.
+         *
+         * @details Handles the routed URLs. The API call of the route is
+         * processed and its response sent.
+         *
+         * @param[in] krRoute The route matched by the request.
+         */
+        static void HandleRoute(const S_Route& krRoute) noexcept;
+
+        /**
+         * @brief Handles the raw bodies.
+         *
+         * @details Handles the raw bodies. The firmware update data are
+         * given to the update handler, the CBOR bodies are gathered in the
+         * request body buffer.
+         *
+         * @param[in] krRoute The route matched by the request.
+         * @param[in, out] rRaw The body part.
+         */
+        static void HandleRaw(const S_Route& krRoute, HTTPRaw& rRaw) noexcept;
+
+        /**
+         * @brief Tells if the body of a route is received as raw data.
+         *
+         * @details Tells if the body of a route is received as raw data. The
+         * routes decoding a CBOR body receive it raw when the request
+         * content type is CBOR.
+         *
+         * @param[in] krRoute The route matched by the request.
+         *
+         * @return true if the body is received as raw data.
+         */
+        static bool IsRawBody(const S_Route& krRoute) noexcept;
+
+        /**
+         * @brief Selects the response encoding.
+         *
+         * @details Selects the response encoding from the request Accept
+         * header. The responses are JSON unless the client accepts CBOR.
+         *
+         * @param[out] rWriter The writer of the response.
+         */
+        static void NegotiateEncoding(JsonWriter& rWriter) noexcept;
+
+        /**
+         * @brief Gathers a part of a CBOR request body.
+         *
+         * @details Gathers a part of a CBOR request body. The body is invalid
+         * when it does not fit the request body buffer or was aborted.
          *
-         * @details Handles the registered URLs. If the URL is not found in the
-         * handlers table, the HM is notified.
+         * @param[in] krRaw The body part.
          */
-        static void HandleKnownURL(void) noexcept;
+        void ReceiveBody(const HTTPRaw& krRaw) noexcept;
+
+        /**
+         * @brief Handles a batch call.
+         *
+         * @details Handles a batch call. Each "req" parameter holds an API
+         * path with its URL encoded query, the APIs are called in order and
+         * their responses gathered in the "responses" array.
+         *
+         * @param[out] rWriter The writer receiving the combined response.
+         */
+        void HandleBatch(JsonWriter& rWriter) noexcept;
 
         /**
          * @brief Generic API handler.
@@ -129,17 +241,46 @@ class APIServerHandlers {
          * @details Generic API handler. The handler will send the reponse
          * to the requesting server.
          *
-         * @param[in] krResponse The reponse to send.
+         * @param[in] krWriter The writer holding the reponse to send.
          * @param[in] kCode The code to respond.
+         *
+         * @return The size of the sent response body in bytes is returned.
          */
-        void GenericHandler(const std::string& krResponse,
-                            const int32_t      kCode) noexcept;
+        size_t GenericHandler(const JsonWriter& krWriter,
+                              const int32_t     kCode) noexcept;
 
-        /** @brief Stores the WebServer used by the handlers. */
-        WebServer* _pServer;
+        /**
+         * @brief Stores the response buffer. Requests are served one at a
+         * time, the same buffer is used by all the responses.
+         */
+        char _pResponseBuffer[API_RESPONSE_BUFFER_SIZE];
+
+        /** @brief Stores the CBOR body of the request being served. */
+        uint8_t _pRequestBody[API_REQUEST_BODY_SIZE];
+
+        /** @brief Stores the size of the request body in bytes. */
+        size_t _requestBodySize;
+
+        /** @brief Tells if the request being served carries a raw body. */
+        bool _hasRequestBody;
+
+        /** @brief Tells if the request body was entirely received. */
+        bool _isRequestBodyValid;
+
+        /** @brief Stores the server used by the handlers. */
+        KeepAliveServer* _pServer;
+
+        /** @brief Stores the route table of the server. */
+        RouteTable* _pRoutes;
+
+        /**
+         * @brief Stores the handlers of the API, by route identifier. The
+         * batch and firmware update data routes have no handler.
+         */
+        APIHandler* _pApiHandlers[E_APIRoute::API_ROUTE_COUNT];
 
-        /** @brief Stores the registered handlers for the API. */
-        std::unordered_map<std::string, APIHandler*> _apiHandlers;
+        /** @brief Stores the statistics identifiers, by route identifier. */
+        uint32_t _pStatsIds[E_APIRoute::API_ROUTE_COUNT];
 };
 
 #endif /* #ifndef __API_SERVER_HANDLERS_H__ */
\ No newline at end of file
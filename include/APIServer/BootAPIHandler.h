@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * @file BootAPIHandler.h
+ *
+ * @see BootAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Boot trace API handler.
+ *
+ * @details Boot trace API handler. This file defines the Boot API handler
+ * used to report the boot phases timing of the running firmware build.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __BOOT_API_HANDLER_H__
+#define __BOOT_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIRequest.h> /* API call parameters */
+#include <APIHandler.h> /* API Handler interface */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The BootAPIHandler class.
+ *
+ * @details The BootAPIHandler class provides the necessary functions to handle
+ * a Boot trace call through the API. The record of the last reset is
+ * reported with the phases.
+ */
+class BootAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Destroys a BootAPIHandler.
+         *
+         * @details Destroys a BootAPIHandler. Since only one object is allowed
+         * in the firmware, the destructor will generate a critical error.
+         */
+        virtual ~BootAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Generate the page. The function should generate API response
+         * and process the API call.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /* None */
+};
+
+#endif /* #ifndef __BOOT_API_HANDLER_H__ */
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * @file CborReader.h
+ *
+ * @see CborReader.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief API CBOR request reader.
+ *
+ * @details API CBOR request reader. The reader decodes a CBOR map in a
+ * structure described by the field schema of the JSON writer, in one linear
+ * pass and without any allocation.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CBOR_READER_H__
+#define __CBOR_READER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>      /* Standard integer definitions */
+#include <cstddef>      /* Standard size type */
+#include <JsonWriter.h> /* JSON schema */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the maximal number of fields of a decoded schema. */
+#define CBOR_READER_MAX_FIELDS 32
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The CborReader class.
+ *
+ * @details The CborReader class decodes a CBOR document written with the JSON
+ * writer schema. The document is a map, definite or indefinite length, whose
+ * keys are the schema keys. The values keep their native type: booleans are
+ * simple values, integers are checked against the field range and strings
+ * must fit their field with the terminator. Unknown and duplicate keys, tags,
+ * nested containers and trailing bytes make the document invalid.
+ */
+class CborReader {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief CborReader constructor.
+         *
+         * @param[in] kpData The CBOR document, it must outlive the object.
+         * @param[in] kSize The document size in bytes.
+         */
+        CborReader(const uint8_t* kpData, const size_t kSize) noexcept;
+
+        /**
+         * @brief Decodes the fields of a structure.
+         *
+         * @details Decodes the fields of a structure as described by the
+         * schema. The fields missing from the document are left untouched,
+         * the fields decoded before an error may be modified.
+         *
+         * @param[out] pObject The structure to fill.
+         * @param[in] kpSchema The structure fields descriptors.
+         * @param[in] kCount The number of fields in the schema, up to
+         * CBOR_READER_MAX_FIELDS.
+         * @param[out] rFound The decoded fields, one bit per schema index.
+         *
+         * @return true is returned when the document is valid.
+         */
+        bool ReadFields(void*              pObject,
+                        const S_JsonField* kpSchema,
+                        const size_t       kCount,
+                        uint32_t&          rFound) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Reads a data item head.
+         *
+         * @param[out] rMajor The major type of the item.
+         * @param[out] rInfo The additional information of the item.
+         * @param[out] rValue The argument of the item, the additional
+         * information when it has no argument bytes.
+         *
+         * @return true is returned when the head is valid.
+         */
+        bool ReadHead(uint8_t&  rMajor,
+                      uint8_t&  rInfo,
+                      uint64_t& rValue) noexcept;
+
+        /**
+         * @brief Reads a definite length text string.
+         *
+         * @param[out] rpkText The string bytes, not terminated.
+         * @param[out] rLength The string length in bytes.
+         *
+         * @return true is returned when the string is valid.
+         */
+        bool ReadText(const uint8_t*& rpkText, size_t& rLength) noexcept;
+
+        /**
+         * @brief Reads a value in a structure field.
+         *
+         * @param[out] pField The field to fill.
+         * @param[in] krField The field descriptor.
+         *
+         * @return true is returned when the value is valid for the field.
+         */
+        bool ReadValue(uint8_t* pField, const S_JsonField& krField) noexcept;
+
+        /** @brief The CBOR document. */
+        const uint8_t* _pkData;
+        /** @brief The document size in bytes. */
+        size_t _size;
+        /** @brief The read position in the document. */
+        size_t _position;
+};
+
+#endif /* #ifndef __CBOR_READER_H__ */
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ * @file HistoryAPIHandler.h
+ *
+ * @see HistoryAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief History API handler.
+ *
+ * @details History API handler. This file defines the History API handler
+ * used to stream the stored series over a time range.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __HISTORY_API_HANDLER_H__
+#define __HISTORY_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>           /* Standard integer definitions */
+#include <cstddef>           /* Standard size type */
+#include <WebServer.h>       /* Web Server services */
+#include <JsonWriter.h>      /* JSON response writer */
+#include <APIRequest.h>      /* API call parameters */
+#include <APIHandler.h>      /* API Handler interface */
+#include <TSDBRollup.h>      /* Time series rollup tiers */
+#include <TimeSeriesStore.h> /* Time series store */
+#include <KeepAliveServer.h> /* Persistent connections server */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef HISTORY_CHUNK_SIZE
+/** @brief Defines the size of the streamed response chunks in bytes. */
+#define HISTORY_CHUNK_SIZE 1024
+#endif
+
+#ifndef HISTORY_DEFAULT_RANGE_MS
+/** @brief Defines the range of a query without start in milliseconds. */
+#define HISTORY_DEFAULT_RANGE_MS 86400000LL
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the history response formats. */
+typedef enum {
+    /** @brief JSON array of [time, value] pairs. */
+    HISTORY_FORMAT_JSON = 0,
+    /** @brief CSV lines of time and value. */
+    HISTORY_FORMAT_CSV = 1,
+    /**
+     * @brief Little endian records of a 64 bits time and a 32 bits float
+     * value.
+     */
+    HISTORY_FORMAT_BIN = 2
+} E_HistoryFormat;
+
+/** @brief History query parameters. */
+typedef struct {
+    /** @brief The raw series identifier. */
+    uint16_t id;
+    /** @brief The aggregate of the downsampled points. */
+    E_TSDBAggregate aggregate;
+    /** @brief The response format. */
+    E_HistoryFormat format;
+    /** @brief The start of the range, store time in milliseconds. */
+    int64_t from;
+    /** @brief The end of the range, store time in milliseconds. */
+    int64_t to;
+    /** @brief The resolution in milliseconds, 0 for the stored points. */
+    int64_t step;
+} S_HistoryQuery;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The HistoryAPIHandler class.
+ *
+ * @details The HistoryAPIHandler class provides the necessary functions to
+ * handle a History call through the API. The points are decoded one block
+ * at a time and sent in chunks while the range is read, the memory used
+ * does not depend on the range.
+ */
+class HistoryAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /** @brief HistoryAPIHandler constructor. */
+        HistoryAPIHandler(void) noexcept;
+
+        /**
+         * @brief Destroys a HistoryAPIHandler.
+         *
+         * @details Destroys a HistoryAPIHandler. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        virtual ~HistoryAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Handle the API call. The history is streamed and cannot
+         * be gathered in a batch response, an error is returned.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+        /**
+         * @brief Streams the response of a History call.
+         *
+         * @details Streams the response of a History call. The parameters are
+         * "series", "from", "to", "step", "agg" (avg, min, max) and "format"
+         * (json, csv, bin). When the step is coarser than the stored points,
+         * the points are aggregated in step buckets.
+         *
+         * @param[in, out] pServer The server sending the response.
+         * @param[in] krRequest The call parameters.
+         * @param[out] rWriter The writer receiving the error response.
+         * @param[out] rCode The HTTP code of the error response.
+         *
+         * @return true if the response was streamed, false if an error
+         * response was written.
+         */
+        bool Stream(KeepAliveServer*  pServer,
+                    const APIRequest& krRequest,
+                    JsonWriter&       rWriter,
+                    int32_t&          rCode) noexcept;
+
+        /**
+         * @brief Parses the parameters of a History call.
+         *
+         * @param[in] krRequest The call parameters.
+         * @param[in] kNow The current store time in milliseconds.
+         * @param[out] rQuery The parsed query.
+         *
+         * @return true if the parameters are valid, false otherwise.
+         */
+        static bool ParseQuery(const APIRequest& krRequest,
+                               const int64_t     kNow,
+                               S_HistoryQuery&   rQuery) noexcept;
+
+        /**
+         * @brief Formats a point of the response.
+         *
+         * @param[in] kFormat The response format.
+         * @param[in] kIsFirst Tells if the point is the first of the response.
+         * @param[in] kTime The time of the point in milliseconds.
+         * @param[in] kValue The value of the point.
+         * @param[out] pBuffer The buffer receiving the point.
+         * @param[in] kSize The size of the buffer.
+         *
+         * @return The size of the formatted point, 0 if it does not fit.
+         */
+        static size_t FormatPoint(const E_HistoryFormat kFormat,
+                                  const bool            kIsFirst,
+                                  const int64_t         kTime,
+                                  const float           kValue,
+                                  char*                 pBuffer,
+                                  const size_t          kSize) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Adds data to the current chunk, the chunk is sent first when
+         * the data does not fit.
+         *
+         * @param[in] kpData The data to add.
+         * @param[in] kSize The data size in bytes.
+         *
+         * @return true if the stream is still valid, false otherwise.
+         */
+        bool Write(const char* kpData, const size_t kSize) noexcept;
+
+        /**
+         * @brief Adds a point to the response.
+         *
+         * @param[in] kTime The time of the point in milliseconds.
+         * @param[in] kValue The value of the point.
+         *
+         * @return true if the stream is still valid, false otherwise.
+         */
+        bool WritePoint(const int64_t kTime, const float kValue) noexcept;
+
+        /** @brief The server of the current stream. */
+        KeepAliveServer* _pServer;
+        /** @brief The query of the current stream. */
+        S_HistoryQuery _query;
+        /** @brief The number of points of the current stream. */
+        uint32_t _points;
+        /** @brief The range cursor, too large for the servers task stack. */
+        S_TSDBCursor _cursor;
+        /** @brief The used size of the current chunk. */
+        size_t _chunkSize;
+        /** @brief The current chunk. */
+        char _pChunk[HISTORY_CHUNK_SIZE];
+};
+
+#endif /* #ifndef __HISTORY_API_HANDLER_H__ */
@@ -0,0 +1,392 @@
+/*******************************************************************************
+ * @file JsonWriter.h
+ *
+ * @see JsonWriter.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief API JSON response writer.
+ *
+ * @details API JSON response writer. The writer serializes JSON values in a
+ * caller provided buffer without any allocation. Structures can be described
+ * by a constant field schema and serialized in one call.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __JSON_WRITER_H__
+#define __JSON_WRITER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard integer definitions */
+#include <cstddef> /* Standard size type and offsetof */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef JSON_WRITER_MAX_DEPTH
+/** @brief Defines the maximal nesting of objects and arrays, up to 32. */
+#define JSON_WRITER_MAX_DEPTH 16
+#endif
+
+/** @brief Defines the CBOR unsigned integer major type. */
+#define CBOR_MAJOR_UNSIGNED 0
+/** @brief Defines the CBOR negative integer major type. */
+#define CBOR_MAJOR_NEGATIVE 1
+/** @brief Defines the CBOR text string major type. */
+#define CBOR_MAJOR_TEXT 3
+/** @brief Defines the CBOR array major type. */
+#define CBOR_MAJOR_ARRAY 4
+/** @brief Defines the CBOR map major type. */
+#define CBOR_MAJOR_MAP 5
+/** @brief Defines the CBOR simple values major type. */
+#define CBOR_MAJOR_SIMPLE 7
+
+/** @brief Defines the CBOR additional information of a one byte argument. */
+#define CBOR_INFO_UINT8 24
+/** @brief Defines the CBOR additional information of the indefinite size. */
+#define CBOR_INFO_INDEFINITE 31
+/** @brief Defines the CBOR false simple value. */
+#define CBOR_SIMPLE_FALSE 20
+/** @brief Defines the CBOR true simple value. */
+#define CBOR_SIMPLE_TRUE 21
+/** @brief Defines the CBOR break byte, closing the indefinite containers. */
+#define CBOR_BREAK 0xFF
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/**
+ * @brief Describes a structure field in a JSON schema.
+ *
+ * @param[in] STRUCT The structure type.
+ * @param[in] MEMBER The structure member to serialize.
+ * @param[in] KEY The JSON key of the field.
+ * @param[in] TYPE The field type, an E_JsonFieldType value.
+ * @param[in] QUOTED Tells if the value is serialized as a JSON string.
+ */
+#define JSON_FIELD(STRUCT, MEMBER, KEY, TYPE, QUOTED)                       \
+    {                                                                       \
+        KEY,                                                                \
+        TYPE,                                                               \
+        offsetof(STRUCT, MEMBER),                                           \
+        sizeof(((STRUCT*)nullptr)->MEMBER),                                 \
+        QUOTED                                                              \
+    }
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the JSON schema field types. */
+typedef enum {
+    /** @brief bool field. */
+    JSON_FIELD_BOOL = 0,
+    /** @brief uint8_t field. */
+    JSON_FIELD_UINT8 = 1,
+    /** @brief uint16_t field. */
+    JSON_FIELD_UINT16 = 2,
+    /** @brief uint32_t field. */
+    JSON_FIELD_UINT32 = 3,
+    /** @brief uint64_t field. */
+    JSON_FIELD_UINT64 = 4,
+    /** @brief int32_t field. */
+    JSON_FIELD_INT32 = 5,
+    /** @brief Null terminated char array field. */
+    JSON_FIELD_STRING = 6
+} E_JsonFieldType;
+
+/** @brief Defines the document encodings. */
+typedef enum {
+    /** @brief JSON text. */
+    JSON_ENCODING_TEXT = 0,
+    /** @brief CBOR, RFC 8949, with the JSON data model. */
+    JSON_ENCODING_CBOR = 1
+} E_JsonEncoding;
+
+/** @brief JSON schema field descriptor. */
+typedef struct {
+    /** @brief The JSON key of the field. */
+    const char* pkKey;
+    /** @brief The field type. */
+    E_JsonFieldType type;
+    /** @brief The field offset in the structure. */
+    size_t offset;
+    /** @brief The field size in bytes, bounds the decoded strings. */
+    size_t size;
+    /**
+     * @brief Tells if the value is serialized as a JSON string. Booleans are
+     * then written as "0" or "1".
+     */
+    bool isQuoted;
+} S_JsonField;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The JsonWriter class.
+ *
+ * @details The JsonWriter class serializes JSON values in a fixed buffer. The
+ * separators are inserted by the writer. Keys are ignored inside arrays. When
+ * the buffer is full, the writer stops and reports the overflow, the buffer
+ * content is then invalid. The same calls produce a CBOR document when the
+ * CBOR encoding is selected: containers are indefinite length and the schema
+ * fields keep their native type.
+ */
+class JsonWriter {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief JsonWriter constructor.
+         *
+         * @details JsonWriter constructor. The buffer is kept null terminated.
+         *
+         * @param[out] pBuffer The buffer receiving the JSON document.
+         * @param[in] kSize The buffer size in bytes.
+         */
+        JsonWriter(char* pBuffer, const size_t kSize) noexcept;
+
+        /**
+         * @brief Empties the writer.
+         *
+         * @details Empties the writer. The overflow status is cleared.
+         */
+        void Reset(void) noexcept;
+
+        /**
+         * @brief Selects the document encoding.
+         *
+         * @details Selects the document encoding, the writer is emptied. The
+         * writer encodes JSON text by default.
+         *
+         * @param[in] kEncoding The encoding to use.
+         */
+        void SetEncoding(const E_JsonEncoding kEncoding) noexcept;
+
+        /**
+         * @brief Returns the document encoding.
+         *
+         * @return The document encoding is returned.
+         */
+        E_JsonEncoding GetEncoding(void) const noexcept;
+
+        /**
+         * @brief Returns the MIME type of the document.
+         *
+         * @return The MIME type of the document encoding is returned.
+         */
+        const char* GetContentType(void) const noexcept;
+
+        /**
+         * @brief Opens an object.
+         *
+         * @param[in] kpKey The object key, ignored inside arrays and for the
+         * root value.
+         */
+        void BeginObject(const char* kpKey = nullptr) noexcept;
+
+        /**
+         * @brief Closes the current object.
+         */
+        void EndObject(void) noexcept;
+
+        /**
+         * @brief Opens an array.
+         *
+         * @param[in] kpKey The array key, ignored inside arrays and for the
+         * root value.
+         */
+        void BeginArray(const char* kpKey = nullptr) noexcept;
+
+        /**
+         * @brief Closes the current array.
+         */
+        void EndArray(void) noexcept;
+
+        /**
+         * @brief Adds an escaped string value.
+         *
+         * @param[in] kpKey The value key.
+         * @param[in] kpValue The null terminated string to add.
+         */
+        void AddString(const char* kpKey, const char* kpValue) noexcept;
+
+        /**
+         * @brief Adds an unsigned integer value.
+         *
+         * @param[in] kpKey The value key.
+         * @param[in] kValue The value to add.
+         */
+        void AddUInt(const char* kpKey, const uint64_t kValue) noexcept;
+
+        /**
+         * @brief Adds a signed integer value.
+         *
+         * @param[in] kpKey The value key.
+         * @param[in] kValue The value to add.
+         */
+        void AddInt(const char* kpKey, const int64_t kValue) noexcept;
+
+        /**
+         * @brief Adds a boolean value.
+         *
+         * @param[in] kpKey The value key.
+         * @param[in] kValue The value to add.
+         */
+        void AddBool(const char* kpKey, const bool kValue) noexcept;
+
+        /**
+         * @brief Adds the fields of a structure.
+         *
+         * @details Adds the fields of a structure to the current object as
+         * described by the schema.
+         *
+         * @param[in] kpObject The structure to serialize.
+         * @param[in] kpSchema The structure fields descriptors.
+         * @param[in] kCount The number of fields in the schema.
+         */
+        void AddFields(const void*        kpObject,
+                       const S_JsonField* kpSchema,
+                       const size_t       kCount) noexcept;
+
+        /**
+         * @brief Returns the JSON document.
+         *
+         * @return The null terminated JSON document is returned. A CBOR
+         * document may embed null bytes, its size is given by GetSize.
+         */
+        const char* GetData(void) const noexcept;
+
+        /**
+         * @brief Returns the JSON document size.
+         *
+         * @return The JSON document size in bytes is returned, the terminator
+         * excluded.
+         */
+        size_t GetSize(void) const noexcept;
+
+        /**
+         * @brief Tells if the buffer overflowed.
+         *
+         * @return The function returns true if a value did not fit in the
+         * buffer or the maximal depth was exceeded, false otherwise.
+         */
+        bool IsOverflowed(void) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Writes the separator and the key of a new value.
+         *
+         * @param[in] kpKey The value key.
+         */
+        void WriteKey(const char* kpKey) noexcept;
+
+        /**
+         * @brief Opens an object or an array.
+         *
+         * @param[in] kpKey The container key.
+         * @param[in] kOpen The opening character.
+         */
+        void Open(const char* kpKey, const char kOpen) noexcept;
+
+        /**
+         * @brief Closes an object or an array.
+         *
+         * @param[in] kClose The closing character.
+         */
+        void Close(const char kClose) noexcept;
+
+        /**
+         * @brief Writes raw bytes.
+         *
+         * @param[in] kpData The bytes to write.
+         * @param[in] kSize The number of bytes to write.
+         */
+        void WriteRaw(const char* kpData, const size_t kSize) noexcept;
+
+        /**
+         * @brief Writes a string with the JSON escaping.
+         *
+         * @param[in] kpStr The null terminated string to write.
+         */
+        void WriteEscaped(const char* kpStr) noexcept;
+
+        /**
+         * @brief Writes the decimal representation of an integer.
+         *
+         * @param[in] kValue The value to write.
+         */
+        void WriteDigits(const uint64_t kValue) noexcept;
+
+        /**
+         * @brief Writes a CBOR data item head.
+         *
+         * @param[in] kMajor The major type of the item.
+         * @param[in] kValue The argument of the item.
+         */
+        void WriteCborHead(const uint8_t kMajor, const uint64_t kValue)
+        noexcept;
+
+        /**
+         * @brief Writes a CBOR text string.
+         *
+         * @param[in] kpStr The null terminated string to write.
+         */
+        void WriteCborString(const char* kpStr) noexcept;
+
+        /** @brief The buffer receiving the JSON document. */
+        char* _pBuffer;
+        /** @brief The buffer size in bytes. */
+        size_t _size;
+        /** @brief The number of bytes used in the buffer. */
+        size_t _used;
+        /** @brief The current nesting depth. */
+        uint32_t _depth;
+        /** @brief The containers holding values, one bit per depth. */
+        uint32_t _hasValues;
+        /** @brief The containers being arrays, one bit per depth. */
+        uint32_t _isArray;
+        /** @brief The document encoding. */
+        E_JsonEncoding _encoding;
+        /** @brief Tells if the buffer overflowed. */
+        bool _isOverflowed;
+};
+
+#endif /* #ifndef __JSON_WRITER_H__ */
@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * @file KeepAliveServer.h
+ *
+ * @see KeepAliveServer.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief HTTP server with persistent connections.
+ *
+ * @details HTTP server with persistent connections. The server keeps the
+ * client connections open between requests and serves the requests pipelined
+ * on a connection back to back.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __KEEP_ALIVE_SERVER_H__
+#define __KEEP_ALIVE_SERVER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>          /* Standard integer definitions */
+#include <cstddef>          /* Standard size type */
+#include <WiFi.h>           /* WiFi services */
+#include <WebServer.h>      /* Web server services */
+#include <lwip/sockets.h>   /* lwIP sockets readiness */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef KEEPALIVE_MAX_CLIENTS
+/** @brief Defines the maximal number of persistent connections. */
+#define KEEPALIVE_MAX_CLIENTS 4
+#endif
+
+#ifndef KEEPALIVE_IDLE_TIMEOUT_NS
+/** @brief Defines the idle time after which a connection is closed in ns. */
+#define KEEPALIVE_IDLE_TIMEOUT_NS 5000000000ULL
+#endif
+
+#ifndef KEEPALIVE_MAX_REQUESTS
+/** @brief Defines the maximal number of requests served per connection. */
+#define KEEPALIVE_MAX_REQUESTS 100
+#endif
+
+#ifndef KEEPALIVE_MAX_PIPELINE
+/**
+ * @brief Defines the maximal number of pipelined requests served on a
+ * connection before the other connections are served.
+ */
+#define KEEPALIVE_MAX_PIPELINE 8
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Persistent connection slot. */
+typedef struct {
+    /** @brief The connection client, not connected when the slot is free. */
+    WiFiClient client;
+    /** @brief The time of the last request in ns. */
+    uint64_t lastActivity;
+    /** @brief The number of requests served on the connection. */
+    uint32_t requests;
+} S_KeepAliveSlot;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The KeepAliveServer class.
+ *
+ * @details The KeepAliveServer class serves HTTP/1.1 persistent connections.
+ * The framework server closes the client after every response, this server
+ * keeps up to KEEPALIVE_MAX_CLIENTS connections open and closes them when
+ * idle, on client request or after KEEPALIVE_MAX_REQUESTS requests. Only the
+ * responses sent with SendResponse keep the connection open, the responses
+ * sent with the framework send functions announce and perform a close.
+ */
+class KeepAliveServer : public WebServer {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief KeepAliveServer constructor.
+         *
+         * @param[in] kPort The listening port.
+         */
+        KeepAliveServer(const uint16_t kPort) noexcept;
+
+        /**
+         * @brief Serves the connections.
+         *
+         * @details Serves the connections. A pending connection is accepted
+         * or refused when all the slots are used. The buffered requests of
+         * each connection are then served and the idle connections closed.
+         * This replaces the framework handleClient.
+         */
+        void HandleClients(void) noexcept;
+
+        /**
+         * @brief Adds the connections sockets to a select set.
+         *
+         * @param[out] rSet The set receiving the sockets.
+         * @param[in, out] rMaxSocket The highest socket of the set.
+         * @param[out] rHasData Set to true if a connection has buffered data.
+         *
+         * @return true if a connection is open, false otherwise.
+         */
+        bool AddWaitSockets(fd_set& rSet,
+                            int&    rMaxSocket,
+                            bool&   rHasData) noexcept;
+
+        /**
+         * @brief Sends a response on the current connection.
+         *
+         * @details Sends a response on the current connection. The response
+         * announces the connection persistence unless the connection closes
+         * after this request.
+         *
+         * @param[in] kCode The response HTTP code.
+         * @param[in] kpType The response content type.
+         * @param[in] kpData The response body.
+         * @param[in] kSize The response body size in bytes.
+         */
+        void SendResponse(const int32_t kCode,
+                          const char*   kpType,
+                          const char*   kpData,
+                          const size_t  kSize) noexcept;
+
+        /**
+         * @brief Starts a streamed response on the current connection.
+         * @details Starts a streamed response on the current connection. The
+         * body is sent in chunks of unknown total size, the connection stays
+         * open when the stream ends completely. The HTTP/1.0 clients receive
+         * a raw body ended by the connection close.
+         * @param[in] kCode The response HTTP code.
+         * @param[in] kpType The response content type.
+         * @return true if the header was sent, false otherwise.
+         */
+        bool BeginStream(const int32_t kCode, const char* kpType) noexcept;
+
+        /**
+         * @brief Sends a chunk of a streamed response.
+         * @details Sends a chunk of a streamed response. Once a chunk failed,
+         * the next chunks are dropped and the connection is closed.
+         * @param[in] kpData The chunk data.
+         * @param[in] kSize The chunk size in bytes.
+         * @return true if the stream is still valid, false otherwise.
+         */
+        bool SendChunk(const char* kpData, const size_t kSize) noexcept;
+
+        /** @brief Ends a streamed response on the current connection. */
+        void EndStream(void) noexcept;
+
+        /**
+         * @brief Returns the body size of the last streamed response.
+         *
+         * @return The number of body bytes sent since the stream began is
+         * returned.
+         */
+        size_t GetStreamSize(void) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief Accepts a pending connection. */
+        void Accept(void) noexcept;
+
+        /**
+         * @brief Serves the buffered requests of a connection.
+         *
+         * @param[in, out] rSlot The connection slot.
+         */
+        void Serve(S_KeepAliveSlot& rSlot) noexcept;
+
+        /**
+         * @brief Tells if the connection closes after the current request.
+         *
+         * @return true if the client or the requests limit asks for a close.
+         */
+        bool IsClosing(void) noexcept;
+
+        /**
+         * @brief Sends the header of a response.
+         * @param[in] kCode The response HTTP code.
+         * @param[in] kpType The response content type.
+         * @param[in] kSize The response body size, ignored for a stream.
+         * @param[in] kIsStream Tells if the body size is unknown.
+         * @param[in] kIsClosing Tells if the connection closes after the
+         * response.
+         * @return The size of the sent header, 0 on error.
+         */
+        size_t WriteHeader(const int32_t kCode,
+                           const char*   kpType,
+                           const size_t  kSize,
+                           const bool    kIsStream,
+                           const bool    kIsClosing) noexcept;
+
+        /** @brief The persistent connections slots. */
+        S_KeepAliveSlot _pSlots[KEEPALIVE_MAX_CLIENTS];
+        /** @brief The slot of the request being served. */
+        S_KeepAliveSlot* _pCurrentSlot;
+        /** @brief Tells if the current response kept the connection open. */
+        bool _isKeptAlive;
+        /** @brief Tells if the current stream is sent in chunks. */
+        bool _isChunked;
+        /** @brief Tells if the current stream is still being sent. */
+        bool _isStreamValid;
+        /** @brief The body bytes sent in the current stream. */
+        size_t _streamSize;
+};
+
+#endif /* #ifndef __KEEP_ALIVE_SERVER_H__ */
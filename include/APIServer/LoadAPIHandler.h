@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * @file LoadAPIHandler.h
+ *
+ * @see LoadAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Load statistics API handler.
+ *
+ * @details Load statistics API handler. This file defines the Load API
+ * handler used to report the device side counters of the load benchmarks.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __LOAD_API_HANDLER_H__
+#define __LOAD_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <WebServer.h>    /* Web Server services */
+#include <JsonWriter.h>   /* JSON response writer */
+#include <APIRequest.h>   /* API call parameters */
+#include <APIHandler.h>   /* API Handler interface */
+#include <HandlerStats.h> /* Request handlers statistics */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The LoadAPIHandler class.
+ *
+ * @details The LoadAPIHandler class provides the necessary functions to
+ * report the service time and heap low-water of each request handler over
+ * the statistics window. The "reset" parameter set to 1 starts a new window
+ * once the statistics are reported.
+ */
+class LoadAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Destroys a LoadAPIHandler.
+         *
+         * @details Destroys a LoadAPIHandler. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        virtual ~LoadAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Generate the page. The function should generate API response
+         * and process the API call.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The handler statistics being formatted. */
+        S_HandlerStats _stats;
+};
+
+#endif /* #ifndef __LOAD_API_HANDLER_H__ */
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * @file MetricsAPIHandler.h
+ *
+ * @see MetricsAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Metrics API handler.
+ *
+ * @details Metrics API handler. This file defines the Metrics API handler
+ * used to export the firmware counters in the Prometheus text format.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __METRICS_API_HANDLER_H__
+#define __METRICS_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>           /* Standard integer definitions */
+#include <cstddef>           /* Standard size type */
+#include <JsonWriter.h>      /* JSON response writer */
+#include <APIRequest.h>      /* API call parameters */
+#include <APIHandler.h>      /* API Handler interface */
+#include <HealthMonitor.h>   /* Reporters status */
+#include <KeepAliveServer.h> /* Persistent connections server */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef METRICS_CHUNK_SIZE
+/** @brief Defines the size of the streamed response chunks in bytes. */
+#define METRICS_CHUNK_SIZE 1024
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The MetricsAPIHandler class.
+ *
+ * @details The MetricsAPIHandler class provides the necessary functions to
+ * handle a Metrics call through the API. The counters are read when the
+ * scrape is served and sent in chunks, nothing is gathered in between
+ * scrapes. The label values are firmware identifiers (reporter names, routes
+ * paths) and are not escaped.
+ */
+class MetricsAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /** @brief MetricsAPIHandler constructor. */
+        MetricsAPIHandler(void) noexcept;
+
+        /**
+         * @brief Destroys a MetricsAPIHandler.
+         *
+         * @details Destroys a MetricsAPIHandler. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        virtual ~MetricsAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Handle the API call. The metrics are streamed in the
+         * Prometheus text format and cannot be gathered in a batch response,
+         * an error is returned.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+        /**
+         * @brief Streams the response of a Metrics call.
+         *
+         * @details Streams the response of a Metrics call: the Health Monitor
+         * reporters, the watchdog misses, the requests per route, the log
+         * lines per level, the SD card writes and the memory and WiFi gauges.
+         *
+         * @param[in, out] pServer The server sending the response.
+         */
+        void Stream(KeepAliveServer* pServer) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Adds data to the current chunk, the chunk is sent first when
+         * the data does not fit.
+         *
+         * @param[in] kpData The data to add.
+         * @param[in] kSize The data size in bytes.
+         *
+         * @return true if the stream is still valid, false otherwise.
+         */
+        bool Write(const char* kpData, const size_t kSize) noexcept;
+
+        /**
+         * @brief Adds the help and type lines of a metric.
+         *
+         * @param[in] kpName The metric name.
+         * @param[in] kpType The metric type, counter or gauge.
+         * @param[in] kpHelp The metric description.
+         *
+         * @return true if the stream is still valid, false otherwise.
+         */
+        bool WriteHeader(const char* kpName,
+                         const char* kpType,
+                         const char* kpHelp) noexcept;
+
+        /**
+         * @brief Adds a sample of a metric.
+         *
+         * @param[in] kpName The metric name.
+         * @param[in] kpLabels The formatted labels with their braces, empty
+         * when the metric has no label.
+         * @param[in] kValue The sample value.
+         *
+         * @return true if the stream is still valid, false otherwise.
+         */
+        bool WriteSample(const char*   kpName,
+                         const char*   kpLabels,
+                         const int64_t kValue) noexcept;
+
+        /** @brief The server of the current stream. */
+        KeepAliveServer* _pServer;
+        /** @brief The reporters snapshot, too large for the servers stack. */
+        S_HMReporterStatus _pReporters[HM_MAX_REPORTERS];
+        /** @brief The used size of the current chunk. */
+        size_t _chunkSize;
+        /** @brief The current chunk. */
+        char _pChunk[METRICS_CHUNK_SIZE];
+};
+
+#endif /* #ifndef __METRICS_API_HANDLER_H__ */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * @file MonitorAPIHandler.h
+ *
+ * @see MonitorAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief System monitor API handler.
+ *
+ * @details System monitor API handler. This file defines the Monitor API
+ * handler used to report the tasks, memory and sockets usage over the
+ * monitor time window.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __MONITOR_API_HANDLER_H__
+#define __MONITOR_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>         /* Standard integer definitions */
+#include <WebServer.h>     /* Web Server services */
+#include <JsonWriter.h>    /* JSON response writer */
+#include <APIRequest.h>    /* API call parameters */
+#include <APIHandler.h>    /* API Handler interface */
+#include <SystemMonitor.h> /* Monitor samples */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The MonitorAPIHandler class.
+ *
+ * @details The MonitorAPIHandler class provides the necessary functions to
+ * handle a system monitor call through the API. The memory and sockets usage
+ * are reported for each sample of the window. The tasks of the newest sample
+ * are reported with their peak CPU usage and lowest free stack over the
+ * window.
+ */
+class MonitorAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Destroys a MonitorAPIHandler.
+         *
+         * @details Destroys a MonitorAPIHandler. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        virtual ~MonitorAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Generate the page. The function should generate API response
+         * and process the API call.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The newest sample. */
+        S_SysMonSample _latest;
+        /** @brief The window sample being formatted. */
+        S_SysMonSample _sample;
+        /** @brief The peak CPU usage of the newest sample tasks. */
+        uint16_t _pCpuMax[SYSMON_MAX_TASKS];
+        /** @brief The lowest free stack of the newest sample tasks. */
+        uint32_t _pStackMin[SYSMON_MAX_TASKS];
+};
+
+#endif /* #ifndef __MONITOR_API_HANDLER_H__ */
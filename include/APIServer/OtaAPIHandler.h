@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * @file OtaAPIHandler.h
+ *
+ * @see OtaAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware update API handler.
+ *
+ * @details Firmware update API handler. This file defines the OTA API handler
+ * used to stream a firmware image into the inactive application partition.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __OTA_API_HANDLER_H__
+#define __OTA_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <Errors.h>     /* Errors definitions */
+#include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIRequest.h> /* API call parameters */
+#include <APIHandler.h> /* API Handler interface */
+#include <OtaUpdater.h> /* Firmware update writer */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the header giving the offset of a transfer. */
+#define API_OTA_OFFSET_HEADER "X-OTA-Offset"
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The OtaAPIHandler class.
+ *
+ * @details The OtaAPIHandler class provides the necessary functions to update
+ * the firmware. Without parameters the update status is reported, "mode" set
+ * to "begin" with "size" and "sha256" starts or resumes an update, "finish"
+ * verifies the image and selects it for the next boot and "abort" stops the
+ * update. The image is sent to the data route as a raw body, starting at the
+ * offset reported in the status and given in the X-OTA-Offset header.
+ */
+class OtaAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /** @brief OtaAPIHandler constructor. */
+        OtaAPIHandler(void) noexcept;
+
+        /**
+         * @brief Destroys a OtaAPIHandler.
+         *
+         * @details Destroys a OtaAPIHandler. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        virtual ~OtaAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Generate the page. The function should generate API response
+         * and process the API call.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+        /**
+         * @brief Receives a part of the image.
+         *
+         * @details Receives a part of the image sent to the data route. An
+         * interrupted transfer keeps the received data, the next transfer
+         * resumes after them.
+         *
+         * @param[in] krOffset The offset header of the transfer.
+         * @param[in] krRaw The body part.
+         */
+        void Receive(const String& krOffset, const HTTPRaw& krRaw) noexcept;
+
+        /**
+         * @brief Handles the end of a transfer to the data route.
+         *
+         * @param[out] rWriter The writer receiving the response.
+         */
+        void HandleTransfer(JsonWriter& rWriter) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Adds the update status to the response.
+         *
+         * @param[out] rWriter The writer receiving the response.
+         * @param[in] kError The result of the call.
+         */
+        void FormatStatus(JsonWriter& rWriter, const E_Return kError) noexcept;
+
+        /**
+         * @brief Starts an update from the call parameters.
+         *
+         * @param[in] krRequest The call parameters.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Begin(const APIRequest& krRequest) noexcept;
+
+        /** @brief The firmware update writer. */
+        OtaUpdater _updater;
+        /** @brief The result of the current transfer. */
+        E_Return _transferError;
+};
+
+#endif /* #ifndef __OTA_API_HANDLER_H__ */
@@ -23,8 +23,9 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <string>       /* Standard strings */
 #include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIRequest.h> /* API call parameters */
 #include <APIHandler.h> /* API Handler interface */
 
 /*******************************************************************************
@@ -94,11 +95,12 @@ class PingAPIHandler : public APIHandler {
          * @details Generate the page. The function should generate API response
          * and process the API call.
          *
-         * @param[out] rResponse The response to the API call.
-         * @param[in] pServer The server that received the call. Used to
-         * retrieve the call parameters.
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
          */
-        virtual void Handle(std::string& rResponse, WebServer* pServer) noexcept;
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
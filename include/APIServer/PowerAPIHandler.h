@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * @file PowerAPIHandler.h
+ *
+ * @see PowerAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief WiFi power-save API handler.
+ *
+ * @details WiFi power-save API handler. This file defines the Power API
+ * handler used to set the request latency budget and report the estimated
+ * current draw.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __POWER_API_HANDLER_H__
+#define __POWER_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIRequest.h> /* API call parameters */
+#include <APIHandler.h> /* API Handler interface */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The PowerAPIHandler class.
+ *
+ * @details The PowerAPIHandler class provides the necessary functions to handle
+ * a WiFi power-save call through the API.
+ */
+class PowerAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Destroys a PowerAPIHandler.
+         *
+         * @details Destroys a PowerAPIHandler. Since only one object is allowed
+         * in the firmware, the destructor will generate a critical error.
+         */
+        virtual ~PowerAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Generate the page. The function should generate API response
+         * and process the API call.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Adds the power-save statistics to the response.
+         *
+         * @param[out] rWriter The writer receiving the response.
+         */
+        static void FormatStats(JsonWriter& rWriter) noexcept;
+};
+
+#endif /* #ifndef __POWER_API_HANDLER_H__ */
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * @file TasksAPIHandler.h
+ *
+ * @see TasksAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Tasks placement API handler.
+ *
+ * @details Tasks placement API handler. This file defines the Tasks API
+ * handler used to report and override the core, priority and stack size of
+ * the firmware tasks.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __TASKS_API_HANDLER_H__
+#define __TASKS_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <WebServer.h>    /* Web Server services */
+#include <JsonWriter.h>   /* JSON response writer */
+#include <APIRequest.h>   /* API call parameters */
+#include <APIHandler.h>   /* API Handler interface */
+#include <TaskRegistry.h> /* Firmware tasks registry */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The TasksAPIHandler class.
+ *
+ * @details The TasksAPIHandler class provides the necessary functions to
+ * report the tasks placements and store their overrides. Without parameters
+ * the placements are reported, "task" with "core", "prio" and "stack" stores
+ * an override and "task" with "clear" set to 1 removes it. The overrides
+ * apply at the next boot. The stack peaks measured by the system monitor
+ * are reported with the placements.
+ */
+class TasksAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Destroys a TasksAPIHandler.
+         *
+         * @details Destroys a TasksAPIHandler. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        virtual ~TasksAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Generate the page. The function should generate API response
+         * and process the API call.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Adds the tasks placements to the response.
+         *
+         * @param[out] rWriter The writer receiving the response.
+         */
+        static void FormatTasks(JsonWriter& rWriter) noexcept;
+
+        /**
+         * @brief Parses the placement of an override call.
+         *
+         * @param[in] krRequest The call parameters.
+         * @param[out] rConfig The buffer receiving the placement.
+         *
+         * @return true is returned when all the values are numbers.
+         */
+        static bool ParseConfig(const APIRequest& krRequest,
+                                S_TaskConfig&     rConfig) noexcept;
+};
+
+#endif /* #ifndef __TASKS_API_HANDLER_H__ */
\ No newline at end of file
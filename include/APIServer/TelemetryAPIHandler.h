@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * @file TelemetryAPIHandler.h
+ *
+ * @see TelemetryAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Telemetry settings API handler.
+ *
+ * @details Telemetry settings API handler. This file defines the Telemetry
+ * API handler used to read and store the telemetry publisher configuration.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __TELEMETRY_API_HANDLER_H__
+#define __TELEMETRY_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <WebServer.h>          /* Web Server services */
+#include <JsonWriter.h>         /* JSON response writer */
+#include <APIRequest.h>         /* API call parameters */
+#include <APIHandler.h>         /* API Handler interface */
+#include <TelemetryPublisher.h> /* Telemetry configuration */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The TelemetryAPIHandler class.
+ *
+ * @details The TelemetryAPIHandler class provides the necessary functions to
+ * handle a telemetry settings call through the API.
+ */
+class TelemetryAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Destroys a TelemetryAPIHandler.
+         *
+         * @details Destroys a TelemetryAPIHandler. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        virtual ~TelemetryAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Generate the page. The function should generate API response
+         * and process the API call.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Adds the stored telemetry configuration to the response.
+         *
+         * @param[out] rWriter The writer receiving the response.
+         */
+        static void FormatConfig(JsonWriter& rWriter) noexcept;
+
+        /**
+         * @brief Parses the telemetry configuration parameters.
+         *
+         * @param[in] krRequest The call parameters.
+         * @param[out] rConfig The parsed configuration.
+         *
+         * @return true if all the parameters are numbers in range, false
+         * otherwise.
+         */
+        static bool ParseConfig(const APIRequest&  krRequest,
+                                S_TelemetryConfig& rConfig) noexcept;
+};
+
+#endif /* #ifndef __TELEMETRY_API_HANDLER_H__ */
\ No newline at end of file
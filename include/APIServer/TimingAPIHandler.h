@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * @file TimingAPIHandler.h
+ *
+ * @see TimingAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Timing API handler.
+ *
+ * @details Timing API handler. This file defines the Timing API handler
+ * used to report the periodic tasks timing statistics.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __TIMING_API_HANDLER_H__
+#define __TIMING_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIRequest.h> /* API call parameters */
+#include <Timeout.h>    /* Timeout statistics */
+#include <APIHandler.h> /* API Handler interface */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The TimingAPIHandler class.
+ *
+ * @details The TimingAPIHandler class provides the necessary functions to
+ * report the period, jitter and execution time histograms of the timeouts
+ * recording statistics.
+ */
+class TimingAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Destroys a TimingAPIHandler.
+         *
+         * @details Destroys a TimingAPIHandler. Since only one object is allowed
+         * in the firmware, the destructor will generate a critical error.
+         */
+        virtual ~TimingAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Generate the page. The function should generate API response
+         * and process the API call.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Formats a timing histogram.
+         *
+         * @details Formats the minimum, maximum, median and 99th percentile of
+         * a timing histogram as a JSON object, in microseconds.
+         *
+         * @param[out] rWriter The response writer.
+         * @param[in] kpKey The key of the histogram object.
+         * @param[in] krHistogram The histogram to format.
+         */
+        static void FormatHistogram(JsonWriter&               rWriter,
+                                    const char*               kpKey,
+                                    const S_TimeoutHistogram& krHistogram)
+        noexcept;
+};
+
+#endif /* #ifndef __TIMING_API_HANDLER_H__ */
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * @file TraceAPIHandler.h
+ *
+ * @see TraceAPIHandler.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Trace API handler.
+ *
+ * @details Trace API handler. This file defines the Trace API handler used
+ * to start and stop the tracing and to export the recorded events.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __TRACE_API_HANDLER_H__
+#define __TRACE_API_HANDLER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>           /* Standard integer definitions */
+#include <Tracer.h>          /* Events tracer */
+#include <JsonWriter.h>      /* JSON response writer */
+#include <APIRequest.h>      /* API call parameters */
+#include <APIHandler.h>      /* API Handler interface */
+#include <KeepAliveServer.h> /* Persistent connections server */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef TRACE_CHUNK_SIZE
+/** @brief Defines the size of the streamed response chunks in bytes. */
+#define TRACE_CHUNK_SIZE 1024
+#endif
+
+static_assert(TRACE_ITEM_SIZE <= TRACE_CHUNK_SIZE,
+              "A trace chunk must hold a trace item");
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+ /**
+ * @brief The TraceAPIHandler class.
+ *
+ * @details The TraceAPIHandler class provides the necessary functions to
+ * handle a Trace call through the API. A call with the "state" parameter
+ * starts (1) or stops (0) the tracing, a call without parameter streams the
+ * recorded events in the Chrome trace event format.
+ */
+class TraceAPIHandler : public APIHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /** @brief TraceAPIHandler constructor. */
+        TraceAPIHandler(void) noexcept;
+
+        /**
+         * @brief Destroys a TraceAPIHandler.
+         *
+         * @details Destroys a TraceAPIHandler. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        virtual ~TraceAPIHandler(void) noexcept;
+
+        /**
+         * @brief Handle the API call.
+         *
+         * @details Handle the API call. Sets the tracing state and responds
+         * with the state, the events cannot be gathered in a batch response.
+         *
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
+         */
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
+
+        /**
+         * @brief Streams the recorded events.
+         *
+         * @param[in, out] pServer The server sending the response.
+         * @param[in] krRequest The call parameters.
+         *
+         * @return true if the events were streamed, false if the call sets
+         * the tracing state and must be handled by Handle.
+         */
+        bool Stream(KeepAliveServer*  pServer,
+                    const APIRequest& krRequest) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The export of the current stream. */
+        S_TraceExport _export;
+        /** @brief The current chunk. */
+        char _pChunk[TRACE_CHUNK_SIZE];
+};
+
+#endif /* #ifndef __TRACE_API_HANDLER_H__ */
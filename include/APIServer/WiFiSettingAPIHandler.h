@@ -23,9 +23,11 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <string>       /* Standard strings */
 #include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIRequest.h> /* API call parameters */
 #include <APIHandler.h> /* API Handler interface */
+#include <WiFiModule.h> /* WiFi configuration */
 
 /*******************************************************************************
  * CONSTANTS
@@ -94,12 +96,12 @@ class WiFiSettingAPIHandler : public APIHandler {
          * @details Generate the page. The function should generate API response
          * and process the API call.
          *
-         * @param[out] rResponse The response to the API call.
-         * @param[in] pServer The server that received the call. Used to
-         * retrieve the call parameters.
+         * @param[out] rWriter The writer receiving the response to the API
+         * call.
+         * @param[in] krRequest The call parameters.
          */
-        virtual void Handle(std::string& rResponse, WebServer* pServer)
-        noexcept;
+        virtual void Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -113,9 +115,9 @@ class WiFiSettingAPIHandler : public APIHandler {
          * @details Retrieves the WiFi settings and fills the API response with
          * the registered settings.
          *
-         * @param[out] rResponse The JSON buffer to fill with the WiFi settings.
+         * @param[out] rWriter The writer to fill with the WiFi settings.
          */
-        void GetWiFiSettings(std::string& rResponse) const noexcept;
+        void GetWiFiSettings(JsonWriter& rWriter) const noexcept;
 
         /**
          * @brief Updates the WiFi settings.
@@ -123,11 +125,39 @@ class WiFiSettingAPIHandler : public APIHandler {
          * @details Updates the WiFi settings and fills the API response with
          * the update status settings.
          *
-         * @param[in] pServer The server that received the request. Used to
-         * retrieve the settings values.
-         * @param[out] rResponse The JSON buffer to fill with the WiFi settings.
+         * @param[in] krRequest The call parameters holding the settings
+         * values.
+         * @param[out] rWriter The writer to fill with the update status.
+         */
+        void SetWiFiSettings(const APIRequest& krRequest,
+                             JsonWriter&       rWriter) const noexcept;
+
+        /**
+         * @brief Updates the WiFi settings from a CBOR body.
+         *
+         * @details Updates the WiFi settings from a CBOR body. The body is a
+         * map of the settings schema, decoded in one pass. All the settings
+         * are required.
+         *
+         * @param[in] kpBody The CBOR body.
+         * @param[in] kSize The body size in bytes.
+         * @param[out] rWriter The writer to fill with the update status.
+         */
+        void SetWiFiSettings(const uint8_t* kpBody,
+                             const size_t   kSize,
+                             JsonWriter&    rWriter) const noexcept;
+
+        /**
+         * @brief Applies a WiFi settings update.
+         *
+         * @details Applies a WiFi settings update and fills the API response
+         * with the update status.
+         *
+         * @param[in] krConfig The settings to apply.
+         * @param[out] rWriter The writer to fill with the update status.
          */
-        void SetWiFiSettings(WebServer* pServer, std::string& rResponse) const
+        void ApplyWiFiSettings(const S_WiFiConfigRequest& krConfig,
+                               JsonWriter&                rWriter) const
         noexcept;
 };
 
@@ -24,6 +24,7 @@
  * INCLUDES
  ******************************************************************************/
 #include <SPI.h>     /* SPI bus */
+#include <atomic>    /* Standard atomic types */
 #include <string>    /* Standard string */
 #include <cstdint>   /* Standard int types */
 #include <Arduino.h> /* Arduino Framework */
@@ -31,7 +32,8 @@
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/* None */
+/** @brief Defines the duration of a tick in microseconds. */
+#define HW_TICK_US ((uint64_t)portTICK_PERIOD_MS * 1000ULL)
 
 /*******************************************************************************
  * MACROS
@@ -61,8 +63,24 @@ typedef enum {
     GPIO_SPI_SCK = GPIO_NUM_17,
     /** @brief SPI MISO Pin */
     GPIO_SPI_MISO = GPIO_NUM_18,
+    /** @brief SPI BME280 sensor CS Pin */
+    GPIO_SPI_CS_BME280 = GPIO_NUM_14,
+    /** @brief I2C SDA Pin */
+    GPIO_I2C_SDA = GPIO_NUM_8,
+    /** @brief I2C SCL Pin */
+    GPIO_I2C_SCL = GPIO_NUM_9,
 } E_GPIORouting;
 
+/** @brief Time snapshot of a tick. */
+typedef struct {
+    /** @brief Snapshot sequence lock, odd while updating. */
+    std::atomic<uint32_t> sequence;
+    /** @brief The tick of the snapshot. */
+    TickType_t tick;
+    /** @brief The time of the snapshot in nanoseconds. */
+    uint64_t time;
+} S_TimeSnapshot;
+
 /*******************************************************************************
  * GLOBAL VARIABLES
  ******************************************************************************/
@@ -135,16 +153,62 @@ class HWManager
          */
         static uint64_t GetTime(void) noexcept;
 
+        /**
+         * @brief Returns the cached time of the current tick in nanoseconds.
+         *
+         * @details Returns the cached time of the current tick in
+         * nanoseconds. The time is read once per tick and core, the other
+         * calls of the tick return the same snapshot. The value is up to a
+         * tick late and must only be used for timestamps and deadlines with
+         * a tick resolution.
+         *
+         * @return The time of the tick snapshot is returned.
+         */
+        static uint64_t GetTickTime(void) noexcept;
+
+        /**
+         * @brief Returns the CPU cycle counter.
+         *
+         * @details Returns the CPU cycle counter (CCOUNT). The counter is
+         * specific to each core and wraps in a few seconds, it must only be
+         * used for sub-millisecond measurements within a task pinned to a
+         * core.
+         *
+         * @return The current cycle count is returned.
+         */
+        static uint32_t GetCycleCount(void) noexcept;
+
+        /**
+         * @brief Converts a number of CPU cycles to nanoseconds.
+         *
+         * @param[in] kCycles The number of cycles.
+         *
+         * @return The duration of the cycles in nanoseconds is returned.
+         */
+        static uint64_t CyclesToNs(const uint32_t kCycles) noexcept;
+
         /**
          * @brief Delays the calling thread.
          *
          * @details Delays the calling thread, if possible the passive option
-         * will be used. If not, active wait will be made.
+         * will be used. If not, active wait will be made. The task sleeps
+         * the whole ticks of the delay and only spins for the last partial
+         * tick. Interrupts and delays before the scheduler starts spin.
+         * Nothing is armed on behalf of the caller, the function can be
+         * called from any task, including the esp_timer task.
          *
          * @param[in] kDelayNs The details to wait in nanoseconds.
          */
         static void DelayExecNs(const uint64_t kDelayNs) noexcept;
 
+        /**
+         * @brief Returns the time spent spinning in the delays.
+         *
+         * @return The cumulated busy-wait time of DelayExecNs in
+         * nanoseconds is returned.
+         */
+        static uint64_t GetBusyWaitTime(void) noexcept;
+
 
         /**
          * @brief Returns the configured SPI bus.
@@ -162,7 +226,8 @@ class HWManager
          * function.
          *
          * @param[in] kSetMaintenance Tells if the maintenance mode should be
-         * set upon rebooting.
+         * set upon rebooting. The mode is recorded in the boot record, the
+         * restart is always a software one.
          */
         static void Reboot(const bool kSetMaintenance) noexcept;
 
@@ -180,6 +245,12 @@ class HWManager
         static SPIClass _SSPIBUS;
         /** @brief Tells if the SPI bus is initialized. */
         static bool _SSPIINIT;
+        /** @brief Stores the CPU frequency in MHz, 0 until first used. */
+        static uint32_t _SCPUFREQMHZ;
+        /** @brief Stores the tick time snapshots of each core. */
+        static S_TimeSnapshot _STIMESNAPSHOTS[portNUM_PROCESSORS];
+        /** @brief Stores the cumulated busy-wait time in nanoseconds. */
+        static std::atomic<uint64_t> _SBUSYWAITNS;
 };
 
 
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * @file BootRecord.h
+ *
+ * @see BootRecord.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Boot mode and reset record.
+ *
+ * @details Boot mode and reset record. The execution mode and the cause of the
+ * last reset are kept in the RTC memory, which survives the software and
+ * watchdog resets. The mode is also stored in the NVS for the power cycles.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __BOOT_RECORD_H__
+#define __BOOT_RECORD_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the size of the reset context, null terminated. */
+#define BOOT_RECORD_CONTEXT_SIZE 64
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the allowed execution modes for the firmware. */
+typedef enum {
+    /** @brief Nominal execution mode. */
+    MODE_NOMINAL,
+    /** @brief Maintenance execution mode. */
+    MODE_MAINTENANCE,
+    /** @brief Faulted execution mode. */
+    MODE_FAULTED
+} E_Mode;
+
+/** @brief Defines the firmware reset causes, by increasing severity. */
+typedef enum {
+    /** @brief The firmware did not record the reset. */
+    RESET_CAUSE_NONE = 0,
+    /** @brief Reboot requested by a mode or settings change. */
+    RESET_CAUSE_REQUEST = 1,
+    /** @brief Reboot after a critical error. */
+    RESET_CAUSE_CRITICAL = 2
+} E_ResetCause;
+
+/** @brief Last reset information. */
+typedef struct {
+    /** @brief The firmware reset cause. */
+    E_ResetCause cause;
+    /** @brief The hardware reset reason, as given by esp_reset_reason. */
+    uint32_t hwReason;
+    /** @brief The number of boots since the RTC memory was lost. */
+    uint32_t bootCount;
+    /** @brief Tells if the record came from the RTC memory. */
+    bool isRtcValid;
+    /** @brief The reset context, the reason or critical error message. */
+    char pContext[BOOT_RECORD_CONTEXT_SIZE];
+} S_ResetInfo;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The BootRecord class.
+ *
+ * @details The BootRecord class keeps the execution mode and the reset cause
+ * across resets without the SD card. The RTC record is validated by its
+ * marker and checksum. When it is lost, on a power cycle, the mode is read
+ * from its NVS copy and the reset has no recorded cause. The flash is only
+ * written by the mode changes, never on the critical error path.
+ */
+class BootRecord {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Loads the record of the previous boot.
+         *
+         * @details Loads the record of the previous boot and starts the record
+         * of the current one. Must be called once, before the mode is read.
+         */
+        static void Load(void) noexcept;
+
+        /**
+         * @brief Returns the execution mode to boot.
+         *
+         * @return The recorded mode is returned, the maintenance mode when no
+         * mode was ever recorded.
+         */
+        static E_Mode GetMode(void) noexcept;
+
+        /**
+         * @brief Records the execution mode of the next boots.
+         *
+         * @param[in] kMode The mode to record.
+         *
+         * @return The function returns the success or error status. The RTC
+         * record is always updated, an error means the NVS copy was not.
+         */
+        static E_Return SetMode(const E_Mode kMode) noexcept;
+
+        /**
+         * @brief Records the cause of the coming reset.
+         *
+         * @details Records the cause of the coming reset. A cause only
+         * replaces a less severe one, the first context of a cause is kept.
+         *
+         * @param[in] kCause The reset cause.
+         * @param[in] kpContext The reset context, truncated to the record.
+         */
+        static void SetResetCause(const E_ResetCause kCause,
+                                  const char*        kpContext) noexcept;
+
+        /**
+         * @brief Returns the record of the last reset.
+         *
+         * @param[out] rInfo The buffer receiving the record.
+         */
+        static void GetLastReset(S_ResetInfo& rInfo) noexcept;
+
+        /**
+         * @brief Returns the name of a reset cause.
+         *
+         * @param[in] kCause The cause to get.
+         *
+         * @return The name of the cause is returned.
+         */
+        static const char* GetCauseName(const E_ResetCause kCause) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Reads the execution mode from the NVS.
+         */
+        static void LoadNvs(void) noexcept;
+
+        /**
+         * @brief Writes the execution mode to the NVS.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return StoreNvs(void) noexcept;
+
+        /** @brief The record of the last reset. */
+        static S_ResetInfo _SLASTRESET;
+};
+
+#endif /* #ifndef __BOOT_RECORD_H__ */
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * @file BootTrace.h
+ *
+ * @see BootTrace.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Boot phases timing trace.
+ *
+ * @details Boot phases timing trace. The time at which each boot phase
+ * completed is recorded in a fixed table, kept for the whole execution.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __BOOT_TRACE_H__
+#define __BOOT_TRACE_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard integer definitions */
+#include <atomic>  /* Atomic timestamps */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the traced boot phases. */
+typedef enum {
+    /** @brief Firmware setup entered. */
+    BOOT_PHASE_SETUP = 0,
+    /** @brief Storage mounted. */
+    BOOT_PHASE_STORAGE = 1,
+    /** @brief Execution mode selected. */
+    BOOT_PHASE_MODE = 2,
+    /** @brief Health monitor started. */
+    BOOT_PHASE_HM = 3,
+    /** @brief Settings initialized. */
+    BOOT_PHASE_SETTINGS = 4,
+    /** @brief IO managers and task started. */
+    BOOT_PHASE_IO = 5,
+    /** @brief WiFi started and connected. */
+    BOOT_PHASE_WIFI = 6,
+    /** @brief Web and API servers started. */
+    BOOT_PHASE_SERVERS = 7,
+    /** @brief Firmware started. */
+    BOOT_PHASE_READY = 8,
+    /** @brief Number of boot phases. */
+    BOOT_PHASE_COUNT = 9
+} E_BootPhase;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The BootTrace class.
+ *
+ * @details The BootTrace class records the esp_timer time at which the boot
+ * phases completed. Each phase is recorded once, phases running in parallel
+ * can be marked from different tasks.
+ */
+class BootTrace {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Marks the completion of a boot phase.
+         *
+         * @details Marks the completion of a boot phase. Only the first mark
+         * of a phase is recorded.
+         *
+         * @param[in] kPhase The completed phase.
+         */
+        static void Mark(const E_BootPhase kPhase) noexcept;
+
+        /**
+         * @brief Returns the completion time of a boot phase.
+         *
+         * @param[in] kPhase The phase to get.
+         *
+         * @return The time since boot in microseconds at which the phase
+         * completed is returned, 0 if the phase was not reached.
+         */
+        static uint32_t GetTime(const E_BootPhase kPhase) noexcept;
+
+        /**
+         * @brief Returns the name of a boot phase.
+         *
+         * @param[in] kPhase The phase to get.
+         *
+         * @return The name of the phase is returned.
+         */
+        static const char* GetName(const E_BootPhase kPhase) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The phases completion times in microseconds. */
+        static std::atomic<uint32_t> _SPTIMES[BOOT_PHASE_COUNT];
+};
+
+#endif /* #ifndef __BOOT_TRACE_H__ */
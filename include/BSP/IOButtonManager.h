@@ -29,19 +29,34 @@
 #include <cstdint>       /* Generic Types */
 #include <Errors.h>      /* Errors definitions */
 #include <Arduino.h>     /* Arduino framework */
+#include <esp_timer.h>   /* One-shot keep timers */
 #include <unordered_map> /* Standard unordered maps */
 
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
 
-/* None */
+#ifndef BTN_DEBOUNCE_NS
+/** @brief Defines the time without edges after which a level is settled. */
+#define BTN_DEBOUNCE_NS 20000000ULL
+#endif
+
+#ifndef BTN_EVENT_QUEUE_SIZE
+/** @brief Defines the number of button events that can be pending. */
+#define BTN_EVENT_QUEUE_SIZE 16
+#endif
+
+#ifndef BTN_MAX_SUBSCRIPTIONS
+/** @brief Defines the maximal number of button transition subscriptions. */
+#define BTN_MAX_SUBSCRIPTIONS 8
+#endif
 
 /*******************************************************************************
  * MACROS
  ******************************************************************************/
 
-/* None */
+/** @brief Returns the subscription mask of a button transition. */
+#define BTN_EDGE_MASK(EDGE) (1U << (EDGE))
 
 /****************************** INNER NAMESPACE *******************************/
 
@@ -67,6 +82,60 @@ typedef enum {
     BUTTON_MAX_ID
 } E_ButtonID;
 
+/** @brief Defines the button events. */
+typedef enum {
+    /** @brief Raw edge of the button GPIO. */
+    BTN_EVENT_EDGE,
+    /** @brief The keep timer of a pressed button expired. */
+    BTN_EVENT_KEEP
+} E_ButtonEventType;
+
+/** @brief Defines the button transitions delivered to the subscriptions. */
+typedef enum {
+    /** @brief The button state went from UP to DOWN. */
+    BTN_EDGE_PRESS,
+    /** @brief The button state went back to UP. */
+    BTN_EDGE_RELEASE,
+    /** @brief The button state went from DOWN to KEEP. */
+    BTN_EDGE_KEEP,
+    /** @brief The timer of the subscription expired. */
+    BTN_EDGE_TIMER
+} E_ButtonEdge;
+
+/** @brief Timestamped button event. */
+typedef struct {
+    /** @brief The button of the event. */
+    E_ButtonID btnId;
+    /** @brief The event type. */
+    E_ButtonEventType type;
+    /** @brief The event time in nanoseconds. */
+    uint64_t time;
+} S_ButtonEvent;
+
+/* Forward declaration */
+class IOButtonManager;
+class IOButtonManagerAction;
+
+/** @brief Button transition subscription. */
+typedef struct {
+    /** @brief The subscribed action, nullptr for a free slot. */
+    IOButtonManagerAction* pAction;
+    /** @brief The subscribed button. */
+    E_ButtonID btnId;
+    /** @brief The subscribed transitions, see BTN_EDGE_MASK. */
+    uint32_t edgeMask;
+    /** @brief The expiration time of the timer in nanoseconds, 0 if unset. */
+    uint64_t timerTime;
+} S_ButtonSubscription;
+
+/** @brief Button interrupt context. */
+typedef struct {
+    /** @brief The button manager owning the button. */
+    IOButtonManager* pManager;
+    /** @brief The button of the context. */
+    E_ButtonID btnId;
+} S_ButtonIrqContext;
+
 /*******************************************************************************
  * GLOBAL VARIABLES
  ******************************************************************************/
@@ -129,7 +198,33 @@ class IOButtonManagerAction {
         virtual void Execute(
             const uint64_t kpBtnLastPress[E_ButtonID::BUTTON_MAX_ID],
             const E_ButtonState kpBtnStates[E_ButtonID::BUTTON_MAX_ID])
-            noexcept = 0;
+            noexcept {
+            (void)kpBtnLastPress;
+            (void)kpBtnStates;
+        };
+
+        /**
+         * @brief The event function that is called when a subscribed button
+         * transition happens.
+         *
+         * @details The event function that is called when a subscribed button
+         * transition happens. The function is called from the IO task, it
+         * cannot subscribe or unsubscribe actions.
+         *
+         * @param[in] kSubId The subscription identifier.
+         * @param[in] kBtnId The button of the transition.
+         * @param[in] kEdge The transition.
+         * @param[in] kTime The time of the transition in nanoseconds.
+         */
+        virtual void OnEvent(const uint32_t     kSubId,
+                             const E_ButtonID   kBtnId,
+                             const E_ButtonEdge kEdge,
+                             const uint64_t     kTime) noexcept {
+            (void)kSubId;
+            (void)kBtnId;
+            (void)kEdge;
+            (void)kTime;
+        };
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -168,10 +263,26 @@ class IOButtonManager {
         /**
          * @brief Updates the button states.
          *
-         * @details Updates the button states. This function also calculate the
-         * time a button has been pressed to setup the KEEP state.
+         * @details Updates the button states. The pending button events are
+         * applied, a button level is read once no edge happened for
+         * BTN_DEBOUNCE_NS. The KEEP state is set by the keep timer armed on
+         * each press. The transitions and expired timers are delivered to
+         * their subscriptions.
+         *
+         * @param[in] kTime The time of the IO cycle in nanoseconds.
+         *
+         * @return The function returns the time in nanoseconds until the next
+         * bouncing button settles or subscription timer expires, UINT64_MAX
+         * if none.
          */
-        void Update(void) noexcept;
+        uint64_t Update(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Sets the task notified when a button event is queued.
+         *
+         * @param[in] kTask The task updating the buttons.
+         */
+        void SetNotifyTask(const TaskHandle_t kTask) noexcept;
 
         /**
          * @brief Get the Button State.
@@ -219,12 +330,122 @@ class IOButtonManager {
          */
         E_Return RemoveAction(const uint32_t krActionId) noexcept;
 
+        /**
+         * @brief Subscribes an action to button transitions.
+         *
+         * @details Subscribes an action to button transitions. The action
+         * OnEvent function is only called when one of the subscribed
+         * transitions of the button happens. The subscription identifier is
+         * returned in the ID buffer.
+         *
+         * @param[in] kBtnId The button to subscribe to.
+         * @param[in] kEdgeMask The transitions to subscribe to, see
+         * BTN_EDGE_MASK.
+         * @param[in] pAction The action to notify.
+         * @param[out] rSubId The subscription identifier buffer.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Subscribe(const E_ButtonID       kBtnId,
+                           const uint32_t         kEdgeMask,
+                           IOButtonManagerAction* pAction,
+                           uint32_t&              rSubId) noexcept;
+
+        /**
+         * @brief Removes a button transitions subscription.
+         *
+         * @param[in] kSubId The subscription identifier.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Unsubscribe(const uint32_t kSubId) noexcept;
+
+        /**
+         * @brief Sets the timer of a subscription.
+         *
+         * @details Sets the timer of a subscription. A BTN_EDGE_TIMER
+         * transition is delivered once the time is reached. The function is
+         * meant to be called from the OnEvent function of the subscribed
+         * action.
+         *
+         * @param[in] kSubId The subscription identifier.
+         * @param[in] kTime The expiration time in nanoseconds, 0 cancels the
+         * timer.
+         */
+        void SetTimer(const uint32_t kSubId, const uint64_t kTime) noexcept;
+
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
         /* None */
 
     /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
     private:
+        /**
+         * @brief Handles the edge interrupts of a button.
+         *
+         * @details Handles the edge interrupts of a button. The edges are
+         * timestamped and queued, the debouncing is done by the notified
+         * task.
+         *
+         * @param[in] pArg The button interrupt context.
+         */
+        static void IrqHandler(void* pArg) noexcept;
+
+        /**
+         * @brief Handles the expiration of a keep timer.
+         *
+         * @param[in] pArg The button interrupt context.
+         */
+        static void KeepTimerHandler(void* pArg) noexcept;
+
+        /**
+         * @brief Reads the pressed level of a button.
+         *
+         * @param[in] kBtnId The button to read.
+         *
+         * @return The function returns 1 if the button is pressed, 0
+         * otherwise.
+         */
+        uint8_t ReadButton(const E_ButtonID kBtnId) const noexcept;
+
+        /**
+         * @brief Applies a button event to the button states.
+         *
+         * @param[in] krEvent The event to apply.
+         */
+        void ProcessEvent(const S_ButtonEvent& krEvent) noexcept;
+
+        /**
+         * @brief Delivers a button transition to its subscriptions.
+         *
+         * @param[in] kBtnId The button of the transition.
+         * @param[in] kEdge The transition.
+         * @param[in] kTime The time of the transition in nanoseconds.
+         */
+        void Dispatch(const E_ButtonID   kBtnId,
+                      const E_ButtonEdge kEdge,
+                      const uint64_t     kTime) noexcept;
+
+        /**
+         * @brief Delivers the expired subscription timers.
+         *
+         * @param[in] kTime The current time in nanoseconds.
+         *
+         * @return The function returns the time in nanoseconds until the
+         * next timer expires, UINT64_MAX if none is set.
+         */
+        uint64_t CheckTimers(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Applies the settled levels of the bouncing buttons.
+         *
+         * @param[in] kTime The current time in nanoseconds.
+         *
+         * @return The function returns the time in nanoseconds until the
+         * next button settles, UINT64_MAX if none is bouncing.
+         */
+        uint64_t Settle(const uint64_t kTime) noexcept;
+
         /** @brief Stores the buttons GPIO pins */
         E_GPIORouting _pBtnPins[E_ButtonID::BUTTON_MAX_ID];
         /** @brief Stores the button GPIO pin mux */
@@ -239,6 +460,24 @@ class IOButtonManager {
         uint32_t _lastActionId;
         /** @brief Stores the actions mutex. */
         SemaphoreHandle_t _lock;
+        /** @brief Stores the buttons interrupt contexts. */
+        S_ButtonIrqContext _pIrqContexts[E_ButtonID::BUTTON_MAX_ID];
+        /** @brief Stores the buttons keep timers. */
+        esp_timer_handle_t _pKeepTimers[E_ButtonID::BUTTON_MAX_ID];
+        /** @brief Stores the pending button events. */
+        QueueHandle_t _events;
+        /** @brief Stores the task updating the buttons. */
+        TaskHandle_t _notifyTask;
+        /** @brief Stores the time of the first edge of the current bounces. */
+        uint64_t _pFirstEdge[E_ButtonID::BUTTON_MAX_ID];
+        /** @brief Stores the time of the last edge of the current bounces. */
+        uint64_t _pLastEdge[E_ButtonID::BUTTON_MAX_ID];
+        /** @brief Tells if the buttons levels are waiting to settle. */
+        bool _pIsBouncing[E_ButtonID::BUTTON_MAX_ID];
+        /** @brief Stores the transition subscriptions. */
+        S_ButtonSubscription _pSubscriptions[BTN_MAX_SUBSCRIPTIONS];
+        /** @brief Stores the subscribed transitions of each button. */
+        uint32_t _pEdgeMasks[E_ButtonID::BUTTON_MAX_ID];
 
 };
 
@@ -28,12 +28,14 @@
 #include <BSP.h>               /* BSP definitions */
 #include <cstdint>             /* Generic Types */
 #include <Errors.h>            /* Errors definitions */
+#include <Arduino.h>           /* Arduino framework */
 
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
 
-/* None */
+/** @brief Defines the number of bits of a RGB LED frame. */
+#define LED_RGB_FRAME_BITS 24
 
 /*******************************************************************************
  * MACROS
@@ -80,6 +82,8 @@ typedef struct {
     E_GPIORouting pin;
     /** @brief Tells if the LED is RGB. */
     bool isRgb;
+    /** @brief The RMT channel of RGB LEDs, nullptr if not available. */
+    rmt_obj_t* pRmt;
 } S_LedDevice;
 
 /*******************************************************************************
@@ -140,9 +144,22 @@ class IOLedManager {
          * @brief Updates the LED states.
          *
          * @details Updates the LED states. This function also calculate the
-         * next LED state when changing states are set for the LEDs.
+         * next LED state when changing states are set for the LEDs. Only the
+         * LEDs whose state changed or that reached a blink edge are written.
+         *
+         * @param[in] kTime The time of the IO cycle in nanoseconds.
+         *
+         * @return The function returns the time in nanoseconds until the next
+         * blink edge, UINT64_MAX if no LED is blinking.
+         */
+        uint64_t Update(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Sets the task notified when a LED state changes.
+         *
+         * @param[in] kTask The task updating the LEDs.
          */
-        void Update(void) noexcept;
+        void SetNotifyTask(const TaskHandle_t kTask) noexcept;
 
         /**
          * @brief Updates the LEDs power state.
@@ -181,6 +198,27 @@ class IOLedManager {
         S_LedState _pLedStates[E_LedID::LED_MAX_ID];
         /** @brief Stores the next periods */
         uint64_t _pNextPeriods[E_LedID::LED_MAX_ID];
+        /** @brief Tells if the LEDs must be written at the next update. */
+        bool _pIsDirty[E_LedID::LED_MAX_ID];
+        /** @brief Stores the RMT frames of the RGB LEDs. */
+        rmt_data_t _pRmtFrames[E_LedID::LED_MAX_ID][LED_RGB_FRAME_BITS];
+        /** @brief Stores the task updating the LEDs. */
+        TaskHandle_t _notifyTask;
+
+        /**
+         * @brief Writes the current state of a LED.
+         *
+         * @details Writes the current state of a LED. The RGB frames are
+         * queued to the RMT peripheral without waiting for the transfer.
+         *
+         * @param[in] kLedId The identifier of the LED to write.
+         */
+        void Write(const E_LedID kLedId) noexcept;
+
+        /**
+         * @brief Notifies the updating task of a state change.
+         */
+        void NotifyChange(void) noexcept;
 
 };
 
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * @file LogCodec.h
+ *
+ * @see LogCodec.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Persistent journal block codec.
+ *
+ * @details Persistent journal block codec. The journal text is compressed in
+ * frames of bounded size with a byte oriented LZ77 codec. The encoder is
+ * incremental and never outgrows its frame, the decoder needs no memory
+ * besides its output.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __LOG_CODEC_H__
+#define __LOG_CODEC_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard integer definitions */
+#include <cstddef> /* Standard size type */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef LOG_CODEC_WINDOW_SIZE
+/**
+ * @brief Defines the largest raw size of a frame in bytes, it is also the
+ * window of the matches. Must not exceed 65535.
+ */
+#define LOG_CODEC_WINDOW_SIZE 4096
+#endif
+
+#ifndef LOG_CODEC_HASH_BITS
+/** @brief Defines the number of bits of the match finder hash table. */
+#define LOG_CODEC_HASH_BITS 10
+#endif
+
+/** @brief Defines the number of entries of the match finder hash table. */
+#define LOG_CODEC_HASH_SIZE (1U << LOG_CODEC_HASH_BITS)
+
+/** @brief Defines the shortest match length. */
+#define LOG_CODEC_MIN_MATCH 4
+
+/** @brief Defines the longest match length. */
+#define LOG_CODEC_MAX_MATCH (LOG_CODEC_MIN_MATCH + 127)
+
+/** @brief Defines the longest literal run. */
+#define LOG_CODEC_MAX_LITERALS 128
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Frame encoder state, the buffers are provided by the owner. */
+typedef struct {
+    /** @brief The raw data of the frame, LOG_CODEC_WINDOW_SIZE bytes. */
+    uint8_t* pRaw;
+    /** @brief The match finder, LOG_CODEC_HASH_SIZE entries. */
+    uint16_t* pHash;
+    /** @brief The packed tokens, capacity bytes. */
+    uint8_t* pPacked;
+    /** @brief The size of the packed frame in bytes. */
+    size_t capacity;
+    /** @brief The raw bytes in the frame. */
+    size_t rawLen;
+    /** @brief The raw bytes encoded as tokens or pending literals. */
+    size_t encoded;
+    /** @brief The start of the pending literal run. */
+    size_t literalStart;
+    /** @brief The size of the packed tokens in bytes. */
+    size_t packedLen;
+} S_LogCodecEncoder;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The LogCodec class.
+ *
+ * @details The LogCodec class implements the journal frames codec. A frame is
+ * a sequence of tokens. A token starting with a byte below 0x80 is a run of
+ * that byte plus one literals. Otherwise the token is a match of the byte
+ * low bits plus LOG_CODEC_MIN_MATCH bytes, followed by the little endian
+ * distance of the match on two bytes. The matches never cross a frame, each
+ * frame decodes alone.
+ */
+class LogCodec {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Starts a new frame.
+         *
+         * @param[in, out] rEncoder The encoder to reset.
+         */
+        static void Reset(S_LogCodecEncoder& rEncoder) noexcept;
+
+        /**
+         * @brief Appends raw data to the frame.
+         *
+         * @details Appends raw data to the frame. The data is accepted as long
+         * as the frame is guaranteed to fit its capacity, the remaining data
+         * starts the next frame.
+         *
+         * @param[in, out] rEncoder The encoder of the frame.
+         * @param[in] kpData The data to append.
+         * @param[in] kSize The size of the data in bytes.
+         *
+         * @return The number of bytes accepted is returned.
+         */
+        static size_t Append(S_LogCodecEncoder& rEncoder,
+                             const uint8_t*     kpData,
+                             const size_t       kSize) noexcept;
+
+        /**
+         * @brief Outputs the packed frame.
+         *
+         * @details Outputs the packed frame, the pending literals are
+         * included. The frame can still be appended to afterwards.
+         *
+         * @param[in] krEncoder The encoder of the frame.
+         * @param[out] pOutput The buffer receiving the frame, capacity bytes.
+         *
+         * @return The size of the packed frame is returned.
+         */
+        static size_t Pack(const S_LogCodecEncoder& krEncoder,
+                           uint8_t*                 pOutput) noexcept;
+
+        /**
+         * @brief Decodes a packed frame.
+         *
+         * @param[in] kpPacked The packed frame.
+         * @param[in] kPackedSize The size of the packed frame in bytes.
+         * @param[out] pRaw The buffer receiving the raw data.
+         * @param[in] kRawSize The size of the raw buffer in bytes.
+         * @param[out] rRawLen The size of the raw data in bytes.
+         *
+         * @return true is returned when the frame is valid.
+         */
+        static bool Decode(const uint8_t* kpPacked,
+                           const size_t   kPackedSize,
+                           uint8_t*       pRaw,
+                           const size_t   kRawSize,
+                           size_t&        rRawLen) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Encodes the raw data appended to the frame.
+         *
+         * @details Encodes the raw data appended to the frame. The last bytes
+         * stay pending until more data is appended or the frame is packed.
+         *
+         * @param[in, out] rEncoder The encoder of the frame.
+         */
+        static void Encode(S_LogCodecEncoder& rEncoder) noexcept;
+
+        /**
+         * @brief Outputs a literal run.
+         *
+         * @param[in] kpLiterals The literals to output.
+         * @param[in] count The number of literals.
+         * @param[out] pOutput The buffer receiving the tokens.
+         *
+         * @return The size of the tokens is returned.
+         */
+        static size_t PutLiterals(const uint8_t* kpLiterals,
+                                  size_t         count,
+                                  uint8_t*       pOutput) noexcept;
+
+        /**
+         * @brief Returns the worst case size of a literal run.
+         *
+         * @param[in] kSize The number of literals.
+         *
+         * @return The size of the tokens of the run is returned.
+         */
+        static size_t GetLiteralsCost(const size_t kSize) noexcept;
+};
+
+#endif /* #ifndef __LOG_CODEC_H__ */
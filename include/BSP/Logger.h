@@ -23,9 +23,13 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <cstdint>   /* Standard Int Types */
-#include <stddef.h>  /* Standard definitions */
-#include <Storage.h> /* File */
+#include <atomic>     /* Atomic types */
+#include <cstdarg>    /* Variadic arguments */
+#include <cstdint>    /* Standard Int Types */
+#include <stddef.h>   /* Standard definitions */
+#include <HAL.h>      /* Hardware abstraction layer */
+#include <Storage.h>  /* File */
+#include <LogCodec.h> /* Journal frames codec */
 
 /*******************************************************************************
  * CONSTANTS
@@ -34,6 +38,96 @@
 /** @brief Defines the current logger level. */
 #define LOG_LEVEL LOG_LEVEL_DEBUG
 
+#ifndef LOG_LEVEL_MODULE_DEFAULT
+/** @brief Defines the compile-time log level of the default module. */
+#define LOG_LEVEL_MODULE_DEFAULT LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_MODULE_BSP
+/** @brief Defines the compile-time log level of the BSP module. */
+#define LOG_LEVEL_MODULE_BSP LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_MODULE_CORE
+/** @brief Defines the compile-time log level of the Core module. */
+#define LOG_LEVEL_MODULE_CORE LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_MODULE_HM
+/** @brief Defines the compile-time log level of the Health Monitor module. */
+#define LOG_LEVEL_MODULE_HM LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_MODULE_WEB
+/** @brief Defines the compile-time log level of the Web Server module. */
+#define LOG_LEVEL_MODULE_WEB LOG_LEVEL_INFO
+#endif
+#ifndef LOG_LEVEL_MODULE_API
+/** @brief Defines the compile-time log level of the API Server module. */
+#define LOG_LEVEL_MODULE_API LOG_LEVEL_INFO
+#endif
+
+#ifndef LOG_MODULE
+/**
+ * @brief Defines the log module of the current file. Source files define it
+ * before their includes to select their module thresholds.
+ */
+#define LOG_MODULE LOG_MODULE_DEFAULT
+#endif
+
+/** @brief The log buffer size in bytes. */
+#define LOGGER_BUFFER_SIZE 512
+
+#ifndef LOGGER_ASYNC_ENABLED
+/**
+ * @brief Enables the asynchronous logger. When enabled, the logs are pushed
+ * to a lock-free ring and written to the sinks by a dedicated writer task.
+ */
+#define LOGGER_ASYNC_ENABLED 1
+#endif
+
+/** @brief Number of records in the asynchronous logger ring (power of 2). */
+#define LOGGER_ASYNC_RING_SIZE 32
+
+#ifndef LOGGER_RATE_LIMIT_ENABLED
+/**
+ * @brief Enables the per call site rate limits at boot. Each call site may
+ * log LOGGER_RATE_BURST logs at once, then one log per LOGGER_RATE_PERIOD_NS.
+ * Critical logs are never limited.
+ */
+#define LOGGER_RATE_LIMIT_ENABLED 1
+#endif
+
+/** @brief Number of call sites tracked by the rate limits. */
+#define LOGGER_RATE_SITES 32
+/** @brief Number of logs a call site may burst. */
+#define LOGGER_RATE_BURST 10
+/** @brief Time to earn a log back for a call site in nanoseconds. */
+#define LOGGER_RATE_PERIOD_NS 100000000ULL
+/** @brief Period of the rate limited call sites report in nanoseconds. */
+#define LOGGER_RATE_REPORT_NS 10000000000ULL
+/** @brief Longest collapse of repeated logs in nanoseconds. */
+#define LOGGER_REPEAT_REPORT_NS 10000000000ULL
+
+/** @brief Persistent journal write-behind block size in bytes (SD sector). */
+#define LOG_JOURNAL_BLOCK_SIZE 512
+/** @brief Number of persistent journal segments. */
+#define LOG_JOURNAL_SEGMENT_COUNT 4
+/** @brief Persistent journal segment size in bytes. */
+#define LOG_JOURNAL_SEGMENT_SIZE (256 * 1024)
+
+#ifndef LOG_JOURNAL_COMPRESSED
+/**
+ * @brief Enables the compressed persistent journal. The segments store
+ * frames of compressed logs, switching the format clears the journal.
+ */
+#define LOG_JOURNAL_COMPRESSED 1
+#endif
+
+#ifndef LOG_JOURNAL_FRAME_SIZE
+/**
+ * @brief Persistent journal compressed frame size in bytes, a multiple of
+ * the write-behind block size.
+ */
+#define LOG_JOURNAL_FRAME_SIZE 1024
+#endif
+
 /*******************************************************************************
  * MACROS
  ******************************************************************************/
@@ -48,13 +142,16 @@
  * @param[in] ... The format arguments.
  */
 #define LOG_INFO(FMT, ...) {                                \
+    if (LogModuleEnabled(LOG_MODULE, LOG_LEVEL_INFO)) {     \
         Logger::GetInstance()->LogLevel(                    \
-        LOG_LEVEL_INFO,                                     \
-        __FILE__,                                           \
-        __LINE__,                                           \
-        FMT,                                                \
-        ##__VA_ARGS__                                       \
-    );                                                      \
+            LOG_LEVEL_INFO,                                 \
+            LOG_MODULE,                                     \
+            __FILE__,                                       \
+            __LINE__,                                       \
+            FMT,                                            \
+            ##__VA_ARGS__                                   \
+        );                                                  \
+    }                                                       \
 }
 
 /**
@@ -67,13 +164,16 @@
  * @param[in] ... The format arguments.
  */
 #define LOG_ERROR(FMT, ...) {                               \
-    Logger::GetInstance()->LogLevel(                        \
-        LOG_LEVEL_ERROR,                                    \
-        __FILE__,                                           \
-        __LINE__,                                           \
-        FMT,                                                \
-        ##__VA_ARGS__                                       \
-    );                                                      \
+    if (LogModuleEnabled(LOG_MODULE, LOG_LEVEL_ERROR)) {    \
+        Logger::GetInstance()->LogLevel(                    \
+            LOG_LEVEL_ERROR,                                \
+            LOG_MODULE,                                     \
+            __FILE__,                                       \
+            __LINE__,                                       \
+            FMT,                                            \
+            ##__VA_ARGS__                                   \
+        );                                                  \
+    }                                                       \
 }
 
 /**
@@ -88,6 +188,7 @@
 #define PANIC(FMT, ...) {                                   \
     Logger::GetInstance()->LogLevel(                        \
         LOG_LEVEL_CRITICAL,                                 \
+        LOG_MODULE,                                         \
         __FILE__,                                           \
         __LINE__,                                           \
         FMT,                                                \
@@ -116,13 +217,16 @@
  * @param[in] ... The format arguments.
  */
 #define LOG_DEBUG(FMT, ...) {                               \
-    Logger::GetInstance()->LogLevel(                        \
-        LOG_LEVEL_DEBUG,                                    \
-        __FILE__,                                           \
-        __LINE__,                                           \
-        FMT,                                                \
-        ##__VA_ARGS__                                       \
-    );                                                      \
+    if (LogModuleEnabled(LOG_MODULE, LOG_LEVEL_DEBUG)) {    \
+        Logger::GetInstance()->LogLevel(                    \
+            LOG_LEVEL_DEBUG,                                \
+            LOG_MODULE,                                     \
+            __FILE__,                                       \
+            __LINE__,                                       \
+            FMT,                                            \
+            ##__VA_ARGS__                                   \
+        );                                                  \
+    }                                                       \
 }
 
 #else
@@ -148,6 +252,35 @@ typedef enum
     LOG_LEVEL_DEBUG = 3
 } E_LogLevel;
 
+/** @brief Defines the log modules. */
+typedef enum
+{
+    /** @brief Default module, used by files not defining LOG_MODULE. */
+    LOG_MODULE_DEFAULT = 0,
+    /** @brief Board support package module. */
+    LOG_MODULE_BSP = 1,
+    /** @brief Core module. */
+    LOG_MODULE_CORE = 2,
+    /** @brief Health Monitor module. */
+    LOG_MODULE_HM = 3,
+    /** @brief Web Server module. */
+    LOG_MODULE_WEB = 4,
+    /** @brief API Server module. */
+    LOG_MODULE_API = 5,
+    /** @brief Number of log modules. */
+    LOG_MODULE_MAX = 6
+} E_LogModule;
+
+/** @brief Asynchronous log record stored in the logger ring. */
+typedef struct {
+    /** @brief Record sequence, used to synchronize producers and consumer. */
+    std::atomic<uint32_t> sequence;
+    /** @brief Size of the binary log record. */
+    uint32_t length;
+    /** @brief Binary log record, formated by the writer task. */
+    uint8_t pData[LOGGER_BUFFER_SIZE];
+} S_LogRecord;
+
 /** @brief RAM journal definition. */
 typedef struct {
     /** @brief Start address of the journal in memory. */
@@ -156,16 +289,70 @@ typedef struct {
     uint8_t* pEndAddress;
     /** @brief Current cursor in the memory. */
     uint8_t* pCursor;
-    /** @brief Tells if the journal buffer as already circled. */
-    bool hasCircled;
+    /** @brief Number of bytes written since boot, wraps around. */
+    size_t written;
+    /** @brief Position of the oldest record, in written bytes. */
+    size_t oldest;
+    /** @brief Sequence of the oldest record. */
+    uint32_t oldestSequence;
+    /** @brief Sequence of the next record written. */
+    uint32_t sequence;
+    /** @brief Positions of the records, one every LOG_RAM_INDEX_STRIDE. */
+    size_t* pIndex;
 } S_RamJournal;
 
-/** @brief RAM journal descriptor. */
+/** @brief RAM journal descriptor, reads the journal from the newest log. */
 typedef struct {
-    /** @brief Current offset of the cursor. */
-    uint32_t pCursor;
+    /** @brief Sequence of the oldest log read, the next logs are older. */
+    uint32_t sequence;
 } S_RamJournalDescriptor;
 
+/** @brief RAM journal stream, reads the journal toward the newest log. */
+typedef struct {
+    /** @brief Position of the next record, in written bytes of the journal. */
+    size_t position;
+    /** @brief Sequence of the next record. */
+    uint32_t sequence;
+    /** @brief Number of logs overwritten before being read, reset by the
+     * stream owner once reported.
+     */
+    uint32_t lost;
+} S_RamJournalStream;
+
+/** @brief Rate limit of a log call site. */
+typedef struct {
+    /** @brief The file of the call site, nullptr if the slot is free. */
+    const char* pkFile;
+    /** @brief The line of the call site. */
+    uint32_t line;
+    /** @brief The logs the call site may still log. */
+    uint32_t tokens;
+    /** @brief Number of logs suppressed since the last report. */
+    uint32_t suppressed;
+    /** @brief Time of the last earned log in nanoseconds. */
+    uint64_t refillTime;
+} S_LogRateSite;
+
+/** @brief Persistent journal frame reader, keeps the last decoded frame. */
+typedef struct {
+    /** @brief The frame read buffer, LOG_JOURNAL_FRAME_SIZE bytes. */
+    uint8_t* pFrame;
+    /** @brief The decoded frame, LOG_CODEC_WINDOW_SIZE bytes. */
+    uint8_t* pRaw;
+    /** @brief The journal generation of the decoded frame. */
+    uint32_t generation;
+    /** @brief The slot of the decoded frame in its segment. */
+    uint32_t slot;
+    /** @brief The offset of the decoded frame in its segment. */
+    size_t rawOffset;
+    /** @brief The size of the decoded frame. */
+    size_t rawLen;
+    /** @brief The segment of the decoded frame. */
+    uint8_t segment;
+    /** @brief Tells if a frame is decoded. */
+    bool isValid;
+} S_LogJournalReader;
+
 /*******************************************************************************
  * GLOBAL VARIABLES
  ******************************************************************************/
@@ -189,7 +376,41 @@ typedef struct {
  * FUNCTIONS
  ******************************************************************************/
 
-/* None */
+/**
+ * @brief Returns the compile-time log level of a module.
+ *
+ * @details Returns the compile-time log level of a module. Logs above this
+ * level are compiled out.
+ *
+ * @param[in] kModule The module to get the level of.
+ *
+ * @return The compile-time log level of the module is returned.
+ */
+constexpr E_LogLevel LogModuleLevel(const E_LogModule kModule) noexcept {
+    return LOG_MODULE_BSP == kModule ? LOG_LEVEL_MODULE_BSP :
+           LOG_MODULE_CORE == kModule ? LOG_LEVEL_MODULE_CORE :
+           LOG_MODULE_HM == kModule ? LOG_LEVEL_MODULE_HM :
+           LOG_MODULE_WEB == kModule ? LOG_LEVEL_MODULE_WEB :
+           LOG_MODULE_API == kModule ? LOG_LEVEL_MODULE_API :
+           LOG_LEVEL_MODULE_DEFAULT;
+}
+
+/**
+ * @brief Tells if a log level is compiled for a module.
+ *
+ * @details Tells if a log level is compiled for a module. Used by the log
+ * macros: since the check is constant, disabled logs are removed at
+ * compile-time along with their arguments.
+ *
+ * @param[in] kModule The module of the log.
+ * @param[in] kLevel The level of the log.
+ *
+ * @return True is returned if the log is compiled, false otherwise.
+ */
+constexpr bool LogModuleEnabled(const E_LogModule kModule,
+                                const E_LogLevel  kLevel) noexcept {
+    return kLevel <= LogModuleLevel(kModule);
+}
 
 /*******************************************************************************
  * CLASSES
@@ -221,46 +442,158 @@ class Logger
          * logger current level, the message is discarded.
          *
          * @param[in] kLevel The lovel of the message to log.
+         * @param[in] kModule The module that generated the message.
          * @param[in] pkFile The file where the log was generated.
          * @param[in] kLine The line where the log was generated.
          * @param[in] pkStr The format string used for the log
          * @param[in] ... The format arguments.
          */
-        void LogLevel(const E_LogLevel kLevel,
-                      const char*      pkFile,
-                      const uint32_t   kLine,
-                      const char*      kStr,
+        void LogLevel(const E_LogLevel  kLevel,
+                      const E_LogModule kModule,
+                      const char*       pkFile,
+                      const uint32_t    kLine,
+                      const char*       kStr,
                       ...) noexcept;
 
+        /**
+         * @brief Sets the runtime log level of a module.
+         *
+         * @details Sets the runtime log level of a module. The runtime level
+         * cannot exceed the compile-time level of the module since the logs
+         * above it are compiled out, it is clamped in that case.
+         *
+         * @param[in] kModule The module to set the level of.
+         * @param[in] kLevel The new log level of the module.
+         */
+        void SetModuleLevel(const E_LogModule kModule,
+                            const E_LogLevel  kLevel) noexcept;
+
+        /**
+         * @brief Returns the runtime log level of a module.
+         *
+         * @details Returns the runtime log level of a module.
+         *
+         * @param[in] kModule The module to get the level of.
+         *
+         * @return The runtime log level of the module is returned.
+         */
+        E_LogLevel GetModuleLevel(const E_LogModule kModule) const noexcept;
+
+        /**
+         * @brief Enables or disables the call sites rate limits.
+         *
+         * @details Enables or disables the call sites rate limits. The
+         * repeated logs are collapsed in both cases.
+         *
+         * @param[in] kIsEnabled Tells if the rate limits apply.
+         */
+        void SetRateLimit(const bool kIsEnabled) noexcept;
+
+        /**
+         * @brief Returns the number of logs suppressed by the rate limits.
+         *
+         * @return The number of logs suppressed since boot is returned.
+         */
+        uint32_t GetRateLimitedCount(void) const noexcept;
+
+        /**
+         * @brief Returns the number of repeated logs collapsed.
+         *
+         * @return The number of repeated logs collapsed since boot is
+         * returned.
+         */
+        uint32_t GetRepeatedCount(void) const noexcept;
+
+        /**
+         * @brief Returns the name of a log module.
+         *
+         * @details Returns the name of a log module.
+         *
+         * @param[in] kModule The module to get the name of.
+         *
+         * @return The name of the log module is returned.
+         */
+        static const char* GetModuleName(const E_LogModule kModule) noexcept;
+
         /**
          * @brief Flushes the logs.
          *
          * @details Flushes the logs. This ensures the buffers are correctly
-         * written.
+         * written. When the asynchronous logger is enabled, the function
+         * waits for the writer task to drain the log ring.
          */
         void Flush(void) noexcept;
 
         /**
-         * @brief Opens the logger persistent journal.
+         * @brief Returns the persistent journal size.
+         *
+         * @details Returns the persistent journal size. This is the sum of the
+         * sizes of all the journal segments written to the storage.
          *
-         * @details Opens the logger persistent journal. This provides a file
-         * that can be read to get the current logs.
+         * @return The persistent journal size in bytes is returned.
          */
-        FsFile OpenPersistenJournal(void) const noexcept;
+        size_t GetPersistentJournalSize(void) const noexcept;
+
+        /**
+         * @brief Reads from the persistent journal.
+         *
+         * @details Reads from the persistent journal. This function will
+         * return up to length bytes, ending kOffset bytes before the end of
+         * the journal. The journal segments are read from the newest to the
+         * oldest, the returned data is always in chronological order.
+         *
+         * @param[out] pBuffer The buffer used to receive the journal data.
+         * @param[in] length The maximum number of bytes to fill in the buffer.
+         * @param[in] kOffset The offset from the end of the journal.
+         *
+         * @return The number of bytes read is returned.
+         */
+        size_t ReadPersistentJournal(uint8_t*     pBuffer,
+                                     size_t       length,
+                                     const size_t kOffset) const noexcept;
 
         /**
          * @brief Clears the persistent journal.
          *
          * @details Clears the persistent journal. This effectively removes the
-         * log file.
+         * log segments.
+         */
+        void ClearPersistentJournal(void) noexcept;
+
+        /**
+         * @brief Finds the offset of a time in the persistent journal.
+         *
+         * @details Finds the offset of a time in the persistent journal. The
+         * sparse time index of the segments is searched, the result is
+         * expressed from the end of the journal as for ReadPersistentJournal.
+         * The start of a range is the last indexed block before the time, the
+         * end of a range is the first indexed block after the time.
+         *
+         * @param[in] kTime The journal time in nanoseconds.
+         * @param[in] kIsEnd Tells if the time is the end of a range.
+         *
+         * @return The offset from the end of the journal is returned.
          */
-        void ClearPersistentJournal(void) const noexcept;
+        size_t FindPersistentJournalOffset(const uint64_t kTime,
+                                           const bool     kIsEnd)
+        const noexcept;
+
+        /**
+         * @brief Returns the current journal time.
+         *
+         * @details Returns the current journal time in nanoseconds. The
+         * journal time is the uptime accumulated accross the boots, it is
+         * used by the persistent journal time index.
+         *
+         * @return The current journal time is returned.
+         */
+        uint64_t GetJournalTime(void) const noexcept;
 
         /**
          * @brief Opens the logger RAM journal.
          *
          * @details Opens the logger RAM journal. This provides a descriptor
-         * that can be read to get the current logs.
+         * that can be read to get the current logs, from the newest one.
          *
          * @param[out] pDesc The RAM journal descriptor used to open.
          */
@@ -270,12 +603,18 @@ class Logger
          * @brief Read from the RAM journal.
          *
          * @details Read from the RAM journal. This function will return up to
-         * length bytes and update the descriptor. Ram journal is read from
-         * the last log to the first log upward.
+         * length bytes of formated logs and update the descriptor. The RAM
+         * journal stores binary records that are only formated when read.
+         * Ram journal is read from the last log to the first log upward, the
+         * returned logs are in chronological order. The logs written after
+         * the descriptor was opened are never returned.
          *
          * @param[out] pBuffer The buffer used to receive the journal data.
          * @param[in] length The maximum number of bytes to fill in the buffer.
          * @param[out] pDesc The RAM journal descriptor used to open.
+         *
+         * @return The number of bytes read is returned, 0 is returned when
+         * the oldest log was reached.
          */
         size_t ReadRamJournal(uint8_t*                pBuffer,
                               size_t                  length,
@@ -284,24 +623,80 @@ class Logger
         /**
          * @brief Sets the RAM journal descriptor cursor.
          *
-         * @details Sets the RAM journal descriptor cursor. If the provided
-         * offset is out of bound, the cursor is set to the end of the RAM
-         * journal. Ram journal is seek from the last log to the first log
-         * upward.
+         * @details Sets the RAM journal descriptor cursor. The next read
+         * returns the logs older than the log of the provided sequence, as
+         * returned in the descriptor after a read. The cursor stays on the
+         * same log whatever is written in between.
          *
          * @param[out] pDesc The RAM journal descriptor used to seek.
-         * @param[in] kOffset The offset to set to the descriptor.
+         * @param[in] kSequence The sequence to set to the descriptor.
          */
         void SeekRamJournal(S_RamJournalDescriptor* pDesc,
-                            const size_t            kOffset) const noexcept;
+                            const uint32_t          kSequence) const noexcept;
 
         /**
          * @brief Clears the RAM journal.
          *
          * @details Clears the RAM journal. This effectively resets the RAM
-         * logs.
+         * logs, the sequences keep increasing.
          */
         void ClearRamJournal(void) noexcept;
+
+        /**
+         * @brief Opens a stream on the RAM journal.
+         *
+         * @details Opens a stream on the RAM journal. The stream starts at
+         * the oldest log still available in the RAM journal.
+         *
+         * @param[out] pStream The RAM journal stream to open.
+         */
+        void OpenRamJournalStream(S_RamJournalStream* pStream) const noexcept;
+
+        /**
+         * @brief Opens a stream on the end of the RAM journal.
+         *
+         * @details Opens a stream on the end of the RAM journal. Only the
+         * logs written after the stream was opened are read from it.
+         *
+         * @param[out] pStream The RAM journal stream to open.
+         */
+        void OpenRamJournalTail(S_RamJournalStream* pStream) const noexcept;
+
+        /**
+         * @brief Moves a RAM journal stream to a log sequence.
+         *
+         * @details Moves a RAM journal stream to a log sequence, in constant
+         * time. The next read starts at the log of the sequence. When the log
+         * was overwritten, the stream starts at the oldest log and counts the
+         * lost logs. A sequence not written yet moves the stream to the end
+         * of the journal.
+         *
+         * @param[out] pStream The RAM journal stream to move.
+         * @param[in] kSequence The sequence of the next log to read.
+         */
+        void SeekRamJournalStream(S_RamJournalStream* pStream,
+                                  const uint32_t      kSequence) const noexcept;
+
+        /**
+         * @brief Reads the next logs of a RAM journal stream.
+         *
+         * @details Reads the next logs of a RAM journal stream. This function
+         * will return up to length bytes of formated logs in chronological
+         * order and advance the stream. The lock is only held for the read,
+         * logs written after the stream was opened are also returned. If the
+         * writer overtook the stream, the stream resumes at the oldest log
+         * and the overwritten logs are added to its lost count.
+         *
+         * @param[out] pBuffer The buffer used to receive the journal data.
+         * @param[in] length The maximum number of bytes to fill in the buffer.
+         * @param[in, out] pStream The RAM journal stream to read.
+         *
+         * @return The number of bytes read is returned, 0 is returned when
+         * the end of the journal is reached.
+         */
+        size_t ReadRamJournalStream(uint8_t*            pBuffer,
+                                    size_t              length,
+                                    S_RamJournalStream* pStream) const noexcept;
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
         /* None */
@@ -316,11 +711,113 @@ class Logger
          */
         Logger(void) noexcept;
 
+        /**
+         * @brief Writes a binary log record to all the sinks.
+         *
+         * @details Writes a binary log record to all the sinks. The record is
+         * stored as is in the RAM journal and formated for the serial and
+         * persistent journal sinks.
+         *
+         * @param[in] kpRecord The binary record to write.
+         * @param[in] kLen The size of the record.
+         */
+        void WriteSinks(const uint8_t* kpRecord, const size_t kLen) noexcept;
+
+        /**
+         * @brief Writes a binary log record to all the sinks.
+         *
+         * @details Writes a binary log record to all the sinks without
+         * collapsing it. Used by WriteSinks and the suppressed logs reports.
+         *
+         * @param[in] kpRecord The binary record to write.
+         * @param[in] kLen The size of the record.
+         */
+        void OutputRecord(const uint8_t* kpRecord, const size_t kLen) noexcept;
+
+        /**
+         * @brief Tells if a call site may log.
+         *
+         * @details Tells if a call site may log and takes a log from its
+         * bucket. When the call site slot is used by another call site still
+         * suppressing logs, the call site is not limited.
+         *
+         * @param[in] kpFile The file of the call site.
+         * @param[in] kLine The line of the call site.
+         *
+         * @return True is returned when the log is allowed, false otherwise.
+         */
+        bool IsRateAllowed(const char* kpFile, const uint32_t kLine) noexcept;
+
+        /**
+         * @brief Reports the suppressed logs.
+         *
+         * @details Reports the repeated logs collapsed for too long and,
+         * every LOGGER_RATE_REPORT_NS, the logs suppressed by each call site.
+         */
+        void ReportSuppressed(void) noexcept;
+
+        /**
+         * @brief Reports the repetitions of the last log and stops
+         * collapsing it.
+         */
+        void ReportRepeats(void) noexcept;
+
+#if LOGGER_ASYNC_ENABLED
+        /**
+         * @brief Reserves a record in the asynchronous log ring.
+         *
+         * @details Reserves a record in the asynchronous log ring. This
+         * function is lock-free and can be called by multiple producers
+         * concurrently. The reserved record must be published with
+         * PublishRecord.
+         *
+         * @param[out] rPosition The reserved position in the ring.
+         *
+         * @return The reserved record is returned, nullptr is returned if the
+         * ring is full.
+         */
+        S_LogRecord* ReserveRecord(uint32_t& rPosition) noexcept;
+
+        /**
+         * @brief Publishes a reserved record to the writer task.
+         *
+         * @details Publishes a reserved record to the writer task and wakes
+         * the writer task up.
+         *
+         * @param[in] pRecord The record to publish.
+         * @param[in] kPosition The position of the record in the ring.
+         */
+        void PublishRecord(S_LogRecord* pRecord, const uint32_t kPosition)
+        noexcept;
+
+        /**
+         * @brief Drains the asynchronous log ring.
+         *
+         * @details Drains the asynchronous log ring. The published records are
+         * written to the sinks in order. This function must only be called by
+         * the writer task.
+         */
+        void DrainRing(void) noexcept;
+
+        /**
+         * @brief Logger writer task.
+         *
+         * @details Logger writer task. Waits for records to be published and
+         * writes them to the sinks.
+         *
+         * @param[in] pLogger The logger instance to be used by the task.
+         */
+        static void WriterTaskRoutine(void* pLogger) noexcept;
+#endif
+
         /**
          * @brief Writes the log to the log file in persisten storage.
          *
          * @details brief Writes the log to the log file in persisten storage.
-         * On error, this function failes silently as the log woud be recursive.
+         * The log is first stored in the write-behind block and the block is
+         * written to the storage when it reaches the next sector boundary or
+         * when the flush period elapsed. On error, this function failes
+         * silently as the log woud be recursive.
          *
          * @param[in] kpStr The string log to write to the file.
          * @param[in] kLen The length of the string to write.
@@ -329,23 +826,324 @@ class Logger
         noexcept;
 
         /**
-         * @brief Writes the log to the log RAM journal in persistent storage.
+         * @brief Writes the write-behind block to the persistent journal.
          *
-         * @details Writes the log to the log RAM journal in persistent storage.
-         * This function will always succeed.
+         * @details Writes the write-behind block to the persistent journal and
+         * rotates the journal segment when it is full.
          *
-         * @param[in] kpStr The string log to write to the RAM journal.
-         * @param[in] kLen The length of the string to write.
+         * @param[in] kSync Tells if the file must be synchronized with the
+         * storage after the write.
+         */
+        void FlushPersistentJournal(const bool kSync) noexcept;
+
+        /**
+         * @brief Tells if logs wait to be synchronized to the journal.
+         *
+         * @return True is returned when the write-behind block or the open
+         * frame holds logs not yet on the storage.
+         */
+        bool IsJournalPending(void) const noexcept;
+
+        /**
+         * @brief Opens the active persistent journal segment.
+         *
+         * @details Opens the active persistent journal segment. The active
+         * segment is retreived from the journal index file. On first use, the
+         * segment is created and preallocated.
+         *
+         * @return True is returned if the segment is open, false otherwise.
+         */
+        bool OpenJournalSegment(void) noexcept;
+
+        /**
+         * @brief Rotates the persistent journal segments.
+         *
+         * @details Rotates the persistent journal segments. The oldest segment
+         * is removed and reused as the new active segment.
+         */
+        void RotateJournalSegment(void) noexcept;
+
+        /**
+         * @brief Removes all the persistent journal segments.
+         *
+         * @details Removes all the persistent journal segments and resets the
+         * write-behind block.
+         */
+        void RemoveJournalSegments(void) noexcept;
+
+        /**
+         * @brief Saves the active segment and the format of the journal.
          */
-        void WriteRamJournal(const char* kpStr, size_t len) noexcept;
+        void WriteJournalIndex(void) noexcept;
 
-        /** @brief The logger buffer. */
+        /**
+         * @brief Reads from a persistent journal segment.
+         *
+         * @details Reads from a persistent journal segment. Compressed frames
+         * are decoded, the offsets are always expressed in logs bytes.
+         *
+         * @param[in, out] rSegment The open segment file.
+         * @param[in] kSegment The segment index.
+         * @param[in] kPosition The offset of the data in the segment.
+         * @param[out] pBuffer The buffer receiving the data.
+         * @param[in] kSize The number of bytes to read.
+         *
+         * @return True is returned on success, false otherwise.
+         */
+        bool ReadJournalSegment(T_HALFile&    rSegment,
+                                const uint8_t kSegment,
+                                const size_t  kPosition,
+                                uint8_t*      pBuffer,
+                                const size_t  kSize) const noexcept;
+
+#if LOG_JOURNAL_COMPRESSED
+        /**
+         * @brief Compresses logs to the active segment.
+         *
+         * @details Compresses logs to the active segment. The full frames are
+         * written to their slot, the open frame is written on
+         * synchronization and rewritten until it is full. On error the open
+         * frame is dropped.
+         *
+         * @param[in] kpData The logs to write.
+         * @param[in] kSize The size of the logs in bytes.
+         * @param[in] kSync Tells if the open frame must be written.
+         */
+        void WriteJournalFrames(const char*  kpData,
+                                const size_t kSize,
+                                const bool   kSync) noexcept;
+
+        /**
+         * @brief Writes the open frame to its slot.
+         *
+         * @return True is returned on success, false otherwise.
+         */
+        bool WriteJournalFrame(void) noexcept;
+
+        /**
+         * @brief Decodes the frame holding a position of a segment.
+         *
+         * @details Decodes the frame holding a position of a segment in the
+         * reader. The decoded frame is kept for the next reads, sequential
+         * reads continue with the next slot and others search the frames.
+         *
+         * @param[in, out] rSegment The open segment file.
+         * @param[in] kSegment The segment index.
+         * @param[in] kPosition The offset in the segment.
+         *
+         * @return True is returned on success, false otherwise.
+         */
+        bool LoadJournalFrame(T_HALFile&    rSegment,
+                              const uint8_t kSegment,
+                              const size_t  kPosition) const noexcept;
+#endif
+
+        /**
+         * @brief Appends the write-behind block to the time index.
+         *
+         * @details Appends the write-behind block to the time index of the
+         * active segment. The block is about to be written at the end of the
+         * segment.
+         */
+        void WriteJournalTimeIndex(void) noexcept;
+
+        /**
+         * @brief Loads the journal time base.
+         *
+         * @details Loads the journal time base from the newest entry of the
+         * time indexes. The journal time continues from the previous boots.
+         */
+        void LoadJournalTimeBase(void) noexcept;
+
+        /**
+         * @brief Returns the size of a journal segment.
+         *
+         * @details Returns the size of a journal segment on the storage.
+         *
+         * @param[in] kSegment The segment to get the size of.
+         *
+         * @return The segment size is returned, 0 if the segment does not
+         * exist.
+         */
+        size_t GetJournalSegmentSize(const uint8_t kSegment) const noexcept;
+
+        /**
+         * @brief Requests an action on the persistent journal.
+         *
+         * @details Requests an action on the persistent journal. When the
+         * asynchronous logger is enabled, the action is executed by the writer
+         * task and the function waits for its completion. Otherwise the action
+         * is executed by the calling task.
+         *
+         * @param[in] kRequest The request flags to execute.
+         */
+        void RequestJournalAction(const uint32_t kRequest) noexcept;
+
+        /**
+         * @brief Executes the pending persistent journal actions.
+         *
+         * @details Executes the pending persistent journal actions. This
+         * function must only be called by the writer task when the
+         * asynchronous logger is enabled.
+         *
+         * @param[in] kRequest The request flags to execute.
+         */
+        void ExecuteJournalAction(const uint32_t kRequest) noexcept;
+
+        /**
+         * @brief Writes the log to the log RAM journal.
+         *
+         * @details Writes the binary log record to the log RAM journal. The
+         * record is stamped with the next sequence and the oldest records
+         * are dropped to make room. This function will always succeed.
+         *
+         * @param[in] kpRecord The binary record to write to the RAM journal.
+         * @param[in] kLen The size of the record.
+         */
+        void WriteRamJournal(const uint8_t* kpRecord, size_t len) noexcept;
+
+        /**
+         * @brief Copies data from the RAM journal.
+         *
+         * @details Copies data from the RAM journal. The copied region ends
+         * kBackOffset bytes before the journal write cursor. The RAM journal
+         * lock must be held by the caller.
+         *
+         * @param[out] pBuffer The buffer receiving the data.
+         * @param[in] kBackOffset The offset of the region end from the cursor.
+         * @param[in] kLen The number of bytes to copy.
+         */
+        void CopyRamJournal(uint8_t*     pBuffer,
+                            const size_t kBackOffset,
+                            const size_t kLen) const noexcept;
+
+        /**
+         * @brief Appends data at the RAM journal write cursor.
+         *
+         * @details Appends data at the RAM journal write cursor, the cursor
+         * rolls over at the end of the journal. The RAM journal lock must be
+         * held by the caller.
+         *
+         * @param[in] kpData The data to append.
+         * @param[in] len The number of bytes to append.
+         */
+        void AppendRamJournal(const uint8_t* kpData, size_t len) noexcept;
+
+        /**
+         * @brief Returns the size of a RAM journal record.
+         *
+         * @details Returns the size of a RAM journal record, read from its
+         * header. The RAM journal lock must be held by the caller.
+         *
+         * @param[in] kPosition The position of the record, in written bytes.
+         *
+         * @return The size of the record is returned.
+         */
+        uint16_t GetRamJournalRecordSize(const size_t kPosition)
+        const noexcept;
+
+        /**
+         * @brief Finds a RAM journal record from its sequence.
+         *
+         * @details Finds a RAM journal record from its sequence. The index
+         * gives the position of a close previous record, at most
+         * LOG_RAM_INDEX_STRIDE records are then walked. The sequence must be
+         * between the oldest and the next sequence of the journal. The RAM
+         * journal lock must be held by the caller.
+         *
+         * @param[in] kSequence The sequence of the record.
+         *
+         * @return The position of the record, in written bytes, is returned.
+         * The next sequence gives the write position.
+         */
+        size_t FindRamJournalRecord(const uint32_t kSequence) const noexcept;
+
+        /** @brief The logger buffer used for synchronous logs. */
         char* _logBuffer;
+
+#if LOGGER_ASYNC_ENABLED
+        /** @brief The asynchronous log ring. */
+        S_LogRecord* _pRing;
+        /** @brief The asynchronous log ring producers position. */
+        std::atomic<uint32_t> _ringHead;
+        /** @brief The asynchronous log ring consumer position. */
+        std::atomic<uint32_t> _ringTail;
+        /** @brief Number of records dropped because the ring was full. */
+        std::atomic<uint32_t> _droppedCount;
+        /** @brief The writer task handle. */
+        T_HALTask _writerTaskHandle;
+#endif
+        /** @brief Runtime log levels of the modules. */
+        std::atomic<uint8_t> _moduleLevels[LOG_MODULE_MAX];
+        /** @brief The rate limits of the call sites, by call site hash. */
+        S_LogRateSite _pRateSites[LOGGER_RATE_SITES];
+        /** @brief The rate limits lock. */
+        T_HALSpinLock _rateLock;
+        /** @brief Tells if the rate limits apply. */
+        std::atomic<bool> _isRateLimited;
+        /** @brief Number of logs suppressed by the rate limits. */
+        std::atomic<uint32_t> _rateLimitedCount;
+        /** @brief Number of repeated logs collapsed. */
+        std::atomic<uint32_t> _repeatedCount;
+        /** @brief Time of the last rate limited call sites report. */
+        uint64_t _lastRateReport;
+        /** @brief The last record written, repetitions are collapsed. */
+        uint8_t* _pLastRecord;
+        /** @brief The size of the last record written. */
+        size_t _lastRecordLen;
+        /** @brief Number of repetitions of the last record. */
+        uint32_t _repeatCount;
+        /** @brief Time of the first repetition of the last record. */
+        uint64_t _repeatStart;
+        /** @brief The buffer used to encode the suppressed logs reports. */
+        uint8_t* _pReportRecord;
+        /** @brief The buffer used to format the binary records. */
+        char* _pFormatBuffer;
         /** @brief The logger journal in RAM. */
         S_RamJournal _logJournalRam;
+        /** @brief The RAM journal lock, shared by the writer and readers. */
+        T_HALMutex _ramJournalLock;
+        /** @brief The RAM journal reader record buffer. */
+        uint8_t* _pReadRecord;
+        /** @brief The RAM journal reader format buffer. */
+        char* _pReadText;
 
-        /** @brief Stores the log file. */
-        FsFile _logfile;
+        /** @brief Stores the active log segment file. */
+        T_HALFile _logfile;
+        /** @brief Active journal segment index. */
+        uint8_t _journalSegment;
+        /** @brief Size of the logs of the active segment. */
+        size_t _journalSegmentSize;
+        /** @brief The persistent journal write-behind block. */
+        char* _pJournalBlock;
+        /** @brief Number of bytes in the write-behind block. */
+        size_t _journalBlockLen;
+        /** @brief Time of the last write-behind block flush. */
+        uint64_t _lastJournalFlush;
+        /** @brief Uptime of the first log of the write-behind block. */
+        uint64_t _journalBlockTime;
+        /** @brief Next segment offset to store in the time index. */
+        size_t _journalIndexNext;
+        /** @brief Journal time at boot, keeps the journal time monotonic. */
+        uint64_t _journalTimeBase;
+        /** @brief Tells if the journal time base was loaded. */
+        bool _isJournalTimeLoaded;
+        /** @brief Pending persistent journal requests. */
+        std::atomic<uint32_t> _journalRequest;
+#if LOG_JOURNAL_COMPRESSED
+        /** @brief The open frame encoder. */
+        S_LogCodecEncoder _journalEncoder;
+        /** @brief The frame write buffer. */
+        uint8_t* _pJournalFrame;
+        /** @brief Slot of the open frame in the active segment. */
+        uint32_t _journalSlot;
+        /** @brief Tells if the open frame changed since it was written. */
+        bool _isJournalFrameDirty;
+        /** @brief Changes when the segments are rotated or removed. */
+        uint32_t _journalGeneration;
+        /** @brief The persistent journal frame reader. */
+        S_LogJournalReader* _pJournalReader;
+#endif
 
         /** @brief Stores the singleton instance. */
         static Logger* _SPINSTANCE;
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * @file OtaUpdater.h
+ *
+ * @see OtaUpdater.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware update writer.
+ *
+ * @details Firmware update writer. The image is streamed into the inactive
+ * application partition through two buffers, one is received while the other
+ * is written to the flash by the update task, and its hash is verified as it
+ * is written.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __OTA_UPDATER_H__
+#define __OTA_UPDATER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>           /* Standard atomic types */
+#include <cstdint>          /* Standard integer definitions */
+#include <cstddef>          /* Standard size type */
+#include <HAL.h>            /* Hardware abstraction layer */
+#include <Errors.h>         /* Errors definitions */
+#include <esp_ota_ops.h>    /* Application partitions updates */
+#include <mbedtls/md.h>     /* Image hash */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef OTA_BUFFER_SIZE
+/** @brief Defines the size of an update buffer in bytes, a flash sector. */
+#define OTA_BUFFER_SIZE 4096
+#endif
+
+/** @brief Defines the number of update buffers. */
+#define OTA_BUFFER_COUNT 2
+
+/** @brief Defines the size of the image hash in bytes. */
+#define OTA_HASH_SIZE 32
+
+#ifndef OTA_WRITE_TIMEOUT_NS
+/** @brief Defines the maximal wait for a buffer to be written. */
+#define OTA_WRITE_TIMEOUT_NS 5000000000ULL
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the update session states. */
+typedef enum {
+    /** @brief No update in progress. */
+    OTA_STATE_IDLE = 0,
+    /** @brief The image is being received. */
+    OTA_STATE_RECEIVING = 1,
+    /** @brief The image is verified and boots next. */
+    OTA_STATE_READY = 2,
+    /** @brief The update failed, it must be started again. */
+    OTA_STATE_FAILED = 3
+} E_OtaState;
+
+/** @brief Update session status. */
+typedef struct {
+    /** @brief The session state. */
+    E_OtaState state;
+    /** @brief The image size in bytes. */
+    uint32_t imageSize;
+    /** @brief The number of bytes received, where a transfer resumes. */
+    uint32_t offset;
+    /** @brief The number of bytes written to the flash. */
+    uint32_t written;
+    /** @brief The last error of the session. */
+    E_Return error;
+} S_OtaStatus;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The OtaUpdater class.
+ *
+ * @details The OtaUpdater class writes a firmware image into the inactive
+ * application partition. The received data fill one buffer while the update
+ * task writes the other one to the flash and hashes it. A session survives a
+ * dropped transfer, the next transfer resumes at the received offset. The
+ * image boots once its hash and content are verified.
+ */
+class OtaUpdater {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief OtaUpdater constructor.
+         */
+        OtaUpdater(void) noexcept;
+
+        /**
+         * @brief Destroys a OtaUpdater.
+         *
+         * @details Destroys a OtaUpdater. Since only one object is allowed in
+         * the firmware, the destructor will generate a critical error.
+         */
+        ~OtaUpdater(void) noexcept;
+
+        /**
+         * @brief Starts or resumes an update session.
+         *
+         * @details Starts an update session. When a session of the same image
+         * is already receiving, it is kept and the transfer resumes at its
+         * offset.
+         *
+         * @param[in] kImageSize The image size in bytes.
+         * @param[in] kpHash The SHA-256 of the image.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Begin(const uint32_t kImageSize,
+                       const uint8_t* kpHash) noexcept;
+
+        /**
+         * @brief Starts a transfer of the image.
+         *
+         * @param[in] kOffset The offset of the first byte of the transfer.
+         *
+         * @return The function returns the success or error status, the
+         * offset must be the session offset.
+         */
+        E_Return BeginTransfer(const uint32_t kOffset) noexcept;
+
+        /**
+         * @brief Receives data of the image.
+         *
+         * @param[in] kpData The received data.
+         * @param[in] kSize The size of the data in bytes.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Write(const uint8_t* kpData, const size_t kSize) noexcept;
+
+        /**
+         * @brief Ends a transfer of the image.
+         *
+         * @details Ends a transfer of the image, complete or dropped. The
+         * received data are written before the function returns.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return EndTransfer(void) noexcept;
+
+        /**
+         * @brief Verifies the image and selects it for the next boot.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Finish(void) noexcept;
+
+        /**
+         * @brief Stops the update session.
+         */
+        void Abort(void) noexcept;
+
+        /**
+         * @brief Returns the update session status.
+         *
+         * @param[out] rStatus The buffer receiving the status.
+         */
+        void GetStatus(S_OtaStatus& rStatus) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief Buffer handed to the update task. */
+        typedef struct {
+            /** @brief The buffer index. */
+            uint32_t index;
+            /** @brief The number of bytes to write. */
+            uint32_t size;
+        } S_OtaBlock;
+
+        /**
+         * @brief Update task routine.
+         *
+         * @param[in] pParam The updater.
+         */
+        static void TaskRoutine(void* pParam) noexcept;
+
+        /**
+         * @brief Allocates the buffers and creates the update task.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Init(void) noexcept;
+
+        /**
+         * @brief Hands the current buffer to the update task.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Submit(void) noexcept;
+
+        /**
+         * @brief Waits for the update task to write all the received data.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Drain(void) noexcept;
+
+        /**
+         * @brief Waits for the update task to give the buffers back.
+         *
+         * @return true is returned when all the buffers not held by the
+         * receiver are back.
+         */
+        bool Reclaim(void) noexcept;
+
+        /**
+         * @brief Marks the session as failed.
+         *
+         * @param[in] kError The failure reason.
+         */
+        void Fail(const E_Return kError) noexcept;
+
+        /** @brief The update buffers. */
+        uint8_t* _pBuffers[OTA_BUFFER_COUNT];
+        /** @brief The buffers to write, filled by the receiver. */
+        T_HALQueue _writeQueue;
+        /** @brief The written buffers, given back to the receiver. */
+        T_HALQueue _freeQueue;
+        /** @brief The update task. */
+        T_HALTask _task;
+        /** @brief The buffer being received, OTA_BUFFER_COUNT if none. */
+        uint32_t _current;
+        /** @brief The number of bytes in the buffer being received. */
+        uint32_t _fill;
+        /** @brief The partition receiving the image. */
+        const esp_partition_t* _pkPartition;
+        /** @brief The partition update handle. */
+        esp_ota_handle_t _handle;
+        /** @brief The hash of the written data. */
+        mbedtls_md_context_t _hash;
+        /** @brief The expected image hash. */
+        uint8_t _pExpectedHash[OTA_HASH_SIZE];
+        /** @brief The session state. */
+        E_OtaState _state;
+        /** @brief The image size in bytes. */
+        uint32_t _imageSize;
+        /** @brief The number of bytes received. */
+        uint32_t _received;
+        /** @brief The number of bytes written, updated by the update task. */
+        std::atomic<uint32_t> _written;
+        /** @brief The flash error of the update task, NO_ERROR if none. */
+        std::atomic<uint32_t> _writeError;
+        /** @brief The last error of the session. */
+        E_Return _error;
+};
+
+#endif /* #ifndef __OTA_UPDATER_H__ */
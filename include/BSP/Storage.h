@@ -24,13 +24,27 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#define DISABLE_FS_H_WARNING
-#include <SdFat.h>  /* SD Card driver */
+#include <HAL.h>    /* Hardware abstraction layer */
+#include <Errors.h> /* Error codes */
 
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/* None */
+
+#ifndef STORAGE_DEDICATED_SPI
+/**
+ * @brief Enables the dedicated SPI mode. The SD card keeps the bus between its
+ * accesses and uses multi-block transfers, the other SPI devices must acquire
+ * the bus through the storage.
+ */
+#define STORAGE_DEDICATED_SPI 0
+#endif
+
+/** @brief SD card SPI clock in MHz. */
+#define STORAGE_SPI_CLOCK_MHZ 40
+
+/** @brief Default storage bus acquisition timeout in nanoseconds. */
+#define STORAGE_BUS_TIMEOUT_NS 1000000000ULL
 
 /*******************************************************************************
  * MACROS
@@ -108,7 +122,7 @@ class Storage
          * @return The function returns a File object corresponding to the
          * opened file.
          */
-        FsFile Open(const char* kpPath, const oflag_t kpMode) noexcept;
+        T_HALFile Open(const char* kpPath, const oflag_t kpMode) noexcept;
 
         /**
          * @brief Removes a file.
@@ -126,6 +140,28 @@ class Storage
          */
         void Format(void) noexcept;
 
+        /**
+         * @brief Acquires the storage SPI bus.
+         *
+         * @details Acquires the storage SPI bus. The SD card accesses and the
+         * other SPI devices transactions must be done while the bus is
+         * acquired. The bus lock is recursive.
+         *
+         * @param[in] kTimeoutNs The acquisition timeout in nanoseconds.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return AcquireSPIBus(const uint64_t kTimeoutNs) noexcept;
+
+        /**
+         * @brief Releases the storage SPI bus.
+         *
+         * @details Releases the storage SPI bus. In dedicated SPI mode, the
+         * pending SD card transfers are ended when the last acquisition is
+         * released so the bus is idle before being granted again.
+         */
+        void ReleaseSPIBus(void) noexcept;
+
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
         /* None */
@@ -133,7 +169,11 @@ class Storage
     /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
     private:
         /** @brief Stores the SD card instance */
-        SdFs _sdCard;
+        T_HALStorageDevice _sdCard;
+        /** @brief The SPI bus lock, recursive. */
+        T_HALMutex _busLock;
+        /** @brief The SPI bus lock nesting depth. */
+        uint32_t _busDepth;
 };
 
 
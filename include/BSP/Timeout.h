@@ -23,13 +23,24 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <cstdint> /* Standard int types */
+#include <cstdint>  /* Standard int types */
+#include <HAL.h>    /* Hardware abstraction layer */
+#include <Errors.h> /* Errors definitions */
 
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
 
-/* None */
+#ifndef TIMEOUT_STATS_MAX
+/** @brief Defines the maximal number of timeouts recording statistics. */
+#define TIMEOUT_STATS_MAX 8
+#endif
+
+/**
+ * @brief Defines the number of buckets of the timing histograms. Buckets are
+ * log-linear in microseconds, 4 buckets per power of two, up to 2 seconds.
+ */
+#define TIMEOUT_HIST_BUCKETS 80
 
 /*******************************************************************************
  * MACROS
@@ -40,7 +51,33 @@
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-/* None */
+/** @brief Timing histogram of a timeout. */
+typedef struct {
+    /** @brief The samples count per microseconds bucket. */
+    uint32_t buckets[TIMEOUT_HIST_BUCKETS];
+    /** @brief The number of samples. */
+    uint32_t count;
+    /** @brief The minimal sample in nanoseconds. */
+    uint64_t minNs;
+    /** @brief The maximal sample in nanoseconds. */
+    uint64_t maxNs;
+} S_TimeoutHistogram;
+
+/** @brief Timing statistics of a periodic timeout. */
+typedef struct {
+    /** @brief The name of the timeout. */
+    const char* pName;
+    /** @brief The nominal period in nanoseconds. */
+    uint64_t periodNs;
+    /** @brief The actual periods between two notifications. */
+    S_TimeoutHistogram period;
+    /** @brief The lateness of the notifications after the wake deadline. */
+    S_TimeoutHistogram jitter;
+    /** @brief The execution time between notification and end of work. */
+    S_TimeoutHistogram execution;
+    /** @brief The number of notifications after the timeout expired. */
+    uint32_t overruns;
+} S_TimeoutStats;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -110,6 +147,17 @@ class Timeout
          */
         void Notify(void) noexcept;
 
+        /**
+         * @brief Notifies the timeout and watchdog of a tick at a given time.
+         *
+         * @details Notifies the timeout and watchdog of a tick at a given
+         * time. Periodic tasks read the time once per cycle and pass it to
+         * avoid reading it again.
+         *
+         * @param[in] kTime The time of the tick in nanoseconds.
+         */
+        void Notify(const uint64_t kTime) noexcept;
+
         /**
          * @brief Checks if the timeout was reached.
          *
@@ -120,6 +168,15 @@ class Timeout
          */
         bool HasTimedOut(void) const noexcept;
 
+        /**
+         * @brief Checks if the timeout was reached at a given time.
+         *
+         * @param[in] kTime The time to check in nanoseconds.
+         *
+         * @return Returns true if the timeout occured, false otherwise.
+         */
+        bool HasTimedOut(const uint64_t kTime) const noexcept;
+
         /**
          * @brief Returns the time in nanoseconds when the timeout will be
          * reached.
@@ -153,6 +210,84 @@ class Timeout
          */
         void ExecuteHandler(void) const noexcept;
 
+        /**
+         * @brief Enables the timing statistics.
+         *
+         * @details Enables the timing statistics of a periodic timeout. Each
+         * notification then records the actual period and jitter, and
+         * NotifyEnd records the execution time. The statistics are kept in
+         * a static slot, the timeout is listed by GetStats until destroyed.
+         *
+         * @param[in] pkName The name of the timeout, must outlive it.
+         * @param[in] kPeriodNs The nominal period in nanoseconds.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return EnableStats(const char* pkName, const uint64_t kPeriodNs)
+        noexcept;
+
+        /**
+         * @brief Notifies the end of the periodic work.
+         *
+         * @details Notifies the end of the periodic work started at the last
+         * notification. Records the execution time when the statistics are
+         * enabled.
+         */
+        void NotifyEnd(void) noexcept;
+
+        /**
+         * @brief Sets the wake deadline of the next notification.
+         *
+         * @details Sets the time at which the task plans to notify the
+         * timeout next. The jitter is the lateness of the next notification
+         * after this deadline, earlier notifications are event wakes and are
+         * not recorded. Without a deadline, the nominal period is used.
+         *
+         * @param[in] kTime The wake deadline in nanoseconds.
+         */
+        void SetWakeDeadline(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Gets the timing statistics of a timeout.
+         *
+         * @details Gets a consistent copy of the timing statistics of the
+         * timeout registered at the given index. The copy is taken under the
+         * statistics lock.
+         *
+         * @param[in] kIndex The index of the timeout, up to TIMEOUT_STATS_MAX.
+         * @param[out] pStats The statistics buffer.
+         *
+         * @return The function returns true if a timeout is registered at the
+         * index, false otherwise.
+         */
+        static bool GetStats(const uint32_t kIndex, S_TimeoutStats* pStats)
+        noexcept;
+
+        /**
+         * @brief Gets a percentile of a timing histogram.
+         *
+         * @details Gets a percentile of a timing histogram. The returned value
+         * is the upper bound of the bucket containing the percentile, clamped
+         * to the histogram range.
+         *
+         * @param[in] krHistogram The histogram.
+         * @param[in] kPercent The percentile to get, from 0 to 100.
+         *
+         * @return The function returns the percentile in nanoseconds.
+         */
+        static uint64_t GetPercentile(const S_TimeoutHistogram& krHistogram,
+                                      const uint8_t             kPercent)
+        noexcept;
+
+        /**
+         * @brief Records a sample in a timing histogram.
+         *
+         * @param[out] rHistogram The histogram to update.
+         * @param[in] kValueNs The sample in nanoseconds.
+         */
+        static void RecordSample(S_TimeoutHistogram& rHistogram,
+                                 const uint64_t      kValueNs) noexcept;
+
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -172,6 +307,17 @@ class Timeout
         uint32_t _watchdogId;
         /** @brief Stores the watchdog trigger handler. */
         void (*_pWDHandler) (void);
+        /** @brief Stores the last notification time. */
+        uint64_t _lastNotify;
+        /** @brief Stores the next wake deadline, 0 for the nominal period. */
+        uint64_t _wakeDeadline;
+        /** @brief Stores the statistics slot, TIMEOUT_STATS_MAX if disabled. */
+        uint32_t _statsSlot;
+
+        /** @brief The timing statistics slots, never released. */
+        static S_TimeoutStats _SPSTATS[TIMEOUT_STATS_MAX];
+        /** @brief The statistics lock. */
+        static T_HALSpinLock _SLOCK;
 };
 
 #endif /* #ifndef __TIMEOUT_H__ */
\ No newline at end of file
@@ -0,0 +1,356 @@
+/*******************************************************************************
+ * @file Tracer.h
+ *
+ * @see Tracer.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware events tracer.
+ *
+ * @details Firmware events tracer. The traced sections record timestamped
+ * begin and end events in per-core rings, the rings are exported as a
+ * timeline by the maintenance server and the API.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __TRACER_H__
+#define __TRACER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>   /* Atomic types */
+#include <cstdint>  /* Standard integer definitions */
+#include <cstddef>  /* Standard size type */
+#include <HAL.h>    /* Hardware abstraction layer */
+#include <Errors.h> /* Errors definitions */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef TRACE_ENABLED
+/**
+ * @brief Set to 0 to compile the tracing out. When compiled in, the tracing
+ * is started at runtime and a stopped tracer only costs a relaxed load per
+ * traced section.
+ */
+#define TRACE_ENABLED 1
+#endif
+
+#ifndef TRACE_RING_SIZE
+/** @brief Defines the number of events of a core ring (power of 2). */
+#define TRACE_RING_SIZE 8192
+#endif
+
+#ifndef TRACE_CORE_COUNT
+/** @brief Defines the number of traced cores. */
+#define TRACE_CORE_COUNT 2
+#endif
+
+#ifndef TRACE_MAX_TASKS
+/** @brief Defines the maximal number of tasks named in an export. */
+#define TRACE_MAX_TASKS 32
+#endif
+
+/** @brief Defines the size of a formatted export item. */
+#define TRACE_ITEM_SIZE 160
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+#if TRACE_ENABLED
+
+/**
+ * @brief Begins a traced section.
+ *
+ * @param[in] EVENT The traced section, an E_TraceEvent.
+ */
+#define TRACE_BEGIN(EVENT) {                                    \
+    Tracer::Record(EVENT, E_TracePhase::TRACE_PHASE_BEGIN);     \
+}
+
+/**
+ * @brief Ends a traced section.
+ *
+ * @param[in] EVENT The traced section, an E_TraceEvent.
+ */
+#define TRACE_END(EVENT) {                                      \
+    Tracer::Record(EVENT, E_TracePhase::TRACE_PHASE_END);       \
+}
+
+#else
+
+#define TRACE_BEGIN(EVENT)
+#define TRACE_END(EVENT)
+
+#endif
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the traced sections. */
+typedef enum {
+    /** @brief IO task cycle. */
+    TRACE_IO_TASK = 0,
+    /** @brief Health Monitor real-time task cycle. */
+    TRACE_HM_RT_TASK = 1,
+    /** @brief Health Monitor action execution. */
+    TRACE_HM_ACTION = 2,
+    /** @brief Web page request. */
+    TRACE_WEB_PAGE = 3,
+    /** @brief API request. */
+    TRACE_API_ROUTE = 4,
+    /** @brief Logger serial sink. */
+    TRACE_LOG_SERIAL = 5,
+    /** @brief Logger RAM journal sink. */
+    TRACE_LOG_RAM = 6,
+    /** @brief Logger persistent journal sink. */
+    TRACE_LOG_JOURNAL = 7,
+    /** @brief Number of traced sections. */
+    TRACE_EVENT_COUNT = 8
+} E_TraceEvent;
+
+/** @brief Defines the phases of a traced section. */
+typedef enum {
+    /** @brief The section started. */
+    TRACE_PHASE_BEGIN = 0,
+    /** @brief The section ended. */
+    TRACE_PHASE_END = 1
+} E_TracePhase;
+
+/** @brief Defines a trace event. */
+typedef struct {
+    /** @brief The event time in nanoseconds. */
+    uint64_t time;
+    /** @brief The task that recorded the event. */
+    uintptr_t task;
+    /** @brief The traced section, an E_TraceEvent. */
+    uint8_t event;
+    /** @brief The section phase, an E_TracePhase. */
+    uint8_t phase;
+    /** @brief The core that recorded the event. */
+    uint8_t core;
+} S_TraceEvent;
+
+/** @brief Trace ring slot, the sequence tells which event it holds. */
+typedef struct {
+    /** @brief The index of the event plus one, 0 while written. */
+    std::atomic<uint32_t> sequence;
+    /** @brief The recorded event. */
+    S_TraceEvent event;
+} S_TraceSlot;
+
+/** @brief Trace events reader. */
+typedef struct {
+    /** @brief The next event index per core. */
+    uint32_t pNext[TRACE_CORE_COUNT];
+    /** @brief The end of the read range per core. */
+    uint32_t pEnd[TRACE_CORE_COUNT];
+    /** @brief The core being read. */
+    uint8_t core;
+    /** @brief The events overwritten before they were read. */
+    uint32_t lost;
+} S_TraceCursor;
+
+/** @brief Defines the parts of a trace export. */
+typedef enum {
+    /** @brief The document start. */
+    TRACE_EXPORT_HEADER = 0,
+    /** @brief The tasks names metadata. */
+    TRACE_EXPORT_TASKS = 1,
+    /** @brief The recorded events. */
+    TRACE_EXPORT_EVENTS = 2,
+    /** @brief The document end. */
+    TRACE_EXPORT_FOOTER = 3,
+    /** @brief The export is complete. */
+    TRACE_EXPORT_DONE = 4
+} E_TraceExportPart;
+
+/** @brief Trace export in the Chrome trace event format. */
+typedef struct {
+    /** @brief The events reader. */
+    S_TraceCursor cursor;
+    /** @brief The tasks alive when the export was opened. */
+    S_HALTaskInfo pTasks[TRACE_MAX_TASKS];
+    /** @brief The number of tasks. */
+    uint32_t taskCount;
+    /** @brief The next task to name. */
+    uint32_t task;
+    /** @brief The part being exported. */
+    E_TraceExportPart part;
+    /** @brief Tells if the next item is the first of the events array. */
+    bool isFirst;
+    /** @brief The size of the item not sent yet, 0 if none. */
+    size_t itemSize;
+    /** @brief The item not sent yet. */
+    char pItem[TRACE_ITEM_SIZE];
+} S_TraceExport;
+
+static_assert(0 == (TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)),
+              "The trace ring size must be a power of 2");
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The Tracer class.
+ *
+ * @details The Tracer class records the traced sections of the firmware. Each
+ * core writes its own PSRAM ring, allocated on the first start, the oldest
+ * events are overwritten when a ring is full. Recording never blocks: a slot
+ * is claimed with an atomic increment and published with its sequence, the
+ * readers skip the slots rewritten while they are read.
+ */
+class Tracer {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Starts the tracing.
+         *
+         * @details Starts the tracing. The events recorded before the start
+         * are discarded from the next readings.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return Start(void) noexcept;
+
+        /**
+         * @brief Stops the tracing, the recorded events are kept.
+         */
+        static void Stop(void) noexcept;
+
+        /**
+         * @brief Tells if the tracing is started.
+         *
+         * @return true is returned when the tracing is started.
+         */
+        static bool IsStarted(void) noexcept;
+
+        /**
+         * @brief Records an event of the current task.
+         *
+         * @details Records an event of the current task. This function is
+         * lock-free, it can be called from any task and returns at once
+         * when the tracing is stopped.
+         *
+         * @param[in] kEvent The traced section.
+         * @param[in] kPhase The section phase.
+         */
+        static void Record(const E_TraceEvent kEvent,
+                           const E_TracePhase kPhase) noexcept;
+
+        /**
+         * @brief Opens a reader on the recorded events.
+         *
+         * @details Opens a reader on the recorded events. The reader covers
+         * the events recorded up to the call, core after core.
+         *
+         * @param[out] rCursor The reader to open.
+         */
+        static void OpenCursor(S_TraceCursor& rCursor) noexcept;
+
+        /**
+         * @brief Reads the next event of a reader.
+         *
+         * @param[in, out] rCursor The reader.
+         * @param[out] rEvent The event buffer.
+         *
+         * @return true is returned when an event was read, false at the end
+         * of the events.
+         */
+        static bool ReadCursor(S_TraceCursor& rCursor,
+                               S_TraceEvent&  rEvent) noexcept;
+
+        /**
+         * @brief Returns the name of a traced section.
+         *
+         * @param[in] kEvent The traced section.
+         *
+         * @return The name of the section is returned.
+         */
+        static const char* GetName(const uint8_t kEvent) noexcept;
+
+        /**
+         * @brief Opens an export of the recorded events.
+         *
+         * @details Opens an export of the recorded events in the Chrome
+         * trace event format, as read by chrome://tracing and Perfetto. The
+         * events are "B" and "E" events of the process 0, their thread is
+         * the recording task, named after the tasks alive at the call.
+         *
+         * @param[out] rExport The export to open.
+         */
+        static void OpenExport(S_TraceExport& rExport) noexcept;
+
+        /**
+         * @brief Reads the next part of an export.
+         *
+         * @param[in, out] rExport The export.
+         * @param[out] pBuffer The buffer receiving the document.
+         * @param[in] kSize The size of the buffer, at least TRACE_ITEM_SIZE.
+         *
+         * @return The number of bytes read is returned, 0 at the end of the
+         * export.
+         */
+        static size_t ReadExport(S_TraceExport& rExport,
+                                 char*          pBuffer,
+                                 const size_t   kSize) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Formats the next item of an export.
+         *
+         * @param[in, out] rExport The export, the item is formatted in its
+         * item buffer.
+         *
+         * @return The size of the item is returned, 0 at the end of the
+         * export.
+         */
+        static size_t FormatItem(S_TraceExport& rExport) noexcept;
+
+        /** @brief The events rings per core, nullptr until the first start. */
+        static S_TraceSlot* _SPRINGS[TRACE_CORE_COUNT];
+        /** @brief The next event index per core. */
+        static std::atomic<uint32_t> _SPHEADS[TRACE_CORE_COUNT];
+        /** @brief The index of the first event of the trace per core. */
+        static std::atomic<uint32_t> _SPSTARTS[TRACE_CORE_COUNT];
+        /** @brief Tells if the tracing is started. */
+        static std::atomic<bool> _SISSTARTED;
+};
+
+#endif /* #ifndef __TRACER_H__ */
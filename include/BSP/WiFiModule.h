@@ -23,6 +23,7 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
+#include <atomic>              /* Standard atomic types */
 #include <string>              /* Standard string */
 #include <cstdint>             /* Standard integer definitions */
 #include <Errors.h>            /* Error definitions */
@@ -30,6 +31,15 @@
 #include <HMReporter.h>        /* HM Reporter abstraction */
 #include <WebServerHandlers.h> /* WebServer handlers */
 #include <APIServerHandlers.h> /* APIServer handlers */
+#include <KeepAliveServer.h>   /* Persistent connections server */
+#include <EventStream.h>       /* Live events stream */
+#include <WiFiPower.h>         /* WiFi power-save scheduler */
+#include <SettingsIds.h>       /* Settings identifiers */
+#include <MemoryPool.h>        /* API memory pool */
+#include <lwip/ip4_addr.h>     /* lwIP IPv4 addresses */
+
+/* Forward class declarations to avoid recursive inclusions */
+class Settings;
 
 /*******************************************************************************
  * CONSTANTS
@@ -44,6 +54,16 @@
 /** @brief Defines the size of the IP setting. */
 #define IP_ADDR_SIZE_BYTES 15
 
+#ifndef WIFI_FAST_CONNECT_REUSE_LEASE
+/**
+ * @brief Reuses the cached DHCP lease when connecting to the last access
+ * point. The lease is applied as a static address and is not renewed, only
+ * enable it when the router reserves the address of the node. A reused lease
+ * is not cached again, the next connection runs DHCP.
+ */
+#define WIFI_FAST_CONNECT_REUSE_LEASE 0
+#endif
+
 /*******************************************************************************
  * MACROS
  ******************************************************************************/
@@ -86,25 +106,84 @@ typedef struct {
     /** @brief WiFi Static configuration status. */
     std::pair<bool, bool> isStatic;
     /** @brief WiFi network SSID. */
-    std::pair<std::string, bool> ssid;
+    std::pair<APIString, bool> ssid;
     /** @brief WiFi network password. */
-    std::pair<std::string, bool> password;
+    std::pair<APIString, bool> password;
     /** @brief WiFi IP address. */
-    std::pair<std::string, bool> ip;
+    std::pair<APIString, bool> ip;
     /** @brief WiFi static gateway IP adress. */
-    std::pair<std::string, bool> gateway;
+    std::pair<APIString, bool> gateway;
     /** @brief WiFi static subnet. */
-    std::pair<std::string, bool> subnet;
+    std::pair<APIString, bool> subnet;
     /** @brief WiFi primary DNS IP address. */
-    std::pair<std::string, bool> primaryDNS;
+    std::pair<APIString, bool> primaryDNS;
     /** @brief WiFi secondary DNS IP address. */
-    std::pair<std::string, bool> secondaryDNS;
+    std::pair<APIString, bool> secondaryDNS;
     /** @brief WiFi web interface port. */
     std::pair<uint16_t, bool> webPort;
     /** @brief WiFi API interface port. */
     std::pair<uint16_t, bool> apiPort;
 } S_WiFiConfigRequest;
 
+/** @brief Defines the addresses of a WiFi configuration. */
+typedef enum {
+    /** @brief WiFi IP address. */
+    WIFI_ADDR_IP = 0,
+    /** @brief WiFi static gateway IP address. */
+    WIFI_ADDR_GATEWAY = 1,
+    /** @brief WiFi static subnet. */
+    WIFI_ADDR_SUBNET = 2,
+    /** @brief WiFi primary DNS IP address. */
+    WIFI_ADDR_PRIMARY_DNS = 3,
+    /** @brief WiFi secondary DNS IP address. */
+    WIFI_ADDR_SECONDARY_DNS = 4,
+    /** @brief Number of addresses. */
+    WIFI_ADDR_COUNT = 5
+} E_WiFiAddress;
+
+/**
+ * @brief Defines a validated WiFi configuration, the addresses are parsed to
+ * their binary form. The structure is zeroed before it is filled, its hash
+ * covers all the fields before it.
+ */
+typedef struct {
+    /** @brief WiFI AP mode. */
+    bool isAP;
+    /** @brief WiFi Static configuration status. */
+    bool isStatic;
+    /** @brief WiFi network SSID. */
+    char ssid[SSID_SIZE_BYTES + 1];
+    /** @brief WiFi network password. */
+    char password[PASS_SIZE_BYTES + 1];
+    /** @brief Tells which addresses are set, by E_WiFiAddress. */
+    bool pIsSet[WIFI_ADDR_COUNT];
+    /** @brief The addresses, by E_WiFiAddress, 0 when not set. */
+    ip4_addr_t pAddresses[WIFI_ADDR_COUNT];
+    /** @brief WiFi web interface port. */
+    uint16_t webPort;
+    /** @brief WiFi API interface port. */
+    uint16_t apiPort;
+    /** @brief The CRC32 of the previous fields. */
+    uint32_t hash;
+} S_WiFiParsedConfig;
+
+/* Forward declaration */
+class WiFiModule;
+
+/** @brief Defines the servers served by the servers task. */
+typedef struct {
+    /** @brief The null-terminated list of the one request servers. */
+    WebServer* pServers[2];
+    /** @brief The persistent connections server. */
+    KeepAliveServer* pKeepAliveServer;
+    /** @brief The live events stream of the web server. */
+    EventStream* pEventStream;
+    /** @brief The power-save scheduler woken up by the sessions. */
+    WiFiPower* pPower;
+    /** @brief The module applying the settings changes between requests. */
+    WiFiModule* pModule;
+} S_ServersSet;
+
 /*******************************************************************************
  * GLOBAL VARIABLES
  ******************************************************************************/
@@ -202,7 +281,9 @@ class WiFiModule {
          * @details Updates the current WiFi configuration. The new provided
          * configuration is compared to the current one and only applicable
          * settings are updated. The function performs all configuration checks
-         * before appying the new configuration.
+         * before appying the new configuration. A configuration equal to the
+         * stored one is not committed. The changes are applied by the servers
+         * task once the response is sent.
          *
          * @param[in] krConfig The new configuration to apply.
          *
@@ -210,6 +291,49 @@ class WiFiModule {
          */
         E_Return SetConfiguration(const S_WiFiConfigRequest& krConfig) noexcept;
 
+        /**
+         * @brief Updates the request latency budget.
+         *
+         * @details Updates the request latency budget. The budget is saved in
+         * the settings and applied without restarting the module. The power
+         * save is only used in node mode.
+         *
+         * @param[in] kBudgetMs The budget in milliseconds, 0 disables the
+         * power save.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return SetLatencyBudget(const uint16_t kBudgetMs) noexcept;
+
+        /**
+         * @brief Returns the power-save scheduler of the module.
+         *
+         * @return The power-save scheduler is returned.
+         */
+        WiFiPower* GetPower(void) const noexcept;
+
+        /**
+         * @brief Tells if the node uplink is usable.
+         *
+         * @details Tells if the node uplink is usable. The link is up when
+         * the node is associated and its RSSI is above WIFI_MIN_RSSI, as
+         * last checked by the health reporter. The link is never up in AP
+         * mode.
+         *
+         * @return true if the link is up, false otherwise.
+         */
+        bool IsLinkUp(void) const noexcept;
+
+        /**
+         * @brief Applies the pending WiFi settings changes.
+         *
+         * @details Applies the pending WiFi settings changes. The port
+         * changes rebind the affected server, the network changes restart
+         * the node or the access point with the new configuration. Called by
+         * the servers task between two requests.
+         */
+        void ApplySettingsChanges(void) noexcept;
+
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
         /* None */
@@ -217,6 +341,18 @@ class WiFiModule {
     /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
     private:
 
+        /**
+         * @brief Starts the WiFi network.
+         *
+         * @details Starts the WiFi network. The configuration is read from
+         * the settings and the module is started as node or access point.
+         *
+         * @param[in] pSettings The settings object to read.
+         *
+         * @return The functions returns the success or error status.
+         */
+        E_Return StartNetwork(Settings* pSettings) noexcept;
+
         /**
          * @brief Starts the WiFi module in AP mode.
          *
@@ -237,6 +373,56 @@ class WiFiModule {
          */
         E_Return StartNode(void) noexcept;
 
+        /**
+         * @brief Connects to the last access point.
+         *
+         * @details Connects to the last access point, with the BSSID and
+         * channel of the fast connect cache. No scan is performed and, when
+         * WIFI_FAST_CONNECT_REUSE_LEASE is set, the cached DHCP lease is
+         * reused once. The cache is invalidated on failure.
+         *
+         * @return The function returns true when connected.
+         */
+        bool ConnectFast(void) noexcept;
+
+        /**
+         * @brief Waits for the node connection.
+         *
+         * @param[in] kTimeoutNs The maximal wait time in nanoseconds.
+         *
+         * @return The function returns true when connected.
+         */
+        bool WaitConnection(const uint64_t kTimeoutNs) const noexcept;
+
+        /**
+         * @brief Saves the current connection in the fast connect cache.
+         *
+         * @param[in] kCredentialsKey The key of the connection credentials.
+         */
+        void SaveFastConnect(const uint32_t kCredentialsKey) noexcept;
+
+        /**
+         * @brief Starts a background reconnection.
+         *
+         * @details Starts a background reconnection when the node lost its
+         * network. The association is started and the function returns
+         * without waiting for it.
+         */
+        void StartReconnect(void) noexcept;
+
+        /**
+         * @brief Starts the association to the network.
+         *
+         * @details Starts the association to the network. The station is
+         * configured first, the power-save listen interval is only read by
+         * the access point at association.
+         *
+         * @param[in] kChannel The channel of the access point, 0 to scan.
+         * @param[in] kpBssid The BSSID of the access point, nullptr to scan.
+         */
+        void BeginStation(const int32_t  kChannel,
+                          const uint8_t* kpBssid) noexcept;
+
         /**
          * @brief Configures the different servers.
          *
@@ -251,7 +437,7 @@ class WiFiModule {
          * @brief Configures the different server tasks.
          *
          * @details Configures the different server tasks. This function will
-         * setup the web and api server tasks.
+         * setup the single task serving both the web and api servers.
          *
          * @return The functions returns the success or error status.
          */
@@ -262,35 +448,75 @@ class WiFiModule {
          *
          * @details Validates the new  WiFi configuration. The new provided
          * configuration is compared to the current one and only applicable
-         * settings are updated. The function performs all configuration checks.
+         * settings are updated. The function performs all configuration checks
+         * and parses the configuration in the same pass.
          *
          * @param[in] krConfig The new configuration to apply.
+         * @param[out] rConfig The parsed configuration, valid and hashed when
+         * no error is returned.
          *
          * @return The function returns the success or error status.
          */
-        E_Return ValidateConfiguration(const S_WiFiConfigRequest& krConfig)
+        E_Return ValidateConfiguration(const S_WiFiConfigRequest& krConfig,
+                                       S_WiFiParsedConfig&        rConfig)
         const noexcept;
 
+        /**
+         * @brief Loads the stored WiFi configuration.
+         *
+         * @details Loads the stored WiFi configuration in its parsed form.
+         * The new configurations are compared to it to skip the commits
+         * that would not change the settings.
+         *
+         * @param[in] pSettings The settings object to read.
+         */
+        void LoadStoredConfiguration(Settings* pSettings) noexcept;
+
+        /**
+         * @brief Records the change of a WiFi setting.
+         *
+         * @details Records the change of a WiFi setting. Called on the
+         * committing task, the change is applied by the servers task.
+         *
+         * @param[in] kId The changed setting identifier.
+         * @param[in] pArgs The WiFi module.
+         */
+        static void OnSettingChange(const E_SettingId kId, void* pArgs)
+        noexcept;
+
         /** @brief Stores the WiFi module configuration. */
         S_WiFiConfig _config;
+        /** @brief Stores the parsed configuration of the settings. */
+        S_WiFiParsedConfig _storedConfig;
+
+        /** @brief Stores the mask of the changed settings to apply. */
+        std::atomic<uint32_t> _pendingSettings;
 
         /** @brief Stores the current state of the module */
         bool _isStarted;
+        /** @brief Tells if the connection uses the cached DHCP lease. */
+        bool _isLeaseReused;
+        /** @brief Stores the uplink state of the last health check. */
+        std::atomic<bool> _isLinkUp;
 
         /** @brief Stores the Web Interface server instance. */
         WebServer* _pWebServer;
         /** @brief Stores the API Interface server instance. */
-        WebServer* _pAPIServer;
+        KeepAliveServer* _pAPIServer;
 
         /** @brief Stores the Web Interface server handlers instance. */
         WebServerHandlers* _pWebServerHandler;
         /** @brief Stores the API Interface server handlers instance. */
         APIServerHandlers* _pAPIServerHandler;
 
-        /** @brief Web handler task handle. */
-        TaskHandle_t _pWebServerTask;
-        /** @brief API handler task handle. */
-        TaskHandle_t _pAPIServerTask;
+        /** @brief Stores the power-save scheduler. */
+        WiFiPower* _pPower;
+
+        /** @brief The servers of the servers task. */
+        S_ServersSet _servers;
+
+        /** @brief Web and API servers task handle. */
+        TaskHandle_t _pServersTask;
 
         /** @brief Stores the Health Reporter for the WiFiModule */
         WiFiModuleHealthReporter* _pReporter;
@@ -0,0 +1,269 @@
+/*******************************************************************************
+ * @file WiFiPower.h
+ *
+ * @see WiFiPower.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief WiFi power-save scheduler.
+ *
+ * @details WiFi power-save scheduler. The radio sleeps between the AP beacons
+ * within a request latency budget and is kept fully awake during the API and
+ * web sessions. The residency in each state gives the estimated current draw.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __WIFI_POWER_H__
+#define __WIFI_POWER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard integer definitions */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef WIFI_PS_BEACON_INTERVAL_US
+/** @brief Defines the AP beacon interval in microseconds (100 TU). */
+#define WIFI_PS_BEACON_INTERVAL_US 102400
+#endif
+
+#ifndef WIFI_PS_MAX_LISTEN_INTERVAL
+/** @brief Defines the maximal listen interval in beacon intervals. */
+#define WIFI_PS_MAX_LISTEN_INTERVAL 10
+#endif
+
+#ifndef WIFI_PS_MAX_BUDGET_MS
+/** @brief Defines the maximal accepted latency budget in milliseconds. */
+#define WIFI_PS_MAX_BUDGET_MS 2000
+#endif
+
+#ifndef WIFI_PS_IDLE_NS
+/** @brief Defines the idle time ending a session in nanoseconds. */
+#define WIFI_PS_IDLE_NS 2000000000ULL
+#endif
+
+#ifndef WIFI_POWER_RX_UA
+/** @brief Defines the current draw of the awake radio in microamperes. */
+#define WIFI_POWER_RX_UA 95000
+#endif
+
+#ifndef WIFI_POWER_SLEEP_UA
+/** @brief Defines the current draw of the sleeping modem in microamperes. */
+#define WIFI_POWER_SLEEP_UA 30000
+#endif
+
+#ifndef WIFI_POWER_BEACON_WAKE_US
+/** @brief Defines the radio awake time per received beacon in microseconds. */
+#define WIFI_POWER_BEACON_WAKE_US 3000
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief WiFi power-save statistics. */
+typedef struct {
+    /** @brief The request latency budget in milliseconds, 0 when disabled. */
+    uint16_t budgetMs;
+    /** @brief The listen interval in beacons, 0 when the radio never sleeps. */
+    uint16_t listenInterval;
+    /** @brief Tells if the radio is currently kept awake. */
+    bool isAwake;
+    /** @brief The time spent with the radio awake in milliseconds. */
+    uint64_t awakeMs;
+    /** @brief The time spent in power save in milliseconds. */
+    uint64_t sleepMs;
+    /** @brief The number of sessions that woke the radio. */
+    uint32_t wakeups;
+    /** @brief The estimated average current draw in microamperes. */
+    uint32_t avgCurrentUa;
+    /** @brief The estimated power save current draw in microamperes. */
+    uint32_t sleepCurrentUa;
+    /** @brief The average wake latency added to a session start in us. */
+    uint32_t wakeLatencyAvgUs;
+    /** @brief The worst wake latency added to a session start in us. */
+    uint32_t wakeLatencyMaxUs;
+    /** @brief The number of served API responses. */
+    uint32_t responses;
+    /** @brief The average API response service time in microseconds. */
+    uint32_t serviceAvgUs;
+    /** @brief The worst API response service time in microseconds. */
+    uint32_t serviceMaxUs;
+} S_WiFiPowerStats;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The WiFiPower class.
+ *
+ * @details The WiFiPower class schedules the station modem sleep. Outside of
+ * the sessions, the station only wakes every listen interval beacons, the
+ * listen interval is the largest one fitting the latency budget. The AP DTIM
+ * period is not controlled by the node, the budget is therefore enforced with
+ * the listen interval of the maximal modem sleep. A session starts with the
+ * first connected client and ends after WIFI_PS_IDLE_NS without clients.
+ * Besides the initial configuration, the methods must be called from the
+ * servers task.
+ */
+class WiFiPower {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief WiFiPower constructor.
+         */
+        WiFiPower(void) noexcept;
+
+        /**
+         * @brief Sets the request latency budget.
+         *
+         * @details Sets the request latency budget. The radio is woken up.
+         * The listen interval is only read at association, the new interval is
+         * used after the next ConfigureStation.
+         *
+         * @param[in] kBudgetMs The budget in milliseconds, 0 disables the
+         * power save.
+         */
+        void SetLatencyBudget(const uint16_t kBudgetMs) noexcept;
+
+        /**
+         * @brief Sets the listen interval in the station configuration.
+         *
+         * @details Sets the listen interval of the latency budget in the
+         * station configuration. The access point reads it at association,
+         * it is called by the connecting task before each connection.
+         */
+        void ConfigureStation(void) noexcept;
+
+        /**
+         * @brief Updates the power state.
+         *
+         * @details Updates the power state. The radio is woken up when a
+         * session starts and put back in power save once idle.
+         *
+         * @param[in] kIsActive Tells if clients are connected to the servers.
+         */
+        void Update(const bool kIsActive) noexcept;
+
+        /**
+         * @brief Records the service time of an API response.
+         *
+         * @param[in] kDurationNs The service time in nanoseconds.
+         */
+        void RecordResponse(const uint64_t kDurationNs) noexcept;
+
+        /**
+         * @brief Returns the power-save statistics.
+         *
+         * @param[out] rStats The statistics buffer.
+         */
+        void GetStats(S_WiFiPowerStats& rStats) noexcept;
+
+        /**
+         * @brief Returns the listen interval fitting a latency budget.
+         *
+         * @param[in] kBudgetMs The budget in milliseconds.
+         *
+         * @return The listen interval in beacons is returned, 0 when the
+         * budget is shorter than a beacon interval.
+         */
+        static uint16_t GetListenInterval(const uint16_t kBudgetMs) noexcept;
+
+        /**
+         * @brief Returns the estimated power save current draw.
+         *
+         * @param[in] kListenInterval The listen interval in beacons, 0 for a
+         * radio always awake.
+         *
+         * @return The estimated current draw in microamperes is returned.
+         */
+        static uint32_t GetSleepCurrent(const uint16_t kListenInterval)
+        noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Accounts the time spent in the current state.
+         *
+         * @param[in] kTime The current time in nanoseconds.
+         */
+        void Account(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Applies a power state to the radio.
+         *
+         * @param[in] kIsAwake true to keep the radio awake, false to enter
+         * power save.
+         */
+        void ApplyState(const bool kIsAwake) noexcept;
+
+        /** @brief The request latency budget in milliseconds. */
+        uint16_t _budgetMs;
+        /** @brief The listen interval of the budget in beacons. */
+        uint16_t _budgetInterval;
+        /** @brief The listen interval of the association in beacons. */
+        uint16_t _listenInterval;
+        /** @brief Tells if the radio is kept awake. */
+        bool _isAwake;
+        /** @brief The time of the last accounting in nanoseconds. */
+        uint64_t _lastUpdate;
+        /** @brief The time of the last session activity in nanoseconds. */
+        uint64_t _lastActivity;
+        /** @brief The time spent with the radio awake in nanoseconds. */
+        uint64_t _awakeNs;
+        /** @brief The time spent in power save in nanoseconds. */
+        uint64_t _sleepNs;
+        /** @brief The estimated consumed charge in microampere-microseconds. */
+        uint64_t _charge;
+        /** @brief The number of sessions that woke the radio. */
+        uint32_t _wakeups;
+        /** @brief The number of served API responses. */
+        uint32_t _responses;
+        /** @brief The cumulated API response service time in nanoseconds. */
+        uint64_t _serviceNs;
+        /** @brief The worst API response service time in nanoseconds. */
+        uint64_t _serviceMaxNs;
+};
+
+#endif /* #ifndef __WIFI_POWER_H__ */
@@ -172,23 +172,58 @@ class WiFiValidator {
          */
         static bool ValidatePorts(const S_WiFiConfigRequest& krConfig) noexcept;
 
-    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
-    protected:
-        /* None */
+        /**
+         * @brief Parses a configuration address.
+         *
+         * @details Parses a configuration address to its binary form in a
+         * single pass. The addresses of a static configuration are mandatory,
+         * the others may be left empty.
+         *
+         * @param[in] krAddress The request address.
+         * @param[in] kIsStatic Tells if the configuration is static.
+         * @param[in] kAddress The address to parse.
+         * @param[out] rConfig The parsed configuration receiving the address.
+         *
+         * @return True is returned is the address is valid, otherwise false is
+         * returned.
+         */
+        static bool ParseAddress(const std::pair<APIString, bool>& krAddress,
+                                 const bool                        kIsStatic,
+                                 const E_WiFiAddress               kAddress,
+                                 S_WiFiParsedConfig&               rConfig)
+        noexcept;
 
-    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
-    private:
         /**
-         * @brief Validates the format of an IP address.
+         * @brief Parses an IP address.
+         *
+         * @details Parses an IP address to its binary form in a single pass.
+         * Checks the content, number of point and range of each nible.
          *
-         * @details Validates the format of an IP address. Checks the content,
-         * number of point and  range of each nible.
+         * @param[in] kpIp The IP address string.
+         * @param[out] rAddress The parsed address, only set when valid.
          *
          * @return True is returned is the format is valid, otherwise false is
          * returned.
          */
-        static bool CheckIpFormat(const char* kpIp) noexcept;
+        static bool ParseIp(const char* kpIp, ip4_addr_t& rAddress) noexcept;
 
+        /**
+         * @brief Hashes a parsed configuration.
+         *
+         * @param[in] krConfig The parsed configuration, zeroed before it was
+         * filled.
+         *
+         * @return The CRC32 of the configuration fields is returned.
+         */
+        static uint32_t Hash(const S_WiFiParsedConfig& krConfig) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /* None */
 };
 
 #endif /* #ifndef __WIFI_VALIDATOR_H__ */
\ No newline at end of file
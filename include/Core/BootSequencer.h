@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * @file BootSequencer.h
+ *
+ * @see BootSequencer.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Dependency ordered boot sequencer.
+ *
+ * @details Dependency ordered boot sequencer. The boot is described as a table
+ * of stages with their dependencies, the stages that do not depend on each
+ * other are executed at the same time on their core.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_BOOT_SEQUENCER_H__
+#define __CORE_BOOT_SEQUENCER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>                 /* Standard integer definitions */
+#include <Errors.h>                /* Errors definitions */
+#include <Arduino.h>               /* Arduino framework */
+#include <freertos/event_groups.h> /* FreeRTOS event groups */
+
+/* Forward declarations */
+class BootSequencer;
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef BOOT_MAX_STAGES
+/** @brief Defines the maximal number of boot stages. */
+#define BOOT_MAX_STAGES 16
+#endif
+
+#ifndef BOOT_STAGE_STACK
+/** @brief Defines the boot stages tasks stack size in bytes. */
+#define BOOT_STAGE_STACK 8192
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/**
+ * @brief Returns the dependency mask of a boot stage.
+ *
+ * @param[in] STAGE The index of the stage in the table.
+ */
+#define BOOT_DEPENDS_ON(STAGE) (1UL << (STAGE))
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/**
+ * @brief Boot stage routine.
+ *
+ * @return The routine returns the success or error status of the stage.
+ */
+typedef E_Return (*BootStageRoutine)(void);
+
+/** @brief Boot stage descriptor. */
+typedef struct {
+    /** @brief The stage name. */
+    const char* pkName;
+    /** @brief The stage routine. */
+    BootStageRoutine routine;
+    /** @brief The mask of the stages that must complete before the stage. */
+    uint32_t dependencies;
+    /** @brief The core executing the stage. */
+    BaseType_t core;
+} S_BootStage;
+
+/** @brief Boot stage execution context. */
+typedef struct {
+    /** @brief The sequencer executing the stage. */
+    BootSequencer* pSequencer;
+    /** @brief The index of the stage in the table. */
+    uint32_t index;
+    /** @brief The stage result, the dependency error for skipped stages. */
+    E_Return result;
+    /** @brief The stage start time in nanoseconds. */
+    uint64_t startTime;
+    /** @brief The stage end time in nanoseconds. */
+    uint64_t endTime;
+} S_BootStageContext;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The BootSequencer class.
+ *
+ * @details The BootSequencer class executes a table of boot stages. Each stage
+ * runs in its own task on its core as soon as all its dependencies completed.
+ * A stage only depends on stages placed before it in the table, this rules out
+ * dependency cycles. When a stage fails, the stages depending on it are
+ * skipped.
+ */
+class BootSequencer {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief BootSequencer constructor.
+         *
+         * @param[in] kpStages The stages table, it must outlive the object.
+         * @param[in] kStageCount The number of stages in the table.
+         */
+        BootSequencer(const S_BootStage* kpStages,
+                      const uint32_t     kStageCount) noexcept;
+
+        /**
+         * @brief BootSequencer destructor.
+         *
+         * @details BootSequencer destructor. Releases the used resources.
+         */
+        ~BootSequencer(void) noexcept;
+
+        /**
+         * @brief Executes the boot stages.
+         *
+         * @details Executes the boot stages and waits for all of them to
+         * complete or be skipped.
+         *
+         * @param[out] rFailedStage The index of the first failed stage, set
+         * on error only.
+         *
+         * @return The function returns the success status, or the error of
+         * the first failed stage.
+         */
+        E_Return Run(uint32_t& rFailedStage) noexcept;
+
+        /**
+         * @brief Tells if a stages table only has backward dependencies.
+         *
+         * @details Tells if a stages table only has backward dependencies.
+         * This is meant to be used in a static_assert next to the table
+         * definition.
+         *
+         * @param[in] kpStages The stages table.
+         * @param[in] kCount The number of stages in the table.
+         * @param[in] kIndex The first stage to check.
+         *
+         * @return true if every stage only depends on the stages before it
+         * and the table fits BOOT_MAX_STAGES.
+         */
+        static constexpr bool IsOrdered(const S_BootStage* kpStages,
+                                        const uint32_t     kCount,
+                                        const uint32_t     kIndex = 0)
+        noexcept {
+            return (BOOT_MAX_STAGES < kCount) ?
+                false :
+                (kCount <= kIndex) ?
+                    true :
+                    (0 == (kpStages[kIndex].dependencies >> kIndex) &&
+                     IsOrdered(kpStages, kCount, kIndex + 1));
+        }
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Boot stage task routine.
+         *
+         * @details Boot stage task routine. Waits for the dependencies of the
+         * stage, executes it and signals its completion.
+         *
+         * @param[in] pContext The stage context.
+         */
+        static void StageRoutine(void* pContext) noexcept;
+
+        /** @brief The stages table. */
+        const S_BootStage* _pkStages;
+        /** @brief The number of stages. */
+        uint32_t _stageCount;
+        /** @brief The stages execution contexts. */
+        S_BootStageContext _pContexts[BOOT_MAX_STAGES];
+        /** @brief The stages completion events, one bit per stage. */
+        EventGroupHandle_t _events;
+};
+
+#endif /* #ifndef __CORE_BOOT_SEQUENCER_H__ */
@@ -84,12 +84,44 @@ typedef enum {
     ERR_WIFI_INVALID_DNS,
     /** @brief WiFi settings error: invalid ports */
     ERR_WIFI_INVALID_PORTS,
+    /** @brief WiFi settings error: invalid latency budget */
+    ERR_WIFI_INVALID_LATENCY,
     /** @brief Error when an action lock timed out. */
     ERR_BTN_ACTION_TIMEOUT,
     /** @brief Error when writing the execution mode file. */
     ERR_MODE_FILE_WRITE,
     /** @brief Error when opening the execution mode file. */
     ERR_MODE_FILE_OPEN,
+    /** @brief Error when the storage bus lock timed out. */
+    ERR_STORAGE_BUS_TIMEOUT,
+    /** @brief Telemetry settings error: invalid configuration. */
+    ERR_TELEMETRY_INVALID_CONFIG,
+    /** @brief Sensor error: the bus transfer failed. */
+    ERR_SENSOR_BUS,
+    /** @brief Sensor error: the device is absent or not supported. */
+    ERR_SENSOR_DEVICE,
+    /** @brief Sensor error: the maximal number of sensors is reached. */
+    ERR_SENSOR_FULL,
+    /** @brief Time series error: the block is full. */
+    ERR_TSDB_BLOCK_FULL,
+    /** @brief Time series error: the block is corrupted. */
+    ERR_TSDB_INVALID_BLOCK,
+    /** @brief Time series error: the maximal number of series is reached. */
+    ERR_TSDB_FULL,
+    /** @brief Time series error: the series files cannot be accessed. */
+    ERR_TSDB_STORAGE,
+    /** @brief Outage buffer error: the record could not be buffered. */
+    ERR_OUTAGE_FULL,
+    /** @brief Task registry error: invalid placement or priority. */
+    ERR_TASK_INVALID_CONFIG,
+    /** @brief Update error: the request does not match the update session. */
+    ERR_OTA_STATE,
+    /** @brief Update error: the image could not be written or validated. */
+    ERR_OTA_FLASH,
+    /** @brief Update error: the image hash does not match. */
+    ERR_OTA_HASH,
+    /** @brief Event bus error: no subscriber slot left. */
+    ERR_EVENT_FULL,
     /** @brief Unknown error. */
     ERR_UNKNOWN
 } E_Return;
@@ -0,0 +1,266 @@
+/*******************************************************************************
+ * @file EventBus.h
+ *
+ * @see EventBus.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Subsystems publish/subscribe event bus.
+ *
+ * @details Subsystems publish/subscribe event bus. The producers only enqueue
+ * typed events in the lock-free queues of the subscribers, the subscribers
+ * receive them in batches on their own task.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_EVENT_BUS_H__
+#define __CORE_EVENT_BUS_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>        /* Atomic types */
+#include <cstdint>       /* Standard integer definitions */
+#include <HAL.h>         /* Hardware abstraction layer */
+#include <Errors.h>      /* Errors definitions */
+#include <BootRecord.h>  /* Execution modes */
+#include <HMReporter.h>  /* Health states */
+#include <SettingsIds.h> /* Settings identifiers */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef EVENT_BUS_MAX_SUBSCRIBERS
+/** @brief Defines the maximal number of subscribers. */
+#define EVENT_BUS_MAX_SUBSCRIBERS 4
+#endif
+
+#ifndef EVENT_BUS_QUEUE_SIZE
+/** @brief Defines the number of events of a subscriber queue (power of 2). */
+#define EVENT_BUS_QUEUE_SIZE 16
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/** @brief Returns the subscription mask of an event identifier. */
+#define EVENT_MASK(ID) (1UL << (uint32_t)(ID))
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the events identifiers. */
+typedef enum {
+    /** @brief The execution mode was set, it applies after the reboot. */
+    EVENT_MODE_CHANGE = 0,
+    /** @brief A Health Monitor reporter changed its status. */
+    EVENT_HM_STATUS = 1,
+    /** @brief A button transition happened. */
+    EVENT_BUTTON = 2,
+    /** @brief A setting change was committed. */
+    EVENT_SETTING_CHANGE = 3,
+    /** @brief Number of events identifiers. */
+    EVENT_ID_MAX = 4
+} E_EventId;
+
+/** @brief Execution mode change event. */
+typedef struct {
+    /** @brief The mode set. */
+    E_Mode mode;
+} S_EventModeChange;
+
+/** @brief Health Monitor reporter status event. */
+typedef struct {
+    /** @brief The reporter, only valid while the reporter is registered. */
+    const HMReporter* kpReporter;
+    /** @brief The previous status of the reporter. */
+    E_HMStatus previous;
+    /** @brief The new status of the reporter. */
+    E_HMStatus status;
+} S_EventHMStatus;
+
+/** @brief Button transition event. */
+typedef struct {
+    /** @brief The button, an E_ButtonID. */
+    uint8_t button;
+    /** @brief The transition, an E_ButtonEdge. */
+    uint8_t edge;
+} S_EventButton;
+
+/** @brief Setting change event. */
+typedef struct {
+    /** @brief The changed setting. */
+    E_SettingId id;
+} S_EventSettingChange;
+
+/** @brief Defines an event. */
+typedef struct {
+    /** @brief The event identifier, selects the payload. */
+    E_EventId id;
+    /** @brief The publication time in nanoseconds. */
+    uint64_t time;
+    /** @brief The event payload. */
+    union {
+        /** @brief EVENT_MODE_CHANGE payload. */
+        S_EventModeChange modeChange;
+        /** @brief EVENT_HM_STATUS payload. */
+        S_EventHMStatus hmStatus;
+        /** @brief EVENT_BUTTON payload. */
+        S_EventButton button;
+        /** @brief EVENT_SETTING_CHANGE payload. */
+        S_EventSettingChange setting;
+    } data;
+} S_Event;
+
+/** @brief Event queue slot, the sequence orders the producers. */
+typedef struct {
+    /** @brief Slot sequence, tells if the slot is free or published. */
+    std::atomic<uint32_t> sequence;
+    /** @brief The queued event. */
+    S_Event event;
+} S_EventSlot;
+
+/** @brief Event bus subscriber. */
+typedef struct {
+    /** @brief The events queue. */
+    S_EventSlot pSlots[EVENT_BUS_QUEUE_SIZE];
+    /** @brief The producers position. */
+    std::atomic<uint32_t> head;
+    /** @brief The subscriber position. */
+    std::atomic<uint32_t> tail;
+    /** @brief Number of events dropped because the queue was full. */
+    std::atomic<uint32_t> dropped;
+    /** @brief The mask of the subscribed events, see EVENT_MASK. */
+    uint32_t mask;
+    /** @brief The task notified on publication, nullptr if none. */
+    T_HALTask task;
+} S_EventSubscriber;
+
+static_assert(32 >= EVENT_ID_MAX, "Event identifiers must fit a mask");
+static_assert(0 == (EVENT_BUS_QUEUE_SIZE & (EVENT_BUS_QUEUE_SIZE - 1)),
+              "The event queue size must be a power of 2");
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The EventBus class.
+ *
+ * @details The EventBus class delivers the events of the producers to the
+ * subscribers. Each subscriber owns a bounded multi-producer queue, a
+ * publication never blocks nor waits for the subscribers: when a queue is
+ * full, the event is dropped for that subscriber and counted. Subscribers
+ * are registered at boot and never removed.
+ */
+class EventBus {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Subscribes to events.
+         *
+         * @details Subscribes to events. The task, if any, is notified when
+         * an event is queued, it then receives the events with Receive.
+         *
+         * @param[in] kMask The events to subscribe to, see EVENT_MASK.
+         * @param[in] task The task to notify, nullptr to poll the queue.
+         * @param[out] rSubId The subscriber identifier buffer.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return Subscribe(const uint32_t kMask,
+                                  T_HALTask      task,
+                                  uint8_t&       rSubId) noexcept;
+
+        /**
+         * @brief Publishes an event.
+         *
+         * @details Publishes an event to the subscribers of its identifier.
+         * The publication time is set by the bus. This function is lock-free
+         * and can be called from any task.
+         *
+         * @param[in] krEvent The event to publish.
+         */
+        static void Publish(const S_Event& krEvent) noexcept;
+
+        /**
+         * @brief Receives the queued events of a subscriber.
+         *
+         * @details Receives the queued events of a subscriber in publication
+         * order. Must only be called by the task of the subscriber.
+         *
+         * @param[in] kSubId The subscriber identifier.
+         * @param[out] pEvents The buffer receiving the events.
+         * @param[in] kMaxCount The maximal number of events to receive.
+         *
+         * @return The number of events received is returned.
+         */
+        static uint32_t Receive(const uint8_t  kSubId,
+                                S_Event*       pEvents,
+                                const uint32_t kMaxCount) noexcept;
+
+        /**
+         * @brief Returns the number of events dropped for a subscriber.
+         *
+         * @param[in] kSubId The subscriber identifier.
+         *
+         * @return The number of events dropped since boot is returned.
+         */
+        static uint32_t GetDroppedCount(const uint8_t kSubId) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Queues an event for a subscriber.
+         *
+         * @param[in, out] rSubscriber The subscriber.
+         * @param[in] krEvent The event to queue.
+         *
+         * @return True is returned when the event is queued, false when the
+         * queue is full.
+         */
+        static bool Enqueue(S_EventSubscriber& rSubscriber,
+                            const S_Event&     krEvent) noexcept;
+
+        /** @brief The subscribers. */
+        static S_EventSubscriber _SPSUBSCRIBERS[EVENT_BUS_MAX_SUBSCRIBERS];
+        /** @brief Number of registered subscribers. */
+        static std::atomic<uint8_t> _SSUBSCRIBERCOUNT;
+        /** @brief The subscriptions lock. */
+        static T_HALSpinLock _SLOCK;
+};
+
+#endif /* #ifndef __CORE_EVENT_BUS_H__ */
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * @file HandlerStats.h
+ *
+ * @see HandlerStats.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Request handlers statistics.
+ *
+ * @details Request handlers statistics. The web and API servers account the
+ * service time of each route and the free heap at the end of each request,
+ * the load benchmarks read them next to the client side measurements.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_HANDLER_STATS_H__
+#define __CORE_HANDLER_STATS_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>   /* Standard integer definitions */
+#include <HAL.h>     /* Hardware abstraction layer */
+#include <Timeout.h> /* Timing histograms */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef HANDLER_STATS_MAX
+/** @brief Defines the maximal number of accounted handlers. */
+#define HANDLER_STATS_MAX 24
+#endif
+
+/** @brief Defines the identifier returned when no handler slot is left. */
+#define HANDLER_STATS_INVALID_ID 0xFFFFFFFF
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Statistics of a request handler. */
+typedef struct {
+    /** @brief The server of the handler. */
+    const char* pkServer;
+    /** @brief The path of the handler. */
+    const char* pkPath;
+    /** @brief The service times of the requests. */
+    S_TimeoutHistogram service;
+    /** @brief The total service time in nanoseconds. */
+    uint64_t totalNs;
+    /** @brief The lowest free heap at the end of a request in bytes. */
+    uint32_t heapLowWater;
+} S_HandlerStats;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The HandlerStats class.
+ *
+ * @details The HandlerStats class accounts the requests of the handlers that
+ * registered at creation. The statistics are accumulated since the boot or
+ * the last reset, the window start allows deriving the served throughput.
+ * The statistics are thread safe.
+ */
+class HandlerStats {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Registers a handler.
+         *
+         * @param[in] kpServer The server of the handler, must be static.
+         * @param[in] kpPath The path of the handler, must be static.
+         *
+         * @return The identifier of the handler is returned,
+         * HANDLER_STATS_INVALID_ID when all the slots are used.
+         */
+        static uint32_t Register(const char* kpServer,
+                                 const char* kpPath) noexcept;
+
+        /**
+         * @brief Accounts a served request.
+         *
+         * @param[in] kId The identifier of the handler, invalid identifiers
+         * are ignored.
+         * @param[in] kServiceNs The service time of the request in
+         * nanoseconds.
+         */
+        static void Record(const uint32_t kId,
+                           const uint64_t kServiceNs) noexcept;
+
+        /**
+         * @brief Gets a consistent copy of the statistics of a handler.
+         *
+         * @param[in] kIndex The index of the handler, up to
+         * HANDLER_STATS_MAX.
+         * @param[out] rStats The statistics buffer.
+         *
+         * @return The function returns true if a handler is registered at the
+         * index, false otherwise.
+         */
+        static bool GetStats(const uint32_t  kIndex,
+                             S_HandlerStats& rStats) noexcept;
+
+        /**
+         * @brief Returns the start of the statistics window.
+         *
+         * @return The time of the boot or of the last reset in nanoseconds is
+         * returned.
+         */
+        static uint64_t GetWindowStart(void) noexcept;
+
+        /**
+         * @brief Clears the statistics and starts a new window.
+         */
+        static void Reset(void) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The handlers statistics. */
+        static S_HandlerStats _SPSTATS[HANDLER_STATS_MAX];
+        /** @brief The number of registered handlers. */
+        static uint32_t _SCOUNT;
+        /** @brief The start of the statistics window in nanoseconds. */
+        static uint64_t _SWINDOWSTART;
+        /** @brief The statistics lock. */
+        static T_HALSpinLock _SLOCK;
+};
+
+#endif /* #ifndef __CORE_HANDLER_STATS_H__ */
@@ -114,9 +114,10 @@ class IOTask {
         /**
          * @brief IO task routine.
          *
-         * @details IO task routine. Executes the periodic IO operations. The
-         * routine is executed by a timer interrupt and should keep its
-         * execution as minimalistic as possible.
+         * @details IO task routine. Executes the IO operations when notified
+         * of an IO event, at the next button or LED deadline and at least
+         * every IO period. The routine should keep its execution as
+         * minimalistic as possible.
          *
          * @param[in] pParam The IOTask instance pointer to use with the
          * routine.
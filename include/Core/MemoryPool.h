@@ -0,0 +1,312 @@
+/*******************************************************************************
+ * @file MemoryPool.h
+ *
+ * @see MemoryPool.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Subsystem memory pools.
+ *
+ * @details Subsystem memory pools. Each subsystem allocates its strings and
+ * containers nodes from its own fixed-block pools instead of the general
+ * heap, the usage of each subsystem is accounted separately.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_MEMORY_POOL_H__
+#define __CORE_MEMORY_POOL_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <new>       /* Standard allocation errors */
+#include <string>    /* Standard strings */
+#include <cstdint>   /* Standard integer definitions */
+#include <cstddef>   /* Standard size type */
+#include <HAL.h>     /* Hardware abstraction layer */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the number of block sizes of a pool. */
+#define MEMPOOL_CLASS_COUNT 3
+
+#ifndef MEMPOOL_PSRAM
+/** @brief Set to 1 to place the pools in PSRAM if present. */
+#define MEMPOOL_PSRAM 1
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the memory pools, one per subsystem. */
+typedef enum {
+    /** @brief Web server pages. */
+    MEM_POOL_WEB = 0,
+    /** @brief API server requests. */
+    MEM_POOL_API = 1,
+    /** @brief Settings containers. */
+    MEM_POOL_SETTINGS = 2,
+    /** @brief Health monitor reporters. */
+    MEM_POOL_HM = 3,
+    /** @brief Number of memory pools. */
+    MEM_POOL_COUNT = 4
+} E_MemPoolId;
+
+/** @brief Memory pool statistics. */
+typedef struct {
+    /** @brief The size of the pool in bytes. */
+    size_t poolSize;
+    /** @brief The size of the used blocks in bytes. */
+    size_t used;
+    /** @brief The highest size of the used blocks in bytes. */
+    size_t highWater;
+    /** @brief The number of blocks. */
+    uint32_t blockCount;
+    /** @brief The number of used blocks. */
+    uint32_t usedBlocks;
+    /** @brief The size currently allocated from the heap in bytes. */
+    size_t heapUsed;
+    /** @brief The number of allocations served by the heap. */
+    uint32_t fallbacks;
+} S_MemPoolStats;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The MemoryPool class.
+ *
+ * @details The MemoryPool class manages the subsystem pools. A pool is made
+ * of MEMPOOL_CLASS_COUNT block sizes, carved once at initialization. An
+ * allocation takes a block of the smallest size that fits and has a free
+ * block. The allocations that are larger than the largest block, that find
+ * the pool exhausted or that happen before the initialization are served by
+ * the heap and accounted to the pool. The pools are thread safe.
+ */
+class MemoryPool {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Carves the pools.
+         *
+         * @details Carves the pools. Must be called once at boot, before
+         * the subsystems start. Subsequent calls have no effect.
+         */
+        static void Init(void) noexcept;
+
+        /**
+         * @brief Allocates memory from a pool.
+         *
+         * @param[in] kPool The pool to allocate from.
+         * @param[in] kSize The size to allocate in bytes.
+         *
+         * @return The allocated memory is returned. std::bad_alloc is
+         * thrown when neither the pool nor the heap can serve it.
+         */
+        static void* Allocate(const E_MemPoolId kPool, const size_t kSize);
+
+        /**
+         * @brief Releases memory to a pool.
+         *
+         * @param[in] kPool The pool the memory was allocated from.
+         * @param[in] pMemory The memory to release.
+         * @param[in] kSize The size that was allocated in bytes.
+         */
+        static void Release(const E_MemPoolId kPool,
+                            void*             pMemory,
+                            const size_t      kSize) noexcept;
+
+        /**
+         * @brief Returns the statistics of a pool.
+         *
+         * @param[in] kPool The pool to get.
+         * @param[out] rStats The buffer receiving the statistics.
+         */
+        static void GetStats(const E_MemPoolId kPool,
+                             S_MemPoolStats&   rStats) noexcept;
+
+        /**
+         * @brief Returns the name of a pool.
+         *
+         * @param[in] kPool The pool to get.
+         *
+         * @return The name of the pool is returned.
+         */
+        static const char* GetName(const E_MemPoolId kPool) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief Free block of a pool, linked in the free list. */
+        typedef struct S_FreeBlock {
+            /** @brief The next free block. */
+            struct S_FreeBlock* pNext;
+        } S_FreeBlock;
+
+        /** @brief Memory pool state. */
+        typedef struct {
+            /** @brief The first block of each size. */
+            uint8_t* pStart[MEMPOOL_CLASS_COUNT];
+            /** @brief The free blocks of each size. */
+            S_FreeBlock* pFree[MEMPOOL_CLASS_COUNT];
+            /** @brief The pool statistics. */
+            S_MemPoolStats stats;
+        } S_Pool;
+
+        /** @brief The pools. */
+        static S_Pool _SPPOOLS[MEM_POOL_COUNT];
+        /** @brief The pools locks, usable before the initialization. */
+        static T_HALSpinLock _SPLOCKS[MEM_POOL_COUNT];
+        /** @brief Tells if the pools are carved. */
+        static bool _SISINIT;
+};
+
+/**
+ * @brief The PoolAllocator class.
+ *
+ * @details The PoolAllocator class is a standard allocator that serves the
+ * strings and containers of a subsystem from its memory pool.
+ *
+ * @tparam T The allocated type.
+ * @tparam POOL The memory pool of the subsystem.
+ */
+template <typename T, E_MemPoolId POOL>
+class PoolAllocator {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /** @brief The allocated type. */
+        typedef T value_type;
+
+        /**
+         * @brief Gives the allocator of another type in the same pool.
+         *
+         * @tparam U The other allocated type.
+         */
+        template <typename U>
+        struct rebind {
+            /** @brief The allocator of the other type. */
+            typedef PoolAllocator<U, POOL> other;
+        };
+
+        /**
+         * @brief PoolAllocator constructor.
+         */
+        PoolAllocator(void) noexcept {
+        }
+
+        /**
+         * @brief PoolAllocator conversion constructor.
+         *
+         * @param[in] krOther The allocator of another type.
+         */
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U, POOL>& krOther) noexcept {
+            (void)krOther;
+        }
+
+        /**
+         * @brief Allocates objects.
+         *
+         * @param[in] kCount The number of objects to allocate.
+         *
+         * @return The allocated objects are returned.
+         */
+        T* allocate(const size_t kCount) {
+            return (T*)MemoryPool::Allocate(POOL, kCount * sizeof(T));
+        }
+
+        /**
+         * @brief Releases objects.
+         *
+         * @param[in] pObjects The objects to release.
+         * @param[in] kCount The number of allocated objects.
+         */
+        void deallocate(T* pObjects, const size_t kCount) noexcept {
+            MemoryPool::Release(POOL, pObjects, kCount * sizeof(T));
+        }
+};
+
+/**
+ * @brief Tells if two allocators share their memory.
+ *
+ * @return true, the allocators of a pool are interchangeable.
+ */
+template <typename T, typename U, E_MemPoolId POOL>
+inline bool operator==(const PoolAllocator<T, POOL>&,
+                       const PoolAllocator<U, POOL>&) noexcept {
+    return true;
+}
+
+/**
+ * @brief Tells if two allocators do not share their memory.
+ *
+ * @return false, the allocators of a pool are interchangeable.
+ */
+template <typename T, typename U, E_MemPoolId POOL>
+inline bool operator!=(const PoolAllocator<T, POOL>&,
+                       const PoolAllocator<U, POOL>&) noexcept {
+    return false;
+}
+
+/** @brief String allocated from the web server pool. */
+typedef std::basic_string<
+    char,
+    std::char_traits<char>,
+    PoolAllocator<char, MEM_POOL_WEB>
+> WebString;
+
+/** @brief String allocated from the API server pool. */
+typedef std::basic_string<
+    char,
+    std::char_traits<char>,
+    PoolAllocator<char, MEM_POOL_API>
+> APIString;
+
+/** @brief String allocated from the health monitor pool. */
+typedef std::basic_string<
+    char,
+    std::char_traits<char>,
+    PoolAllocator<char, MEM_POOL_HM>
+> HMString;
+
+#endif /* #ifndef __CORE_MEMORY_POOL_H__ */
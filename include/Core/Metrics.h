@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * @file Metrics.h
+ *
+ * @see Metrics.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware always-on metrics counters.
+ *
+ * @details Firmware always-on metrics counters. The subsystems increment
+ * lock-free counters on their hot paths, the counters are only read and
+ * formatted when the metrics are scraped.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_METRICS_H__
+#define __CORE_METRICS_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>         /* Atomic types */
+#include <cstdint>        /* Standard integer definitions */
+#include <cstddef>        /* Standard size type */
+#include <HandlerStats.h> /* Request handlers identifiers */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the metrics counters. */
+typedef enum {
+    /** @brief Watchdog deadlines missed. */
+    METRIC_WATCHDOG_MISSES = 0,
+    /** @brief Critical log lines, the next counters follow the log levels. */
+    METRIC_LOG_CRITICAL = 1,
+    /** @brief Error log lines. */
+    METRIC_LOG_ERROR = 2,
+    /** @brief Info log lines. */
+    METRIC_LOG_INFO = 3,
+    /** @brief Debug log lines. */
+    METRIC_LOG_DEBUG = 4,
+    /** @brief Bytes written to the SD card by the logger. */
+    METRIC_SD_LOGGER_BYTES = 5,
+    /** @brief Bytes written to the SD card by the settings. */
+    METRIC_SD_SETTINGS_BYTES = 6,
+    /** @brief Number of metrics counters. */
+    METRIC_COUNTER_MAX = 7
+} E_MetricCounter;
+
+/** @brief Counters of a request handler. */
+typedef struct {
+    /** @brief Number of requests served. */
+    uint32_t requests;
+    /** @brief Number of response body bytes sent. */
+    uint32_t bytes;
+} S_MetricRoute;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The Metrics class.
+ *
+ * @details The Metrics class holds the always-on counters of the firmware.
+ * The counters are 32 bits lock-free atomics, they are never reset and wrap
+ * around, which the monitoring stack handles as a counter reset. The requests
+ * counters are indexed by the handlers statistics identifiers.
+ */
+class Metrics {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Adds to a counter.
+         *
+         * @details Adds to a counter. This function is lock-free and can be
+         * called from any task.
+         *
+         * @param[in] kCounter The counter to increment.
+         * @param[in] kValue The value to add.
+         */
+        static void Add(const E_MetricCounter kCounter,
+                        const uint32_t        kValue) noexcept;
+
+        /**
+         * @brief Returns the value of a counter.
+         *
+         * @param[in] kCounter The counter to read.
+         *
+         * @return The value of the counter is returned.
+         */
+        static uint32_t Get(const E_MetricCounter kCounter) noexcept;
+
+        /**
+         * @brief Accounts a served request.
+         *
+         * @details Accounts a served request. This function is lock-free and
+         * can be called from any task.
+         *
+         * @param[in] kId The identifier of the handler in the handlers
+         * statistics, invalid identifiers are ignored.
+         * @param[in] kBytes The size of the response body in bytes.
+         */
+        static void RecordRequest(const uint32_t kId,
+                                  const size_t   kBytes) noexcept;
+
+        /**
+         * @brief Returns the counters of a request handler.
+         *
+         * @param[in] kId The identifier of the handler in the handlers
+         * statistics.
+         * @param[out] rRoute The counters buffer.
+         *
+         * @return The function returns true if the identifier is valid, false
+         * otherwise.
+         */
+        static bool GetRequests(const uint32_t kId,
+                                S_MetricRoute& rRoute) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The counters. */
+        static std::atomic<uint32_t> _SPCOUNTERS[METRIC_COUNTER_MAX];
+        /** @brief The requests served per handler. */
+        static std::atomic<uint32_t> _SPREQUESTS[HANDLER_STATS_MAX];
+        /** @brief The response bytes sent per handler. */
+        static std::atomic<uint32_t> _SPBYTES[HANDLER_STATS_MAX];
+};
+
+#endif /* #ifndef __CORE_METRICS_H__ */
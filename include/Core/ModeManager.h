@@ -24,8 +24,13 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <Errors.h>    /* Errors definitions */
-#include <WebServer.h> /* Web server services */
+#include <Errors.h>     /* Errors definitions */
+#include <WebServer.h>  /* Web server services */
+#include <BootRecord.h> /* Boot mode and reset record */
+
+/* Forward declarations */
+class MaintenanceWebServerHandlers;
+
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
@@ -41,16 +46,7 @@
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-
-/** @brief Defines the allowed execution modes for the firmware. */
-typedef enum {
-    /** @brief Nominal execution mode. */
-    MODE_NOMINAL,
-    /** @brief Maintenance execution mode. */
-    MODE_MAINTENANCE,
-    /** @brief Faulted execution mode. */
-    MODE_FAULTED
-} E_Mode;
+/* None */
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -155,7 +151,8 @@ class ModeManager {
          * @brief Starts the firmware in nominal execution mode.
          *
          * @details Starts the firmware in nominal execution mode. This is the
-         * regular execution mode.
+         * regular execution mode. The boot stages are executed by a boot
+         * sequencer, following their dependencies.
          */
         void StartNominal(void) const noexcept;
 
@@ -191,6 +188,9 @@ class ModeManager {
         /** @brief Stores the maintenance web server. */
         WebServer* _pMaintServer;
 
+        /** @brief Stores the maintenance web server handlers. */
+        MaintenanceWebServerHandlers* _pMaintHandlers;
+
         /** @brief Force maintenance mode. */
         bool _forceMaintenance;
 };
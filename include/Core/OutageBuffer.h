@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * @file OutageBuffer.h
+ *
+ * @see OutageBuffer.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Store-and-forward buffer.
+ *
+ * @details Store-and-forward buffer. The records that cannot be sent while
+ * the uplink is down are kept in a bounded memory queue, then in an overflow
+ * file on the SD card, until they are drained in order.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_OUTAGE_BUFFER_H__
+#define __CORE_OUTAGE_BUFFER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <cstddef>  /* Standard size type */
+#include <Errors.h> /* Errors definitions */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef OUTAGE_FILE_MAX_RECORDS
+/** @brief Defines the maximal number of records of the overflow file. */
+#define OUTAGE_FILE_MAX_RECORDS 65536
+#endif
+
+#ifndef OUTAGE_REFILL_RECORDS
+/** @brief Defines the maximal number of records read per file access. */
+#define OUTAGE_REFILL_RECORDS 64
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Outage buffer statistics. */
+typedef struct {
+    /** @brief The number of records in the memory queue. */
+    uint32_t queued;
+    /** @brief The number of records in the overflow file. */
+    uint32_t spilled;
+    /** @brief The number of records dropped since the last reset. */
+    uint32_t dropped;
+} S_OutageStats;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The OutageBuffer class.
+ *
+ * @details The OutageBuffer class is a first in first out queue of fixed
+ * size records. The records fill a queue allocated in external memory, then
+ * are appended to the overflow file. While the file holds records, the new
+ * records are appended to it to keep the order, and the queue is refilled
+ * from the file as it is drained. When the file is full or the card is
+ * absent, the records are dropped and counted. The buffer is not thread
+ * safe, it belongs to the task of its producer.
+ */
+class OutageBuffer {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief OutageBuffer constructor.
+         *
+         * @param[in] kRecordSize The size of a record in bytes.
+         * @param[in] kQueueRecords The capacity of the memory queue.
+         * @param[in] kpPath The path of the overflow file.
+         */
+        OutageBuffer(const size_t   kRecordSize,
+                     const uint32_t kQueueRecords,
+                     const char*    kpPath) noexcept;
+
+        /**
+         * @brief Destroys an OutageBuffer.
+         *
+         * @details Destroys an OutageBuffer. The buffers live as long as
+         * their owner, the destructor will generate a critical error.
+         */
+        ~OutageBuffer(void) noexcept;
+
+        /**
+         * @brief Empties the buffer.
+         *
+         * @details Empties the buffer. The records and the overflow file
+         * left by a previous boot are removed.
+         */
+        void Reset(void) noexcept;
+
+        /**
+         * @brief Appends a record.
+         *
+         * @param[in] kpRecord The record to append.
+         *
+         * @return The function returns the success or error status. When
+         * the record cannot be buffered, ERR_OUTAGE_FULL is returned.
+         */
+        E_Return Push(const void* kpRecord) noexcept;
+
+        /**
+         * @brief Copies the oldest records.
+         *
+         * @details Copies the oldest records. The records stay buffered
+         * until they are released.
+         *
+         * @param[out] pRecords The buffer receiving the records.
+         * @param[in] kMaxCount The maximal number of records to copy.
+         *
+         * @return The number of copied records is returned.
+         */
+        uint32_t Peek(void* pRecords, const uint32_t kMaxCount) noexcept;
+
+        /**
+         * @brief Releases the oldest records.
+         *
+         * @param[in] kCount The number of records to release, at most the
+         * number of records returned by the last peek.
+         */
+        void Release(const uint32_t kCount) noexcept;
+
+        /**
+         * @brief Returns the number of buffered records.
+         *
+         * @return The number of records in the queue and the file is
+         * returned.
+         */
+        uint32_t GetCount(void) const noexcept;
+
+        /**
+         * @brief Returns the buffer statistics.
+         *
+         * @param[out] rStats The buffer receiving the statistics.
+         */
+        void GetStats(S_OutageStats& rStats) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Appends a record to the overflow file.
+         *
+         * @param[in] kpRecord The record to append.
+         *
+         * @return true if the record was written, false otherwise.
+         */
+        bool Spill(const void* kpRecord) noexcept;
+
+        /**
+         * @brief Moves the oldest records of the file to the queue.
+         */
+        void Refill(void) noexcept;
+
+        /** @brief The size of a record in bytes. */
+        size_t _recordSize;
+        /** @brief The capacity of the memory queue in records. */
+        uint32_t _capacity;
+        /** @brief The memory queue. */
+        uint8_t* _pQueue;
+        /** @brief The index of the oldest queued record. */
+        uint32_t _head;
+        /** @brief The number of queued records. */
+        uint32_t _count;
+
+        /** @brief The path of the overflow file. */
+        const char* _kpPath;
+        /** @brief The index of the oldest record of the file. */
+        uint32_t _fileHead;
+        /** @brief The number of records left in the file. */
+        uint32_t _fileCount;
+        /** @brief The number of records dropped since the last reset. */
+        uint32_t _dropped;
+};
+
+#endif /* #ifndef __CORE_OUTAGE_BUFFER_H__ */
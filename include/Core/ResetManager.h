@@ -109,22 +109,22 @@ class ResetManager : public IOButtonManagerAction {
         virtual ~ResetManager(void) noexcept;
 
         /**
-         * @brief The execute function that checks the buttons states to define
-         * the reset action.
+         * @brief The event function that follows the reset button
+         * transitions to define the reset action.
          *
-         * @details The execute function that checks the buttons states to
-         * define the reset action. Based on the buttons states and the timings,
-         * the function will perform reset actions.
+         * @details The event function that follows the reset button
+         * transitions to define the reset action. The reset hold and
+         * confirmation delays use the subscription timer.
          *
-         * @param[in] kpBtnLastPress The time at which the buttons were last
-         * detected as pressed.
-         * @param[in] kpBtnStates The button states detected during the last
-         * update.
+         * @param[in] kSubId The subscription identifier.
+         * @param[in] kBtnId The button of the transition.
+         * @param[in] kEdge The transition.
+         * @param[in] kTime The time of the transition in nanoseconds.
          */
-        virtual void Execute(
-            const uint64_t kpBtnLastPress[E_ButtonID::BUTTON_MAX_ID],
-            const E_ButtonState kpBtnStates[E_ButtonID::BUTTON_MAX_ID])
-            noexcept;
+        virtual void OnEvent(const uint32_t     kSubId,
+                             const E_ButtonID   kBtnId,
+                             const E_ButtonEdge kEdge,
+                             const uint64_t     kTime) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -142,8 +142,6 @@ class ResetManager : public IOButtonManagerAction {
 
         /** @brief Current reset state */
         E_ResetState _state;
-        /** @brief Time at the entry of the reset state. */
-        uint64_t _resetStartTime;
 };
 
 #endif /* #ifndef __CORE_RESET_MANAGER_H__ */
\ No newline at end of file
@@ -27,34 +27,32 @@
 #include <string>        /* Standard strings */
 #include <Errors.h>      /* Errors definitions */
 #include <Storage.h>     /* Preference storage */
-#include <Arduino.h>     /* Arduino framework */
+#include <SettingsIds.h> /* Generated setting identifiers */
+#include <HAL.h>         /* Hardware abstraction layer */
 #include <unordered_map> /* Settings map */
+#include <atomic>        /* Atomic sequence counter */
+#include <unordered_set> /* Modified settings set */
+#include <MemoryPool.h>  /* Settings memory pool */
 
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/** @brief Defines the isAP setting key. */
-#define SETTING_IS_AP "is_ap"
-/** @brief Defines the node ssid setting key. */
-#define SETTING_NODE_SSID "node_ssid"
-/** @brief Defines the node password setting key. */
-#define SETTING_NODE_PASS "node_pass"
-/** @brief Defines the web interface port setting key. */
-#define SETTING_WEB_PORT "web_port"
-/** @brief Defines the api interface port setting key. */
-#define SETTING_API_PORT "api_port"
-/** @brief Defines the static mode configuration. */
-#define SETTING_NODE_STATIC "node_static"
-/** @brief Defines the static IP configuration. */
-#define SETTING_NODE_ST_IP "node_st_ip"
-/** @brief Defines the static gateway configuration. */
-#define SETTING_NODE_ST_GATE "node_st_gate"
-/** @brief Defines the static subnet configuration. */
-#define SETTING_NODE_ST_SUBNET "node_st_subnet"
-/** @brief Defines the static primary DNS configuration. */
-#define SETTING_NODE_ST_PDNS "node_st_pdns"
-/** @brief Defines the static secondary DNS configuration. */
-#define SETTING_NODE_ST_SDNS "node_st_sdns"
+/* Setting keys and identifiers are generated in SettingsIds.h */
+
+#ifndef SETTINGS_ARENA_SIZE
+/** @brief Defines the size of the settings values arena in bytes. */
+#define SETTINGS_ARENA_SIZE 16384
+#endif
+
+#ifndef SETTINGS_MAX_SUBSCRIBERS
+/** @brief Defines the maximal number of settings subscribers. */
+#define SETTINGS_MAX_SUBSCRIBERS 8
+#endif
+
+#ifndef SETTINGS_ARENA_PSRAM
+/** @brief Set to 1 to place the settings values arena in PSRAM if present. */
+#define SETTINGS_ARENA_PSRAM 1
+#endif
 
 /*******************************************************************************
  * MACROS
@@ -74,6 +72,71 @@ typedef struct {
     size_t fieldSize;
 } S_SettingField;
 
+/** @brief Settings cache, allocated from the settings pool. */
+typedef std::unordered_map<
+    std::string,
+    S_SettingField,
+    std::hash<std::string>,
+    std::equal_to<std::string>,
+    PoolAllocator<
+        std::pair<const std::string, S_SettingField>,
+        MEM_POOL_SETTINGS
+    >
+> T_SettingsCache;
+
+/** @brief Settings names set, allocated from the settings pool. */
+typedef std::unordered_set<
+    std::string,
+    std::hash<std::string>,
+    std::equal_to<std::string>,
+    PoolAllocator<std::string, MEM_POOL_SETTINGS>
+> T_SettingsNames;
+
+/**
+ * @brief Settings change callback. The callback is called from the task that
+ * committed the change, after the commit completed.
+ *
+ * @param[in] kId The identifier of the changed setting.
+ * @param[in] pArgs The arguments provided on subscription.
+ */
+typedef void (*T_SettingsCallback)(const E_SettingId kId, void* pArgs);
+
+/** @brief Describes a settings change subscriber. */
+typedef struct {
+    /** @brief The subscriber callback. */
+    T_SettingsCallback callback;
+    /** @brief The subscriber callback arguments. */
+    void* pArgs;
+    /** @brief The mask of the subscribed setting identifiers. */
+    uint32_t ids;
+} S_SettingsSubscriber;
+
+static_assert(32 >= SETTING_ID_MAX, "Setting identifiers must fit a mask");
+
+/** @brief Settings memory usage report. */
+typedef struct {
+    /** @brief The size of the values arena. */
+    size_t arenaSize;
+    /** @brief The used size of the values arena. */
+    size_t arenaUsed;
+    /** @brief The peak used size of the values arena. */
+    size_t arenaPeak;
+    /** @brief The size of the values referenced by the cache. */
+    size_t liveSize;
+    /** @brief The number of settings in the cache. */
+    size_t settingsCount;
+    /** @brief The number of compactions of the values arena. */
+    uint32_t arenaCompactions;
+    /** @brief Tells if the values arena is in external memory. */
+    bool isArenaExternal;
+    /** @brief The free internal heap size. */
+    size_t heapFree;
+    /** @brief The largest free internal heap block. */
+    size_t heapLargestBlock;
+    /** @brief The minimal free internal heap size since boot. */
+    size_t heapMinFree;
+} S_SettingsMemoryStats;
+
 /*******************************************************************************
  * GLOBAL VARIABLES
  ******************************************************************************/
@@ -134,6 +197,7 @@ class Settings
          * @brief Reads the setting value based on the settings name.
          *
          * @details Reads the setting value based on the settings name.
+         * The identified settings that were never set read their default.
          * If the settings does not exist, an error is returned.
          *
          * @param[in] krName The name of the setting to read.
@@ -178,13 +242,97 @@ class Settings
                              const uint8_t*     kpData,
                              const size_t       kDataLength) noexcept;
 
+        /**
+         * @brief Reads the setting value based on the setting identifier.
+         *
+         * @details Reads the setting value based on the setting identifier.
+         * The value is served from the settings values array, the named
+         * settings are only looked up on the first access, the settings that
+         * were never set read their default. Loaded values are read without
+         * the settings lock, the read never waits for a commit.
+         *
+         * @param[in] kId The identifier of the setting to read.
+         * @param[out] pData The buffer of the value to return.
+         * @param[in] kDataLength The exact length of the data to load.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return GetSetting(const E_SettingId kId,
+                            uint8_t*          pData,
+                            const size_t      kDataLength) noexcept;
+
+        /**
+         * @brief Reads the default setting value based on the setting
+         * identifier.
+         *
+         * @details Reads the default setting value based on the setting
+         * identifier.
+         *
+         * @param[in] kId The identifier of the setting to read.
+         * @param[out] pData The buffer of the value to return.
+         * @param[in] kDataLength The exact length of the data to load.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return GetDefault(const E_SettingId kId,
+                            uint8_t*          pData,
+                            const size_t      kDataLength) noexcept;
+
+        /**
+         * @brief Writes the setting value based on the setting identifier.
+         *
+         * @details Writes the setting value based on the setting identifier.
+         *
+         * @param[in] kId The identifier of the setting to write.
+         * @param[in] kpData The buffer of the value to write.
+         * @param[in] kDataLength The exact length of the data to write.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return SetSetting(const E_SettingId kId,
+                            const uint8_t*    kpData,
+                            const size_t      kDataLength) noexcept;
+
+        /**
+         * @brief Subscribes to the changes of a setting.
+         *
+         * @details Subscribes to the changes of a setting. The callback is
+         * called once for each changed setting after a successful commit. A
+         * setting set to its current value is not a change.
+         *
+         * @param[in] kId The identifier of the setting to subscribe to.
+         * @param[in] kCallback The callback to call on change.
+         * @param[in] pArgs The arguments provided to the callback.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Subscribe(const E_SettingId        kId,
+                           const T_SettingsCallback kCallback,
+                           void*                    pArgs) noexcept;
+
+        /**
+         * @brief Unsubscribes from the changes of a setting.
+         *
+         * @details Unsubscribes from the changes of a setting.
+         *
+         * @param[in] kId The identifier of the setting to unsubscribe from.
+         * @param[in] kCallback The callback provided on subscription.
+         * @param[in] pArgs The arguments provided on subscription.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Unsubscribe(const E_SettingId        kId,
+                             const T_SettingsCallback kCallback,
+                             void*                    pArgs) noexcept;
+
         /**
          * @brief Commits the changes made to the configuration to the
          * non-volatile memory.
          *
          * @details Commits the changes made to the configuration to the
-         * non-volatile memory. Try grouping changes to ease the memory wear
-         * when commiting changes.
+         * non-volatile memory. Only the modified settings are appended to the
+         * settings journal. When the journal is full, the settings are
+         * compacted in the alternate file, which then becomes the active one.
          *
          * @return The function returns the success or error status.
          */
@@ -194,12 +342,24 @@ class Settings
          * @brief Clears the settings cache.
          *
          * @brief Clears the settings cache. All settings will be reloaded from
-         * non-volatile memory.
+         * non-volatile memory. The values arena is released at once.
          *
          * @return The function returns the success or error status.
          */
         E_Return ClearCache(void) noexcept;
 
+        /**
+         * @brief Gets the settings memory usage.
+         *
+         * @details Gets the settings memory usage. The report contains the
+         * values arena usage and the internal heap state.
+         *
+         * @param[out] pStats The buffer that receives the memory usage.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return GetMemoryStats(S_SettingsMemoryStats* pStats) noexcept;
+
 
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
@@ -219,38 +379,299 @@ class Settings
         E_Return LoadFromStorage(void) noexcept;
 
         /**
-         * @brief Initializes the default values for the settings.
+         * @brief Loads an identified setting value.
+         *
+         * @details Loads an identified setting value from the named settings
+         * to the settings values array. The settings lock must be held by the
+         * caller.
+         *
+         * @param[in] kId The identifier of the setting to load.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return LoadValue(const E_SettingId kId) noexcept;
+
+        /**
+         * @brief Gets the default value of a setting.
+         *
+         * @details Gets the default value of a setting. The defaults are
+         * generated in a constant table kept in flash, they are never copied
+         * in memory.
+         *
+         * @param[in] kId The setting identifier.
          *
-         * @details Initializes the default values for the settings. Those are
-         * not stored in non-volatile memory and generated at each boot.
+         * @return The default value, SettingSize(kId) bytes, is returned.
          */
-        void InitializeDefault(void) noexcept;
+        static const uint8_t* GetDefaultValue(const E_SettingId kId) noexcept;
 
         /**
-         * @brief Gets the next setting name string from the file.
+         * @brief Reads the start of a settings file.
          *
-         * @details Gets the next setting name string from the file. This will
-         * read the file until a null terminator is encountered and return the
-         * read data.
+         * @details Reads the start of a settings file in a single read. A
+         * missing file or a file smaller than the requested size is not an
+         * error and nothing is read. The storage bus must be held by the
+         * caller.
          *
-         * @param[in] rFile The file to read from.
+         * @param[in] kpPath The settings file path.
+         * @param[out] pBuffer The buffer that receives the file content.
+         * @param[in] kSize The size to read.
+         * @param[out] pFileSize The buffer that receives the file size, can be
+         * nullptr.
          *
-         * @return The name of the next setting is returned. An empty string is
-         * returned on error.
+         * @return The function returns the success or error status.
          */
-        std::string GetSettingName(FsFile& rFile) const noexcept;
+        E_Return ReadImage(const char*  kpPath,
+                           uint8_t*     pBuffer,
+                           const size_t kSize,
+                           size_t*      pFileSize) noexcept;
+
+        /**
+         * @brief Compacts the settings cache to non-volatile memory.
+         *
+         * @details Compacts the settings cache to non-volatile memory. The
+         * settings image is built in memory and written at once in the
+         * inactive file with the next generation. The active file stays valid
+         * until the write completes. The settings lock must be held by the
+         * caller.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return WriteToStorage(void) noexcept;
+
+        /**
+         * @brief Appends the modified settings to the settings journal.
+         *
+         * @details Appends the modified settings to the settings journal of
+         * the active file. The records are built in memory and written at
+         * once. The settings lock must be held by the caller.
+         *
+         * @param[in] kSize The size of the records to append.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return AppendJournal(const size_t kSize) noexcept;
+
+        /**
+         * @brief Gets the size of the compacted part of a settings image.
+         *
+         * @details Gets the size of the compacted part of a settings image.
+         * The header, the checksum and the entries bounds are checked.
+         *
+         * @param[in] kpImage The settings image.
+         * @param[in] kSize The size of the settings image.
+         * @param[out] pGeneration The buffer that receives the image
+         * generation.
+         *
+         * @return The size of the header and entries is returned, 0 if the
+         * image is invalid.
+         */
+        size_t GetImageBaseSize(const uint8_t* kpImage,
+                                const size_t   kSize,
+                                uint32_t*      pGeneration) const noexcept;
+
+        /**
+         * @brief Indexes a settings image in the cache.
+         *
+         * @details Indexes a settings image in the cache. The cache values
+         * point in the image, the settings takes the image ownership. The
+         * journal records are replayed after the entries, up to the first
+         * torn record.
+         *
+         * @param[in] pImage The valid settings image.
+         * @param[in] kBaseSize The size of the image header and entries.
+         * @param[in] kSize The size of the settings image.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return IndexImage(uint8_t*     pImage,
+                            const size_t kBaseSize,
+                            const size_t kSize) noexcept;
+
+        /**
+         * @brief Loads a legacy settings image in the cache.
+         *
+         * @details Loads a legacy settings image in the cache. The legacy
+         * image is a stream of null-terminated name, size and value. The
+         * values are copied in the cache.
+         *
+         * @param[in] kpImage The legacy settings image.
+         * @param[in] kSize The size of the legacy settings image.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return LoadLegacyImage(const uint8_t* kpImage, const size_t kSize)
+        noexcept;
+
+        /**
+         * @brief Adds a value loaded from storage to the cache.
+         *
+         * @details Adds a value loaded from storage to the cache. Modified
+         * settings that are not committed yet are not replaced.
+         *
+         * @param[in] krName The setting name.
+         * @param[in] krSetting The loaded setting.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return CacheLoadedValue(const std::string&    krName,
+                              const S_SettingField& krSetting) noexcept;
+
+        /**
+         * @brief Reads an identified setting value without the lock.
+         *
+         * @details Reads an identified setting value without the lock. The
+         * values array is protected by a sequence lock, the read is retried
+         * when it overlaps an update.
+         *
+         * @param[in] kId The identifier of the setting to read.
+         * @param[out] pData The buffer of the value to return.
+         * @param[in] kDataLength The exact length of the data to load.
+         *
+         * @return True is returned if a consistent loaded value was read, the
+         * locked read must be used otherwise.
+         */
+        bool ReadValueSnapshot(const E_SettingId kId,
+                               uint8_t*          pData,
+                               const size_t      kDataLength) const noexcept;
+
+        /**
+         * @brief Updates an identified setting value.
+         *
+         * @details Updates an identified setting value in the values array.
+         * The settings lock must be held by the caller.
+         *
+         * @param[in] kId The setting identifier.
+         * @param[in] kpData The setting value.
+         * @param[in] kDataLength The setting value size.
+         */
+        void UpdateValue(const E_SettingId kId,
+                         const uint8_t*    kpData,
+                         const size_t      kDataLength) noexcept;
+
+        /**
+         * @brief Notifies the settings changes to the subscribers.
+         *
+         * @details Notifies the settings changes to the subscribers. The
+         * settings lock must not be held by the caller.
+         *
+         * @param[in] kChangedIds The mask of the changed setting identifiers.
+         * @param[in] kpSubscribers The subscribers to notify.
+         */
+        void NotifySubscribers(const uint32_t              kChangedIds,
+                               const S_SettingsSubscriber* kpSubscribers)
+        noexcept;
+
+        /**
+         * @brief Starts an update of the values array.
+         *
+         * @details Starts an update of the values array, the snapshot reads
+         * are retried until the update ends. The settings lock must be held by
+         * the caller.
+         */
+        void BeginValuesUpdate(void) noexcept;
+
+        /**
+         * @brief Ends an update of the values array.
+         *
+         * @details Ends an update of the values array and publishes it to the
+         * snapshot reads.
+         */
+        void EndValuesUpdate(void) noexcept;
+
+        /**
+         * @brief Allocates a buffer in the settings arena.
+         *
+         * @details Allocates a buffer in the settings arena. The arena is
+         * compacted when it is full. The settings lock must be held by the
+         * caller.
+         *
+         * @param[in] kSize The size of the buffer to allocate.
+         *
+         * @return The allocated buffer is returned, nullptr if the arena is
+         * exhausted.
+         */
+        uint8_t* ArenaAllocate(const size_t kSize) noexcept;
+
+        /**
+         * @brief Releases a buffer of the settings arena.
+         *
+         * @details Releases a buffer of the settings arena. Only the last
+         * allocated buffer is released, the other ones are reclaimed on
+         * compaction.
+         *
+         * @param[in] kpBuffer The buffer to release.
+         * @param[in] kSize The size of the buffer to release.
+         */
+        void ArenaRelease(const uint8_t* kpBuffer, const size_t kSize)
+        noexcept;
+
+        /**
+         * @brief Compacts the settings arena.
+         *
+         * @details Compacts the settings arena. The values referenced by the
+         * cache are moved to the start of the arena, the rest is released.
+         */
+        void CompactArena(void) noexcept;
 
         /** @brief Stores the settings mutex. */
-        SemaphoreHandle_t _lock;
+        T_HALMutex _lock;
 
         /** @brief Stores the preference instance. */
         Storage* _pStorage;
 
-        /** @brief Stores the settings cache. */
-        std::unordered_map<std::string, S_SettingField> _cache;
+        /** @brief Stores the identified settings values. */
+        uint8_t _values[SETTINGS_VALUES_SIZE];
+
+        /** @brief Tells which identified settings values are loaded. */
+        bool _isValueLoaded[SETTING_ID_MAX];
+
+        /** @brief Stores the changed identified settings not notified yet. */
+        uint32_t _changedIds;
+
+        /** @brief Stores the settings change subscribers. */
+        S_SettingsSubscriber _subscribers[SETTINGS_MAX_SUBSCRIBERS];
+
+        /** @brief Sequence lock of the identified settings values. */
+        std::atomic<uint32_t> _valuesSequence;
+
+        /** @brief Stores the settings values arena. */
+        uint8_t* _pArena;
+
+        /** @brief Stores the used size of the settings values arena. */
+        size_t _arenaUsed;
+
+        /** @brief Stores the peak used size of the settings values arena. */
+        size_t _arenaPeak;
 
-        /** @brief Stores the default settings. */
-        std::unordered_map<std::string, const S_SettingField> _defaults;
+        /** @brief Stores the number of compactions of the arena. */
+        uint32_t _arenaCompactions;
+
+        /** @brief Tells if the arena is in external memory. */
+        bool _isArenaExternal;
+
+        /** @brief Tells if the active settings file is known. */
+        bool _isStorageLoaded;
+
+        /** @brief Stores the active settings file index. */
+        uint8_t _activeFile;
+
+        /** @brief Stores the active settings file generation. */
+        uint32_t _generation;
+
+        /** @brief Stores the valid size of the active settings file. */
+        size_t _activeSize;
+
+        /** @brief Stores the journal size of the active settings file. */
+        size_t _journalSize;
+
+        /** @brief Stores the modified settings not committed yet. */
+        T_SettingsNames _dirty;
+
+        /**
+         * @brief Stores the settings cache. Only the stored and set values are
+         * cached, the other identified settings read their flash default.
+         */
+        T_SettingsCache _cache;
 };
 
 #endif /* #ifndef __SETTINGS_H__ */
\ No newline at end of file
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * @file SettingsIds.h
+ *
+ * @see Settings.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 18/12/2025
+ *
+ * @version 1.0
+ *
+ * @brief Weather Station Firmware setting identifiers.
+ *
+ * @details Weather Station Firmware setting identifiers. This file is
+ * auto-generated and contains the names, identifiers, offsets and sizes of
+ * the settings used by the firmware.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __SETTINGS_IDS_H__
+#define __SETTINGS_IDS_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstddef> /* Standard size types */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the is_ap setting key. */
+#define SETTING_IS_AP "is_ap"
+/** @brief Defines the node_ssid setting key. */
+#define SETTING_NODE_SSID "node_ssid"
+/** @brief Defines the node_pass setting key. */
+#define SETTING_NODE_PASS "node_pass"
+/** @brief Defines the web_port setting key. */
+#define SETTING_WEB_PORT "web_port"
+/** @brief Defines the api_port setting key. */
+#define SETTING_API_PORT "api_port"
+/** @brief Defines the node_static setting key. */
+#define SETTING_NODE_STATIC "node_static"
+/** @brief Defines the node_st_ip setting key. */
+#define SETTING_NODE_ST_IP "node_st_ip"
+/** @brief Defines the node_st_gate setting key. */
+#define SETTING_NODE_ST_GATE "node_st_gate"
+/** @brief Defines the node_st_subnet setting key. */
+#define SETTING_NODE_ST_SUBNET "node_st_subnet"
+/** @brief Defines the node_st_pdns setting key. */
+#define SETTING_NODE_ST_PDNS "node_st_pdns"
+/** @brief Defines the node_st_sdns setting key. */
+#define SETTING_NODE_ST_SDNS "node_st_sdns"
+/** @brief Defines the wifi_lat_ms setting key. */
+#define SETTING_WIFI_LAT_MS "wifi_lat_ms"
+/** @brief Defines the tlm_mode setting key. */
+#define SETTING_TLM_MODE "tlm_mode"
+/** @brief Defines the tlm_host setting key. */
+#define SETTING_TLM_HOST "tlm_host"
+/** @brief Defines the tlm_port setting key. */
+#define SETTING_TLM_PORT "tlm_port"
+/** @brief Defines the tlm_period_s setting key. */
+#define SETTING_TLM_PERIOD_S "tlm_period_s"
+/** @brief Defines the task_cfg setting key. */
+#define SETTING_TASK_CFG "task_cfg"
+
+/** @brief Defines the size of all the identified settings values. */
+#define SETTINGS_VALUES_SIZE 231
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+
+/** @brief Identifiers of the settings. */
+typedef enum {
+    /** @brief Identifier of the is_ap setting. */
+    SETTING_ID_IS_AP = 0,
+    /** @brief Identifier of the node_ssid setting. */
+    SETTING_ID_NODE_SSID = 1,
+    /** @brief Identifier of the node_pass setting. */
+    SETTING_ID_NODE_PASS = 2,
+    /** @brief Identifier of the web_port setting. */
+    SETTING_ID_WEB_PORT = 3,
+    /** @brief Identifier of the api_port setting. */
+    SETTING_ID_API_PORT = 4,
+    /** @brief Identifier of the node_static setting. */
+    SETTING_ID_NODE_STATIC = 5,
+    /** @brief Identifier of the node_st_ip setting. */
+    SETTING_ID_NODE_ST_IP = 6,
+    /** @brief Identifier of the node_st_gate setting. */
+    SETTING_ID_NODE_ST_GATE = 7,
+    /** @brief Identifier of the node_st_subnet setting. */
+    SETTING_ID_NODE_ST_SUBNET = 8,
+    /** @brief Identifier of the node_st_pdns setting. */
+    SETTING_ID_NODE_ST_PDNS = 9,
+    /** @brief Identifier of the node_st_sdns setting. */
+    SETTING_ID_NODE_ST_SDNS = 10,
+    /** @brief Identifier of the wifi_lat_ms setting. */
+    SETTING_ID_WIFI_LAT_MS = 11,
+    /** @brief Identifier of the tlm_mode setting. */
+    SETTING_ID_TLM_MODE = 12,
+    /** @brief Identifier of the tlm_host setting. */
+    SETTING_ID_TLM_HOST = 13,
+    /** @brief Identifier of the tlm_port setting. */
+    SETTING_ID_TLM_PORT = 14,
+    /** @brief Identifier of the tlm_period_s setting. */
+    SETTING_ID_TLM_PERIOD_S = 15,
+    /** @brief Identifier of the task_cfg setting. */
+    SETTING_ID_TASK_CFG = 16,
+    /** @brief Number of identified settings. */
+    SETTING_ID_MAX = 17
+} E_SettingId;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/** @brief Names of the identified settings. */
+static constexpr const char* skSettingNames[SETTING_ID_MAX] = {
+    SETTING_IS_AP,
+    SETTING_NODE_SSID,
+    SETTING_NODE_PASS,
+    SETTING_WEB_PORT,
+    SETTING_API_PORT,
+    SETTING_NODE_STATIC,
+    SETTING_NODE_ST_IP,
+    SETTING_NODE_ST_GATE,
+    SETTING_NODE_ST_SUBNET,
+    SETTING_NODE_ST_PDNS,
+    SETTING_NODE_ST_SDNS,
+    SETTING_WIFI_LAT_MS,
+    SETTING_TLM_MODE,
+    SETTING_TLM_HOST,
+    SETTING_TLM_PORT,
+    SETTING_TLM_PERIOD_S,
+    SETTING_TASK_CFG
+};
+
+/** @brief Offsets of the identified settings values. */
+static constexpr size_t skSettingOffsets[SETTING_ID_MAX] = {
+    0,
+    1,
+    33,
+    65,
+    67,
+    69,
+    70,
+    85,
+    100,
+    115,
+    130,
+    145,
+    147,
+    148,
+    163,
+    165,
+    167
+};
+
+/** @brief Sizes of the identified settings values. */
+static constexpr size_t skSettingSizes[SETTING_ID_MAX] = {
+    1,
+    32,
+    32,
+    2,
+    2,
+    1,
+    15,
+    15,
+    15,
+    15,
+    15,
+    2,
+    1,
+    15,
+    2,
+    2,
+    64
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * @brief Gets the name of a setting.
+ *
+ * @param[in] kId The setting identifier.
+ *
+ * @return The setting name is returned.
+ */
+constexpr const char* SettingName(const E_SettingId kId) noexcept {
+    return skSettingNames[kId];
+}
+
+/**
+ * @brief Gets the offset of a setting value in the settings values.
+ *
+ * @param[in] kId The setting identifier.
+ *
+ * @return The setting value offset is returned.
+ */
+constexpr size_t SettingOffset(const E_SettingId kId) noexcept {
+    return skSettingOffsets[kId];
+}
+
+/**
+ * @brief Gets the size of a setting value.
+ *
+ * @param[in] kId The setting identifier.
+ *
+ * @return The setting value size is returned.
+ */
+constexpr size_t SettingSize(const E_SettingId kId) noexcept {
+    return skSettingSizes[kId];
+}
+
+#endif /* #ifndef __SETTINGS_IDS_H__ */
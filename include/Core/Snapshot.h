@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * @file Snapshot.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Lock-free published snapshot.
+ *
+ * @details Lock-free published snapshot. A single writer publishes values
+ * that any number of readers copy without locks. The readers never block
+ * the writer and never see a partially written value.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>      /* Standard atomic types */
+#include <cstdint>     /* Standard integer definitions */
+#include <type_traits> /* Type traits */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef SNAPSHOT_MAX_RETRIES
+/**
+ * @brief Defines the number of copies a reader attempts before giving up,
+ * a copy only fails when the writer published twice during the copy.
+ */
+#define SNAPSHOT_MAX_RETRIES 8
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The Snapshot class.
+ *
+ * @details The Snapshot class double buffers a value. The writer fills the
+ * slot not designated by the last publication, then designates it. Each
+ * slot has a sequence counter, odd while the slot is written, that the
+ * readers check around their copy. A copy is only retried when the writer
+ * came back to the slot being copied, that is after two publications.
+ *
+ * @tparam T The published type, trivially copyable.
+ */
+template <typename T>
+class Snapshot {
+    static_assert(
+        std::is_trivially_copyable<T>::value,
+        "Snapshots are copied without their constructors."
+    );
+
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Snapshot constructor.
+         *
+         * @param[in] krInitial The value read before the first publication.
+         */
+        explicit Snapshot(const T& krInitial) noexcept {
+            this->_pSlots[0].value = krInitial;
+            this->_pSlots[0].sequence.store(0, std::memory_order_relaxed);
+            this->_pSlots[1].value = krInitial;
+            this->_pSlots[1].sequence.store(0, std::memory_order_relaxed);
+            this->_version.store(0, std::memory_order_release);
+        }
+
+        /**
+         * @brief Publishes a value.
+         *
+         * @details Publishes a value. Must only be called by a single
+         * writer, never blocks.
+         *
+         * @param[in] krValue The value to publish.
+         */
+        void Publish(const T& krValue) noexcept {
+            uint32_t version;
+            uint32_t sequence;
+            S_Slot*  pSlot;
+
+            version = this->_version.load(std::memory_order_relaxed) + 1;
+            pSlot = &this->_pSlots[version & 1];
+
+            /* The slot is marked as written before its content changes */
+            sequence = pSlot->sequence.load(std::memory_order_relaxed);
+            pSlot->sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            pSlot->value = krValue;
+            pSlot->sequence.store(sequence + 2, std::memory_order_release);
+
+            this->_version.store(version, std::memory_order_release);
+        }
+
+        /**
+         * @brief Copies the last published value.
+         *
+         * @details Copies the last published value. Never blocks, the copy
+         * is retried up to SNAPSHOT_MAX_RETRIES times while the writer
+         * overtakes it.
+         *
+         * @param[out] rValue The buffer receiving the value.
+         *
+         * @return true if a consistent value was copied, false otherwise.
+         */
+        bool Read(T& rValue) const noexcept {
+            const S_Slot* pkSlot;
+            uint32_t      version;
+            uint32_t      sequence;
+            uint32_t      retries;
+            bool          isConsistent;
+
+            isConsistent = false;
+            for (retries = 0;
+                 SNAPSHOT_MAX_RETRIES > retries && !isConsistent;
+                 ++retries) {
+                version = this->_version.load(std::memory_order_acquire);
+                pkSlot = &this->_pSlots[version & 1];
+                sequence = pkSlot->sequence.load(std::memory_order_acquire);
+                rValue = pkSlot->value;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                isConsistent =
+                    0 == (sequence & 1) &&
+                    sequence ==
+                    pkSlot->sequence.load(std::memory_order_relaxed);
+            }
+
+            return isConsistent;
+        }
+
+        /**
+         * @brief Returns the number of publications.
+         *
+         * @details Returns the number of publications. Readers compare it
+         * with the last read one to skip unchanged values.
+         *
+         * @return The number of publications is returned.
+         */
+        uint32_t GetVersion(void) const noexcept {
+            return this->_version.load(std::memory_order_acquire);
+        }
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief Snapshot buffer slot. */
+        typedef struct {
+            /** @brief The slot sequence, odd while the slot is written. */
+            std::atomic<uint32_t> sequence;
+            /** @brief The slot value. */
+            T value;
+        } S_Slot;
+
+        /** @brief The two buffers. */
+        S_Slot _pSlots[2];
+        /** @brief The number of publications, its parity gives the slot. */
+        std::atomic<uint32_t> _version;
+};
+
+#endif /* #ifndef __SNAPSHOT_H__ */
@@ -0,0 +1,265 @@
+/*******************************************************************************
+ * @file SystemMonitor.h
+ *
+ * @see SystemMonitor.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Runtime system monitor.
+ *
+ * @details Runtime system monitor. The CPU usage and the stack watermark of
+ * the tasks, the memory and the sockets usage are sampled periodically and
+ * kept for a short time window.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_SYSTEM_MONITOR_H__
+#define __CORE_SYSTEM_MONITOR_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>   /* Standard integer definitions */
+#include <Errors.h>  /* Errors definitions */
+#include <Arduino.h> /* Arduino framework */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef SYSMON_PERIOD_NS
+/** @brief Defines the sampling period in nanoseconds. */
+#define SYSMON_PERIOD_NS 5000000000ULL
+#endif
+
+#ifndef SYSMON_WINDOW_SAMPLES
+/** @brief Defines the number of samples kept, the monitor time window. */
+#define SYSMON_WINDOW_SAMPLES 12
+#endif
+
+#ifndef SYSMON_MAX_TASKS
+/** @brief Defines the maximal number of tasks of a sample. */
+#define SYSMON_MAX_TASKS 20
+#endif
+
+/** @brief Defines the maximal number of tasks enumerated at once. */
+#define SYSMON_MAX_STATES 32
+
+/** @brief Defines the size of a task name, including the terminator. */
+#define SYSMON_TASK_NAME_SIZE configMAX_TASK_NAME_LEN
+
+/** @brief Defines the core of the tasks that are not pinned. */
+#define SYSMON_CORE_ANY -1
+
+/**
+ * @brief Tells if the run time counters are available. The CPU usages of the
+ * samples are not valid without them and are reported as unavailable.
+ */
+#define SYSMON_HAS_RUN_TIME                 \
+    (1 == configUSE_TRACE_FACILITY &&       \
+     1 == configGENERATE_RUN_TIME_STATS)
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Task usage of a monitor sample. */
+typedef struct {
+    /** @brief The task name. */
+    char pName[SYSMON_TASK_NAME_SIZE];
+    /** @brief The lowest free stack since the task creation in bytes. */
+    uint32_t stackFree;
+    /** @brief The CPU usage of one core during the period in permille. */
+    uint16_t cpuPermille;
+    /** @brief The core the task is pinned to, SYSMON_CORE_ANY if none. */
+    int8_t core;
+} S_SysMonTask;
+
+/** @brief Monitor sample. */
+typedef struct {
+    /** @brief The sampling time since boot in milliseconds. */
+    uint32_t timeMs;
+    /** @brief The load of each core during the period in permille. */
+    uint16_t pCoreLoad[portNUM_PROCESSORS];
+    /** @brief The free internal memory in bytes. */
+    uint32_t internalFree;
+    /** @brief The largest free internal block in bytes. */
+    uint32_t internalLargest;
+    /** @brief The free external memory in bytes. */
+    uint32_t psramFree;
+    /** @brief The largest free external block in bytes. */
+    uint32_t psramLargest;
+    /** @brief The number of open lwIP sockets. */
+    uint16_t socketsUsed;
+    /** @brief The number of lwIP sockets. */
+    uint16_t socketsMax;
+    /** @brief The number of tasks of the sample. */
+    uint32_t taskCount;
+    /** @brief The tasks, by decreasing CPU usage. */
+    S_SysMonTask pTasks[SYSMON_MAX_TASKS];
+} S_SysMonSample;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The SystemMonitor class.
+ *
+ * @details The SystemMonitor class samples the system every
+ * SYSMON_PERIOD_NS in a ring of SYSMON_WINDOW_SAMPLES. The CPU usage of the
+ * tasks is computed from the FreeRTOS run time counters over the period,
+ * the load of a core is the time its idle task did not run. When the run
+ * time statistics are not enabled in the FreeRTOS configuration, the CPU
+ * usages are left to 0 and SYSMON_HAS_RUN_TIME tells the readers to report
+ * them as unavailable.
+ */
+class SystemMonitor {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief SystemMonitor constructor.
+         */
+        SystemMonitor(void) noexcept;
+
+        /**
+         * @brief Destroys a SystemMonitor.
+         *
+         * @details Destroys a SystemMonitor. Since only one object is allowed
+         * in the firmware, the destructor will generate a critical error.
+         */
+        ~SystemMonitor(void) noexcept;
+
+        /**
+         * @brief Starts the sampling task.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Start(void) noexcept;
+
+        /**
+         * @brief Returns the number of samples in the window.
+         *
+         * @return The number of samples is returned.
+         */
+        uint32_t GetSampleCount(void) const noexcept;
+
+        /**
+         * @brief Copies a sample of the window.
+         *
+         * @param[in] kIndex The index of the sample, 0 is the oldest.
+         * @param[out] rSample The buffer receiving the sample.
+         *
+         * @return true if the sample was copied, false otherwise.
+         */
+        bool GetSample(const uint32_t  kIndex,
+                       S_SysMonSample& rSample) const noexcept;
+
+        /**
+         * @brief Copies the newest sample.
+         *
+         * @param[out] rSample The buffer receiving the sample.
+         *
+         * @return true if the sample was copied, false when no sample was
+         * taken yet.
+         */
+        bool GetLatest(S_SysMonSample& rSample) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief Run time counter of a task at the last sample. */
+        typedef struct {
+            /** @brief The FreeRTOS task number. */
+            UBaseType_t number;
+            /** @brief The run time counter of the task. */
+            uint32_t runTime;
+        } S_TaskCounter;
+
+        /**
+         * @brief Monitor task routine.
+         *
+         * @param[in] pParam The SystemMonitor instance.
+         */
+        static void TaskRoutine(void* pParam) noexcept;
+
+        /**
+         * @brief Samples the system in the ring.
+         */
+        void Sample(void) noexcept;
+
+        /**
+         * @brief Samples the tasks usage.
+         *
+         * @param[out] rSample The sample receiving the tasks usage.
+         */
+        void SampleTasks(S_SysMonSample& rSample) noexcept;
+
+        /**
+         * @brief Counts the open lwIP sockets.
+         *
+         * @return The number of open sockets is returned.
+         */
+        static uint16_t CountSockets(void) noexcept;
+
+        /** @brief The samples ring. */
+        S_SysMonSample* _pSamples;
+        /** @brief The index of the oldest sample. */
+        uint32_t _head;
+        /** @brief The number of samples. */
+        uint32_t _count;
+        /** @brief The sample being built. */
+        S_SysMonSample _current;
+
+        /** @brief The tasks state buffer. */
+        TaskStatus_t _pStates[SYSMON_MAX_STATES];
+        /** @brief The run time counters of the last sample. */
+        S_TaskCounter _pCounters[SYSMON_MAX_STATES];
+        /** @brief The number of run time counters. */
+        uint32_t _counterCount;
+        /** @brief The total run time counter of the last sample. */
+        uint32_t _totalRunTime;
+
+        /** @brief The samples ring lock. */
+        SemaphoreHandle_t _lock;
+        /** @brief Stores the monitor task handle. */
+        TaskHandle_t _taskHandle;
+};
+
+#endif /* #ifndef __CORE_SYSTEM_MONITOR_H__ */
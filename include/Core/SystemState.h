@@ -24,7 +24,9 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-/* None */
+#include <cstdint>    /* Standard integer definitions */
+#include <Sensor.h>   /* Sensor samples */
+#include <Snapshot.h> /* Lock-free published snapshot */
 
 /* Forward class declarations to avoid recursive inclusions */
 class WiFiModule;
@@ -34,11 +36,20 @@ class IOButtonManager;
 class IOLedManager;
 class Storage;
 class ModeManager;
+class SensorEngine;
+class TimeSeriesStore;
+class SystemMonitor;
 
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/* None */
+#ifndef SYSTEM_LIVE_MAX_READINGS
+/** @brief Defines the maximal number of channels of the latest readings. */
+#define SYSTEM_LIVE_MAX_READINGS 32
+#endif
+
+/** @brief Defines the number of health states, see E_HMStatus. */
+#define SYSTEM_HEALTH_STATES 4
 
 /*******************************************************************************
  * MACROS
@@ -49,7 +60,37 @@ class ModeManager;
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-/* None */
+/** @brief Latest readings, one per sensor channel. */
+typedef struct {
+    /** @brief The time of the last update in nanoseconds. */
+    uint64_t time;
+    /** @brief The number of valid readings. */
+    uint32_t count;
+    /** @brief The latest sample of each channel, in discovery order. */
+    S_SensorSample pReadings[SYSTEM_LIVE_MAX_READINGS];
+} S_LiveReadings;
+
+/** @brief Latest health summary. */
+typedef struct {
+    /** @brief The time of the last update in nanoseconds. */
+    uint64_t time;
+    /** @brief The worst status of the enabled reporters, see E_HMStatus. */
+    uint8_t status;
+    /** @brief The number of reporters in each state, by E_HMStatus. */
+    uint8_t pCounts[SYSTEM_HEALTH_STATES];
+} S_LiveHealth;
+
+/** @brief Latest system state copy. */
+typedef struct {
+    /** @brief The latest readings. */
+    S_LiveReadings readings;
+    /** @brief The readings publications count, unchanged when no update. */
+    uint32_t readingsVersion;
+    /** @brief The latest health summary. */
+    S_LiveHealth health;
+    /** @brief The health publications count, unchanged when no update. */
+    uint32_t healthVersion;
+} S_LiveState;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -176,6 +217,39 @@ class SystemState
          */
         void SetModeManager(ModeManager* pModeManager) noexcept;
 
+        /**
+         * @brief Sets the current Sensor engine instance.
+         *
+         * @details Sets the current Sensor engine instance. This stores a
+         * pointer in the system state object.
+         *
+         * @param[in] pSensorEngine The Sensor engine instance to store in the
+         * system state.
+         */
+        void SetSensorEngine(SensorEngine* pSensorEngine) noexcept;
+
+        /**
+         * @brief Sets the current Time series store instance.
+         *
+         * @details Sets the current Time series store instance. This stores a
+         * pointer in the system state object.
+         *
+         * @param[in] pStore The Time series store instance to store in the
+         * system state.
+         */
+        void SetTimeSeriesStore(TimeSeriesStore* pStore) noexcept;
+
+        /**
+         * @brief Sets the current System monitor instance.
+         *
+         * @details Sets the current System monitor instance. This stores a
+         * pointer in the system state object.
+         *
+         * @param[in] pMonitor The System monitor instance to store in the
+         * system state.
+         */
+        void SetSystemMonitor(SystemMonitor* pMonitor) noexcept;
+
         /**
          * @brief Returns the current WiFi module instance.
          *
@@ -246,6 +320,73 @@ class SystemState
          */
         ModeManager* GetModeManager(void) const noexcept;
 
+        /**
+         * @brief Returns the current Sensor engine instance.
+         *
+         * @details Returns the current Sensor engine instance. This
+         * instance is stored in the system state.
+         *
+         * @return The Sensor engine stored in the system state is returned,
+         * nullptr when the sensors are not started.
+         */
+        SensorEngine* GetSensorEngine(void) const noexcept;
+
+        /**
+         * @brief Returns the current Time series store instance.
+         *
+         * @details Returns the current Time series store instance. This
+         * instance is stored in the system state.
+         *
+         * @return The Time series store stored in the system state is
+         * returned, nullptr when the store is not created.
+         */
+        TimeSeriesStore* GetTimeSeriesStore(void) const noexcept;
+
+        /**
+         * @brief Returns the current System monitor instance.
+         *
+         * @details Returns the current System monitor instance. This
+         * instance is stored in the system state.
+         *
+         * @return The System monitor stored in the system state is returned,
+         * nullptr when the monitor is not created.
+         */
+        SystemMonitor* GetSystemMonitor(void) const noexcept;
+
+        /**
+         * @brief Publishes the latest readings.
+         *
+         * @details Publishes the latest readings. Only the acquisition task
+         * publishes the readings, the readers are not waited for.
+         *
+         * @param[in] krReadings The latest readings.
+         */
+        void PublishReadings(const S_LiveReadings& krReadings) noexcept;
+
+        /**
+         * @brief Publishes the latest health summary.
+         *
+         * @details Publishes the latest health summary. Only the HM checks
+         * task publishes the health, the readers are not waited for.
+         *
+         * @param[in] krHealth The latest health summary.
+         */
+        void PublishHealth(const S_LiveHealth& krHealth) noexcept;
+
+        /**
+         * @brief Copies the latest readings and health summary.
+         *
+         * @details Copies the latest readings and health summary without
+         * taking any lock. Each part is consistent, the readings and the
+         * health are published independently.
+         *
+         * @param[out] rState The buffer receiving the state.
+         *
+         * @return true if consistent copies were made, false if a writer
+         * kept overtaking the copy.
+         */
+        bool GetLiveState(S_LiveState& rState) const noexcept;
+
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
         /* None */
@@ -281,6 +422,21 @@ class SystemState
         /** @brief Stores the current Mode Manager instance. */
         ModeManager* _pModeManager;
 
+        /** @brief Stores the current Sensor Engine instance. */
+        SensorEngine* _pSensorEngine;
+
+        /** @brief Stores the current Time Series Store instance. */
+        TimeSeriesStore* _pTimeSeriesStore;
+
+        /** @brief Stores the current System Monitor instance. */
+        SystemMonitor* _pSystemMonitor;
+
+        /** @brief Stores the latest readings snapshot. */
+        Snapshot<S_LiveReadings> _readings;
+
+        /** @brief Stores the latest health snapshot. */
+        Snapshot<S_LiveHealth> _health;
+
         /** @brief The singleton instance. */
         static SystemState* _SPINSTANCE;
 
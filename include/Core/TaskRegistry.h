@@ -0,0 +1,329 @@
+/*******************************************************************************
+ * @file TaskRegistry.h
+ *
+ * @see TaskRegistry.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware tasks registry.
+ *
+ * @details Firmware tasks registry. The core, priority and stack size of the
+ * firmware tasks are defined in a single table, each entry can be overridden
+ * in the settings to rebalance the cores of a deployment.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_TASK_REGISTRY_H__
+#define __CORE_TASK_REGISTRY_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+#include <HAL.h>    /* Hardware abstraction layer */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the smallest stack size accepted for a task in bytes. */
+#define TASK_MIN_STACK 2048
+
+/** @brief Defines the largest stack size accepted for a task in bytes. */
+#define TASK_MAX_STACK 32768
+
+/** @brief Defines the number of cores a task can be pinned to. */
+#define TASK_CORE_COUNT 2
+
+/** @brief Defines the number of overrides the tasks setting holds. */
+#define TASK_MAX_OVERRIDES 16
+
+#ifndef TASK_STACK_PROFILE
+/**
+ * @brief Enables the stack profiling mode, the stack peaks of the tasks are
+ * persisted across boots to size the stack table.
+ */
+#define TASK_STACK_PROFILE 0
+#endif
+
+/** @brief Defines the file persisting the stack peaks. */
+#define TASK_STACK_PROFILE_PATH "/taskstack.bin"
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the firmware tasks identifiers. */
+typedef enum {
+    /** @brief Logger writer task. */
+    TASK_ID_LOGGER = 0,
+    /** @brief Health Monitor real-time task. */
+    TASK_ID_HM_RT = 1,
+    /** @brief Health Monitor actions task. */
+    TASK_ID_HM_ACTIONS = 2,
+    /** @brief Health Monitor checks task. */
+    TASK_ID_HM_CHECKS = 3,
+    /** @brief IO task. */
+    TASK_ID_IO = 4,
+    /** @brief Sensors sampling task. */
+    TASK_ID_SENSORS = 5,
+    /** @brief Web and API servers task. */
+    TASK_ID_SERVERS = 6,
+    /** @brief Telemetry publisher task. */
+    TASK_ID_TELEMETRY = 7,
+    /** @brief Time series store task. */
+    TASK_ID_TSDB = 8,
+    /** @brief System monitor task. */
+    TASK_ID_SYSMON = 9,
+    /** @brief Firmware update writer task. */
+    TASK_ID_OTA = 10,
+    /** @brief Number of firmware tasks. */
+    TASK_ID_COUNT = 11
+} E_TaskId;
+
+/** @brief Placement of a task. */
+typedef struct {
+    /** @brief The stack size in bytes. */
+    uint32_t stackSize;
+    /** @brief The task priority. */
+    uint8_t priority;
+    /** @brief The core the task is pinned to, HAL_CORE_ANY if none. */
+    int8_t core;
+} S_TaskConfig;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The TaskRegistry class.
+ *
+ * @details The TaskRegistry class creates the firmware tasks from the tasks
+ * table. The overrides stored in the settings are applied when the settings
+ * are loaded, the tasks created before that, the logger and the Health
+ * Monitor tasks, always use the table defaults. A changed override applies
+ * at the next boot.
+ */
+class TaskRegistry {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Creates a firmware task.
+         *
+         * @param[in] kId The task to create.
+         * @param[in] routine The task routine.
+         * @param[in] pParam The routine parameter.
+         * @param[out] rTask The created task handle.
+         *
+         * @return true is returned when the task is created.
+         */
+        static bool CreateTask(const E_TaskId   kId,
+                               T_HALTaskRoutine routine,
+                               void*            pParam,
+                               T_HALTask&       rTask) noexcept;
+
+        /**
+         * @brief Applies the overrides stored in the settings.
+         *
+         * @details Applies the overrides stored in the settings. Invalid
+         * overrides are reported and ignored. Must be called once the
+         * settings are created.
+         */
+        static void LoadOverrides(void) noexcept;
+
+        /**
+         * @brief Returns the name of a task.
+         *
+         * @param[in] kId The task to get.
+         *
+         * @return The name of the task is returned.
+         */
+        static const char* GetName(const E_TaskId kId) noexcept;
+
+        /**
+         * @brief Finds a task by name.
+         *
+         * @param[in] kpName The name of the task.
+         * @param[out] rId The identifier of the task.
+         *
+         * @return true is returned when the task exists.
+         */
+        static bool Find(const char* kpName, E_TaskId& rId) noexcept;
+
+        /**
+         * @brief Returns the placement used to create a task.
+         *
+         * @param[in] kId The task to get.
+         * @param[out] rConfig The buffer receiving the placement.
+         */
+        static void GetConfig(const E_TaskId kId,
+                              S_TaskConfig&  rConfig) noexcept;
+
+        /**
+         * @brief Returns the override stored for a task.
+         *
+         * @param[in] kId The task to get.
+         * @param[out] rConfig The buffer receiving the override.
+         *
+         * @return true is returned when an override is stored.
+         */
+        static bool GetOverride(const E_TaskId kId,
+                                S_TaskConfig&  rConfig) noexcept;
+
+        /**
+         * @brief Stores an override for a task.
+         *
+         * @details Stores and commits an override for a task, it applies at
+         * the next boot.
+         *
+         * @param[in] kId The task to override.
+         * @param[in] krConfig The placement of the task.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return SetOverride(const E_TaskId      kId,
+                                    const S_TaskConfig& krConfig) noexcept;
+
+        /**
+         * @brief Removes the override of a task.
+         *
+         * @details Removes the override of a task, the table default applies
+         * at the next boot.
+         *
+         * @param[in] kId The task to restore.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return ClearOverride(const E_TaskId kId) noexcept;
+
+        /**
+         * @brief Records the lowest free stack of a task.
+         *
+         * @param[in] kId The task to update.
+         * @param[in] kStackFree The lowest free stack since the task creation
+         * in bytes.
+         */
+        static void RecordStackFree(const E_TaskId kId,
+                                    const uint32_t kStackFree) noexcept;
+
+        /**
+         * @brief Returns the stack peak of a task.
+         *
+         * @details Returns the stack peak of a task. In profiling mode, the
+         * peak includes the peaks persisted by the previous boots.
+         *
+         * @param[in] kId The task to get.
+         *
+         * @return The largest stack usage measured in bytes is returned, 0 if
+         * none was measured.
+         */
+        static uint32_t GetStackPeak(const E_TaskId kId) noexcept;
+
+        /**
+         * @brief Persists the stack peaks in profiling mode.
+         *
+         * @details Persists the stack peaks when one grew since the last
+         * call. The peaks of the previous boots are merged on the first call.
+         * Does nothing when TASK_STACK_PROFILE is disabled.
+         */
+        static void SaveStackProfile(void) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief Task override as stored in the settings. */
+        typedef struct {
+            /** @brief The stack size in bytes, 0 when not overridden. */
+            uint16_t stackSize;
+            /** @brief The task priority. */
+            uint8_t priority;
+            /** @brief The core the task is pinned to, HAL_CORE_ANY if none. */
+            int8_t core;
+        } S_TaskOverride;
+
+        /**
+         * @brief Tells if a placement can be applied.
+         *
+         * @param[in] krConfig The placement to check.
+         *
+         * @return true is returned when the placement is valid.
+         */
+        static bool IsValid(const S_TaskConfig& krConfig) noexcept;
+
+        /**
+         * @brief Reads the overrides of all the tasks.
+         *
+         * @param[out] pOverrides The buffer receiving the TASK_MAX_OVERRIDES
+         * overrides, by task identifier.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return ReadOverrides(S_TaskOverride* pOverrides) noexcept;
+
+        /**
+         * @brief Writes and commits the override of a task.
+         *
+         * @param[in] kId The task to override.
+         * @param[in] krOverride The override to store.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return StoreOverride(const E_TaskId        kId,
+                                      const S_TaskOverride& krOverride)
+        noexcept;
+
+        /**
+         * @brief Merges the stack peaks persisted by the previous boots.
+         */
+        static void LoadStackProfile(void) noexcept;
+
+        /** @brief The placement of the tasks, by task identifier. */
+        static S_TaskConfig _SPCONFIGS[TASK_ID_COUNT];
+        /** @brief The stack peaks in bytes, by task identifier. */
+        static uint32_t _SPSTACKPEAKS[TASK_ID_COUNT];
+        /** @brief Tells if a stack peak grew since the last save. */
+        static bool _SPROFILEDIRTY;
+        /** @brief Tells if the persisted stack peaks were merged. */
+        static bool _SPROFILELOADED;
+        /** @brief The stack peaks lock. */
+        static T_HALSpinLock _SLOCK;
+};
+
+#endif /* #ifndef __CORE_TASK_REGISTRY_H__ */
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * @file TaskStacks.h
+ *
+ * @see TaskRegistry.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware tasks stack sizes.
+ *
+ * @details Firmware tasks stack sizes. This file is auto-generated by
+ * tools/stacktune.py from the stack peaks measured with TASK_STACK_PROFILE.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_TASK_STACKS_H__
+#define __CORE_TASK_STACKS_H__
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief LOGGER_TASK stack size, not measured. */
+#define TASK_STACK_LOGGER 4096
+/** @brief HW-RT_TASK stack size, not measured. */
+#define TASK_STACK_HM_RT 4096
+/** @brief HM_ACTIONS_TASK stack size, not measured. */
+#define TASK_STACK_HM_ACTIONS 4096
+/** @brief HM_CHECKS_TASK stack size, not measured. */
+#define TASK_STACK_HM_CHECKS 4096
+/** @brief HW-IO_TASK stack size, not measured. */
+#define TASK_STACK_IO 4096
+/** @brief SENSORS_TASK stack size, not measured. */
+#define TASK_STACK_SENSORS 4096
+/** @brief HTTP-SRV_TASK stack size, not measured. */
+#define TASK_STACK_SERVERS 4096
+/** @brief TLM_TASK stack size, not measured. */
+#define TASK_STACK_TELEMETRY 4096
+/** @brief TSDB_TASK stack size, not measured. */
+#define TASK_STACK_TSDB 6144
+/** @brief SYSMON_TASK stack size, not measured. */
+#define TASK_STACK_SYSMON 3072
+/** @brief OTA_TASK stack size, not measured. */
+#define TASK_STACK_OTA 4096
+
+#endif /* #ifndef __CORE_TASK_STACKS_H__ */
\ No newline at end of file
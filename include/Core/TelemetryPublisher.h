@@ -0,0 +1,425 @@
+/*******************************************************************************
+ * @file TelemetryPublisher.h
+ *
+ * @see TelemetryPublisher.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Batched telemetry publisher.
+ *
+ * @details Batched telemetry publisher. The node status and the health of the
+ * reporters are sampled periodically and pushed in batches over UDP or MQTT at
+ * the configured interval.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CORE_TELEMETRY_PUBLISHER_H__
+#define __CORE_TELEMETRY_PUBLISHER_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>         /* Standard integer definitions */
+#include <cstddef>         /* Standard size type */
+#include <WiFi.h>          /* WiFi services */
+#include <Errors.h>        /* Errors definitions */
+#include <WiFiUdp.h>       /* UDP transport */
+#include <Arduino.h>       /* Arduino framework */
+#include <SettingsIds.h>   /* Settings identifiers */
+#include <OutageBuffer.h>  /* Store-and-forward buffer */
+#include <HealthMonitor.h> /* Reporters status */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef TELEMETRY_SAMPLE_PERIOD_NS
+/** @brief Defines the sampling period in nanoseconds. */
+#define TELEMETRY_SAMPLE_PERIOD_NS 1000000000ULL
+#endif
+
+#ifndef TELEMETRY_MAX_SAMPLES
+/** @brief Defines the number of buffered samples. */
+#define TELEMETRY_MAX_SAMPLES 64
+#endif
+
+#ifndef TELEMETRY_BATCH_MAX_SAMPLES
+/** @brief Defines the maximal number of samples per payload. */
+#define TELEMETRY_BATCH_MAX_SAMPLES 12
+#endif
+
+#ifndef TELEMETRY_PAYLOAD_SIZE
+/** @brief Defines the payload buffer size in bytes, one datagram. */
+#define TELEMETRY_PAYLOAD_SIZE 1400
+#endif
+
+#ifndef TELEMETRY_MAX_BACKOFF_NS
+/** @brief Defines the maximal retry delay after failed sends in ns. */
+#define TELEMETRY_MAX_BACKOFF_NS 300000000000ULL
+#endif
+
+#ifndef TELEMETRY_OUTAGE_RECORDS
+/** @brief Defines the number of samples kept in memory during outages. */
+#define TELEMETRY_OUTAGE_RECORDS 2048
+#endif
+
+#ifndef TELEMETRY_OUTAGE_PATH
+/** @brief Defines the outage overflow file path. */
+#define TELEMETRY_OUTAGE_PATH "rthr_tlm_outage.bin"
+#endif
+
+#ifndef TELEMETRY_DRAIN_PAYLOAD_NS
+/** @brief Defines the minimal delay between two backlog payloads in ns. */
+#define TELEMETRY_DRAIN_PAYLOAD_NS 250000000ULL
+#endif
+
+#ifndef TELEMETRY_DRAIN_BURST
+/** @brief Defines the maximal number of backlog payloads sent at once. */
+#define TELEMETRY_DRAIN_BURST 4
+#endif
+
+#ifndef TELEMETRY_CONNECT_TIMEOUT_NS
+/** @brief Defines the MQTT broker connection timeout in nanoseconds. */
+#define TELEMETRY_CONNECT_TIMEOUT_NS 2000000000ULL
+#endif
+
+#ifndef TELEMETRY_MQTT_KEEPALIVE_S
+/**
+ * @brief Defines the MQTT keep alive interval in seconds. A ping is sent
+ * after half of it without publication.
+ */
+#define TELEMETRY_MQTT_KEEPALIVE_S 60
+#endif
+
+#ifndef TELEMETRY_MQTT_TOPIC_PREFIX
+/** @brief Defines the MQTT topic prefix, followed by the node identifier. */
+#define TELEMETRY_MQTT_TOPIC_PREFIX "rthr/"
+#endif
+
+/** @brief Defines the size of the MQTT topic buffer. */
+#define TELEMETRY_MQTT_TOPIC_SIZE 64
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the telemetry transports. */
+typedef enum {
+    /** @brief Telemetry disabled. */
+    TELEMETRY_MODE_OFF = 0,
+    /** @brief One JSON datagram per batch. */
+    TELEMETRY_MODE_UDP = 1,
+    /** @brief One MQTT QoS 0 publish per batch. */
+    TELEMETRY_MODE_MQTT = 2
+} E_TelemetryMode;
+
+/** @brief Telemetry configuration, as stored in the settings. */
+typedef struct {
+    /** @brief The transport, by E_TelemetryMode. */
+    uint8_t mode;
+    /** @brief The collector IPv4 address, null-terminated. */
+    char pHost[SettingSize(SETTING_ID_TLM_HOST) + 1];
+    /** @brief The collector port. */
+    uint16_t port;
+    /** @brief The publish interval in seconds. */
+    uint16_t periodS;
+} S_TelemetryConfig;
+
+/** @brief Telemetry sample. */
+typedef struct {
+    /** @brief The sampling time since boot in milliseconds. */
+    uint32_t timeMs;
+    /** @brief The free heap in bytes. */
+    uint32_t heapFree;
+    /** @brief The lowest free heap since boot in bytes. */
+    uint32_t heapMin;
+    /** @brief The WiFi RSSI in dBm, 0 when not associated. */
+    int32_t rssi;
+    /** @brief The number of pending HM actions. */
+    uint32_t hmPending;
+    /** @brief The number of HM actions rejected by a full scheduler. */
+    uint32_t hmDropped;
+} S_TelemetrySample;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The TelemetryPublisher class.
+ *
+ * @details The TelemetryPublisher class samples the node status in a ring of
+ * TELEMETRY_MAX_SAMPLES. At each publish interval, the buffered samples are
+ * sent in batches with the current health of the reporters. A failed send
+ * keeps the samples and doubles the retry delay up to
+ * TELEMETRY_MAX_BACKOFF_NS. When the ring is full, the oldest samples are
+ * moved to an outage buffer, that spills to the SD card. While the WiFi link
+ * is down, nothing is sent and the samples accumulate. Once the link is back,
+ * the live samples are published first and the backlog is drained between
+ * the publications in full payloads, at most one every
+ * TELEMETRY_DRAIN_PAYLOAD_NS. The samples that could not be buffered are
+ * dropped and their count is reported in the next batches.
+ */
+class TelemetryPublisher {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief TelemetryPublisher constructor.
+         */
+        TelemetryPublisher(void) noexcept;
+
+        /**
+         * @brief Destroys a TelemetryPublisher.
+         *
+         * @details Destroys a TelemetryPublisher. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        ~TelemetryPublisher(void) noexcept;
+
+        /**
+         * @brief Starts the publisher.
+         *
+         * @details Starts the publisher. The configuration is read from the
+         * settings and the publisher task is created, unless the telemetry
+         * is disabled.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Start(void) noexcept;
+
+        /**
+         * @brief Provides the stored telemetry configuration.
+         *
+         * @details Provides the stored telemetry configuration. The default
+         * values are provided for the settings that are not set.
+         *
+         * @param[out] rConfig The buffer receiving the configuration.
+         */
+        static void GetConfiguration(S_TelemetryConfig& rConfig) noexcept;
+
+        /**
+         * @brief Updates the stored telemetry configuration.
+         *
+         * @details Updates the stored telemetry configuration. The
+         * configuration is validated and committed to the settings. The
+         * publisher reads it at start, the new configuration applies at the
+         * next boot.
+         *
+         * @param[in] krConfig The new configuration.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return SetConfiguration(const S_TelemetryConfig& krConfig)
+        noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Publisher task routine.
+         *
+         * @param[in] pParam The TelemetryPublisher instance.
+         */
+        static void TaskRoutine(void* pParam) noexcept;
+
+        /**
+         * @brief Validates a telemetry configuration.
+         *
+         * @param[in] krConfig The configuration to validate.
+         * @param[out] rHost The parsed collector address.
+         *
+         * @return true if the configuration is valid, a disabled telemetry
+         * is always valid.
+         */
+        static bool IsConfigValid(const S_TelemetryConfig& krConfig,
+                                  IPAddress&               rHost) noexcept;
+
+        /**
+         * @brief Samples the node status in the ring.
+         */
+        void Sample(void) noexcept;
+
+        /**
+         * @brief Publishes the buffered samples.
+         *
+         * @return true if all the buffered samples were sent.
+         */
+        bool Publish(void) noexcept;
+
+        /**
+         * @brief Sends the oldest samples of the outage buffer.
+         *
+         * @details Sends the oldest samples of the outage buffer. The number
+         * of payloads is limited by the credit accumulated since the last
+         * drain.
+         *
+         * @return true if no send failed.
+         */
+        bool DrainBacklog(void) noexcept;
+
+        /**
+         * @brief Sends the samples of the batch buffer.
+         *
+         * @details Sends the samples of the batch buffer. The batch is
+         * halved until it fits a payload.
+         *
+         * @param[in] kCount The number of samples of the batch buffer.
+         * @param[in] kIsBacklog Tells if the samples come from the backlog.
+         *
+         * @return The number of samples to release is returned, 0 if the
+         * send failed.
+         */
+        uint32_t SendBatch(const uint32_t kCount,
+                           const bool     kIsBacklog) noexcept;
+
+        /**
+         * @brief Formats the first samples of the batch buffer.
+         *
+         * @param[in] kCount The number of samples of the batch.
+         * @param[in] kIsBacklog Tells if the samples come from the backlog.
+         *
+         * @return The payload size is returned, 0 if the batch overflowed
+         * the payload buffer.
+         */
+        size_t FormatBatch(const uint32_t kCount,
+                           const bool     kIsBacklog) noexcept;
+
+        /**
+         * @brief Sends a payload over the configured transport.
+         *
+         * @param[in] kSize The size of the payload in bytes.
+         *
+         * @return true if the payload was sent.
+         */
+        bool Send(const size_t kSize) noexcept;
+
+        /**
+         * @brief Connects to the MQTT broker.
+         *
+         * @return true if the broker accepted the connection.
+         */
+        bool ConnectMQTT(void) noexcept;
+
+        /**
+         * @brief Keeps the MQTT broker session alive.
+         *
+         * @details Keeps the MQTT broker session alive. A ping is sent when
+         * nothing was sent for half the keep alive interval and the
+         * connection is closed when the broker does not answer within the
+         * interval. The next publication reconnects.
+         *
+         * @param[in] kTime The current time in nanoseconds.
+         */
+        void KeepAliveMQTT(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Writes a MQTT fixed header.
+         *
+         * @param[in] kType The packet type and flags byte.
+         * @param[in] kRemaining The remaining length of the packet.
+         *
+         * @return true if the header was written.
+         */
+        bool WriteMQTTHeader(const uint8_t  kType,
+                             const uint32_t kRemaining) noexcept;
+
+        /**
+         * @brief Writes a MQTT length prefixed string.
+         *
+         * @param[in] kpStr The null-terminated string to write.
+         *
+         * @return true if the string was written.
+         */
+        bool WriteMQTTString(const char* kpStr) noexcept;
+
+        /** @brief The configured transport. */
+        E_TelemetryMode _mode;
+        /** @brief The collector address. */
+        IPAddress _host;
+        /** @brief The collector port. */
+        uint16_t _port;
+        /** @brief The publish interval in nanoseconds. */
+        uint64_t _periodNs;
+        /** @brief The current retry delay in nanoseconds. */
+        uint64_t _backoffNs;
+        /** @brief The time of the next publish in nanoseconds. */
+        uint64_t _nextPublish;
+
+        /** @brief The samples ring. */
+        S_TelemetrySample _pSamples[TELEMETRY_MAX_SAMPLES];
+        /** @brief The index of the oldest sample. */
+        uint32_t _head;
+        /** @brief The number of buffered samples. */
+        uint32_t _count;
+        /** @brief The number of samples dropped since boot. */
+        uint32_t _dropped;
+        /** @brief The sequence number of the next batch. */
+        uint32_t _sequence;
+
+        /** @brief The samples kept while the collector is unreachable. */
+        OutageBuffer* _pOutage;
+        /** @brief The samples of the batch being sent. */
+        S_TelemetrySample _pBatch[TELEMETRY_BATCH_MAX_SAMPLES];
+        /** @brief The backlog send credit in nanoseconds. */
+        uint64_t _drainCreditNs;
+        /** @brief The time of the last backlog drain in nanoseconds. */
+        uint64_t _lastDrain;
+
+        /** @brief The reporters status of the batch being formatted. */
+        S_HMReporterStatus _pHealth[HM_MAX_REPORTERS];
+        /** @brief The payload buffer. */
+        char _pPayload[TELEMETRY_PAYLOAD_SIZE];
+        /** @brief The MQTT topic. */
+        char _pTopic[TELEMETRY_MQTT_TOPIC_SIZE];
+
+        /** @brief The UDP transport. */
+        WiFiUDP _udp;
+        /** @brief The MQTT broker connection. */
+        WiFiClient _mqtt;
+        /** @brief The time of the last MQTT packet sent in nanoseconds. */
+        uint64_t _lastMQTTSend;
+        /** @brief The time of the pending MQTT ping, 0 if none. */
+        uint64_t _pingTime;
+
+        /** @brief Stores the publisher task handle. */
+        TaskHandle_t _taskHandle;
+};
+
+#endif /* #ifndef __CORE_TELEMETRY_PUBLISHER_H__ */
@@ -0,0 +1,409 @@
+/*******************************************************************************
+ * @file HAL.h
+ *
+ * @see HAL.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Hardware abstraction layer.
+ *
+ * @details Hardware abstraction layer. The time, locks, tasks, queues, memory
+ * and storage services used by the platform independent modules are reached
+ * through this layer. The ESP32 backend forwards to FreeRTOS and the BSP, the
+ * native backend runs the same modules on the host for load testing.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __HAL_H__
+#define __HAL_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard integer definitions */
+#include <cstddef> /* Standard size type */
+
+#ifndef HAL_NATIVE
+/** @brief Set to 1 to build the host simulator backend. */
+#define HAL_NATIVE 0
+#endif
+
+#if HAL_NATIVE
+#include <HALNative.h> /* Host simulator backend */
+#else
+#define DISABLE_FS_H_WARNING
+#include <SdFat.h>     /* SD Card driver */
+#include <Arduino.h>   /* FreeRTOS services */
+#endif
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Timeout value waiting without limit. */
+#define HAL_WAIT_FOREVER UINT64_MAX
+
+/** @brief Lowest task priority, the priority of the idle tasks. */
+#define HAL_IDLE_PRIORITY 0
+
+/** @brief Core of the tasks that are not pinned. */
+#define HAL_CORE_ANY -1
+
+#if !HAL_NATIVE
+/** @brief Duration of a scheduler tick in nanoseconds. */
+#define HAL_TICK_NS (portTICK_PERIOD_MS * 1000000ULL)
+
+/** @brief Highest task priority. */
+#define HAL_MAX_PRIORITY (configMAX_PRIORITIES - 1)
+
+/** @brief Spin lock initializer, usable for static locks. */
+#define HAL_SPINLOCK_INITIALIZER portMUX_INITIALIZER_UNLOCKED
+
+/** @brief Size of a task name, with its terminator. */
+#define HAL_TASK_NAME_SIZE configMAX_TASK_NAME_LEN
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+#if !HAL_NATIVE
+/** @brief Task handle. */
+typedef TaskHandle_t T_HALTask;
+/** @brief Mutex handle. */
+typedef SemaphoreHandle_t T_HALMutex;
+/** @brief Queue handle. */
+typedef QueueHandle_t T_HALQueue;
+/** @brief Spin lock, masks the interrupts of the core while held. */
+typedef portMUX_TYPE T_HALSpinLock;
+/** @brief Scheduler tick count. */
+typedef TickType_t T_HALTick;
+/** @brief Storage file. */
+typedef FsFile T_HALFile;
+/** @brief Storage device. */
+typedef SdFs T_HALStorageDevice;
+#endif
+
+/** @brief Task routine. */
+typedef void (*T_HALTaskRoutine)(void* pParam);
+
+/** @brief Internal heap statistics. */
+typedef struct {
+    /** @brief The free size in bytes. */
+    size_t freeSize;
+    /** @brief The largest free block in bytes. */
+    size_t largestBlock;
+    /** @brief The lowest free size since boot in bytes. */
+    size_t minFreeSize;
+} S_HALHeapStats;
+
+/** @brief Task description. */
+typedef struct {
+    /** @brief The task handle. */
+    T_HALTask task;
+    /** @brief The task name. */
+    char pName[HAL_TASK_NAME_SIZE];
+} S_HALTaskInfo;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The HAL class.
+ *
+ * @details The HAL class gathers the platform services as static functions.
+ * The timeouts are given in nanoseconds and rounded up to the scheduler
+ * tick, HAL_WAIT_FOREVER waits without limit.
+ */
+class HAL {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Returns the time in nanoseconds.
+         *
+         * @return The time since boot is returned.
+         */
+        static uint64_t GetTime(void) noexcept;
+
+        /**
+         * @brief Returns the CPU cycle counter.
+         *
+         * @details Returns the CPU cycle counter. The counter wraps, it must
+         * only be used for short measurements.
+         *
+         * @return The current cycle count is returned.
+         */
+        static uint32_t GetCycleCount(void) noexcept;
+
+        /**
+         * @brief Creates a mutex.
+         *
+         * @return The mutex is returned, nullptr on error.
+         */
+        static T_HALMutex CreateMutex(void) noexcept;
+
+        /**
+         * @brief Takes a mutex.
+         *
+         * @param[in] mutex The mutex to take.
+         * @param[in] kTimeoutNs The acquisition timeout in nanoseconds.
+         *
+         * @return true is returned when the mutex is taken.
+         */
+        static bool TakeMutex(T_HALMutex mutex,
+                              const uint64_t kTimeoutNs) noexcept;
+
+        /**
+         * @brief Gives a mutex back.
+         *
+         * @param[in] mutex The mutex to give.
+         *
+         * @return true is returned when the mutex is released.
+         */
+        static bool GiveMutex(T_HALMutex mutex) noexcept;
+
+        /**
+         * @brief Initializes a spin lock.
+         *
+         * @param[out] rLock The lock to initialize.
+         */
+        static void InitSpinLock(T_HALSpinLock& rLock) noexcept;
+
+        /**
+         * @brief Enters a critical section.
+         *
+         * @details Enters a critical section. The section must be short and
+         * must not block, the sections do not nest.
+         *
+         * @param[in] rLock The lock of the section.
+         */
+        static void EnterCritical(T_HALSpinLock& rLock) noexcept;
+
+        /**
+         * @brief Exits a critical section.
+         *
+         * @param[in] rLock The lock of the section.
+         */
+        static void ExitCritical(T_HALSpinLock& rLock) noexcept;
+
+        /**
+         * @brief Creates a task.
+         *
+         * @details Creates a task. The priority and core are hints that the
+         * native backend ignores.
+         *
+         * @param[in] routine The task routine.
+         * @param[in] kpName The task name.
+         * @param[in] kStackSize The stack size in bytes.
+         * @param[in] pParam The routine parameter.
+         * @param[in] kPriority The task priority.
+         * @param[in] kCore The core the task is pinned to, HAL_CORE_ANY to
+         * let the scheduler place it.
+         * @param[out] rTask The created task handle.
+         *
+         * @return true is returned when the task is created.
+         */
+        static bool CreateTask(T_HALTaskRoutine routine,
+                               const char*      kpName,
+                               const uint32_t   kStackSize,
+                               void*            pParam,
+                               const uint32_t   kPriority,
+                               const int32_t    kCore,
+                               T_HALTask&       rTask) noexcept;
+
+        /**
+         * @brief Returns the calling task.
+         *
+         * @return The handle of the calling task is returned.
+         */
+        static T_HALTask GetCurrentTask(void) noexcept;
+
+        /**
+         * @brief Returns the core running the calling task.
+         *
+         * @return The core identifier is returned, 0 on the native backend.
+         */
+        static uint8_t GetCoreId(void) noexcept;
+
+        /**
+         * @brief Lists the existing tasks.
+         *
+         * @details Lists the existing tasks. The native backend does not
+         * list the host threads.
+         *
+         * @param[out] pTasks The buffer receiving the tasks.
+         * @param[in] kCount The number of tasks the buffer holds.
+         *
+         * @return The number of tasks listed is returned, 0 when the buffer
+         * cannot hold all the tasks.
+         */
+        static uint32_t GetTasks(S_HALTaskInfo* pTasks,
+                                 const uint32_t kCount) noexcept;
+
+        /**
+         * @brief Blocks the calling task.
+         *
+         * @param[in] kDelayNs The delay in nanoseconds, at least one tick.
+         */
+        static void Sleep(const uint64_t kDelayNs) noexcept;
+
+        /**
+         * @brief Returns the scheduler tick count.
+         *
+         * @return The current tick count is returned.
+         */
+        static T_HALTick GetTick(void) noexcept;
+
+        /**
+         * @brief Blocks the calling task until the next period.
+         *
+         * @details Blocks the calling task until the next period. The wake
+         * time is advanced by the period, rounded down to the tick.
+         *
+         * @param[in, out] rLastWake The previous wake time, updated.
+         * @param[in] kPeriodNs The period in nanoseconds.
+         *
+         * @return false is returned when the period was already over and the
+         * task was not blocked.
+         */
+        static bool DelayUntil(T_HALTick&     rLastWake,
+                               const uint64_t kPeriodNs) noexcept;
+
+        /**
+         * @brief Notifies a task.
+         *
+         * @param[in] task The task to notify.
+         */
+        static void NotifyTask(T_HALTask task) noexcept;
+
+        /**
+         * @brief Waits for a notification of the calling task.
+         *
+         * @details Waits for a notification of the calling task. The pending
+         * notifications are all consumed.
+         *
+         * @param[in] kTimeoutNs The wait timeout in nanoseconds.
+         *
+         * @return The number of consumed notifications is returned, 0 on
+         * timeout.
+         */
+        static uint32_t WaitNotify(const uint64_t kTimeoutNs) noexcept;
+
+        /**
+         * @brief Creates a queue.
+         *
+         * @param[in] kLength The number of items of the queue.
+         * @param[in] kItemSize The size of an item in bytes.
+         *
+         * @return The queue is returned, nullptr on error.
+         */
+        static T_HALQueue CreateQueue(const uint32_t kLength,
+                                      const uint32_t kItemSize) noexcept;
+
+        /**
+         * @brief Sends an item to a queue.
+         *
+         * @param[in] queue The queue to send to.
+         * @param[in] kpItem The item to copy in the queue.
+         * @param[in] kTimeoutNs The wait timeout in nanoseconds.
+         *
+         * @return true is returned when the item is queued.
+         */
+        static bool SendQueue(T_HALQueue     queue,
+                              const void*    kpItem,
+                              const uint64_t kTimeoutNs) noexcept;
+
+        /**
+         * @brief Receives an item from a queue.
+         *
+         * @param[in] queue The queue to receive from.
+         * @param[out] pItem The buffer receiving the item.
+         * @param[in] kTimeoutNs The wait timeout in nanoseconds.
+         *
+         * @return true is returned when an item is received.
+         */
+        static bool ReceiveQueue(T_HALQueue     queue,
+                                 void*          pItem,
+                                 const uint64_t kTimeoutNs) noexcept;
+
+        /**
+         * @brief Allocates memory.
+         *
+         * @details Allocates memory. The external memory is only used when
+         * requested, there is no fallback to the internal memory.
+         *
+         * @param[in] kSize The size to allocate in bytes.
+         * @param[in] kIsExternal Tells if the external memory is requested.
+         *
+         * @return The allocated memory is returned, nullptr on error.
+         */
+        static void* Allocate(const size_t kSize,
+                              const bool   kIsExternal) noexcept;
+
+        /**
+         * @brief Returns the internal heap statistics.
+         *
+         * @param[out] rStats The buffer receiving the statistics.
+         */
+        static void GetHeapStats(S_HALHeapStats& rStats) noexcept;
+
+        /**
+         * @brief Computes a CRC32.
+         *
+         * @details Computes the little-endian CRC32 used by the zlib. The
+         * seed is the CRC of the previous data, 0 for the first call.
+         *
+         * @param[in] kSeed The CRC of the previous data.
+         * @param[in] kpData The data to compute.
+         * @param[in] kSize The size of the data in bytes.
+         *
+         * @return The CRC is returned.
+         */
+        static uint32_t Crc32(const uint32_t kSeed,
+                              const uint8_t* kpData,
+                              const size_t   kSize) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /* None */
+};
+
+#endif /* #ifndef __HAL_H__ */
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * @file HALNative.h
+ *
+ * @see HALNative.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Hardware abstraction layer, host simulator backend.
+ *
+ * @details Hardware abstraction layer, host simulator backend. The tasks are
+ * host threads, the locks and queues are built on the standard library and
+ * the storage is a directory of the host. This file is only included by
+ * HAL.h when HAL_NATIVE is set.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __HAL_NATIVE_H__
+#define __HAL_NATIVE_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>  /* Standard atomic types */
+#include <string>  /* Standard strings */
+#include <cstdint> /* Standard integer definitions */
+#include <cstddef> /* Standard size type */
+#include <fcntl.h> /* File open flags */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Duration of a scheduler tick in nanoseconds. */
+#define HAL_TICK_NS 1000000ULL
+
+/** @brief Highest task priority, the priorities are not applied. */
+#define HAL_MAX_PRIORITY 24
+
+/** @brief Spin lock initializer, usable for static locks. */
+#define HAL_SPINLOCK_INITIALIZER {ATOMIC_FLAG_INIT}
+
+/** @brief Size of a task name, with its terminator. */
+#define HAL_TASK_NAME_SIZE 16
+
+#ifndef HAL_NATIVE_STORAGE_ROOT
+/** @brief Host directory holding the simulated storage. */
+#define HAL_NATIVE_STORAGE_ROOT "native_storage"
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief File open flags, same as the SD card driver. */
+typedef int oflag_t;
+
+/** @brief Simulated task, defined by the backend. */
+struct S_HALNativeTask;
+/** @brief Simulated mutex, defined by the backend. */
+struct S_HALNativeMutex;
+/** @brief Simulated queue, defined by the backend. */
+struct S_HALNativeQueue;
+
+/** @brief Task handle. */
+typedef S_HALNativeTask* T_HALTask;
+/** @brief Mutex handle, the simulated mutexes are recursive. */
+typedef S_HALNativeMutex* T_HALMutex;
+/** @brief Queue handle. */
+typedef S_HALNativeQueue* T_HALQueue;
+/** @brief Scheduler tick count, in nanoseconds on the host. */
+typedef uint64_t T_HALTick;
+
+/** @brief Spin lock. */
+typedef struct {
+    /** @brief The lock flag, set while held. */
+    std::atomic_flag flag;
+} T_HALSpinLock;
+
+/** @brief Simulated storage device. */
+typedef struct {
+    /** @brief The host directory of the storage. */
+    std::string root;
+} T_HALStorageDevice;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The HALNativeFile class.
+ *
+ * @details The HALNativeFile class is a host file with the subset of the SD
+ * card driver file interface used by the modules. As for the driver, the
+ * copies share the descriptor and the file is only closed by close().
+ */
+class HALNativeFile {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief HALNativeFile constructor, the file is not opened.
+         */
+        HALNativeFile(void) noexcept;
+
+        /**
+         * @brief Opens a file.
+         *
+         * @param[in] kpPath The host path of the file.
+         * @param[in] kFlags The open flags.
+         *
+         * @return true is returned when the file is opened.
+         */
+        bool open(const char* kpPath, const oflag_t kFlags) noexcept;
+
+        /**
+         * @brief Tells if the file is opened.
+         *
+         * @return true is returned when the file is opened.
+         */
+        bool isOpen(void) const noexcept;
+
+        /**
+         * @brief Closes the file.
+         *
+         * @return true is returned when the file is closed.
+         */
+        bool close(void) noexcept;
+
+        /**
+         * @brief Reads from the current position.
+         *
+         * @param[out] pBuffer The buffer receiving the data.
+         * @param[in] kSize The size to read in bytes.
+         *
+         * @return The read size is returned, -1 on error.
+         */
+        int read(void* pBuffer, const size_t kSize) noexcept;
+
+        /**
+         * @brief Writes at the current position.
+         *
+         * @param[in] kpBuffer The data to write.
+         * @param[in] kSize The size to write in bytes.
+         *
+         * @return The written size is returned.
+         */
+        size_t write(const void* kpBuffer, const size_t kSize) noexcept;
+
+        /**
+         * @brief Sets the current position.
+         *
+         * @param[in] kPosition The position from the start in bytes.
+         *
+         * @return true is returned on success.
+         */
+        bool seekSet(const uint64_t kPosition) noexcept;
+
+        /**
+         * @brief Returns the file size.
+         *
+         * @return The file size in bytes is returned.
+         */
+        uint64_t size(void) const noexcept;
+
+        /**
+         * @brief Writes the file data to the host storage.
+         *
+         * @return true is returned on success.
+         */
+        bool sync(void) noexcept;
+
+        /**
+         * @brief Truncates the file.
+         *
+         * @param[in] kSize The new size in bytes.
+         *
+         * @return true is returned on success.
+         */
+        bool truncate(const uint64_t kSize) noexcept;
+
+        /**
+         * @brief Returns the error of the last operation.
+         *
+         * @return The host error number is returned, 0 without error.
+         */
+        int getError(void) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The host file descriptor, -1 when closed. */
+        int _fd;
+        /** @brief The error of the last operation. */
+        int _error;
+};
+
+/** @brief Storage file. */
+typedef HALNativeFile T_HALFile;
+
+#endif /* #ifndef __HAL_NATIVE_H__ */
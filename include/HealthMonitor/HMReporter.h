@@ -23,8 +23,10 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <string>  /* Standard string */
-#include <cstdint> /* Standard types */
+#include <atomic>       /* Standard atomic types */
+#include <string>       /* Standard string */
+#include <cstdint>      /* Standard types */
+#include <MemoryPool.h> /* Health monitor memory pool */
 
 /*******************************************************************************
  * CONSTANTS
@@ -53,6 +55,18 @@ typedef enum {
     HM_DISABLED
 } E_HMStatus;
 
+/** @brief Defines the states of an asynchronous health check. */
+typedef enum {
+    /** @brief No check in progress */
+    HM_CHECK_IDLE,
+    /** @brief Check queued or running on the checks task */
+    HM_CHECK_RUNNING,
+    /** @brief Check result being applied by the checks task */
+    HM_CHECK_COMPLETING,
+    /** @brief Check exceeded its budget, its result will be discarded */
+    HM_CHECK_TIMED_OUT
+} E_HMCheckState;
+
 /** @brief Defines the HM reporter parameters. */
 typedef struct {
     /** @brief The health check period in nanoseconds. */
@@ -140,6 +154,76 @@ class HMReporter
          */
         void HealthCheck(const uint64_t kTime) noexcept;
 
+        /**
+         * @brief Schedules an asynchronous health check.
+         *
+         * @details Schedules an asynchronous health check. If the check is due
+         * and no check is in progress, the check is marked running and the
+         * caller must have it executed with ExecuteCheck.
+         *
+         * @param[in] kTime The current time for the check.
+         *
+         * @return The function returns true if the check must be executed,
+         * false otherwise.
+         */
+        bool ScheduleCheck(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Executes a scheduled health check.
+         *
+         * @details Executes a scheduled health check and applies its result,
+         * unless the check exceeded its budget in the meantime.
+         */
+        void ExecuteCheck(void) noexcept;
+
+        /**
+         * @brief Enforces the time budget of the running check.
+         *
+         * @details Enforces the time budget of the running check. A check
+         * that exceeds its budget is accounted as failed and its result is
+         * discarded once it completes.
+         *
+         * @param[in] kTime The current time.
+         */
+        void EnforceCheckBudget(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Cancels the scheduled health check.
+         *
+         * @details Cancels the scheduled health check. Called when the
+         * reporter is removed while a check was scheduled.
+         */
+        void CancelCheck(void) noexcept;
+
+        /**
+         * @brief Cancels the scheduled action.
+         *
+         * @details Cancels the scheduled action. Called when the reporter is
+         * removed once its pending action was cancelled, the next failed
+         * check schedules a new action.
+         */
+        void CancelAction(void) noexcept;
+
+        /**
+         * @brief Sets the time budget of the asynchronous checks.
+         *
+         * @details Sets the time budget of the asynchronous checks. The
+         * budget defaults to the check period.
+         *
+         * @param[in] kBudgetNs The budget in nanoseconds.
+         */
+        void SetCheckBudget(const uint64_t kBudgetNs) noexcept;
+
+        /**
+         * @brief Returns the number of checks that exceeded their budget.
+         *
+         * @details Returns the number of checks that exceeded their budget
+         * since the object exists.
+         *
+         * @return Returns the number of checks that exceeded their budget.
+         */
+        uint32_t GetTimedOutCount(void) const noexcept;
+
         /**
          * @brief Execute the current action.
          *
@@ -184,7 +268,18 @@ class HMReporter
          *
          * @return Returns the name of the monitored item.
          */
-        const std::string& GetName(void) const noexcept;
+        const HMString& GetName(void) const noexcept;
+
+        /**
+         * @brief Returns the time of the next check.
+         *
+         * @details Returns the time in nanoseconds after which the next check
+         * will be performed. While a check is running, the time at which its
+         * budget expires is returned.
+         *
+         * @return Returns the time of the next check.
+         */
+        uint64_t GetNextCheck(void) const noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -237,11 +332,29 @@ class HMReporter
         /** @brief The number of failure since the object exists. */
         uint64_t _totalFailCount;
         /** @brief The name of the reporter. */
-        std::string _name;
+        HMString _name;
         /** @brief The current health status. */
         E_HMStatus _status;
         /** @brief Tells if an action is running to manage the status. */
         bool _hasRunningAction;
+        /** @brief The state of the asynchronous check. */
+        std::atomic<uint8_t> _checkState;
+        /** @brief The time at which the asynchronous check was scheduled. */
+        uint64_t _checkStartNs;
+        /** @brief The time budget of the asynchronous checks. */
+        uint64_t _checkBudgetNs;
+        /** @brief The number of checks that exceeded their budget. */
+        uint32_t _timedOutCount;
+
+        /**
+         * @brief Applies a health check result.
+         *
+         * @details Applies a health check result. Updates the failure count
+         * and the status and adds the HM action if necessary.
+         *
+         * @param[in] kIsPassed Tells if the check passed.
+         */
+        void ApplyResult(const bool kIsPassed) noexcept;
 };
 
 #endif /* #ifndef __HM_REPORTER_H__ */
\ No newline at end of file
@@ -24,10 +24,10 @@
  * INCLUDES
  ******************************************************************************/
 #include <Errors.h>          /* Errors definitions */
-#include <Arduino.h>         /* Arduino framework */
+#include <HAL.h>             /* Hardware abstraction layer */
 #include <Timeout.h>         /* Timeout services */
 #include <HMReporter.h>      /* HM Reporters */
-#include <unordered_map>     /* Standard unordered map */
+#include <atomic>            /* Standard atomic types */
 #include <SystemState.h>     /* System State manager */
 
 /*******************************************************************************
@@ -36,6 +36,48 @@
 /** @brief Defines the real-time task period in nanoseconds. */
 #define HW_RT_TASK_PERIOD_NS 100000000ULL
 
+#ifndef HM_MAX_WATCHDOGS
+/** @brief Defines the maximal number of registered watchdogs. */
+#define HM_MAX_WATCHDOGS 64
+#endif
+
+#ifndef HM_MAX_REPORTERS
+/** @brief Defines the maximal number of registered HM reporters. */
+#define HM_MAX_REPORTERS 32
+#endif
+
+#ifndef HM_MAX_PENDING_ACTIONS
+/**
+ * @brief Defines the maximal number of pending HM actions. Actions are
+ * coalesced per reporter, this bounds the number of distinct reporters waiting
+ * for their action.
+ */
+#define HM_MAX_PENDING_ACTIONS HM_MAX_REPORTERS
+#endif
+
+#ifndef HM_REPORTER_NAME_SIZE
+/** @brief Defines the size of the reporter names in the status snapshots. */
+#define HM_REPORTER_NAME_SIZE 24
+#endif
+
+/** @brief Defines the capacity of the watchdogs deadlines heap. */
+#define HM_WD_EVENTS_CAPACITY (2 * HM_MAX_WATCHDOGS)
+/** @brief Defines the number of words of the pending watchdogs mask. */
+#define HM_WD_PENDING_WORDS ((HM_MAX_WATCHDOGS + 31) / 32)
+
+#ifndef HM_RT_TASK_TICKLESS
+/**
+ * @brief Set to 1 to wake the real-time task on the next watchdog or reporter
+ * deadline instead of every period.
+ */
+#define HM_RT_TASK_TICKLESS 0
+#endif
+
+#ifndef HM_RT_TASK_MAX_SLEEP_NS
+/** @brief Defines the maximal real-time task sleep time in tickless mode. */
+#define HM_RT_TASK_MAX_SLEEP_NS 1000000000ULL
+#endif
+
 /*******************************************************************************
  * MACROS
  ******************************************************************************/
@@ -44,7 +86,94 @@
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-/* None */
+/** @brief Watchdog deadline entry of the watchdogs heap. */
+typedef struct {
+    /** @brief The watchdog deadline when the entry was scheduled. */
+    uint64_t deadline;
+    /** @brief The watchdog identifier. */
+    uint32_t id;
+    /** @brief The watchdog registry slot. */
+    uint16_t slot;
+} S_WatchdogEvent;
+
+/**
+ * @brief Watchdog registry slot. The timeout is published before the
+ * identifier and the identifier is revoked before the timeout.
+ */
+typedef struct {
+    /** @brief The registered timeout, nullptr when the slot is free. */
+    std::atomic<Timeout*> pTimeout;
+    /** @brief The watchdog identifier, HM_INVALID_ID when not published. */
+    std::atomic<uint32_t> id;
+} S_WatchdogSlot;
+
+/** @brief Pending HM action entry. */
+typedef struct {
+    /** @brief The reporter embedding the action to execute. */
+    HMReporter* pReporter;
+    /** @brief The health status that triggered the action. */
+    E_HMStatus severity;
+    /** @brief The scheduling order of the action, FIFO within a severity. */
+    uint32_t sequence;
+} S_HMAction;
+
+/** @brief HM actions scheduler accounting. */
+typedef struct {
+    /** @brief Number of actions waiting to be executed. */
+    uint32_t pending;
+    /** @brief Number of actions being executed. */
+    uint32_t running;
+    /** @brief Number of actions executed. */
+    uint32_t executed;
+    /** @brief Number of requests merged into an already pending action. */
+    uint32_t coalesced;
+    /** @brief Number of requests rejected because the scheduler was full. */
+    uint32_t dropped;
+} S_HMActionStats;
+
+/** @brief HM watchdogs check accounting, in CPU cycles. */
+typedef struct {
+    /** @brief Number of measured watchdogs checks. */
+    uint32_t count;
+    /** @brief Cycles of the fastest check. */
+    uint32_t minCycles;
+    /** @brief Cycles of the slowest check. */
+    uint32_t maxCycles;
+    /** @brief Cycles of all the measured checks. */
+    uint64_t totalCycles;
+    /** @brief Number of scheduled watchdog events after the last check. */
+    uint32_t events;
+    /** @brief Number of reporter checks dropped on a full checks queue. */
+    uint32_t droppedChecks;
+} S_HMCheckStats;
+
+/** @brief HM reporter status snapshot. */
+typedef struct {
+    /** @brief The reporter name, truncated to HM_REPORTER_NAME_SIZE - 1. */
+    char pName[HM_REPORTER_NAME_SIZE];
+    /** @brief The reporter health status. */
+    E_HMStatus status;
+    /** @brief The number of consecutive failed checks. */
+    uint32_t failures;
+    /** @brief The number of failed checks since the registration. */
+    uint64_t totalFailures;
+} S_HMReporterStatus;
+
+/** @brief Asynchronous reporter check request. */
+typedef struct {
+    /** @brief The reporter registry slot. */
+    uint32_t slot;
+    /** @brief The reporter identifier when the check was scheduled. */
+    uint32_t id;
+} S_HMCheckRequest;
+
+/** @brief HM reporter registry slot, published like the watchdog slots. */
+typedef struct {
+    /** @brief The registered reporter, nullptr when the slot is free. */
+    std::atomic<HMReporter*> pReporter;
+    /** @brief The reporter identifier, HM_INVALID_ID when not published. */
+    std::atomic<uint32_t> id;
+} S_ReporterSlot;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -157,13 +286,56 @@ class HealthMonitor
          * @brief Adds an HM action to execute.
          *
          * @details Adds an HM action to execute. The action is provided by the
-         * HM Reporter and is executed in a concurent thread.
+         * HM Reporter and is executed in a concurent thread. A reporter has at
+         * most one pending action: a new request for a pending reporter is
+         * merged and keeps the highest severity. Unhealthy actions are
+         * executed before degraded ones.
          *
          * @param[in] pReporter The reporter embedding the action to execute.
+         * @param[in] kSeverity The health status that triggered the action.
          *
          * @return The function returns the success or error status.
+         * ERR_HM_FULL is returned when HM_MAX_PENDING_ACTIONS distinct
+         * reporters are already waiting.
+         */
+        E_Return AddHMAction(HMReporter*      pReporter,
+                             const E_HMStatus kSeverity) noexcept;
+
+        /**
+         * @brief Returns the HM actions scheduler accounting.
+         *
+         * @details Returns the HM actions scheduler accounting.
+         *
+         * @param[out] rStats The accounting to fill.
          */
-        E_Return AddHMAction(HMReporter* pReporter) noexcept;
+        void GetActionStats(S_HMActionStats& rStats) noexcept;
+
+        /**
+         * @brief Returns the watchdogs check accounting.
+         *
+         * @details Returns the watchdogs check accounting. Each real-time
+         * task cycle measures the cycles spent checking the watchdogs.
+         *
+         * @param[out] rStats The accounting to fill.
+         * @param[in] kReset Tells if the accounting is restarted after the
+         * read.
+         */
+        void GetCheckStats(S_HMCheckStats& rStats, const bool kReset) noexcept;
+
+        /**
+         * @brief Returns the status of the registered reporters.
+         *
+         * @details Returns the status of the registered reporters. The
+         * registrations are locked while the snapshot is taken.
+         *
+         * @param[out] pStatus The snapshots buffer.
+         * @param[in] kMaxCount The number of snapshots the buffer can hold.
+         *
+         * @return The number of filled snapshots is returned, 0 if the
+         * registrations lock could not be acquired.
+         */
+        uint32_t GetReportersStatus(S_HMReporterStatus* pStatus,
+                                    const uint32_t      kMaxCount) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -194,20 +366,143 @@ class HealthMonitor
         static void HMActionTaskRoutine(void* pHealthMonitor) noexcept;
 
         /**
-         * @brief Checks each watchdogs registered.
+         * @brief Removes the most urgent pending HM action.
+         *
+         * @details Removes the most urgent pending HM action and marks it as
+         * running: highest severity first, oldest first within a severity.
          *
-         * @details Checks each watchdogs registered. If a watchdog is trigerred
-         * the handling function is called.
+         * @param[out] rpReporter The reporter embedding the action to execute.
+         *
+         * @return The function returns true if an action was pending, false
+         * otherwise.
+         */
+        bool PopHMAction(HMReporter*& rpReporter) noexcept;
+
+        /**
+         * @brief Cancels the HM action of a reporter.
+         *
+         * @details Cancels the pending HM action of a reporter and waits for
+         * its running action to end.
+         *
+         * @param[in] pReporter The reporter whose action is cancelled.
          */
-        void CheckWatchdogs(void) const noexcept;
+        void CancelHMAction(const HMReporter* pReporter) noexcept;
+
+        /**
+         * @brief HM checks task.
+         *
+         * @details HM checks task. Executes the reporters checks scheduled by
+         * the real-time task, which only enforces their time budget.
+         *
+         * @param[in] pHealthMonitor The health monitor instance to be used by
+         * the task.
+         */
+        static void HMChecksTaskRoutine(void* pHealthMonitor) noexcept;
+
+        /**
+         * @brief Publishes the health summary in the system state.
+         *
+         * @details Publishes the health summary in the system state. Called
+         * by the checks task after each check, the readers of the summary
+         * do not take the reporters lock.
+         */
+        void PublishHealth(void) noexcept;
+
+        /**
+         * @brief Checks the expired watchdogs.
+         *
+         * @details Checks the expired watchdogs. The newly published
+         * watchdogs are scheduled first, then only the watchdogs whose
+         * scheduled deadline passed are visited. If a watchdog is trigerred
+         * the handling function is called. No lock is taken.
+         *
+         * @param[in] kTime The time of the check cycle in nanoseconds.
+         *
+         * @return The function returns the earliest scheduled watchdog
+         * deadline, UINT64_MAX if none.
+         */
+        uint64_t CheckWatchdogs(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Orders the watchdogs heap by earliest deadline.
+         *
+         * @param[in] krFirst The first watchdog event to compare.
+         * @param[in] krSecond The second watchdog event to compare.
+         *
+         * @return The function returns true if the first event's deadline is
+         * after the second one.
+         */
+        static bool IsLaterWatchdogEvent(const S_WatchdogEvent& krFirst,
+                                         const S_WatchdogEvent& krSecond)
+        noexcept;
+
+        /**
+         * @brief Gets the timeout of a watchdog event.
+         *
+         * @details Gets the timeout of a watchdog event if the event's
+         * watchdog is still registered.
+         *
+         * @param[in] krEvent The watchdog event.
+         *
+         * @return The function returns the timeout or nullptr if the watchdog
+         * was removed.
+         */
+        Timeout* GetEventTimeout(const S_WatchdogEvent& krEvent) const noexcept;
+
+        /**
+         * @brief Schedules a watchdog event.
+         *
+         * @details Schedules a watchdog event in the deadlines heap. When the
+         * heap is full, the events of the removed watchdogs are purged. Only
+         * called by the real-time task.
+         *
+         * @param[in] krEvent The watchdog event to schedule.
+         */
+        void ScheduleWatchdogEvent(const S_WatchdogEvent& krEvent) noexcept;
+
+        /**
+         * @brief Waits for the running checks to complete.
+         *
+         * @details Waits for the running real-time task checks to complete.
+         * Once a watchdog or reporter is unpublished, this ensures the
+         * real-time task no longer uses it.
+         */
+        void WaitChecksDone(void) const noexcept;
 
         /**
          * @brief Checks each health reporter registered.
          *
-         * @details Checks each health reporter registered. This will update
-         * their check time and status in case of failure.
+         * @details Checks each health reporter registered. The due checks are
+         * scheduled on the checks task and the running checks exceeding their
+         * budget are accounted as failed. A check that does not fit in the
+         * checks queue is dropped and accounted. No lock is taken.
+         *
+         * @param[in] kTime The time of the check cycle in nanoseconds.
+         *
+         * @return The function returns the earliest next reporter check time,
+         * UINT64_MAX if none.
+         */
+        uint64_t CheckReporters(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Accounts a watchdogs check.
+         *
+         * @details Accounts a watchdogs check in the checks accounting.
+         *
+         * @param[in] kCycles The cycles spent checking the watchdogs.
+         */
+        void AccountCheck(const uint32_t kCycles) noexcept;
+
+        /**
+         * @brief Waits for the next real-time task event.
+         *
+         * @details Waits for the next real-time task event in tickless mode.
+         * The task sleeps until the next deadline, at most
+         * HM_RT_TASK_MAX_SLEEP_NS, or until a registration notifies it.
+         *
+         * @param[in] kNextEvent The time of the next event in nanoseconds.
          */
-        void CheckReporters(void) const noexcept;
+        void WaitNextEvent(const uint64_t kNextEvent) noexcept;
 
         /**
          * @brief Initializes the hardware real-time task.
@@ -224,6 +519,13 @@ class HealthMonitor
          */
         void ActionsTaskInit(void) noexcept;
 
+        /**
+         * @brief Initializes the checks task.
+         *
+         * @details  Initializes the checks task. On error, a reboot is issued.
+         */
+        void ChecksTaskInit(void) noexcept;
+
         /**
          * @brief Handles the HM Real Time task watchdog trigger.
          *
@@ -233,23 +535,55 @@ class HealthMonitor
         static void DeadlineMissHandler(void) noexcept;
 
         /** @brief Real-time task handle. */
-        TaskHandle_t _RTTaskHandle;
+        T_HALTask _RTTaskHandle;
         /** @brief Actions task handle. */
-        TaskHandle_t _actionsTaskHandle;
-        /** @brief Map that contains the watchdogs */
-        std::unordered_map<uint32_t, Timeout*> _watchdogs;
-        /** @brief Map that contains the HM reporters */
-        std::unordered_map<uint32_t, HMReporter*> _reporters;
+        T_HALTask _actionsTaskHandle;
+        /** @brief Checks task handle. */
+        T_HALTask _checksTaskHandle;
+        /** @brief Registry slots of the watchdogs. */
+        S_WatchdogSlot _wdSlots[HM_MAX_WATCHDOGS];
+        /** @brief Mask of the watchdog slots published since the last check. */
+        std::atomic<uint32_t> _wdPending[HM_WD_PENDING_WORDS];
+        /**
+         * @brief Min-heap of the watchdogs deadlines, owned by the real-time
+         * task. Timeouts only postpone their deadline when notified, the
+         * scheduled deadline is a lower bound refreshed when the entry expires.
+         */
+        S_WatchdogEvent _wdEvents[HM_WD_EVENTS_CAPACITY];
+        /** @brief Number of events in the watchdogs deadlines heap. */
+        uint32_t _wdEventsCount;
+        /** @brief Registry slots of the HM reporters. */
+        S_ReporterSlot _reporterSlots[HM_MAX_REPORTERS];
+        /** @brief Real-time checks sequence, odd while checking. */
+        std::atomic<uint32_t> _checkSequence;
         /** @brief Last watchdog ID provided. */
         uint32_t _lastWDId;
         /** @brief Last reporter ID provided. */
         uint32_t _lastReporterId;
-        /** @brief Stores the watchdogs mutex. */
-        SemaphoreHandle_t _wdLock;
-        /** @brief Stores the reporters mutex. */
-        SemaphoreHandle_t _reportersLock;
-        /** @brief The HM actions queue */
-        QueueHandle_t _actionsQueue;
+        /** @brief Stores the watchdogs registration mutex. */
+        T_HALMutex _wdLock;
+        /** @brief Stores the reporters registration mutex. */
+        T_HALMutex _reportersLock;
+        /** @brief HM actions scheduler lock, taken for a few instructions. */
+        T_HALSpinLock _actionsLock;
+        /** @brief The pending HM actions, at most one per reporter. */
+        S_HMAction _pendingActions[HM_MAX_PENDING_ACTIONS];
+        /** @brief The number of pending HM actions. */
+        uint32_t _pendingActionsCount;
+        /** @brief The next HM action sequence number. */
+        uint32_t _actionsSequence;
+        /** @brief The reporter whose action is running, nullptr if none. */
+        const HMReporter* _pRunningAction;
+        /** @brief The HM actions scheduler accounting. */
+        S_HMActionStats _actionStats;
+        /** @brief Watchdogs check accounting lock. */
+        T_HALSpinLock _checkStatsLock;
+        /** @brief The watchdogs check accounting. */
+        S_HMCheckStats _checkStats;
+        /** @brief The HM checks queue */
+        T_HALQueue _checksQueue;
+        /** @brief The reporter slot being checked, HM_MAX_REPORTERS if none. */
+        std::atomic<uint32_t> _checkingSlot;
         /** @brief Deadline miss manager. */
         Timeout* _pTimeout;
 };
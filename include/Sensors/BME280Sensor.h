@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * @file BME280Sensor.h
+ *
+ * @see BME280Sensor.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief BME280 temperature, humidity and pressure sensor driver.
+ *
+ * @details BME280 temperature, humidity and pressure sensor driver. The sensor
+ * runs in normal mode and the eight measurement registers are read in a
+ * single burst, then compensated with the factory calibration.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __BME280_SENSOR_H__
+#define __BME280_SENSOR_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+#include <Sensor.h> /* Sensor interface */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef BME280_PERIOD_NS
+/** @brief Defines the BME280 sampling period in nanoseconds. */
+#define BME280_PERIOD_NS 1000000000ULL
+#endif
+
+#ifndef BME280_SPI_CLOCK_HZ
+/** @brief Defines the BME280 SPI clock in Hz. */
+#define BME280_SPI_CLOCK_HZ 8000000
+#endif
+
+/** @brief Defines the BME280 default I2C address. */
+#define BME280_I2C_ADDRESS 0x76
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief BME280 factory calibration. */
+typedef struct {
+    /** @brief Temperature calibration. */
+    uint16_t t1;
+    int16_t  t2;
+    int16_t  t3;
+    /** @brief Pressure calibration. */
+    uint16_t p1;
+    int16_t  p2;
+    int16_t  p3;
+    int16_t  p4;
+    int16_t  p5;
+    int16_t  p6;
+    int16_t  p7;
+    int16_t  p8;
+    int16_t  p9;
+    /** @brief Humidity calibration. */
+    uint8_t  h1;
+    int16_t  h2;
+    uint8_t  h3;
+    int16_t  h4;
+    int16_t  h5;
+    int8_t   h6;
+} S_BME280Calibration;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The BME280Sensor class.
+ *
+ * @details The BME280Sensor class drives a BME280 on the SPI or the I2C bus.
+ * Each read produces a temperature, a humidity and a pressure sample.
+ */
+class BME280Sensor : public Sensor {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief BME280Sensor constructor.
+         *
+         * @param[in] kBus The bus of the sensor.
+         * @param[in] kDevice The SPI chip select GPIO or the I2C address.
+         */
+        BME280Sensor(const E_SensorBus kBus, const uint8_t kDevice) noexcept;
+
+        /**
+         * @brief BME280Sensor destructor.
+         */
+        virtual ~BME280Sensor(void) noexcept;
+
+        /** @brief See Sensor.h */
+        virtual E_Return Init(void) noexcept;
+
+        /** @brief See Sensor.h */
+        virtual void GetTransfer(S_SensorTransfer& rTransfer) const noexcept;
+
+        /** @brief See Sensor.h */
+        virtual uint32_t Decode(const uint8_t*  kpFrame,
+                                S_SensorSample* pSamples) noexcept;
+
+        /**
+         * @brief Compensates a raw measurement.
+         *
+         * @param[in] krCalib The factory calibration.
+         * @param[in] kpFrame The burst read of the measurement registers.
+         * @param[out] rTemperature The temperature in degrees Celsius.
+         * @param[out] rHumidity The relative humidity in percent.
+         * @param[out] rPressure The pressure in hectopascals.
+         *
+         * @return true if the frame holds a valid measurement.
+         */
+        static bool Compensate(const S_BME280Calibration& krCalib,
+                               const uint8_t*             kpFrame,
+                               float&                     rTemperature,
+                               float&                     rHumidity,
+                               float&                     rPressure) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Reads consecutive registers of the sensor.
+         *
+         * @param[in] kReg The first register.
+         * @param[out] pBuffer The buffer receiving the registers.
+         * @param[in] kSize The number of registers.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return ReadRegisters(const uint8_t kReg,
+                               uint8_t*      pBuffer,
+                               const uint8_t kSize) noexcept;
+
+        /**
+         * @brief Writes a register of the sensor.
+         *
+         * @param[in] kReg The register.
+         * @param[in] kValue The value.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return WriteRegister(const uint8_t kReg,
+                               const uint8_t kValue) noexcept;
+
+        /** @brief The transfer describing the device. */
+        S_SensorTransfer _transfer;
+        /** @brief The factory calibration. */
+        S_BME280Calibration _calib;
+};
+
+#endif /* #ifndef __BME280_SENSOR_H__ */
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * @file ChipTempSensor.h
+ *
+ * @see ChipTempSensor.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief On-chip temperature sensor driver.
+ *
+ * @details On-chip temperature sensor driver. The die temperature follows the
+ * enclosure temperature and the compute load, it is sampled for the health
+ * reports.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __CHIP_TEMP_SENSOR_H__
+#define __CHIP_TEMP_SENSOR_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+#include <Sensor.h> /* Sensor interface */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef CHIP_TEMP_PERIOD_NS
+/** @brief Defines the on-chip temperature sampling period in nanoseconds. */
+#define CHIP_TEMP_PERIOD_NS 5000000000ULL
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The ChipTempSensor class.
+ *
+ * @details The ChipTempSensor class reads the ESP32 internal temperature
+ * sensor. The sensor has no bus transfer.
+ */
+class ChipTempSensor : public Sensor {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief ChipTempSensor constructor.
+         */
+        ChipTempSensor(void) noexcept;
+
+        /**
+         * @brief ChipTempSensor destructor.
+         */
+        virtual ~ChipTempSensor(void) noexcept;
+
+        /** @brief See Sensor.h */
+        virtual E_Return Init(void) noexcept;
+
+        /** @brief See Sensor.h */
+        virtual void GetTransfer(S_SensorTransfer& rTransfer) const noexcept;
+
+        /** @brief See Sensor.h */
+        virtual uint32_t Decode(const uint8_t*  kpFrame,
+                                S_SensorSample* pSamples) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /* None */
+};
+
+#endif /* #ifndef __CHIP_TEMP_SENSOR_H__ */
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * @file Sensor.h
+ *
+ * @see Sensor.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Sensor driver interface.
+ *
+ * @details Sensor driver interface. A sensor describes the bus transfer that
+ * reads all its measurement registers at once and decodes the received frame
+ * into samples. The bus accesses are performed by the sensor engine.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __SENSOR_H__
+#define __SENSOR_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <cstddef>  /* Standard size type */
+#include <Errors.h> /* Errors definitions */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef SENSOR_MAX_TRANSFER_SIZE
+/** @brief Defines the maximal size of a sensor frame in bytes. */
+#define SENSOR_MAX_TRANSFER_SIZE 32
+#endif
+
+#ifndef SENSOR_MAX_CHANNELS
+/** @brief Defines the maximal number of samples decoded per read. */
+#define SENSOR_MAX_CHANNELS 4
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the sensor buses. */
+typedef enum {
+    /** @brief On-chip sensor, no bus transfer. */
+    SENSOR_BUS_NONE = 0,
+    /** @brief Shared SPI bus. */
+    SENSOR_BUS_SPI = 1,
+    /** @brief I2C bus. */
+    SENSOR_BUS_I2C = 2
+} E_SensorBus;
+
+/** @brief Defines the measured quantities. */
+typedef enum {
+    /** @brief Temperature in degrees Celsius. */
+    SENSOR_QTY_TEMPERATURE = 0,
+    /** @brief Relative humidity in percent. */
+    SENSOR_QTY_HUMIDITY = 1,
+    /** @brief Pressure in hectopascals. */
+    SENSOR_QTY_PRESSURE = 2,
+    /** @brief Number of quantities. */
+    SENSOR_QTY_MAX
+} E_SensorQuantity;
+
+/** @brief Sensor sample. */
+typedef struct {
+    /** @brief The acquisition time in nanoseconds. */
+    uint64_t time;
+    /** @brief The measured value. */
+    float value;
+    /** @brief The identifier of the sensor in the engine. */
+    uint8_t sensorId;
+    /** @brief The measured quantity, see E_SensorQuantity. */
+    uint8_t quantity;
+} S_SensorSample;
+
+/** @brief Sensor bus transfer. */
+typedef struct {
+    /** @brief The bus of the sensor. */
+    E_SensorBus bus;
+    /** @brief The SPI chip select GPIO or the I2C device address. */
+    uint8_t device;
+    /** @brief The first register to read. */
+    uint8_t reg;
+    /** @brief The number of bytes to read. */
+    uint8_t size;
+    /** @brief The SPI clock or the I2C clock in Hz. */
+    uint32_t clockHz;
+    /** @brief The SPI mode. */
+    uint8_t spiMode;
+} S_SensorTransfer;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The Sensor interface.
+ *
+ * @details The Sensor interface. The engine reads the transfer frame of the
+ * due sensors in a single bus acquisition, then the sensors decode their
+ * frame. Decoding must not block nor allocate memory.
+ */
+class Sensor {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Sensor constructor.
+         *
+         * @param[in] kpName The name of the sensor for the reports.
+         * @param[in] kPeriodNs The sampling period in nanoseconds.
+         */
+        Sensor(const char* kpName, const uint64_t kPeriodNs) noexcept;
+
+        /**
+         * @brief Sensor destructor.
+         */
+        virtual ~Sensor(void) noexcept;
+
+        /**
+         * @brief Initializes the sensor.
+         *
+         * @details Initializes the sensor. Called from the acquisition task
+         * when the sensor is started and after a failed health check. The
+         * sensor is configured and its calibration is read.
+         *
+         * @return The function returns the success or error status.
+         */
+        virtual E_Return Init(void) noexcept = 0;
+
+        /**
+         * @brief Returns the measurement transfer of the sensor.
+         *
+         * @param[out] rTransfer The transfer to perform at each sample.
+         */
+        virtual void GetTransfer(S_SensorTransfer& rTransfer) const noexcept
+            = 0;
+
+        /**
+         * @brief Decodes a measurement frame.
+         *
+         * @param[in] kpFrame The received frame, nullptr for on-chip
+         * sensors.
+         * @param[out] pSamples The decoded samples, SENSOR_MAX_CHANNELS at
+         * most. Only the values and the quantities are set.
+         *
+         * @return The number of decoded samples is returned, 0 if the frame
+         * is invalid.
+         */
+        virtual uint32_t Decode(const uint8_t*  kpFrame,
+                                S_SensorSample* pSamples) noexcept = 0;
+
+        /**
+         * @brief Returns the name of the sensor.
+         *
+         * @return The name of the sensor is returned.
+         */
+        const char* GetName(void) const noexcept;
+
+        /**
+         * @brief Returns the sampling period.
+         *
+         * @return The sampling period in nanoseconds is returned.
+         */
+        uint64_t GetPeriod(void) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The name of the sensor. */
+        const char* _kpName;
+        /** @brief The sampling period in nanoseconds. */
+        uint64_t _periodNs;
+};
+
+#endif /* #ifndef __SENSOR_H__ */
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * @file SensorBus.h
+ *
+ * @see SensorBus.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Sensor bus accesses.
+ *
+ * @details Sensor bus accesses. Burst register reads and writes on the shared
+ * SPI bus and on the I2C bus. The SPI bus is shared with the SD card and is
+ * granted by the storage bus lock.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __SENSOR_BUS_H__
+#define __SENSOR_BUS_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+#include <Sensor.h> /* Sensor transfers */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef SENSOR_BUS_TIMEOUT_NS
+/**
+ * @brief Defines the bus acquisition timeout in nanoseconds. A busy bus skips
+ * the acquisition cycle instead of delaying the other bus users.
+ */
+#define SENSOR_BUS_TIMEOUT_NS 5000000ULL
+#endif
+
+#ifndef SENSOR_I2C_CLOCK_HZ
+/** @brief Defines the I2C bus clock in Hz. */
+#define SENSOR_I2C_CLOCK_HZ 400000
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The SensorBus class.
+ *
+ * @details The SensorBus class performs the sensors transfers. A register
+ * read is a single bus transaction: the SPI frame is clocked in one transfer
+ * and the I2C read uses a repeated start. The reads and writes must be done
+ * while the bus is acquired. Only the acquisition task uses the I2C bus.
+ */
+class SensorBus {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Prepares the bus and the device of a sensor.
+         *
+         * @details Prepares the bus and the device of a sensor. The SPI chip
+         * select is released and the I2C bus is started on first use.
+         *
+         * @param[in] krTransfer The transfer of the sensor.
+         */
+        static void Setup(const S_SensorTransfer& krTransfer) noexcept;
+
+        /**
+         * @brief Acquires a bus.
+         *
+         * @param[in] kBus The bus to acquire.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return Acquire(const E_SensorBus kBus) noexcept;
+
+        /**
+         * @brief Releases an acquired bus.
+         *
+         * @param[in] kBus The bus to release.
+         */
+        static void Release(const E_SensorBus kBus) noexcept;
+
+        /**
+         * @brief Reads consecutive registers.
+         *
+         * @param[in] krTransfer The transfer, its register and size are read.
+         * @param[out] pBuffer The buffer receiving krTransfer.size bytes.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return Read(const S_SensorTransfer& krTransfer,
+                             uint8_t*                pBuffer) noexcept;
+
+        /**
+         * @brief Writes a register.
+         *
+         * @param[in] krTransfer The transfer describing the device.
+         * @param[in] kReg The register to write.
+         * @param[in] kValue The value to write.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return Write(const S_SensorTransfer& krTransfer,
+                              const uint8_t           kReg,
+                              const uint8_t           kValue) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief Tells if the I2C bus was started. */
+        static bool _SI2CINIT;
+};
+
+#endif /* #ifndef __SENSOR_BUS_H__ */
@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * @file SensorDSP.h
+ *
+ * @see SensorDSP.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Sensor filtering kernels.
+ *
+ * @details Sensor filtering kernels. The kernels filter and derive blocks of
+ * values gathered from the acquisition ring, the filters state is kept
+ * between the blocks.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __SENSOR_DSP_H__
+#define __SENSOR_DSP_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+#include <Sensor.h> /* Sensor samples */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef DSP_MAX_WINDOW
+/** @brief Defines the maximal moving average window in samples. */
+#define DSP_MAX_WINDOW 32
+#endif
+
+#ifndef DSP_MAX_MEDIAN
+/** @brief Defines the maximal median window in samples, must be odd. */
+#define DSP_MAX_MEDIAN 7
+#endif
+
+#ifndef DSP_SEA_LEVEL_HPA
+/** @brief Defines the standard sea level pressure in hectopascals. */
+#define DSP_SEA_LEVEL_HPA 1013.25f
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Moving average filter state. */
+typedef struct {
+    /** @brief The last values, circular. */
+    float pWindow[DSP_MAX_WINDOW];
+    /** @brief The running sum of the window. */
+    float sum;
+    /** @brief The window size in samples. */
+    uint32_t size;
+    /** @brief The index of the oldest value. */
+    uint32_t index;
+    /** @brief The number of values in the window. */
+    uint32_t count;
+} S_DSPMovingAverage;
+
+/** @brief Median filter state. */
+typedef struct {
+    /** @brief The last values, circular. */
+    float pWindow[DSP_MAX_MEDIAN];
+    /** @brief The window size in samples. */
+    uint32_t size;
+    /** @brief The index of the oldest value. */
+    uint32_t index;
+    /** @brief The number of values in the window. */
+    uint32_t count;
+} S_DSPMedian;
+
+/** @brief Exponential smoothing filter state. */
+typedef struct {
+    /** @brief The smoothing factor in ]0, 1]. */
+    float alpha;
+    /** @brief The smoothed value. */
+    float value;
+    /** @brief Tells if the first value was filtered. */
+    bool isInit;
+} S_DSPEma;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The SensorDSP class.
+ *
+ * @details The SensorDSP class provides the block filtering kernels. The
+ * ring samples of a channel are first gathered in a contiguous array, the
+ * kernels then process the whole block. The block kernels keep a running
+ * sum, use sorting networks and polynomial logarithms where the scalar
+ * versions call the math library for each value. The input and output
+ * blocks may be the same array.
+ */
+class SensorDSP {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Gathers the values of a channel from a samples batch.
+         *
+         * @param[in] kpSamples The samples read from the ring.
+         * @param[in] kCount The number of samples.
+         * @param[in] kSensorId The sensor of the channel.
+         * @param[in] kQuantity The quantity of the channel.
+         * @param[out] pValues The gathered values.
+         * @param[in] kMaxCount The capacity of the values buffer.
+         *
+         * @return The number of gathered values is returned.
+         */
+        static uint32_t Gather(const S_SensorSample* kpSamples,
+                               const uint32_t        kCount,
+                               const uint8_t         kSensorId,
+                               const uint8_t         kQuantity,
+                               float*                pValues,
+                               const uint32_t        kMaxCount) noexcept;
+
+        /**
+         * @brief Initializes a moving average filter.
+         *
+         * @param[out] rState The filter state.
+         * @param[in] kSize The window size, up to DSP_MAX_WINDOW.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return InitMovingAverage(S_DSPMovingAverage& rState,
+                                          const uint32_t      kSize) noexcept;
+
+        /**
+         * @brief Filters a block with a moving average.
+         *
+         * @details Filters a block with a moving average. Until the window
+         * is full, the average of the received values is produced.
+         *
+         * @param[in, out] rState The filter state.
+         * @param[in] kpIn The input block.
+         * @param[out] pOut The output block.
+         * @param[in] kCount The number of values of the block.
+         */
+        static void MovingAverage(S_DSPMovingAverage& rState,
+                                  const float*        kpIn,
+                                  float*              pOut,
+                                  const uint32_t      kCount) noexcept;
+
+        /**
+         * @brief Initializes a median filter.
+         *
+         * @param[out] rState The filter state.
+         * @param[in] kSize The window size, odd and up to DSP_MAX_MEDIAN.
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return InitMedian(S_DSPMedian&   rState,
+                                   const uint32_t kSize) noexcept;
+
+        /**
+         * @brief Removes the spikes of a block with a median filter.
+         *
+         * @details Removes the spikes of a block with a median filter. Until
+         * the window is full, the values are passed through.
+         *
+         * @param[in, out] rState The filter state.
+         * @param[in] kpIn The input block.
+         * @param[out] pOut The output block.
+         * @param[in] kCount The number of values of the block.
+         */
+        static void Median(S_DSPMedian&   rState,
+                           const float*   kpIn,
+                           float*         pOut,
+                           const uint32_t kCount) noexcept;
+
+        /**
+         * @brief Initializes an exponential smoothing filter.
+         *
+         * @param[out] rState The filter state.
+         * @param[in] kAlpha The smoothing factor in ]0, 1].
+         *
+         * @return The function returns the success or error status.
+         */
+        static E_Return InitEma(S_DSPEma& rState, const float kAlpha) noexcept;
+
+        /**
+         * @brief Filters a block with an exponential smoothing.
+         *
+         * @param[in, out] rState The filter state.
+         * @param[in] kpIn The input block.
+         * @param[out] pOut The output block.
+         * @param[in] kCount The number of values of the block.
+         */
+        static void Ema(S_DSPEma&      rState,
+                        const float*   kpIn,
+                        float*         pOut,
+                        const uint32_t kCount) noexcept;
+
+        /**
+         * @brief Computes the dew point of a block.
+         *
+         * @details Computes the dew point of a block with the Magnus formula.
+         * The logarithm is approximated within 1e-5.
+         *
+         * @param[in] kpTemperature The temperatures in degrees Celsius.
+         * @param[in] kpHumidity The relative humidities in percent.
+         * @param[out] pOut The dew points in degrees Celsius.
+         * @param[in] kCount The number of values of the block.
+         */
+        static void DewPoint(const float*   kpTemperature,
+                             const float*   kpHumidity,
+                             float*         pOut,
+                             const uint32_t kCount) noexcept;
+
+        /**
+         * @brief Computes the pressure altitude of a block.
+         *
+         * @details Computes the pressure altitude of a block with the
+         * international barometric formula. The power is approximated
+         * within 1e-5.
+         *
+         * @param[in] kpPressure The pressures in hectopascals.
+         * @param[out] pOut The altitudes in meters.
+         * @param[in] kCount The number of values of the block.
+         * @param[in] kSeaLevel The sea level pressure in hectopascals.
+         */
+        static void PressureAltitude(const float*   kpPressure,
+                                     float*         pOut,
+                                     const uint32_t kCount,
+                                     const float    kSeaLevel =
+                                         DSP_SEA_LEVEL_HPA) noexcept;
+
+        /**
+         * @brief Computes the dew point of a single value.
+         *
+         * @param[in] kTemperature The temperature in degrees Celsius.
+         * @param[in] kHumidity The relative humidity in percent.
+         *
+         * @return The dew point in degrees Celsius is returned.
+         */
+        static float DewPointScalar(const float kTemperature,
+                                    const float kHumidity) noexcept;
+
+        /**
+         * @brief Computes the pressure altitude of a single value.
+         *
+         * @param[in] kPressure The pressure in hectopascals.
+         * @param[in] kSeaLevel The sea level pressure in hectopascals.
+         *
+         * @return The altitude in meters is returned.
+         */
+        static float PressureAltitudeScalar(const float kPressure,
+                                            const float kSeaLevel =
+                                                DSP_SEA_LEVEL_HPA) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Approximates the base 2 logarithm of a positive value.
+         *
+         * @param[in] kValue The value, must be normal and positive.
+         *
+         * @return The logarithm is returned.
+         */
+        static float FastLog2(const float kValue) noexcept;
+
+        /**
+         * @brief Approximates the base 2 exponential of a value.
+         *
+         * @param[in] kValue The value, in [-126, 127].
+         *
+         * @return The exponential is returned.
+         */
+        static float FastExp2(const float kValue) noexcept;
+};
+
+#endif /* #ifndef __SENSOR_DSP_H__ */
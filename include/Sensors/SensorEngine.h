@@ -0,0 +1,377 @@
+/*******************************************************************************
+ * @file SensorEngine.h
+ *
+ * @see SensorEngine.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Sensor acquisition engine.
+ *
+ * @details Sensor acquisition engine. The periodic acquisition task reads the
+ * due sensors with one acquisition per bus and publishes the samples in a
+ * preallocated ring buffer. The ring is read without locks.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __SENSOR_ENGINE_H__
+#define __SENSOR_ENGINE_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>        /* Standard atomic types */
+#include <cstdint>       /* Standard integer definitions */
+#include <Errors.h>      /* Errors definitions */
+#include <Sensor.h>      /* Sensor interface */
+#include <Timeout.h>     /* Timeout services */
+#include <HAL.h>         /* Hardware abstraction layer */
+#include <HMReporter.h>  /* HM reporter interface */
+#include <SystemState.h> /* Latest readings */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef SENSOR_MAX_SENSORS
+/** @brief Defines the maximal number of sensors. */
+#define SENSOR_MAX_SENSORS 8
+#endif
+
+#ifndef SENSOR_RING_SIZE
+/** @brief Defines the number of samples of the ring, a power of two. */
+#define SENSOR_RING_SIZE 4096
+#endif
+
+#ifndef SENSOR_TASK_MAX_SLEEP_NS
+/** @brief Defines the maximal acquisition task sleep in nanoseconds. */
+#define SENSOR_TASK_MAX_SLEEP_NS 1000000000ULL
+#endif
+
+#ifndef SENSOR_INIT_RETRY_NS
+/** @brief Defines the delay between two failed sensor starts in ns. */
+#define SENSOR_INIT_RETRY_NS 10000000000ULL
+#endif
+
+#ifndef SENSOR_HM_CHECK_PERIODS
+/** @brief Defines the sensor health check period in sampling periods. */
+#define SENSOR_HM_CHECK_PERIODS 3
+#endif
+
+static_assert(
+    0 == (SENSOR_RING_SIZE & (SENSOR_RING_SIZE - 1)),
+    "The sensor ring size must be a power of two."
+);
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* Forward declarations */
+class SensorHealthReporter;
+
+/** @brief Sensor slot of the engine. */
+typedef struct {
+    /** @brief The sensor driver. */
+    Sensor* pSensor;
+    /** @brief The measurement transfer of the sensor. */
+    S_SensorTransfer transfer;
+    /** @brief The health reporter of the sensor. */
+    SensorHealthReporter* pReporter;
+    /** @brief The health reporter identifier. */
+    uint32_t reporterId;
+    /** @brief The time of the next read or start in nanoseconds. */
+    uint64_t nextRead;
+    /** @brief Tells if the sensor must be started before being read. */
+    std::atomic<bool> needsInit;
+    /** @brief Tells if the frame of the current cycle was received. */
+    bool isRead;
+    /** @brief The number of successful reads. */
+    std::atomic<uint32_t> reads;
+    /** @brief The number of failed starts and reads. */
+    std::atomic<uint32_t> errors;
+    /** @brief The number of failures since the last successful read. */
+    std::atomic<uint32_t> failures;
+    /** @brief The frame of the current cycle. */
+    uint8_t pFrame[SENSOR_MAX_TRANSFER_SIZE];
+} S_SensorSlot;
+
+/** @brief Sensor status. */
+typedef struct {
+    /** @brief The name of the sensor. */
+    const char* pkName;
+    /** @brief The sampling period in nanoseconds. */
+    uint64_t periodNs;
+    /** @brief The number of successful reads. */
+    uint32_t reads;
+    /** @brief The number of failed starts and reads. */
+    uint32_t errors;
+    /** @brief The health of the sensor. */
+    E_HMStatus health;
+} S_SensorStatus;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The SensorEngine class.
+ *
+ * @details The SensorEngine class owns the acquisition task. At each cycle,
+ * the due sensors of a bus are read while the bus is acquired once, then
+ * the frames are decoded with the bus released. The samples are written in
+ * a ring of SENSOR_RING_SIZE samples allocated at creation, preferably in
+ * PSRAM. The ring has a single writer and is read with a sequence number:
+ * the readers never take a lock and never delay the acquisition. The
+ * sensors must be added before the engine is started.
+ */
+class SensorEngine {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief SensorEngine constructor.
+         */
+        SensorEngine(void) noexcept;
+
+        /**
+         * @brief Destroys a SensorEngine.
+         *
+         * @details Destroys a SensorEngine. Since only one object is allowed
+         * in the firmware, the destructor will generate a critical error.
+         */
+        ~SensorEngine(void) noexcept;
+
+        /**
+         * @brief Adds a sensor to the engine.
+         *
+         * @details Adds a sensor to the engine and registers its health
+         * reporter. The sensor is started by the acquisition task.
+         *
+         * @param[in] pSensor The sensor to add.
+         * @param[out] rId The identifier of the sensor in the engine.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return AddSensor(Sensor* pSensor, uint32_t& rId) noexcept;
+
+        /**
+         * @brief Starts the acquisition task.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Start(void) noexcept;
+
+        /**
+         * @brief Returns the sequence number of the next sample.
+         *
+         * @return The sequence number of the next published sample is
+         * returned.
+         */
+        uint32_t GetSequence(void) const noexcept;
+
+        /**
+         * @brief Reads the published samples.
+         *
+         * @details Reads the published samples from a sequence number. When
+         * the requested samples were overwritten, the reading starts at the
+         * oldest sample of the ring. Never blocks.
+         *
+         * @param[in, out] rSequence The sequence number of the first sample
+         * to read, updated to the one following the last read sample.
+         * @param[out] pBuffer The samples buffer.
+         * @param[in] kMaxCount The capacity of the buffer in samples.
+         *
+         * @return The number of read samples is returned.
+         */
+        uint32_t ReadSamples(uint32_t&       rSequence,
+                             S_SensorSample* pBuffer,
+                             const uint32_t  kMaxCount) const noexcept;
+
+        /**
+         * @brief Returns the number of sensors.
+         *
+         * @return The number of sensors is returned.
+         */
+        uint32_t GetSensorCount(void) const noexcept;
+
+        /**
+         * @brief Returns the status of a sensor.
+         *
+         * @param[in] kId The identifier of the sensor.
+         * @param[out] rStatus The status buffer.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return GetSensorStatus(const uint32_t  kId,
+                                 S_SensorStatus& rStatus) const noexcept;
+
+        /**
+         * @brief Requests a sensor restart.
+         *
+         * @details Requests a sensor restart. The sensor is started again by
+         * the acquisition task before its next read.
+         *
+         * @param[in] kId The identifier of the sensor.
+         */
+        void RequestInit(const uint32_t kId) noexcept;
+
+        /**
+         * @brief Tells if a sensor is healthy.
+         *
+         * @details Tells if a sensor is healthy. A sensor is healthy when it
+         * is started, its last read succeeded and it was read since the
+         * previous check.
+         *
+         * @param[in] kId The identifier of the sensor.
+         * @param[in, out] rLastReads The reads count at the previous check,
+         * updated with the current count.
+         *
+         * @return true if the sensor is healthy, false otherwise.
+         */
+        bool IsSensorHealthy(const uint32_t kId,
+                             uint32_t&      rLastReads) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Acquisition task routine.
+         *
+         * @param[in] pParam The SensorEngine instance.
+         */
+        static void TaskRoutine(void* pParam) noexcept;
+
+        /**
+         * @brief Handler called on acquisition watchdog trigger.
+         */
+        static void DeadlineMissHandler(void) noexcept;
+
+        /**
+         * @brief Performs an acquisition cycle.
+         *
+         * @param[in] kTime The time of the cycle in nanoseconds.
+         *
+         * @return The time to the next read in nanoseconds is returned.
+         */
+        uint64_t Acquire(const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Reads the frames of the due sensors of a bus.
+         *
+         * @param[in] kBus The bus to read.
+         * @param[in] kTime The time of the cycle in nanoseconds.
+         */
+        void ReadBus(const E_SensorBus kBus, const uint64_t kTime) noexcept;
+
+        /**
+         * @brief Publishes a sample in the ring.
+         *
+         * @param[in] krSample The sample to publish.
+         */
+        void Publish(const S_SensorSample& krSample) noexcept;
+
+        /**
+         * @brief Updates the latest reading of the channel of a sample.
+         *
+         * @param[in] krSample The sample of the channel.
+         */
+        void UpdateLatest(const S_SensorSample& krSample) noexcept;
+
+        /** @brief The sensor slots. */
+        S_SensorSlot _pSlots[SENSOR_MAX_SENSORS];
+        /** @brief The number of sensors. */
+        uint32_t _sensorCount;
+
+        /** @brief The samples ring. */
+        S_SensorSample* _pRing;
+        /** @brief The sequence number of the next published sample. */
+        std::atomic<uint32_t> _writeSeq;
+        /** @brief The latest readings, published once per cycle. */
+        S_LiveReadings _latest;
+
+        /** @brief The acquisition deadline manager. */
+        Timeout* _pTimeout;
+        /** @brief Stores the acquisition task handle. */
+        T_HALTask _taskHandle;
+};
+
+/**
+ * @brief Sensor Health Reporter class.
+ *
+ * @details Sensor Health Reporter class. A sensor that stops producing
+ * samples is restarted by the acquisition task.
+ */
+class SensorHealthReporter : public HMReporter {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Initializes the Health Reporter.
+         *
+         * @param[in] krParam The health reporter parameters.
+         * @param[in] pEngine The engine of the monitored sensor.
+         * @param[in] kId The identifier of the monitored sensor.
+         */
+        SensorHealthReporter(const S_HMReporterParam& krParam,
+                             SensorEngine*            pEngine,
+                             const uint32_t           kId) noexcept;
+
+        /**
+         * @brief SensorHealthReporter destructor.
+         */
+        virtual ~SensorHealthReporter(void) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /** @brief See HMReporter.h */
+        virtual void OnDegraded(void) noexcept;
+        /** @brief See HMReporter.h */
+        virtual void OnUnhealthy(void) noexcept;
+        /** @brief See HMReporter.h */
+        virtual bool PerformCheck(void) noexcept;
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The engine of the monitored sensor. */
+        SensorEngine* _pEngine;
+        /** @brief The identifier of the monitored sensor. */
+        uint32_t _id;
+        /** @brief The reads count at the previous check. */
+        uint32_t _lastReads;
+};
+
+#endif /* #ifndef __SENSOR_ENGINE_H__ */
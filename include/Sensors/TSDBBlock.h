@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * @file TSDBBlock.h
+ *
+ * @see TSDBBlock.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Time series compressed block codec.
+ *
+ * @details Time series compressed block codec. The points of a series are
+ * packed in sector-sized blocks with delta-of-delta encoded timestamps and
+ * XOR encoded values.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __TSDB_BLOCK_H__
+#define __TSDB_BLOCK_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the size of a block in bytes, one SD sector. */
+#define TSDB_BLOCK_SIZE 512
+
+/** @brief Defines the block magic, "TSB1". */
+#define TSDB_BLOCK_MAGIC 0x31425354
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Block header, stored at the start of each block. */
+typedef struct __attribute__((packed)) {
+    /** @brief The block magic. */
+    uint32_t magic;
+    /** @brief The number of points of the block. */
+    uint16_t count;
+    /** @brief The number of used bits after the header. */
+    uint16_t bitCount;
+    /** @brief The time of the first point. */
+    int64_t firstTime;
+    /** @brief The time of the last point. */
+    int64_t lastTime;
+} S_TSDBBlockHeader;
+
+/** @brief Block encoding and decoding state. */
+typedef struct {
+    /** @brief The block buffer of TSDB_BLOCK_SIZE bytes. */
+    uint8_t* pBlock;
+    /** @brief The number of points of the block. */
+    uint16_t count;
+    /** @brief The number of points decoded. */
+    uint16_t index;
+    /** @brief The position of the next bit after the header. */
+    uint32_t bitPos;
+    /** @brief The time of the previous point. */
+    int64_t prevTime;
+    /** @brief The delta between the two previous points. */
+    int64_t prevDelta;
+    /** @brief The bits of the previous value. */
+    uint32_t prevValue;
+    /** @brief The leading zeros of the previous XOR window. */
+    uint8_t prevLeading;
+    /** @brief The trailing zeros of the previous XOR window. */
+    uint8_t prevTrailing;
+} S_TSDBCodec;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The TSDBBlock class.
+ *
+ * @details The TSDBBlock class encodes and decodes the blocks of the
+ * time-series store. The timestamps are stored as the delta of their deltas,
+ * a regularly sampled series costs one bit per timestamp. The values are
+ * XORed with the previous one and only the meaningful bits are stored. The
+ * blocks are self-contained and decoded without reading any other block.
+ */
+class TSDBBlock {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Starts a new empty block.
+         *
+         * @param[out] pBlock The block buffer of TSDB_BLOCK_SIZE bytes.
+         * @param[out] rCodec The encoding state.
+         */
+        static void Create(uint8_t* pBlock, S_TSDBCodec& rCodec) noexcept;
+
+        /**
+         * @brief Appends a point to a block.
+         *
+         * @details Appends a point to a block and updates its header. The
+         * points must be appended in increasing time order.
+         *
+         * @param[in, out] rCodec The encoding state.
+         * @param[in] kTime The time of the point.
+         * @param[in] kValue The value of the point.
+         *
+         * @return The function returns ERR_TSDB_BLOCK_FULL when the point
+         * does not fit in the block, ERR_INVALID_PARAM when the point is older
+         * than the last one, NO_ERROR otherwise.
+         */
+        static E_Return Append(S_TSDBCodec&  rCodec,
+                               const int64_t kTime,
+                               const float   kValue) noexcept;
+
+        /**
+         * @brief Opens a block for decoding.
+         *
+         * @param[in] pBlock The block buffer of TSDB_BLOCK_SIZE bytes.
+         * @param[out] rCodec The decoding state.
+         *
+         * @return The function returns ERR_TSDB_INVALID_BLOCK when the
+         * block is corrupted, NO_ERROR otherwise.
+         */
+        static E_Return Open(uint8_t* pBlock, S_TSDBCodec& rCodec) noexcept;
+
+        /**
+         * @brief Decodes the next point of a block.
+         *
+         * @param[in, out] rCodec The decoding state.
+         * @param[out] rTime The time of the point.
+         * @param[out] rValue The value of the point.
+         *
+         * @return true if a point was decoded, false at the end of the block.
+         */
+        static bool Next(S_TSDBCodec& rCodec,
+                         int64_t&     rTime,
+                         float&       rValue) noexcept;
+
+        /**
+         * @brief Reopens a block for appending.
+         *
+         * @details Reopens a partially filled block for appending. The block
+         * is decoded to restore the encoding state.
+         *
+         * @param[in] pBlock The block buffer of TSDB_BLOCK_SIZE bytes.
+         * @param[out] rCodec The encoding state.
+         *
+         * @return The function returns ERR_TSDB_INVALID_BLOCK when the
+         * block is corrupted, NO_ERROR otherwise.
+         */
+        static E_Return Resume(uint8_t* pBlock, S_TSDBCodec& rCodec) noexcept;
+
+        /**
+         * @brief Reads the header of a block.
+         *
+         * @param[in] kpBlock The block buffer of TSDB_BLOCK_SIZE bytes.
+         * @param[out] rHeader The block header.
+         */
+        static void GetHeader(const uint8_t*     kpBlock,
+                              S_TSDBBlockHeader& rHeader) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Writes bits after the header.
+         *
+         * @param[in, out] rCodec The encoding state.
+         * @param[in] kValue The bits to write, right aligned.
+         * @param[in] kCount The number of bits to write, up to 64.
+         */
+        static void WriteBits(S_TSDBCodec&   rCodec,
+                              const uint64_t kValue,
+                              const uint8_t  kCount) noexcept;
+
+        /**
+         * @brief Reads bits after the header.
+         *
+         * @param[in, out] rCodec The decoding state.
+         * @param[in] kCount The number of bits to read, up to 64.
+         *
+         * @return The bits read, right aligned, are returned.
+         */
+        static uint64_t ReadBits(S_TSDBCodec&  rCodec,
+                                 const uint8_t kCount) noexcept;
+};
+
+#endif /* #ifndef __TSDB_BLOCK_H__ */
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ * @file TSDBRollup.h
+ *
+ * @see TSDBRollup.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Time series rollup tiers.
+ *
+ * @details Time series rollup tiers. The raw series are aggregated in
+ * minute, hour and day buckets while they are stored, each tier has its own
+ * series and retention.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __TSDB_ROLLUP_H__
+#define __TSDB_ROLLUP_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard integer definitions */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef TSDB_RETENTION_RAW_MS
+/** @brief Defines the raw points retention in milliseconds, 0 is forever. */
+#define TSDB_RETENTION_RAW_MS (7LL * 86400000LL)
+#endif
+
+#ifndef TSDB_RETENTION_MINUTE_MS
+/** @brief Defines the minute tier retention in milliseconds. */
+#define TSDB_RETENTION_MINUTE_MS (90LL * 86400000LL)
+#endif
+
+#ifndef TSDB_RETENTION_HOUR_MS
+/** @brief Defines the hour tier retention in milliseconds. */
+#define TSDB_RETENTION_HOUR_MS (730LL * 86400000LL)
+#endif
+
+#ifndef TSDB_RETENTION_DAY_MS
+/** @brief Defines the day tier retention in milliseconds. */
+#define TSDB_RETENTION_DAY_MS 0LL
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/**
+ * @brief Builds the identifier of a rollup series from its raw series, the
+ * tier is stored in bits 12-13 and the aggregate in bits 10-11.
+ */
+#define TSDB_ROLLUP_ID(BASE, TIER, AGGREGATE)                     \
+    ((uint16_t)(((BASE) & 0x3FF) | (((TIER) & 0x3) << 12) |       \
+                (((AGGREGATE) & 0x3) << 10)))
+
+/** @brief Returns the tier of a series identifier. */
+#define TSDB_SERIES_TIER(ID) ((E_TSDBTier)(((ID) >> 12) & 0x3))
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Defines the rollup tiers, from the finest. */
+typedef enum {
+    /** @brief Raw points. */
+    TSDB_TIER_RAW = 0,
+    /** @brief One minute buckets. */
+    TSDB_TIER_MINUTE = 1,
+    /** @brief One hour buckets. */
+    TSDB_TIER_HOUR = 2,
+    /** @brief One day buckets. */
+    TSDB_TIER_DAY = 3,
+    /** @brief Number of tiers. */
+    TSDB_TIER_MAX
+} E_TSDBTier;
+
+/** @brief Defines the aggregates of a bucket. */
+typedef enum {
+    /** @brief Average of the bucket, the raw points for the raw tier. */
+    TSDB_AGG_AVG = 0,
+    /** @brief Minimum of the bucket. */
+    TSDB_AGG_MIN = 1,
+    /** @brief Maximum of the bucket. */
+    TSDB_AGG_MAX = 2,
+    /** @brief Number of aggregates. */
+    TSDB_AGG_MAX_ID
+} E_TSDBAggregate;
+
+/** @brief Running aggregate of a bucket. */
+typedef struct {
+    /** @brief The start time of the bucket, aligned on the tier period. */
+    int64_t start;
+    /** @brief The number of points of the bucket. */
+    uint32_t count;
+    /** @brief The minimum of the bucket. */
+    float min;
+    /** @brief The maximum of the bucket. */
+    float max;
+    /** @brief The sum of the bucket. */
+    double sum;
+} S_TSDBBucket;
+
+/** @brief Rollup state of a raw series. */
+typedef struct {
+    /** @brief The raw series identifier. */
+    uint16_t id;
+    /** @brief Tells if the state is used. */
+    bool isUsed;
+    /** @brief The open bucket of each rolled up tier. */
+    S_TSDBBucket pBuckets[TSDB_TIER_MAX];
+} S_TSDBRollupState;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The TSDBRollup class.
+ *
+ * @details The TSDBRollup class maintains the running aggregates of the
+ * rollup tiers. A bucket is closed by the first point of the next bucket,
+ * its average, minimum and maximum are then stored at the bucket start time
+ * in the three series of the tier. The open buckets are not persisted, the
+ * first buckets after a boot only aggregate the points since the boot.
+ */
+class TSDBRollup {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Resets the open buckets of a raw series.
+         *
+         * @param[out] rState The rollup state.
+         * @param[in] kId The raw series identifier.
+         */
+        static void Init(S_TSDBRollupState& rState,
+                         const uint16_t     kId) noexcept;
+
+        /**
+         * @brief Adds a point to the bucket of a tier.
+         *
+         * @details Adds a point to the bucket of a tier. When the point
+         * belongs to a later bucket, the open bucket is closed and returned
+         * and the point starts the next one.
+         *
+         * @param[in, out] rBucket The open bucket of the tier.
+         * @param[in] kTier The tier, must not be the raw tier.
+         * @param[in] kTime The time of the point in milliseconds.
+         * @param[in] kValue The value of the point.
+         * @param[out] rClosed The closed bucket.
+         *
+         * @return true if a bucket was closed, false otherwise.
+         */
+        static bool Add(S_TSDBBucket&    rBucket,
+                        const E_TSDBTier kTier,
+                        const int64_t    kTime,
+                        const float      kValue,
+                        S_TSDBBucket&    rClosed) noexcept;
+
+        /**
+         * @brief Returns an aggregate of a bucket.
+         *
+         * @param[in] krBucket The bucket, must not be empty.
+         * @param[in] kAggregate The aggregate.
+         *
+         * @return The aggregate value is returned.
+         */
+        static float GetAggregate(const S_TSDBBucket&   krBucket,
+                                  const E_TSDBAggregate kAggregate) noexcept;
+
+        /**
+         * @brief Returns the bucket period of a tier.
+         *
+         * @param[in] kTier The tier.
+         *
+         * @return The period in milliseconds is returned, 0 for the raw tier.
+         */
+        static int64_t GetPeriod(const E_TSDBTier kTier) noexcept;
+
+        /**
+         * @brief Returns the retention of a tier.
+         *
+         * @param[in] kTier The tier.
+         *
+         * @return The retention in milliseconds is returned, 0 when the
+         * points are kept forever.
+         */
+        static int64_t GetRetention(const E_TSDBTier kTier) noexcept;
+
+        /**
+         * @brief Selects the tier of a range query.
+         *
+         * @details Selects the coarsest tier with a period finer than the
+         * requested resolution. When the start of the range is past the
+         * retention of the tier, the next coarser tier is used.
+         *
+         * @param[in] kStep The requested resolution in milliseconds.
+         * @param[in] kFrom The start of the range in milliseconds.
+         * @param[in] kNow The current store time in milliseconds.
+         *
+         * @return The selected tier is returned.
+         */
+        static E_TSDBTier SelectTier(const int64_t kStep,
+                                     const int64_t kFrom,
+                                     const int64_t kNow) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /* None */
+};
+
+#endif /* #ifndef __TSDB_ROLLUP_H__ */
@@ -0,0 +1,508 @@
+/*******************************************************************************
+ * @file TimeSeriesStore.h
+ *
+ * @see TimeSeriesStore.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Compressed time-series store.
+ *
+ * @details Compressed time-series store. Each series is stored on the SD card
+ * in append-only segment files of compressed sector-sized blocks, with a
+ * block time index used for the range reads.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __TIME_SERIES_STORE_H__
+#define __TIME_SERIES_STORE_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>      /* Standard integer definitions */
+#include <Errors.h>     /* Errors definitions */
+#include <Arduino.h>    /* Arduino framework */
+#include <TSDBBlock.h>  /* Block codec */
+#include <TSDBRollup.h> /* Rollup tiers */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef TSDB_MAX_SERIES
+/**
+ * @brief Defines the maximal number of series written since boot, each raw
+ * series has nine rollup series.
+ */
+#define TSDB_MAX_SERIES 48
+#endif
+
+#ifndef TSDB_MAX_ROLLUPS
+/** @brief Defines the maximal number of rolled up raw series. */
+#define TSDB_MAX_ROLLUPS 8
+#endif
+
+#ifndef TSDB_SEGMENT_BLOCKS
+/** @brief Defines the number of blocks of a segment file. */
+#define TSDB_SEGMENT_BLOCKS 256
+#endif
+
+#ifndef TSDB_TASK_PERIOD_NS
+/** @brief Defines the samples ingestion period in nanoseconds. */
+#define TSDB_TASK_PERIOD_NS 1000000000ULL
+#endif
+
+#ifndef TSDB_FLUSH_PERIOD_NS
+/** @brief Defines the period of the partial blocks flush in nanoseconds. */
+#define TSDB_FLUSH_PERIOD_NS 60000000000ULL
+#endif
+
+/** @brief Defines the maximal length of a store file path. */
+#define TSDB_PATH_SIZE 32
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/** @brief Builds the identifier of the series of a sensor quantity. */
+#define TSDB_SERIES_ID(SENSOR, QUANTITY) \
+    ((uint16_t)(((SENSOR) << 4) | ((QUANTITY) & 0xF)))
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Block time index entry, one per sealed block of a segment. */
+typedef struct __attribute__((packed)) {
+    /** @brief The time of the first point of the block. */
+    int64_t firstTime;
+    /** @brief The time of the last point of the block. */
+    int64_t lastTime;
+} S_TSDBIndexEntry;
+
+/** @brief Series state. */
+typedef struct {
+    /** @brief The series identifier. */
+    uint16_t id;
+    /** @brief Tells if the slot is used. */
+    bool isUsed;
+    /** @brief Tells if the open block has points not written on the card. */
+    bool isDirty;
+    /** @brief The oldest segment of the series. */
+    uint32_t firstSegment;
+    /** @brief The segment receiving the appends. */
+    uint32_t lastSegment;
+    /** @brief The number of sealed blocks of the last segment. */
+    uint32_t blockCount;
+    /** @brief The open block encoding state. */
+    S_TSDBCodec codec;
+    /** @brief The open block buffer. */
+    uint8_t* pBlock;
+} S_TSDBSeries;
+
+/** @brief Range read cursor, its memory use does not depend on the range. */
+typedef struct {
+    /** @brief The series identifier. */
+    uint16_t id;
+    /** @brief The first time of the range, inclusive. */
+    int64_t from;
+    /** @brief The last time of the range, inclusive. */
+    int64_t to;
+    /** @brief The segment of the current block. */
+    uint32_t segment;
+    /** @brief The last segment of the series at the cursor creation. */
+    uint32_t lastSegment;
+    /** @brief The current block in its segment. */
+    uint32_t block;
+    /** @brief The period of the points in milliseconds, 0 for raw points. */
+    int64_t period;
+    /** @brief Tells if the current block is open. */
+    bool isBlockOpen;
+    /** @brief Tells if the range is fully read. */
+    bool isDone;
+    /** @brief The current block decoding state. */
+    S_TSDBCodec codec;
+    /** @brief The current block buffer. */
+    uint8_t pBlock[TSDB_BLOCK_SIZE];
+} S_TSDBCursor;
+
+/** @brief Store statistics. */
+typedef struct {
+    /** @brief The number of series written since boot. */
+    uint32_t seriesCount;
+    /** @brief The number of stored points since boot. */
+    uint32_t points;
+    /** @brief The number of written blocks since boot. */
+    uint32_t blocks;
+    /** @brief The number of samples lost before being stored. */
+    uint32_t dropped;
+    /** @brief The number of failed card accesses. */
+    uint32_t errors;
+} S_TSDBStats;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The TimeSeriesStore class.
+ *
+ * @details The TimeSeriesStore class stores the sensor samples on the SD
+ * card. The store task reads the samples ring of the sensor engine, the
+ * acquisition is never delayed by the card. Each series keeps its open block
+ * in memory, a full block is sealed: written once at its position in the
+ * segment and indexed with its time range. The open block is rewritten at its
+ * position on flush and reloaded at boot. The store time is in milliseconds
+ * and continues across reboots. Each raw series is rolled up in minute, hour
+ * and day tiers while it is stored, the expired segments of a tier are
+ * removed when a new segment is started.
+ */
+class TimeSeriesStore {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief TimeSeriesStore constructor.
+         */
+        TimeSeriesStore(void) noexcept;
+
+        /**
+         * @brief Destroys a TimeSeriesStore.
+         *
+         * @details Destroys a TimeSeriesStore. Since only one object is
+         * allowed in the firmware, the destructor will generate a critical
+         * error.
+         */
+        ~TimeSeriesStore(void) noexcept;
+
+        /**
+         * @brief Starts the store task.
+         *
+         * @details Starts the store task. The store time base is loaded from
+         * the card and the task stores the samples published since boot.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Start(void) noexcept;
+
+        /**
+         * @brief Converts a time since boot to the store time.
+         *
+         * @param[in] kTimeNs The time since boot in nanoseconds.
+         *
+         * @return The store time in milliseconds is returned.
+         */
+        int64_t GetStoreTime(const uint64_t kTimeNs) const noexcept;
+
+        /**
+         * @brief Appends a point to a series.
+         *
+         * @details Appends a point to a series. The points of a series must
+         * be appended in increasing time order. A full block is sealed and
+         * written on the card.
+         *
+         * @param[in] kId The series identifier.
+         * @param[in] kTime The store time of the point in milliseconds.
+         * @param[in] kValue The value of the point.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return Append(const uint16_t kId,
+                        const int64_t  kTime,
+                        const float    kValue) noexcept;
+
+        /**
+         * @brief Writes the open blocks on the card.
+         */
+        void Flush(void) noexcept;
+
+        /**
+         * @brief Removes a series from the card.
+         *
+         * @param[in] kId The series identifier.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return RemoveSeries(const uint16_t kId) noexcept;
+
+        /**
+         * @brief Opens a range read cursor.
+         *
+         * @details Opens a range read cursor. The first block of the range is
+         * found with the segments and blocks time indexes.
+         *
+         * @param[in] kId The series identifier.
+         * @param[in] kFrom The first time of the range, inclusive.
+         * @param[in] kTo The last time of the range, inclusive.
+         * @param[out] rCursor The cursor to initialize.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return OpenCursor(const uint16_t kId,
+                            const int64_t  kFrom,
+                            const int64_t  kTo,
+                            S_TSDBCursor&  rCursor) noexcept;
+
+        /**
+         * @brief Opens a range read cursor at a resolution.
+         *
+         * @details Opens a range read cursor at a resolution. The coarsest
+         * tier with a period finer than the step is read, the raw series is
+         * read for the steps under a minute. The rollup points are stored at
+         * the start of their bucket, the range start is aligned on the tier
+         * period.
+         *
+         * @param[in] kId The raw series identifier.
+         * @param[in] kAggregate The aggregate read in the rollup tiers.
+         * @param[in] kFrom The first time of the range, inclusive.
+         * @param[in] kTo The last time of the range, inclusive.
+         * @param[in] kStep The requested resolution in milliseconds.
+         * @param[out] rCursor The cursor to initialize.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return OpenRangeCursor(const uint16_t        kId,
+                                 const E_TSDBAggregate kAggregate,
+                                 const int64_t         kFrom,
+                                 const int64_t         kTo,
+                                 const int64_t         kStep,
+                                 S_TSDBCursor&         rCursor) noexcept;
+
+        /**
+         * @brief Reads the next point of a range.
+         *
+         * @details Reads the next point of a range. The blocks are read and
+         * decoded one at a time.
+         *
+         * @param[in, out] rCursor The range cursor.
+         * @param[out] rTime The time of the point.
+         * @param[out] rValue The value of the point.
+         *
+         * @return true if a point was read, false at the end of the range.
+         */
+        bool ReadCursor(S_TSDBCursor& rCursor,
+                        int64_t&      rTime,
+                        float&        rValue) noexcept;
+
+        /**
+         * @brief Returns the store statistics.
+         *
+         * @param[out] rStats The statistics buffer.
+         */
+        void GetStats(S_TSDBStats& rStats) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Store task routine.
+         *
+         * @param[in] pParam The TimeSeriesStore instance.
+         */
+        static void TaskRoutine(void* pParam) noexcept;
+
+        /**
+         * @brief Stores the samples published since the last ingestion.
+         */
+        void Ingest(void) noexcept;
+
+        /**
+         * @brief Updates the rollup tiers of a raw series.
+         *
+         * @details Updates the rollup tiers of a raw series with a point and
+         * stores the closed buckets.
+         *
+         * @param[in] kId The raw series identifier.
+         * @param[in] kTime The store time of the point in milliseconds.
+         * @param[in] kValue The value of the point.
+         */
+        void Rollup(const uint16_t kId,
+                    const int64_t  kTime,
+                    const float    kValue) noexcept;
+
+        /**
+         * @brief Removes the expired segments of a series.
+         *
+         * @details Removes the oldest segments of a series when all their
+         * points are older than the retention of the series tier. The last
+         * segment is always kept. Must be called with the storage bus.
+         *
+         * @param[in, out] pSeries The series state.
+         * @param[in] kNow The time of the newest point of the series.
+         */
+        void ApplyRetention(S_TSDBSeries* pSeries,
+                            const int64_t kNow) noexcept;
+
+        /**
+         * @brief Returns the state of a series.
+         *
+         * @details Returns the state of a series, the series is loaded from
+         * the card on first use. Must be called with the store lock.
+         *
+         * @param[in] kId The series identifier.
+         *
+         * @return The series state is returned, nullptr when no slot is free.
+         */
+        S_TSDBSeries* GetSeries(const uint16_t kId) noexcept;
+
+        /**
+         * @brief Loads a series from the card.
+         *
+         * @details Loads a series from the card: its segments and its open
+         * block. Must be called with the store lock.
+         *
+         * @param[out] pSeries The series state, its identifier is set.
+         */
+        void LoadSeries(S_TSDBSeries* pSeries) noexcept;
+
+        /**
+         * @brief Writes the open block of a series at its position.
+         *
+         * @details Writes the open block of a series at its position. A
+         * sealed block is also indexed, the next segment is started when the
+         * segment is full. Must be called with the store lock.
+         *
+         * @param[in, out] pSeries The series state.
+         * @param[in] kIsSealed Tells if the block is full.
+         *
+         * @return The function returns the success or error status.
+         */
+        E_Return WriteBlock(S_TSDBSeries* pSeries,
+                            const bool    kIsSealed) noexcept;
+
+        /**
+         * @brief Reads the segments range of a series.
+         *
+         * @details Reads the segments range of a series and the number of
+         * sealed blocks of its last segment. Must be called with the storage
+         * bus.
+         *
+         * @param[in] kId The series identifier.
+         * @param[out] rFirst The oldest segment.
+         * @param[out] rLast The newest segment.
+         * @param[out] rBlockCount The sealed blocks of the newest segment.
+         *
+         * @return true if the series exists on the card, false otherwise.
+         */
+        bool ReadCatalog(const uint16_t kId,
+                         uint32_t&      rFirst,
+                         uint32_t&      rLast,
+                         uint32_t&      rBlockCount) const noexcept;
+
+        /**
+         * @brief Writes the segments range of a series.
+         *
+         * @details Writes the segments range of a series. Must be called with
+         * the storage bus.
+         *
+         * @param[in] kpSeries The series state.
+         */
+        void WriteCatalog(const S_TSDBSeries* kpSeries) const noexcept;
+
+        /**
+         * @brief Finds the first block of a range.
+         *
+         * @details Finds the first block that may hold points of the cursor
+         * range. Must be called with the storage bus.
+         *
+         * @param[in, out] rCursor The range cursor.
+         * @param[in] kFirst The oldest segment of the series.
+         * @param[in] kBlockCount The sealed blocks of the newest segment.
+         */
+        void SeekCursor(S_TSDBCursor&  rCursor,
+                        const uint32_t kFirst,
+                        const uint32_t kBlockCount) const noexcept;
+
+        /**
+         * @brief Loads the current block of a cursor.
+         *
+         * @param[in, out] rCursor The range cursor.
+         *
+         * @return true if the block was loaded, false at the end of the
+         * series.
+         */
+        bool LoadCursorBlock(S_TSDBCursor& rCursor) noexcept;
+
+        /**
+         * @brief Reads a block from the card.
+         *
+         * @details Reads a block from the card. Must be called with the
+         * storage bus.
+         *
+         * @param[in] kId The series identifier.
+         * @param[in] kSegment The segment of the block.
+         * @param[in] kBlock The block in its segment.
+         * @param[out] pBlock The block buffer of TSDB_BLOCK_SIZE bytes.
+         *
+         * @return true if the block was read, false otherwise.
+         */
+        bool ReadBlock(const uint16_t kId,
+                       const uint32_t kSegment,
+                       const uint32_t kBlock,
+                       uint8_t*       pBlock) const noexcept;
+
+        /**
+         * @brief Loads the store time base from the card.
+         */
+        void LoadTimeBase(void) noexcept;
+
+        /**
+         * @brief Saves the current store time on the card.
+         *
+         * @details Saves the current store time on the card, all the stored
+         * points are older. Must be called with the storage bus.
+         */
+        void SaveTimeBase(void) const noexcept;
+
+        /** @brief The series states. */
+        S_TSDBSeries _pSeries[TSDB_MAX_SERIES];
+        /** @brief The rollup states of the raw series. */
+        S_TSDBRollupState _pRollups[TSDB_MAX_ROLLUPS];
+        /** @brief The open blocks buffers of the series. */
+        uint8_t* _pBlocks;
+        /** @brief The series states lock. */
+        SemaphoreHandle_t _lock;
+
+        /** @brief The store time at boot in milliseconds. */
+        int64_t _timeBase;
+        /** @brief The sequence number of the next sample to store. */
+        uint32_t _readSeq;
+        /** @brief The time of the last flush in nanoseconds. */
+        uint64_t _lastFlush;
+
+        /** @brief The store statistics. */
+        S_TSDBStats _stats;
+
+        /** @brief Stores the store task handle. */
+        TaskHandle_t _taskHandle;
+};
+
+#endif /* #ifndef __TIME_SERIES_STORE_H__ */
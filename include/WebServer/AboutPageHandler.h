@@ -98,17 +98,23 @@ class AboutPageHandler : public PageHandler {
         virtual ~AboutPageHandler(void) noexcept;
 
         /**
-         * @brief Generates the about page.
+         * @brief Returns the about page title.
+         *
+         * @details Returns the about page title.
          *
-         * @details Generate the about page. The function generates the
-         * about page and title based on the current state of the system.
+         * @return The function returns the about page title.
+         */
+        virtual const char* GetTitle(void) const noexcept;
+
+        /**
+         * @brief Generates the about page.
          *
-         * @param[out] rPageTitle The title to give to the about page.
-         * @param[out] rPageBody The body to give to the about page.
+         * @details Generate the about page. The function writes the about page
+         * body to the sink based on the current state of the system.
          *
+         * @param[out] rSink The sink that receives the about page body.
          */
-        virtual void Generate(std::string& rPageTitle,
-                              std::string& rPageBody) noexcept;
+        virtual void Generate(PageSink& rSink) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
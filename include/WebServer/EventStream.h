@@ -0,0 +1,249 @@
+/*******************************************************************************
+ * @file EventStream.h
+ *
+ * @see EventStream.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Server-Sent Events live stream.
+ *
+ * @details Server-Sent Events live stream. The stream pushes the new RAM
+ * journal logs and the status counters to the attached clients, only the data
+ * produced since the last push is sent.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __EVENT_STREAM_H__
+#define __EVENT_STREAM_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>     /* Standard integer definitions */
+#include <cstddef>     /* Standard size type */
+#include <WiFi.h>      /* WiFi services */
+#include <Logger.h>    /* RAM journal streams */
+#include <WebServer.h> /* Web server services */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef EVENT_STREAM_MAX_CLIENTS
+/** @brief Defines the maximal number of attached clients. */
+#define EVENT_STREAM_MAX_CLIENTS 2
+#endif
+
+#ifndef EVENT_STREAM_LOG_CHUNK_SIZE
+/** @brief Defines the size of the logs read per push in bytes. */
+#define EVENT_STREAM_LOG_CHUNK_SIZE 512
+#endif
+
+#ifndef EVENT_STREAM_FRAME_SIZE
+/** @brief Defines the size of the events framing buffer in bytes. */
+#define EVENT_STREAM_FRAME_SIZE 1024
+#endif
+
+#ifndef EVENT_STREAM_MAX_CHUNKS
+/** @brief Defines the maximal number of log chunks pushed per update. */
+#define EVENT_STREAM_MAX_CHUNKS 4
+#endif
+
+#ifndef EVENT_STREAM_STATUS_PERIOD_NS
+/** @brief Defines the status counters sampling period in ns. */
+#define EVENT_STREAM_STATUS_PERIOD_NS 1000000000ULL
+#endif
+
+#ifndef EVENT_STREAM_HEARTBEAT_NS
+/** @brief Defines the idle time after which a heartbeat is sent in ns. */
+#define EVENT_STREAM_HEARTBEAT_NS 15000000000ULL
+#endif
+
+/** @brief Defines the request header resuming a stream after a reconnect. */
+#define EVENT_STREAM_LAST_ID_HEADER "Last-Event-ID"
+/** @brief Defines the request argument giving the first log of a stream. */
+#define EVENT_STREAM_SEQUENCE_ARG "seq"
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Status counters pushed by the stream. */
+typedef struct {
+    /** @brief The free heap in bytes. */
+    uint32_t heapFree;
+    /** @brief The lowest free heap since boot in bytes. */
+    uint32_t heapMin;
+    /** @brief The number of pending HM actions. */
+    uint32_t hmPending;
+    /** @brief The number of executed HM actions. */
+    uint32_t hmExecuted;
+    /** @brief The number of HM actions rejected by a full scheduler. */
+    uint32_t hmDropped;
+} S_EventStatus;
+
+/** @brief Attached client slot. */
+typedef struct {
+    /** @brief The client, not connected when the slot is free. */
+    WiFiClient client;
+    /** @brief The client position in the RAM journal. */
+    S_RamJournalStream logStream;
+    /** @brief The time of the last push to the client in ns. */
+    uint64_t lastPush;
+} S_EventClient;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The EventStream class.
+ *
+ * @details The EventStream class serves a text/event-stream to up to
+ * EVENT_STREAM_MAX_CLIENTS clients. The connection of the request is kept by
+ * the stream once the server released it. The stream sends "log" events with
+ * the journal logs written since the client attached and "status" events when
+ * the status counters change. The updates must be called from the task
+ * serving the server.
+ */
+class EventStream {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief EventStream constructor.
+         */
+        EventStream(void) noexcept;
+
+        /**
+         * @brief Attaches the client of the current request.
+         *
+         * @details Attaches the client of the current request. The stream
+         * headers are sent and the client receives the logs written from now
+         * on, and the current status.
+         *
+         * @param[in] pServer The server serving the request.
+         *
+         * @return true if the client was attached, false if all the slots
+         * are used. No response is sent in that case.
+         */
+        bool Attach(WebServer* pServer) noexcept;
+
+        /**
+         * @brief Pushes the new data to the attached clients.
+         *
+         * @details Pushes the new data to the attached clients. The clients
+         * that closed or failed a write are detached.
+         */
+        void Update(void) noexcept;
+
+        /**
+         * @brief Tells if clients are attached.
+         *
+         * @return true if at least one client is attached.
+         */
+        bool HasClients(void) noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Pushes the new logs to a client.
+         *
+         * @param[in, out] rClient The client to push to.
+         *
+         * @return false if a write failed.
+         */
+        bool PushLogs(S_EventClient& rClient) noexcept;
+
+        /**
+         * @brief Pushes the status to a client.
+         *
+         * @param[in, out] rClient The client to push to.
+         *
+         * @return false if a write failed.
+         */
+        bool PushStatus(S_EventClient& rClient) noexcept;
+
+        /**
+         * @brief Samples the status counters.
+         *
+         * @param[out] rStatus The sampled counters.
+         */
+        static void SampleStatus(S_EventStatus& rStatus) noexcept;
+
+        /**
+         * @brief Appends data to the frame of a client.
+         *
+         * @details Appends data to the frame of a client. The frame is sent
+         * when full.
+         *
+         * @param[in, out] rClient The client to write to.
+         * @param[in] kpData The data to append.
+         * @param[in] kSize The data size in bytes.
+         *
+         * @return false if a write failed.
+         */
+        bool Append(S_EventClient& rClient,
+                    const char*    kpData,
+                    const size_t   kSize) noexcept;
+
+        /**
+         * @brief Sends the frame to a client.
+         *
+         * @param[in, out] rClient The client to write to.
+         *
+         * @return false if the frame was not fully written.
+         */
+        bool Flush(S_EventClient& rClient) noexcept;
+
+        /** @brief The attached clients. */
+        S_EventClient _pClients[EVENT_STREAM_MAX_CLIENTS];
+        /** @brief The last pushed status. */
+        S_EventStatus _status;
+        /** @brief The time of the last status sampling in ns. */
+        uint64_t _lastSample;
+        /** @brief The logs read buffer, shared by the clients. */
+        char _pLogBuffer[EVENT_STREAM_LOG_CHUNK_SIZE];
+        /** @brief The events framing buffer, shared by the clients. */
+        char _pFrame[EVENT_STREAM_FRAME_SIZE];
+        /** @brief The number of bytes in the framing buffer. */
+        size_t _frameSize;
+};
+
+#endif /* #ifndef __EVENT_STREAM_H__ */
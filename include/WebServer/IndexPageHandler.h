@@ -98,17 +98,23 @@ class IndexPageHandler : public PageHandler {
         virtual ~IndexPageHandler(void) noexcept;
 
         /**
-         * @brief Generates the index page.
+         * @brief Returns the index page title.
+         *
+         * @details Returns the index page title.
          *
-         * @details Generate the index page. The function generates the index
-         * page and title based on the current state of the system.
+         * @return The function returns the index page title.
+         */
+        virtual const char* GetTitle(void) const noexcept;
+
+        /**
+         * @brief Generates the index page.
          *
-         * @param[out] rPageTitle The title to give to the index page.
-         * @param[out] rPageBody The body to give to the index page.
+         * @details Generate the index page. The function writes the index page
+         * body to the sink based on the current state of the system.
          *
+         * @param[out] rSink The sink that receives the index page body.
          */
-        virtual void Generate(std::string& rPageTitle,
-                              std::string& rPageBody) noexcept;
+        virtual void Generate(PageSink& rSink) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -122,9 +128,9 @@ class IndexPageHandler : public PageHandler {
          * @details Generates the network section. This contains information
          * about the system network status.
          *
-         * @param[out] rBuffer The buffer that will receive the section.
+         * @param[out] rSink The sink that receives the section.
          */
-        void GenerateNetwork(std::string& rBuffer) const noexcept;
+        void GenerateNetwork(PageSink& rSink) const noexcept;
 
         /**
          * @brief Generates the system section.
@@ -132,9 +138,9 @@ class IndexPageHandler : public PageHandler {
          * @details Generates the system section. This contains information
          * about the system general status.
          *
-         * @param[out] rBuffer The buffer that will receive the section.
+         * @param[out] rSink The sink that receives the section.
          */
-        void GenerateSystem(std::string& rBuffer) const noexcept;
+        void GenerateSystem(PageSink& rSink) const noexcept;
 };
 
 #endif /* #ifndef __INDEX_PAGE_HANDLER_H__ */
\ No newline at end of file
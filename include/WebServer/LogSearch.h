@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * @file LogSearch.h
+ *
+ * @see LogSearch.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Journal logs search filter.
+ *
+ * @details Journal logs search filter. The formated logs read from the
+ * journals are filtered by level, time and pattern, only the matching lines
+ * are kept.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __LOG_SEARCH_H__
+#define __LOG_SEARCH_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <cstddef>  /* Standard size type */
+#include <Logger.h> /* Logger services */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the longest search pattern in characters. */
+#define LOG_SEARCH_PATTERN_MAX 64
+
+/** @brief Defines the number of literal pieces of a search pattern. */
+#define LOG_SEARCH_PIECES_MAX 4
+
+/** @brief Defines the wildcard character of the search patterns. */
+#define LOG_SEARCH_WILDCARD '*'
+
+/**
+ * @brief Defines the longest line kept across two blocks, longer lines are
+ * cut. A formated log never exceeds the logger buffer.
+ */
+#define LOG_SEARCH_LINE_MAX LOGGER_BUFFER_SIZE
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The LogSearch class.
+ *
+ * @details The LogSearch class filters blocks of formated logs. A pattern is
+ * made of literal pieces separated by LOG_SEARCH_WILDCARD, the pieces must
+ * appear in order in the line and are case sensitive. The first piece is
+ * searched over the whole block with a Boyer-Moore-Horspool skip table, the
+ * lines without it are never scanned. The time range applies to the
+ * timestamp of the logs, lines without a log header only match when no
+ * range is set.
+ */
+class LogSearch {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief LogSearch constructor.
+         *
+         * @details LogSearch constructor. The search matches all the lines
+         * until it is configured.
+         */
+        LogSearch(void) noexcept;
+
+        /**
+         * @brief Destroys a LogSearch.
+         *
+         * @details Destroys a LogSearch. The searches live as long as their
+         * server, the destructor will generate a critical error.
+         */
+        ~LogSearch(void) noexcept;
+
+        /**
+         * @brief Configures the search.
+         *
+         * @param[in] kpPattern The pattern to search, empty to match any
+         * line.
+         * @param[in] kLevel The highest level of the matching logs.
+         * @param[in] kFromNs The start of the time range in nanoseconds.
+         * @param[in] kToNs The end of the time range in nanoseconds, included.
+         *
+         * @return true is returned when the pattern is valid, the search
+         * matches no line otherwise.
+         */
+        bool Configure(const char*      kpPattern,
+                       const E_LogLevel kLevel,
+                       const uint64_t   kFromNs,
+                       const uint64_t   kToNs) noexcept;
+
+        /**
+         * @brief Filters a block of logs.
+         *
+         * @details Filters a block of logs in place. The matching lines are
+         * moved to the start of the block. The last line of the block is not
+         * consumed when it is not terminated and shorter than
+         * LOG_SEARCH_LINE_MAX, it must be provided again at the start of the
+         * next block. The blocks must be larger than the lines they cut to
+         * make progress, LOG_SEARCH_LINE_MAX bytes always are.
+         *
+         * @param[in, out] pBlock The block to filter.
+         * @param[in] kSize The size of the block in bytes.
+         * @param[in] kIsLast Tells if the block ends the logs.
+         * @param[out] rConsumed The number of bytes consumed from the block.
+         *
+         * @return The size of the matching lines is returned.
+         */
+        size_t Filter(char*        pBlock,
+                      const size_t kSize,
+                      const bool   kIsLast,
+                      size_t&      rConsumed) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Finds a piece of the pattern.
+         *
+         * @param[in] kPiece The piece to find.
+         * @param[in] kpData The data to search.
+         * @param[in] kSize The size of the data in bytes.
+         *
+         * @return The offset of the piece in the data is returned, kSize is
+         * returned when the piece is not found.
+         */
+        size_t Find(const uint8_t kPiece,
+                    const char*   kpData,
+                    const size_t  kSize) const noexcept;
+
+        /**
+         * @brief Tells if a line matches the search.
+         *
+         * @param[in] kpLine The line to check.
+         * @param[in] kSize The size of the line in bytes.
+         *
+         * @return true is returned when the line matches.
+         */
+        bool IsMatch(const char* kpLine, const size_t kSize) const noexcept;
+
+        /** @brief The pattern pieces, separated by null characters. */
+        char _pPattern[LOG_SEARCH_PATTERN_MAX + 1];
+        /** @brief The start of the pieces in the pattern. */
+        uint8_t _pPieceStart[LOG_SEARCH_PIECES_MAX];
+        /** @brief The length of the pieces. */
+        uint8_t _pPieceLength[LOG_SEARCH_PIECES_MAX];
+        /** @brief The skip tables of the pieces, by last compared byte. */
+        uint8_t _pSkip[LOG_SEARCH_PIECES_MAX][256];
+        /** @brief The number of pieces of the pattern. */
+        uint8_t _pieceCount;
+        /** @brief The highest level of the matching logs. */
+        E_LogLevel _level;
+        /** @brief The start of the time range in nanoseconds. */
+        uint64_t _fromNs;
+        /** @brief The end of the time range in nanoseconds. */
+        uint64_t _toNs;
+        /** @brief Tells if the time range filters the lines. */
+        bool _hasRange;
+        /** @brief Tells if the search can match a line. */
+        bool _isValid;
+};
+
+#endif /* #ifndef __LOG_SEARCH_H__ */
@@ -23,9 +23,12 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <string>        /* Standard strings */
-#include <cstdint>       /* Standard integer definitions */
-#include <WebServer.h>   /* Web server services */
+#include <cstdint>        /* Standard integer definitions */
+#include <PageSink.h>     /* Page output sink */
+#include <WebServer.h>    /* Web server services */
+#include <EventStream.h>  /* Live events stream */
+#include <LogSearch.h>    /* Journal logs search */
+#include <RequestArena.h> /* Per-request arena */
 
 /*******************************************************************************
  * CONSTANTS
@@ -97,6 +100,16 @@ class MaintenanceWebServerHandlers {
          */
         ~MaintenanceWebServerHandlers(void) noexcept;
 
+        /**
+         * @brief Returns the live events stream of the server.
+         *
+         * @details Returns the live events stream of the server. The stream
+         * must be updated by the task serving the server.
+         *
+         * @return The function returns the live events stream.
+         */
+        EventStream* GetEventStream(void) const noexcept;
+
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -139,10 +152,30 @@ class MaintenanceWebServerHandlers {
          * @brief Handles the Journal logs loading request URL.
          *
          * @details Handles the Journal logs loading request URL. Respond with
-         * new logs when available.
+         * new logs when available. When a from / to time range in seconds of
+         * journal time is requested, the whole range is sent.
          */
         static void HandleJournalLoad(void) noexcept;
 
+        /**
+         * @brief Handles the RAM logs download request URL.
+         *
+         * @details Handles the RAM logs download request URL. The whole RAM
+         * journal is streamed in a single chunked response, from the oldest
+         * log to the newest.
+         */
+        static void HandleRamDownload(void) noexcept;
+
+        /**
+         * @brief Handles the log search request URL.
+         *
+         * @details Handles the log search request URL. The RAM journal or a
+         * time range of the persistent journal is searched on the device,
+         * only the lines matching the level and the pattern are streamed in
+         * a chunked response.
+         */
+        static void HandleLogSearch(void) noexcept;
+
         /**
          * @brief Handles the log clear request URL.
          *
@@ -152,71 +185,168 @@ class MaintenanceWebServerHandlers {
         static void HandleClearLogs(void) noexcept;
 
         /**
-         * @brief Creates the page header.
+         * @brief Handles the log level request URL.
+         *
+         * @details Handles the log level request URL. Sets the runtime log
+         * level of a module and redirects to the index page.
+         */
+        static void HandleLogLevel(void) noexcept;
+
+        /**
+         * @brief Handles the events stream URL.
          *
-         * @details Creates the page header. This will fill the string buffer
-         * and use the appropriate page title.
+         * @details Handles the events stream URL. The client is attached to
+         * the live events stream, or refused when the stream is full.
+         */
+        static void HandleEvents(void) noexcept;
+
+        /**
+         * @brief Handles the trace download request URL.
          *
-         * @param[out] rHeaderStr The string buffer that receives the header.
-         * @param[in] krTitle The page title to set.
+         * @details Handles the trace download request URL. The recorded
+         * events are streamed in the Chrome trace event format.
          */
-        void GetPageHeader(std::string&       rHeaderStr,
-                           const std::string& krTitle) const noexcept;
+        static void HandleTraceDownload(void) noexcept;
 
         /**
-         * @brief Creates the page footer.
+         * @brief Handles the tracing state request URL.
          *
-         * @details Creates the page footer. This will fill the string buffer.
+         * @details Handles the tracing state request URL. Starts or stops
+         * the tracing and redirects to the index page.
+         */
+        static void HandleTraceState(void) noexcept;
+
+        /**
+         * @brief Writes the page header.
          *
-         * @param[out] rFooterStr The string buffer that receives the footer.
+         * @details Writes the constant page shell header to the sink and
+         * inserts the page title.
+         *
+         * @param[out] rSink The sink that receives the header.
+         * @param[in] kpTitle The page title to set.
          */
-        void GetPageFooter(std::string& rFooterStr) const noexcept;
+        void WritePageHeader(PageSink&   rSink,
+                             const char* kpTitle) const noexcept;
 
         /**
-         * @brief Creates the page CSS section.
+         * @brief Ends the page.
          *
-         * @details Creates the page CSS section. This will fill the string
-         * buffer.
+         * @details Writes the page footer and terminates the response. The
+         * function does nothing when the page already ended.
          *
-         * @param[out] rHeaderStr The string buffer that receives the CSS.
+         * @param[out] rSink The sink to terminate.
          */
-        void GeneratePageCSS(std::string& rHeaderStr) const noexcept;
+        void EndPage(PageSink& rSink) const noexcept;
 
         /**
-         * @brief Creates the page Script section.
+         * @brief Sends a buffer as a complete response.
          *
-         * @details Creates the page Script section. This will fill the string
-         * buffer.
+         * @param[in] kpBuffer The buffer to send.
+         * @param[in] kSize The size of the buffer in bytes.
+         */
+        void SendBuffer(const char* kpBuffer, const size_t kSize) noexcept;
+
+        /**
+         * @brief Formats the firmware logs.
          *
-         * @param[out] rHeaderStr The string buffer that receives the Script.
+         * @details Formats the firmware logs to be displayed in an HLTM page.
+         *
+         * @param[out] rSink The sink that receives the logs.
          */
-        void GeneratePageScripts(std::string& rHeaderStr) const noexcept;
+        void GetFormatedLogs(PageSink& rSink) const noexcept;
 
+        /**
+         * @brief Formats the log modules levels.
+         *
+         * @details Formats the runtime log level of each log module with the
+         * links used to update them.
+         *
+         * @param[out] rSink The sink that receives the log levels.
+         */
+        void GetFormatedLogLevels(PageSink& rSink) const noexcept;
 
         /**
-         * @brief Generic page handler.
+         * @brief Formats the settings memory usage.
          *
-         * @details Generic page handler. The handler will send the page
-         * to the requesting server.
+         * @details Formats the settings values arena usage and the internal
+         * heap state.
          *
-         * @param[in] kpPage The page to send.
-         * @param[in] kCode The code to respond.
+         * @param[out] rSink The sink that receives the memory usage.
          */
-        void GenericHandler(const std::string& krPage,
-                            const int32_t      kCode) noexcept;
+        void GetFormatedSettingsMemory(PageSink& rSink) const noexcept;
 
+        /**
+         * @brief Formats the subsystems memory pools usage.
+         *
+         * @details Formats the usage, the high-water mark and the heap
+         * fallbacks of each subsystem memory pool, and the peak usage of the
+         * request arena.
+         *
+         * @param[out] rSink The sink that receives the pools usage.
+         */
+        void GetFormatedMemoryPools(PageSink& rSink) const noexcept;
 
         /**
-         * @brief Formats the firmware logs.
+         * @brief Sends a time range of the persistent journal.
          *
-         * @details Formats the firmware logs to be displayed in an HLTM page.
+         * @details Sends a time range of the persistent journal in a chunked
+         * response. The range is located with the journal time index.
+         *
+         * @param[in] kFromNs The start of the range in journal time.
+         * @param[in] kToNs The end of the range in journal time.
+         */
+        void SendJournalRange(const uint64_t kFromNs, const uint64_t kToNs)
+        noexcept;
+
+        /**
+         * @brief Sends the matching logs of the RAM journal.
+         *
+         * @param[in, out] pBuffer The LOG_SEARCH_BLOCK_SIZE bytes read
+         * buffer.
+         */
+        void SearchRamJournal(char* pBuffer) noexcept;
+
+        /**
+         * @brief Sends the matching logs of a persistent journal range.
          *
-         * @param[out] rPage The page buffer to fill with the logs.
+         * @details Sends the matching logs of a persistent journal range. The
+         * range is located with the journal time index.
+         *
+         * @param[in, out] pBuffer The LOG_SEARCH_BLOCK_SIZE bytes read
+         * buffer.
+         * @param[in] kFromNs The start of the range in journal time.
+         * @param[in] kToNs The end of the range in journal time.
          */
-        void GetFormatedLogs(std::string& rPage) const noexcept;
+        void SearchJournalRange(char*          pBuffer,
+                                const uint64_t kFromNs,
+                                const uint64_t kToNs) noexcept;
+
+        /**
+         * @brief Filters a read block and sends its matching logs.
+         *
+         * @param[in, out] pBuffer The read buffer, the unterminated line of
+         * the block is moved to its start.
+         * @param[in, out] rPending The size of the unterminated line leading
+         * the buffer.
+         * @param[in] kReadBytes The bytes read after the pending line.
+         * @param[in] kIsLast Tells if the block ends the logs.
+         */
+        void SendMatches(char*        pBuffer,
+                         size_t&      rPending,
+                         const size_t kReadBytes,
+                         const bool   kIsLast) noexcept;
 
         /** @brief Stores the WebServer used by the handlers. */
         WebServer* _pServer;
+
+        /** @brief Stores the live events stream. */
+        EventStream* _pEvents;
+
+        /** @brief Stores the arena of the request being handled. */
+        RequestArena* _pArena;
+
+        /** @brief Stores the log search filter. */
+        LogSearch* _pSearch;
 };
 
 #endif /* #ifndef __MAINTENANCE_WEB_SERVER_HANDLERS_H__ */
\ No newline at end of file
@@ -23,9 +23,10 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <string>        /* Standard string */
-#include <Errors.h>      /* Errors definitions */
-#include <PageHandler.h> /* Page Handler interface */
+#include <string>          /* Standard string */
+#include <Errors.h>        /* Errors definitions */
+#include <PageHandler.h>   /* Page Handler interface */
+#include <SystemMonitor.h> /* Monitor samples */
 
 /*******************************************************************************
  * CONSTANTS
@@ -75,7 +76,9 @@
  * @brief The MonitorPageHandler class.
  *
  * @details The MonitorPageHandler class provides the necessary functions to
- * handle monitor page requests.
+ * handle monitor page requests. The newest system monitor sample is rendered
+ * with the page, the status and the logs are then pushed by the live events
+ * stream.
  */
 class MonitorPageHandler : public PageHandler {
     /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
@@ -98,17 +101,23 @@ class MonitorPageHandler : public PageHandler {
         virtual ~MonitorPageHandler(void) noexcept;
 
         /**
-         * @brief Generates the monitor page.
+         * @brief Returns the monitor page title.
+         *
+         * @details Returns the monitor page title.
          *
-         * @details Generate the monitor page. The function generates the
-         * monitor page and title based on the current state of the system.
+         * @return The function returns the monitor page title.
+         */
+        virtual const char* GetTitle(void) const noexcept;
+
+        /**
+         * @brief Generates the monitor page.
          *
-         * @param[out] rPageTitle The title to give to the monitor page.
-         * @param[out] rPageBody The body to give to the monitor page.
+         * @details Generate the monitor page. The function writes the page body
+         * to the sink based on the current state of the system.
          *
+         * @param[out] rSink The sink that receives the monitor page body.
          */
-        virtual void Generate(std::string& rPageTitle,
-                              std::string& rPageBody) noexcept;
+        virtual void Generate(PageSink& rSink) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -116,7 +125,15 @@ class MonitorPageHandler : public PageHandler {
 
     /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
     private:
-        /* None */
+        /**
+         * @brief Writes the newest system monitor sample.
+         *
+         * @param[out] rSink The sink that receives the sample tables.
+         */
+        void GenerateSystem(PageSink& rSink) noexcept;
+
+        /** @brief The sample being rendered. */
+        S_SysMonSample _sample;
 };
 
 #endif /* #ifndef __MONITOR_PAGE_HANDLER_H__ */
\ No newline at end of file
@@ -23,6 +23,7 @@
  ******************************************************************************/
 #include <string>              /* Standard strings */
 #include <Errors.h>            /* Error definitions */
+#include <PageSink.h>          /* Page output sink */
 
 /* Forward declarations */
 class WebServerHandlers;
@@ -98,18 +99,25 @@ class PageHandler {
          */
         virtual ~PageHandler(void) noexcept {};
 
+        /**
+         * @brief Returns the page title.
+         *
+         * @details Returns the page title. The title is written in the page
+         * header before the page is generated.
+         *
+         * @return The function returns the page title.
+         */
+        virtual const char* GetTitle(void) const noexcept = 0;
+
         /**
          * @brief Generates the page.
          *
-         * @details Generate the page. The function should generate the page and
-         * fill the string in parameters with the content of the page title and
-         * body.
+         * @details Generate the page. The function should write the page body
+         * to the sink, the page header and footer are written by the handlers.
          *
-         * @param[out] rPageTitle The title to give to the page.
-         * @param[out] rPageBody The body to give to the page.
+         * @param[out] rSink The sink that receives the page body.
          */
-        virtual void Generate(std::string& rPageTitle,
-                              std::string& rPageBody) noexcept = 0;
+        virtual void Generate(PageSink& rSink) noexcept = 0;
 
         /**
          * @brief Returns the handlers with wich the page was generated.
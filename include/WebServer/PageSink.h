@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * @file PageSink.h
+ *
+ * @see PageSink.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Web server response output sink.
+ *
+ * @details Web server response output sink. Pages are written in a small fixed
+ * buffer that is sent as an HTTP chunk each time it fills.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __PAGE_SINK_H__
+#define __PAGE_SINK_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <string>         /* Standard strings */
+#include <cstdint>        /* Standard integer definitions */
+#include <cstddef>        /* Standard size type */
+#include <WebServer.h>    /* Web server services */
+#include <RequestArena.h> /* Per-request arena */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef PAGE_SINK_BUFFER_SIZE
+/** @brief Defines the size of the page sink buffer in bytes. */
+#define PAGE_SINK_BUFFER_SIZE 384
+#endif
+
+#ifndef PAGE_SINK_ARENA_BUFFER_SIZE
+/** @brief Defines the size of the page sink buffer taken from an arena. */
+#define PAGE_SINK_ARENA_BUFFER_SIZE 6144
+#endif
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The PageSink class.
+ *
+ * @details The PageSink class streams a response to the current client of a
+ * server. The response headers are sent with the first chunk, a response that
+ * fits in the buffer is sent at once with its exact length. The peak memory of
+ * a response is bounded by the sink buffer, whatever the size of the page.
+ * When a request arena is given, the buffer is taken from it so that most
+ * pages fit and are sent at once, the sink falls back to its own smaller
+ * buffer when the arena is exhausted.
+ */
+class PageSink {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Creates a PageSink.
+         *
+         * @details Creates a PageSink. Nothing is sent before the buffer fills
+         * or the sink is ended.
+         *
+         * @param[in] pServer The server handling the request.
+         * @param[in] kCode The response status code.
+         * @param[in] pkContentType The response content type.
+         * @param[in] pArena The arena of the request, if any.
+         */
+        PageSink(WebServer*    pServer,
+                 const int32_t kCode,
+                 const char*   pkContentType,
+                 RequestArena* pArena = nullptr) noexcept;
+
+        /**
+         * @brief Destroys a PageSink.
+         *
+         * @details Destroys a PageSink. The response is ended if it was not.
+         */
+        ~PageSink(void) noexcept;
+
+        /**
+         * @brief Writes data to the response.
+         *
+         * @details Writes data to the response. Data larger than the buffer
+         * is sent directly after the buffered data.
+         *
+         * @param[in] kpData The data to write.
+         * @param[in] kSize The size of the data in bytes.
+         */
+        void Write(const char* kpData, const size_t kSize) noexcept;
+
+        /**
+         * @brief Writes a null-terminated string to the response.
+         *
+         * @details Writes a null-terminated string to the response.
+         *
+         * @param[in] kpStr The string to write.
+         */
+        void Write(const char* kpStr) noexcept;
+
+        /**
+         * @brief Writes a string to the response.
+         *
+         * @details Writes a string to the response.
+         *
+         * @param[in] krStr The string to write.
+         */
+        void Write(const std::string& krStr) noexcept;
+
+        /**
+         * @brief Writes an unsigned integer in decimal to the response.
+         *
+         * @details Writes an unsigned integer in decimal to the response. No
+         * memory is allocated.
+         *
+         * @param[in] kValue The value to write.
+         */
+        void WriteUInt(const uint64_t kValue) noexcept;
+
+        /**
+         * @brief Writes a signed integer in decimal to the response.
+         *
+         * @details Writes a signed integer in decimal to the response. No
+         * memory is allocated.
+         *
+         * @param[in] kValue The value to write.
+         */
+        void WriteInt(const int64_t kValue) noexcept;
+
+        /**
+         * @brief Ends the response.
+         *
+         * @details Ends the response. The buffered data is sent and the
+         * chunked transfer is terminated. Further writes are ignored.
+         */
+        void End(void) noexcept;
+
+        /**
+         * @brief Tells if the response was ended.
+         *
+         * @details Tells if the response was ended.
+         *
+         * @return The function returns true if the response was ended, false
+         * otherwise.
+         */
+        bool IsEnded(void) const noexcept;
+
+        /**
+         * @brief Returns the size of the response body.
+         *
+         * @details Returns the size of the response body written so far,
+         * buffered or sent.
+         *
+         * @return The number of body bytes written is returned.
+         */
+        size_t GetSize(void) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /**
+         * @brief Sends the buffered data as a chunk.
+         *
+         * @details Sends the buffered data as a chunk. The response headers
+         * are sent before the first chunk.
+         */
+        void Flush(void) noexcept;
+
+        /** @brief The server handling the request. */
+        WebServer* _pServer;
+        /** @brief The response status code. */
+        int32_t _code;
+        /** @brief The response content type. */
+        const char* _pkContentType;
+        /** @brief The number of bytes used in the buffer. */
+        size_t _used;
+        /** @brief The number of body bytes written. */
+        size_t _size;
+        /** @brief Tells if the response headers were sent. */
+        bool _isStarted;
+        /** @brief Tells if the response was ended. */
+        bool _isEnded;
+        /** @brief The response buffer. */
+        char* _pBuffer;
+        /** @brief The size of the response buffer in bytes. */
+        size_t _capacity;
+        /** @brief The buffer used without arena. */
+        char _pLocal[PAGE_SINK_BUFFER_SIZE];
+};
+
+#endif /* #ifndef __PAGE_SINK_H__ */
@@ -98,17 +98,23 @@ class RebootPageHandler : public PageHandler {
         virtual ~RebootPageHandler(void) noexcept;
 
         /**
-         * @brief Generates the reboot page.
+         * @brief Returns the reboot page title.
+         *
+         * @details Returns the reboot page title.
          *
-         * @details Generate the reboot page. The function generates the
-         * reboot page and title based on the current state of the system.
+         * @return The function returns the reboot page title.
+         */
+        virtual const char* GetTitle(void) const noexcept;
+
+        /**
+         * @brief Generates the reboot page.
          *
-         * @param[out] rPageTitle The title to give to the reboot page.
-         * @param[out] rPageBody The body to give to the reboot page.
+         * @details Generate the reboot page. The function writes the page body
+         * to the sink based on the current state of the system.
          *
+         * @param[out] rSink The sink that receives the reboot page body.
          */
-        virtual void Generate(std::string& rPageTitle,
-                              std::string& rPageBody) noexcept;
+        virtual void Generate(PageSink& rSink) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
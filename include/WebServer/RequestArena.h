@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * @file RequestArena.h
+ *
+ * @see RequestArena.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Per-request memory arena.
+ *
+ * @details Per-request memory arena. The buffers needed to handle a request
+ * are taken from a bump-pointer arena that is reset when the request
+ * completes, no memory is allocated from the heap while handling requests.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __REQUEST_ARENA_H__
+#define __REQUEST_ARENA_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard integer definitions */
+#include <cstddef> /* Standard size type */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef REQUEST_ARENA_SIZE
+/** @brief Defines the size of a request arena in bytes. */
+#define REQUEST_ARENA_SIZE 8192
+#endif
+
+/** @brief Defines the alignment of the arena allocations in bytes. */
+#define REQUEST_ARENA_ALIGN 8
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Request arena statistics. */
+typedef struct {
+    /** @brief The size of the arena in bytes. */
+    size_t size;
+    /** @brief The highest size used by a request in bytes. */
+    size_t peak;
+    /** @brief The number of completed requests. */
+    uint32_t requests;
+    /** @brief The number of allocations the arena could not serve. */
+    uint32_t failures;
+} S_RequestArenaStats;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The RequestArena class.
+ *
+ * @details The RequestArena class is a bump-pointer allocator over a buffer
+ * taken once from the web memory pool. The allocations of a request are
+ * never released one by one, the whole arena is reset when the request
+ * completes. The arena is not thread safe, it belongs to the task of its
+ * server.
+ */
+class RequestArena {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief RequestArena constructor.
+         *
+         * @param[in] kSize The size of the arena in bytes.
+         */
+        explicit RequestArena(const size_t kSize) noexcept;
+
+        /**
+         * @brief Destroys a RequestArena.
+         *
+         * @details Destroys a RequestArena. The arenas live as long as their
+         * server, the destructor will generate a critical error.
+         */
+        ~RequestArena(void) noexcept;
+
+        /**
+         * @brief Allocates memory for the current request.
+         *
+         * @param[in] kSize The size to allocate in bytes.
+         *
+         * @return The allocated memory is returned, aligned on
+         * REQUEST_ARENA_ALIGN bytes. nullptr is returned when the arena is
+         * exhausted.
+         */
+        void* Allocate(const size_t kSize) noexcept;
+
+        /**
+         * @brief Releases the memory of the completed request.
+         *
+         * @details Releases the memory of the completed request. Every
+         * pointer returned by the arena since the last reset is invalidated.
+         */
+        void Reset(void) noexcept;
+
+        /**
+         * @brief Returns the arena statistics.
+         *
+         * @param[out] rStats The buffer receiving the statistics.
+         */
+        void GetStats(S_RequestArenaStats& rStats) const noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The arena memory. */
+        uint8_t* _pMemory;
+        /** @brief The size of the arena in bytes. */
+        size_t _size;
+        /** @brief The bytes used by the current request. */
+        size_t _used;
+        /** @brief The arena statistics. */
+        S_RequestArenaStats _stats;
+};
+
+#endif /* #ifndef __REQUEST_ARENA_H__ */
@@ -0,0 +1,295 @@
+/*******************************************************************************
+ * @file RouteTable.h
+ *
+ * @see RouteTable.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief HTTP servers route table.
+ *
+ * @details HTTP servers route table. Routes are described by a constant table
+ * sorted by path, checked at compile time. Requests are matched on the raw URI
+ * bytes by binary search, without any allocation.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __ROUTE_TABLE_H__
+#define __ROUTE_TABLE_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>     /* Standard integer definitions */
+#include <cstddef>     /* Standard size type */
+#include <Arduino.h>   /* Arduino Framework */
+#include <WebServer.h> /* Web server services */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/**
+ * @brief Describes a route.
+ *
+ * @param[in] PATH The route path, a string literal.
+ * @param[in] METHOD The accepted method, HTTP_ANY accepts all the methods.
+ * @param[in] IS_PREFIX Tells if the path also matches the URIs it prefixes.
+ * @param[in] ID The route identifier given to the route handler.
+ */
+#define ROUTE(PATH, METHOD, IS_PREFIX, ID)                                  \
+    { PATH, sizeof(PATH) - 1, METHOD, IS_PREFIX, ID }
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Route descriptor. */
+typedef struct {
+    /** @brief The route path. */
+    const char* pkPath;
+    /** @brief The route path length in bytes. */
+    size_t pathLength;
+    /** @brief The accepted method. */
+    HTTPMethod method;
+    /** @brief Tells if the path also matches the URIs it prefixes. */
+    bool isPrefix;
+    /** @brief The route identifier. */
+    uint32_t id;
+} S_Route;
+
+/** @brief Defines the route lookup results. */
+typedef enum {
+    /** @brief A route accepts the URI and the method. */
+    ROUTE_MATCH = 0,
+    /** @brief No route matches the URI. */
+    ROUTE_NO_MATCH = 1,
+    /** @brief A route matches the URI but not the method. */
+    ROUTE_METHOD_MISMATCH = 2
+} E_RouteMatch;
+
+/**
+ * @brief Route handler, called with the matched route when a request is
+ * dispatched.
+ */
+typedef void (*RouteHandler)(const S_Route& krRoute);
+
+/**
+ * @brief Raw body handler, called with the matched route for each part of a
+ * raw request body.
+ */
+typedef void (*RouteRawHandler)(const S_Route& krRoute, HTTPRaw& rRaw);
+
+/**
+ * @brief Raw body filter, tells if the body of the matched route is received
+ * as raw data. Called once the request headers are parsed.
+ */
+typedef bool (*RouteRawFilter)(const S_Route& krRoute);
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The RouteTable class.
+ *
+ * @details The RouteTable class dispatches the requests of a server through a
+ * constant route table. The table is registered as a single request handler,
+ * the server does not walk one handler per route. Exact paths are found by
+ * binary search, the prefix routes are only scanned when no exact path
+ * matches and the longest prefix wins.
+ */
+class RouteTable : public RequestHandler {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief RouteTable constructor.
+         *
+         * @param[in] kpRoutes The route table, sorted by path. The table must
+         * outlive the object.
+         * @param[in] kCount The number of routes in the table.
+         * @param[in] handler The handler called with the matched routes.
+         */
+        RouteTable(const S_Route*     kpRoutes,
+                   const size_t       kCount,
+                   const RouteHandler handler) noexcept;
+
+        /**
+         * @brief Receives the body of a route as raw data.
+         *
+         * @details Receives the body of a route as raw data. The body is given
+         * to the raw handler as it is read, before the route handler is
+         * called. Only one route of the table is received as raw data.
+         *
+         * @param[in] kId The identifier of the route.
+         * @param[in] handler The handler called with the body parts.
+         */
+        void SetRawHandler(const uint32_t        kId,
+                           const RouteRawHandler handler) noexcept;
+
+        /**
+         * @brief Receives the body of the filtered routes as raw data.
+         *
+         * @details Receives the body of the routes accepted by the filter as
+         * raw data, in addition to the raw route. The bodies are given to the
+         * raw handler.
+         *
+         * @param[in] filter The filter of the routes, nullptr to disable it.
+         */
+        void SetRawFilter(const RouteRawFilter filter) noexcept;
+
+        /**
+         * @brief Finds the route of a request.
+         *
+         * @param[in] kpUri The request URI, without the query.
+         * @param[in] kLength The URI length in bytes.
+         * @param[in] kMethod The request method.
+         * @param[out] rMatch The lookup result.
+         *
+         * @return The matched route is returned, nullptr if no route accepts
+         * the request.
+         */
+        const S_Route* Find(const char*      kpUri,
+                            const size_t     kLength,
+                            const HTTPMethod kMethod,
+                            E_RouteMatch&    rMatch) const noexcept;
+
+        /**
+         * @brief Compares two null terminated paths at compile time.
+         *
+         * @param[in] kpLeft The first path.
+         * @param[in] kpRight The second path.
+         *
+         * @return A negative value if the first path sorts first, 0 if they
+         * are equal, a positive value otherwise.
+         */
+        static constexpr int32_t ComparePaths(const char* kpLeft,
+                                              const char* kpRight) noexcept {
+            return (*kpLeft != *kpRight || 0 == *kpLeft) ?
+                (int32_t)(uint8_t)*kpLeft - (int32_t)(uint8_t)*kpRight :
+                ComparePaths(kpLeft + 1, kpRight + 1);
+        }
+
+        /**
+         * @brief Tells if a route table is strictly sorted by path.
+         *
+         * @details Tells if a route table is strictly sorted by path. This is
+         * meant to be used in a static_assert next to the table definition.
+         *
+         * @param[in] kpRoutes The route table.
+         * @param[in] kCount The number of routes in the table.
+         *
+         * @return true if the table is sorted and has no duplicate path.
+         */
+        static constexpr bool IsSorted(const S_Route* kpRoutes,
+                                       const size_t   kCount) noexcept {
+            return (2 > kCount) ?
+                true :
+                (0 > ComparePaths(kpRoutes[0].pkPath, kpRoutes[1].pkPath) &&
+                 IsSorted(kpRoutes + 1, kCount - 1));
+        }
+
+        /**
+         * @brief Tells if a request can be handled by the table.
+         *
+         * @details Tells if a request can be handled by the table. The match
+         * is kept for the handle call that follows.
+         *
+         * @param[in] method The request method.
+         * @param[in] uri The request URI.
+         *
+         * @return true if a route accepts the request.
+         */
+        virtual bool canHandle(HTTPMethod method, String uri) override;
+
+        /**
+         * @brief Handles a request.
+         *
+         * @details Calls the route handler with the route found by canHandle.
+         *
+         * @param[in] server The server that received the request.
+         * @param[in] requestMethod The request method.
+         * @param[in] requestUri The request URI.
+         *
+         * @return true if the request was handled.
+         */
+        virtual bool handle(WebServer& server,
+                            HTTPMethod requestMethod,
+                            String     requestUri) override;
+
+        /**
+         * @brief Tells if the body of a request is received as raw data.
+         *
+         * @param[in] uri The request URI.
+         *
+         * @return true if the route found by canHandle is the raw route or
+         * is accepted by the raw filter.
+         */
+        virtual bool canRaw(String uri) override;
+
+        /**
+         * @brief Receives a part of a raw request body.
+         *
+         * @param[in] server The server that received the request.
+         * @param[in] requestUri The request URI.
+         * @param[in, out] raw The body part.
+         */
+        virtual void raw(WebServer& server,
+                         String     requestUri,
+                         HTTPRaw&   raw) override;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /** @brief The route table. */
+        const S_Route* _pkRoutes;
+        /** @brief The number of routes in the table. */
+        size_t _count;
+        /** @brief The handler called with the matched routes. */
+        RouteHandler _handler;
+        /** @brief The handler called with the raw body parts. */
+        RouteRawHandler _rawHandler;
+        /** @brief The filter of the other routes received as raw data. */
+        RouteRawFilter _rawFilter;
+        /** @brief The identifier of the route received as raw data. */
+        uint32_t _rawId;
+        /** @brief The route matched by the last canHandle call. */
+        const S_Route* _pkMatch;
+};
+
+#endif /* #ifndef __ROUTE_TABLE_H__ */
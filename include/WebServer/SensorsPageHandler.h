@@ -98,17 +98,23 @@ class SensorsPageHandler : public PageHandler {
         virtual ~SensorsPageHandler(void) noexcept;
 
         /**
-         * @brief Generates the sensors page.
+         * @brief Returns the sensors page title.
+         *
+         * @details Returns the sensors page title.
          *
-         * @details Generate the sensors page. The function generates the
-         * sensors page and title based on the current state of the system.
+         * @return The function returns the sensors page title.
+         */
+        virtual const char* GetTitle(void) const noexcept;
+
+        /**
+         * @brief Generates the sensors page.
          *
-         * @param[out] rPageTitle The title to give to the sensors page.
-         * @param[out] rPageBody The body to give to the sensors page.
+         * @details Generate the sensors page. The function writes the page body
+         * to the sink based on the current state of the system.
          *
+         * @param[out] rSink The sink that receives the sensors page body.
          */
-        virtual void Generate(std::string& rPageTitle,
-                              std::string& rPageBody) noexcept;
+        virtual void Generate(PageSink& rSink) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -98,17 +98,23 @@ class SettingsPageHandler : public PageHandler {
         virtual ~SettingsPageHandler(void) noexcept;
 
         /**
-         * @brief Generates the settings page.
+         * @brief Returns the settings page title.
+         *
+         * @details Returns the settings page title.
          *
-         * @details Generate the settings page. The function generates the
-         * settings page and title based on the current state of the system.
+         * @return The function returns the settings page title.
+         */
+        virtual const char* GetTitle(void) const noexcept;
+
+        /**
+         * @brief Generates the settings page.
          *
-         * @param[out] rPageTitle The title to give to the settings page.
-         * @param[out] rPageBody The body to give to the settings page.
+         * @details Generate the settings page. The function writes the page
+         * body to the sink based on the current state of the system.
          *
+         * @param[out] rSink The sink that receives the settings page body.
          */
-        virtual void Generate(std::string& rPageTitle,
-                              std::string& rPageBody) noexcept;
+        virtual void Generate(PageSink& rSink) noexcept;
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
     protected:
@@ -119,12 +125,12 @@ class SettingsPageHandler : public PageHandler {
         /**
          * @brief Generates the networks settings.
          *
-         * @details Generates the networks settings. The content is added to the
-         * page buffer given as parameter.
+         * @details Generates the networks settings. The content is written to
+         * the sink given as parameter.
          *
-         * @param[out] rPageBuffer The page buffer to fill.
+         * @param[out] rSink The sink that receives the settings.
          */
-        void GenerateNetworkSettings(std::string& rPageBuffer) const noexcept;
+        void GenerateNetworkSettings(PageSink& rSink) const noexcept;
 };
 
 #endif /* #ifndef __SETTINGS_PAGE_HANDLER_H__ */
\ No newline at end of file
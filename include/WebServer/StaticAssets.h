@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * @file StaticAssets.h
+ *
+ * @see StaticAssets.cpp
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Web servers static assets.
+ *
+ * @details Web servers static assets. Serves the flash-resident CSS and
+ * scripts as cacheable resources validated with their ETag.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __STATIC_ASSETS_H__
+#define __STATIC_ASSETS_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>     /* Standard integer definitions */
+#include <cstddef>     /* Standard size type */
+#include <WebServer.h> /* Web server services */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the size of an asset ETag, quotes and terminator included. */
+#define STATIC_ASSET_ETAG_SIZE 11
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Static asset descriptor. */
+typedef struct {
+    /** @brief The URL the asset is served at. */
+    const char* pkUrl;
+    /** @brief The asset content type. */
+    const char* pkContentType;
+    /** @brief The flash-resident asset content. */
+    const uint8_t* pkData;
+    /** @brief The asset content size in bytes. */
+    size_t size;
+    /** @brief The flash-resident gzip encoded content, nullptr if none. */
+    const uint8_t* pkGzData;
+    /** @brief The gzip encoded content size in bytes. */
+    size_t gzSize;
+    /** @brief The asset entity tag, computed when the asset is registered. */
+    char pETag[STATIC_ASSET_ETAG_SIZE];
+    /** @brief The gzip encoded asset entity tag. */
+    char pGzETag[STATIC_ASSET_ETAG_SIZE];
+} S_StaticAsset;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASSES
+ ******************************************************************************/
+
+/**
+ * @brief The StaticAssets class.
+ *
+ * @details The StaticAssets class registers the static assets on a server.
+ * Assets are sent with their ETag and revalidated by the browsers, unchanged
+ * assets are answered with 304 Not Modified. Assets compressed at build time
+ * are sent gzip encoded to the clients accepting it.
+ */
+class StaticAssets {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Registers the static assets on a server.
+         *
+         * @details Registers the static assets on a server. The assets ETags
+         * are computed and the request headers needed to validate the cached
+         * assets are collected by the server.
+         *
+         * @param[in] pServer The server serving the assets.
+         * @param[in, out] pAssets The assets to register. The table must
+         * outlive the server.
+         * @param[in] kCount The number of assets in the table.
+         */
+        static void Register(WebServer*     pServer,
+                             S_StaticAsset* pAssets,
+                             const size_t   kCount) noexcept;
+
+        /**
+         * @brief Sends a static asset.
+         *
+         * @details Sends a static asset. The gzip encoded content is sent
+         * when the client accepts it. When the request validates the ETag of
+         * the selected encoding, only the 304 Not Modified status is sent.
+         *
+         * @param[in] pServer The server handling the request.
+         * @param[in] krAsset The asset to send.
+         */
+        static void Send(WebServer* pServer, const S_StaticAsset& krAsset)
+        noexcept;
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /* None */
+
+    /********************* PRIVATE METHODS AND ATTRIBUTES *********************/
+    private:
+        /* None */
+};
+
+#endif /* #ifndef __STATIC_ASSETS_H__ */
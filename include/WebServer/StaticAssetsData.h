@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * @file StaticAssetsData.h
+ *
+ * @see StaticAssets.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Weather Station Firmware static assets content.
+ *
+ * @details Weather Station Firmware static assets content. This file is
+ * auto-generated from the webassets directory and contains the identity and
+ * gzip encoded content of the static assets served by the firmware.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+#ifndef __STATIC_ASSETS_DATA_H__
+#define __STATIC_ASSETS_DATA_H__
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard int types */
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Content type of the style.css asset. */
+#define ASSET_STYLE_CSS_TYPE "text/css"
+/** @brief Identity size of the style.css asset. */
+#define ASSET_STYLE_CSS_SIZE 127
+/** @brief Gzip encoded size of the style.css asset. */
+#define ASSET_STYLE_CSS_GZ_SIZE 120
+/** @brief Content type of the maintenance.css asset. */
+#define ASSET_MAINTENANCE_CSS_TYPE "text/css"
+/** @brief Identity size of the maintenance.css asset. */
+#define ASSET_MAINTENANCE_CSS_SIZE 180
+/** @brief Gzip encoded size of the maintenance.css asset. */
+#define ASSET_MAINTENANCE_CSS_GZ_SIZE 136
+/** @brief Content type of the maintenance.js asset. */
+#define ASSET_MAINTENANCE_JS_TYPE "application/javascript"
+/** @brief Identity size of the maintenance.js asset. */
+#define ASSET_MAINTENANCE_JS_SIZE 2326
+/** @brief Gzip encoded size of the maintenance.js asset. */
+#define ASSET_MAINTENANCE_JS_GZ_SIZE 783
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/** @brief Identity content of the style.css asset. */
+extern const uint8_t gkAssetStyleCss[];
+/** @brief Gzip encoded content of the style.css asset. */
+extern const uint8_t gkAssetStyleCssGz[];
+/** @brief Identity content of the maintenance.css asset. */
+extern const uint8_t gkAssetMaintenanceCss[];
+/** @brief Gzip encoded content of the maintenance.css asset. */
+extern const uint8_t gkAssetMaintenanceCssGz[];
+/** @brief Identity content of the maintenance.js asset. */
+extern const uint8_t gkAssetMaintenanceJs[];
+/** @brief Gzip encoded content of the maintenance.js asset. */
+extern const uint8_t gkAssetMaintenanceJsGz[];
+
+/************************** Static global variables ***************************/
+/* None */
+
+#endif /* #ifndef __STATIC_ASSETS_DATA_H__ */
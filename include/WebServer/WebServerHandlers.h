@@ -23,11 +23,14 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <Errors.h>      /* Errors definitions */
-#include <Arduino.h>     /* Arduino Framework */
-#include <WebServer.h>   /* Web server services */
-#include <PageHandler.h> /* Page Handlers */
-#include <unordered_map> /* Standard maps */
+#include <Errors.h>       /* Errors definitions */
+#include <Arduino.h>      /* Arduino Framework */
+#include <WebServer.h>    /* Web server services */
+#include <PageSink.h>     /* Page output sink */
+#include <RouteTable.h>   /* Route table */
+#include <PageHandler.h>  /* Page Handlers */
+#include <EventStream.h>  /* Live events stream */
+#include <RequestArena.h> /* Per-request arena */
 
 /*******************************************************************************
  * CONSTANTS
@@ -43,7 +46,25 @@
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-/* None */
+/** @brief Defines the page routes identifiers. */
+typedef enum {
+    /** @brief Index page. */
+    PAGE_ROUTE_INDEX = 0,
+    /** @brief About page. */
+    PAGE_ROUTE_ABOUT = 1,
+    /** @brief Monitor page. */
+    PAGE_ROUTE_MONITOR = 2,
+    /** @brief Reboot page. */
+    PAGE_ROUTE_REBOOT = 3,
+    /** @brief Sensors page. */
+    PAGE_ROUTE_SENSORS = 4,
+    /** @brief Settings page. */
+    PAGE_ROUTE_SETTINGS = 5,
+    /** @brief Live events stream, served without a page handler. */
+    PAGE_ROUTE_EVENTS = 6,
+    /** @brief Number of page routes. */
+    PAGE_ROUTE_COUNT = 7
+} E_PageRoute;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -109,36 +130,37 @@ class WebServerHandlers {
         WebServer* GetServer(void) const noexcept;
 
         /**
-         * @brief Creates the page header.
+         * @brief Returns the live events stream of the server.
          *
-         * @details Creates the page header. This will fill the string buffer
-         * and use the appropriate page title.
+         * @details Returns the live events stream of the server. The stream
+         * must be updated by the task serving the server.
          *
-         * @param[out] rHeaderStr The string buffer that receives the header.
-         * @param[in] krTitle The page title to set.
+         * @return The function returns the live events stream.
          */
-        void GetPageHeader(std::string&       rHeaderStr,
-                           const std::string& krTitle) const noexcept;
+        EventStream* GetEventStream(void) const noexcept;
+
         /**
-         * @brief Creates the page footer.
+         * @brief Writes the page header.
          *
-         * @details Creates the page footer. This will fill the string buffer.
+         * @details Writes the constant page shell header to the sink and
+         * inserts the page title.
          *
-         * @param[out] rFooterStr The string buffer that receives the footer.
+         * @param[out] rSink The sink that receives the header.
+         * @param[in] kpTitle The page title to set.
          */
-        void GetPageFooter(std::string& rFooterStr) const noexcept;
+        void WritePageHeader(PageSink&   rSink,
+                             const char* kpTitle) const noexcept;
 
         /**
-         * @brief Generic page handler.
+         * @brief Ends the page.
          *
-         * @details Generic page handler. The handler will send the page
-         * to the requesting server.
+         * @details Writes the page footer and terminates the response. Page
+         * handlers that must act after the response was delivered can call
+         * this early, the function does nothing when the page already ended.
          *
-         * @param[in] kpPage The page to send.
-         * @param[in] kCode The code to respond.
+         * @param[out] rSink The sink to terminate.
          */
-        void GenericHandler(const std::string& krPage,
-                            const int32_t      kCode) noexcept;
+        void EndPage(PageSink& rSink) const noexcept;
 
 
     /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
@@ -155,28 +177,47 @@ class WebServerHandlers {
         static void HandleNotFound(void) noexcept;
 
         /**
-         * @brief Handles the registered URLs.
+         * @brief Handles the routed URLs.
+         *
+         * @details Handles the routed URLs. The request is dispatched to the
+         * events stream or to the page of the route.
          *
-         * @details Handles the registered URLs. If the URL is not found in the
-         * handlers table, the HM is notified.
+         * @param[in] krRoute The route matched by the request.
          */
-        static void HandleKnownURL(void) noexcept;
+        static void HandleRoute(const S_Route& krRoute) noexcept;
 
         /**
-         * @brief Creates the page CSS section.
+         * @brief Handles the page routes.
          *
-         * @details Creates the page CSS section. This will fill the string
-         * buffer.
+         * @details Handles the page routes. The page of the route is
+         * generated and streamed to the client.
+         *
+         * @param[in] krRoute The route matched by the request.
+         */
+        static void HandlePage(const S_Route& krRoute) noexcept;
+
+        /**
+         * @brief Handles the events stream route.
          *
-         * @param[out] rHeaderStr The string buffer that receives the CSS.
+         * @details Handles the events stream route. The client is attached to
+         * the live events stream, or refused when the stream is full.
          */
-        void GeneratePageCSS(std::string& rHeaderStr) const noexcept;
+        static void HandleEvents(void) noexcept;
 
         /** @brief Stores the WebServer used by the handlers. */
         WebServer* _pServer;
 
-        /** @brief Stores the registered handlers for the pages. */
-        std::unordered_map<std::string, PageHandler*> _pageHandlers;
+        /** @brief Stores the live events stream. */
+        EventStream* _pEvents;
+
+        /** @brief Stores the arena of the request being handled. */
+        RequestArena* _pArena;
+
+        /** @brief Stores the handlers of the pages, by route identifier. */
+        PageHandler* _pPageHandlers[E_PageRoute::PAGE_ROUTE_COUNT];
+
+        /** @brief Stores the statistics identifiers, by route identifier. */
+        uint32_t _pStatsIds[E_PageRoute::PAGE_ROUTE_COUNT];
 };
 
 #endif /* #ifndef __WEB_SERVER_HANDLERS_H__ */
\ No newline at end of file
@@ -1,5 +1,16 @@
 import yaml
 
+# Number of bytes per line of the generated defaults table
+BYTES_PER_LINE = 12
+
+# Size in bytes of the generated integer types
+INTEGER_SIZES = {
+    "uint8_t": 1, "int8_t": 1,
+    "uint16_t": 2, "int16_t": 2,
+    "uint32_t": 4, "int32_t": 4,
+    "uint64_t": 8, "int64_t": 8
+}
+
 def BuildFileStart(sourceFile):
     sourceFile.write(
         "/*******************************************************************************\n" +
@@ -17,6 +28,8 @@ def BuildFileStart(sourceFile):
         " *\n" +
         " * @details Weather Station Firmware default setting repository. This file \n" +
         " * is auto-generated and contains the default settings used by the firmware.\n" +
+        " * The defaults are a constant table laid out as the settings values, it is\n" +
+        " * kept in flash.\n" +
         " *\n" +
         " * @copyright Alexy Torres Aurora Dugo\n" +
         " ******************************************************************************/\n" +
@@ -26,11 +39,12 @@ def BuildFileStart(sourceFile):
         " ******************************************************************************/\n" +
         "#include <cstdint>       /* Standard int types */\n" +
         "#include <Settings.h>    /* Settings */\n" +
-        "#include <unordered_map> /* Settings map */" +
+        "#include <SettingsIds.h> /* Settings identifiers */\n" +
         "\n" +
         "/*******************************************************************************\n" +
         " * CONSTANTS\n" +
         " ******************************************************************************/\n" +
+        "/* None */\n" +
         "\n" +
         "/*******************************************************************************\n" +
         " * STRUCTURES AND TYPES\n" +
@@ -61,6 +75,34 @@ def BuildFileStart(sourceFile):
     )
 
 
+def GetValueBytes(key, value):
+    size = int(value["size"])
+    kind = value["type"]
+    raw = value["value"]
+
+    if "bool" == kind:
+        data = bytes([1 if "true" == str(raw).lower() else 0])
+    elif kind in INTEGER_SIZES:
+        data = int(raw).to_bytes(
+            INTEGER_SIZES[kind],
+            "little",
+            signed=not kind.startswith("u")
+        )
+    elif '*' in kind:
+        # The value is a C string literal, escapes included
+        literal = str(raw).strip()
+        if literal.startswith('"') and literal.endswith('"'):
+            literal = literal[1:-1]
+        data = literal.encode("latin-1").decode("unicode_escape").encode("latin-1")
+    else:
+        raise ValueError("Unsupported type {} for setting {}".format(kind, key))
+
+    if len(data) > size:
+        raise ValueError("Default value of setting {} exceeds {} bytes".format(key, size))
+
+    return data + bytes(size - len(data))
+
+
 def BuildSettings(sourceFile, settingPath):
     with open(settingPath, 'r', encoding="utf-8") as file:
         # Load the settings
@@ -70,10 +112,23 @@ def BuildSettings(sourceFile, settingPath):
         except yaml.YAMLError as exc:
             print(exc)
 
+        sourceFile.write(
+            "/**\n" +
+            " * @brief Default settings values, by setting offset. The names are only\n" +
+            " * resolved to identifiers, no default is copied in memory.\n" +
+            " */\n" +
+            "static constexpr uint8_t skSettingsDefaults[SETTINGS_VALUES_SIZE] = {\n"
+        )
+        lines = []
         for key, value in loaded.items():
             print("==== Setting: {}".format(key))
-            sourceFile.write("/** @brief Default setting for {} item. */\n".format(key))
-            sourceFile.write("static const {} sk{} = {};\n".format(value["type"], key, value["value"]))
+            data = GetValueBytes(key, value)
+            lines.append("    /* {} */".format(key))
+            for i in range(0, len(data), BYTES_PER_LINE):
+                lines.append("    " + ", ".join(
+                    "0x{:02X}".format(b) for b in data[i:i + BYTES_PER_LINE]
+                ) + ",")
+        sourceFile.write("\n".join(lines) + "\n};\n")
 
         sourceFile.write("\n")
         return loaded
@@ -91,27 +146,11 @@ def BuildFileNext(sourceFile):
     )
 
 def BuildFileInit(sourceFile, settings):
-    sourceFile.write("void Settings::InitializeDefault(void) noexcept {\n")
-    for key, value in settings.items():
-        addRef = True
-        if '*' in value["type"]:
-            addRef = False
-        sourceFile.write(
-            "\tthis->_defaults.emplace(\n" +
-            f"\t\t{'SETTING_' + key.upper()},\n" +
-            "\t\tS_SettingField {\n")
-
-        if addRef:
-            sourceFile.write(f"\t\t\t.pValue = (uint8_t*)&sk{key},\n")
-        else:
-            sourceFile.write(f"\t\t\t.pValue = (uint8_t*)sk{key},\n")
-
-        sourceFile.write(
-            f"\t\t\t.fieldSize = {value['size']}\n" +
-            "\t\t}\n" +
-            "\t);\n")
-
-    sourceFile.write("}")
+    sourceFile.write(
+        "const uint8_t* Settings::GetDefaultValue(const E_SettingId kId) noexcept {\n" +
+        "    return skSettingsDefaults + SettingOffset(kId);\n" +
+        "}\n"
+    )
 
 
 def GenerateDerfaultSettings(settingPath, sourcePath):
@@ -119,4 +158,155 @@ def GenerateDerfaultSettings(settingPath, sourcePath):
         BuildFileStart(sourceFile)
         settings = BuildSettings(sourceFile, settingPath)
         BuildFileNext(sourceFile)
-        BuildFileInit(sourceFile, settings)
\ No newline at end of file
+        BuildFileInit(sourceFile, settings)
+
+
+def BuildIdsFile(headerFile, settings):
+    headerFile.write(
+        "/*******************************************************************************\n" +
+        " * @file SettingsIds.h\n" +
+        " *\n" +
+        " * @see Settings.h\n" +
+        " *\n" +
+        " * @author Alexy Torres Aurora Dugo\n" +
+        " *\n" +
+        " * @date 18/12/2025\n" +
+        " *\n" +
+        " * @version 1.0\n" +
+        " *\n" +
+        " * @brief Weather Station Firmware setting identifiers.\n" +
+        " *\n" +
+        " * @details Weather Station Firmware setting identifiers. This file is\n" +
+        " * auto-generated and contains the names, identifiers, offsets and sizes of\n" +
+        " * the settings used by the firmware.\n" +
+        " *\n" +
+        " * @copyright Alexy Torres Aurora Dugo\n" +
+        " ******************************************************************************/\n" +
+        "\n" +
+        "#ifndef __SETTINGS_IDS_H__\n" +
+        "#define __SETTINGS_IDS_H__\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * INCLUDES\n" +
+        " ******************************************************************************/\n" +
+        "#include <cstddef> /* Standard size types */\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * CONSTANTS\n" +
+        " ******************************************************************************/\n"
+    )
+
+    for key in settings.keys():
+        headerFile.write("/** @brief Defines the {} setting key. */\n".format(key))
+        headerFile.write("#define {} \"{}\"\n".format('SETTING_' + key.upper(), key))
+
+    total = 0
+    for value in settings.values():
+        total += int(value["size"])
+    headerFile.write(
+        "\n" +
+        "/** @brief Defines the size of all the identified settings values. */\n" +
+        "#define SETTINGS_VALUES_SIZE {}\n".format(total) +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * MACROS\n" +
+        " ******************************************************************************/\n" +
+        "/* None */\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * STRUCTURES AND TYPES\n" +
+        " ******************************************************************************/\n" +
+        "\n" +
+        "/** @brief Identifiers of the settings. */\n" +
+        "typedef enum {\n"
+    )
+    for idx, key in enumerate(settings.keys()):
+        headerFile.write("    /** @brief Identifier of the {} setting. */\n".format(key))
+        headerFile.write("    {} = {},\n".format('SETTING_ID_' + key.upper(), idx))
+    headerFile.write(
+        "    /** @brief Number of identified settings. */\n" +
+        "    SETTING_ID_MAX = {}\n".format(len(settings)) +
+        "} E_SettingId;\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * GLOBAL VARIABLES\n" +
+        " ******************************************************************************/\n" +
+        "\n" +
+        "/** @brief Names of the identified settings. */\n" +
+        "static constexpr const char* skSettingNames[SETTING_ID_MAX] = {\n"
+    )
+    headerFile.write(",\n".join(
+        "    " + 'SETTING_' + key.upper() for key in settings.keys()
+    ) + "\n};\n\n")
+
+    headerFile.write(
+        "/** @brief Offsets of the identified settings values. */\n" +
+        "static constexpr size_t skSettingOffsets[SETTING_ID_MAX] = {\n"
+    )
+    offsets = []
+    offset = 0
+    for value in settings.values():
+        offsets.append("    {}".format(offset))
+        offset += int(value["size"])
+    headerFile.write(",\n".join(offsets) + "\n};\n\n")
+
+    headerFile.write(
+        "/** @brief Sizes of the identified settings values. */\n" +
+        "static constexpr size_t skSettingSizes[SETTING_ID_MAX] = {\n"
+    )
+    headerFile.write(",\n".join(
+        "    {}".format(value["size"]) for value in settings.values()
+    ) + "\n};\n\n")
+
+    headerFile.write(
+        "/*******************************************************************************\n" +
+        " * FUNCTIONS\n" +
+        " ******************************************************************************/\n" +
+        "\n" +
+        "/**\n" +
+        " * @brief Gets the name of a setting.\n" +
+        " *\n" +
+        " * @param[in] kId The setting identifier.\n" +
+        " *\n" +
+        " * @return The setting name is returned.\n" +
+        " */\n" +
+        "constexpr const char* SettingName(const E_SettingId kId) noexcept {\n" +
+        "    return skSettingNames[kId];\n" +
+        "}\n" +
+        "\n" +
+        "/**\n" +
+        " * @brief Gets the offset of a setting value in the settings values.\n" +
+        " *\n" +
+        " * @param[in] kId The setting identifier.\n" +
+        " *\n" +
+        " * @return The setting value offset is returned.\n" +
+        " */\n" +
+        "constexpr size_t SettingOffset(const E_SettingId kId) noexcept {\n" +
+        "    return skSettingOffsets[kId];\n" +
+        "}\n" +
+        "\n" +
+        "/**\n" +
+        " * @brief Gets the size of a setting value.\n" +
+        " *\n" +
+        " * @param[in] kId The setting identifier.\n" +
+        " *\n" +
+        " * @return The setting value size is returned.\n" +
+        " */\n" +
+        "constexpr size_t SettingSize(const E_SettingId kId) noexcept {\n" +
+        "    return skSettingSizes[kId];\n" +
+        "}\n" +
+        "\n" +
+        "#endif /* #ifndef __SETTINGS_IDS_H__ */\n"
+    )
+
+
+def GenerateSettingIds(settingPath, headerPath):
+    with open(settingPath, 'r', encoding="utf-8") as file:
+        settings = {}
+        try:
+            settings = yaml.safe_load(file)
+        except yaml.YAMLError as exc:
+            print(exc)
+
+    with open(headerPath, 'w', encoding="utf-8") as headerFile:
+        BuildIdsFile(headerFile, settings)
@@ -0,0 +1,278 @@
+/*******************************************************************************
+ * @file APIRequest.cpp
+ *
+ * @see APIRequest.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief API call parameters.
+ *
+ * @details API call parameters. The API handlers retrieve the parameters of a
+ * call through this interface, the parameters come either from the server
+ * request or from a sub-request of a batch call.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>     /* Standard integer definitions */
+#include <cstring>     /* String manipulation */
+#include <Arduino.h>   /* Arduino Framework */
+#include <WebServer.h> /* Web server services */
+
+/* Header file */
+#include <APIRequest.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Returns the value of an hexadecimal digit.
+ *
+ * @param[in] kDigit The digit character.
+ *
+ * @return The digit value is returned, -1 if the character is not an
+ * hexadecimal digit.
+ */
+static int32_t HexValue(const char kDigit) noexcept;
+
+/**
+ * @brief Decodes an URL encoded string in place.
+ *
+ * @details Decodes an URL encoded string in place. '+' is decoded as a space
+ * and the %XX sequences as their byte. Invalid sequences are kept as is.
+ *
+ * @param[in, out] pStr The null terminated string to decode.
+ */
+static void DecodeURL(char* pStr) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static int32_t HexValue(const char kDigit) noexcept {
+    int32_t value;
+
+    if ('0' <= kDigit && '9' >= kDigit) {
+        value = kDigit - '0';
+    }
+    else if ('a' <= kDigit && 'f' >= kDigit) {
+        value = kDigit - 'a' + 10;
+    }
+    else if ('A' <= kDigit && 'F' >= kDigit) {
+        value = kDigit - 'A' + 10;
+    }
+    else {
+        value = -1;
+    }
+
+    return value;
+}
+
+static void DecodeURL(char* pStr) noexcept {
+    const char* pkRead;
+    char*       pWrite;
+    int32_t     high;
+    int32_t     low;
+
+    pkRead = pStr;
+    pWrite = pStr;
+    while (0 != *pkRead) {
+        high = -1;
+        low = -1;
+        if ('%' == *pkRead && 0 != pkRead[1]) {
+            high = HexValue(pkRead[1]);
+            low = HexValue(pkRead[2]);
+        }
+
+        if (0 <= high && 0 <= low) {
+            *pWrite = (char)((high << 4) | low);
+            pkRead += 3;
+        }
+        else if ('+' == *pkRead) {
+            *pWrite = ' ';
+            ++pkRead;
+        }
+        else {
+            *pWrite = *pkRead;
+            ++pkRead;
+        }
+        ++pWrite;
+    }
+    *pWrite = 0;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+ServerAPIRequest::ServerAPIRequest(WebServer* pServer) noexcept {
+    this->_pServer = pServer;
+    this->_pkBody = nullptr;
+    this->_bodySize = 0;
+}
+
+ServerAPIRequest::~ServerAPIRequest(void) noexcept {
+}
+
+uint32_t ServerAPIRequest::GetArgCount(void) const noexcept {
+    return (uint32_t)this->_pServer->args();
+}
+
+String ServerAPIRequest::GetArgName(const uint32_t kIndex) const noexcept {
+    return this->_pServer->argName((int)kIndex);
+}
+
+String ServerAPIRequest::GetArg(const uint32_t kIndex) const noexcept {
+    return this->_pServer->arg((int)kIndex);
+}
+
+String ServerAPIRequest::GetNamedArg(const char* kpName) const noexcept {
+    return this->_pServer->arg(String(kpName));
+}
+
+bool ServerAPIRequest::GetBody(const uint8_t*& rpkData,
+                               size_t&         rSize) const noexcept {
+    if (nullptr != this->_pkBody) {
+        rpkData = this->_pkBody;
+        rSize = this->_bodySize;
+    }
+
+    return nullptr != this->_pkBody;
+}
+
+void ServerAPIRequest::SetBody(const uint8_t* kpData,
+                               const size_t   kSize) noexcept {
+    this->_pkBody = kpData;
+    this->_bodySize = kSize;
+}
+
+QueryAPIRequest::QueryAPIRequest(char* pQuery) noexcept {
+    char* pCursor;
+    char* pNext;
+    char* pValue;
+
+    this->_count = 0;
+    this->_isOverflowed = false;
+
+    pCursor = pQuery;
+    while (nullptr != pCursor && 0 != *pCursor) {
+        pNext = strchr(pCursor, '&');
+        if (nullptr != pNext) {
+            *pNext = 0;
+            ++pNext;
+        }
+
+        /* Empty pairs are skipped */
+        if (0 != *pCursor) {
+            if (API_REQUEST_MAX_ARGS > this->_count) {
+                pValue = strchr(pCursor, '=');
+                if (nullptr != pValue) {
+                    *pValue = 0;
+                    ++pValue;
+                }
+                else {
+                    pValue = pCursor + strlen(pCursor);
+                }
+
+                DecodeURL(pCursor);
+                DecodeURL(pValue);
+                this->_pkNames[this->_count] = pCursor;
+                this->_pkValues[this->_count] = pValue;
+                ++this->_count;
+            }
+            else {
+                this->_isOverflowed = true;
+            }
+        }
+
+        pCursor = pNext;
+    }
+}
+
+QueryAPIRequest::~QueryAPIRequest(void) noexcept {
+}
+
+bool QueryAPIRequest::IsOverflowed(void) const noexcept {
+    return this->_isOverflowed;
+}
+
+uint32_t QueryAPIRequest::GetArgCount(void) const noexcept {
+    return this->_count;
+}
+
+String QueryAPIRequest::GetArgName(const uint32_t kIndex) const noexcept {
+    String name;
+
+    if (this->_count > kIndex) {
+        name = this->_pkNames[kIndex];
+    }
+
+    return name;
+}
+
+String QueryAPIRequest::GetArg(const uint32_t kIndex) const noexcept {
+    String value;
+
+    if (this->_count > kIndex) {
+        value = this->_pkValues[kIndex];
+    }
+
+    return value;
+}
+
+String QueryAPIRequest::GetNamedArg(const char* kpName) const noexcept {
+    String   value;
+    uint32_t i;
+    bool     isFound;
+
+    isFound = false;
+    for (i = 0; this->_count > i && !isFound; ++i) {
+        if (0 == strcmp(this->_pkNames[i], kpName)) {
+            value = this->_pkValues[i];
+            isFound = true;
+        }
+    }
+
+    return value;
+}
+
+bool QueryAPIRequest::GetBody(const uint8_t*& rpkData,
+                              size_t&         rSize) const noexcept {
+    (void)rpkData;
+    (void)rSize;
+
+    return false;
+}
@@ -21,17 +21,44 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
 /* Included headers */
-#include <Errors.h>        /* Errors definitions */
-#include <Logger.h>        /* Logger services */
-#include <Arduino.h>       /* Arduino Framework */
-#include <Settings.h>      /* Settings services */
-#include <WebServer.h>     /* Web server services */
+#include <cstdio>            /* Standard IO */
+#include <cstring>           /* String manipulation */
+#include <BSP.h>             /* Time services */
+#include <Errors.h>          /* Errors definitions */
+#include <Logger.h>          /* Logger services */
+#include <Arduino.h>         /* Arduino Framework */
+#include <Settings.h>        /* Settings services */
+#include <WebServer.h>       /* Web server services */
+#include <JsonWriter.h>      /* JSON response writer */
+#include <RouteTable.h>      /* Route table */
+#include <APIRequest.h>      /* API call parameters */
+#include <KeepAliveServer.h> /* Persistent connections server */
+#include <WiFiModule.h>      /* WiFi module */
+#include <WiFiPower.h>       /* WiFi power-save scheduler */
+#include <SystemState.h>     /* System state object */
+#include <HandlerStats.h>    /* Request handlers statistics */
+#include <Metrics.h>         /* Metrics counters */
+#include <Tracer.h>          /* Events tracer */
 
 /* Handlers */
 #include <APIHandler.h>            /* API handler interface */
 #include <PingAPIHandler.h>        /* Ping handler */
 #include <WiFiSettingAPIHandler.h> /* WiFi Settings handler */
+#include <TimingAPIHandler.h>      /* Timing statistics handler */
+#include <BootAPIHandler.h>        /* Boot trace handler */
+#include <PowerAPIHandler.h>       /* WiFi power-save handler */
+#include <HistoryAPIHandler.h>     /* History handler */
+#include <MonitorAPIHandler.h>     /* System monitor handler */
+#include <LoadAPIHandler.h>        /* Load statistics handler */
+#include <TasksAPIHandler.h>       /* Tasks placement handler */
+#include <OtaAPIHandler.h>         /* Firmware update handler */
+#include <MetricsAPIHandler.h>     /* Prometheus metrics handler */
+#include <TraceAPIHandler.h>       /* Events trace handler */
+#include <TelemetryAPIHandler.h>   /* Telemetry settings handler */
 
 /* Header file */
 #include <APIServerHandlers.h>
@@ -44,6 +71,48 @@
 #define API_URL_PING "/ping"
 /** @brief Defines the ping URL */
 #define API_URL_WIFI "/wifi"
+/** @brief Defines the timing statistics URL */
+#define API_URL_TIMING "/timing"
+/** @brief Defines the batch URL */
+#define API_URL_BATCH "/batch"
+/** @brief Defines the boot trace URL */
+#define API_URL_BOOT "/boot"
+/** @brief Defines the WiFi power-save URL */
+#define API_URL_POWER "/power"
+/** @brief Defines the history URL */
+#define API_URL_HISTORY "/history"
+/** @brief Defines the system monitor URL */
+#define API_URL_MONITOR "/monitor"
+/** @brief Defines the load statistics URL */
+#define API_URL_LOAD "/load"
+/** @brief Defines the tasks placement URL */
+#define API_URL_TASKS "/tasks"
+/** @brief Defines the firmware update URL */
+#define API_URL_OTA "/ota"
+/** @brief Defines the firmware update data URL */
+#define API_URL_OTA_DATA "/ota/data"
+/** @brief Defines the Prometheus metrics URL */
+#define API_URL_METRICS "/metrics"
+/** @brief Defines the events trace URL */
+#define API_URL_TRACE "/trace"
+/** @brief Defines the telemetry settings URL */
+#define API_URL_TELEMETRY "/telemetry"
+
+/** @brief Defines the parameter holding a batched request. */
+#define API_BATCH_ARG "req"
+
+/** @brief Defines the server name of the handlers statistics. */
+#define API_STATS_SERVER "api"
+
+/** @brief Defines the size of the formatted error messages. */
+#define API_MSG_SIZE 96
+
+/** @brief Defines the header holding the accepted response types. */
+#define API_ACCEPT_HEADER "Accept"
+/** @brief Defines the header holding the request body type. */
+#define API_CONTENT_TYPE_HEADER "Content-Type"
+/** @brief Defines the CBOR content type. */
+#define API_CONTENT_TYPE_CBOR "application/cbor"
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
@@ -59,23 +128,29 @@
  * @details  Creates a new API handler. This will add the handler to the
  * handlers table and generate a HM event in case of error.
  *
- * @param[in] URL The URL to handle.
+ * @param[in] ROUTE_ID The route handled by the handler.
  * @param[in] HANDLER_CLASS The class of the object used to handle the URL.
- * @param[out] HANDLER_OBJ The object that gets assigned the new handler.
  */
-#define CREATE_NEW_HANDLER(URL, HANDLER_CLASS, HANDLER_OBJ) {               \
-    HANDLER_OBJ = new HANDLER_CLASS();                                      \
-    if (nullptr == HANDLER_OBJ) {                                           \
-        PANIC("Failed to allocate a new handler for API %s.\n", URL)        \
+#define CREATE_NEW_HANDLER(ROUTE_ID, HANDLER_CLASS) {                       \
+    this->_pApiHandlers[ROUTE_ID] = new HANDLER_CLASS();                    \
+    if (nullptr == this->_pApiHandlers[ROUTE_ID]) {                         \
+        PANIC("Failed to allocate a new handler for API %d.\n", ROUTE_ID)   \
     }                                                                       \
-    this->_apiHandlers.emplace(URL, HANDLER_OBJ);                           \
-    this->_pServer->on(URL, HTTP_POST, HandleKnownURL);                     \
 }
 
 /*******************************************************************************
  * STATIC FUNCTIONS DECLARATIONS
  ******************************************************************************/
-/* None */
+/**
+ * @brief Adds an error message embedding the request URI.
+ *
+ * @param[out] rWriter The response writer.
+ * @param[in] kpFormat The message format, with one string conversion.
+ * @param[in] kpUri The request URI.
+ */
+static void WriteURIError(JsonWriter& rWriter,
+                          const char* kpFormat,
+                          const char* kpUri) noexcept;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -91,16 +166,52 @@
 /** @brief Stores the current API server instance. */
 static APIServerHandlers* spInstance = nullptr;
 
+/** @brief The API server routes, sorted by path. */
+static constexpr S_Route skRoutes[] = {
+    ROUTE(API_URL_BATCH, HTTP_POST, false, E_APIRoute::API_ROUTE_BATCH),
+    ROUTE(API_URL_BOOT, HTTP_POST, false, E_APIRoute::API_ROUTE_BOOT),
+    ROUTE(API_URL_HISTORY, HTTP_POST, false, E_APIRoute::API_ROUTE_HISTORY),
+    ROUTE(API_URL_LOAD, HTTP_POST, false, E_APIRoute::API_ROUTE_LOAD),
+    ROUTE(API_URL_METRICS, HTTP_GET, false, E_APIRoute::API_ROUTE_METRICS),
+    ROUTE(API_URL_MONITOR, HTTP_POST, false, E_APIRoute::API_ROUTE_MONITOR),
+    ROUTE(API_URL_OTA, HTTP_POST, false, E_APIRoute::API_ROUTE_OTA),
+    ROUTE(API_URL_OTA_DATA, HTTP_POST, false, E_APIRoute::API_ROUTE_OTA_DATA),
+    ROUTE(API_URL_PING, HTTP_POST, false, E_APIRoute::API_ROUTE_PING),
+    ROUTE(API_URL_POWER, HTTP_POST, false, E_APIRoute::API_ROUTE_POWER),
+    ROUTE(API_URL_TASKS, HTTP_POST, false, E_APIRoute::API_ROUTE_TASKS),
+    ROUTE(
+        API_URL_TELEMETRY,
+        HTTP_POST,
+        false,
+        E_APIRoute::API_ROUTE_TELEMETRY
+    ),
+    ROUTE(API_URL_TIMING, HTTP_POST, false, E_APIRoute::API_ROUTE_TIMING),
+    ROUTE(API_URL_TRACE, HTTP_ANY, false, E_APIRoute::API_ROUTE_TRACE),
+    ROUTE(API_URL_WIFI, HTTP_POST, false, E_APIRoute::API_ROUTE_WIFI)
+};
+
+static_assert(
+    RouteTable::IsSorted(skRoutes, sizeof(skRoutes) / sizeof(skRoutes[0])),
+    "The API server routes must be sorted by path."
+);
+
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
-/* None */
+static void WriteURIError(JsonWriter& rWriter,
+                          const char* kpFormat,
+                          const char* kpUri) noexcept {
+    char pMessage[API_MSG_SIZE];
+
+    snprintf(pMessage, sizeof(pMessage), kpFormat, kpUri);
+    rWriter.AddString("msg", pMessage);
+}
 
 /*******************************************************************************
  * CLASS METHODS
  ******************************************************************************/
-APIServerHandlers::APIServerHandlers(WebServer* pServer) noexcept {
-    APIHandler* pNewHandler;
+APIServerHandlers::APIServerHandlers(KeepAliveServer* pServer) noexcept {
+    uint32_t i;
 
     if (nullptr != spInstance) {
         PANIC(
@@ -109,10 +220,47 @@ APIServerHandlers::APIServerHandlers(WebServer* pServer) noexcept {
     }
 
     this->_pServer = pServer;
+    this->_requestBodySize = 0;
+    this->_hasRequestBody = false;
+    this->_isRequestBodyValid = false;
 
     /* Create the handlers */
-    CREATE_NEW_HANDLER(API_URL_PING, PingAPIHandler, pNewHandler);
-    CREATE_NEW_HANDLER(API_URL_WIFI, WiFiSettingAPIHandler, pNewHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_PING, PingAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_WIFI, WiFiSettingAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_TIMING, TimingAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_BOOT, BootAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_POWER, PowerAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_HISTORY, HistoryAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_MONITOR, MonitorAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_LOAD, LoadAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_TASKS, TasksAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_OTA, OtaAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_METRICS, MetricsAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_TRACE, TraceAPIHandler);
+    CREATE_NEW_HANDLER(E_APIRoute::API_ROUTE_TELEMETRY, TelemetryAPIHandler);
+    this->_pApiHandlers[E_APIRoute::API_ROUTE_BATCH] = nullptr;
+    this->_pApiHandlers[E_APIRoute::API_ROUTE_OTA_DATA] = nullptr;
+
+    /* Account the service time of each route */
+    for (i = 0; sizeof(skRoutes) / sizeof(skRoutes[0]) > i; ++i) {
+        this->_pStatsIds[skRoutes[i].id] = HandlerStats::Register(
+            API_STATS_SERVER,
+            skRoutes[i].pkPath
+        );
+    }
+
+    /* All the APIs are dispatched by a single handler, owned by the server */
+    this->_pRoutes = new RouteTable(
+        skRoutes,
+        sizeof(skRoutes) / sizeof(skRoutes[0]),
+        HandleRoute
+    );
+    if (nullptr == this->_pRoutes) {
+        PANIC("Failed to allocate the API Server route table.\n");
+    }
+    this->_pRoutes->SetRawHandler(E_APIRoute::API_ROUTE_OTA_DATA, HandleRaw);
+    this->_pRoutes->SetRawFilter(IsRawBody);
+    this->_pServer->addHandler(this->_pRoutes);
 
     /* Configure the not found handler */
     this->_pServer->onNotFound(HandleNotFound);
@@ -128,67 +276,332 @@ APIServerHandlers::~APIServerHandlers(void) {
 }
 
 void APIServerHandlers::HandleNotFound(void) noexcept {
-    std::string response;
+    JsonWriter writer(
+        spInstance->_pResponseBuffer,
+        sizeof(spInstance->_pResponseBuffer)
+    );
 
     LOG_DEBUG(
         "Handling API not found: %s\n",
         spInstance->_pServer->uri().c_str()
     );
 
-    response = "{\"result\": ";
-    response += std::to_string(E_APIResult::API_RES_UNKNOWN);
-    response += ", \"msg\": \"Unknown API: ";
-    response += spInstance->_pServer->uri().c_str();
-    response += "\"}";
+    NegotiateEncoding(writer);
+    writer.BeginObject();
+    writer.AddUInt("result", E_APIResult::API_RES_UNKNOWN);
+    WriteURIError(
+        writer,
+        "Unknown API: %s",
+        spInstance->_pServer->uri().c_str()
+    );
+    writer.EndObject();
 
     /* Send */
-    spInstance->GenericHandler(response, 404);
+    spInstance->GenericHandler(writer, 404);
 }
 
-void APIServerHandlers::HandleKnownURL(void) noexcept {
-    std::unordered_map<std::string, APIHandler*>::const_iterator it;
-    std::string                                                  response;
-    const char*                                                  pageUrl;
-    String                                                       pageURLStr;
-    int32_t                                                      code;
-
-    LOG_DEBUG(
-        "Handling API: %s\n",
-        spInstance->_pServer->uri().c_str()
+void APIServerHandlers::HandleRoute(const S_Route& krRoute) noexcept {
+    JsonWriter writer(
+        spInstance->_pResponseBuffer,
+        sizeof(spInstance->_pResponseBuffer)
     );
 
-    /* Get the handler */
-    pageURLStr = spInstance->_pServer->uri();
-    pageUrl = pageURLStr.c_str();
-
-    it = spInstance->_apiHandlers.find(pageUrl);
-    if (spInstance->_apiHandlers.end() == it) {
-        response = "{\"result\": ";
-        response += std::to_string(E_APIResult::API_RES_NOT_REGISTERED);
-        response += ", \"msg\": \"Non-registered API: ";
-        response += spInstance->_pServer->uri().c_str();
-        response += "\"}";
-
-        LOG_ERROR(
-            "API URL not registered: %s\n",
-            spInstance->_pServer->uri().c_str()
+    ServerAPIRequest   request(spInstance->_pServer);
+    HistoryAPIHandler* pHistory;
+    MetricsAPIHandler* pMetrics;
+    TraceAPIHandler*   pTrace;
+    OtaAPIHandler*     pOta;
+    uint64_t           serviceNs;
+    uint64_t           startTime;
+    size_t             bytes;
+    int32_t            code;
+    bool               isStreamed;
+
+    TRACE_BEGIN(E_TraceEvent::TRACE_API_ROUTE);
+
+    /*
+     * The service includes the network I/O and can last longer than the
+     * cycle counter range, the monotonic time is used.
+     */
+    startTime = HWManager::GetTime();
+
+    LOG_DEBUG("Handling API: %s\n", krRoute.pkPath);
+
+    NegotiateEncoding(writer);
+    if (spInstance->_hasRequestBody) {
+        request.SetBody(
+            spInstance->_pRequestBody,
+            spInstance->_requestBodySize
         );
+    }
 
-        code = 500;
+    code = 200;
+    isStreamed = false;
+    if (spInstance->_hasRequestBody && !spInstance->_isRequestBodyValid) {
+        writer.BeginObject();
+        writer.AddUInt("result", E_APIResult::API_RES_BODY_INVALID);
+        writer.AddString("msg", "Invalid or too large request body.");
+        writer.EndObject();
+        code = 400;
+    }
+    else if (E_APIRoute::API_ROUTE_BATCH == krRoute.id) {
+        spInstance->HandleBatch(writer);
+    }
+    else if (E_APIRoute::API_ROUTE_HISTORY == krRoute.id) {
+        /* The history does not fit in the response buffer, it is streamed */
+        pHistory = static_cast<HistoryAPIHandler*>(
+            spInstance->_pApiHandlers[krRoute.id]
+        );
+        isStreamed = pHistory->Stream(
+            spInstance->_pServer,
+            request,
+            writer,
+            code
+        );
+    }
+    else if (E_APIRoute::API_ROUTE_METRICS == krRoute.id) {
+        /* The scrapes are sent in the Prometheus text format */
+        pMetrics = static_cast<MetricsAPIHandler*>(
+            spInstance->_pApiHandlers[krRoute.id]
+        );
+        pMetrics->Stream(spInstance->_pServer);
+        isStreamed = true;
+    }
+    else if (E_APIRoute::API_ROUTE_TRACE == krRoute.id) {
+        /* The events are streamed, the state calls are batch compatible */
+        pTrace = static_cast<TraceAPIHandler*>(
+            spInstance->_pApiHandlers[krRoute.id]
+        );
+        isStreamed = pTrace->Stream(spInstance->_pServer, request);
+        if (!isStreamed) {
+            pTrace->Handle(writer, request);
+        }
+    }
+    else if (E_APIRoute::API_ROUTE_OTA_DATA == krRoute.id) {
+        /* The image was received by the raw handler */
+        pOta = static_cast<OtaAPIHandler*>(
+            spInstance->_pApiHandlers[E_APIRoute::API_ROUTE_OTA]
+        );
+        pOta->HandleTransfer(writer);
     }
     else {
         /* Get the potential GET and POST parameters */
-        it->second->Handle(response, spInstance->_pServer);
-        code = 200;
+        spInstance->_pApiHandlers[krRoute.id]->Handle(writer, request);
     }
 
-    /* Send */
-    spInstance->GenericHandler(response, code);
+    if (!isStreamed) {
+        bytes = spInstance->GenericHandler(writer, code);
+    }
+    else {
+        bytes = spInstance->_pServer->GetStreamSize();
+    }
+    spInstance->_hasRequestBody = false;
+    serviceNs = HWManager::GetTime() - startTime;
+
+    /*
+     * The service time is reported next to the power-save wake latency, a
+     * stream duration depends on its range and is only accounted per route.
+     */
+    if (!isStreamed) {
+        SystemState::GetInstance()->GetWiFiModule()->GetPower()->
+            RecordResponse(serviceNs);
+    }
+    HandlerStats::Record(spInstance->_pStatsIds[krRoute.id], serviceNs);
+    Metrics::RecordRequest(spInstance->_pStatsIds[krRoute.id], bytes);
+    TRACE_END(E_TraceEvent::TRACE_API_ROUTE);
+}
+
+void APIServerHandlers::HandleRaw(const S_Route& krRoute,
+                                  HTTPRaw&       rRaw) noexcept {
+    OtaAPIHandler* pOta;
+
+    if (E_APIRoute::API_ROUTE_OTA_DATA == krRoute.id) {
+        pOta = static_cast<OtaAPIHandler*>(
+            spInstance->_pApiHandlers[E_APIRoute::API_ROUTE_OTA]
+        );
+        pOta->Receive(
+            spInstance->_pServer->header(API_OTA_OFFSET_HEADER),
+            rRaw
+        );
+    }
+    else {
+        spInstance->ReceiveBody(rRaw);
+    }
 }
 
-void APIServerHandlers::GenericHandler(const std::string& krResponse,
-                                       const int32_t      kCode) noexcept {
-    /* Update page length and send */
-    this->_pServer->setContentLength(krResponse.size());
-    this->_pServer->send(kCode, "application/json", krResponse.c_str());
+bool APIServerHandlers::IsRawBody(const S_Route& krRoute) noexcept {
+    /* The other routes keep their URL encoded parameters */
+    return E_APIRoute::API_ROUTE_WIFI == krRoute.id &&
+           0 == spInstance->_pServer->header(API_CONTENT_TYPE_HEADER).indexOf(
+               API_CONTENT_TYPE_CBOR
+           );
+}
+
+void APIServerHandlers::NegotiateEncoding(JsonWriter& rWriter) noexcept {
+    if (0 <= spInstance->_pServer->header(API_ACCEPT_HEADER).indexOf(
+            API_CONTENT_TYPE_CBOR
+        )) {
+        rWriter.SetEncoding(JSON_ENCODING_CBOR);
+    }
+}
+
+void APIServerHandlers::ReceiveBody(const HTTPRaw& krRaw) noexcept {
+    if (RAW_START == krRaw.status) {
+        this->_requestBodySize = 0;
+        this->_hasRequestBody = true;
+        this->_isRequestBodyValid = true;
+    }
+    else if (RAW_WRITE == krRaw.status) {
+        if (sizeof(this->_pRequestBody) - this->_requestBodySize >=
+            krRaw.currentSize) {
+            memcpy(
+                this->_pRequestBody + this->_requestBodySize,
+                krRaw.buf,
+                krRaw.currentSize
+            );
+            this->_requestBodySize += krRaw.currentSize;
+        }
+        else {
+            this->_isRequestBodyValid = false;
+        }
+    }
+    else if (RAW_ABORTED == krRaw.status) {
+        this->_isRequestBodyValid = false;
+    }
+}
+
+void APIServerHandlers::HandleBatch(JsonWriter& rWriter) noexcept {
+    char           pSubRequest[API_BATCH_REQUEST_SIZE];
+    char*          pQuery;
+    const S_Route* pkRoute;
+    E_RouteMatch   match;
+    E_APIResult    result;
+    String         arg;
+    uint32_t       args;
+    uint32_t       count;
+    uint32_t       i;
+
+    rWriter.BeginObject();
+    rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+    rWriter.BeginArray("responses");
+
+    count = 0;
+    args = (uint32_t)this->_pServer->args();
+    for (i = 0; args > i; ++i) {
+        if (!this->_pServer->argName(i).equals(API_BATCH_ARG)) {
+            continue;
+        }
+
+        arg = this->_pServer->arg(i);
+        pSubRequest[0] = 0;
+        if (API_BATCH_MAX_REQUESTS <= count ||
+            sizeof(pSubRequest) <= arg.length()) {
+            result = E_APIResult::API_RES_BATCH_INVALID;
+        }
+        else {
+            /* Split the path and the query */
+            memcpy(pSubRequest, arg.c_str(), arg.length() + 1);
+            pQuery = strchr(pSubRequest, '?');
+            if (nullptr != pQuery) {
+                *pQuery = 0;
+                ++pQuery;
+            }
+            else {
+                pQuery = pSubRequest + strlen(pSubRequest);
+            }
+
+            /* Batches are not nested and do not carry raw bodies */
+            pkRoute = this->_pRoutes->Find(
+                pSubRequest,
+                strlen(pSubRequest),
+                HTTP_POST,
+                match
+            );
+            if (nullptr == pkRoute ||
+                E_APIRoute::API_ROUTE_BATCH == pkRoute->id ||
+                E_APIRoute::API_ROUTE_OTA_DATA == pkRoute->id) {
+                result = E_APIResult::API_RES_UNKNOWN;
+            }
+            else {
+                QueryAPIRequest request(pQuery);
+
+                if (request.IsOverflowed()) {
+                    result = E_APIResult::API_RES_BATCH_INVALID;
+                }
+                else {
+                    LOG_DEBUG("Handling batched API: %s\n", pSubRequest);
+                    this->_pApiHandlers[pkRoute->id]->Handle(
+                        rWriter,
+                        request
+                    );
+                    result = E_APIResult::API_RES_NO_ERROR;
+                }
+            }
+        }
+        ++count;
+
+        /* Failed requests still get their entry to keep the order */
+        if (E_APIResult::API_RES_NO_ERROR != result) {
+            LOG_ERROR("Rejected batched API request %d.\n", count);
+
+            rWriter.BeginObject();
+            rWriter.AddUInt("result", result);
+            if (E_APIResult::API_RES_UNKNOWN == result) {
+                WriteURIError(rWriter, "Unknown API: %s", pSubRequest);
+            }
+            else {
+                rWriter.AddString("msg", "Invalid batched request.");
+            }
+            rWriter.EndObject();
+        }
+    }
+
+    rWriter.EndArray();
+    rWriter.EndObject();
+}
+
+size_t APIServerHandlers::GenericHandler(const JsonWriter& krWriter,
+                                         const int32_t     kCode) noexcept {
+    JsonWriter overflowWriter(
+        this->_pResponseBuffer,
+        sizeof(this->_pResponseBuffer)
+    );
+
+    size_t size;
+
+    if (!krWriter.IsOverflowed()) {
+        /* The response is sent from the buffer, no copy is made */
+        this->_pServer->SendResponse(
+            kCode,
+            krWriter.GetContentType(),
+            krWriter.GetData(),
+            krWriter.GetSize()
+        );
+        size = krWriter.GetSize();
+    }
+    else {
+        LOG_ERROR(
+            "API response overflow: %s\n",
+            this->_pServer->uri().c_str()
+        );
+
+        overflowWriter.SetEncoding(krWriter.GetEncoding());
+        overflowWriter.BeginObject();
+        overflowWriter.AddUInt(
+            "result",
+            E_APIResult::API_RES_RESPONSE_OVERFLOW
+        );
+        overflowWriter.AddString("msg", "Response too large.");
+        overflowWriter.EndObject();
+
+        this->_pServer->SendResponse(
+            500,
+            overflowWriter.GetContentType(),
+            overflowWriter.GetData(),
+            overflowWriter.GetSize()
+        );
+        size = overflowWriter.GetSize();
+    }
+
+    return size;
 }
\ No newline at end of file
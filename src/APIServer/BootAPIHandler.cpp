@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * @file BootAPIHandler.cpp
+ *
+ * @see BootAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Boot trace API handler.
+ *
+ * @details Boot trace API handler. This file defines the Boot API handler
+ * used to report the boot phases timing of the running firmware build.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <Logger.h>     /* Logger services */
+#include <Errors.h>     /* Errors definitions */
+#include <version.h>    /* Versioning */
+#include <BootTrace.h>  /* Boot phases trace */
+#include <BootRecord.h> /* Boot mode and reset record */
+#include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIHandler.h> /* API Handler interface */
+
+/* Header file */
+#include <BootAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+BootAPIHandler::~BootAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Boot API handler.\n");
+}
+
+void BootAPIHandler::Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept {
+    S_ResetInfo reset;
+    uint32_t    i;
+
+    (void)krRequest;
+
+    LOG_DEBUG("Handling Boot API.\n");
+
+    BootRecord::GetLastReset(reset);
+
+    /* The build identifies the firmware the timings belong to */
+    rWriter.BeginObject();
+    rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+    rWriter.AddString("version", VERSION);
+    rWriter.AddString("build", BUILD_NUMBER);
+    rWriter.BeginArray("phases");
+    for (i = 0; E_BootPhase::BOOT_PHASE_COUNT > i; ++i) {
+        rWriter.BeginObject();
+        rWriter.AddString("name", BootTrace::GetName((E_BootPhase)i));
+        rWriter.AddUInt("time_us", BootTrace::GetTime((E_BootPhase)i));
+        rWriter.EndObject();
+    }
+    rWriter.EndArray();
+    rWriter.BeginObject("reset");
+    rWriter.AddString("cause", BootRecord::GetCauseName(reset.cause));
+    rWriter.AddUInt("hw_reason", reset.hwReason);
+    rWriter.AddUInt("boot_count", reset.bootCount);
+    rWriter.AddString("context", reset.pContext);
+    rWriter.EndObject();
+    rWriter.EndObject();
+}
\ No newline at end of file
@@ -0,0 +1,276 @@
+/*******************************************************************************
+ * @file CborReader.cpp
+ *
+ * @see CborReader.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief API CBOR request reader.
+ *
+ * @details API CBOR request reader. The reader decodes a CBOR map in a
+ * structure described by the field schema of the JSON writer, in one linear
+ * pass and without any allocation.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>      /* Standard integer definitions */
+#include <cstring>      /* String manipulation */
+#include <JsonWriter.h> /* JSON schema */
+
+/* Header file */
+#include <CborReader.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the CBOR tag major type, tags are not supported. */
+#define CBOR_MAJOR_TAG 6
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+CborReader::CborReader(const uint8_t* kpData, const size_t kSize) noexcept {
+    this->_pkData = kpData;
+    this->_size = kSize;
+    this->_position = 0;
+}
+
+bool CborReader::ReadFields(void*              pObject,
+                            const S_JsonField* kpSchema,
+                            const size_t       kCount,
+                            uint32_t&          rFound) noexcept {
+    const uint8_t* pkKey;
+    uint64_t       remaining;
+    size_t         length;
+    size_t         index;
+    size_t         i;
+    uint8_t        major;
+    uint8_t        info;
+    bool           isIndefinite;
+    bool           isMatched;
+    bool           isValid;
+    bool           isDone;
+
+    rFound = 0;
+    info = 0;
+    remaining = 0;
+    this->_position = 0;
+    isValid = CBOR_READER_MAX_FIELDS >= kCount &&
+              ReadHead(major, info, remaining) &&
+              CBOR_MAJOR_MAP == major;
+    isIndefinite = CBOR_INFO_INDEFINITE == info;
+    isDone = !isValid || (!isIndefinite && 0 == remaining);
+    while (!isDone) {
+        if (isIndefinite &&
+            this->_size > this->_position &&
+            CBOR_BREAK == this->_pkData[this->_position]) {
+            ++this->_position;
+            isDone = true;
+        }
+        else {
+            /* Match the key, each field is decoded once */
+            isValid = ReadText(pkKey, length);
+            isMatched = false;
+            index = 0;
+            for (i = 0; isValid && !isMatched && kCount > i; ++i) {
+                if (length == strlen(kpSchema[i].pkKey) &&
+                    0 == memcmp(pkKey, kpSchema[i].pkKey, length)) {
+                    isMatched = true;
+                    index = i;
+                }
+            }
+            isValid = isMatched && 0 == (rFound & (1UL << index));
+            if (isValid) {
+                isValid = ReadValue(
+                    (uint8_t*)pObject + kpSchema[index].offset,
+                    kpSchema[index]
+                );
+                rFound |= 1UL << index;
+            }
+
+            if (!isIndefinite) {
+                --remaining;
+            }
+            isDone = !isValid || (!isIndefinite && 0 == remaining);
+        }
+    }
+
+    return isValid && this->_size == this->_position;
+}
+
+bool CborReader::ReadHead(uint8_t&  rMajor,
+                          uint8_t&  rInfo,
+                          uint64_t& rValue) noexcept {
+    size_t length;
+    size_t i;
+    bool   isValid;
+
+    isValid = this->_size > this->_position;
+    if (isValid) {
+        rMajor = this->_pkData[this->_position] >> 5;
+        rInfo = this->_pkData[this->_position] & 0x1F;
+        ++this->_position;
+
+        /* The argument follows the initial byte in network order */
+        length = 0;
+        if (CBOR_INFO_UINT8 > rInfo) {
+            rValue = rInfo;
+        }
+        else if (CBOR_INFO_UINT8 + 3 >= rInfo) {
+            length = (size_t)1 << (rInfo - CBOR_INFO_UINT8);
+            rValue = 0;
+        }
+        else if (CBOR_INFO_INDEFINITE == rInfo) {
+            /* Only the strings, the containers and the break are sized so */
+            isValid = CBOR_MAJOR_NEGATIVE < rMajor &&
+                      CBOR_MAJOR_TAG != rMajor;
+            rValue = 0;
+        }
+        else {
+            isValid = false;
+        }
+
+        isValid = isValid && this->_size - this->_position >= length;
+        if (isValid) {
+            for (i = 0; length > i; ++i) {
+                rValue = (rValue << 8) | this->_pkData[this->_position + i];
+            }
+            this->_position += length;
+        }
+    }
+
+    return isValid;
+}
+
+bool CborReader::ReadText(const uint8_t*& rpkText, size_t& rLength) noexcept {
+    uint64_t length;
+    uint8_t  major;
+    uint8_t  info;
+    bool     isValid;
+
+    isValid = ReadHead(major, info, length) &&
+              CBOR_MAJOR_TEXT == major &&
+              CBOR_INFO_INDEFINITE != info &&
+              this->_size - this->_position >= length;
+    if (isValid) {
+        rpkText = this->_pkData + this->_position;
+        rLength = (size_t)length;
+        this->_position += rLength;
+    }
+
+    return isValid;
+}
+
+bool CborReader::ReadValue(uint8_t*           pField,
+                           const S_JsonField& krField) noexcept {
+    const uint8_t* pkText;
+    uint64_t       value;
+    size_t         length;
+    uint8_t        major;
+    uint8_t        info;
+    bool           isValid;
+
+    if (JSON_FIELD_STRING == krField.type) {
+        /* The string is copied with its terminator, null bytes are refused */
+        isValid = ReadText(pkText, length) &&
+                  krField.size > length &&
+                  nullptr == memchr(pkText, 0, length);
+        if (isValid) {
+            memcpy(pField, pkText, length);
+            pField[length] = 0;
+        }
+    }
+    else if (ReadHead(major, info, value)) {
+        switch (krField.type) {
+            case JSON_FIELD_BOOL:
+                isValid = CBOR_MAJOR_SIMPLE == major &&
+                          (CBOR_SIMPLE_FALSE == info ||
+                           CBOR_SIMPLE_TRUE == info);
+                if (isValid) {
+                    *(bool*)pField = (CBOR_SIMPLE_TRUE == info);
+                }
+                break;
+            case JSON_FIELD_INT32:
+                /* CBOR negative integers encode -1 - value */
+                isValid = (CBOR_MAJOR_UNSIGNED == major ||
+                           CBOR_MAJOR_NEGATIVE == major) &&
+                          INT32_MAX >= value;
+                if (isValid) {
+                    *(int32_t*)pField = CBOR_MAJOR_NEGATIVE == major ?
+                        -1 - (int32_t)value :
+                        (int32_t)value;
+                }
+                break;
+            case JSON_FIELD_UINT8:
+                isValid = CBOR_MAJOR_UNSIGNED == major && UINT8_MAX >= value;
+                if (isValid) {
+                    *(uint8_t*)pField = (uint8_t)value;
+                }
+                break;
+            case JSON_FIELD_UINT16:
+                isValid = CBOR_MAJOR_UNSIGNED == major && UINT16_MAX >= value;
+                if (isValid) {
+                    *(uint16_t*)pField = (uint16_t)value;
+                }
+                break;
+            case JSON_FIELD_UINT32:
+                isValid = CBOR_MAJOR_UNSIGNED == major && UINT32_MAX >= value;
+                if (isValid) {
+                    *(uint32_t*)pField = (uint32_t)value;
+                }
+                break;
+            default:
+                isValid = CBOR_MAJOR_UNSIGNED == major;
+                if (isValid) {
+                    *(uint64_t*)pField = value;
+                }
+                break;
+        }
+    }
+    else {
+        isValid = false;
+    }
+
+    return isValid;
+}
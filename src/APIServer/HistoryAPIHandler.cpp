@@ -0,0 +1,460 @@
+/*******************************************************************************
+ * @file HistoryAPIHandler.cpp
+ *
+ * @see HistoryAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief History API handler.
+ *
+ * @details History API handler. This file defines the History API handler
+ * used to stream the stored series over a time range.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cmath>             /* std::isfinite */
+#include <cstdio>            /* Standard IO */
+#include <cstdlib>           /* strtoll */
+#include <cstring>           /* String manipulation */
+#include <BSP.h>             /* Time services */
+#include <Logger.h>          /* Logger services */
+#include <Errors.h>          /* Errors definitions */
+#include <WebServer.h>       /* Web Server services */
+#include <JsonWriter.h>      /* JSON response writer */
+#include <APIHandler.h>      /* API Handler interface */
+#include <TSDBRollup.h>      /* Time series rollup tiers */
+#include <SystemState.h>     /* System state object */
+#include <TimeSeriesStore.h> /* Time series store */
+#include <KeepAliveServer.h> /* Persistent connections server */
+
+/* Header file */
+#include <HistoryAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the argument string for the series. */
+#define API_ARG_SERIES "series"
+/** @brief Defines the argument string for the range start. */
+#define API_ARG_FROM "from"
+/** @brief Defines the argument string for the range end. */
+#define API_ARG_TO "to"
+/** @brief Defines the argument string for the resolution. */
+#define API_ARG_STEP "step"
+/** @brief Defines the argument string for the aggregate. */
+#define API_ARG_AGG "agg"
+/** @brief Defines the argument string for the format. */
+#define API_ARG_FORMAT "format"
+
+/** @brief Defines the size of a formatted point. */
+#define HISTORY_POINT_SIZE 48
+
+/** @brief Defines the size of the formatted response prefix. */
+#define HISTORY_PREFIX_SIZE 128
+
+/** @brief Defines the size of a binary point. */
+#define HISTORY_BIN_POINT_SIZE (sizeof(int64_t) + sizeof(float))
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Parses an integer parameter.
+ *
+ * @param[in] krArg The parameter value, empty when not given.
+ * @param[in] kDefault The value of a parameter not given.
+ * @param[out] rValue The parsed value.
+ *
+ * @return true if the parameter is valid or not given, false otherwise.
+ */
+static bool ParseInt(const String& krArg,
+                     const int64_t kDefault,
+                     int64_t&      rValue) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The content types of the formats. */
+static const char* spkContentTypes[] = {
+    "application/json",
+    "text/csv",
+    "application/octet-stream"
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static bool ParseInt(const String& krArg,
+                     const int64_t kDefault,
+                     int64_t&      rValue) noexcept {
+    char* pEnd;
+    bool  isValid;
+
+    isValid = true;
+    if (0 == krArg.length()) {
+        rValue = kDefault;
+    }
+    else {
+        rValue = strtoll(krArg.c_str(), &pEnd, 0);
+        isValid = 0 == *pEnd;
+    }
+
+    return isValid;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+HistoryAPIHandler::HistoryAPIHandler(void) noexcept {
+    this->_pServer = nullptr;
+    this->_points = 0;
+    this->_chunkSize = 0;
+}
+
+HistoryAPIHandler::~HistoryAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the History API handler.\n");
+}
+
+void HistoryAPIHandler::Handle(JsonWriter&       rWriter,
+                               const APIRequest& krRequest) noexcept {
+    (void)krRequest;
+
+    rWriter.BeginObject();
+    rWriter.AddUInt("result", E_APIResult::API_RES_HISTORY_INVALID);
+    rWriter.AddString("msg", "History queries are not batched.");
+    rWriter.EndObject();
+}
+
+bool HistoryAPIHandler::Stream(KeepAliveServer*  pServer,
+                               const APIRequest& krRequest,
+                               JsonWriter&       rWriter,
+                               int32_t&          rCode) noexcept {
+    char             pPrefix[HISTORY_PREFIX_SIZE];
+    TimeSeriesStore* pStore;
+    S_TSDBBucket     bucket;
+    E_Return         error;
+    int64_t          now;
+    int64_t          time;
+    int64_t          start;
+    float            value;
+    int              length;
+    bool             isStreamed;
+    bool             isValid;
+
+    LOG_DEBUG("Handling History API.\n");
+
+    isStreamed = false;
+    pStore = SystemState::GetInstance()->GetTimeSeriesStore();
+    if (nullptr == pStore) {
+        rCode = 500;
+        rWriter.BeginObject();
+        rWriter.AddUInt("result", E_APIResult::API_RES_HISTORY_INVALID);
+        rWriter.AddString("msg", "History not available.");
+        rWriter.EndObject();
+    }
+    else {
+        now = pStore->GetStoreTime(HWManager::GetTime());
+        if (!ParseQuery(krRequest, now, this->_query)) {
+            error = E_Return::ERR_INVALID_PARAM;
+        }
+        else {
+            error = pStore->OpenRangeCursor(
+                this->_query.id,
+                this->_query.aggregate,
+                this->_query.from,
+                this->_query.to,
+                this->_query.step,
+                this->_cursor
+            );
+        }
+
+        if (E_Return::NO_ERROR != error) {
+            rCode = (E_Return::ERR_NO_SUCH_ID == error) ? 404 : 400;
+            rWriter.BeginObject();
+            rWriter.AddUInt("result", E_APIResult::API_RES_HISTORY_INVALID);
+            if (E_Return::ERR_NO_SUCH_ID == error) {
+                rWriter.AddString("msg", "Unknown series.");
+            }
+            else {
+                rWriter.AddString("msg", "Invalid history query.");
+            }
+            rWriter.EndObject();
+
+            LOG_ERROR("Invalid History API query: %d.\n", error);
+        }
+        else {
+            isStreamed = true;
+            this->_pServer = pServer;
+            this->_points = 0;
+            this->_chunkSize = 0;
+
+            isValid = pServer->BeginStream(
+                200,
+                spkContentTypes[this->_query.format]
+            );
+
+            /* The store time lets the client place the points */
+            if (E_HistoryFormat::HISTORY_FORMAT_JSON == this->_query.format) {
+                length = snprintf(
+                    pPrefix,
+                    sizeof(pPrefix),
+                    "{\"result\":%u,\"series\":%u,\"now\":%lld,"
+                    "\"step\":%lld,\"points\":[",
+                    (unsigned int)E_APIResult::API_RES_NO_ERROR,
+                    (unsigned int)this->_query.id,
+                    (long long)now,
+                    (long long)this->_query.step
+                );
+                isValid = isValid && Write(pPrefix, (size_t)length);
+            }
+            else if (E_HistoryFormat::HISTORY_FORMAT_CSV ==
+                     this->_query.format) {
+                isValid = isValid && Write("time,value\n", 11);
+            }
+
+            /* The stored points finer than the step are aggregated */
+            bucket.count = 0;
+            while (isValid &&
+                   pStore->ReadCursor(this->_cursor, time, value)) {
+                if (this->_query.step <= this->_cursor.period) {
+                    isValid = WritePoint(time, value);
+                }
+                else {
+                    start = time - time % this->_query.step;
+                    if (0 > time % this->_query.step) {
+                        start -= this->_query.step;
+                    }
+                    if (0 != bucket.count && start != bucket.start) {
+                        isValid = WritePoint(
+                            bucket.start,
+                            TSDBRollup::GetAggregate(
+                                bucket,
+                                this->_query.aggregate
+                            )
+                        );
+                        bucket.count = 0;
+                    }
+                    if (0 == bucket.count) {
+                        bucket.start = start;
+                        bucket.min = value;
+                        bucket.max = value;
+                        bucket.sum = 0.0;
+                    }
+                    else if (value < bucket.min) {
+                        bucket.min = value;
+                    }
+                    else if (value > bucket.max) {
+                        bucket.max = value;
+                    }
+                    bucket.sum += value;
+                    ++bucket.count;
+                }
+            }
+            if (isValid && 0 != bucket.count) {
+                isValid = WritePoint(
+                    bucket.start,
+                    TSDBRollup::GetAggregate(bucket, this->_query.aggregate)
+                );
+            }
+
+            if (E_HistoryFormat::HISTORY_FORMAT_JSON == this->_query.format) {
+                isValid = isValid && Write("]}", 2);
+            }
+            isValid = isValid &&
+                      pServer->SendChunk(this->_pChunk, this->_chunkSize);
+            pServer->EndStream();
+
+            if (!isValid) {
+                LOG_ERROR(
+                    "History stream aborted after %u points.\n",
+                    this->_points
+                );
+            }
+            this->_pServer = nullptr;
+        }
+    }
+
+    return isStreamed;
+}
+
+bool HistoryAPIHandler::ParseQuery(const APIRequest& krRequest,
+                                   const int64_t     kNow,
+                                   S_HistoryQuery&   rQuery) noexcept {
+    String  arg;
+    int64_t id;
+    bool    isValid;
+
+    isValid = ParseInt(krRequest.GetNamedArg(API_ARG_SERIES), -1, id) &&
+              0 <= id && UINT16_MAX >= id;
+    rQuery.id = (uint16_t)id;
+
+    isValid = isValid &&
+              ParseInt(krRequest.GetNamedArg(API_ARG_TO), kNow, rQuery.to);
+    isValid = isValid &&
+              ParseInt(
+                  krRequest.GetNamedArg(API_ARG_FROM),
+                  rQuery.to - HISTORY_DEFAULT_RANGE_MS,
+                  rQuery.from
+              ) &&
+              rQuery.from <= rQuery.to;
+    isValid = isValid &&
+              ParseInt(krRequest.GetNamedArg(API_ARG_STEP), 0, rQuery.step) &&
+              0 <= rQuery.step;
+
+    arg = krRequest.GetNamedArg(API_ARG_AGG);
+    if (0 == arg.length() || arg.equals("avg")) {
+        rQuery.aggregate = E_TSDBAggregate::TSDB_AGG_AVG;
+    }
+    else if (arg.equals("min")) {
+        rQuery.aggregate = E_TSDBAggregate::TSDB_AGG_MIN;
+    }
+    else if (arg.equals("max")) {
+        rQuery.aggregate = E_TSDBAggregate::TSDB_AGG_MAX;
+    }
+    else {
+        isValid = false;
+    }
+
+    arg = krRequest.GetNamedArg(API_ARG_FORMAT);
+    if (0 == arg.length() || arg.equals("json")) {
+        rQuery.format = E_HistoryFormat::HISTORY_FORMAT_JSON;
+    }
+    else if (arg.equals("csv")) {
+        rQuery.format = E_HistoryFormat::HISTORY_FORMAT_CSV;
+    }
+    else if (arg.equals("bin")) {
+        rQuery.format = E_HistoryFormat::HISTORY_FORMAT_BIN;
+    }
+    else {
+        isValid = false;
+    }
+
+    return isValid;
+}
+
+size_t HistoryAPIHandler::FormatPoint(const E_HistoryFormat kFormat,
+                                      const bool            kIsFirst,
+                                      const int64_t         kTime,
+                                      const float           kValue,
+                                      char*                 pBuffer,
+                                      const size_t          kSize) noexcept {
+    int    length;
+    size_t size;
+
+    size = 0;
+    if (E_HistoryFormat::HISTORY_FORMAT_BIN == kFormat) {
+        /* The target is little endian, the fields are copied as is */
+        if (HISTORY_BIN_POINT_SIZE <= kSize) {
+            memcpy(pBuffer, &kTime, sizeof(int64_t));
+            memcpy(pBuffer + sizeof(int64_t), &kValue, sizeof(float));
+            size = HISTORY_BIN_POINT_SIZE;
+        }
+    }
+    else {
+        if (!std::isfinite(kValue)) {
+            /* Failed readings have no value */
+            length = snprintf(
+                pBuffer,
+                kSize,
+                (E_HistoryFormat::HISTORY_FORMAT_CSV == kFormat) ?
+                    "%s%lld,\n" :
+                    "%s[%lld,null]",
+                (kIsFirst ||
+                 E_HistoryFormat::HISTORY_FORMAT_CSV == kFormat) ? "" : ",",
+                (long long)kTime
+            );
+        }
+        else if (E_HistoryFormat::HISTORY_FORMAT_CSV == kFormat) {
+            length = snprintf(
+                pBuffer,
+                kSize,
+                "%lld,%.3f\n",
+                (long long)kTime,
+                (double)kValue
+            );
+        }
+        else {
+            length = snprintf(
+                pBuffer,
+                kSize,
+                "%s[%lld,%.3f]",
+                kIsFirst ? "" : ",",
+                (long long)kTime,
+                (double)kValue
+            );
+        }
+        if (0 < length && kSize > (size_t)length) {
+            size = (size_t)length;
+        }
+    }
+
+    return size;
+}
+
+bool HistoryAPIHandler::Write(const char* kpData, const size_t kSize) noexcept {
+    bool isValid;
+
+    isValid = true;
+    if (sizeof(this->_pChunk) - this->_chunkSize < kSize) {
+        isValid = this->_pServer->SendChunk(this->_pChunk, this->_chunkSize);
+        this->_chunkSize = 0;
+    }
+    if (isValid) {
+        memcpy(this->_pChunk + this->_chunkSize, kpData, kSize);
+        this->_chunkSize += kSize;
+    }
+
+    return isValid;
+}
+
+bool HistoryAPIHandler::WritePoint(const int64_t kTime,
+                                   const float   kValue) noexcept {
+    char   pPoint[HISTORY_POINT_SIZE];
+    size_t size;
+    bool   isValid;
+
+    size = FormatPoint(
+        this->_query.format,
+        0 == this->_points,
+        kTime,
+        kValue,
+        pPoint,
+        sizeof(pPoint)
+    );
+    isValid = 0 != size && Write(pPoint, size);
+    ++this->_points;
+
+    return isValid;
+}
@@ -0,0 +1,460 @@
+/*******************************************************************************
+ * @file JsonWriter.cpp
+ *
+ * @see JsonWriter.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief API JSON response writer.
+ *
+ * @details API JSON response writer. The writer serializes JSON values in a
+ * caller provided buffer without any allocation. Structures can be described
+ * by a constant field schema and serialized in one call.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>  /* Standard integer definitions */
+#include <cstring>  /* String manipulation */
+
+/* Header file */
+#include <JsonWriter.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Maximal number of digits of a 64 bits integer. */
+#define JSON_MAX_DIGITS 20
+
+/** @brief Maximal size of a CBOR data item head. */
+#define CBOR_MAX_HEAD 9
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief Hexadecimal digits used by the control characters escaping. */
+static const char skHexDigits[] = "0123456789abcdef";
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+JsonWriter::JsonWriter(char* pBuffer, const size_t kSize) noexcept {
+    this->_pBuffer = pBuffer;
+    this->_size = kSize;
+    this->_encoding = JSON_ENCODING_TEXT;
+    Reset();
+}
+
+void JsonWriter::Reset(void) noexcept {
+    this->_used = 0;
+    this->_depth = 0;
+    this->_hasValues = 0;
+    this->_isArray = 0;
+    this->_isOverflowed = (0 == this->_size);
+    if (!this->_isOverflowed) {
+        this->_pBuffer[0] = 0;
+    }
+}
+
+void JsonWriter::SetEncoding(const E_JsonEncoding kEncoding) noexcept {
+    this->_encoding = kEncoding;
+    Reset();
+}
+
+E_JsonEncoding JsonWriter::GetEncoding(void) const noexcept {
+    return this->_encoding;
+}
+
+const char* JsonWriter::GetContentType(void) const noexcept {
+    const char* pkType;
+
+    if (JSON_ENCODING_CBOR == this->_encoding) {
+        pkType = "application/cbor";
+    }
+    else {
+        pkType = "application/json";
+    }
+
+    return pkType;
+}
+
+void JsonWriter::BeginObject(const char* kpKey) noexcept {
+    Open(kpKey, '{');
+}
+
+void JsonWriter::EndObject(void) noexcept {
+    Close('}');
+}
+
+void JsonWriter::BeginArray(const char* kpKey) noexcept {
+    Open(kpKey, '[');
+}
+
+void JsonWriter::EndArray(void) noexcept {
+    Close(']');
+}
+
+void JsonWriter::AddString(const char* kpKey, const char* kpValue) noexcept {
+    WriteKey(kpKey);
+    if (JSON_ENCODING_CBOR == this->_encoding) {
+        WriteCborString(kpValue);
+    }
+    else {
+        WriteRaw("\"", 1);
+        WriteEscaped(kpValue);
+        WriteRaw("\"", 1);
+    }
+}
+
+void JsonWriter::AddUInt(const char* kpKey, const uint64_t kValue) noexcept {
+    WriteKey(kpKey);
+    if (JSON_ENCODING_CBOR == this->_encoding) {
+        WriteCborHead(CBOR_MAJOR_UNSIGNED, kValue);
+    }
+    else {
+        WriteDigits(kValue);
+    }
+}
+
+void JsonWriter::AddInt(const char* kpKey, const int64_t kValue) noexcept {
+    WriteKey(kpKey);
+    if (JSON_ENCODING_CBOR == this->_encoding) {
+        /* CBOR negative integers encode -1 - value */
+        if (0 > kValue) {
+            WriteCborHead(CBOR_MAJOR_NEGATIVE, ~(uint64_t)kValue);
+        }
+        else {
+            WriteCborHead(CBOR_MAJOR_UNSIGNED, (uint64_t)kValue);
+        }
+    }
+    else if (0 > kValue) {
+        WriteRaw("-", 1);
+        WriteDigits(0 - (uint64_t)kValue);
+    }
+    else {
+        WriteDigits((uint64_t)kValue);
+    }
+}
+
+void JsonWriter::AddBool(const char* kpKey, const bool kValue) noexcept {
+    uint8_t simple;
+
+    WriteKey(kpKey);
+    if (JSON_ENCODING_CBOR == this->_encoding) {
+        simple = (CBOR_MAJOR_SIMPLE << 5) |
+                 (kValue ? CBOR_SIMPLE_TRUE : CBOR_SIMPLE_FALSE);
+        WriteRaw((const char*)&simple, 1);
+    }
+    else if (kValue) {
+        WriteRaw("true", 4);
+    }
+    else {
+        WriteRaw("false", 5);
+    }
+}
+
+void JsonWriter::AddFields(const void*        kpObject,
+                           const S_JsonField* kpSchema,
+                           const size_t       kCount) noexcept {
+    const uint8_t* pkField;
+    uint64_t       value;
+    int32_t        signedValue;
+    bool           isNegative;
+    size_t         i;
+
+    for (i = 0; kCount > i; ++i) {
+        pkField = (const uint8_t*)kpObject + kpSchema[i].offset;
+
+        if (JSON_FIELD_STRING == kpSchema[i].type) {
+            AddString(kpSchema[i].pkKey, (const char*)pkField);
+        }
+        else if (JSON_FIELD_BOOL == kpSchema[i].type &&
+                 (!kpSchema[i].isQuoted ||
+                  JSON_ENCODING_CBOR == this->_encoding)) {
+            /* CBOR documents keep the native types */
+            AddBool(kpSchema[i].pkKey, *(const bool*)pkField);
+        }
+        else {
+            isNegative = false;
+            switch (kpSchema[i].type) {
+                case JSON_FIELD_BOOL:
+                    value = *(const bool*)pkField ? 1 : 0;
+                    break;
+                case JSON_FIELD_UINT8:
+                    value = *(const uint8_t*)pkField;
+                    break;
+                case JSON_FIELD_UINT16:
+                    value = *(const uint16_t*)pkField;
+                    break;
+                case JSON_FIELD_UINT32:
+                    value = *(const uint32_t*)pkField;
+                    break;
+                case JSON_FIELD_INT32:
+                    signedValue = *(const int32_t*)pkField;
+                    isNegative = (0 > signedValue);
+                    value = isNegative ?
+                        0 - (uint64_t)(int64_t)signedValue :
+                        (uint64_t)signedValue;
+                    break;
+                default:
+                    value = *(const uint64_t*)pkField;
+                    break;
+            }
+
+            WriteKey(kpSchema[i].pkKey);
+            if (JSON_ENCODING_CBOR == this->_encoding) {
+                if (isNegative) {
+                    WriteCborHead(CBOR_MAJOR_NEGATIVE, value - 1);
+                }
+                else {
+                    WriteCborHead(CBOR_MAJOR_UNSIGNED, value);
+                }
+            }
+            else {
+                if (kpSchema[i].isQuoted) {
+                    WriteRaw("\"", 1);
+                }
+                if (isNegative) {
+                    WriteRaw("-", 1);
+                }
+                WriteDigits(value);
+                if (kpSchema[i].isQuoted) {
+                    WriteRaw("\"", 1);
+                }
+            }
+        }
+    }
+}
+
+const char* JsonWriter::GetData(void) const noexcept {
+    return this->_pBuffer;
+}
+
+size_t JsonWriter::GetSize(void) const noexcept {
+    return this->_used;
+}
+
+bool JsonWriter::IsOverflowed(void) const noexcept {
+    return this->_isOverflowed;
+}
+
+void JsonWriter::WriteKey(const char* kpKey) noexcept {
+    uint32_t mask;
+
+    if (0 != this->_depth) {
+        mask = 1UL << (this->_depth - 1);
+        if (0 != (this->_hasValues & mask) &&
+            JSON_ENCODING_TEXT == this->_encoding) {
+            WriteRaw(", ", 2);
+        }
+        this->_hasValues |= mask;
+
+        if (0 == (this->_isArray & mask) && nullptr != kpKey) {
+            if (JSON_ENCODING_CBOR == this->_encoding) {
+                WriteCborString(kpKey);
+            }
+            else {
+                WriteRaw("\"", 1);
+                WriteEscaped(kpKey);
+                WriteRaw("\": ", 3);
+            }
+        }
+    }
+}
+
+void JsonWriter::Open(const char* kpKey, const char kOpen) noexcept {
+    uint32_t mask;
+    uint8_t  head;
+
+    if (JSON_WRITER_MAX_DEPTH <= this->_depth) {
+        this->_isOverflowed = true;
+    }
+    else {
+        WriteKey(kpKey);
+        if (JSON_ENCODING_CBOR == this->_encoding) {
+            head = ('[' == kOpen) ? CBOR_MAJOR_ARRAY : CBOR_MAJOR_MAP;
+            head = (head << 5) | CBOR_INFO_INDEFINITE;
+            WriteRaw((const char*)&head, 1);
+        }
+        else {
+            WriteRaw(&kOpen, 1);
+        }
+
+        ++this->_depth;
+        mask = 1UL << (this->_depth - 1);
+        this->_hasValues &= ~mask;
+        if ('[' == kOpen) {
+            this->_isArray |= mask;
+        }
+        else {
+            this->_isArray &= ~mask;
+        }
+    }
+}
+
+void JsonWriter::Close(const char kClose) noexcept {
+    uint8_t breakByte;
+
+    if (0 != this->_depth) {
+        --this->_depth;
+        if (JSON_ENCODING_CBOR == this->_encoding) {
+            breakByte = CBOR_BREAK;
+            WriteRaw((const char*)&breakByte, 1);
+        }
+        else {
+            WriteRaw(&kClose, 1);
+        }
+    }
+}
+
+void JsonWriter::WriteRaw(const char* kpData, const size_t kSize) noexcept {
+    if (!this->_isOverflowed) {
+        /* Keep room for the terminator */
+        if (this->_size - this->_used > kSize) {
+            memcpy(this->_pBuffer + this->_used, kpData, kSize);
+            this->_used += kSize;
+            this->_pBuffer[this->_used] = 0;
+        }
+        else {
+            this->_isOverflowed = true;
+        }
+    }
+}
+
+void JsonWriter::WriteEscaped(const char* kpStr) noexcept {
+    char   pEscape[6];
+    size_t start;
+    size_t i;
+
+    /* Unescaped runs are copied at once */
+    start = 0;
+    for (i = 0; 0 != kpStr[i]; ++i) {
+        if ('"' == kpStr[i] || '\\' == kpStr[i] ||
+            0x20 > (uint8_t)kpStr[i]) {
+            WriteRaw(kpStr + start, i - start);
+            start = i + 1;
+
+            pEscape[0] = '\\';
+            if ('"' == kpStr[i] || '\\' == kpStr[i]) {
+                pEscape[1] = kpStr[i];
+                WriteRaw(pEscape, 2);
+            }
+            else if ('\n' == kpStr[i]) {
+                pEscape[1] = 'n';
+                WriteRaw(pEscape, 2);
+            }
+            else if ('\r' == kpStr[i]) {
+                pEscape[1] = 'r';
+                WriteRaw(pEscape, 2);
+            }
+            else if ('\t' == kpStr[i]) {
+                pEscape[1] = 't';
+                WriteRaw(pEscape, 2);
+            }
+            else {
+                pEscape[1] = 'u';
+                pEscape[2] = '0';
+                pEscape[3] = '0';
+                pEscape[4] = skHexDigits[((uint8_t)kpStr[i]) >> 4];
+                pEscape[5] = skHexDigits[((uint8_t)kpStr[i]) & 0xF];
+                WriteRaw(pEscape, 6);
+            }
+        }
+    }
+    WriteRaw(kpStr + start, i - start);
+}
+
+void JsonWriter::WriteDigits(const uint64_t kValue) noexcept {
+    char     pDigits[JSON_MAX_DIGITS];
+    size_t   position;
+    uint64_t value;
+
+    /* Digits are produced from the end */
+    position = JSON_MAX_DIGITS;
+    value = kValue;
+    do {
+        --position;
+        pDigits[position] = (char)('0' + value % 10);
+        value /= 10;
+    } while (0 != value);
+
+    WriteRaw(pDigits + position, JSON_MAX_DIGITS - position);
+}
+
+void JsonWriter::WriteCborHead(const uint8_t  kMajor,
+                               const uint64_t kValue) noexcept {
+    uint8_t pHead[CBOR_MAX_HEAD];
+    size_t  length;
+    size_t  i;
+
+    /* The argument follows the initial byte in network order */
+    if (CBOR_INFO_UINT8 > kValue) {
+        length = 0;
+        pHead[0] = (uint8_t)kValue;
+    }
+    else if (0xFF >= kValue) {
+        length = 1;
+        pHead[0] = CBOR_INFO_UINT8;
+    }
+    else if (0xFFFF >= kValue) {
+        length = 2;
+        pHead[0] = CBOR_INFO_UINT8 + 1;
+    }
+    else if (0xFFFFFFFF >= kValue) {
+        length = 4;
+        pHead[0] = CBOR_INFO_UINT8 + 2;
+    }
+    else {
+        length = 8;
+        pHead[0] = CBOR_INFO_UINT8 + 3;
+    }
+    pHead[0] |= (uint8_t)(kMajor << 5);
+    for (i = 0; length > i; ++i) {
+        pHead[length - i] = (uint8_t)(kValue >> (8 * i));
+    }
+
+    WriteRaw((const char*)pHead, length + 1);
+}
+
+void JsonWriter::WriteCborString(const char* kpStr) noexcept {
+    size_t length;
+
+    length = strlen(kpStr);
+    WriteCborHead(CBOR_MAJOR_TEXT, length);
+    WriteRaw(kpStr, length);
+}
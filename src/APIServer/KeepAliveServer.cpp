@@ -0,0 +1,458 @@
+/*******************************************************************************
+ * @file KeepAliveServer.cpp
+ *
+ * @see KeepAliveServer.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief HTTP server with persistent connections.
+ *
+ * @details HTTP server with persistent connections. The server keeps the
+ * client connections open between requests and serves the requests pipelined
+ * on a connection back to back.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cstdio>          /* Standard IO */
+#include <cstdint>         /* Standard integer definitions */
+#include <algorithm>       /* std::max */
+#include <BSP.h>           /* Time services */
+#include <WiFi.h>          /* WiFi services */
+#include <Logger.h>        /* Logger services */
+#include <WebServer.h>     /* Web server services */
+#include <lwip/sockets.h>  /* lwIP sockets readiness */
+
+/* Header file */
+#include <KeepAliveServer.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the size of the response header buffer. */
+#define KEEPALIVE_HEADER_SIZE 192
+
+/** @brief Defines the size of a chunk size line. */
+#define KEEPALIVE_CHUNK_HEADER_SIZE 12
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Returns the reason phrase of an HTTP code.
+ *
+ * @param[in] kCode The HTTP code.
+ *
+ * @return The reason phrase is returned, an empty string for the codes not
+ * sent by the firmware.
+ */
+static const char* GetReason(const int32_t kCode) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/**
+ * @brief The request headers used by the connections management, the
+ * firmware update transfers and the API content negotiation.
+ */
+static const char* spkCollectedHeaders[] = {
+    "Connection",
+    "X-OTA-Offset",
+    "Accept",
+    "Content-Type"
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static const char* GetReason(const int32_t kCode) noexcept {
+    const char* pkReason;
+
+    switch (kCode) {
+        case 200:
+            pkReason = "OK";
+            break;
+        case 400:
+            pkReason = "Bad Request";
+            break;
+        case 404:
+            pkReason = "Not Found";
+            break;
+        case 500:
+            pkReason = "Internal Server Error";
+            break;
+        default:
+            pkReason = "";
+            break;
+    }
+
+    return pkReason;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+KeepAliveServer::KeepAliveServer(const uint16_t kPort) noexcept :
+    WebServer(kPort) {
+    uint32_t i;
+
+    for (i = 0; KEEPALIVE_MAX_CLIENTS > i; ++i) {
+        this->_pSlots[i].lastActivity = 0;
+        this->_pSlots[i].requests = 0;
+    }
+    this->_pCurrentSlot = nullptr;
+    this->_isKeptAlive = false;
+    this->_isChunked = false;
+    this->_isStreamValid = false;
+    this->_streamSize = 0;
+
+    collectHeaders(
+        spkCollectedHeaders,
+        sizeof(spkCollectedHeaders) / sizeof(spkCollectedHeaders[0])
+    );
+}
+
+void KeepAliveServer::HandleClients(void) noexcept {
+    uint64_t currentTime;
+    uint32_t i;
+
+    Accept();
+
+    currentTime = HWManager::GetTime();
+    for (i = 0; KEEPALIVE_MAX_CLIENTS > i; ++i) {
+        if (!this->_pSlots[i].client.connected()) {
+            /* Release the socket of the connections closed by the client */
+            this->_pSlots[i].client.stop();
+        }
+        else if (0 != this->_pSlots[i].client.available()) {
+            Serve(this->_pSlots[i]);
+        }
+        else if (KEEPALIVE_IDLE_TIMEOUT_NS <
+                 currentTime - this->_pSlots[i].lastActivity) {
+            LOG_DEBUG("Closing idle API connection %d.\n", i);
+            this->_pSlots[i].client.stop();
+        }
+    }
+}
+
+bool KeepAliveServer::AddWaitSockets(fd_set& rSet,
+                                     int&    rMaxSocket,
+                                     bool&   rHasData) noexcept {
+    int      socket;
+    bool     isConnected;
+    uint32_t i;
+
+    isConnected = false;
+    for (i = 0; KEEPALIVE_MAX_CLIENTS > i; ++i) {
+        if (this->_pSlots[i].client.connected()) {
+            isConnected = true;
+            rHasData |= (0 != this->_pSlots[i].client.available());
+            socket = this->_pSlots[i].client.fd();
+            if (0 <= socket) {
+                FD_SET(socket, &rSet);
+                rMaxSocket = std::max(rMaxSocket, socket);
+            }
+        }
+    }
+
+    return isConnected;
+}
+
+void KeepAliveServer::SendResponse(const int32_t kCode,
+                                   const char*   kpType,
+                                   const char*   kpData,
+                                   const size_t  kSize) noexcept {
+    size_t length;
+    size_t written;
+    bool   isClosing;
+
+    isClosing = IsClosing();
+    length = WriteHeader(kCode, kpType, kSize, false, isClosing);
+    if (0 != length) {
+        written = length;
+        if (0 != kSize) {
+            written += this->_currentClient.write(
+                (const uint8_t*)kpData,
+                kSize
+            );
+        }
+
+        /* A partial response leaves the connection unusable */
+        this->_isKeptAlive = !isClosing && length + kSize == written;
+    }
+    else {
+        this->_isKeptAlive = false;
+    }
+}
+
+bool KeepAliveServer::BeginStream(const int32_t kCode,
+                                  const char*   kpType) noexcept {
+    bool isClosing;
+
+    /* HTTP/1.0 clients do not decode chunks, the close ends the body */
+    isClosing = IsClosing();
+    this->_isChunked = !isClosing;
+    this->_isStreamValid = 0 != WriteHeader(
+        kCode,
+        kpType,
+        0,
+        true,
+        isClosing
+    );
+    this->_isKeptAlive = false;
+    this->_streamSize = 0;
+
+    return this->_isStreamValid;
+}
+
+bool KeepAliveServer::SendChunk(const char*  kpData,
+                                const size_t kSize) noexcept {
+    char   pSize[KEEPALIVE_CHUNK_HEADER_SIZE];
+    int    length;
+    size_t expected;
+    size_t written;
+
+    /* An empty chunk would end the body */
+    if (this->_isStreamValid && 0 != kSize) {
+        if (this->_isChunked) {
+            length = snprintf(
+                pSize,
+                sizeof(pSize),
+                "%x\r\n",
+                (unsigned int)kSize
+            );
+            written = this->_currentClient.write(
+                (const uint8_t*)pSize,
+                (size_t)length
+            );
+            written += this->_currentClient.write(
+                (const uint8_t*)kpData,
+                kSize
+            );
+            written += this->_currentClient.write((const uint8_t*)"\r\n", 2);
+            expected = (size_t)length + kSize + 2;
+        }
+        else {
+            written = this->_currentClient.write(
+                (const uint8_t*)kpData,
+                kSize
+            );
+            expected = kSize;
+        }
+
+        /* A client gone or too slow aborts the stream */
+        this->_isStreamValid = expected == written;
+        if (this->_isStreamValid) {
+            this->_streamSize += kSize;
+        }
+    }
+
+    return this->_isStreamValid;
+}
+
+void KeepAliveServer::EndStream(void) noexcept {
+    size_t written;
+
+    if (this->_isStreamValid && this->_isChunked) {
+        written = this->_currentClient.write(
+            (const uint8_t*)"0\r\n\r\n",
+            5
+        );
+        this->_isKeptAlive = 5 == written;
+    }
+    this->_isStreamValid = false;
+}
+
+size_t KeepAliveServer::GetStreamSize(void) const noexcept {
+    return this->_streamSize;
+}
+
+size_t KeepAliveServer::WriteHeader(const int32_t kCode,
+                                    const char*   kpType,
+                                    const size_t  kSize,
+                                    const bool    kIsStream,
+                                    const bool    kIsClosing) noexcept {
+    char   pHeader[KEEPALIVE_HEADER_SIZE];
+    int    length;
+    int    tailLength;
+    size_t written;
+
+    length = snprintf(
+        pHeader,
+        sizeof(pHeader),
+        "HTTP/1.%d %d %s\r\n"
+        "Content-Type: %s\r\n",
+        this->_currentVersion,
+        (int)kCode,
+        GetReason(kCode),
+        kpType
+    );
+    if (0 < length && sizeof(pHeader) > (size_t)length) {
+        if (!kIsStream) {
+            tailLength = snprintf(
+                pHeader + length,
+                sizeof(pHeader) - length,
+                "Content-Length: %u\r\n",
+                (unsigned int)kSize
+            );
+        }
+        else if (!kIsClosing) {
+            tailLength = snprintf(
+                pHeader + length,
+                sizeof(pHeader) - length,
+                "Transfer-Encoding: chunked\r\n"
+            );
+        }
+        else {
+            /* The connection close delimits the body */
+            tailLength = 0;
+        }
+        length += tailLength;
+    }
+    if (0 < length && sizeof(pHeader) > (size_t)length) {
+        if (kIsClosing) {
+            tailLength = snprintf(
+                pHeader + length,
+                sizeof(pHeader) - length,
+                "Connection: close\r\n\r\n"
+            );
+        }
+        else {
+            tailLength = snprintf(
+                pHeader + length,
+                sizeof(pHeader) - length,
+                "Connection: keep-alive\r\n"
+                "Keep-Alive: timeout=%u, max=%u\r\n\r\n",
+                (unsigned int)(KEEPALIVE_IDLE_TIMEOUT_NS / 1000000000ULL),
+                (unsigned int)(KEEPALIVE_MAX_REQUESTS -
+                               this->_pCurrentSlot->requests)
+            );
+        }
+        length += tailLength;
+    }
+
+    written = 0;
+    if (0 < length && sizeof(pHeader) > (size_t)length) {
+        written = this->_currentClient.write(
+            (const uint8_t*)pHeader,
+            (size_t)length
+        );
+
+        /* A partial header cannot be completed */
+        if ((size_t)length != written) {
+            written = 0;
+        }
+    }
+    else {
+        LOG_ERROR("API response header overflow.\n");
+    }
+
+    return written;
+}
+
+void KeepAliveServer::Accept(void) noexcept {
+    WiFiClient client;
+    uint32_t   i;
+    bool       isAccepted;
+
+    client = this->_server.available();
+    if (client) {
+        isAccepted = false;
+        for (i = 0; KEEPALIVE_MAX_CLIENTS > i && !isAccepted; ++i) {
+            if (!this->_pSlots[i].client.connected()) {
+                /* Responses are small, do not wait for the client ACKs */
+                client.setNoDelay(true);
+                this->_pSlots[i].client = client;
+                this->_pSlots[i].lastActivity = HWManager::GetTime();
+                this->_pSlots[i].requests = 0;
+                isAccepted = true;
+            }
+        }
+
+        if (!isAccepted) {
+            LOG_DEBUG("Refused API connection, all slots are used.\n");
+            client.stop();
+        }
+    }
+}
+
+void KeepAliveServer::Serve(S_KeepAliveSlot& rSlot) noexcept {
+    uint32_t served;
+    bool     isOpen;
+
+    this->_pCurrentSlot = &rSlot;
+    this->_currentClient = rSlot.client;
+
+    /* Pipelined requests are served in order, the pipeline is bounded to
+     * keep serving the other connections.
+     */
+    served = 0;
+    isOpen = true;
+    while (isOpen &&
+           KEEPALIVE_MAX_PIPELINE > served &&
+           0 != this->_currentClient.available()) {
+        if (_parseRequest(this->_currentClient)) {
+            ++rSlot.requests;
+            ++served;
+
+            /* Same sequence as the framework handleClient */
+            this->_isKeptAlive = false;
+            this->_currentClient.setTimeout(HTTP_MAX_SEND_WAIT / 1000);
+            this->_contentLength = CONTENT_LENGTH_NOT_SET;
+            _handleRequest();
+
+            /* The framework send functions announced a close */
+            isOpen = this->_isKeptAlive;
+        }
+        else {
+            LOG_DEBUG("Invalid API request, closing the connection.\n");
+            isOpen = false;
+        }
+    }
+
+    rSlot.lastActivity = HWManager::GetTime();
+    if (!isOpen) {
+        rSlot.client.stop();
+    }
+
+    /* Release the server reference on the connection */
+    this->_currentClient = WiFiClient();
+    this->_pCurrentSlot = nullptr;
+}
+
+bool KeepAliveServer::IsClosing(void) noexcept {
+    return nullptr == this->_pCurrentSlot ||
+           0 == this->_currentVersion ||
+           KEEPALIVE_MAX_REQUESTS <= this->_pCurrentSlot->requests ||
+           header("Connection").equalsIgnoreCase("close");
+}
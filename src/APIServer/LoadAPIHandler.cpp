@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * @file LoadAPIHandler.cpp
+ *
+ * @see LoadAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Load statistics API handler.
+ *
+ * @details Load statistics API handler. This file defines the Load API
+ * handler used to report the device side counters of the load benchmarks.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cstdint>        /* Standard integer definitions */
+#include <HAL.h>          /* Hardware abstraction layer */
+#include <Logger.h>       /* Logger services */
+#include <Errors.h>       /* Errors definitions */
+#include <Timeout.h>      /* Timing histograms */
+#include <WebServer.h>    /* Web Server services */
+#include <JsonWriter.h>   /* JSON response writer */
+#include <APIHandler.h>   /* API Handler interface */
+#include <HandlerStats.h> /* Request handlers statistics */
+
+/* Header file */
+#include <LoadAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the reset parameter. */
+#define API_ARG_RESET "reset"
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+LoadAPIHandler::~LoadAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Load API handler.\n");
+}
+
+void LoadAPIHandler::Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept {
+    S_HALHeapStats heapStats;
+    uint64_t       average;
+    uint32_t       i;
+
+    LOG_DEBUG("Handling Load API.\n");
+
+    HAL::GetHeapStats(heapStats);
+
+    rWriter.BeginObject();
+    rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+    rWriter.AddUInt(
+        "window_ms",
+        (HAL::GetTime() - HandlerStats::GetWindowStart()) / 1000000ULL
+    );
+    rWriter.AddUInt("heap_free", heapStats.freeSize);
+    rWriter.AddUInt("heap_min", heapStats.minFreeSize);
+
+    /* Compact entries, all the routes of both servers fit the response */
+    rWriter.BeginArray("handlers");
+    i = 0;
+    while (HandlerStats::GetStats(i, this->_stats)) {
+        average = 0;
+        if (0 != this->_stats.service.count) {
+            average = this->_stats.totalNs / this->_stats.service.count;
+        }
+
+        rWriter.BeginObject();
+        rWriter.AddString("srv", this->_stats.pkServer);
+        rWriter.AddString("path", this->_stats.pkPath);
+        rWriter.AddUInt("count", this->_stats.service.count);
+        rWriter.AddUInt("min_us", this->_stats.service.minNs / 1000);
+        rWriter.AddUInt("avg_us", average / 1000);
+        rWriter.AddUInt(
+            "p50_us",
+            Timeout::GetPercentile(this->_stats.service, 50) / 1000
+        );
+        rWriter.AddUInt(
+            "p99_us",
+            Timeout::GetPercentile(this->_stats.service, 99) / 1000
+        );
+        rWriter.AddUInt("max_us", this->_stats.service.maxNs / 1000);
+        if (0 != this->_stats.service.count) {
+            rWriter.AddUInt("heap_low", this->_stats.heapLowWater);
+        }
+        rWriter.EndObject();
+        ++i;
+    }
+    rWriter.EndArray();
+    rWriter.EndObject();
+
+    /* The reset call is reported, its window starts after it */
+    if (krRequest.GetNamedArg(API_ARG_RESET).equals("1")) {
+        HandlerStats::Reset();
+    }
+}
@@ -0,0 +1,374 @@
+/*******************************************************************************
+ * @file MetricsAPIHandler.cpp
+ *
+ * @see MetricsAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Metrics API handler.
+ *
+ * @details Metrics API handler. This file defines the Metrics API handler
+ * used to export the firmware counters in the Prometheus text format.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cstdio>            /* Standard IO */
+#include <cstring>           /* String manipulation */
+#include <WiFi.h>            /* WiFi services */
+#include <Logger.h>          /* Logger services */
+#include <Errors.h>          /* Errors definitions */
+#include <Arduino.h>         /* Arduino framework */
+#include <Metrics.h>         /* Metrics counters */
+#include <JsonWriter.h>      /* JSON response writer */
+#include <APIHandler.h>      /* API Handler interface */
+#include <SystemState.h>     /* System state object */
+#include <HandlerStats.h>    /* Request handlers registry */
+#include <HealthMonitor.h>   /* Reporters status */
+#include <KeepAliveServer.h> /* Persistent connections server */
+
+/* Header file */
+#include <MetricsAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the content type of the Prometheus text format. */
+#define METRICS_CONTENT_TYPE "text/plain; version=0.0.4"
+
+/** @brief Defines the size of a formatted line. */
+#define METRICS_LINE_SIZE 160
+
+/** @brief Defines the size of the formatted labels of a sample. */
+#define METRICS_LABELS_SIZE 96
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The label values of the log counters, in log level order. */
+static const char* spkLogLevels[] = {
+    "critical",
+    "error",
+    "info",
+    "debug"
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+MetricsAPIHandler::MetricsAPIHandler(void) noexcept {
+    this->_pServer = nullptr;
+    this->_chunkSize = 0;
+}
+
+MetricsAPIHandler::~MetricsAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Metrics API handler.\n");
+}
+
+void MetricsAPIHandler::Handle(JsonWriter&       rWriter,
+                               const APIRequest& krRequest) noexcept {
+    (void)krRequest;
+
+    rWriter.BeginObject();
+    rWriter.AddUInt("result", E_APIResult::API_RES_METRICS_INVALID);
+    rWriter.AddString("msg", "Metrics are not batched.");
+    rWriter.EndObject();
+}
+
+void MetricsAPIHandler::Stream(KeepAliveServer* pServer) noexcept {
+    char           pLabels[METRICS_LABELS_SIZE];
+    HealthMonitor* pMonitor;
+    S_HandlerStats stats;
+    S_MetricRoute  route;
+    uint32_t       count;
+    uint32_t       i;
+    bool           isValid;
+
+    LOG_DEBUG("Handling Metrics API.\n");
+
+    this->_pServer = pServer;
+    this->_chunkSize = 0;
+    isValid = pServer->BeginStream(200, METRICS_CONTENT_TYPE);
+
+    /* Health Monitor reporters, the status follows E_HMStatus */
+    count = 0;
+    pMonitor = SystemState::GetInstance()->GetHealthMonitor();
+    if (nullptr != pMonitor) {
+        count = pMonitor->GetReportersStatus(
+            this->_pReporters,
+            HM_MAX_REPORTERS
+        );
+    }
+    isValid = isValid && WriteHeader(
+        "rthr_hm_reporter_status",
+        "gauge",
+        "Reporter status: 0 healthy, 1 degraded, 2 unhealthy, 3 disabled."
+    );
+    for (i = 0; isValid && count > i; ++i) {
+        snprintf(
+            pLabels,
+            sizeof(pLabels),
+            "{reporter=\"%s\"}",
+            this->_pReporters[i].pName
+        );
+        isValid = WriteSample(
+            "rthr_hm_reporter_status",
+            pLabels,
+            this->_pReporters[i].status
+        );
+    }
+    isValid = isValid && WriteHeader(
+        "rthr_hm_reporter_failures_total",
+        "counter",
+        "Failed checks of the reporter since its registration."
+    );
+    for (i = 0; isValid && count > i; ++i) {
+        snprintf(
+            pLabels,
+            sizeof(pLabels),
+            "{reporter=\"%s\"}",
+            this->_pReporters[i].pName
+        );
+        isValid = WriteSample(
+            "rthr_hm_reporter_failures_total",
+            pLabels,
+            (int64_t)this->_pReporters[i].totalFailures
+        );
+    }
+
+    isValid = isValid &&
+              WriteHeader(
+                  "rthr_watchdog_misses_total",
+                  "counter",
+                  "Watchdog deadlines missed."
+              ) &&
+              WriteSample(
+                  "rthr_watchdog_misses_total",
+                  "",
+                  Metrics::Get(E_MetricCounter::METRIC_WATCHDOG_MISSES)
+              );
+
+    /* Requests per route, in the handlers statistics order */
+    isValid = isValid && WriteHeader(
+        "rthr_http_requests_total",
+        "counter",
+        "Requests served per route."
+    );
+    for (i = 0; isValid && HANDLER_STATS_MAX > i; ++i) {
+        if (HandlerStats::GetStats(i, stats) &&
+            Metrics::GetRequests(i, route)) {
+            snprintf(
+                pLabels,
+                sizeof(pLabels),
+                "{server=\"%s\",path=\"%s\"}",
+                stats.pkServer,
+                stats.pkPath
+            );
+            isValid = WriteSample(
+                "rthr_http_requests_total",
+                pLabels,
+                route.requests
+            );
+        }
+    }
+    isValid = isValid && WriteHeader(
+        "rthr_http_response_bytes_total",
+        "counter",
+        "Response body bytes sent per route."
+    );
+    for (i = 0; isValid && HANDLER_STATS_MAX > i; ++i) {
+        if (HandlerStats::GetStats(i, stats) &&
+            Metrics::GetRequests(i, route)) {
+            snprintf(
+                pLabels,
+                sizeof(pLabels),
+                "{server=\"%s\",path=\"%s\"}",
+                stats.pkServer,
+                stats.pkPath
+            );
+            isValid = WriteSample(
+                "rthr_http_response_bytes_total",
+                pLabels,
+                route.bytes
+            );
+        }
+    }
+
+    isValid = isValid && WriteHeader(
+        "rthr_log_lines_total",
+        "counter",
+        "Log lines emitted per level."
+    );
+    for (i = 0; isValid && sizeof(spkLogLevels) / sizeof(char*) > i; ++i) {
+        snprintf(
+            pLabels,
+            sizeof(pLabels),
+            "{level=\"%s\"}",
+            spkLogLevels[i]
+        );
+        isValid = WriteSample(
+            "rthr_log_lines_total",
+            pLabels,
+            Metrics::Get(
+                (E_MetricCounter)(E_MetricCounter::METRIC_LOG_CRITICAL + i)
+            )
+        );
+    }
+
+    isValid = isValid &&
+              WriteHeader(
+                  "rthr_sd_written_bytes_total",
+                  "counter",
+                  "Bytes written to the SD card per writer."
+              ) &&
+              WriteSample(
+                  "rthr_sd_written_bytes_total",
+                  "{writer=\"logger\"}",
+                  Metrics::Get(E_MetricCounter::METRIC_SD_LOGGER_BYTES)
+              ) &&
+              WriteSample(
+                  "rthr_sd_written_bytes_total",
+                  "{writer=\"settings\"}",
+                  Metrics::Get(E_MetricCounter::METRIC_SD_SETTINGS_BYTES)
+              );
+
+    /* Gauges, read when scraped */
+    isValid = isValid &&
+              WriteHeader(
+                  "rthr_heap_free_bytes",
+                  "gauge",
+                  "Free internal heap."
+              ) &&
+              WriteSample("rthr_heap_free_bytes", "", ESP.getFreeHeap()) &&
+              WriteHeader(
+                  "rthr_heap_min_free_bytes",
+                  "gauge",
+                  "Lowest free internal heap since boot."
+              ) &&
+              WriteSample(
+                  "rthr_heap_min_free_bytes",
+                  "",
+                  ESP.getMinFreeHeap()
+              ) &&
+              WriteHeader(
+                  "rthr_psram_free_bytes",
+                  "gauge",
+                  "Free PSRAM."
+              ) &&
+              WriteSample("rthr_psram_free_bytes", "", ESP.getFreePsram());
+    if (isValid && WiFi.isConnected()) {
+        isValid = WriteHeader(
+                      "rthr_wifi_rssi_dbm",
+                      "gauge",
+                      "Signal strength of the station link."
+                  ) &&
+                  WriteSample("rthr_wifi_rssi_dbm", "", WiFi.RSSI());
+    }
+
+    isValid = isValid &&
+              pServer->SendChunk(this->_pChunk, this->_chunkSize);
+    pServer->EndStream();
+
+    if (!isValid) {
+        LOG_ERROR("Metrics stream aborted.\n");
+    }
+    this->_pServer = nullptr;
+}
+
+bool MetricsAPIHandler::Write(const char* kpData, const size_t kSize) noexcept {
+    bool isValid;
+
+    isValid = true;
+    if (sizeof(this->_pChunk) - this->_chunkSize < kSize) {
+        isValid = this->_pServer->SendChunk(this->_pChunk, this->_chunkSize);
+        this->_chunkSize = 0;
+    }
+    if (isValid) {
+        memcpy(this->_pChunk + this->_chunkSize, kpData, kSize);
+        this->_chunkSize += kSize;
+    }
+
+    return isValid;
+}
+
+bool MetricsAPIHandler::WriteHeader(const char* kpName,
+                                    const char* kpType,
+                                    const char* kpHelp) noexcept {
+    char pLine[METRICS_LINE_SIZE];
+    int  length;
+
+    length = snprintf(
+        pLine,
+        sizeof(pLine),
+        "# HELP %s %s\n# TYPE %s %s\n",
+        kpName,
+        kpHelp,
+        kpName,
+        kpType
+    );
+
+    return 0 < length &&
+           sizeof(pLine) > (size_t)length &&
+           Write(pLine, (size_t)length);
+}
+
+bool MetricsAPIHandler::WriteSample(const char*   kpName,
+                                    const char*   kpLabels,
+                                    const int64_t kValue) noexcept {
+    char pLine[METRICS_LINE_SIZE];
+    int  length;
+
+    length = snprintf(
+        pLine,
+        sizeof(pLine),
+        "%s%s %lld\n",
+        kpName,
+        kpLabels,
+        (long long)kValue
+    );
+
+    return 0 < length &&
+           sizeof(pLine) > (size_t)length &&
+           Write(pLine, (size_t)length);
+}
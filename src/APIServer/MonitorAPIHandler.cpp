@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * @file MonitorAPIHandler.cpp
+ *
+ * @see MonitorAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief System monitor API handler.
+ *
+ * @details System monitor API handler. This file defines the Monitor API
+ * handler used to report the tasks, memory and sockets usage over the
+ * monitor time window.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cstring>         /* strncmp */
+#include <cstdint>         /* Standard integer definitions */
+#include <algorithm>       /* std::min, std::max */
+#include <Logger.h>        /* Logger services */
+#include <Errors.h>        /* Errors definitions */
+#include <WebServer.h>     /* Web Server services */
+#include <JsonWriter.h>    /* JSON response writer */
+#include <APIHandler.h>    /* API Handler interface */
+#include <SystemState.h>   /* System state */
+#include <SystemMonitor.h> /* Monitor samples */
+
+/* Header file */
+#include <MonitorAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+MonitorAPIHandler::~MonitorAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Monitor API handler.\n");
+}
+
+void MonitorAPIHandler::Handle(JsonWriter&       rWriter,
+                               const APIRequest& krRequest) noexcept {
+    SystemMonitor*      pMonitor;
+    const S_SysMonTask* kpTask;
+    uint32_t            count;
+    uint32_t            i;
+    uint32_t            j;
+    uint32_t            k;
+
+    (void)krRequest;
+
+    LOG_DEBUG("Handling Monitor API.\n");
+
+    rWriter.BeginObject();
+    pMonitor = SystemState::GetInstance()->GetSystemMonitor();
+    if (nullptr == pMonitor || !pMonitor->GetLatest(this->_latest)) {
+        rWriter.AddUInt("result", E_APIResult::API_RES_UNKNOWN);
+        rWriter.AddString("msg", "The system monitor has no sample.");
+    }
+    else {
+        rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+        rWriter.AddUInt("period_ms", SYSMON_PERIOD_NS / 1000000ULL);
+        rWriter.AddUInt("sock_max", this->_latest.socketsMax);
+
+        /* Without the run time statistics, the CPU usages are omitted */
+        rWriter.AddBool("cpu_stats", SYSMON_HAS_RUN_TIME);
+
+        for (i = 0; this->_latest.taskCount > i; ++i) {
+            this->_pCpuMax[i] = this->_latest.pTasks[i].cpuPermille;
+            this->_pStackMin[i] = this->_latest.pTasks[i].stackFree;
+        }
+
+        /* Compact entries, the whole window fits the response */
+        rWriter.BeginArray("window");
+        count = pMonitor->GetSampleCount();
+        for (i = 0; count > i; ++i) {
+            if (pMonitor->GetSample(i, this->_sample)) {
+                rWriter.BeginObject();
+                rWriter.AddUInt("t", this->_sample.timeMs);
+                if (SYSMON_HAS_RUN_TIME) {
+                    rWriter.BeginArray("cpu");
+                    for (j = 0; portNUM_PROCESSORS > j; ++j) {
+                        rWriter.AddUInt(nullptr, this->_sample.pCoreLoad[j]);
+                    }
+                    rWriter.EndArray();
+                }
+                rWriter.BeginArray("sram");
+                rWriter.AddUInt(nullptr, this->_sample.internalFree);
+                rWriter.AddUInt(nullptr, this->_sample.internalLargest);
+                rWriter.EndArray();
+                rWriter.BeginArray("psram");
+                rWriter.AddUInt(nullptr, this->_sample.psramFree);
+                rWriter.AddUInt(nullptr, this->_sample.psramLargest);
+                rWriter.EndArray();
+                rWriter.AddUInt("sock", this->_sample.socketsUsed);
+                rWriter.EndObject();
+
+                /* The tasks are matched by name between the samples */
+                for (j = 0; this->_sample.taskCount > j; ++j) {
+                    kpTask = &this->_sample.pTasks[j];
+                    for (k = 0; this->_latest.taskCount > k; ++k) {
+                        if (0 == strncmp(kpTask->pName,
+                                         this->_latest.pTasks[k].pName,
+                                         SYSMON_TASK_NAME_SIZE)) {
+                            this->_pCpuMax[k] = std::max(
+                                this->_pCpuMax[k],
+                                kpTask->cpuPermille
+                            );
+                            this->_pStackMin[k] = std::min(
+                                this->_pStackMin[k],
+                                kpTask->stackFree
+                            );
+                        }
+                    }
+                }
+            }
+        }
+        rWriter.EndArray();
+
+        rWriter.BeginArray("tasks");
+        for (i = 0; this->_latest.taskCount > i; ++i) {
+            kpTask = &this->_latest.pTasks[i];
+            rWriter.BeginObject();
+            rWriter.AddString("name", kpTask->pName);
+            rWriter.AddInt("core", kpTask->core);
+            if (SYSMON_HAS_RUN_TIME) {
+                rWriter.AddUInt("cpu", kpTask->cpuPermille);
+                rWriter.AddUInt("cpu_max", this->_pCpuMax[i]);
+            }
+            rWriter.AddUInt("stack", this->_pStackMin[i]);
+            rWriter.EndObject();
+        }
+        rWriter.EndArray();
+    }
+    rWriter.EndObject();
+}
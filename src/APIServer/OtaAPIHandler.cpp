@@ -0,0 +1,295 @@
+/*******************************************************************************
+ * @file OtaAPIHandler.cpp
+ *
+ * @see OtaAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware update API handler.
+ *
+ * @details Firmware update API handler. This file defines the OTA API handler
+ * used to stream a firmware image into the inactive application partition.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cstdio>       /* Standard IO */
+#include <cstdlib>      /* strtoul */
+#include <cstdint>      /* Standard integer definitions */
+#include <Logger.h>     /* Logger services */
+#include <Errors.h>     /* Errors definitions */
+#include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIHandler.h> /* API Handler interface */
+#include <OtaUpdater.h> /* Firmware update writer */
+
+/* Header file */
+#include <OtaAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the argument string for the call mode. */
+#define API_ARG_MODE "mode"
+/** @brief Defines the argument string for the image size. */
+#define API_ARG_SIZE "size"
+/** @brief Defines the argument string for the image hash. */
+#define API_ARG_HASH "sha256"
+
+/** @brief Defines the mode starting or resuming an update. */
+#define API_MODE_BEGIN "begin"
+/** @brief Defines the mode verifying and selecting the image. */
+#define API_MODE_FINISH "finish"
+/** @brief Defines the mode stopping the update. */
+#define API_MODE_ABORT "abort"
+
+/** @brief Defines the size of the formatted error messages. */
+#define API_MSG_SIZE 64
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Parses an unsigned decimal value.
+ *
+ * @param[in] krValue The value.
+ * @param[out] rNumber The parsed number.
+ *
+ * @return true is returned when the whole value is a 32 bits number.
+ */
+static bool ParseNumber(const String& krValue, uint32_t& rNumber) noexcept;
+
+/**
+ * @brief Parses the hexadecimal image hash.
+ *
+ * @param[in] krValue The value.
+ * @param[out] pHash The buffer receiving the OTA_HASH_SIZE bytes of hash.
+ *
+ * @return true is returned when the value is a valid hash.
+ */
+static bool ParseHash(const String& krValue, uint8_t* pHash) noexcept;
+
+/**
+ * @brief Returns the value of an hexadecimal digit.
+ *
+ * @param[in] kDigit The digit.
+ *
+ * @return The value of the digit is returned, -1 if it is not a digit.
+ */
+static int32_t HexValue(const char kDigit) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The update states names, by state. */
+static const char* spkStateNames[] = {
+    "idle",
+    "receiving",
+    "ready",
+    "failed"
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static bool ParseNumber(const String& krValue, uint32_t& rNumber) noexcept {
+    char*         pEnd;
+    unsigned long number;
+
+    number = strtoul(krValue.c_str(), &pEnd, 10);
+    rNumber = (uint32_t)number;
+
+    return 0 != krValue.length() && 0 == *pEnd &&
+           '-' != *krValue.c_str() && number == rNumber;
+}
+
+static bool ParseHash(const String& krValue, uint8_t* pHash) noexcept {
+    const char* pkValue;
+    int32_t     high;
+    int32_t     low;
+    uint32_t    i;
+    bool        isValid;
+
+    pkValue = krValue.c_str();
+    isValid = (2 * OTA_HASH_SIZE == krValue.length());
+    for (i = 0; isValid && OTA_HASH_SIZE > i; ++i) {
+        high = HexValue(pkValue[2 * i]);
+        low = HexValue(pkValue[2 * i + 1]);
+        isValid = (0 <= high && 0 <= low);
+        pHash[i] = (uint8_t)((high << 4) | low);
+    }
+
+    return isValid;
+}
+
+static int32_t HexValue(const char kDigit) noexcept {
+    int32_t value;
+
+    if ('0' <= kDigit && '9' >= kDigit) {
+        value = kDigit - '0';
+    }
+    else if ('a' <= kDigit && 'f' >= kDigit) {
+        value = kDigit - 'a' + 10;
+    }
+    else if ('A' <= kDigit && 'F' >= kDigit) {
+        value = kDigit - 'A' + 10;
+    }
+    else {
+        value = -1;
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+OtaAPIHandler::OtaAPIHandler(void) noexcept {
+    this->_transferError = E_Return::NO_ERROR;
+}
+
+OtaAPIHandler::~OtaAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the OTA API handler.\n");
+}
+
+void OtaAPIHandler::Handle(JsonWriter&       rWriter,
+                           const APIRequest& krRequest) noexcept {
+    String   mode;
+    E_Return error;
+
+    LOG_DEBUG("Handling OTA API.\n");
+
+    mode = krRequest.GetNamedArg(API_ARG_MODE);
+    if (0 == krRequest.GetArgCount()) {
+        error = E_Return::NO_ERROR;
+    }
+    else if (mode.equals(API_MODE_BEGIN) && 3 == krRequest.GetArgCount()) {
+        error = Begin(krRequest);
+    }
+    else if (mode.equals(API_MODE_FINISH) && 1 == krRequest.GetArgCount()) {
+        error = this->_updater.Finish();
+    }
+    else if (mode.equals(API_MODE_ABORT) && 1 == krRequest.GetArgCount()) {
+        this->_updater.Abort();
+        error = E_Return::NO_ERROR;
+    }
+    else {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+
+    if (E_Return::NO_ERROR != error) {
+        LOG_ERROR("OTA API call failed: %d.\n", error);
+    }
+    FormatStatus(rWriter, error);
+}
+
+void OtaAPIHandler::Receive(const String&  krOffset,
+                            const HTTPRaw& krRaw) noexcept {
+    uint32_t offset;
+
+    if (RAW_START == krRaw.status) {
+        if (ParseNumber(krOffset, offset)) {
+            this->_transferError = this->_updater.BeginTransfer(offset);
+        }
+        else {
+            this->_transferError = E_Return::ERR_INVALID_PARAM;
+        }
+    }
+    else if (E_Return::NO_ERROR == this->_transferError) {
+        if (RAW_WRITE == krRaw.status) {
+            this->_transferError = this->_updater.Write(
+                krRaw.buf,
+                krRaw.currentSize
+            );
+        }
+        else {
+            /* Ended or aborted, the received data are kept for a resume */
+            this->_transferError = this->_updater.EndTransfer();
+        }
+    }
+}
+
+void OtaAPIHandler::HandleTransfer(JsonWriter& rWriter) noexcept {
+    LOG_DEBUG("Handling OTA data API.\n");
+
+    if (E_Return::NO_ERROR != this->_transferError) {
+        LOG_ERROR("OTA transfer failed: %d.\n", this->_transferError);
+    }
+    FormatStatus(rWriter, this->_transferError);
+}
+
+void OtaAPIHandler::FormatStatus(JsonWriter&    rWriter,
+                                 const E_Return kError) noexcept {
+    char        pMessage[API_MSG_SIZE];
+    S_OtaStatus status;
+
+    this->_updater.GetStatus(status);
+
+    rWriter.BeginObject();
+    if (E_Return::NO_ERROR == kError) {
+        rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+    }
+    else {
+        snprintf(
+            pMessage,
+            sizeof(pMessage),
+            "Firmware update error %d",
+            kError
+        );
+        rWriter.AddUInt("result", E_APIResult::API_RES_OTA_ERROR);
+        rWriter.AddString("msg", pMessage);
+    }
+    rWriter.AddString("state", spkStateNames[status.state]);
+    rWriter.AddUInt("size", status.imageSize);
+    rWriter.AddUInt("offset", status.offset);
+    rWriter.AddUInt("written", status.written);
+    rWriter.AddUInt("error", status.error);
+    rWriter.EndObject();
+}
+
+E_Return OtaAPIHandler::Begin(const APIRequest& krRequest) noexcept {
+    uint8_t  pHash[OTA_HASH_SIZE];
+    uint32_t size;
+    E_Return error;
+
+    if (ParseNumber(krRequest.GetNamedArg(API_ARG_SIZE), size) &&
+        ParseHash(krRequest.GetNamedArg(API_ARG_HASH), pHash)) {
+        error = this->_updater.Begin(size, pHash);
+    }
+    else {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+
+    return error;
+}
@@ -21,11 +21,14 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
 /* Included headers */
-#include <string>       /* Standard string */
 #include <Logger.h>     /* Logger services */
 #include <Errors.h>     /* Errors definitions */
 #include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
 #include <APIHandler.h> /* API Handler interface */
 
 /* Header file */
@@ -77,13 +80,14 @@ PingAPIHandler::~PingAPIHandler(void) noexcept {
     PANIC("Tried to destroy the Ping API handler.\n");
 }
 
-void PingAPIHandler::Handle(std::string& rResponse, WebServer* pServer)
-noexcept {
-    (void)pServer;
+void PingAPIHandler::Handle(JsonWriter&       rWriter,
+                            const APIRequest& krRequest) noexcept {
+    (void)krRequest;
 
     LOG_DEBUG("Handling Ping API.\n");
 
-    rResponse = "{\"result\": " +
-        std::to_string(E_APIResult::API_RES_NO_ERROR) +
-        ", \"msg\": \"Pong\"}";
+    rWriter.BeginObject();
+    rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+    rWriter.AddString("msg", "Pong");
+    rWriter.EndObject();
 }
\ No newline at end of file
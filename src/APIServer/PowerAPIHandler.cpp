@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * @file PowerAPIHandler.cpp
+ *
+ * @see PowerAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief WiFi power-save API handler.
+ *
+ * @details WiFi power-save API handler. This file defines the Power API
+ * handler used to set the request latency budget and report the estimated
+ * current draw.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cstdio>        /* Standard IO */
+#include <cstdlib>       /* strtoul */
+#include <Logger.h>      /* Logger services */
+#include <Errors.h>      /* Errors definitions */
+#include <WiFiPower.h>   /* WiFi power-save scheduler */
+#include <WebServer.h>   /* Web Server services */
+#include <WiFiModule.h>  /* WiFi module */
+#include <JsonWriter.h>  /* JSON response writer */
+#include <APIHandler.h>  /* API Handler interface */
+#include <SystemState.h> /* System state object */
+
+/* Header file */
+#include <PowerAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the argument string for the latency budget. */
+#define API_ARG_BUDGET "budget_ms"
+
+/** @brief Defines the size of the formatted error messages. */
+#define API_MSG_SIZE 96
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+PowerAPIHandler::~PowerAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Power API handler.\n");
+}
+
+void PowerAPIHandler::Handle(JsonWriter&       rWriter,
+                             const APIRequest& krRequest) noexcept {
+    char          pMessage[API_MSG_SIZE];
+    String        arg;
+    char*         pEnd;
+    unsigned long budgetMs;
+    E_Return      result;
+
+    LOG_DEBUG("Handling Power API.\n");
+
+    rWriter.BeginObject();
+    if (0 == krRequest.GetArgCount()) {
+        rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+        FormatStats(rWriter);
+    }
+    else if (1 == krRequest.GetArgCount() &&
+             krRequest.GetArgName(0).equals(API_ARG_BUDGET)) {
+        arg = krRequest.GetArg(0);
+        budgetMs = strtoul(arg.c_str(), &pEnd, 10);
+        if (0 == arg.length() || 0 != *pEnd || UINT16_MAX < budgetMs) {
+            rWriter.AddUInt("result", E_APIResult::API_RES_WIFI_SET_UNKNOWN);
+            rWriter.AddString(
+                "msg",
+                "Invalid parameter " API_ARG_BUDGET " value."
+            );
+        }
+        else {
+            result = SystemState::GetInstance()->GetWiFiModule()->
+                SetLatencyBudget((uint16_t)budgetMs);
+            if (E_Return::NO_ERROR == result) {
+                rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+                FormatStats(rWriter);
+            }
+            else {
+                snprintf(
+                    pMessage,
+                    sizeof(pMessage),
+                    "Error while saving the latency budget: error %d",
+                    result
+                );
+                rWriter.AddUInt(
+                    "result",
+                    E_APIResult::API_RES_WIFI_SET_ACTION_ERR
+                );
+                rWriter.AddString("msg", pMessage);
+            }
+        }
+    }
+    else {
+        rWriter.AddUInt("result", E_APIResult::API_RES_WIFI_SET_UNKNOWN);
+        rWriter.AddString("msg", "Unknown parameters.");
+
+        LOG_ERROR("Invalid Power API parameters.\n");
+    }
+    rWriter.EndObject();
+}
+
+void PowerAPIHandler::FormatStats(JsonWriter& rWriter) noexcept {
+    S_WiFiPowerStats stats;
+
+    SystemState::GetInstance()->GetWiFiModule()->GetPower()->GetStats(stats);
+
+    /* The current is estimated from the time spent in each radio state */
+    rWriter.AddUInt("budget_ms", stats.budgetMs);
+    rWriter.AddUInt("listen_interval", stats.listenInterval);
+    rWriter.AddBool("awake", stats.isAwake);
+    rWriter.AddUInt("awake_ms", stats.awakeMs);
+    rWriter.AddUInt("sleep_ms", stats.sleepMs);
+    rWriter.AddUInt("wakeups", stats.wakeups);
+    rWriter.AddUInt("avg_current_ua", stats.avgCurrentUa);
+    rWriter.AddUInt("sleep_current_ua", stats.sleepCurrentUa);
+    rWriter.BeginObject("latency");
+    rWriter.AddUInt("wake_avg_us", stats.wakeLatencyAvgUs);
+    rWriter.AddUInt("wake_max_us", stats.wakeLatencyMaxUs);
+    rWriter.AddUInt("responses", stats.responses);
+    rWriter.AddUInt("service_avg_us", stats.serviceAvgUs);
+    rWriter.AddUInt("service_max_us", stats.serviceMaxUs);
+    rWriter.EndObject();
+}
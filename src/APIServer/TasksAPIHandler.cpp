@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * @file TasksAPIHandler.cpp
+ *
+ * @see TasksAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Tasks placement API handler.
+ *
+ * @details Tasks placement API handler. This file defines the Tasks API
+ * handler used to report and override the core, priority and stack size of
+ * the firmware tasks.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cstdio>         /* Standard IO */
+#include <cstdlib>        /* strtol */
+#include <Logger.h>       /* Logger services */
+#include <Errors.h>       /* Errors definitions */
+#include <WebServer.h>    /* Web Server services */
+#include <JsonWriter.h>   /* JSON response writer */
+#include <APIHandler.h>   /* API Handler interface */
+#include <TaskRegistry.h> /* Firmware tasks registry */
+
+/* Header file */
+#include <TasksAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the argument string for the task name. */
+#define API_ARG_TASK "task"
+/** @brief Defines the argument string for the task core. */
+#define API_ARG_CORE "core"
+/** @brief Defines the argument string for the task priority. */
+#define API_ARG_PRIO "prio"
+/** @brief Defines the argument string for the task stack size. */
+#define API_ARG_STACK "stack"
+/** @brief Defines the argument string for the override removal. */
+#define API_ARG_CLEAR "clear"
+
+/** @brief Defines the size of the formatted error messages. */
+#define API_MSG_SIZE 96
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Parses a signed decimal parameter.
+ *
+ * @param[in] krValue The parameter value.
+ * @param[out] rNumber The parsed number.
+ *
+ * @return true is returned when the whole value is a number.
+ */
+static bool ParseNumber(const String& krValue, long& rNumber) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static bool ParseNumber(const String& krValue, long& rNumber) noexcept {
+    char* pEnd;
+
+    rNumber = strtol(krValue.c_str(), &pEnd, 10);
+
+    return 0 != krValue.length() && 0 == *pEnd;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+TasksAPIHandler::~TasksAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Tasks API handler.\n");
+}
+
+void TasksAPIHandler::Handle(JsonWriter&       rWriter,
+                             const APIRequest& krRequest) noexcept {
+    char         pMessage[API_MSG_SIZE];
+    S_TaskConfig config;
+    E_TaskId     id;
+    E_Return     result;
+
+    LOG_DEBUG("Handling Tasks API.\n");
+
+    rWriter.BeginObject();
+    if (0 == krRequest.GetArgCount()) {
+        rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+        FormatTasks(rWriter);
+    }
+    else if (!TaskRegistry::Find(
+                krRequest.GetNamedArg(API_ARG_TASK).c_str(),
+                id
+             )) {
+        rWriter.AddUInt("result", E_APIResult::API_RES_TASK_INVALID);
+        rWriter.AddString("msg", "Unknown " API_ARG_TASK " value.");
+    }
+    else {
+        if (2 == krRequest.GetArgCount() &&
+            krRequest.GetNamedArg(API_ARG_CLEAR).equals("1")) {
+            result = TaskRegistry::ClearOverride(id);
+        }
+        else if (4 == krRequest.GetArgCount() &&
+                 ParseConfig(krRequest, config)) {
+            result = TaskRegistry::SetOverride(id, config);
+        }
+        else {
+            result = E_Return::ERR_TASK_INVALID_CONFIG;
+        }
+
+        if (E_Return::NO_ERROR == result) {
+            rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+            FormatTasks(rWriter);
+        }
+        else {
+            snprintf(
+                pMessage,
+                sizeof(pMessage),
+                "Error while storing the task override: error %d",
+                result
+            );
+            rWriter.AddUInt("result", E_APIResult::API_RES_TASK_INVALID);
+            rWriter.AddString("msg", pMessage);
+
+            LOG_ERROR("Invalid Tasks API parameters.\n");
+        }
+    }
+    rWriter.EndObject();
+}
+
+void TasksAPIHandler::FormatTasks(JsonWriter& rWriter) noexcept {
+    S_TaskConfig config;
+    uint32_t     i;
+
+    /* The running placement differs from the override until the next boot */
+    rWriter.BeginArray("tasks");
+    for (i = 0; E_TaskId::TASK_ID_COUNT > i; ++i) {
+        TaskRegistry::GetConfig((E_TaskId)i, config);
+
+        rWriter.BeginObject();
+        rWriter.AddString("name", TaskRegistry::GetName((E_TaskId)i));
+        rWriter.AddInt("core", config.core);
+        rWriter.AddUInt("prio", config.priority);
+        rWriter.AddUInt("stack", config.stackSize);
+        rWriter.AddUInt("stack_peak", TaskRegistry::GetStackPeak((E_TaskId)i));
+        if (TaskRegistry::GetOverride((E_TaskId)i, config)) {
+            rWriter.BeginObject("override");
+            rWriter.AddInt("core", config.core);
+            rWriter.AddUInt("prio", config.priority);
+            rWriter.AddUInt("stack", config.stackSize);
+            rWriter.EndObject();
+        }
+        rWriter.EndObject();
+    }
+    rWriter.EndArray();
+}
+
+bool TasksAPIHandler::ParseConfig(const APIRequest& krRequest,
+                                  S_TaskConfig&     rConfig) noexcept {
+    long core;
+    long priority;
+    long stackSize;
+    bool isValid;
+
+    isValid = ParseNumber(krRequest.GetNamedArg(API_ARG_CORE), core) &&
+              ParseNumber(krRequest.GetNamedArg(API_ARG_PRIO), priority) &&
+              ParseNumber(krRequest.GetNamedArg(API_ARG_STACK), stackSize) &&
+              INT8_MIN <= core && INT8_MAX >= core &&
+              0 <= priority && UINT8_MAX >= priority &&
+              0 <= stackSize;
+    if (isValid) {
+        rConfig.core = (int8_t)core;
+        rConfig.priority = (uint8_t)priority;
+        rConfig.stackSize = (uint32_t)stackSize;
+    }
+
+    return isValid;
+}
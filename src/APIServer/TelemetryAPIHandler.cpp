@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * @file TelemetryAPIHandler.cpp
+ *
+ * @see TelemetryAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Telemetry settings API handler.
+ *
+ * @details Telemetry settings API handler. This file defines the Telemetry
+ * API handler used to read and store the telemetry publisher configuration.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <cstdio>               /* Standard IO */
+#include <cstdlib>              /* strtoul */
+#include <cstring>              /* String manipulation */
+#include <Logger.h>             /* Logger services */
+#include <Errors.h>             /* Errors definitions */
+#include <WebServer.h>          /* Web Server services */
+#include <JsonWriter.h>         /* JSON response writer */
+#include <APIHandler.h>         /* API Handler interface */
+#include <TelemetryPublisher.h> /* Telemetry configuration */
+
+/* Header file */
+#include <TelemetryAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the argument string for the transport. */
+#define API_ARG_MODE "mode"
+/** @brief Defines the argument string for the collector address. */
+#define API_ARG_HOST "host"
+/** @brief Defines the argument string for the collector port. */
+#define API_ARG_PORT "port"
+/** @brief Defines the argument string for the publish interval. */
+#define API_ARG_PERIOD "period_s"
+
+/** @brief Defines the size of the formatted error messages. */
+#define API_MSG_SIZE 96
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Parses an unsigned decimal parameter.
+ *
+ * @param[in] krValue The parameter value.
+ * @param[in] kMax The maximal accepted value.
+ * @param[out] rNumber The parsed number.
+ *
+ * @return true is returned when the whole value is a number up to kMax.
+ */
+static bool ParseNumber(const String&       krValue,
+                        const unsigned long kMax,
+                        unsigned long&      rNumber) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static bool ParseNumber(const String&       krValue,
+                        const unsigned long kMax,
+                        unsigned long&      rNumber) noexcept {
+    char* pEnd;
+
+    rNumber = strtoul(krValue.c_str(), &pEnd, 10);
+
+    return 0 != krValue.length() && 0 == *pEnd && kMax >= rNumber;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+TelemetryAPIHandler::~TelemetryAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Telemetry API handler.\n");
+}
+
+void TelemetryAPIHandler::Handle(JsonWriter&       rWriter,
+                                 const APIRequest& krRequest) noexcept {
+    char              pMessage[API_MSG_SIZE];
+    S_TelemetryConfig config;
+    E_Return          result;
+
+    LOG_DEBUG("Handling Telemetry API.\n");
+
+    rWriter.BeginObject();
+    if (0 == krRequest.GetArgCount()) {
+        rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+        FormatConfig(rWriter);
+    }
+    else {
+        if (4 == krRequest.GetArgCount() && ParseConfig(krRequest, config)) {
+            result = TelemetryPublisher::SetConfiguration(config);
+        }
+        else {
+            result = E_Return::ERR_TELEMETRY_INVALID_CONFIG;
+        }
+
+        /* The publisher reads its configuration at boot */
+        if (E_Return::NO_ERROR == result) {
+            rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+            rWriter.AddString(
+                "msg",
+                "Saved telemetry settings, applied at the next boot."
+            );
+            FormatConfig(rWriter);
+        }
+        else {
+            snprintf(
+                pMessage,
+                sizeof(pMessage),
+                "Error while saving the telemetry settings: error %d",
+                result
+            );
+            rWriter.AddUInt(
+                "result",
+                E_APIResult::API_RES_TELEMETRY_INVALID
+            );
+            rWriter.AddString("msg", pMessage);
+
+            LOG_ERROR("Invalid Telemetry API parameters.\n");
+        }
+    }
+    rWriter.EndObject();
+}
+
+void TelemetryAPIHandler::FormatConfig(JsonWriter& rWriter) noexcept {
+    S_TelemetryConfig config;
+
+    TelemetryPublisher::GetConfiguration(config);
+
+    rWriter.AddUInt(API_ARG_MODE, config.mode);
+    rWriter.AddString(API_ARG_HOST, config.pHost);
+    rWriter.AddUInt(API_ARG_PORT, config.port);
+    rWriter.AddUInt(API_ARG_PERIOD, config.periodS);
+}
+
+bool TelemetryAPIHandler::ParseConfig(const APIRequest&  krRequest,
+                                      S_TelemetryConfig& rConfig) noexcept {
+    String        host;
+    unsigned long mode;
+    unsigned long port;
+    unsigned long periodS;
+    bool          isValid;
+
+    memset(&rConfig, 0, sizeof(S_TelemetryConfig));
+    host = krRequest.GetNamedArg(API_ARG_HOST);
+    isValid = ParseNumber(
+                  krRequest.GetNamedArg(API_ARG_MODE),
+                  UINT8_MAX,
+                  mode
+              ) &&
+              ParseNumber(
+                  krRequest.GetNamedArg(API_ARG_PORT),
+                  UINT16_MAX,
+                  port
+              ) &&
+              ParseNumber(
+                  krRequest.GetNamedArg(API_ARG_PERIOD),
+                  UINT16_MAX,
+                  periodS
+              ) &&
+              sizeof(rConfig.pHost) > host.length();
+    if (isValid) {
+        rConfig.mode = (uint8_t)mode;
+        memcpy(rConfig.pHost, host.c_str(), host.length());
+        rConfig.port = (uint16_t)port;
+        rConfig.periodS = (uint16_t)periodS;
+    }
+
+    return isValid;
+}
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * @file TimingAPIHandler.cpp
+ *
+ * @see TimingAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Timing API handler.
+ *
+ * @details Timing API handler. This file defines the Timing API handler
+ * used to report the periodic tasks timing statistics.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <Logger.h>     /* Logger services */
+#include <Errors.h>     /* Errors definitions */
+#include <Timeout.h>    /* Timeout statistics */
+#include <WebServer.h>  /* Web Server services */
+#include <JsonWriter.h> /* JSON response writer */
+#include <APIHandler.h> /* API Handler interface */
+
+/* Header file */
+#include <TimingAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+TimingAPIHandler::~TimingAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Timing API handler.\n");
+}
+
+void TimingAPIHandler::Handle(JsonWriter&       rWriter,
+                              const APIRequest& krRequest) noexcept {
+    S_TimeoutStats stats;
+    uint32_t       i;
+
+    (void)krRequest;
+
+    LOG_DEBUG("Handling Timing API.\n");
+
+    rWriter.BeginObject();
+    rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+    rWriter.BeginArray("timeouts");
+
+    for (i = 0; TIMEOUT_STATS_MAX > i; ++i) {
+        if (Timeout::GetStats(i, &stats)) {
+            rWriter.BeginObject();
+            rWriter.AddString("name", stats.pName);
+            rWriter.AddUInt("period_us", stats.periodNs / 1000);
+            rWriter.AddUInt("samples", stats.period.count);
+            rWriter.AddUInt("overruns", stats.overruns);
+            FormatHistogram(rWriter, "period", stats.period);
+            FormatHistogram(rWriter, "jitter", stats.jitter);
+            FormatHistogram(rWriter, "execution", stats.execution);
+            rWriter.EndObject();
+        }
+    }
+
+    rWriter.EndArray();
+    rWriter.EndObject();
+}
+
+void TimingAPIHandler::FormatHistogram(JsonWriter&               rWriter,
+                                       const char*               kpKey,
+                                       const S_TimeoutHistogram& krHistogram)
+noexcept {
+    rWriter.BeginObject(kpKey);
+    rWriter.AddUInt("min_us", krHistogram.minNs / 1000);
+    rWriter.AddUInt("max_us", krHistogram.maxNs / 1000);
+    rWriter.AddUInt(
+        "p50_us",
+        Timeout::GetPercentile(krHistogram, 50) / 1000
+    );
+    rWriter.AddUInt(
+        "p99_us",
+        Timeout::GetPercentile(krHistogram, 99) / 1000
+    );
+    rWriter.EndObject();
+}
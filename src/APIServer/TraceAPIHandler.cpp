@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * @file TraceAPIHandler.cpp
+ *
+ * @see TraceAPIHandler.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Trace API handler.
+ *
+ * @details Trace API handler. This file defines the Trace API handler used
+ * to start and stop the tracing and to export the recorded events.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
+/* Included headers */
+#include <Tracer.h>          /* Events tracer */
+#include <Logger.h>          /* Logger services */
+#include <Errors.h>          /* Errors definitions */
+#include <JsonWriter.h>      /* JSON response writer */
+#include <APIHandler.h>      /* API Handler interface */
+#include <KeepAliveServer.h> /* Persistent connections server */
+
+/* Header file */
+#include <TraceAPIHandler.h>
+
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the argument string for the tracing state. */
+#define API_ARG_STATE "state"
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+TraceAPIHandler::TraceAPIHandler(void) noexcept {
+    /* Nothing to do, the export is opened by each stream */
+}
+
+TraceAPIHandler::~TraceAPIHandler(void) noexcept {
+    PANIC("Tried to destroy the Trace API handler.\n");
+}
+
+void TraceAPIHandler::Handle(JsonWriter&       rWriter,
+                             const APIRequest& krRequest) noexcept {
+    E_Return error;
+    String   arg;
+
+    LOG_DEBUG("Handling Trace API.\n");
+
+    error = E_Return::NO_ERROR;
+    arg = krRequest.GetNamedArg(API_ARG_STATE);
+    if (arg.equals("1")) {
+        error = Tracer::Start();
+    }
+    else if (arg.equals("0")) {
+        Tracer::Stop();
+    }
+    else {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+
+    rWriter.BeginObject();
+    if (E_Return::NO_ERROR == error) {
+        rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+        rWriter.AddBool("started", Tracer::IsStarted());
+    }
+    else {
+        rWriter.AddUInt("result", E_APIResult::API_RES_TRACE_INVALID);
+        if (E_Return::ERR_INVALID_PARAM == error) {
+            rWriter.AddString("msg", "Invalid tracing state.");
+        }
+        else {
+            rWriter.AddString("msg", "Failed to start the tracing.");
+        }
+
+        LOG_ERROR("Trace API failed: %d.\n", error);
+    }
+    rWriter.EndObject();
+}
+
+bool TraceAPIHandler::Stream(KeepAliveServer*  pServer,
+                             const APIRequest& krRequest) noexcept {
+    size_t size;
+    bool   isStreamed;
+    bool   isValid;
+
+    /* A call with a state argument sets the tracing state */
+    isStreamed = 0 == krRequest.GetNamedArg(API_ARG_STATE).length();
+    if (isStreamed) {
+        LOG_DEBUG("Streaming Trace API.\n");
+
+        isValid = pServer->BeginStream(200, "application/json");
+        Tracer::OpenExport(this->_export);
+        do {
+            size = Tracer::ReadExport(
+                this->_export,
+                this->_pChunk,
+                sizeof(this->_pChunk)
+            );
+            isValid = isValid &&
+                      (0 == size || pServer->SendChunk(this->_pChunk, size));
+        } while (isValid && 0 != size);
+        pServer->EndStream();
+
+        if (!isValid) {
+            LOG_ERROR("Trace stream aborted.\n");
+        }
+    }
+
+    return isStreamed;
+}
@@ -21,11 +21,17 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_API
+
 /* Included headers */
+#include <cstdio>        /* Standard IO */
 #include <string>        /* Standard string */
 #include <Logger.h>      /* Logger services */
 #include <Errors.h>      /* Errors definitions */
 #include <WebServer.h>   /* Web Server services */
+#include <JsonWriter.h>  /* JSON response writer */
+#include <CborReader.h>  /* CBOR request reader */
 #include <WiFiModule.h>  /* WiFi module configuration */
 #include <APIHandler.h>  /* API Handler interface */
 #include <SystemState.h> /* System state object */
@@ -59,6 +65,9 @@
 /** @brief Defines the argument string for the API port setting. */
 #define API_ARG_API_PORT "apip"
 
+/** @brief Defines the size of the formatted error messages. */
+#define API_MSG_SIZE 96
+
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
@@ -79,8 +88,8 @@
  * @param[out] PARAM The parameter to set with the value of the argument.
  */
 #define CHECK_BOOL_ARG(I, NAME, PARAM)                                      \
-    (pServer->argName(I).equals(NAME) && !PARAM.second) {                   \
-        currentArg = pServer->arg(I);                                       \
+    (krRequest.GetArgName(I).equals(NAME) && !PARAM.second) {               \
+        currentArg = krRequest.GetArg(I);                                   \
         if (currentArg.equals("0")) {                                       \
             PARAM.first = false;                                            \
         }                                                                   \
@@ -103,8 +112,8 @@
  * @param[out] PARAM The parameter to set with the value of the argument.
  */
 #define CHECK_STR_ARG(I, NAME, PARAM)                                       \
-    (pServer->argName(I).equals(NAME) && !PARAM.second) {                   \
-        PARAM.first = std::string(pServer->arg(I).c_str());                 \
+    (krRequest.GetArgName(I).equals(NAME) && !PARAM.second) {               \
+        PARAM.first = krRequest.GetArg(I).c_str();                          \
         ++argsSet;                                                          \
         PARAM.second = true;                                                \
     }
@@ -121,16 +130,21 @@
  * @param[out] PARAM The parameter to set with the value of the argument.
  */
 #define CHECK_UINT16_ARG(I, NAME, PARAM)                                    \
-    (pServer->argName(I).equals(NAME) && !PARAM.second) {                   \
+    (krRequest.GetArgName(I).equals(NAME) && !PARAM.second) {               \
         try {                                                               \
-            PARAM.first = (uint16_t)std::stoi(pServer->arg(I).c_str());     \
+            PARAM.first = (uint16_t)std::stoi(krRequest.GetArg(I).c_str()); \
             ++argsSet;                                                      \
             PARAM.second = true;                                            \
         }                                                                   \
         catch (std::exception& rExc) {                                      \
-            rResponse = "{\"result\": " +                                   \
-                std::to_string(E_APIResult::API_RES_WIFI_SET_UNKNOWN) +     \
-                ", \"msg\": \"Invalid parameter " NAME " value.\"}";        \
+            rWriter.BeginObject();                                          \
+            rWriter.AddUInt(                                                \
+                "result",                                                   \
+                E_APIResult::API_RES_WIFI_SET_UNKNOWN                       \
+            );                                                              \
+            rWriter.AddString("msg", "Invalid parameter " NAME " value.");  \
+            rWriter.EndObject();                                            \
+            hasError = true;                                                \
             break;                                                          \
         }                                                                   \
     }
@@ -150,7 +164,38 @@
 /* None */
 
 /************************** Static global variables ***************************/
-/* None */
+/**
+ * @brief The WiFi settings JSON schema. Values are sent as JSON strings, as
+ * the settings API always did, CBOR keeps the native types. The schema also
+ * decodes the CBOR settings updates.
+ */
+static const S_JsonField skWiFiConfigSchema[] = {
+    JSON_FIELD(S_WiFiConfig, isAP, API_ARG_AP_MODE, JSON_FIELD_BOOL, true),
+    JSON_FIELD(S_WiFiConfig, ssid, API_ARG_SSID, JSON_FIELD_STRING, true),
+    JSON_FIELD(
+        S_WiFiConfig, password, API_ARG_PASSWORD, JSON_FIELD_STRING, true
+    ),
+    JSON_FIELD(S_WiFiConfig, isStatic, API_ARG_STATIC, JSON_FIELD_BOOL, true),
+    JSON_FIELD(S_WiFiConfig, ip, API_ARG_IP, JSON_FIELD_STRING, true),
+    JSON_FIELD(S_WiFiConfig, gateway, API_ARG_GATEWY, JSON_FIELD_STRING, true),
+    JSON_FIELD(S_WiFiConfig, subnet, API_ARG_SUBNET, JSON_FIELD_STRING, true),
+    JSON_FIELD(
+        S_WiFiConfig, primaryDNS, API_ARG_PRIMARY_DNS, JSON_FIELD_STRING, true
+    ),
+    JSON_FIELD(
+        S_WiFiConfig,
+        secondaryDNS,
+        API_ARG_SECONDARY_DNS,
+        JSON_FIELD_STRING,
+        true
+    ),
+    JSON_FIELD(
+        S_WiFiConfig, webPort, API_ARG_WEB_PORT, JSON_FIELD_UINT16, true
+    ),
+    JSON_FIELD(
+        S_WiFiConfig, apiPort, API_ARG_API_PORT, JSON_FIELD_UINT16, true
+    )
+};
 
 /*******************************************************************************
  * FUNCTIONS
@@ -164,32 +209,41 @@ WiFiSettingAPIHandler::~WiFiSettingAPIHandler(void) noexcept {
     PANIC("Tried to destroy the WiFi settings API handler.\n");
 }
 
-void WiFiSettingAPIHandler::Handle(std::string& rResponse, WebServer* pServer)
-noexcept {
-    uint32_t args;
+void WiFiSettingAPIHandler::Handle(JsonWriter&       rWriter,
+                                   const APIRequest& krRequest) noexcept {
+    const uint8_t* pkBody;
+    size_t         bodySize;
+    uint32_t       args;
 
     LOG_DEBUG("Handling WiFi setting API.\n");
 
     /* Check the number of arguments */
-    args = pServer->args();
+    args = krRequest.GetArgCount();
 
+    /* A CBOR body always holds a settings update */
+    if (krRequest.GetBody(pkBody, bodySize)) {
+        SetWiFiSettings(pkBody, bodySize, rWriter);
+    }
     /* Check if the user just wants to get the current settings */
-    if (1 == args && pServer->arg("mode").equals("getsettings")) {
-        GetWiFiSettings(rResponse);
+    else if (1 == args &&
+             krRequest.GetNamedArg("mode").equals("getsettings")) {
+        GetWiFiSettings(rWriter);
     }
-    else if (12 == args && pServer->arg("mode").equals("setsettings")) {
-        SetWiFiSettings(pServer, rResponse);
+    else if (12 == args &&
+             krRequest.GetNamedArg("mode").equals("setsettings")) {
+        SetWiFiSettings(krRequest, rWriter);
     }
     else {
-        rResponse = "{\"result\": " +
-            std::to_string(E_APIResult::API_RES_WIFI_SET_UNKNOWN) +
-            ", \"msg\": \"Unknown parameters.\"}";
+        rWriter.BeginObject();
+        rWriter.AddUInt("result", E_APIResult::API_RES_WIFI_SET_UNKNOWN);
+        rWriter.AddString("msg", "Unknown parameters.");
+        rWriter.EndObject();
 
         LOG_ERROR("Invalid WiFi setting API parameters. Count: %d\n", args);
     }
 }
 
-void WiFiSettingAPIHandler::GetWiFiSettings(std::string& rResponse)
+void WiFiSettingAPIHandler::GetWiFiSettings(JsonWriter& rWriter)
 const noexcept {
     WiFiModule*  pWiFiModule;
     S_WiFiConfig config;
@@ -199,46 +253,31 @@ const noexcept {
     pWiFiModule = SystemState::GetInstance()->GetWiFiModule();
     pWiFiModule->GetConfiguration(&config);
 
-    rResponse = "{\"result\": ";
-    rResponse += std::to_string(E_APIResult::API_RES_NO_ERROR) + ", ";
-    rResponse += "\"" API_ARG_AP_MODE "\": \"" + std::to_string(config.isAP) +
-        "\", ";
-    rResponse += "\"" API_ARG_SSID "\": \"" + std::string(config.ssid) + "\", ";
-    rResponse += "\"" API_ARG_PASSWORD "\": \"" + std::string(config.password) +
-        "\", ";
-    rResponse += "\"" API_ARG_STATIC "\": \"" + std::to_string(config.isStatic)+
-        "\", ";
-    rResponse += "\"" API_ARG_IP "\": \"" + std::string(config.ip) + "\", ";
-    rResponse += "\"" API_ARG_GATEWY "\": \"" + std::string(config.gateway) +
-        "\", ";
-    rResponse += "\"" API_ARG_SUBNET "\": \"" + std::string(config.subnet) +
-        "\", ";
-    rResponse += "\"" API_ARG_PRIMARY_DNS "\": \"" +
-        std::string(config.primaryDNS) + "\", ";
-    rResponse += "\"" API_ARG_SECONDARY_DNS "\": \"" +
-        std::string(config.secondaryDNS) + "\", ";
-    rResponse += "\"" API_ARG_WEB_PORT "\": \"" +
-        std::to_string(config.webPort) + "\", ";
-    rResponse += "\"" API_ARG_API_PORT "\": \"" +
-        std::to_string(config.apiPort) + "\"} ";
-
+    rWriter.BeginObject();
+    rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+    rWriter.AddFields(
+        &config,
+        skWiFiConfigSchema,
+        sizeof(skWiFiConfigSchema) / sizeof(skWiFiConfigSchema[0])
+    );
+    rWriter.EndObject();
 }
 
-void WiFiSettingAPIHandler::SetWiFiSettings(WebServer* pServer,
-                                            std::string& rResponse) const
+void WiFiSettingAPIHandler::SetWiFiSettings(const APIRequest& krRequest,
+                                            JsonWriter&       rWriter) const
 noexcept {
     uint32_t            args;
     uint32_t            i;
     uint32_t            argsSet;
     S_WiFiConfigRequest config;
-    E_Return            result;
-    WiFiModule*         pWiFiModule;
     String              currentArg;
+    char                pMessage[API_MSG_SIZE];
+    bool                hasError;
 
     LOG_DEBUG("Handling WiFi settings Set API.\n");
 
     /* Check the number of arguments and their value */
-    rResponse.clear();
+    hasError = false;
     config.isAP.second = false;
     config.isStatic.second = false;
     config.ssid.second = false;
@@ -251,7 +290,7 @@ noexcept {
     config.webPort.second = false;
     config.apiPort.second = false;
     argsSet = 0;
-    args = pServer->args();
+    args = krRequest.GetArgCount();
     for (i = 0; i < args; ++i) {
         if CHECK_BOOL_ARG(i, API_ARG_AP_MODE, config.isAP)
         else if CHECK_BOOL_ARG(i, API_ARG_STATIC, config.isStatic)
@@ -264,16 +303,22 @@ noexcept {
         else if CHECK_STR_ARG(i, API_ARG_SECONDARY_DNS, config.secondaryDNS)
         else if CHECK_UINT16_ARG(i, API_ARG_WEB_PORT, config.webPort)
         else if CHECK_UINT16_ARG(i, API_ARG_API_PORT, config.apiPort)
-        else if (!pServer->argName(i).equals("mode")) {
-            rResponse = "{\"result\": " +
-                std::to_string(E_APIResult::API_RES_WIFI_SET_UNKNOWN) +
-                ", \"msg\": \"Unknown parameters or duplicate parameter " +
-                pServer->argName(i).c_str() +
-                ".\"}";
+        else if (!krRequest.GetArgName(i).equals("mode")) {
+            snprintf(
+                pMessage,
+                sizeof(pMessage),
+                "Unknown parameters or duplicate parameter %s.",
+                krRequest.GetArgName(i).c_str()
+            );
+            rWriter.BeginObject();
+            rWriter.AddUInt("result", E_APIResult::API_RES_WIFI_SET_UNKNOWN);
+            rWriter.AddString("msg", pMessage);
+            rWriter.EndObject();
+            hasError = true;
 
             LOG_ERROR(
                 "WiFi Setttings Set API invalid parameter: %s.\n",
-                pServer->argName(i).c_str()
+                krRequest.GetArgName(i).c_str()
             );
 
             break;
@@ -285,33 +330,103 @@ noexcept {
 
     if (11 == argsSet) {
         /* Everything went fine, continue */
-        pWiFiModule = SystemState::GetInstance()->GetWiFiModule();
-        result = pWiFiModule->SetConfiguration(config);
-        if (E_Return::NO_ERROR == result) {
-            rResponse = "{\"result\": " +
-                std::to_string(E_APIResult::API_RES_NO_ERROR) +
-                ", \"msg\": \"Saved WiFi settings.\"}";
-
-            LOG_DEBUG("WiFi Setting API Set success.\n");
-        }
-        else {
-            rResponse = "{\"result\": " +
-                std::to_string(E_APIResult::API_RES_WIFI_SET_ACTION_ERR) +
-                ", \"msg\": \"Error while saving the WiFi settings: error " +
-                std::to_string(result) + "\"}";
+        ApplyWiFiSettings(config, rWriter);
+    }
+    else if (!hasError) {
+        snprintf(
+            pMessage,
+            sizeof(pMessage),
+            "Invalid parameters, expected 11, parsed %lu.",
+            (unsigned long)argsSet
+        );
+        rWriter.BeginObject();
+        rWriter.AddUInt("result", E_APIResult::API_RES_WIFI_SET_UNKNOWN);
+        rWriter.AddString("msg", pMessage);
+        rWriter.EndObject();
+
+        LOG_ERROR(
+            "WiFi Setting API Set error. Expected 11 arguments, parser %d.",
+            argsSet
+        );
+    }
+}
 
-            LOG_ERROR("WiFi Setting API Set error. Error %d.\n", result);
-        }
+void WiFiSettingAPIHandler::SetWiFiSettings(const uint8_t* kpBody,
+                                            const size_t   kSize,
+                                            JsonWriter&    rWriter) const
+noexcept {
+    S_WiFiConfig        values;
+    S_WiFiConfigRequest config;
+    CborReader          reader(kpBody, kSize);
+    uint32_t            found;
+    size_t              count;
+
+    LOG_DEBUG("Handling WiFi settings CBOR Set API.\n");
+
+    /* The values are decoded in place, all the settings are required */
+    count = sizeof(skWiFiConfigSchema) / sizeof(skWiFiConfigSchema[0]);
+    if (reader.ReadFields(&values, skWiFiConfigSchema, count, found) &&
+        (1UL << count) - 1 == found) {
+        config.isAP = std::make_pair(values.isAP, true);
+        config.isStatic = std::make_pair(values.isStatic, true);
+        config.ssid = std::make_pair(APIString(values.ssid), true);
+        config.password = std::make_pair(APIString(values.password), true);
+        config.ip = std::make_pair(APIString(values.ip), true);
+        config.gateway = std::make_pair(APIString(values.gateway), true);
+        config.subnet = std::make_pair(APIString(values.subnet), true);
+        config.primaryDNS = std::make_pair(
+            APIString(values.primaryDNS),
+            true
+        );
+        config.secondaryDNS = std::make_pair(
+            APIString(values.secondaryDNS),
+            true
+        );
+        config.webPort = std::make_pair(values.webPort, true);
+        config.apiPort = std::make_pair(values.apiPort, true);
+
+        ApplyWiFiSettings(config, rWriter);
     }
-    else if (0 == rResponse.size()) {
-        rResponse = "{\"result\": " +
-            std::to_string(E_APIResult::API_RES_WIFI_SET_UNKNOWN) +
-            ", \"msg\": \"Invalid parameters, expected 11, parsed " +
-            std::to_string(argsSet) + ".\"}";
+    else {
+        rWriter.BeginObject();
+        rWriter.AddUInt("result", E_APIResult::API_RES_WIFI_SET_UNKNOWN);
+        rWriter.AddString("msg", "Invalid or incomplete CBOR settings.");
+        rWriter.EndObject();
 
-            LOG_ERROR(
-                "WiFi Setting API Set error. Expected 11 arguments, parser %d.",
-                argsSet
-            );
+        LOG_ERROR("WiFi Setting API invalid CBOR settings.\n");
+    }
+}
+
+void WiFiSettingAPIHandler::ApplyWiFiSettings(
+    const S_WiFiConfigRequest& krConfig,
+    JsonWriter&                rWriter) const noexcept {
+    E_Return    result;
+    WiFiModule* pWiFiModule;
+    char        pMessage[API_MSG_SIZE];
+
+    pWiFiModule = SystemState::GetInstance()->GetWiFiModule();
+    result = pWiFiModule->SetConfiguration(krConfig);
+    rWriter.BeginObject();
+    if (E_Return::NO_ERROR == result) {
+        rWriter.AddUInt("result", E_APIResult::API_RES_NO_ERROR);
+        rWriter.AddString("msg", "Saved WiFi settings.");
+
+        LOG_DEBUG("WiFi Setting API Set success.\n");
     }
-}
\ No newline at end of file
+    else {
+        snprintf(
+            pMessage,
+            sizeof(pMessage),
+            "Error while saving the WiFi settings: error %d",
+            result
+        );
+        rWriter.AddUInt(
+            "result",
+            E_APIResult::API_RES_WIFI_SET_ACTION_ERR
+        );
+        rWriter.AddString("msg", pMessage);
+
+        LOG_ERROR("WiFi Setting API Set error. Error %d.\n", result);
+    }
+    rWriter.EndObject();
+}
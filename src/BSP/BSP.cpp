@@ -21,13 +21,18 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
 /* Included headers */
 #include <SPI.h>           /* SPI bus */
 #include <string>          /* Standard string */
 #include <cstdint>         /* Standard int types */
 #include <Logger.h>        /* Logger services */
 #include <Arduino.h>       /* Arduino library */
+#include <esp_timer.h>     /* High resolution timer */
 #include <HealthMonitor.h> /* HM Services*/
+#include <BootRecord.h>    /* Boot mode and reset record */
 
 /* Header file */
 #include <BSP.h>
@@ -70,6 +75,12 @@ std::string HWManager::_SMACADDR;
 SPIClass HWManager::_SSPIBUS(HSPI);
 /** @brief See BSP.h */
 bool HWManager::_SSPIINIT = false;
+/** @brief See BSP.h */
+uint32_t HWManager::_SCPUFREQMHZ = 0;
+/** @brief See BSP.h */
+S_TimeSnapshot HWManager::_STIMESNAPSHOTS[portNUM_PROCESSORS];
+/** @brief See BSP.h */
+std::atomic<uint64_t> HWManager::_SBUSYWAITNS(0);
 
 /** @brief Decimal to Hexadecimal convertion table */
 static const char spkHexTable[16] = {
@@ -136,25 +147,91 @@ uint64_t HWManager::GetTime(void) noexcept {
     return (uint64_t)esp_timer_get_time() * 1000ULL;
 }
 
-void HWManager::DelayExecNs(const uint64_t kDelayNs) noexcept {
-    uint64_t passiveTime;
-    uint64_t startTime;
-    uint64_t delaysUs;
+uint64_t HWManager::GetTickTime(void) noexcept {
+    S_TimeSnapshot* pSnapshot;
+    TickType_t      tick;
+    uint64_t        time;
+    uint32_t        sequence;
+    bool            isCached;
+
+    pSnapshot = &_STIMESNAPSHOTS[xPortGetCoreID()];
+    tick = xTaskGetTickCount();
+
+    /* The snapshot is valid if the sequence did not move while read */
+    sequence = pSnapshot->sequence.load();
+    isCached = false;
+    if (0 == (sequence & 1) && tick == pSnapshot->tick) {
+        time = pSnapshot->time;
+        isCached = sequence == pSnapshot->sequence.load();
+    }
 
-    startTime = (uint64_t)esp_timer_get_time();
+    if (!isCached) {
+        time = GetTime();
+
+        /* Only one writer, a preempted update is left to the next call */
+        if (0 == (sequence & 1) &&
+            pSnapshot->sequence.compare_exchange_strong(
+                sequence,
+                sequence + 1
+            )) {
+            pSnapshot->tick = tick;
+            pSnapshot->time = time;
+            pSnapshot->sequence.store(sequence + 2);
+        }
+    }
 
-    delaysUs = kDelayNs / 1000ULL;
+    return time;
+}
 
-    /* Calculate how much we can spend in passive wait */
-    passiveTime = (delaysUs / 1000ULL) / portTICK_PERIOD_MS;
+uint32_t HWManager::GetCycleCount(void) noexcept {
+    return ESP.getCycleCount();
+}
 
-    /* Check if we can use a precise wait */
-    if (0 != passiveTime) {
-        vTaskDelay(passiveTime);
+uint64_t HWManager::CyclesToNs(const uint32_t kCycles) noexcept {
+    if (0 == _SCPUFREQMHZ) {
+        _SCPUFREQMHZ = ESP.getCpuFreqMHz();
+    }
+
+    return (uint64_t)kCycles * 1000ULL / _SCPUFREQMHZ;
+}
+
+void HWManager::DelayExecNs(const uint64_t kDelayNs) noexcept {
+    uint64_t   spinStart;
+    uint64_t   endTime;
+    uint64_t   currentTime;
+    TickType_t ticks;
+
+    endTime = (uint64_t)esp_timer_get_time() + kDelayNs / 1000ULL;
+
+    /*
+     * A delay of N ticks lasts between N - 1 and N ticks, the whole ticks
+     * left are slept until less than a tick remains.
+     */
+    if (taskSCHEDULER_RUNNING == xTaskGetSchedulerState() &&
+        pdFALSE == xPortInIsrContext()) {
+        currentTime = (uint64_t)esp_timer_get_time();
+        ticks = (endTime > currentTime) ?
+                (TickType_t)((endTime - currentTime) / HW_TICK_US) :
+                0;
+        while (0 != ticks) {
+            vTaskDelay(ticks);
+            currentTime = (uint64_t)esp_timer_get_time();
+            ticks = (endTime > currentTime) ?
+                    (TickType_t)((endTime - currentTime) / HW_TICK_US) :
+                    0;
+        }
     }
 
     /* Spend the rest for active time */
-    while ((uint64_t)esp_timer_get_time() < startTime + delaysUs) {}
+    spinStart = (uint64_t)esp_timer_get_time();
+    while ((uint64_t)esp_timer_get_time() < endTime) {}
+    if (endTime > spinStart) {
+        _SBUSYWAITNS.fetch_add((endTime - spinStart) * 1000ULL);
+    }
+}
+
+uint64_t HWManager::GetBusyWaitTime(void) noexcept {
+    return _SBUSYWAITNS.load();
 }
 
 SPIClass* HWManager::GetSPIBus(void) noexcept {
@@ -183,15 +260,15 @@ void HWManager::Reboot(const bool kSetMaintenance) noexcept {
     LOG_FLUSH();
     DelayExecNs(500000000);
 
-    /* Restart */
-    if (!kSetMaintenance) {
-        ESP.restart();
-        while (true) {
-            LOG_ERROR("Failed to restart.\n");
-        }
+    /* The maintenance mode is recorded, the restart stays a clean one */
+    if (kSetMaintenance) {
+        (void)BootRecord::SetMode(E_Mode::MODE_MAINTENANCE);
     }
-    else {
-        /* For maintenance reboot, trigger error */
-        *((uint32_t*)0) = 5;
+    BootRecord::SetResetCause(E_ResetCause::RESET_CAUSE_REQUEST, "Reboot");
+
+    /* Restart */
+    ESP.restart();
+    while (true) {
+        LOG_ERROR("Failed to restart.\n");
     }
 }
\ No newline at end of file
@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * @file BootRecord.cpp
+ *
+ * @see BootRecord.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Boot mode and reset record.
+ *
+ * @details Boot mode and reset record. The execution mode and the cause of the
+ * last reset are kept in the RTC memory, which survives the software and
+ * watchdog resets. The mode is also stored in the NVS for the power cycles.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
+/* Included headers */
+#include <cstddef>        /* offsetof */
+#include <cstdint>        /* Standard integer definitions */
+#include <cstring>        /* String manipulation */
+#include <HAL.h>          /* Hardware abstraction layer */
+#include <Errors.h>       /* Errors definitions */
+#include <Logger.h>       /* Logger services */
+#include <Arduino.h>      /* Arduino Framework */
+#include <nvs.h>          /* Non volatile storage */
+#include <esp_system.h>   /* Reset reasons */
+
+/* Header file */
+#include <BootRecord.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the RTC record validity marker. */
+#define BOOT_RECORD_MAGIC 0x42545243
+
+/** @brief Defines the NVS namespace of the record. */
+#define BOOT_RECORD_NVS_NAMESPACE "rthrws_boot"
+/** @brief Defines the NVS key of the execution mode. */
+#define BOOT_RECORD_NVS_MODE "mode"
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Boot record, kept in RTC memory across resets. */
+typedef struct {
+    /** @brief The validity marker. */
+    uint32_t magic;
+    /** @brief The execution mode of the next boots. */
+    uint32_t mode;
+    /** @brief The cause of the coming reset. */
+    uint32_t cause;
+    /** @brief The number of boots since the record was lost. */
+    uint32_t bootCount;
+    /** @brief The context of the coming reset, null terminated. */
+    char pContext[BOOT_RECORD_CONTEXT_SIZE];
+    /** @brief The CRC32 of the previous fields. */
+    uint32_t checksum;
+} S_BootRecord;
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Computes the checksum of the RTC record.
+ *
+ * @return The CRC32 of the record fields is returned.
+ */
+static uint32_t GetRecordChecksum(void) noexcept;
+
+/**
+ * @brief Updates the checksum of the RTC record.
+ */
+static void SealRecord(void) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/**
+ * @brief The boot record. The RTC memory is not initialized on reset, the
+ * content is validated by its marker and checksum.
+ */
+static RTC_NOINIT_ATTR S_BootRecord sRecord;
+
+/** @brief The reset causes names, by cause. */
+static const char* spkCauseNames[] = {
+    "none",
+    "request",
+    "critical"
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static uint32_t GetRecordChecksum(void) noexcept {
+    return HAL::Crc32(
+        0,
+        (const uint8_t*)&sRecord,
+        offsetof(S_BootRecord, checksum)
+    );
+}
+
+static void SealRecord(void) noexcept {
+    sRecord.checksum = GetRecordChecksum();
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+S_ResetInfo BootRecord::_SLASTRESET;
+
+void BootRecord::Load(void) noexcept {
+    BootRecord::_SLASTRESET.hwReason = (uint32_t)esp_reset_reason();
+    BootRecord::_SLASTRESET.isRtcValid =
+        BOOT_RECORD_MAGIC == sRecord.magic &&
+        GetRecordChecksum() == sRecord.checksum &&
+        E_Mode::MODE_FAULTED >= sRecord.mode &&
+        E_ResetCause::RESET_CAUSE_CRITICAL >= sRecord.cause;
+
+    if (!BootRecord::_SLASTRESET.isRtcValid) {
+        /* Power cycle, the RTC memory content is random, no cause */
+        memset(&sRecord, 0, sizeof(S_BootRecord));
+        sRecord.magic = BOOT_RECORD_MAGIC;
+        sRecord.mode = E_Mode::MODE_MAINTENANCE;
+        LoadNvs();
+    }
+
+    BootRecord::_SLASTRESET.cause = (E_ResetCause)sRecord.cause;
+    BootRecord::_SLASTRESET.bootCount = ++sRecord.bootCount;
+    sRecord.pContext[BOOT_RECORD_CONTEXT_SIZE - 1] = 0;
+    memcpy(
+        BootRecord::_SLASTRESET.pContext,
+        sRecord.pContext,
+        BOOT_RECORD_CONTEXT_SIZE
+    );
+
+    /* An unrecorded reset of this boot reads as none */
+    sRecord.cause = E_ResetCause::RESET_CAUSE_NONE;
+    sRecord.pContext[0] = 0;
+    SealRecord();
+
+    LOG_INFO(
+        "Last reset: %s (%u), boot %u: %s\n",
+        GetCauseName(BootRecord::_SLASTRESET.cause),
+        BootRecord::_SLASTRESET.hwReason,
+        BootRecord::_SLASTRESET.bootCount,
+        BootRecord::_SLASTRESET.pContext
+    );
+}
+
+E_Mode BootRecord::GetMode(void) noexcept {
+    return (E_Mode)sRecord.mode;
+}
+
+E_Return BootRecord::SetMode(const E_Mode kMode) noexcept {
+    sRecord.mode = kMode;
+    SealRecord();
+
+    return StoreNvs();
+}
+
+void BootRecord::SetResetCause(const E_ResetCause kCause,
+                               const char*        kpContext) noexcept {
+    if (kCause > sRecord.cause) {
+        sRecord.cause = kCause;
+        strncpy(sRecord.pContext, kpContext, BOOT_RECORD_CONTEXT_SIZE - 1);
+        sRecord.pContext[BOOT_RECORD_CONTEXT_SIZE - 1] = 0;
+        SealRecord();
+    }
+}
+
+void BootRecord::GetLastReset(S_ResetInfo& rInfo) noexcept {
+    rInfo = BootRecord::_SLASTRESET;
+}
+
+const char* BootRecord::GetCauseName(const E_ResetCause kCause) noexcept {
+    const char* pkName;
+
+    if (E_ResetCause::RESET_CAUSE_CRITICAL >= kCause) {
+        pkName = spkCauseNames[kCause];
+    }
+    else {
+        pkName = "unknown";
+    }
+
+    return pkName;
+}
+
+void BootRecord::LoadNvs(void) noexcept {
+    nvs_handle_t handle;
+    uint8_t      value;
+
+    if (ESP_OK == nvs_open(BOOT_RECORD_NVS_NAMESPACE, NVS_READONLY, &handle)) {
+        if (ESP_OK == nvs_get_u8(handle, BOOT_RECORD_NVS_MODE, &value) &&
+            E_Mode::MODE_FAULTED >= value) {
+            sRecord.mode = value;
+        }
+        nvs_close(handle);
+    }
+    else {
+        LOG_INFO("No boot mode in the NVS.\n");
+    }
+}
+
+E_Return BootRecord::StoreNvs(void) noexcept {
+    nvs_handle_t handle;
+    esp_err_t    error;
+
+    error = nvs_open(BOOT_RECORD_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ESP_OK == error) {
+        error = nvs_set_u8(handle, BOOT_RECORD_NVS_MODE, (uint8_t)sRecord.mode);
+        if (ESP_OK == error) {
+            error = nvs_commit(handle);
+        }
+        nvs_close(handle);
+    }
+
+    if (ESP_OK != error) {
+        LOG_ERROR("Failed to store the boot mode in the NVS: %d.\n", error);
+    }
+
+    return (ESP_OK == error) ? E_Return::NO_ERROR :
+                               E_Return::ERR_MODE_FILE_WRITE;
+}
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * @file BootTrace.cpp
+ *
+ * @see BootTrace.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Boot phases timing trace.
+ *
+ * @details Boot phases timing trace. The time at which each boot phase
+ * completed is recorded in a fixed table, kept for the whole execution.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>   /* Standard integer definitions */
+#include <atomic>    /* Atomic timestamps */
+#include <Arduino.h> /* esp_timer services */
+
+/* Header file */
+#include <BootTrace.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The boot phases names, by phase. */
+static const char* spkPhaseNames[E_BootPhase::BOOT_PHASE_COUNT] = {
+    "setup",
+    "storage",
+    "mode",
+    "health_monitor",
+    "settings",
+    "io",
+    "wifi",
+    "servers",
+    "ready"
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+std::atomic<uint32_t> BootTrace::_SPTIMES[E_BootPhase::BOOT_PHASE_COUNT];
+
+void BootTrace::Mark(const E_BootPhase kPhase) noexcept {
+    uint32_t notReached;
+    uint32_t time;
+
+    if (E_BootPhase::BOOT_PHASE_COUNT > kPhase) {
+        /* The time is never 0 once the application started */
+        time = (uint32_t)esp_timer_get_time();
+        if (0 == time) {
+            time = 1;
+        }
+        notReached = 0;
+        BootTrace::_SPTIMES[kPhase].compare_exchange_strong(notReached, time);
+    }
+}
+
+uint32_t BootTrace::GetTime(const E_BootPhase kPhase) noexcept {
+    uint32_t time;
+
+    time = 0;
+    if (E_BootPhase::BOOT_PHASE_COUNT > kPhase) {
+        time = BootTrace::_SPTIMES[kPhase].load(std::memory_order_relaxed);
+    }
+
+    return time;
+}
+
+const char* BootTrace::GetName(const E_BootPhase kPhase) noexcept {
+    const char* pkName;
+
+    pkName = "unknown";
+    if (E_BootPhase::BOOT_PHASE_COUNT > kPhase) {
+        pkName = spkPhaseNames[kPhase];
+    }
+
+    return pkName;
+}
@@ -21,6 +21,9 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
 /* Included headers */
 #include <BSP.h>         /* Hardware services*/
 #include <Logger.h>      /* Firmware logger */
@@ -28,6 +31,8 @@
 #include <Storage.h>     /* Storage manager */
 #include <ModeManager.h> /* Mode manager */
 #include <SystemState.h> /* System state services */
+#include <BootTrace.h>   /* Boot phases trace */
+#include <MemoryPool.h>  /* Subsystem memory pools */
 
 /* Header file */
 #include <Entry.h>
@@ -76,17 +81,29 @@ void setup(void) {
     SystemState* pSystemState;
     Storage*     pStorage;
 
+    BootTrace::Mark(E_BootPhase::BOOT_PHASE_SETUP);
+
+    /* Carve the subsystems pools before any subsystem allocates */
+    MemoryPool::Init();
+
     /* Create the system state */
     pSystemState = SystemState::GetInstance();
     if (nullptr == pSystemState) {
         PANIC("Failed to initialize system state manager.\n");
     }
 
+    /* Create the mode manager, the mode does not depend on the SD card */
+    spModeManager = new ModeManager();
+    if (nullptr == spModeManager) {
+        PANIC("Failed to initialize mode manager.\n");
+    }
+
     /* Create the storage manager */
     pStorage = new Storage();
     if (nullptr == pStorage) {
         PANIC("Failed to initialize system storage manager.\n");
     }
+    BootTrace::Mark(E_BootPhase::BOOT_PHASE_STORAGE);
 
     /* Welcome output*/
     LOG_INFO("RTHR Weather Station Booting...\n");
@@ -95,12 +112,6 @@ void setup(void) {
     LOG_INFO("| " VERSION " |\n");
     LOG_INFO("#==============================#\n");
 
-    /* Create the mode manager */
-    spModeManager = new ModeManager();
-    if (nullptr == spModeManager) {
-        PANIC("Failed to initialize mode manager.\n");
-    }
-
     /* Start the firmware */
     spModeManager->StartFirmware();
 }
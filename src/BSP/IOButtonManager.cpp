@@ -20,11 +20,19 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
+/* Included headers */
 #include <BSP.h>           /* BSP definitions */
 #include <cstdint>         /* Generic Types */
+#include <algorithm>       /* std::min */
 #include <Logger.h>        /* Logger services */
 #include <Errors.h>        /* Errors definitions */
 #include <Arduino.h>       /* Arduino framework */
+#include <EventBus.h>      /* Subsystems events */
+#include <esp_timer.h>     /* One-shot keep timers */
 #include <SystemState.h>   /* System state services */
 #include <unordered_map>   /* Unordered maps */
 /* Header File */
@@ -34,7 +42,7 @@
  * CONSTANTS
  ******************************************************************************/
 
-/** @brief Time in microseconds after which we consider a button keeped. */
+/** @brief Time in nanoseconds after which we consider a button keeped. */
 #define BTN_KEEP_WAIT_TIME 1000000
 
 /** @brief Defines the lock timeout in nanoseconds. */
@@ -86,7 +94,9 @@
  ******************************************************************************/
 
 IOButtonManager::IOButtonManager(void) noexcept {
-    uint8_t  i;
+    esp_timer_create_args_t timerArgs;
+    esp_err_t               error;
+    uint8_t                 i;
 
     /* Init pins and handlers */
     memset(
@@ -110,12 +120,44 @@ IOButtonManager::IOButtonManager(void) noexcept {
     this->_pBtnPinsMux[E_ButtonID::BUTTON_RESET] =
         E_GPIOPull::GPIO_BTN_RESET_MUX;
 
-    /* Setup pinmux */
+    /* Create the events queue before enabling the interrupts */
+    this->_notifyTask = nullptr;
+    this->_events = xQueueCreate(BTN_EVENT_QUEUE_SIZE, sizeof(S_ButtonEvent));
+    if (nullptr == this->_events) {
+        PANIC("Failed to create the IO Button Manager events queue.\n");
+    }
+
+    /* Setup pinmux, keep timers and edge interrupts */
+    memset(&timerArgs, 0, sizeof(timerArgs));
+    timerArgs.callback = IOButtonManager::KeepTimerHandler;
+    timerArgs.dispatch_method = ESP_TIMER_TASK;
+    timerArgs.name = "BTN_KEEP";
     for (i = 0; E_ButtonID::BUTTON_MAX_ID > i; ++i) {
         pinMode(this->_pBtnPins[i], this->_pBtnPinsMux[i]);
+
+        this->_pIrqContexts[i].pManager = this;
+        this->_pIrqContexts[i].btnId = (E_ButtonID)i;
+        this->_pFirstEdge[i] = 0;
+        this->_pLastEdge[i] = 0;
+        this->_pIsBouncing[i] = false;
+
+        timerArgs.arg = &this->_pIrqContexts[i];
+        error = esp_timer_create(&timerArgs, &this->_pKeepTimers[i]);
+        if (ESP_OK != error) {
+            PANIC("Failed to create the button keep timer. Error %d\n", error);
+        }
+
+        attachInterruptArg(
+            this->_pBtnPins[i],
+            IOButtonManager::IrqHandler,
+            &this->_pIrqContexts[i],
+            CHANGE
+        );
     }
 
     /* Init actions */
+    memset(this->_pSubscriptions, 0, sizeof(this->_pSubscriptions));
+    memset(this->_pEdgeMasks, 0, sizeof(this->_pEdgeMasks));
     _lastActionId = 0;
     this->_lock = xSemaphoreCreateMutex();
     if (nullptr == this->_lock) {
@@ -132,44 +174,122 @@ IOButtonManager::~IOButtonManager(void) noexcept {
     PANIC("Tried to destroy the IO Button Manager.\n");
 }
 
-void IOButtonManager::Update(void) noexcept {
-    uint8_t  i;
-    uint8_t  btnState;
-    uint64_t currTime;
+uint64_t IOButtonManager::Update(const uint64_t kTime) noexcept {
+    S_ButtonEvent event;
+    uint64_t      nextNs;
 
     std::unordered_map<uint32_t, IOButtonManagerAction*>::const_iterator it;
 
-    /* Check all pins */
-    for (i = 0; E_ButtonID::BUTTON_MAX_ID > i; ++i) {
-        btnState = digitalRead(this->_pBtnPins[i]);
+    /* Apply all the pending events, then the settled levels */
+    while (pdPASS == xQueueReceive(this->_events, &event, 0)) {
+        ProcessEvent(event);
+    }
+    nextNs = std::min(Settle(kTime), CheckTimers(kTime));
 
-        /* Manage pinmux */
-        if (INPUT_PULLUP == this->_pBtnPinsMux[i]) {
-            btnState = !btnState;
-        }
+    /* Execute actions */
+    for (it = this->_actions.begin(); this->_actions.end() != it; ++it) {
+        /* Execute */
+        it->second->Execute(this->_pBtnLastPress, this->_pBtnStates);
+    }
+
+    return nextNs;
+}
+
+void IOButtonManager::SetNotifyTask(const TaskHandle_t kTask) noexcept {
+    this->_notifyTask = kTask;
+}
+
+E_Return IOButtonManager::Subscribe(const E_ButtonID       kBtnId,
+                                    const uint32_t         kEdgeMask,
+                                    IOButtonManagerAction* pAction,
+                                    uint32_t&              rSubId) noexcept {
+    E_Return error;
+    uint32_t i;
 
-        if (0 != btnState) {
-            currTime = HWManager::GetTime();
-            /* If this is the first time the button is pressed */
-            if (E_ButtonState::BTN_STATE_UP == this->_pBtnStates[i]) {
-                this->_pBtnStates[i]    = E_ButtonState::BTN_STATE_DOWN;
-                this->_pBtnLastPress[i] = currTime;
+    LOG_DEBUG("Subscribing IO Button Manager action.\n");
+
+    if (E_ButtonID::BUTTON_MAX_ID <= kBtnId ||
+        0 == kEdgeMask ||
+        nullptr == pAction) {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+    else if (pdPASS == xSemaphoreTake(this->_lock, ACTION_LOCK_TIMEOUT_TICKS)) {
+        for (i = 0; BTN_MAX_SUBSCRIPTIONS > i; ++i) {
+            if (nullptr == this->_pSubscriptions[i].pAction) {
+                break;
             }
-            else if (BTN_KEEP_WAIT_TIME < currTime - this->_pBtnLastPress[i])
-            {
-                this->_pBtnStates[i] = E_ButtonState::BTN_STATE_KEEP;
+        }
+
+        if (BTN_MAX_SUBSCRIPTIONS > i) {
+            /* The action is set last, the slot is then complete */
+            this->_pSubscriptions[i].btnId = kBtnId;
+            this->_pSubscriptions[i].edgeMask = kEdgeMask;
+            this->_pSubscriptions[i].timerTime = 0;
+            this->_pSubscriptions[i].pAction = pAction;
+            this->_pEdgeMasks[kBtnId] |= kEdgeMask;
+            rSubId = i;
+            error = E_Return::NO_ERROR;
+        }
+        else {
+            LOG_ERROR("No free IO Button subscription.\n");
+            error = E_Return::ERR_MEMORY;
+        }
+
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the IO Button Manager Action lock.\n");
+        }
+    }
+    else {
+        LOG_ERROR("Failed to acquire actions lock.\n");
+        error = E_Return::ERR_BTN_ACTION_TIMEOUT;
+    }
+
+    return error;
+}
+
+E_Return IOButtonManager::Unsubscribe(const uint32_t kSubId) noexcept {
+    E_Return error;
+    uint32_t i;
+
+    LOG_DEBUG("Unsubscribing IO Button Manager action.\n");
+
+    if (BTN_MAX_SUBSCRIPTIONS <= kSubId) {
+        error = E_Return::ERR_NO_SUCH_ID;
+    }
+    else if (pdPASS == xSemaphoreTake(this->_lock, ACTION_LOCK_TIMEOUT_TICKS)) {
+        if (nullptr != this->_pSubscriptions[kSubId].pAction) {
+            this->_pSubscriptions[kSubId].pAction = nullptr;
+
+            /* Rebuild the subscribed transitions of the button */
+            this->_pEdgeMasks[this->_pSubscriptions[kSubId].btnId] = 0;
+            for (i = 0; BTN_MAX_SUBSCRIPTIONS > i; ++i) {
+                if (nullptr != this->_pSubscriptions[i].pAction) {
+                    this->_pEdgeMasks[this->_pSubscriptions[i].btnId] |=
+                        this->_pSubscriptions[i].edgeMask;
+                }
             }
+            error = E_Return::NO_ERROR;
         }
         else {
-            /* When the button is released, its state is allways UP */
-            this->_pBtnStates[i] = E_ButtonState::BTN_STATE_UP;
+            error = E_Return::ERR_NO_SUCH_ID;
+        }
+
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the IO Button Manager Action lock.\n");
         }
     }
+    else {
+        LOG_ERROR("Failed to acquire actions lock.\n");
+        error = E_Return::ERR_BTN_ACTION_TIMEOUT;
+    }
 
-    /* Execute actions */
-    for (it = this->_actions.begin(); this->_actions.end() != it; ++it) {
-        /* Execute */
-        it->second->Execute(this->_pBtnLastPress, this->_pBtnStates);
+    return error;
+}
+
+void IOButtonManager::SetTimer(const uint32_t kSubId,
+                               const uint64_t kTime) noexcept {
+    if (BTN_MAX_SUBSCRIPTIONS > kSubId) {
+        this->_pSubscriptions[kSubId].timerTime = kTime;
     }
 }
 
@@ -274,4 +394,190 @@ E_Return IOButtonManager::RemoveAction(const uint32_t krActionId) noexcept {
     }
 
     return error;
+}
+
+void IRAM_ATTR IOButtonManager::IrqHandler(void* pArg) noexcept {
+    S_ButtonIrqContext* pContext;
+    S_ButtonEvent       event;
+    BaseType_t          hasWoken;
+
+    pContext = (S_ButtonIrqContext*)pArg;
+
+    /* esp_timer_get_time is safe in interrupts, HWManager is not in IRAM */
+    event.btnId = pContext->btnId;
+    event.type = E_ButtonEventType::BTN_EVENT_EDGE;
+    event.time = (uint64_t)esp_timer_get_time() * 1000ULL;
+
+    hasWoken = pdFALSE;
+    xQueueSendFromISR(pContext->pManager->_events, &event, &hasWoken);
+    if (nullptr != pContext->pManager->_notifyTask) {
+        vTaskNotifyGiveFromISR(pContext->pManager->_notifyTask, &hasWoken);
+    }
+    if (pdFALSE != hasWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+void IOButtonManager::KeepTimerHandler(void* pArg) noexcept {
+    S_ButtonIrqContext* pContext;
+    S_ButtonEvent       event;
+
+    pContext = (S_ButtonIrqContext*)pArg;
+
+    event.btnId = pContext->btnId;
+    event.type = E_ButtonEventType::BTN_EVENT_KEEP;
+    event.time = HWManager::GetTime();
+    if (pdPASS != xQueueSend(pContext->pManager->_events, &event, 0)) {
+        LOG_ERROR("Button events queue full, keep event lost.\n");
+    }
+    if (nullptr != pContext->pManager->_notifyTask) {
+        xTaskNotifyGive(pContext->pManager->_notifyTask);
+    }
+}
+
+uint8_t IOButtonManager::ReadButton(const E_ButtonID kBtnId)
+const noexcept {
+    uint8_t btnState;
+
+    btnState = digitalRead(this->_pBtnPins[kBtnId]);
+
+    /* Manage pinmux */
+    if (INPUT_PULLUP == this->_pBtnPinsMux[kBtnId]) {
+        btnState = !btnState;
+    }
+
+    return btnState;
+}
+
+void IOButtonManager::ProcessEvent(const S_ButtonEvent& krEvent) noexcept {
+    E_ButtonID btnId;
+
+    btnId = krEvent.btnId;
+    if (E_ButtonEventType::BTN_EVENT_EDGE == krEvent.type) {
+        /* The press time is the first edge of the bounces */
+        if (!this->_pIsBouncing[btnId]) {
+            this->_pIsBouncing[btnId] = true;
+            this->_pFirstEdge[btnId] = krEvent.time;
+        }
+        this->_pLastEdge[btnId] = krEvent.time;
+    }
+    else if (E_ButtonState::BTN_STATE_DOWN == this->_pBtnStates[btnId]) {
+        /* The level is checked again in case the release was missed */
+        if (0 != ReadButton(btnId)) {
+            this->_pBtnStates[btnId] = E_ButtonState::BTN_STATE_KEEP;
+            Dispatch(btnId, E_ButtonEdge::BTN_EDGE_KEEP, krEvent.time);
+        }
+        else {
+            this->_pBtnStates[btnId] = E_ButtonState::BTN_STATE_UP;
+            Dispatch(btnId, E_ButtonEdge::BTN_EDGE_RELEASE, krEvent.time);
+        }
+    }
+}
+
+uint64_t IOButtonManager::Settle(const uint64_t kTime) noexcept {
+    uint64_t nextSettle;
+    uint64_t elapsed;
+    uint8_t  i;
+
+    nextSettle = UINT64_MAX;
+    for (i = 0; E_ButtonID::BUTTON_MAX_ID > i; ++i) {
+        /* The edges queued after the cycle time are not settled yet */
+        elapsed = 0;
+        if (kTime > this->_pLastEdge[i]) {
+            elapsed = kTime - this->_pLastEdge[i];
+        }
+        if (this->_pIsBouncing[i] && BTN_DEBOUNCE_NS > elapsed) {
+            nextSettle = std::min(
+                nextSettle,
+                (uint64_t)(BTN_DEBOUNCE_NS - elapsed)
+            );
+        }
+        else if (this->_pIsBouncing[i]) {
+            this->_pIsBouncing[i] = false;
+            if (0 == ReadButton((E_ButtonID)i)) {
+                /* When the button is released, its state is allways UP */
+                if (E_ButtonState::BTN_STATE_UP != this->_pBtnStates[i]) {
+                    this->_pBtnStates[i] = E_ButtonState::BTN_STATE_UP;
+                    esp_timer_stop(this->_pKeepTimers[i]);
+                    Dispatch(
+                        (E_ButtonID)i,
+                        E_ButtonEdge::BTN_EDGE_RELEASE,
+                        this->_pFirstEdge[i]
+                    );
+                }
+            }
+            else if (E_ButtonState::BTN_STATE_UP == this->_pBtnStates[i]) {
+                this->_pBtnStates[i] = E_ButtonState::BTN_STATE_DOWN;
+                this->_pBtnLastPress[i] = this->_pFirstEdge[i];
+                esp_timer_start_once(
+                    this->_pKeepTimers[i],
+                    BTN_KEEP_WAIT_TIME / 1000ULL
+                );
+                Dispatch(
+                    (E_ButtonID)i,
+                    E_ButtonEdge::BTN_EDGE_PRESS,
+                    this->_pFirstEdge[i]
+                );
+            }
+        }
+    }
+
+    return nextSettle;
+}
+
+void IOButtonManager::Dispatch(const E_ButtonID   kBtnId,
+                               const E_ButtonEdge kEdge,
+                               const uint64_t     kTime) noexcept {
+    IOButtonManagerAction* pAction;
+    S_Event                event;
+    uint32_t               i;
+
+    event.id                 = E_EventId::EVENT_BUTTON;
+    event.data.button.button = (uint8_t)kBtnId;
+    event.data.button.edge   = (uint8_t)kEdge;
+    EventBus::Publish(event);
+
+    /* Nothing to scan when no subscription wants the transition */
+    if (0 != (this->_pEdgeMasks[kBtnId] & BTN_EDGE_MASK(kEdge))) {
+        for (i = 0; BTN_MAX_SUBSCRIPTIONS > i; ++i) {
+            pAction = this->_pSubscriptions[i].pAction;
+            if (nullptr != pAction &&
+                kBtnId == this->_pSubscriptions[i].btnId &&
+                0 != (this->_pSubscriptions[i].edgeMask &
+                      BTN_EDGE_MASK(kEdge))) {
+                pAction->OnEvent(i, kBtnId, kEdge, kTime);
+            }
+        }
+    }
+}
+
+uint64_t IOButtonManager::CheckTimers(const uint64_t kTime) noexcept {
+    S_ButtonSubscription* pSub;
+    uint64_t              nextTimer;
+    uint32_t              i;
+
+    nextTimer = UINT64_MAX;
+    for (i = 0; BTN_MAX_SUBSCRIPTIONS > i; ++i) {
+        pSub = &this->_pSubscriptions[i];
+        if (nullptr != pSub->pAction && 0 != pSub->timerTime) {
+            if (kTime >= pSub->timerTime) {
+                /* Cleared first, the action may set it again */
+                pSub->timerTime = 0;
+                pSub->pAction->OnEvent(
+                    i,
+                    pSub->btnId,
+                    E_ButtonEdge::BTN_EDGE_TIMER,
+                    kTime
+                );
+            }
+            if (0 != pSub->timerTime) {
+                nextTimer = std::min(
+                    nextTimer,
+                    pSub->timerTime - std::min(kTime, pSub->timerTime)
+                );
+            }
+        }
+    }
+
+    return nextTimer;
 }
\ No newline at end of file
@@ -20,10 +20,17 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
+/* Included headers */
 #include <BSP.h>               /* BSP definitions */
 #include <cstdint>             /* Generic Types */
 #include <Logger.h>            /* Logger services */
 #include <Errors.h>            /* Errors definitions */
+#include <Arduino.h>           /* Arduino framework */
+#include <algorithm>           /* std::min */
 #include <SystemState.h>       /* System state services */
 
 /* Header File */
@@ -32,7 +39,16 @@
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/* None */
+/** @brief Defines the RMT tick of the RGB LED frames in nanoseconds. */
+#define LED_RMT_TICK_NS 100
+/** @brief Defines the high time of a 0 bit in RMT ticks. */
+#define LED_RMT_T0H 4
+/** @brief Defines the low time of a 0 bit in RMT ticks. */
+#define LED_RMT_T0L 8
+/** @brief Defines the high time of a 1 bit in RMT ticks. */
+#define LED_RMT_T1H 8
+/** @brief Defines the low time of a 1 bit in RMT ticks. */
+#define LED_RMT_T1L 4
 
 /*******************************************************************************
  * MACROS
@@ -76,9 +92,13 @@
  ******************************************************************************/
 
 IOLedManager::IOLedManager(void) noexcept {
+    uint8_t i;
+
     /* Init states. */
     memset(this->_pLedStates, 0, sizeof(S_LedState) * E_LedID::LED_MAX_ID);
     memset(this->_pNextPeriods, 0, sizeof(uint64_t) * E_LedID::LED_MAX_ID);
+    memset(this->_pIsDirty, 0, sizeof(bool) * E_LedID::LED_MAX_ID);
+    this->_notifyTask = nullptr;
 
     /* Init the GPIOs */
     this->_pLedDev[E_LedID::LED_INFO].pin = E_GPIORouting::GPIO_LED_INFO;
@@ -86,6 +106,24 @@ IOLedManager::IOLedManager(void) noexcept {
     pinMode(this->_pLedDev[E_LedID::LED_INFO].pin, OUTPUT);
     digitalWrite(this->_pLedDev[E_LedID::LED_INFO].pin, LOW);
 
+    /* Reserve the RMT channels of the RGB LEDs */
+    for (i = 0; E_LedID::LED_MAX_ID > i; ++i) {
+        this->_pLedDev[i].pRmt = nullptr;
+        if (this->_pLedDev[i].isRgb) {
+            this->_pLedDev[i].pRmt = rmtInit(
+                this->_pLedDev[i].pin,
+                RMT_TX_MODE,
+                RMT_MEM_64
+            );
+            if (nullptr != this->_pLedDev[i].pRmt) {
+                rmtSetTick(this->_pLedDev[i].pRmt, LED_RMT_TICK_NS);
+            }
+            else {
+                LOG_ERROR("Failed to reserve the RMT of LED %d.\n", i);
+            }
+        }
+    }
+
     /* Add to system state */
     SystemState::GetInstance()->SetIOLedManager(this);
 
@@ -96,53 +134,48 @@ IOLedManager::~IOLedManager(void) noexcept {
     PANIC("Tried to destroy the IO Led Manager.\n");
 }
 
-void IOLedManager::Update(void) noexcept {
-    uint8_t i;
+uint64_t IOLedManager::Update(const uint64_t kTime) noexcept {
+    uint64_t nextEdge;
+    uint8_t  i;
+
+    nextEdge = UINT64_MAX;
 
     /* Iterate over all leds */
     for (i = 0; E_LedID::LED_MAX_ID > i; ++i) {
-        /* Check if enabled */
-        if (this->_pLedStates[i].enabled) {
-            /* Check the blink period */
-            if (0 != this->_pLedStates[i].blinkPeriodNs) {
-                if (HWManager::GetTime() > this->_pNextPeriods[i]) {
-                    /* Update time */
-                    this->_pNextPeriods[i] = HWManager::GetTime() +
-                        this->_pLedStates[i].blinkPeriodNs;
-
-                    /* Update state */
-                    this->_pLedStates[i].isOn = !this->_pLedStates[i].isOn;
-                }
-            }
-
-            /* Set state */
-            if (this->_pLedDev[i].isRgb) {
-                neopixelWrite(
-                    this->_pLedDev[i].pin,
-                    this->_pLedStates[i].red * this->_pLedStates[i].isOn,
-                    this->_pLedStates[i].green * this->_pLedStates[i].isOn,
-                    this->_pLedStates[i].blue * this->_pLedStates[i].isOn
-                );
-            }
-            else {
-                digitalWrite(this->_pLedDev[i].pin, this->_pLedStates[i].isOn);
+        /* Check the blink period */
+        if (this->_pLedStates[i].enabled &&
+            0 != this->_pLedStates[i].blinkPeriodNs) {
+            if (kTime > this->_pNextPeriods[i]) {
+                /* Update time */
+                this->_pNextPeriods[i] = kTime +
+                    this->_pLedStates[i].blinkPeriodNs;
+
+                /* Update state */
+                this->_pLedStates[i].isOn = !this->_pLedStates[i].isOn;
+                this->_pIsDirty[i] = true;
             }
+            nextEdge = std::min(nextEdge, this->_pNextPeriods[i] - kTime);
         }
-        else {
-            /* Set state */
-            if (this->_pLedDev[i].isRgb) {
-                neopixelWrite(this->_pLedDev[i].pin, 0, 0, 0);
-            }
-            else {
-                digitalWrite(this->_pLedDev[i].pin, 0);
-            }
+
+        /* Cleared first, a concurrent change is written at the next update */
+        if (this->_pIsDirty[i]) {
+            this->_pIsDirty[i] = false;
+            Write((E_LedID)i);
         }
     }
+
+    return nextEdge;
+}
+
+void IOLedManager::SetNotifyTask(const TaskHandle_t kTask) noexcept {
+    this->_notifyTask = kTask;
 }
 
 void IOLedManager::Enable(const E_LedID kLedId, const bool kEnable) noexcept {
     if (E_LedID::LED_MAX_ID > kLedId) {
         this->_pLedStates[kLedId].enabled = kEnable;
+        this->_pIsDirty[kLedId] = true;
+        NotifyChange();
     }
 }
 
@@ -150,5 +183,65 @@ void IOLedManager::SetState(const E_LedID kLedId,
                              const S_LedState& krState) noexcept {
     if (E_LedID::LED_MAX_ID > kLedId) {
         this->_pLedStates[kLedId] = krState;
+        this->_pIsDirty[kLedId] = true;
+        NotifyChange();
+    }
+}
+
+void IOLedManager::Write(const E_LedID kLedId) noexcept {
+    const S_LedState* kpState;
+    rmt_data_t*       pFrame;
+    uint32_t          color;
+    uint8_t           isOn;
+    uint8_t           i;
+
+    kpState = &this->_pLedStates[kLedId];
+    isOn = kpState->enabled && kpState->isOn;
+
+    if (!this->_pLedDev[kLedId].isRgb) {
+        digitalWrite(this->_pLedDev[kLedId].pin, isOn);
+    }
+    else if (nullptr == this->_pLedDev[kLedId].pRmt) {
+        neopixelWrite(
+            this->_pLedDev[kLedId].pin,
+            kpState->red * isOn,
+            kpState->green * isOn,
+            kpState->blue * isOn
+        );
+    }
+    else {
+        /* The LED expects the GRB components, most significant bit first */
+        color = ((uint32_t)(kpState->green * isOn) << 16) |
+                ((uint32_t)(kpState->red * isOn) << 8) |
+                (uint32_t)(kpState->blue * isOn);
+        pFrame = this->_pRmtFrames[kLedId];
+        for (i = 0; LED_RGB_FRAME_BITS > i; ++i) {
+            if (0 != (color & (1UL << (LED_RGB_FRAME_BITS - 1 - i)))) {
+                pFrame[i].duration0 = LED_RMT_T1H;
+                pFrame[i].duration1 = LED_RMT_T1L;
+            }
+            else {
+                pFrame[i].duration0 = LED_RMT_T0H;
+                pFrame[i].duration1 = LED_RMT_T0L;
+            }
+            pFrame[i].level0 = 1;
+            pFrame[i].level1 = 0;
+        }
+
+        /* The frame fits the channel memory, the write does not block */
+        if (!rmtWrite(
+                this->_pLedDev[kLedId].pRmt,
+                pFrame,
+                LED_RGB_FRAME_BITS
+            )) {
+            this->_pIsDirty[kLedId] = true;
+        }
+    }
+}
+
+void IOLedManager::NotifyChange(void) noexcept {
+    if (nullptr != this->_notifyTask &&
+        xTaskGetCurrentTaskHandle() != this->_notifyTask) {
+        xTaskNotifyGive(this->_notifyTask);
     }
 }
\ No newline at end of file
@@ -0,0 +1,300 @@
+/*******************************************************************************
+ * @file LogCodec.cpp
+ *
+ * @see LogCodec.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Persistent journal block codec.
+ *
+ * @details Persistent journal block codec. The journal text is compressed in
+ * frames of bounded size with a byte oriented LZ77 codec. The encoder is
+ * incremental and never outgrows its frame, the decoder needs no memory
+ * besides its output.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstring> /* memcpy, memcmp, memset */
+#include <cstdint> /* Standard integer definitions */
+
+/* Header file */
+#include <LogCodec.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the flag of the match tokens. */
+#define LOG_CODEC_MATCH_FLAG 0x80
+
+/** @brief Defines the multiplier of the match finder hash. */
+#define LOG_CODEC_HASH_PRIME 2654435761U
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Returns the match finder hash of a position.
+ *
+ * @param[in] kpData The LOG_CODEC_MIN_MATCH bytes at the position.
+ *
+ * @return The hash of the position is returned.
+ */
+static uint32_t GetHash(const uint8_t* kpData) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static uint32_t GetHash(const uint8_t* kpData) noexcept {
+    uint32_t value;
+
+    memcpy(&value, kpData, sizeof(uint32_t));
+
+    return (value * LOG_CODEC_HASH_PRIME) >> (32 - LOG_CODEC_HASH_BITS);
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+void LogCodec::Reset(S_LogCodecEncoder& rEncoder) noexcept {
+    rEncoder.rawLen       = 0;
+    rEncoder.encoded      = 0;
+    rEncoder.literalStart = 0;
+    rEncoder.packedLen    = 0;
+    memset(rEncoder.pHash, 0, LOG_CODEC_HASH_SIZE * sizeof(uint16_t));
+}
+
+size_t LogCodec::Append(S_LogCodecEncoder& rEncoder,
+                        const uint8_t*     kpData,
+                        const size_t       kSize) noexcept {
+    size_t accepted;
+    size_t available;
+    size_t pending;
+    size_t toCopy;
+    bool   isFull;
+
+    accepted = 0;
+    isFull   = false;
+    while (!isFull && kSize > accepted) {
+        /* The pending bytes must fit the frame, even as literals */
+        available = rEncoder.capacity - rEncoder.packedLen;
+        toCopy    = available * LOG_CODEC_MAX_LITERALS /
+                    (LOG_CODEC_MAX_LITERALS + 1);
+        if (GetLiteralsCost(toCopy + 1) <= available) {
+            ++toCopy;
+        }
+        pending = rEncoder.rawLen - rEncoder.literalStart;
+        toCopy  = toCopy > pending ? toCopy - pending : 0;
+
+        if (LOG_CODEC_WINDOW_SIZE - rEncoder.rawLen < toCopy) {
+            toCopy = LOG_CODEC_WINDOW_SIZE - rEncoder.rawLen;
+        }
+        if (kSize - accepted < toCopy) {
+            toCopy = kSize - accepted;
+        }
+
+        if (0 != toCopy) {
+            memcpy(rEncoder.pRaw + rEncoder.rawLen, kpData + accepted, toCopy);
+            rEncoder.rawLen += toCopy;
+            accepted        += toCopy;
+            Encode(rEncoder);
+        }
+        else {
+            isFull = true;
+        }
+    }
+
+    return accepted;
+}
+
+size_t LogCodec::Pack(const S_LogCodecEncoder& krEncoder,
+                      uint8_t*                 pOutput) noexcept {
+    size_t size;
+
+    memcpy(pOutput, krEncoder.pPacked, krEncoder.packedLen);
+    size = krEncoder.packedLen;
+    size += PutLiterals(
+        krEncoder.pRaw + krEncoder.literalStart,
+        krEncoder.rawLen - krEncoder.literalStart,
+        pOutput + size
+    );
+
+    return size;
+}
+
+bool LogCodec::Decode(const uint8_t* kpPacked,
+                      const size_t   kPackedSize,
+                      uint8_t*       pRaw,
+                      const size_t   kRawSize,
+                      size_t&        rRawLen) noexcept {
+    size_t  input;
+    size_t  output;
+    size_t  length;
+    size_t  distance;
+    size_t  i;
+    uint8_t token;
+    bool    isValid;
+
+    input   = 0;
+    output  = 0;
+    isValid = true;
+    while (isValid && kPackedSize > input) {
+        token = kpPacked[input++];
+        if (LOG_CODEC_MATCH_FLAG > token) {
+            length  = (size_t)token + 1;
+            isValid = kPackedSize - input >= length &&
+                      kRawSize - output >= length;
+            if (isValid) {
+                memcpy(pRaw + output, kpPacked + input, length);
+                input  += length;
+                output += length;
+            }
+        }
+        else {
+            length  = (size_t)(token & ~LOG_CODEC_MATCH_FLAG) +
+                      LOG_CODEC_MIN_MATCH;
+            isValid = kPackedSize - input >= 2;
+            if (isValid) {
+                distance = (size_t)kpPacked[input] |
+                           ((size_t)kpPacked[input + 1] << 8);
+                input += 2;
+                isValid = 0 != distance && output >= distance &&
+                          kRawSize - output >= length;
+            }
+            if (isValid) {
+                /* The match may overlap its output */
+                for (i = 0; length > i; ++i) {
+                    pRaw[output + i] = pRaw[output + i - distance];
+                }
+                output += length;
+            }
+        }
+    }
+
+    rRawLen = output;
+
+    return isValid;
+}
+
+void LogCodec::Encode(S_LogCodecEncoder& rEncoder) noexcept {
+    uint8_t* pRaw;
+    uint32_t hash;
+    size_t   position;
+    size_t   candidate;
+    size_t   length;
+    size_t   longest;
+    size_t   distance;
+    size_t   i;
+
+    pRaw     = rEncoder.pRaw;
+    position = rEncoder.encoded;
+    while (rEncoder.rawLen >= position + LOG_CODEC_MIN_MATCH) {
+        hash      = GetHash(pRaw + position);
+        candidate = rEncoder.pHash[hash];
+        rEncoder.pHash[hash] = (uint16_t)(position + 1);
+
+        /* Positions are stored plus one, zero is an empty entry */
+        length = 0;
+        if (0 != candidate &&
+            0 == memcmp(pRaw + candidate - 1,
+                        pRaw + position,
+                        LOG_CODEC_MIN_MATCH)) {
+            --candidate;
+            longest = rEncoder.rawLen - position;
+            longest = LOG_CODEC_MAX_MATCH < longest ?
+                      LOG_CODEC_MAX_MATCH : longest;
+            length  = LOG_CODEC_MIN_MATCH;
+            while (longest > length &&
+                   pRaw[candidate + length] == pRaw[position + length]) {
+                ++length;
+            }
+        }
+
+        if (0 != length) {
+            /* A match never costs more than the literals it replaces */
+            rEncoder.packedLen += PutLiterals(
+                pRaw + rEncoder.literalStart,
+                position - rEncoder.literalStart,
+                rEncoder.pPacked + rEncoder.packedLen
+            );
+
+            distance = position - candidate;
+            rEncoder.pPacked[rEncoder.packedLen++] =
+                LOG_CODEC_MATCH_FLAG | (uint8_t)(length - LOG_CODEC_MIN_MATCH);
+            rEncoder.pPacked[rEncoder.packedLen++] = (uint8_t)distance;
+            rEncoder.pPacked[rEncoder.packedLen++] = (uint8_t)(distance >> 8);
+
+            /* Index the matched positions for the next matches */
+            for (i = position + 1;
+                 position + length > i &&
+                 rEncoder.rawLen >= i + LOG_CODEC_MIN_MATCH;
+                 ++i) {
+                rEncoder.pHash[GetHash(pRaw + i)] = (uint16_t)(i + 1);
+            }
+
+            position += length;
+            rEncoder.literalStart = position;
+        }
+        else {
+            ++position;
+        }
+    }
+
+    rEncoder.encoded = position;
+}
+
+size_t LogCodec::PutLiterals(const uint8_t* kpLiterals,
+                             size_t         count,
+                             uint8_t*       pOutput) noexcept {
+    size_t size;
+    size_t run;
+
+    size = 0;
+    while (0 < count) {
+        run = LOG_CODEC_MAX_LITERALS < count ?
+              LOG_CODEC_MAX_LITERALS : count;
+
+        pOutput[size] = (uint8_t)(run - 1);
+        memcpy(pOutput + size + 1, kpLiterals, run);
+        size       += run + 1;
+        kpLiterals += run;
+        count      -= run;
+    }
+
+    return size;
+}
+
+size_t LogCodec::GetLiteralsCost(const size_t kSize) noexcept {
+    return kSize + (kSize + LOG_CODEC_MAX_LITERALS - 1) /
+                   LOG_CODEC_MAX_LITERALS;
+}
@@ -20,12 +20,16 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
-#include <BSP.h>         /* Hardware services*/
-#include <cstdint>       /* Standard Int Types */
-#include <Arduino.h>     /* Serial service */
-#include <Storage.h>     /* Storage manager */
-#include <SystemState.h> /* System state services */
-#include <ModeManager.h> /* Mode management */
+#include <BSP.h>          /* Hardware services*/
+#include <cstdint>        /* Standard Int Types */
+#include <Arduino.h>      /* Serial service */
+#include <Storage.h>      /* Storage manager */
+#include <SystemState.h>  /* System state services */
+#include <ModeManager.h>  /* Mode management */
+#include <TaskRegistry.h> /* Firmware tasks registry */
+#include <BootRecord.h>   /* Boot mode and reset record */
+#include <Metrics.h>      /* Metrics counters */
+#include <Tracer.h>       /* Events tracer */
 
 /* Header file */
 #include <Logger.h>
@@ -37,313 +41,2538 @@
 /** @brief Serial Baudrate */
 #define LOGGER_SERIAL_BAUDRATE 115200
 
-/** @brief The log buffer size in bytes. */
-#define LOGGER_BUFFER_SIZE 512
+/** @brief Log file path, segments are suffixed with their index. */
+#define LOG_JOURNAL_PATH "rthr_logs"
+/** @brief Log journal index file path, stores the segment and the format. */
+#define LOG_JOURNAL_INDEX_PATH "rthr_logs.idx"
+/** @brief Log journal index file size in bytes. */
+#define LOG_JOURNAL_INDEX_SIZE 2
+/** @brief Log journal format: raw logs. */
+#define LOG_JOURNAL_FORMAT_RAW 0
+/** @brief Log journal format: compressed frames. */
+#define LOG_JOURNAL_FORMAT_FRAMES 1
+#if LOG_JOURNAL_COMPRESSED
+/** @brief Log journal format of the firmware. */
+#define LOG_JOURNAL_FORMAT LOG_JOURNAL_FORMAT_FRAMES
+/** @brief Log journal segment open mode, frames are written in their slot. */
+#define LOG_JOURNAL_SEGMENT_MODE (O_RDWR | O_CREAT)
+#else
+/** @brief Log journal format of the firmware. */
+#define LOG_JOURNAL_FORMAT LOG_JOURNAL_FORMAT_RAW
+/** @brief Log journal segment open mode, logs are appended. */
+#define LOG_JOURNAL_SEGMENT_MODE (O_RDWR | O_CREAT | O_APPEND)
+#endif
+/** @brief Log journal compressed frame magic. */
+#define LOG_JOURNAL_FRAME_MAGIC 0x464A4C52
+/** @brief Log journal compressed frame packed data capacity in bytes. */
+#define LOG_JOURNAL_FRAME_CAPACITY \
+    (LOG_JOURNAL_FRAME_SIZE - sizeof(S_LogJournalFrame))
+/** @brief Log journal time index extension, one index per segment. */
+#define LOG_JOURNAL_TIME_INDEX_EXT "tix"
+/** @brief Log journal time index stride in bytes of segment. */
+#define LOG_JOURNAL_TIME_INDEX_STRIDE 4096
+/** @brief Maximal log journal segment path length. */
+#define LOG_JOURNAL_PATH_SIZE 32
+/** @brief Write-behind block maximal retention time in nanoseconds. */
+#define LOG_JOURNAL_FLUSH_PERIOD_NS 1000000000ULL
+/** @brief Journal request: flush the write-behind block. */
+#define LOG_JOURNAL_REQ_FLUSH 0x1
+/** @brief Journal request: remove all the journal segments. */
+#define LOG_JOURNAL_REQ_CLEAR 0x2
+
+/** @brief Maximal size of a string argument stored in a binary record. */
+#define LOG_RECORD_STR_MAX 128
+/** @brief Maximal size of a single conversion specification. */
+#define LOG_RECORD_SPEC_MAX 24
+/** @brief Maximal wait for the RAM journal lock in nanoseconds. */
+#define LOG_RAM_LOCK_TIMEOUT_NS 100000000ULL
+/** @brief Maximal wait for the RAM journal lock in ticks. */
+#define LOG_RAM_LOCK_TIMEOUT_TICKS \
+    (pdMS_TO_TICKS(LOG_RAM_LOCK_TIMEOUT_NS / 1000000ULL))
+
+/** @brief Ram log buffer size. */
+#define LOG_RAM_BUFFER_SIZE 0x200000
+/** @brief Smallest RAM journal record, a header and its trailer. */
+#define LOG_RAM_RECORD_MIN_SIZE (sizeof(S_LogRecordHeader) + sizeof(uint16_t))
+/** @brief Number of records between two RAM journal index entries. */
+#define LOG_RAM_INDEX_STRIDE 16
+/**
+ * @brief Number of RAM journal index entries, the entries of all the records
+ * the journal can hold are never reused.
+ */
+#define LOG_RAM_INDEX_SIZE \
+    (LOG_RAM_BUFFER_SIZE / (LOG_RAM_RECORD_MIN_SIZE * LOG_RAM_INDEX_STRIDE) + 1)
+
+/** @brief Logger writer task maximal wait between two drains. */
+#define LOGGER_TASK_WAIT_NS 100000000ULL
+/** @brief Logger writer task maximal wait between two drains in ticks. */
+#define LOGGER_TASK_WAIT_TICKS (pdMS_TO_TICKS(LOGGER_TASK_WAIT_NS / 1000000ULL))
+/** @brief Maximal time to wait for the writer task on flush. */
+#define LOGGER_FLUSH_TIMEOUT_NS 500000000ULL
+/** @brief Mask used to get the position of a record in the ring. */
+#define LOGGER_ASYNC_RING_MASK (LOGGER_ASYNC_RING_SIZE - 1)
+/** @brief Multiplier of the call sites hash. */
+#define LOGGER_RATE_HASH_PRIME 2654435761U
+
+static_assert(METRIC_LOG_DEBUG == METRIC_LOG_CRITICAL + LOG_LEVEL_DEBUG,
+              "The log lines counters must follow the log levels");
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+
+/** @brief Binary log record header, followed by the arguments and the record
+ * size trailer.
+ */
+typedef struct __attribute__((packed)) {
+    /** @brief Total record size, including the header and the trailer. */
+    uint16_t size;
+    /** @brief The log level. */
+    uint8_t level;
+    /** @brief Number of stored arguments. */
+    uint8_t argCount;
+    /** @brief The line where the log was generated. */
+    uint32_t line;
+    /** @brief The RAM journal sequence, set when the record is stored. */
+    uint32_t sequence;
+    /** @brief The log timestamp in nanoseconds. */
+    uint64_t timestamp;
+    /** @brief The file where the log was generated, stored in flash. */
+    const char* pkFile;
+    /** @brief The format string, stored in flash. */
+    const char* pkFormat;
+} S_LogRecordHeader;
+
+/** @brief Binary log record argument types. */
+typedef enum {
+    /** @brief Invalid or unsupported conversion. */
+    LOG_ARG_NONE = 0,
+    /** @brief 32 bits integer argument. */
+    LOG_ARG_INT32 = 1,
+    /** @brief 64 bits integer argument. */
+    LOG_ARG_INT64 = 2,
+    /** @brief Floating point argument. */
+    LOG_ARG_DOUBLE = 3,
+    /** @brief Pointer argument. */
+    LOG_ARG_PTR = 4,
+    /** @brief String argument, copied in the record. */
+    LOG_ARG_STR = 5,
+    /** @brief Escaped percent sign, no argument. */
+    LOG_ARG_PERCENT = 6
+} E_LogArgType;
+
+/** @brief Persistent journal time index entry. */
+typedef struct __attribute__((packed)) {
+    /** @brief Journal time of the first log of the block in nanoseconds. */
+    uint64_t time;
+    /** @brief Offset of the block in the segment. */
+    uint32_t offset;
+} S_LogJournalIndexEntry;
+
+/** @brief Persistent journal compressed frame header, followed by the packed
+ * data.
+ */
+typedef struct __attribute__((packed)) {
+    /** @brief The frame magic, LOG_JOURNAL_FRAME_MAGIC. */
+    uint32_t magic;
+    /** @brief CRC of the fields below and of the packed data. */
+    uint32_t crc;
+    /** @brief Offset of the frame logs in the segment. */
+    uint32_t rawOffset;
+    /** @brief Size of the frame logs in bytes. */
+    uint16_t rawLen;
+    /** @brief Size of the packed data in bytes. */
+    uint16_t packedLen;
+} S_LogJournalFrame;
+
+/** @brief Conversion specification parsed from a format string. */
+typedef struct {
+    /** @brief Length of the specification in the format string. */
+    size_t length;
+    /** @brief Argument type of the conversion. */
+    E_LogArgType type;
+    /** @brief Number of '*' width and precision arguments. */
+    uint8_t starCount;
+} S_LogConversion;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief Singleton instance. */
+Logger* Logger::_SPINSTANCE = nullptr;
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/**
+ * @brief Returns the storage used by the persistent journal.
+ *
+ * @details Returns the storage used by the persistent journal. The storage
+ * might not be initialized when the first logs are generated.
+ *
+ * @return The storage is returned, nullptr if not initialized.
+ */
+static Storage* GetJournalStorage(void) noexcept;
+
+/**
+ * @brief Builds the path of a journal segment.
+ *
+ * @details Builds the path of a journal segment, the segment index is used as
+ * file extension.
+ *
+ * @param[in] kSegment The segment index.
+ * @param[out] pPath The buffer receiving the path, must be at least
+ * LOG_JOURNAL_PATH_SIZE bytes.
+ */
+static void GetJournalSegmentPath(const uint8_t kSegment, char* pPath) noexcept;
+
+/**
+ * @brief Builds the path of a journal segment time index.
+ *
+ * @details Builds the path of a journal segment time index, the index is
+ * stored next to its segment.
+ *
+ * @param[in] kSegment The segment index.
+ * @param[out] pPath The buffer receiving the path, must be at least
+ * LOG_JOURNAL_PATH_SIZE bytes.
+ */
+static void GetJournalTimeIndexPath(const uint8_t kSegment, char* pPath)
+noexcept;
+
+/**
+ * @brief Reads an entry of the journal time indexes.
+ *
+ * @details Reads an entry of the journal time indexes. The indexes of the
+ * segments are seen as a single array, from the oldest segment to the newest.
+ *
+ * @param[in] pIndexes The time indexes files, from the oldest segment.
+ * @param[in] kpCounts The number of entries of each index.
+ * @param[in] kEntry The entry to read in the whole array.
+ * @param[out] pEntry The entry read.
+ * @param[out] pPosition The position of the entry segment, from the oldest.
+ *
+ * @return True is returned on success, false otherwise.
+ */
+static bool ReadJournalTimeEntry(FsFile*                 pIndexes,
+                                 const uint32_t*         kpCounts,
+                                 uint32_t                kEntry,
+                                 S_LogJournalIndexEntry* pEntry,
+                                 uint8_t*                pPosition) noexcept;
+
+#if LOG_JOURNAL_COMPRESSED
+/**
+ * @brief Computes the CRC of a journal frame.
+ *
+ * @param[in] kpHeader The frame header.
+ * @param[in] kpPacked The packed data of the frame.
+ *
+ * @return The CRC of the frame is returned.
+ */
+static uint32_t GetJournalFrameCrc(const S_LogJournalFrame* kpHeader,
+                                   const uint8_t*           kpPacked) noexcept;
+
+/**
+ * @brief Reads the header of a journal frame.
+ *
+ * @details Reads the header of a journal frame, the segment is left at the
+ * start of the packed data.
+ *
+ * @param[in, out] pSegment The segment file.
+ * @param[in] kSlot The slot of the frame in the segment.
+ * @param[out] pHeader The header read.
+ *
+ * @return True is returned when the header is valid, false otherwise.
+ */
+static bool ReadJournalFrameHeader(FsFile*            pSegment,
+                                   const uint32_t     kSlot,
+                                   S_LogJournalFrame* pHeader) noexcept;
+
+/**
+ * @brief Reads the header of the last frame of a segment.
+ *
+ * @param[in, out] pSegment The segment file.
+ * @param[out] pSlot The slot of the last frame.
+ * @param[out] pHeader The header of the last frame.
+ *
+ * @return True is returned when the segment holds a frame, false otherwise.
+ */
+static bool ReadLastJournalFrame(FsFile*            pSegment,
+                                 uint32_t*          pSlot,
+                                 S_LogJournalFrame* pHeader) noexcept;
+#endif
+
+/**
+ * @brief Parses a conversion specification.
+ *
+ * @details Parses a printf conversion specification starting at the '%'
+ * character.
+ *
+ * @param[in] pkSpec The specification to parse.
+ * @param[out] pConv The parsed conversion.
+ */
+static void ParseConversion(const char* pkSpec, S_LogConversion* pConv)
+noexcept;
+
+/**
+ * @brief Encodes a binary log record.
+ *
+ * @details Encodes a binary log record. Only the arguments are copied, the
+ * formating is deferred. String arguments are copied in the record and
+ * truncated to LOG_RECORD_STR_MAX bytes. When the record is full, the
+ * remaining arguments are discarded.
+ *
+ * @param[out] pBuffer The buffer receiving the record, must be at least
+ * LOGGER_BUFFER_SIZE bytes.
+ * @param[in] kLevel The lovel of the message to log.
+ * @param[in] pkFile The file where the log was generated.
+ * @param[in] kLine The line where the log was generated.
+ * @param[in] pkStr The format string used for the log
+ * @param[in] args The format arguments.
+ *
+ * @return The size of the record is returned.
+ */
+static size_t EncodeRecord(uint8_t*         pBuffer,
+                           const E_LogLevel kLevel,
+                           const char*      pkFile,
+                           const uint32_t   kLine,
+                           const char*      pkStr,
+                           va_list          args) noexcept;
+
+/**
+ * @brief Encodes a binary log record.
+ *
+ * @details Encodes a binary log record, variadic version of EncodeRecord.
+ *
+ * @param[out] pBuffer The buffer receiving the record, must be at least
+ * LOGGER_BUFFER_SIZE bytes.
+ * @param[in] kLevel The lovel of the message to log.
+ * @param[in] pkFile The file where the log was generated.
+ * @param[in] kLine The line where the log was generated.
+ * @param[in] pkStr The format string used for the log
+ * @param[in] ... The format arguments.
+ *
+ * @return The size of the record is returned.
+ */
+static size_t EncodeRecordArgs(uint8_t*         pBuffer,
+                               const E_LogLevel kLevel,
+                               const char*      pkFile,
+                               const uint32_t   kLine,
+                               const char*      pkStr,
+                               ...) noexcept;
+
+/**
+ * @brief Formats a binary log record.
+ *
+ * @details Formats a binary log record with its tag in the provided buffer.
+ * The formated message is truncated to kSize bytes, including the null
+ * terminator.
+ *
+ * @param[in] kpRecord The binary record to format.
+ * @param[out] pBuffer The buffer receiving the message.
+ * @param[in] kSize The size of the buffer.
+ *
+ * @return The length of the formated message is returned.
+ */
+static size_t FormatRecord(const uint8_t* kpRecord,
+                           char*          pBuffer,
+                           const size_t   kSize) noexcept;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static Storage* GetJournalStorage(void) noexcept {
+    SystemState* pSysState;
+    Storage*     pStorage;
+
+    pStorage = nullptr;
+    pSysState = SystemState::GetInstance();
+    if (nullptr != pSysState) {
+        pStorage = pSysState->GetStorage();
+    }
+
+    return pStorage;
+}
+
+static void GetJournalSegmentPath(const uint8_t kSegment, char* pPath) noexcept {
+    snprintf(
+        pPath,
+        LOG_JOURNAL_PATH_SIZE,
+        "%s.%u",
+        LOG_JOURNAL_PATH,
+        (unsigned int)kSegment
+    );
+}
+
+static void GetJournalTimeIndexPath(const uint8_t kSegment, char* pPath)
+noexcept {
+    snprintf(
+        pPath,
+        LOG_JOURNAL_PATH_SIZE,
+        "%s.%u.%s",
+        LOG_JOURNAL_PATH,
+        (unsigned int)kSegment,
+        LOG_JOURNAL_TIME_INDEX_EXT
+    );
+}
+
+static bool ReadJournalTimeEntry(FsFile*                 pIndexes,
+                                 const uint32_t*         kpCounts,
+                                 uint32_t                kEntry,
+                                 S_LogJournalIndexEntry* pEntry,
+                                 uint8_t*                pPosition) noexcept {
+    uint8_t i;
+    bool    success;
+
+    /* Get the segment of the entry */
+    i = 0;
+    while (LOG_JOURNAL_SEGMENT_COUNT > i && kpCounts[i] <= kEntry) {
+        kEntry -= kpCounts[i];
+        ++i;
+    }
+
+    success = false;
+    if (LOG_JOURNAL_SEGMENT_COUNT > i) {
+        success = pIndexes[i].seek(kEntry * sizeof(S_LogJournalIndexEntry)) &&
+                  (int)sizeof(S_LogJournalIndexEntry) == pIndexes[i].read(
+                      pEntry,
+                      sizeof(S_LogJournalIndexEntry)
+                  );
+        *pPosition = i;
+    }
+
+    return success;
+}
+
+#if LOG_JOURNAL_COMPRESSED
+static uint32_t GetJournalFrameCrc(const S_LogJournalFrame* kpHeader,
+                                   const uint8_t*           kpPacked) noexcept {
+    uint32_t crc;
+
+    /* The magic and the CRC are not covered */
+    crc = HAL::Crc32(
+        0,
+        (const uint8_t*)kpHeader + offsetof(S_LogJournalFrame, rawOffset),
+        sizeof(S_LogJournalFrame) - offsetof(S_LogJournalFrame, rawOffset)
+    );
+
+    return HAL::Crc32(crc, kpPacked, kpHeader->packedLen);
+}
+
+static bool ReadJournalFrameHeader(FsFile*            pSegment,
+                                   const uint32_t     kSlot,
+                                   S_LogJournalFrame* pHeader) noexcept {
+    return pSegment->seek(kSlot * LOG_JOURNAL_FRAME_SIZE) &&
+           (int)sizeof(S_LogJournalFrame) == pSegment->read(
+               pHeader,
+               sizeof(S_LogJournalFrame)
+           ) &&
+           LOG_JOURNAL_FRAME_MAGIC == pHeader->magic &&
+           0 != pHeader->rawLen &&
+           LOG_CODEC_WINDOW_SIZE >= pHeader->rawLen &&
+           LOG_JOURNAL_FRAME_CAPACITY >= pHeader->packedLen;
+}
+
+static bool ReadLastJournalFrame(FsFile*            pSegment,
+                                 uint32_t*          pSlot,
+                                 S_LogJournalFrame* pHeader) noexcept {
+    uint32_t slot;
+    bool     isFound;
+
+    /* A torn write only damages the last frames */
+    slot = (pSegment->size() + LOG_JOURNAL_FRAME_SIZE - 1) /
+           LOG_JOURNAL_FRAME_SIZE;
+    isFound = false;
+    while (!isFound && 0 < slot) {
+        --slot;
+        isFound = ReadJournalFrameHeader(pSegment, slot, pHeader);
+    }
+
+    *pSlot = slot;
+
+    return isFound;
+}
+#endif
+
+static void ParseConversion(const char* pkSpec, S_LogConversion* pConv)
+noexcept {
+    size_t i;
+    char   lengthMod;
+    bool   isLong;
+
+    pConv->starCount = 0;
+    lengthMod = 0;
+    isLong = false;
+
+    i = 1;
+    if ('%' == pkSpec[i]) {
+        pConv->type = LOG_ARG_PERCENT;
+        ++i;
+    }
+    else {
+        /* Flags */
+        while (0 != pkSpec[i] && nullptr != strchr("-+ #0", pkSpec[i])) {
+            ++i;
+        }
+
+        /* Width */
+        if ('*' == pkSpec[i]) {
+            ++pConv->starCount;
+            ++i;
+        }
+        while ('0' <= pkSpec[i] && '9' >= pkSpec[i]) {
+            ++i;
+        }
+
+        /* Precision */
+        if ('.' == pkSpec[i]) {
+            ++i;
+            if ('*' == pkSpec[i]) {
+                ++pConv->starCount;
+                ++i;
+            }
+            while ('0' <= pkSpec[i] && '9' >= pkSpec[i]) {
+                ++i;
+            }
+        }
+
+        /* Length modifier */
+        while (0 != pkSpec[i] && nullptr != strchr("hlLqjzt", pkSpec[i])) {
+            if ('l' == lengthMod && 'l' == pkSpec[i]) {
+                isLong = true;
+            }
+            lengthMod = pkSpec[i];
+            ++i;
+        }
+        if ('l' == lengthMod && !isLong) {
+            isLong = (8 == sizeof(long));
+        }
+        else if ('j' == lengthMod || 'q' == lengthMod) {
+            isLong = true;
+        }
+        else if ('z' == lengthMod || 't' == lengthMod) {
+            isLong = (8 == sizeof(size_t));
+        }
+
+        /* Conversion */
+        if (0 == pkSpec[i]) {
+            pConv->type = LOG_ARG_NONE;
+        }
+        else {
+            if (nullptr != strchr("diuoxXc", pkSpec[i])) {
+                pConv->type = isLong ? LOG_ARG_INT64 : LOG_ARG_INT32;
+            }
+            else if (nullptr != strchr("fFeEgGaA", pkSpec[i])) {
+                pConv->type = LOG_ARG_DOUBLE;
+            }
+            else if ('s' == pkSpec[i]) {
+                pConv->type = LOG_ARG_STR;
+            }
+            else if ('p' == pkSpec[i]) {
+                pConv->type = LOG_ARG_PTR;
+            }
+            else {
+                pConv->type = LOG_ARG_NONE;
+            }
+            ++i;
+        }
+    }
+
+    pConv->length = i;
+}
+
+static size_t EncodeRecord(uint8_t*         pBuffer,
+                           const E_LogLevel kLevel,
+                           const char*      pkFile,
+                           const uint32_t   kLine,
+                           const char*      pkStr,
+                           va_list          args) noexcept {
+    S_LogRecordHeader header;
+    S_LogConversion   conv;
+    const char*       pkCursor;
+    const char*       pkArgStr;
+    uint8_t*          pCursor;
+    uint8_t*          pLimit;
+    uint32_t          valueInt;
+    uint64_t          valueLong;
+    double            valueDouble;
+    void*             pValue;
+    size_t            strLen;
+    uint8_t           i;
+    bool              isFull;
+    uint16_t          size;
+
+    header.level     = (uint8_t)kLevel;
+    header.argCount  = 0;
+    header.line      = kLine;
+    header.sequence  = 0;
+    header.timestamp = HWManager::GetTime();
+    header.pkFile    = pkFile;
+    header.pkFormat  = pkStr;
+
+    pCursor = pBuffer + sizeof(S_LogRecordHeader);
+    pLimit = pBuffer + LOGGER_BUFFER_SIZE - sizeof(uint16_t);
+    isFull = false;
+
+    /* Copy the raw arguments */
+    pkCursor = pkStr;
+    while (0 != *pkCursor && !isFull) {
+        if ('%' != *pkCursor) {
+            ++pkCursor;
+        }
+        else {
+            ParseConversion(pkCursor, &conv);
+            pkCursor += conv.length;
+
+            /* Width and precision arguments */
+            for (i = 0; i < conv.starCount && !isFull; ++i) {
+                valueInt = (uint32_t)va_arg(args, int);
+                if (pCursor + 1 + sizeof(uint32_t) <= pLimit) {
+                    *pCursor++ = LOG_ARG_INT32;
+                    memcpy(pCursor, &valueInt, sizeof(uint32_t));
+                    pCursor += sizeof(uint32_t);
+                    ++header.argCount;
+                }
+                else {
+                    isFull = true;
+                }
+            }
+
+            if (isFull || LOG_ARG_NONE == conv.type ||
+                LOG_ARG_PERCENT == conv.type) {
+                /* Nothing to store */
+            }
+            else if (LOG_ARG_INT32 == conv.type) {
+                valueInt = va_arg(args, uint32_t);
+                isFull = pCursor + 1 + sizeof(uint32_t) > pLimit;
+                if (!isFull) {
+                    *pCursor++ = LOG_ARG_INT32;
+                    memcpy(pCursor, &valueInt, sizeof(uint32_t));
+                    pCursor += sizeof(uint32_t);
+                }
+            }
+            else if (LOG_ARG_INT64 == conv.type) {
+                valueLong = va_arg(args, uint64_t);
+                isFull = pCursor + 1 + sizeof(uint64_t) > pLimit;
+                if (!isFull) {
+                    *pCursor++ = LOG_ARG_INT64;
+                    memcpy(pCursor, &valueLong, sizeof(uint64_t));
+                    pCursor += sizeof(uint64_t);
+                }
+            }
+            else if (LOG_ARG_DOUBLE == conv.type) {
+                valueDouble = va_arg(args, double);
+                isFull = pCursor + 1 + sizeof(double) > pLimit;
+                if (!isFull) {
+                    *pCursor++ = LOG_ARG_DOUBLE;
+                    memcpy(pCursor, &valueDouble, sizeof(double));
+                    pCursor += sizeof(double);
+                }
+            }
+            else if (LOG_ARG_PTR == conv.type) {
+                pValue = va_arg(args, void*);
+                isFull = pCursor + 1 + sizeof(void*) > pLimit;
+                if (!isFull) {
+                    *pCursor++ = LOG_ARG_PTR;
+                    memcpy(pCursor, &pValue, sizeof(void*));
+                    pCursor += sizeof(void*);
+                }
+            }
+            else {
+                /* Strings are copied, their storage might not outlive the
+                 * record.
+                 */
+                pkArgStr = va_arg(args, const char*);
+                if (nullptr == pkArgStr) {
+                    pkArgStr = "(null)";
+                }
+                strLen = strnlen(pkArgStr, LOG_RECORD_STR_MAX - 1);
+                if (pCursor + 2 + strLen > pLimit) {
+                    strLen = pLimit - pCursor > 2 ? pLimit - pCursor - 2 : 0;
+                }
+                isFull = pCursor + 2 > pLimit;
+                if (!isFull) {
+                    *pCursor++ = LOG_ARG_STR;
+                    memcpy(pCursor, pkArgStr, strLen);
+                    pCursor += strLen;
+                    *pCursor++ = 0;
+                }
+            }
+
+            if (!isFull && LOG_ARG_NONE != conv.type &&
+                LOG_ARG_PERCENT != conv.type) {
+                ++header.argCount;
+            }
+        }
+    }
+
+    /* Set the size in the header and trailer */
+    size = (uint16_t)(pCursor - pBuffer + sizeof(uint16_t));
+    header.size = size;
+    memcpy(pBuffer, &header, sizeof(S_LogRecordHeader));
+    memcpy(pCursor, &size, sizeof(uint16_t));
+
+    return size;
+}
+
+static size_t EncodeRecordArgs(uint8_t*         pBuffer,
+                               const E_LogLevel kLevel,
+                               const char*      pkFile,
+                               const uint32_t   kLine,
+                               const char*      pkStr,
+                               ...) noexcept {
+    va_list argptr;
+    size_t  size;
+
+    va_start(argptr, pkStr);
+    size = EncodeRecord(pBuffer, kLevel, pkFile, kLine, pkStr, argptr);
+    va_end(argptr);
+
+    return size;
+}
+
+static size_t FormatRecord(const uint8_t* kpRecord,
+                           char*          pBuffer,
+                           const size_t   kSize) noexcept {
+    S_LogRecordHeader header;
+    S_LogConversion   conv;
+    const char*       pkCursor;
+    const uint8_t*    kpArg;
+    const uint8_t*    kpArgEnd;
+    char              pSpec[LOG_RECORD_SPEC_MAX];
+    char              pStar[12];
+    size_t            specLen;
+    size_t            len;
+    size_t            i;
+    int               written;
+    uint32_t          valueInt;
+    uint64_t          valueLong;
+    double            valueDouble;
+    void*             pValue;
+    bool              isValid;
+
+    memcpy(&header, kpRecord, sizeof(S_LogRecordHeader));
+    kpArg = kpRecord + sizeof(S_LogRecordHeader);
+    kpArgEnd = kpRecord + header.size - sizeof(uint16_t);
+
+    /* Print TAG */
+    if (LOG_LEVEL_CRITICAL == header.level) {
+        written = snprintf(pBuffer, kSize, "[CRIT  - %16llu] %s:%lu - ",
+                           (unsigned long long)header.timestamp,
+                           header.pkFile, (unsigned long)header.line);
+    }
+    else if (LOG_LEVEL_ERROR == header.level) {
+        written = snprintf(pBuffer, kSize, "[ERROR - %16llu] %s:%lu - ",
+                           (unsigned long long)header.timestamp,
+                           header.pkFile, (unsigned long)header.line);
+    }
+    else if (LOG_LEVEL_INFO == header.level) {
+        written = snprintf(pBuffer, kSize, "[INFO  - %16llu] ",
+                           (unsigned long long)header.timestamp);
+    }
+    else if (LOG_LEVEL_DEBUG == header.level) {
+        written = snprintf(pBuffer, kSize, "[DBG   - %16llu] %s:%lu - ",
+                           (unsigned long long)header.timestamp,
+                           header.pkFile, (unsigned long)header.line);
+    }
+    else {
+        written = snprintf(pBuffer, kSize, "[UNKN  - %16llu] %s:%lu - ",
+                           (unsigned long long)header.timestamp,
+                           header.pkFile, (unsigned long)header.line);
+    }
+    len = 0 < written ? (size_t)written : 0;
+    len = len < kSize - 1 ? len : kSize - 1;
+
+    /* Format the message */
+    pkCursor = header.pkFormat;
+    while (0 != *pkCursor && kSize - 1 > len) {
+        if ('%' != *pkCursor) {
+            pBuffer[len++] = *pkCursor++;
+        }
+        else if ('%' == pkCursor[1]) {
+            pBuffer[len++] = '%';
+            pkCursor += 2;
+        }
+        else {
+            ParseConversion(pkCursor, &conv);
+
+            /* Rebuild the specification with the stored star arguments */
+            specLen = 0;
+            isValid = (LOG_ARG_NONE != conv.type);
+            for (i = 0; i < conv.length && isValid; ++i) {
+                if ('*' == pkCursor[i]) {
+                    isValid = kpArg + 1 + sizeof(uint32_t) <= kpArgEnd &&
+                              LOG_ARG_INT32 == *kpArg;
+                    if (isValid) {
+                        memcpy(&valueInt, kpArg + 1, sizeof(uint32_t));
+                        kpArg += 1 + sizeof(uint32_t);
+                        written = snprintf(pStar, sizeof(pStar), "%ld",
+                                           (long)(int32_t)valueInt);
+                        isValid = 0 < written &&
+                                  specLen + written < LOG_RECORD_SPEC_MAX;
+                        if (isValid) {
+                            memcpy(pSpec + specLen, pStar, written);
+                            specLen += written;
+                        }
+                    }
+                }
+                else {
+                    isValid = specLen + 1 < LOG_RECORD_SPEC_MAX;
+                    if (isValid) {
+                        pSpec[specLen++] = pkCursor[i];
+                    }
+                }
+            }
+            pSpec[specLen] = 0;
+
+            /* Format the argument */
+            isValid = isValid && kpArg < kpArgEnd && conv.type == *kpArg;
+            written = 0;
+            if (!isValid) {
+                /* Missing argument, print the specification as is */
+                written = conv.length < kSize - 1 - len ?
+                          conv.length :
+                          kSize - 1 - len;
+                memcpy(pBuffer + len, pkCursor, written);
+            }
+            else if (LOG_ARG_INT32 == conv.type) {
+                memcpy(&valueInt, kpArg + 1, sizeof(uint32_t));
+                kpArg += 1 + sizeof(uint32_t);
+                written = snprintf(pBuffer + len, kSize - len, pSpec, valueInt);
+            }
+            else if (LOG_ARG_INT64 == conv.type) {
+                memcpy(&valueLong, kpArg + 1, sizeof(uint64_t));
+                kpArg += 1 + sizeof(uint64_t);
+                written = snprintf(pBuffer + len, kSize - len, pSpec, valueLong);
+            }
+            else if (LOG_ARG_DOUBLE == conv.type) {
+                memcpy(&valueDouble, kpArg + 1, sizeof(double));
+                kpArg += 1 + sizeof(double);
+                written = snprintf(
+                    pBuffer + len,
+                    kSize - len,
+                    pSpec,
+                    valueDouble
+                );
+            }
+            else if (LOG_ARG_PTR == conv.type) {
+                memcpy(&pValue, kpArg + 1, sizeof(void*));
+                kpArg += 1 + sizeof(void*);
+                written = snprintf(pBuffer + len, kSize - len, pSpec, pValue);
+            }
+            else {
+                written = snprintf(
+                    pBuffer + len,
+                    kSize - len,
+                    pSpec,
+                    (const char*)(kpArg + 1)
+                );
+                kpArg += 2 + strlen((const char*)(kpArg + 1));
+            }
+
+            if (0 < written) {
+                len += (size_t)written;
+                len = len < kSize - 1 ? len : kSize - 1;
+            }
+            pkCursor += conv.length;
+        }
+    }
+
+    /* Terminate */
+    pBuffer[len] = 0;
+
+    return len;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+Logger* Logger::GetInstance(void) noexcept {
+    if (nullptr == Logger::_SPINSTANCE) {
+        Logger::_SPINSTANCE = new Logger();
+
+        if (nullptr == Logger::_SPINSTANCE) {
+            Serial.begin(LOGGER_SERIAL_BAUDRATE);
+            HWManager::DelayExecNs(50000000);
+            Serial.printf("Failed to initialize logger.\n");
+            ESP.restart();
+        }
+    }
+
+    return Logger::_SPINSTANCE;
+}
+
+void Logger::LogLevel(const E_LogLevel  kLevel,
+                      const E_LogModule kModule,
+                      const char*       pkFile,
+                      const uint32_t    kLine,
+                      const char*       pkStr,
+                      ...) noexcept
+{
+    va_list      argptr;
+    size_t       len;
+    bool         isEnabled;
+    char         pContext[BOOT_RECORD_CONTEXT_SIZE];
+    const char*  pkName;
+#if LOGGER_ASYNC_ENABLED
+    S_LogRecord* pRecord;
+    uint32_t     position;
+#endif
+
+    /* Critical logs are never filtered */
+    isEnabled = (LOG_LEVEL_CRITICAL == kLevel);
+    if (!isEnabled && LOG_LEVEL >= kLevel && LOG_MODULE_MAX > kModule) {
+        isEnabled = (this->_moduleLevels[kModule].load(
+            std::memory_order_relaxed
+        ) >= kLevel);
+    }
+
+    /* Limit the call sites flooding the sinks */
+    if (isEnabled && LOG_LEVEL_CRITICAL != kLevel) {
+        isEnabled = IsRateAllowed(pkFile, kLine);
+    }
+
+    if (isEnabled) {
+#if LOGGER_ASYNC_ENABLED
+        /* Critical logs are written synchronously after the ring is drained */
+        if (LOG_LEVEL_CRITICAL != kLevel &&
+            nullptr != this->_writerTaskHandle) {
+            pRecord = ReserveRecord(position);
+            if (nullptr != pRecord) {
+                va_start(argptr, pkStr);
+                pRecord->length = EncodeRecord(
+                    pRecord->pData,
+                    kLevel,
+                    pkFile,
+                    kLine,
+                    pkStr,
+                    argptr
+                );
+                va_end(argptr);
+                PublishRecord(pRecord, position);
+            }
+            else {
+                /* The writer task reports the dropped logs */
+                this->_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        else {
+            Flush();
+#endif
+            va_start(argptr, pkStr);
+            len = EncodeRecord(
+                (uint8_t*)this->_logBuffer,
+                kLevel,
+                pkFile,
+                kLine,
+                pkStr,
+                argptr
+            );
+            va_end(argptr);
+            WriteSinks((const uint8_t*)this->_logBuffer, len);
+#if LOGGER_ASYNC_ENABLED
+        }
+#endif
+
+        /* On critical, record the error location and reboot */
+        if (LOG_LEVEL_CRITICAL == kLevel) {
+            pkName = strrchr(pkFile, '/');
+            pkName = (nullptr != pkName) ? pkName + 1 : pkFile;
+            snprintf(
+                pContext,
+                sizeof(pContext),
+                "%s:%lu",
+                pkName,
+                (unsigned long)kLine
+            );
+            BootRecord::SetResetCause(
+                E_ResetCause::RESET_CAUSE_CRITICAL,
+                pContext
+            );
+
+            /*
+             * The RTC cause forces the maintenance mode on the next boot, the
+             * NVS is not written as the failing task may hold the flash.
+             */
+            HWManager::Reboot(false);
+        }
+    }
+}
+
+void Logger::SetModuleLevel(const E_LogModule kModule,
+                            const E_LogLevel  kLevel) noexcept {
+    E_LogLevel level;
+
+    if (LOG_MODULE_MAX > kModule) {
+        /* Compiled out logs cannot be enabled */
+        level = kLevel;
+        if (LogModuleLevel(kModule) < level) {
+            level = LogModuleLevel(kModule);
+        }
+        this->_moduleLevels[kModule].store(
+            (uint8_t)level,
+            std::memory_order_relaxed
+        );
+    }
+}
+
+E_LogLevel Logger::GetModuleLevel(const E_LogModule kModule) const noexcept {
+    E_LogLevel level;
+
+    level = LOG_LEVEL_CRITICAL;
+    if (LOG_MODULE_MAX > kModule) {
+        level = (E_LogLevel)this->_moduleLevels[kModule].load(
+            std::memory_order_relaxed
+        );
+    }
+
+    return level;
+}
+
+void Logger::SetRateLimit(const bool kIsEnabled) noexcept {
+    this->_isRateLimited.store(kIsEnabled, std::memory_order_relaxed);
+}
+
+uint32_t Logger::GetRateLimitedCount(void) const noexcept {
+    return this->_rateLimitedCount.load(std::memory_order_relaxed);
+}
+
+uint32_t Logger::GetRepeatedCount(void) const noexcept {
+    return this->_repeatedCount.load(std::memory_order_relaxed);
+}
+
+const char* Logger::GetModuleName(const E_LogModule kModule) noexcept {
+    const char* pkName;
+
+    switch (kModule) {
+        case LOG_MODULE_BSP:
+            pkName = "BSP";
+            break;
+        case LOG_MODULE_CORE:
+            pkName = "Core";
+            break;
+        case LOG_MODULE_HM:
+            pkName = "Health Monitor";
+            break;
+        case LOG_MODULE_WEB:
+            pkName = "Web Server";
+            break;
+        case LOG_MODULE_API:
+            pkName = "API Server";
+            break;
+        case LOG_MODULE_DEFAULT:
+        default:
+            pkName = "Default";
+            break;
+    }
+
+    return pkName;
+}
+
+void Logger::Flush(void) noexcept {
+    /* Drain the logs and write the write-behind block */
+    RequestJournalAction(LOG_JOURNAL_REQ_FLUSH);
+
+    Serial.flush();
+}
+
+size_t Logger::GetPersistentJournalSize(void) const noexcept {
+    size_t  size;
+    uint8_t i;
+
+    size = 0;
+    for (i = 0; i < LOG_JOURNAL_SEGMENT_COUNT; ++i) {
+        size += GetJournalSegmentSize(i);
+    }
+
+    return size;
+}
+
+size_t Logger::ReadPersistentJournal(uint8_t*     pBuffer,
+                                     size_t       length,
+                                     const size_t kOffset) const noexcept {
+    Storage* pStorage;
+    FsFile   segment;
+    char     pPath[LOG_JOURNAL_PATH_SIZE];
+    size_t   total;
+    size_t   toCopy;
+    size_t   segSize;
+    size_t   segEnd;
+    size_t   segStart;
+    size_t   rangeStart;
+    size_t   rangeEnd;
+    uint8_t  segId;
+    uint8_t  i;
+    bool     success;
+
+    pStorage = GetJournalStorage();
+    total = GetPersistentJournalSize();
+
+    if (nullptr != pStorage && kOffset < total &&
+        E_Return::NO_ERROR ==
+        pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        toCopy = total - kOffset;
+        toCopy = toCopy < length ? toCopy : length;
+
+        /* Offsets are expressed from the end of the journal: walk the
+         * segments from the newest to the oldest.
+         */
+        success = true;
+        segEnd = 0;
+        for (i = 0; i < LOG_JOURNAL_SEGMENT_COUNT && success; ++i) {
+            segId = (this->_journalSegment + LOG_JOURNAL_SEGMENT_COUNT - i) %
+                    LOG_JOURNAL_SEGMENT_COUNT;
+            segSize = GetJournalSegmentSize(segId);
+            segStart = segEnd + segSize;
+
+            /* Get the part of the request stored in this segment */
+            rangeStart = kOffset > segEnd ? kOffset : segEnd;
+            rangeEnd = kOffset + toCopy < segStart ? kOffset + toCopy : segStart;
+            if (rangeStart < rangeEnd) {
+                GetJournalSegmentPath(segId, pPath);
+                segment = pStorage->Open(pPath, O_RDONLY);
+                success = segment.isOpen() &&
+                          ReadJournalSegment(
+                              segment,
+                              segId,
+                              segSize - rangeEnd + segEnd,
+                              pBuffer + kOffset + toCopy - rangeEnd,
+                              rangeEnd - rangeStart
+                          );
+                segment.close();
+            }
+
+            segEnd = segStart;
+        }
+
+        if (!success) {
+            toCopy = 0;
+        }
+
+        pStorage->ReleaseSPIBus();
+    }
+    else {
+        toCopy = 0;
+    }
+
+    return toCopy;
+}
+
+size_t Logger::FindPersistentJournalOffset(const uint64_t kTime,
+                                           const bool     kIsEnd)
+const noexcept {
+    Storage*               pStorage;
+    FsFile                 pIndexes[LOG_JOURNAL_SEGMENT_COUNT];
+    uint32_t               pCounts[LOG_JOURNAL_SEGMENT_COUNT];
+    uint8_t                pSegIds[LOG_JOURNAL_SEGMENT_COUNT];
+    char                   pPath[LOG_JOURNAL_PATH_SIZE];
+    S_LogJournalIndexEntry entry;
+    uint32_t               total;
+    uint32_t               low;
+    uint32_t               high;
+    uint32_t               middle;
+    size_t                 offset;
+    size_t                 segSize;
+    uint8_t                position;
+    uint8_t                i;
+    bool                   isFound;
+
+    /* Without index, the range covers the whole journal */
+    if (kIsEnd) {
+        offset = 0;
+    }
+    else {
+        offset = GetPersistentJournalSize();
+    }
+
+    pStorage = GetJournalStorage();
+    if (nullptr != pStorage &&
+        E_Return::NO_ERROR ==
+        pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        /* Open the indexes from the oldest segment to the newest */
+        total = 0;
+        for (i = 0; LOG_JOURNAL_SEGMENT_COUNT > i; ++i) {
+            pSegIds[i] = (this->_journalSegment + 1 + i) %
+                         LOG_JOURNAL_SEGMENT_COUNT;
+            GetJournalTimeIndexPath(pSegIds[i], pPath);
+            pIndexes[i] = pStorage->Open(pPath, O_RDONLY);
+            pCounts[i] = 0;
+            if (pIndexes[i].isOpen()) {
+                pCounts[i] = pIndexes[i].size() /
+                             sizeof(S_LogJournalIndexEntry);
+            }
+            total += pCounts[i];
+        }
+
+        /* Count the entries at or before the time, the journal time is
+         * monotonic.
+         */
+        low  = 0;
+        high = total;
+        while (low < high) {
+            middle = low + (high - low) / 2;
+            if (ReadJournalTimeEntry(pIndexes, pCounts, middle, &entry,
+                                     &position) &&
+                entry.time <= kTime) {
+                low = middle + 1;
+            }
+            else {
+                high = middle;
+            }
+        }
+
+        /* The range starts at the last block before the time and ends at the
+         * first block after it.
+         */
+        if (kIsEnd) {
+            isFound = (low < total);
+        }
+        else {
+            isFound = (0 < low);
+            --low;
+        }
+        if (isFound &&
+            ReadJournalTimeEntry(pIndexes, pCounts, low, &entry, &position)) {
+            /* Offsets are expressed from the end of the journal */
+            offset = 0;
+            for (i = position + 1; LOG_JOURNAL_SEGMENT_COUNT > i; ++i) {
+                offset += GetJournalSegmentSize(pSegIds[i]);
+            }
+            segSize = GetJournalSegmentSize(pSegIds[position]);
+            if (entry.offset < segSize) {
+                offset += segSize - entry.offset;
+            }
+        }
+
+        for (i = 0; LOG_JOURNAL_SEGMENT_COUNT > i; ++i) {
+            if (pIndexes[i].isOpen()) {
+                pIndexes[i].close();
+            }
+        }
+
+        pStorage->ReleaseSPIBus();
+    }
+
+    return offset;
+}
+
+uint64_t Logger::GetJournalTime(void) const noexcept {
+    return this->_journalTimeBase + HWManager::GetTime();
+}
+
+void Logger::ClearPersistentJournal(void) noexcept {
+    /* Drain the logs and remove the segments */
+    RequestJournalAction(LOG_JOURNAL_REQ_FLUSH | LOG_JOURNAL_REQ_CLEAR);
+}
+
+void Logger::OpenRamJournal(S_RamJournalDescriptor* pDesc) const noexcept {
+    pDesc->sequence = 0;
+
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        pDesc->sequence = this->_logJournalRam.sequence;
+
+        xSemaphoreGive(this->_ramJournalLock);
+    }
+}
+
+size_t Logger::ReadRamJournal(uint8_t*                pBuffer,
+                              size_t                  length,
+                              S_RamJournalDescriptor* pDesc) const noexcept {
+    size_t   position;
+    size_t   recordEnd;
+    size_t   textLen;
+    uint32_t sequence;
+    uint16_t recordSize;
+    bool     isDone;
+
+    position = length;
+    sequence = pDesc->sequence;
+
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        /* The logs older than an overwritten log are gone as well */
+        if ((uint32_t)(sequence - this->_logJournalRam.oldestSequence) >
+            (uint32_t)(this->_logJournalRam.sequence -
+                       this->_logJournalRam.oldestSequence)) {
+            sequence = this->_logJournalRam.oldestSequence;
+        }
+        recordEnd = FindRamJournalRecord(sequence);
+
+        /* Walk the records backward, format and place them from the end of
+         * the buffer.
+         */
+        isDone = false;
+        while (!isDone && 0 < position &&
+               this->_logJournalRam.oldestSequence != sequence) {
+            CopyRamJournal(
+                (uint8_t*)&recordSize,
+                this->_logJournalRam.written - recordEnd,
+                sizeof(uint16_t)
+            );
+            CopyRamJournal(
+                this->_pReadRecord,
+                this->_logJournalRam.written - recordEnd,
+                recordSize
+            );
+            textLen = FormatRecord(
+                this->_pReadRecord,
+                this->_pReadText,
+                LOGGER_BUFFER_SIZE
+            );
+
+            if (textLen <= position) {
+                position -= textLen;
+                memcpy(pBuffer + position, this->_pReadText, textLen);
+                recordEnd -= recordSize;
+                --sequence;
+            }
+            else {
+                /* Always make progress with the first record */
+                if (position == length) {
+                    memcpy(pBuffer, this->_pReadText, position);
+                    position = 0;
+                    recordEnd -= recordSize;
+                    --sequence;
+                }
+                isDone = true;
+            }
+        }
+
+        xSemaphoreGive(this->_ramJournalLock);
+    }
+
+    /* Move the logs to the start of the buffer */
+    memmove(pBuffer, pBuffer + position, length - position);
+
+    pDesc->sequence = sequence;
+
+    return length - position;
+}
+
+void Logger::SeekRamJournal(S_RamJournalDescriptor* pDesc,
+                            const uint32_t          kSequence) const noexcept {
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        /* Out of the journal, no older log remains */
+        if ((uint32_t)(kSequence - this->_logJournalRam.oldestSequence) <=
+            (uint32_t)(this->_logJournalRam.sequence -
+                       this->_logJournalRam.oldestSequence)) {
+            pDesc->sequence = kSequence;
+        }
+        else {
+            pDesc->sequence = this->_logJournalRam.oldestSequence;
+        }
+
+        xSemaphoreGive(this->_ramJournalLock);
+    }
+}
+
+void Logger::ClearRamJournal(void) noexcept {
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        /* Resets the RAM logs, the positions and sequences keep going */
+        this->_logJournalRam.oldest         = this->_logJournalRam.written;
+        this->_logJournalRam.oldestSequence = this->_logJournalRam.sequence;
+
+        xSemaphoreGive(this->_ramJournalLock);
+    }
+}
+
+void Logger::OpenRamJournalStream(S_RamJournalStream* pStream)
+const noexcept {
+    pStream->position = 0;
+    pStream->sequence = 0;
+    pStream->lost     = 0;
+
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        pStream->position = this->_logJournalRam.oldest;
+        pStream->sequence = this->_logJournalRam.oldestSequence;
+
+        xSemaphoreGive(this->_ramJournalLock);
+    }
+}
+
+void Logger::OpenRamJournalTail(S_RamJournalStream* pStream)
+const noexcept {
+    pStream->position = 0;
+    pStream->sequence = 0;
+    pStream->lost     = 0;
+
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        pStream->position = this->_logJournalRam.written;
+        pStream->sequence = this->_logJournalRam.sequence;
+
+        xSemaphoreGive(this->_ramJournalLock);
+    }
+}
+
+void Logger::SeekRamJournalStream(S_RamJournalStream* pStream,
+                                  const uint32_t      kSequence)
+const noexcept {
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        pStream->lost = 0;
+        if (0 > (int32_t)(kSequence - this->_logJournalRam.oldestSequence)) {
+            /* The log was overwritten, resume at the oldest */
+            pStream->lost     = this->_logJournalRam.oldestSequence -
+                                kSequence;
+            pStream->position = this->_logJournalRam.oldest;
+            pStream->sequence = this->_logJournalRam.oldestSequence;
+        }
+        else if (0 > (int32_t)(this->_logJournalRam.sequence - kSequence)) {
+            /* Not written yet, only the new logs are read */
+            pStream->position = this->_logJournalRam.written;
+            pStream->sequence = this->_logJournalRam.sequence;
+        }
+        else {
+            pStream->position = FindRamJournalRecord(kSequence);
+            pStream->sequence = kSequence;
+        }
+
+        xSemaphoreGive(this->_ramJournalLock);
+    }
+}
+
+size_t Logger::ReadRamJournalStream(uint8_t*            pBuffer,
+                                    size_t              length,
+                                    S_RamJournalStream* pStream)
+const noexcept {
+    size_t   filled;
+    size_t   textLen;
+    uint16_t recordSize;
+    bool     isDone;
+
+    filled = 0;
+
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        /* The positions are stable accross the new logs */
+        if (0 > (int32_t)(pStream->sequence -
+                          this->_logJournalRam.oldestSequence)) {
+            /* Overtaken by the writer or cleared, resume at the oldest */
+            pStream->lost     += this->_logJournalRam.oldestSequence -
+                                 pStream->sequence;
+            pStream->position  = this->_logJournalRam.oldest;
+            pStream->sequence  = this->_logJournalRam.oldestSequence;
+        }
+
+        /* Walk the records forward, from their header size */
+        isDone = false;
+        while (!isDone && filled < length &&
+               this->_logJournalRam.sequence != pStream->sequence) {
+            recordSize = GetRamJournalRecordSize(pStream->position);
+            CopyRamJournal(
+                this->_pReadRecord,
+                this->_logJournalRam.written - pStream->position - recordSize,
+                recordSize
+            );
+            textLen = FormatRecord(
+                this->_pReadRecord,
+                this->_pReadText,
+                LOGGER_BUFFER_SIZE
+            );
+
+            if (textLen <= length - filled) {
+                memcpy(pBuffer + filled, this->_pReadText, textLen);
+                filled            += textLen;
+                pStream->position += recordSize;
+                ++pStream->sequence;
+            }
+            else {
+                /* Always make progress with the first record */
+                if (0 == filled) {
+                    memcpy(pBuffer, this->_pReadText, length);
+                    filled             = length;
+                    pStream->position += recordSize;
+                    ++pStream->sequence;
+                }
+                isDone = true;
+            }
+        }
+
+        xSemaphoreGive(this->_ramJournalLock);
+    }
+
+    return filled;
+}
+
+uint16_t Logger::GetRamJournalRecordSize(const size_t kPosition)
+const noexcept {
+    uint16_t recordSize;
+
+    /* The size leads the record header */
+    CopyRamJournal(
+        (uint8_t*)&recordSize,
+        this->_logJournalRam.written - kPosition - sizeof(uint16_t),
+        sizeof(uint16_t)
+    );
+
+    return recordSize;
+}
+
+size_t Logger::FindRamJournalRecord(const uint32_t kSequence) const noexcept {
+    size_t   position;
+    uint32_t current;
+    uint32_t base;
+
+    base = kSequence - kSequence % LOG_RAM_INDEX_STRIDE;
+    if (this->_logJournalRam.sequence == kSequence) {
+        /* The next record is not indexed yet */
+        current  = kSequence;
+        position = this->_logJournalRam.written;
+    }
+    else if ((uint32_t)(kSequence - this->_logJournalRam.oldestSequence) >=
+             kSequence - base) {
+        /* The indexed record is still in the journal */
+        current  = base;
+        position = this->_logJournalRam.pIndex[
+            (base / LOG_RAM_INDEX_STRIDE) % LOG_RAM_INDEX_SIZE
+        ];
+    }
+    else {
+        current  = this->_logJournalRam.oldestSequence;
+        position = this->_logJournalRam.oldest;
+    }
+
+    while (kSequence != current) {
+        position += GetRamJournalRecordSize(position);
+        ++current;
+    }
+
+    return position;
+}
+
+void Logger::CopyRamJournal(uint8_t*     pBuffer,
+                            const size_t kBackOffset,
+                            const size_t kLen) const noexcept {
+    size_t ringSize;
+    size_t start;
+    size_t toCopy;
+
+    ringSize = this->_logJournalRam.pEndAddress -
+               this->_logJournalRam.pStartAddress;
+
+    /* Get the start of the region in the ring */
+    start = this->_logJournalRam.pCursor - this->_logJournalRam.pStartAddress;
+    start = (start + ringSize - ((kBackOffset + kLen) % ringSize)) % ringSize;
+
+    /* Copy with rollover */
+    toCopy = ringSize - start;
+    toCopy = toCopy < kLen ? toCopy : kLen;
+    memcpy(pBuffer, this->_logJournalRam.pStartAddress + start, toCopy);
+    if (toCopy < kLen) {
+        memcpy(
+            pBuffer + toCopy,
+            this->_logJournalRam.pStartAddress,
+            kLen - toCopy
+        );
+    }
+}
+
+void Logger::WriteSinks(const uint8_t* kpRecord, const size_t kLen) noexcept {
+    size_t timeStart;
+    size_t timeEnd;
+    bool   isRepeat;
+
+    /* The records of a repeated log only differ by their timestamp */
+    timeStart = offsetof(S_LogRecordHeader, timestamp);
+    timeEnd   = timeStart + sizeof(uint64_t);
+    isRepeat  = kLen == this->_lastRecordLen &&
+                timeEnd <= kLen &&
+                0 == memcmp(kpRecord, this->_pLastRecord, timeStart) &&
+                0 == memcmp(
+                    kpRecord + timeEnd,
+                    this->_pLastRecord + timeEnd,
+                    kLen - timeEnd
+                );
+
+    if (isRepeat) {
+        if (0 == this->_repeatCount) {
+            this->_repeatStart = HWManager::GetTime();
+        }
+        ++this->_repeatCount;
+        this->_repeatedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    else {
+        if (0 != this->_repeatCount) {
+            ReportRepeats();
+        }
+        OutputRecord(kpRecord, kLen);
+
+        /* Longer records are never collapsed */
+        this->_lastRecordLen = 0;
+        if (LOGGER_BUFFER_SIZE >= kLen) {
+            memcpy(this->_pLastRecord, kpRecord, kLen);
+            this->_lastRecordLen = kLen;
+        }
+    }
+
+    ReportSuppressed();
+}
+
+void Logger::OutputRecord(const uint8_t* kpRecord, const size_t kLen)
+noexcept {
+    size_t len;
+
+    /* The counters follow the log levels */
+    Metrics::Add(
+        (E_MetricCounter)(METRIC_LOG_CRITICAL +
+                          kpRecord[offsetof(S_LogRecordHeader, level)]),
+        1
+    );
+
+    /* Format for the text sinks */
+    len = FormatRecord(kpRecord, this->_pFormatBuffer, LOGGER_BUFFER_SIZE);
+    TRACE_BEGIN(E_TraceEvent::TRACE_LOG_SERIAL);
+    Serial.write((const uint8_t*)this->_pFormatBuffer, len);
+    TRACE_END(E_TraceEvent::TRACE_LOG_SERIAL);
+
+    /* Log to journal */
+    TRACE_BEGIN(E_TraceEvent::TRACE_LOG_RAM);
+    WriteRamJournal(kpRecord, kLen);
+    TRACE_END(E_TraceEvent::TRACE_LOG_RAM);
+    TRACE_BEGIN(E_TraceEvent::TRACE_LOG_JOURNAL);
+    WritePersistentJournal(this->_pFormatBuffer, len);
+    TRACE_END(E_TraceEvent::TRACE_LOG_JOURNAL);
+}
+
+bool Logger::IsRateAllowed(const char* kpFile, const uint32_t kLine) noexcept {
+    S_LogRateSite* pSite;
+    uint64_t       now;
+    uint64_t       earned;
+    uint32_t       index;
+    bool           isAllowed;
+
+    isAllowed = true;
+    if (this->_isRateLimited.load(std::memory_order_relaxed)) {
+        index = ((uint32_t)(uintptr_t)kpFile ^ kLine) * LOGGER_RATE_HASH_PRIME;
+        pSite = &this->_pRateSites[(index >> 16) % LOGGER_RATE_SITES];
+        now   = HWManager::GetTime();
+
+        HAL::EnterCritical(this->_rateLock);
+
+        /* Earn the logs back since the last earned log */
+        earned = (now - pSite->refillTime) / LOGGER_RATE_PERIOD_NS;
+        if (LOGGER_RATE_BURST <= pSite->tokens + earned) {
+            pSite->tokens     = LOGGER_RATE_BURST;
+            pSite->refillTime = now;
+        }
+        else {
+            pSite->tokens     += earned;
+            pSite->refillTime += earned * LOGGER_RATE_PERIOD_NS;
+        }
+
+        if (kpFile != pSite->pkFile || kLine != pSite->line) {
+            /* Take the slot of a quiet call site only */
+            if (0 == pSite->suppressed &&
+                LOGGER_RATE_BURST == pSite->tokens) {
+                pSite->pkFile = kpFile;
+                pSite->line   = kLine;
+                --pSite->tokens;
+            }
+        }
+        else if (0 != pSite->tokens) {
+            --pSite->tokens;
+        }
+        else {
+            ++pSite->suppressed;
+            isAllowed = false;
+        }
+
+        HAL::ExitCritical(this->_rateLock);
+
+        if (!isAllowed) {
+            this->_rateLimitedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    return isAllowed;
+}
+
+void Logger::ReportSuppressed(void) noexcept {
+    const char* pkName;
+    const char* pkFile;
+    uint64_t    now;
+    uint32_t    suppressed;
+    uint32_t    line;
+    size_t      len;
+    uint8_t     i;
+
+    now = HWManager::GetTime();
+    if (0 != this->_repeatCount &&
+        LOGGER_REPEAT_REPORT_NS <= now - this->_repeatStart) {
+        ReportRepeats();
+    }
+
+    if (LOGGER_RATE_REPORT_NS <= now - this->_lastRateReport) {
+        this->_lastRateReport = now;
+        for (i = 0; LOGGER_RATE_SITES > i; ++i) {
+            HAL::EnterCritical(this->_rateLock);
+            pkFile     = this->_pRateSites[i].pkFile;
+            line       = this->_pRateSites[i].line;
+            suppressed = this->_pRateSites[i].suppressed;
+            this->_pRateSites[i].suppressed = 0;
+            HAL::ExitCritical(this->_rateLock);
+
+            if (0 != suppressed) {
+                pkName = strrchr(pkFile, '/');
+                pkName = (nullptr != pkName) ? pkName + 1 : pkFile;
+                len = EncodeRecordArgs(
+                    this->_pReportRecord,
+                    LOG_LEVEL_INFO,
+                    __FILE__,
+                    __LINE__,
+                    "Rate limited %s:%lu, suppressed %lu logs.\n",
+                    pkName,
+                    (unsigned long)line,
+                    (unsigned long)suppressed
+                );
+                OutputRecord(this->_pReportRecord, len);
+            }
+        }
+    }
+}
+
+void Logger::ReportRepeats(void) noexcept {
+    S_LogRecordHeader header;
+    size_t            len;
+
+    /* Report at the call site of the repeated log */
+    memcpy(&header, this->_pLastRecord, sizeof(S_LogRecordHeader));
+    len = EncodeRecordArgs(
+        this->_pReportRecord,
+        (E_LogLevel)header.level,
+        header.pkFile,
+        header.line,
+        "Last message repeated %lu times.\n",
+        (unsigned long)this->_repeatCount
+    );
+    OutputRecord(this->_pReportRecord, len);
+
+    /* The next repetition is written again */
+    this->_repeatCount   = 0;
+    this->_lastRecordLen = 0;
+}
+
+#if LOGGER_ASYNC_ENABLED
+S_LogRecord* Logger::ReserveRecord(uint32_t& rPosition) noexcept {
+    S_LogRecord* pRecord;
+    uint32_t     position;
+    uint32_t     sequence;
+    int32_t      diff;
+
+    pRecord = nullptr;
+    position = this->_ringHead.load(std::memory_order_relaxed);
+    while (nullptr == pRecord) {
+        sequence = this->_pRing[position & LOGGER_ASYNC_RING_MASK].sequence.load(
+            std::memory_order_acquire
+        );
+        diff = (int32_t)sequence - (int32_t)position;
+        if (0 == diff) {
+            /* The record is free, try to claim it */
+            if (this->_ringHead.compare_exchange_weak(
+                    position,
+                    position + 1,
+                    std::memory_order_relaxed)) {
+                pRecord = &this->_pRing[position & LOGGER_ASYNC_RING_MASK];
+                rPosition = position;
+            }
+        }
+        else if (0 > diff) {
+            /* The ring is full */
+            break;
+        }
+        else {
+            /* Another producer claimed the record, retry */
+            position = this->_ringHead.load(std::memory_order_relaxed);
+        }
+    }
+
+    return pRecord;
+}
+
+void Logger::PublishRecord(S_LogRecord* pRecord, const uint32_t kPosition)
+noexcept {
+    pRecord->sequence.store(kPosition + 1, std::memory_order_release);
+    xTaskNotifyGive(this->_writerTaskHandle);
+}
 
-/** @brief Log file path. */
-#define LOG_JOURNAL_PATH "rthr_logs"
+void Logger::DrainRing(void) noexcept {
+    S_LogRecord* pRecord;
+    uint32_t     tail;
+    uint32_t     dropped;
+    size_t       len;
+    uint8_t      pDropLog[LOGGER_BUFFER_SIZE];
 
-/** @brief Ram log buffer size. */
-#define LOG_RAM_BUFFER_SIZE 0x200000
+    tail = this->_ringTail.load(std::memory_order_relaxed);
+    pRecord = &this->_pRing[tail & LOGGER_ASYNC_RING_MASK];
+    while (tail + 1 == pRecord->sequence.load(std::memory_order_acquire)) {
+        WriteSinks(pRecord->pData, pRecord->length);
 
-/*******************************************************************************
- * MACROS
- ******************************************************************************/
+        /* Release the record for the next round */
+        pRecord->sequence.store(
+            tail + LOGGER_ASYNC_RING_SIZE,
+            std::memory_order_release
+        );
+        ++tail;
+        this->_ringTail.store(tail, std::memory_order_release);
+        pRecord = &this->_pRing[tail & LOGGER_ASYNC_RING_MASK];
+    }
 
-/* None */
+    /* Report dropped logs */
+    dropped = this->_droppedCount.exchange(0, std::memory_order_relaxed);
+    if (0 != dropped) {
+        len = EncodeRecordArgs(
+            pDropLog,
+            LOG_LEVEL_ERROR,
+            __FILE__,
+            __LINE__,
+            "Logger ring full, dropped %lu logs.\n",
+            (unsigned long)dropped
+        );
+        WriteSinks(pDropLog, len);
+    }
 
-/*******************************************************************************
- * STRUCTURES AND TYPES
- ******************************************************************************/
+    /* Report the suppressed logs when the logs stop */
+    ReportSuppressed();
+}
 
-/* None */
+void Logger::WriterTaskRoutine(void* pLogger) noexcept {
+    Logger*  pLog;
+    uint32_t request;
 
-/*******************************************************************************
- * GLOBAL VARIABLES
- ******************************************************************************/
+    pLog = (Logger*)pLogger;
 
-/************************* Imported global variables **************************/
-/* None */
+    while (true) {
+        /* Wait for published records */
+        ulTaskNotifyTake(pdTRUE, LOGGER_TASK_WAIT_TICKS);
+        pLog->DrainRing();
 
-/************************* Exported global variables **************************/
-/* None */
+        /* Execute the journal requests, then release the requesters */
+        request = pLog->_journalRequest.load(std::memory_order_acquire);
+        if (0 != request) {
+            pLog->ExecuteJournalAction(request);
+            pLog->_journalRequest.fetch_and(
+                ~request,
+                std::memory_order_release
+            );
+        }
+        else if (pLog->IsJournalPending() &&
+                 LOG_JOURNAL_FLUSH_PERIOD_NS <
+                 HWManager::GetTickTime() - pLog->_lastJournalFlush) {
+            pLog->FlushPersistentJournal(true);
+        }
+    }
+}
+#endif
 
-/************************** Static global variables ***************************/
-/** @brief Singleton instance. */
-Logger* Logger::_SPINSTANCE = nullptr;
+void Logger::WritePersistentJournal(const char* kpStr, size_t len)
+noexcept {
+    size_t limit;
+    size_t toCopy;
 
-/*******************************************************************************
- * STATIC FUNCTIONS DECLARATIONS
- ******************************************************************************/
+    while (0 < len) {
+        /* Blocks always end on a sector boundary of the segment */
+        limit = LOG_JOURNAL_BLOCK_SIZE -
+                (this->_journalSegmentSize % LOG_JOURNAL_BLOCK_SIZE);
+        toCopy = limit - this->_journalBlockLen;
+        toCopy = toCopy < len ? toCopy : len;
 
-/* None */
+        if (0 == this->_journalBlockLen) {
+            this->_journalBlockTime = HWManager::GetTime();
+        }
+        memcpy(this->_pJournalBlock + this->_journalBlockLen, kpStr, toCopy);
+        this->_journalBlockLen += toCopy;
+        kpStr += toCopy;
+        len -= toCopy;
 
-/*******************************************************************************
- * FUNCTIONS
- ******************************************************************************/
-/* None */
+        if (limit == this->_journalBlockLen) {
+            FlushPersistentJournal(false);
+        }
+    }
 
-/*******************************************************************************
- * CLASS METHODS
- ******************************************************************************/
-Logger* Logger::GetInstance(void) noexcept {
-    if (nullptr == Logger::_SPINSTANCE) {
-        Logger::_SPINSTANCE = new Logger();
+    /* Do not retain the logs for too long, a tick resolution is enough */
+    if (IsJournalPending() &&
+        LOG_JOURNAL_FLUSH_PERIOD_NS <
+        HWManager::GetTickTime() - this->_lastJournalFlush) {
+        FlushPersistentJournal(true);
+    }
+}
 
-        HWManager::DelayExecNs(50000000);
+void Logger::FlushPersistentJournal(const bool kSync) noexcept {
+    Storage* pStorage;
+#if !LOG_JOURNAL_COMPRESSED
+    size_t   written;
+#endif
+    bool     isFull;
+    bool     isAcquired;
 
-        if (nullptr == Logger::_SPINSTANCE) {
-            Serial.begin(LOGGER_SERIAL_BAUDRATE);
-            HWManager::DelayExecNs(50000000);
-            Serial.printf("Failed to initialize logger.\n");
-            ESP.restart();
+    pStorage = GetJournalStorage();
+    isAcquired = (nullptr != pStorage &&
+                  E_Return::NO_ERROR ==
+                  pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS));
+
+    if (0 != this->_journalBlockLen) {
+        if (isAcquired && OpenJournalSegment()) {
+            /* Rotate full segments */
+#if LOG_JOURNAL_COMPRESSED
+            /* A block seals at most one frame, keep a slot for it */
+            isFull = LOG_JOURNAL_SEGMENT_SIZE <
+                     (this->_journalSlot + 2) * LOG_JOURNAL_FRAME_SIZE;
+#else
+            isFull = LOG_JOURNAL_SEGMENT_SIZE <= this->_journalSegmentSize;
+#endif
+            if (isFull) {
+                RotateJournalSegment();
+            }
+
+            if (this->_logfile.isOpen()) {
+                /* Index the blocks crossing the index stride */
+                if (this->_journalIndexNext <= this->_journalSegmentSize) {
+                    WriteJournalTimeIndex();
+                }
+
+#if LOG_JOURNAL_COMPRESSED
+                WriteJournalFrames(
+                    this->_pJournalBlock,
+                    this->_journalBlockLen,
+                    kSync
+                );
+#else
+                written = this->_logfile.write(
+                    this->_pJournalBlock,
+                    this->_journalBlockLen
+                );
+                this->_journalSegmentSize += written;
+                Metrics::Add(METRIC_SD_LOGGER_BYTES, (uint32_t)written);
+#endif
+                if (kSync) {
+                    this->_logfile.sync();
+                }
+            }
         }
+
+        /* On error the block is dropped, the logs cannot be kept forever */
+        this->_journalBlockLen = 0;
+    }
+    else if (isAcquired && kSync && this->_logfile.isOpen()) {
+#if LOG_JOURNAL_COMPRESSED
+        /* Write the logs kept in the open frame */
+        WriteJournalFrames(nullptr, 0, true);
+#endif
+        this->_logfile.sync();
     }
 
-    return Logger::_SPINSTANCE;
+    if (isAcquired) {
+        pStorage->ReleaseSPIBus();
+    }
+
+    this->_lastJournalFlush = HWManager::GetTime();
 }
 
-void Logger::LogLevel(const E_LogLevel kLevel,
-                      const char*      pkFile,
-                      const uint32_t   kLine,
-                      const char*      pkStr,
-                      ...) noexcept
-{
-    va_list      argptr;
-    size_t       len;
-    char         pTag[32];
-    SystemState* pSysState;
-    ModeManager* pModeMgr;
+bool Logger::IsJournalPending(void) const noexcept {
+#if LOG_JOURNAL_COMPRESSED
+    return 0 != this->_journalBlockLen || this->_isJournalFrameDirty;
+#else
+    return 0 != this->_journalBlockLen;
+#endif
+}
 
-    if (LOG_LEVEL >= kLevel) {
-        /* Print TAG */
-        if (LOG_LEVEL_CRITICAL == kLevel) {
-            memcpy(pTag, "[CRIT  - %16llu] %s:%d -\0", 26);
-        }
-        else if (LOG_LEVEL_ERROR == kLevel) {
-            memcpy(pTag, "[ERROR - %16llu] %s:%d -\0", 26);
-        }
-        else if (LOG_LEVEL_INFO == kLevel) {
-            memcpy(pTag, "[INFO  - %16llu]\0", 17);
-        }
-        else if (LOG_LEVEL_DEBUG == kLevel) {
-            memcpy(pTag, "[DBG   - %16llu] %s:%d -\0", 26);
-        }
-        else {
-            memcpy(pTag, "[UNKN  - %16llu] %s:%d -\0", 26);
-        }
+bool Logger::OpenJournalSegment(void) noexcept {
+    Storage*          pStorage;
+    FsFile            index;
+    char              pPath[LOG_JOURNAL_PATH_SIZE];
+    uint8_t           pIndex[LOG_JOURNAL_INDEX_SIZE];
+    size_t            blockLen;
+    int               length;
+#if LOG_JOURNAL_COMPRESSED
+    S_LogJournalFrame header;
+    uint32_t          slot;
+#endif
+    bool              isFormatValid;
 
-        /* Setup message */
-        len = snprintf(
-            this->_logBuffer,
-            LOGGER_BUFFER_SIZE,
-            pTag,
-            HWManager::GetTime(),
-            pkFile,
-            kLine
-        );
-        this->_logBuffer[len++] = ' ';
-
-        /* Add message formating */
-        va_start(argptr, pkStr);
-        len += vsnprintf(
-            this->_logBuffer + len,
-            LOGGER_BUFFER_SIZE - len,
-            pkStr,
-            argptr
-        );
-        va_end(argptr);
+    if (!this->_logfile.isOpen()) {
+        pStorage = GetJournalStorage();
+        if (nullptr != pStorage) {
+            /* Get the active segment and the journal format, the first
+             * versions only saved the segment of a raw journal.
+             */
+            pIndex[0] = 0;
+            pIndex[1] = LOG_JOURNAL_FORMAT_RAW;
+            isFormatValid = (LOG_JOURNAL_FORMAT_RAW == LOG_JOURNAL_FORMAT);
+            index = pStorage->Open(LOG_JOURNAL_INDEX_PATH, O_RDONLY);
+            if (index.isOpen()) {
+                length = index.read(pIndex, LOG_JOURNAL_INDEX_SIZE);
+                if (1 > length || LOG_JOURNAL_SEGMENT_COUNT <= pIndex[0]) {
+                    pIndex[0] = 0;
+                }
+                isFormatValid = (LOG_JOURNAL_FORMAT == pIndex[1]);
+                index.close();
+            }
+            this->_journalSegment = pIndex[0];
 
-        /* Terminate and print */
-        this->_logBuffer[len] = 0;
-        Serial.printf("%s", this->_logBuffer);
+            /* The segments of another format cannot be read, keep the block
+             * being flushed.
+             */
+            if (!isFormatValid) {
+                blockLen = this->_journalBlockLen;
+                RemoveJournalSegments();
+                this->_journalBlockLen = blockLen;
+                WriteJournalIndex();
+            }
 
-        /* Log to journal */
-        WriteRamJournal(this->_logBuffer, len);
-        WritePersistentJournal(this->_logBuffer, len);
+            if (!this->_isJournalTimeLoaded) {
+                LoadJournalTimeBase();
+            }
 
-        /* On critical, reboot */
-        if (LOG_LEVEL_CRITICAL == kLevel) {
-            pSysState = SystemState::GetInstance();
-            /* Get the system state */
-            if (nullptr != pSysState) {
-                /* Set the maintenance mode */
-                pModeMgr = pSysState->GetModeManager();
-                if (nullptr != pModeMgr) {
-                    pModeMgr->SetMode(E_Mode::MODE_MAINTENANCE);
+            /* Open the segment */
+            GetJournalSegmentPath(this->_journalSegment, pPath);
+            this->_logfile = pStorage->Open(pPath, LOG_JOURNAL_SEGMENT_MODE);
+            if (this->_logfile.isOpen()) {
+#if LOG_JOURNAL_COMPRESSED
+                /* Continue in the slot after the last frame */
+                this->_journalSegmentSize = 0;
+                this->_journalSlot        = 0;
+                if (ReadLastJournalFrame(&this->_logfile, &slot, &header)) {
+                    this->_journalSegmentSize = header.rawOffset +
+                                                header.rawLen;
+                    this->_journalSlot        = slot + 1;
+                }
+                LogCodec::Reset(this->_journalEncoder);
+                this->_isJournalFrameDirty = false;
+#else
+                this->_journalSegmentSize = this->_logfile.size();
+#endif
+
+                /* Index the first block after boot */
+                this->_journalIndexNext = this->_journalSegmentSize;
+                if (0 == this->_logfile.size()) {
+                    /* Keep the append cost flat with a contiguous extent */
+                    this->_logfile.preAllocate(LOG_JOURNAL_SEGMENT_SIZE);
                 }
             }
-            HWManager::Reboot(true);
         }
     }
+
+    return this->_logfile.isOpen();
 }
 
-void Logger::Flush(void) noexcept {
-    Serial.flush();
+void Logger::RotateJournalSegment(void) noexcept {
+    Storage* pStorage;
+    char     pPath[LOG_JOURNAL_PATH_SIZE];
+
+    pStorage = GetJournalStorage();
+    if (nullptr != pStorage) {
+#if LOG_JOURNAL_COMPRESSED
+        /* Seal the open frame before leaving the segment */
+        if (this->_isJournalFrameDirty) {
+            WriteJournalFrame();
+        }
+        LogCodec::Reset(this->_journalEncoder);
+        this->_isJournalFrameDirty = false;
+        this->_journalSlot         = 0;
+        ++this->_journalGeneration;
+#endif
+        this->_logfile.close();
+
+        /* The oldest segment is dropped and becomes the active one */
+        this->_journalSegment = (this->_journalSegment + 1) %
+                                LOG_JOURNAL_SEGMENT_COUNT;
+        this->_journalSegmentSize = 0;
+        this->_journalIndexNext = 0;
+        GetJournalTimeIndexPath(this->_journalSegment, pPath);
+        pStorage->Remove(pPath);
+        GetJournalSegmentPath(this->_journalSegment, pPath);
+        pStorage->Remove(pPath);
+        this->_logfile = pStorage->Open(pPath, LOG_JOURNAL_SEGMENT_MODE);
+        if (this->_logfile.isOpen()) {
+            this->_logfile.preAllocate(LOG_JOURNAL_SEGMENT_SIZE);
+        }
+
+        WriteJournalIndex();
+    }
 }
 
-FsFile Logger::OpenPersistenJournal(void) const noexcept {
-    SystemState* pSysState;
-    Storage*     pStorage;
-    FsFile       file;
+void Logger::WriteJournalIndex(void) noexcept {
+    Storage* pStorage;
+    FsFile   index;
+    uint8_t  pIndex[LOG_JOURNAL_INDEX_SIZE];
 
-    pSysState = SystemState::GetInstance();
-    if (nullptr != pSysState) {
-        pStorage = pSysState->GetStorage();
-        if (nullptr != pStorage) {
-            /* Open the log file */
-            file = pStorage->Open(LOG_JOURNAL_PATH, O_RDONLY);
+    pStorage = GetJournalStorage();
+    if (nullptr != pStorage) {
+        pIndex[0] = this->_journalSegment;
+        pIndex[1] = LOG_JOURNAL_FORMAT;
+        index = pStorage->Open(
+            LOG_JOURNAL_INDEX_PATH,
+            O_WRONLY | O_CREAT | O_TRUNC
+        );
+        if (index.isOpen()) {
+            Metrics::Add(
+                METRIC_SD_LOGGER_BYTES,
+                (uint32_t)index.write(pIndex, LOG_JOURNAL_INDEX_SIZE)
+            );
+            index.close();
+        }
+    }
+}
+
+void Logger::RemoveJournalSegments(void) noexcept {
+    Storage* pStorage;
+    char     pPath[LOG_JOURNAL_PATH_SIZE];
+    uint8_t  i;
+
+    if (this->_logfile.isOpen()) {
+        this->_logfile.close();
+    }
+
+    pStorage = GetJournalStorage();
+    if (nullptr != pStorage) {
+        for (i = 0; i < LOG_JOURNAL_SEGMENT_COUNT; ++i) {
+            GetJournalSegmentPath(i, pPath);
+            pStorage->Remove(pPath);
+            GetJournalTimeIndexPath(i, pPath);
+            pStorage->Remove(pPath);
         }
+        pStorage->Remove(LOG_JOURNAL_INDEX_PATH);
+
+        /* Remove the journal of previous versions */
+        pStorage->Remove(LOG_JOURNAL_PATH);
     }
 
-    return file;
+    this->_journalSegment = 0;
+    this->_journalSegmentSize = 0;
+    this->_journalBlockLen = 0;
+    this->_journalIndexNext = 0;
+#if LOG_JOURNAL_COMPRESSED
+    LogCodec::Reset(this->_journalEncoder);
+    this->_isJournalFrameDirty = false;
+    this->_journalSlot = 0;
+    ++this->_journalGeneration;
+#endif
 }
 
-void Logger::ClearPersistentJournal(void) const noexcept {
-    SystemState* pSysState;
-    Storage*     pStorage;
+void Logger::WriteJournalTimeIndex(void) noexcept {
+    Storage*               pStorage;
+    FsFile                 index;
+    char                   pPath[LOG_JOURNAL_PATH_SIZE];
+    S_LogJournalIndexEntry entry;
 
-    pSysState = SystemState::GetInstance();
-    if (nullptr != pSysState) {
-        pStorage = pSysState->GetStorage();
-        if (nullptr != pStorage) {
-            /* remove the log file */
-            pStorage->Remove(LOG_JOURNAL_PATH);
+    pStorage = GetJournalStorage();
+    if (nullptr != pStorage) {
+        GetJournalTimeIndexPath(this->_journalSegment, pPath);
+        index = pStorage->Open(pPath, O_WRONLY | O_CREAT | O_APPEND);
+        if (index.isOpen()) {
+            entry.time   = this->_journalTimeBase + this->_journalBlockTime;
+            entry.offset = this->_journalSegmentSize;
+            Metrics::Add(
+                METRIC_SD_LOGGER_BYTES,
+                (uint32_t)index.write(&entry, sizeof(S_LogJournalIndexEntry))
+            );
+            index.close();
         }
     }
+
+    this->_journalIndexNext = (this->_journalSegmentSize /
+                               LOG_JOURNAL_TIME_INDEX_STRIDE + 1) *
+                              LOG_JOURNAL_TIME_INDEX_STRIDE;
 }
 
-void Logger::OpenRamJournal(S_RamJournalDescriptor* pDesc) const noexcept {
-    pDesc->pCursor = 0;
+void Logger::LoadJournalTimeBase(void) noexcept {
+    Storage*               pStorage;
+    FsFile                 index;
+    char                   pPath[LOG_JOURNAL_PATH_SIZE];
+    S_LogJournalIndexEntry entry;
+    size_t                 size;
+    uint8_t                i;
+
+    pStorage = GetJournalStorage();
+    if (nullptr != pStorage) {
+        /* Continue after the newest entry of the previous boots */
+        for (i = 0; LOG_JOURNAL_SEGMENT_COUNT > i; ++i) {
+            GetJournalTimeIndexPath(i, pPath);
+            index = pStorage->Open(pPath, O_RDONLY);
+            if (index.isOpen()) {
+                size = index.size();
+                if (sizeof(S_LogJournalIndexEntry) <= size &&
+                    index.seek(size - size % sizeof(S_LogJournalIndexEntry) -
+                               sizeof(S_LogJournalIndexEntry)) &&
+                    (int)sizeof(S_LogJournalIndexEntry) == index.read(
+                        &entry,
+                        sizeof(S_LogJournalIndexEntry)
+                    ) &&
+                    this->_journalTimeBase < entry.time) {
+                    this->_journalTimeBase = entry.time;
+                }
+                index.close();
+            }
+        }
+
+        this->_isJournalTimeLoaded = true;
+    }
 }
 
-size_t Logger::ReadRamJournal(uint8_t*                pBuffer,
-                              size_t                  length,
-                              S_RamJournalDescriptor* pDesc) const noexcept {
-    size_t   available;
-    size_t   toCopy;
-    size_t   leftToCopy;
-    uint8_t* pCopyCursor;
-    size_t   cursorOff;
+size_t Logger::GetJournalSegmentSize(const uint8_t kSegment) const noexcept {
+    Storage*          pStorage;
+    FsFile            segment;
+    char              pPath[LOG_JOURNAL_PATH_SIZE];
+    size_t            size;
+#if LOG_JOURNAL_COMPRESSED
+    S_LogJournalFrame header;
+    uint32_t          slot;
+#endif
 
-    /* Get the max content */
-    if (this->_logJournalRam.hasCircled) {
-        available = (uint32_t)this->_logJournalRam.pEndAddress -
-                    (uint32_t)this->_logJournalRam.pStartAddress;
+    if (kSegment == this->_journalSegment && this->_logfile.isOpen()) {
+        size = this->_journalSegmentSize;
     }
     else {
-        available = (uint32_t)this->_logJournalRam.pCursor -
-                    (uint32_t)this->_logJournalRam.pStartAddress;
+        size = 0;
+        pStorage = GetJournalStorage();
+        if (nullptr != pStorage) {
+            GetJournalSegmentPath(kSegment, pPath);
+            segment = pStorage->Open(pPath, O_RDONLY);
+            if (segment.isOpen()) {
+#if LOG_JOURNAL_COMPRESSED
+                /* The size is the end of the logs of the last frame */
+                if (ReadLastJournalFrame(&segment, &slot, &header)) {
+                    size = header.rawOffset + header.rawLen;
+                }
+#else
+                size = segment.size();
+#endif
+                segment.close();
+            }
+        }
     }
 
-    /* Get the amount to copy */
-    if (pDesc->pCursor < available) {
-        /* Get the size to copy */
-        toCopy = available - pDesc->pCursor;
-        toCopy = toCopy < length ? toCopy : length;
+    return size;
+}
 
-        /* Get the offset cursor position */
-        cursorOff = (uint32_t)this->_logJournalRam.pCursor -
-                    (uint32_t)this->_logJournalRam.pStartAddress;
+bool Logger::ReadJournalSegment(T_HALFile&    rSegment,
+                                const uint8_t kSegment,
+                                const size_t  kPosition,
+                                uint8_t*      pBuffer,
+                                const size_t  kSize) const noexcept {
+#if LOG_JOURNAL_COMPRESSED
+    S_LogJournalReader* pReader;
+    size_t              openStart;
+    size_t              position;
+    size_t              toCopy;
+    bool                success;
 
-        if (pDesc->pCursor > cursorOff) {
-            pCopyCursor = this->_logJournalRam.pEndAddress -
-                          (pDesc->pCursor - cursorOff);
+    pReader   = this->_pJournalReader;
+    openStart = this->_journalSegmentSize - this->_journalEncoder.rawLen;
+    position  = kPosition;
+    success   = true;
+    while (success && kPosition + kSize > position) {
+        toCopy = 0;
+        if (kSegment == this->_journalSegment &&
+            this->_logfile.isOpen() &&
+            openStart <= position) {
+            /* The open frame is read from the encoder */
+            toCopy = kPosition + kSize - position;
+            memcpy(
+                pBuffer + position - kPosition,
+                this->_journalEncoder.pRaw + position - openStart,
+                toCopy
+            );
         }
         else {
-            pCopyCursor = this->_logJournalRam.pCursor - pDesc->pCursor;
+            success = LoadJournalFrame(rSegment, kSegment, position);
+            if (success) {
+                toCopy = pReader->rawOffset + pReader->rawLen - position;
+                if (kPosition + kSize - position < toCopy) {
+                    toCopy = kPosition + kSize - position;
+                }
+                memcpy(
+                    pBuffer + position - kPosition,
+                    pReader->pRaw + position - pReader->rawOffset,
+                    toCopy
+                );
+            }
         }
+        position += toCopy;
+    }
 
-        /* Set the start of the copy */
-        cursorOff = (uint32_t)pCopyCursor -
-                    (uint32_t)this->_logJournalRam.pStartAddress;
-        if (toCopy > cursorOff) {
-            pCopyCursor = this->_logJournalRam.pEndAddress -
-                          (toCopy - cursorOff);
+    return success;
+#else
+    (void)kSegment;
+
+    return rSegment.seek(kPosition) &&
+           (int)kSize == rSegment.read(pBuffer, kSize);
+#endif
+}
+
+#if LOG_JOURNAL_COMPRESSED
+void Logger::WriteJournalFrames(const char*  kpData,
+                                const size_t kSize,
+                                const bool   kSync) noexcept {
+    size_t accepted;
+    size_t appended;
+    bool   success;
+
+    accepted = 0;
+    success  = true;
+    while (success && kSize > accepted) {
+        appended = LogCodec::Append(
+            this->_journalEncoder,
+            (const uint8_t*)kpData + accepted,
+            kSize - accepted
+        );
+        this->_journalSegmentSize += appended;
+        accepted                  += appended;
+        if (0 != appended) {
+            this->_isJournalFrameDirty = true;
         }
-        else {
-            pCopyCursor -= toCopy;
+
+        /* Seal the full frame, the logs continue in the next slot */
+        if (kSize > accepted) {
+            success = WriteJournalFrame();
+            if (success) {
+                ++this->_journalSlot;
+                LogCodec::Reset(this->_journalEncoder);
+            }
         }
+    }
+
+    /* The open frame is rewritten until it is full */
+    if (success && kSync && this->_isJournalFrameDirty) {
+        success = WriteJournalFrame();
+    }
+
+    /* On error the frame is dropped, the logs cannot be kept forever */
+    if (!success) {
+        this->_journalSegmentSize -= this->_journalEncoder.rawLen;
+        LogCodec::Reset(this->_journalEncoder);
+        this->_isJournalFrameDirty = false;
+        ++this->_journalGeneration;
+    }
+}
+
+bool Logger::WriteJournalFrame(void) noexcept {
+    S_LogJournalFrame header;
+    uint8_t*          pPacked;
+    size_t            size;
+    bool              success;
+
+    pPacked          = this->_pJournalFrame + sizeof(S_LogJournalFrame);
+    header.magic     = LOG_JOURNAL_FRAME_MAGIC;
+    header.rawOffset = this->_journalSegmentSize -
+                       this->_journalEncoder.rawLen;
+    header.rawLen    = this->_journalEncoder.rawLen;
+    header.packedLen = LogCodec::Pack(this->_journalEncoder, pPacked);
+    header.crc       = GetJournalFrameCrc(&header, pPacked);
+    memcpy(this->_pJournalFrame, &header, sizeof(S_LogJournalFrame));
 
-        /* Check if we have a copy rollover */
-        if (pCopyCursor + toCopy > this->_logJournalRam.pEndAddress) {
-            /* Copy first part */
-            leftToCopy = this->_logJournalRam.pEndAddress - pCopyCursor;
-            memcpy(pBuffer, pCopyCursor, leftToCopy);
+    /* Only write the sectors holding the frame */
+    size = sizeof(S_LogJournalFrame) + header.packedLen;
+    size = (size + LOG_JOURNAL_BLOCK_SIZE - 1) / LOG_JOURNAL_BLOCK_SIZE *
+           LOG_JOURNAL_BLOCK_SIZE;
+    memset(
+        pPacked + header.packedLen,
+        0,
+        size - sizeof(S_LogJournalFrame) - header.packedLen
+    );
+
+    success = this->_logfile.seek(
+                  this->_journalSlot * LOG_JOURNAL_FRAME_SIZE
+              ) &&
+              size == this->_logfile.write(this->_pJournalFrame, size);
+    if (success) {
+        this->_isJournalFrameDirty = false;
+        Metrics::Add(METRIC_SD_LOGGER_BYTES, (uint32_t)size);
+    }
+
+    return success;
+}
+
+bool Logger::LoadJournalFrame(T_HALFile&    rSegment,
+                              const uint8_t kSegment,
+                              const size_t  kPosition) const noexcept {
+    S_LogJournalReader* pReader;
+    S_LogJournalFrame   header;
+    uint32_t            low;
+    uint32_t            high;
+    uint32_t            middle;
+    size_t              rawLen;
+    bool                isSame;
 
-            /* Update left to copy info */
-            pBuffer += leftToCopy;
-            leftToCopy = toCopy - leftToCopy;
-            pCopyCursor = this->_logJournalRam.pStartAddress;
+    pReader = this->_pJournalReader;
+    isSame  = pReader->isValid &&
+              this->_journalGeneration == pReader->generation &&
+              kSegment == pReader->segment;
+
+    if (!isSame ||
+        pReader->rawOffset > kPosition ||
+        pReader->rawOffset + pReader->rawLen <= kPosition) {
+        if (isSame && pReader->rawOffset + pReader->rawLen == kPosition) {
+            /* Sequential reads continue in the next slot */
+            low = pReader->slot + 1;
         }
         else {
-            leftToCopy = toCopy;
+            /* Search the last frame starting at or before the position */
+            low  = 0;
+            high = (rSegment.size() + LOG_JOURNAL_FRAME_SIZE - 1) /
+                   LOG_JOURNAL_FRAME_SIZE;
+            while (low + 1 < high) {
+                middle = low + (high - low) / 2;
+                if (ReadJournalFrameHeader(&rSegment, middle, &header) &&
+                    header.rawOffset <= kPosition) {
+                    low = middle;
+                }
+                else {
+                    high = middle;
+                }
+            }
         }
 
-        memcpy(pBuffer, pCopyCursor, leftToCopy);
-    }
-    else {
-        toCopy = 0;
-    }
+        pReader->isValid = false;
+        if (ReadJournalFrameHeader(&rSegment, low, &header) &&
+            header.rawOffset <= kPosition &&
+            header.rawOffset + header.rawLen > kPosition &&
+            (int)header.packedLen == rSegment.read(
+                pReader->pFrame,
+                header.packedLen
+            )) {
+            /* A damaged frame reads as empty lines, the offsets of the other
+             * frames are kept.
+             */
+            if (GetJournalFrameCrc(&header, pReader->pFrame) != header.crc ||
+                !LogCodec::Decode(
+                    pReader->pFrame,
+                    header.packedLen,
+                    pReader->pRaw,
+                    LOG_CODEC_WINDOW_SIZE,
+                    rawLen
+                ) ||
+                header.rawLen != rawLen) {
+                memset(pReader->pRaw, '\n', header.rawLen);
+            }
 
-    pDesc->pCursor += toCopy;
+            pReader->generation = this->_journalGeneration;
+            pReader->segment    = kSegment;
+            pReader->slot       = low;
+            pReader->rawOffset  = header.rawOffset;
+            pReader->rawLen     = header.rawLen;
+            pReader->isValid    = true;
+        }
+    }
 
-    return toCopy;
+    return pReader->isValid;
 }
-void Logger::SeekRamJournal(S_RamJournalDescriptor* pDesc,
-                            const size_t            kOffset) const noexcept{
-    size_t available;
+#endif
+
+void Logger::RequestJournalAction(const uint32_t kRequest) noexcept {
+#if LOGGER_ASYNC_ENABLED
+    uint64_t startTime;
 
-    /* Get the max content */
-    if (this->_logJournalRam.hasCircled) {
-        available = (uint32_t)this->_logJournalRam.pEndAddress -
-                    (uint32_t)this->_logJournalRam.pStartAddress;
+    /* Let the writer task execute the request, except from the writer task
+     * itself.
+     */
+    if (nullptr != this->_writerTaskHandle &&
+        xTaskGetCurrentTaskHandle() != this->_writerTaskHandle &&
+        taskSCHEDULER_RUNNING == xTaskGetSchedulerState()) {
+        startTime = HWManager::GetTime();
+        this->_journalRequest.fetch_or(kRequest, std::memory_order_release);
+        xTaskNotifyGive(this->_writerTaskHandle);
+        while ((0 != (this->_journalRequest.load(std::memory_order_acquire) &
+                      kRequest) ||
+                this->_ringTail.load(std::memory_order_acquire) !=
+                this->_ringHead.load(std::memory_order_acquire)) &&
+               LOGGER_FLUSH_TIMEOUT_NS > HWManager::GetTime() - startTime) {
+            vTaskDelay(1);
+        }
     }
     else {
-        available = (uint32_t)this->_logJournalRam.pCursor -
-                    (uint32_t)this->_logJournalRam.pStartAddress;
+        ExecuteJournalAction(kRequest);
     }
+#else
+    ExecuteJournalAction(kRequest);
+#endif
+}
 
-    if (kOffset < available) {
-        pDesc->pCursor = kOffset;
+void Logger::ExecuteJournalAction(const uint32_t kRequest) noexcept {
+    Storage* pStorage;
+
+    if (0 != (LOG_JOURNAL_REQ_FLUSH & kRequest)) {
+        FlushPersistentJournal(true);
     }
-    else {
-        pDesc->pCursor = available;
+    if (0 != (LOG_JOURNAL_REQ_CLEAR & kRequest)) {
+        pStorage = GetJournalStorage();
+        if (nullptr != pStorage &&
+            E_Return::NO_ERROR ==
+            pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+            RemoveJournalSegments();
+            pStorage->ReleaseSPIBus();
+        }
     }
 }
 
-void Logger::ClearRamJournal(void) noexcept {
-    /* Resets the RAM logs */
-    this->_logJournalRam.hasCircled = false;
-    this->_logJournalRam.pCursor = this->_logJournalRam.pStartAddress;
-}
+void Logger::WriteRamJournal(const uint8_t* kpRecord, size_t len) noexcept {
+    S_LogRecordHeader header;
+    size_t            ringSize;
 
-void Logger::WritePersistentJournal(const char* kpStr, size_t len)
-noexcept {
-    SystemState* pSysState;
-    Storage*     pStorage;
+    /* Drop the record when a reader is stuck */
+    if (pdPASS == xSemaphoreTake(
+                    this->_ramJournalLock,
+                    LOG_RAM_LOCK_TIMEOUT_TICKS)) {
+        ringSize = this->_logJournalRam.pEndAddress -
+                   this->_logJournalRam.pStartAddress;
 
-    if (!this->_logfile.isOpen()) {
-        pSysState = SystemState::GetInstance();
-        if (nullptr != pSysState) {
-            pStorage = pSysState->GetStorage();
-            if (nullptr != pStorage) {
-                /* Open the log file and append */
-                this->_logfile = pStorage->Open(
-                    LOG_JOURNAL_PATH,
-                    O_RDWR | O_CREAT | O_APPEND
-                );
-            }
+        /* Drop the oldest records to make room */
+        while (ringSize < this->_logJournalRam.written + len -
+                          this->_logJournalRam.oldest) {
+            this->_logJournalRam.oldest += GetRamJournalRecordSize(
+                this->_logJournalRam.oldest
+            );
+            ++this->_logJournalRam.oldestSequence;
         }
-    }
 
-    if (this->_logfile.isOpen()) {
-        this->_logfile.write(kpStr, len);
+        /* Stamp the record, one record every stride is indexed */
+        memcpy(&header, kpRecord, sizeof(S_LogRecordHeader));
+        header.sequence = this->_logJournalRam.sequence;
+        if (0 == header.sequence % LOG_RAM_INDEX_STRIDE) {
+            this->_logJournalRam.pIndex[
+                (header.sequence / LOG_RAM_INDEX_STRIDE) % LOG_RAM_INDEX_SIZE
+            ] = this->_logJournalRam.written;
+        }
+        ++this->_logJournalRam.sequence;
+
+        AppendRamJournal((const uint8_t*)&header, sizeof(S_LogRecordHeader));
+        AppendRamJournal(
+            kpRecord + sizeof(S_LogRecordHeader),
+            len - sizeof(S_LogRecordHeader)
+        );
+
+        xSemaphoreGive(this->_ramJournalLock);
     }
 }
 
-void Logger::WriteRamJournal(const char* kpStr, size_t len) noexcept {
-
+void Logger::AppendRamJournal(const uint8_t* kpData, size_t len) noexcept {
     size_t toWrite;
 
     while (0 < len) {
@@ -358,26 +2587,63 @@ void Logger::WriteRamJournal(const char* kpStr, size_t len) noexcept {
         }
 
         /* Copy data */
-        memcpy(this->_logJournalRam.pCursor, kpStr, toWrite);
+        memcpy(this->_logJournalRam.pCursor, kpData, toWrite);
 
         /* Update cursors */
-        kpStr += toWrite;
+        kpData += toWrite;
         len -= toWrite;
+        this->_logJournalRam.written += toWrite;
         this->_logJournalRam.pCursor += toWrite;
 
         /* Check for rollover */
         if (this->_logJournalRam.pCursor == this->_logJournalRam.pEndAddress) {
             this->_logJournalRam.pCursor = this->_logJournalRam.pStartAddress;
-            this->_logJournalRam.hasCircled = true;
         }
     }
 }
 
 Logger::Logger() noexcept
 {
+    uint8_t  module;
+#if LOGGER_ASYNC_ENABLED
+    bool     isCreated;
+    uint32_t i;
+#endif
+
     /* Init serial */
     Serial.begin(LOGGER_SERIAL_BAUDRATE);
 
+    /* Init the runtime module levels */
+    for (module = 0; LOG_MODULE_MAX > module; ++module) {
+        this->_moduleLevels[module].store(
+            (uint8_t)LogModuleLevel((E_LogModule)module),
+            std::memory_order_relaxed
+        );
+    }
+
+    /* Init the rate limits and the repeated logs collapsing */
+    memset(this->_pRateSites, 0, sizeof(this->_pRateSites));
+    HAL::InitSpinLock(this->_rateLock);
+    this->_isRateLimited.store(LOGGER_RATE_LIMIT_ENABLED);
+    this->_rateLimitedCount.store(0);
+    this->_repeatedCount.store(0);
+    this->_lastRateReport = 0;
+    this->_lastRecordLen  = 0;
+    this->_repeatCount    = 0;
+    this->_repeatStart    = 0;
+    this->_pLastRecord    = (uint8_t*)ps_calloc(
+        LOGGER_BUFFER_SIZE,
+        sizeof(uint8_t)
+    );
+    this->_pReportRecord  = (uint8_t*)ps_calloc(
+        LOGGER_BUFFER_SIZE,
+        sizeof(uint8_t)
+    );
+    if (nullptr == this->_pLastRecord || nullptr == this->_pReportRecord) {
+        Serial.printf("Failed to allocate logger report buffers.\n");
+        HWManager::Reboot(true);
+    }
+
     /* Init buffer */
     this->_logBuffer = new char[LOGGER_BUFFER_SIZE];
     if (nullptr == this->_logBuffer) {
@@ -397,5 +2663,129 @@ Logger::Logger() noexcept
     this->_logJournalRam.pEndAddress = this->_logJournalRam.pStartAddress +
                                        LOG_RAM_BUFFER_SIZE - 1;
     this->_logJournalRam.pCursor     = this->_logJournalRam.pStartAddress;
-    this->_logJournalRam.hasCircled  = false;
+    this->_logJournalRam.written     = 0;
+
+    /* The index entries are only read once their record is written */
+    this->_logJournalRam.oldest         = 0;
+    this->_logJournalRam.oldestSequence = 0;
+    this->_logJournalRam.sequence       = 0;
+    this->_logJournalRam.pIndex         = (size_t*)ps_calloc(
+        LOG_RAM_INDEX_SIZE,
+        sizeof(size_t)
+    );
+    if (nullptr == this->_logJournalRam.pIndex) {
+        Serial.printf("Failed to allocate logger journal index.\n");
+        HWManager::Reboot(true);
+    }
+    this->_ramJournalLock = xSemaphoreCreateMutex();
+    if (nullptr == this->_ramJournalLock) {
+        Serial.printf("Failed to create logger journal lock.\n");
+        HWManager::Reboot(true);
+    }
+
+    /* Init the formating buffers */
+    this->_pFormatBuffer = new char[LOGGER_BUFFER_SIZE];
+    this->_pReadRecord = (uint8_t*)ps_calloc(LOGGER_BUFFER_SIZE, sizeof(uint8_t));
+    this->_pReadText = (char*)ps_calloc(LOGGER_BUFFER_SIZE, sizeof(char));
+    if (nullptr == this->_pFormatBuffer ||
+        nullptr == this->_pReadRecord ||
+        nullptr == this->_pReadText) {
+        Serial.printf("Failed to allocate logger format buffers.\n");
+        HWManager::Reboot(true);
+    }
+
+    /* Init persistent journal write-behind block */
+    this->_pJournalBlock = new char[LOG_JOURNAL_BLOCK_SIZE];
+    if (nullptr == this->_pJournalBlock) {
+        Serial.printf("Failed to allocate logger journal block.\n");
+        HWManager::Reboot(true);
+    }
+    this->_journalBlockLen     = 0;
+    this->_journalSegment      = 0;
+    this->_journalSegmentSize  = 0;
+    this->_lastJournalFlush    = 0;
+    this->_journalBlockTime    = 0;
+    this->_journalIndexNext    = 0;
+    this->_journalTimeBase     = 0;
+    this->_isJournalTimeLoaded = false;
+    this->_journalRequest.store(0);
+
+#if LOG_JOURNAL_COMPRESSED
+    /* Init the persistent journal frames */
+    this->_journalEncoder.pRaw = (uint8_t*)ps_calloc(
+        LOG_CODEC_WINDOW_SIZE,
+        sizeof(uint8_t)
+    );
+    this->_journalEncoder.pHash = (uint16_t*)ps_calloc(
+        LOG_CODEC_HASH_SIZE,
+        sizeof(uint16_t)
+    );
+    this->_journalEncoder.pPacked = (uint8_t*)ps_calloc(
+        LOG_JOURNAL_FRAME_CAPACITY,
+        sizeof(uint8_t)
+    );
+    this->_journalEncoder.capacity = LOG_JOURNAL_FRAME_CAPACITY;
+    this->_pJournalFrame = (uint8_t*)ps_calloc(
+        LOG_JOURNAL_FRAME_SIZE,
+        sizeof(uint8_t)
+    );
+    this->_pJournalReader = (S_LogJournalReader*)ps_calloc(
+        1,
+        sizeof(S_LogJournalReader)
+    );
+    if (nullptr == this->_journalEncoder.pRaw ||
+        nullptr == this->_journalEncoder.pHash ||
+        nullptr == this->_journalEncoder.pPacked ||
+        nullptr == this->_pJournalFrame ||
+        nullptr == this->_pJournalReader) {
+        Serial.printf("Failed to allocate logger journal frames.\n");
+        HWManager::Reboot(true);
+    }
+    this->_pJournalReader->pFrame = (uint8_t*)ps_calloc(
+        LOG_JOURNAL_FRAME_SIZE,
+        sizeof(uint8_t)
+    );
+    this->_pJournalReader->pRaw = (uint8_t*)ps_calloc(
+        LOG_CODEC_WINDOW_SIZE,
+        sizeof(uint8_t)
+    );
+    if (nullptr == this->_pJournalReader->pFrame ||
+        nullptr == this->_pJournalReader->pRaw) {
+        Serial.printf("Failed to allocate logger journal frames.\n");
+        HWManager::Reboot(true);
+    }
+    LogCodec::Reset(this->_journalEncoder);
+    this->_isJournalFrameDirty = false;
+    this->_journalSlot         = 0;
+    this->_journalGeneration   = 0;
+#endif
+
+#if LOGGER_ASYNC_ENABLED
+    /* Init the asynchronous ring */
+    this->_writerTaskHandle = nullptr;
+    this->_ringHead.store(0);
+    this->_ringTail.store(0);
+    this->_droppedCount.store(0);
+    this->_pRing = new S_LogRecord[LOGGER_ASYNC_RING_SIZE];
+    if (nullptr == this->_pRing) {
+        Serial.printf("Failed to allocate logger ring.\n");
+        HWManager::Reboot(true);
+    }
+    for (i = 0; i < LOGGER_ASYNC_RING_SIZE; ++i) {
+        this->_pRing[i].sequence.store(i);
+        this->_pRing[i].length = 0;
+    }
+
+    /* Create the writer task, on failure the logger stays synchronous */
+    isCreated = TaskRegistry::CreateTask(
+        E_TaskId::TASK_ID_LOGGER,
+        Logger::WriterTaskRoutine,
+        this,
+        this->_writerTaskHandle
+    );
+    if (!isCreated) {
+        Serial.printf("Failed to create the logger writer task.\n");
+        this->_writerTaskHandle = nullptr;
+    }
+#endif
 }
@@ -0,0 +1,530 @@
+/*******************************************************************************
+ * @file OtaUpdater.cpp
+ *
+ * @see OtaUpdater.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware update writer.
+ *
+ * @details Firmware update writer. The image is streamed into the inactive
+ * application partition through two buffers, one is received while the other
+ * is written to the flash by the update task, and its hash is verified as it
+ * is written.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
+/* Included headers */
+#include <atomic>           /* Standard atomic types */
+#include <cstdint>          /* Standard integer definitions */
+#include <cstring>          /* memcpy, memcmp */
+#include <HAL.h>            /* Hardware abstraction layer */
+#include <Errors.h>         /* Errors definitions */
+#include <Logger.h>         /* Logger services */
+#include <TaskRegistry.h>   /* Firmware tasks registry */
+#include <esp_ota_ops.h>    /* Application partitions updates */
+#include <mbedtls/md.h>     /* Image hash */
+
+/* Header file */
+#include <OtaUpdater.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+OtaUpdater::OtaUpdater(void) noexcept {
+    uint32_t i;
+
+    /* The buffers and the task are only created by the first update */
+    for (i = 0; OTA_BUFFER_COUNT > i; ++i) {
+        this->_pBuffers[i] = nullptr;
+    }
+    this->_writeQueue = nullptr;
+    this->_freeQueue = nullptr;
+    this->_task = nullptr;
+    this->_current = OTA_BUFFER_COUNT;
+    this->_fill = 0;
+    this->_pkPartition = nullptr;
+    this->_handle = 0;
+    this->_state = E_OtaState::OTA_STATE_IDLE;
+    this->_imageSize = 0;
+    this->_received = 0;
+    this->_written = 0;
+    this->_writeError = E_Return::NO_ERROR;
+    this->_error = E_Return::NO_ERROR;
+}
+
+OtaUpdater::~OtaUpdater(void) noexcept {
+    PANIC("Tried to destroy the OTA updater.\n");
+}
+
+E_Return OtaUpdater::Begin(const uint32_t kImageSize,
+                           const uint8_t* kpHash) noexcept {
+    E_Return  error;
+    esp_err_t espError;
+
+    error = E_Return::NO_ERROR;
+
+    if (E_OtaState::OTA_STATE_READY == this->_state) {
+        /* The verified image must boot before another one is written */
+        error = E_Return::ERR_OTA_STATE;
+    }
+    else if (E_OtaState::OTA_STATE_RECEIVING == this->_state &&
+             kImageSize == this->_imageSize &&
+             0 == memcmp(kpHash, this->_pExpectedHash, OTA_HASH_SIZE)) {
+        LOG_INFO(
+            "Resuming the firmware update at %u/%u.\n",
+            this->_received,
+            this->_imageSize
+        );
+    }
+    else {
+        Abort();
+
+        error = Init();
+        if (E_Return::NO_ERROR == error) {
+            this->_pkPartition = esp_ota_get_next_update_partition(nullptr);
+            if (nullptr == this->_pkPartition ||
+                0 == kImageSize ||
+                this->_pkPartition->size < kImageSize) {
+                error = E_Return::ERR_INVALID_PARAM;
+            }
+        }
+        if (E_Return::NO_ERROR == error) {
+            /* The sectors are erased as they are written */
+            espError = esp_ota_begin(
+                this->_pkPartition,
+                OTA_WITH_SEQUENTIAL_WRITES,
+                &this->_handle
+            );
+            if (ESP_OK != espError) {
+                LOG_ERROR("Failed to start the update: %d.\n", espError);
+                error = E_Return::ERR_OTA_FLASH;
+            }
+        }
+        if (E_Return::NO_ERROR == error &&
+            0 != mbedtls_md_starts(&this->_hash)) {
+            esp_ota_abort(this->_handle);
+            error = E_Return::ERR_OTA_HASH;
+        }
+
+        if (E_Return::NO_ERROR == error) {
+            memcpy(this->_pExpectedHash, kpHash, OTA_HASH_SIZE);
+            this->_imageSize = kImageSize;
+            this->_received = 0;
+            this->_fill = 0;
+            this->_written = 0;
+            this->_writeError = E_Return::NO_ERROR;
+            this->_error = E_Return::NO_ERROR;
+            this->_state = E_OtaState::OTA_STATE_RECEIVING;
+
+            LOG_INFO(
+                "Started a firmware update of %u bytes to %s.\n",
+                kImageSize,
+                this->_pkPartition->label
+            );
+        }
+        else {
+            this->_error = error;
+        }
+    }
+
+    return error;
+}
+
+E_Return OtaUpdater::BeginTransfer(const uint32_t kOffset) noexcept {
+    E_Return error;
+
+    if (E_OtaState::OTA_STATE_RECEIVING != this->_state) {
+        error = E_Return::ERR_OTA_STATE;
+    }
+    else if (kOffset != this->_received) {
+        /* The client resumes from the offset it read in the status */
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+    else {
+        error = E_Return::NO_ERROR;
+    }
+
+    return error;
+}
+
+E_Return OtaUpdater::Write(const uint8_t* kpData,
+                           const size_t   kSize) noexcept {
+    E_Return error;
+    size_t   offset;
+    size_t   length;
+
+    error = E_Return::NO_ERROR;
+
+    if (E_OtaState::OTA_STATE_RECEIVING != this->_state) {
+        error = E_Return::ERR_OTA_STATE;
+    }
+    else if (this->_imageSize - this->_received < kSize) {
+        Fail(E_Return::ERR_INVALID_PARAM);
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+
+    offset = 0;
+    while (E_Return::NO_ERROR == error && kSize > offset) {
+        /* Wait for the update task to give a buffer back */
+        if (OTA_BUFFER_COUNT == this->_current) {
+            if (!HAL::ReceiveQueue(
+                    this->_freeQueue,
+                    &this->_current,
+                    OTA_WRITE_TIMEOUT_NS
+                )) {
+                this->_current = OTA_BUFFER_COUNT;
+                Fail(E_Return::ERR_OTA_FLASH);
+                error = E_Return::ERR_OTA_FLASH;
+            }
+            this->_fill = 0;
+        }
+
+        if (E_Return::NO_ERROR == error) {
+            length = kSize - offset;
+            if (OTA_BUFFER_SIZE - this->_fill < length) {
+                length = OTA_BUFFER_SIZE - this->_fill;
+            }
+            memcpy(
+                this->_pBuffers[this->_current] + this->_fill,
+                kpData + offset,
+                length
+            );
+            this->_fill += length;
+            this->_received += length;
+            offset += length;
+
+            if (OTA_BUFFER_SIZE == this->_fill) {
+                error = Submit();
+            }
+        }
+    }
+
+    return error;
+}
+
+E_Return OtaUpdater::EndTransfer(void) noexcept {
+    E_Return error;
+
+    if (E_OtaState::OTA_STATE_RECEIVING != this->_state) {
+        error = E_Return::ERR_OTA_STATE;
+    }
+    else {
+        /* A dropped transfer resumes after the data already received */
+        error = Drain();
+
+        LOG_DEBUG(
+            "Firmware update transfer ended at %u/%u.\n",
+            this->_received,
+            this->_imageSize
+        );
+    }
+
+    return error;
+}
+
+E_Return OtaUpdater::Finish(void) noexcept {
+    uint8_t   pHash[OTA_HASH_SIZE];
+    E_Return  error;
+    esp_err_t espError;
+
+    if (E_OtaState::OTA_STATE_RECEIVING != this->_state ||
+        this->_imageSize != this->_received) {
+        error = E_Return::ERR_OTA_STATE;
+    }
+    else {
+        error = Drain();
+        if (E_Return::NO_ERROR == error) {
+            if (0 != mbedtls_md_finish(&this->_hash, pHash) ||
+                0 != memcmp(pHash, this->_pExpectedHash, OTA_HASH_SIZE)) {
+                Fail(E_Return::ERR_OTA_HASH);
+                error = E_Return::ERR_OTA_HASH;
+            }
+        }
+        if (E_Return::NO_ERROR == error) {
+            /* The handle is released by the end call, even on error */
+            espError = esp_ota_end(this->_handle);
+            if (ESP_OK == espError) {
+                espError = esp_ota_set_boot_partition(this->_pkPartition);
+            }
+            if (ESP_OK == espError) {
+                this->_state = E_OtaState::OTA_STATE_READY;
+                LOG_INFO(
+                    "Firmware update verified, %s boots next.\n",
+                    this->_pkPartition->label
+                );
+            }
+            else {
+                LOG_ERROR("Failed to validate the update: %d.\n", espError);
+                this->_state = E_OtaState::OTA_STATE_FAILED;
+                this->_error = E_Return::ERR_OTA_FLASH;
+                error = E_Return::ERR_OTA_FLASH;
+            }
+        }
+    }
+
+    return error;
+}
+
+void OtaUpdater::Abort(void) noexcept {
+    if (E_OtaState::OTA_STATE_RECEIVING == this->_state) {
+        /* The queued buffers are skipped, the handle is released after */
+        this->_writeError = E_Return::ERR_OTA_STATE;
+        if (Reclaim()) {
+            (void)esp_ota_abort(this->_handle);
+        }
+        this->_fill = 0;
+        this->_state = E_OtaState::OTA_STATE_IDLE;
+
+        LOG_INFO("Firmware update aborted.\n");
+    }
+    else if (E_OtaState::OTA_STATE_FAILED == this->_state) {
+        this->_state = E_OtaState::OTA_STATE_IDLE;
+    }
+}
+
+void OtaUpdater::GetStatus(S_OtaStatus& rStatus) const noexcept {
+    rStatus.state = this->_state;
+    rStatus.imageSize = this->_imageSize;
+    rStatus.offset = this->_received;
+    rStatus.written = this->_written;
+    rStatus.error = this->_error;
+}
+
+void OtaUpdater::TaskRoutine(void* pParam) noexcept {
+    OtaUpdater* pUpdater;
+    S_OtaBlock  block;
+    esp_err_t   espError;
+
+    pUpdater = static_cast<OtaUpdater*>(pParam);
+
+    while (true) {
+        if (HAL::ReceiveQueue(
+                pUpdater->_writeQueue,
+                &block,
+                HAL_WAIT_FOREVER
+            )) {
+            /* After an error, the buffers are only given back */
+            if (E_Return::NO_ERROR == pUpdater->_writeError) {
+                espError = esp_ota_write(
+                    pUpdater->_handle,
+                    pUpdater->_pBuffers[block.index],
+                    block.size
+                );
+                if (ESP_OK != espError) {
+                    LOG_ERROR("Failed to write the update: %d.\n", espError);
+                    pUpdater->_writeError = E_Return::ERR_OTA_FLASH;
+                }
+                else if (0 != mbedtls_md_update(
+                            &pUpdater->_hash,
+                            pUpdater->_pBuffers[block.index],
+                            block.size
+                         )) {
+                    pUpdater->_writeError = E_Return::ERR_OTA_HASH;
+                }
+                else {
+                    pUpdater->_written += block.size;
+                }
+            }
+
+            (void)HAL::SendQueue(
+                pUpdater->_freeQueue,
+                &block.index,
+                HAL_WAIT_FOREVER
+            );
+        }
+    }
+}
+
+E_Return OtaUpdater::Init(void) noexcept {
+    E_Return error;
+    uint32_t i;
+
+    error = E_Return::NO_ERROR;
+
+    if (nullptr == this->_task) {
+        /* The buffers are DMA capable, they stay in the internal memory */
+        for (i = 0; OTA_BUFFER_COUNT > i && E_Return::NO_ERROR == error; ++i) {
+            this->_pBuffers[i] = static_cast<uint8_t*>(
+                HAL::Allocate(OTA_BUFFER_SIZE, false)
+            );
+            if (nullptr == this->_pBuffers[i]) {
+                error = E_Return::ERR_MEMORY;
+            }
+        }
+        if (E_Return::NO_ERROR == error) {
+            this->_writeQueue = HAL::CreateQueue(
+                OTA_BUFFER_COUNT,
+                sizeof(S_OtaBlock)
+            );
+            this->_freeQueue = HAL::CreateQueue(
+                OTA_BUFFER_COUNT,
+                sizeof(uint32_t)
+            );
+            if (nullptr == this->_writeQueue || nullptr == this->_freeQueue) {
+                error = E_Return::ERR_MEMORY;
+            }
+        }
+        if (E_Return::NO_ERROR == error) {
+            mbedtls_md_init(&this->_hash);
+            if (0 != mbedtls_md_setup(
+                        &this->_hash,
+                        mbedtls_md_info_from_type(MBEDTLS_MD_SHA256),
+                        0
+                     )) {
+                error = E_Return::ERR_MEMORY;
+            }
+        }
+        if (E_Return::NO_ERROR == error) {
+            for (i = 0; OTA_BUFFER_COUNT > i; ++i) {
+                (void)HAL::SendQueue(this->_freeQueue, &i, HAL_WAIT_FOREVER);
+            }
+            if (!TaskRegistry::CreateTask(
+                    E_TaskId::TASK_ID_OTA,
+                    TaskRoutine,
+                    this,
+                    this->_task
+                )) {
+                this->_task = nullptr;
+                error = E_Return::ERR_MEMORY;
+            }
+        }
+
+        if (E_Return::NO_ERROR != error) {
+            LOG_ERROR("Failed to initialize the OTA updater: %d.\n", error);
+            PANIC("Failed to initialize the OTA updater.\n");
+        }
+    }
+
+    return error;
+}
+
+E_Return OtaUpdater::Submit(void) noexcept {
+    S_OtaBlock block;
+    E_Return   error;
+
+    block.index = this->_current;
+    block.size = this->_fill;
+
+    /* The queue holds all the buffers, the send never blocks */
+    if (HAL::SendQueue(this->_writeQueue, &block, OTA_WRITE_TIMEOUT_NS)) {
+        this->_current = OTA_BUFFER_COUNT;
+        this->_fill = 0;
+        error = E_Return::NO_ERROR;
+    }
+    else {
+        Fail(E_Return::ERR_OTA_FLASH);
+        error = E_Return::ERR_OTA_FLASH;
+    }
+
+    return error;
+}
+
+E_Return OtaUpdater::Drain(void) noexcept {
+    E_Return error;
+
+    error = E_Return::NO_ERROR;
+
+    if (OTA_BUFFER_COUNT != this->_current && 0 != this->_fill) {
+        error = Submit();
+    }
+    if (E_Return::NO_ERROR == error && !Reclaim()) {
+        error = E_Return::ERR_OTA_FLASH;
+    }
+    if (E_Return::NO_ERROR == error) {
+        error = (E_Return)this->_writeError.load();
+    }
+    if (E_Return::NO_ERROR != error) {
+        Fail(error);
+    }
+
+    return error;
+}
+
+bool OtaUpdater::Reclaim(void) noexcept {
+    uint32_t pIndexes[OTA_BUFFER_COUNT];
+    uint32_t count;
+    uint32_t held;
+    uint32_t i;
+
+    /* All the buffers not held by the receiver are back once written */
+    count = 0;
+    held = (OTA_BUFFER_COUNT != this->_current) ? 1 : 0;
+    while (OTA_BUFFER_COUNT - held > count &&
+           HAL::ReceiveQueue(
+               this->_freeQueue,
+               &pIndexes[count],
+               OTA_WRITE_TIMEOUT_NS
+           )) {
+        ++count;
+    }
+    for (i = 0; count > i; ++i) {
+        (void)HAL::SendQueue(this->_freeQueue, &pIndexes[i], HAL_WAIT_FOREVER);
+    }
+
+    return OTA_BUFFER_COUNT - held == count;
+}
+
+void OtaUpdater::Fail(const E_Return kError) noexcept {
+    if (E_OtaState::OTA_STATE_RECEIVING == this->_state) {
+        /* The queued buffers are skipped, the handle is released after */
+        this->_writeError = kError;
+        if (Reclaim()) {
+            (void)esp_ota_abort(this->_handle);
+        }
+        this->_state = E_OtaState::OTA_STATE_FAILED;
+        this->_error = kError;
+
+        LOG_ERROR("Firmware update failed: %d.\n", kError);
+    }
+}
@@ -21,6 +21,10 @@
 /*******************************************************************************
  * INCLUDES
  ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
 #define DISABLE_FS_H_WARNING
 #include <BSP.h>         /* HW Manager */
 #include <SdFat.h>       /* SD card driver */
@@ -33,7 +37,14 @@
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/* None */
+
+#if STORAGE_DEDICATED_SPI
+/** @brief SD card SPI bus mode. */
+#define STORAGE_SPI_MODE DEDICATED_SPI
+#else
+/** @brief SD card SPI bus mode. */
+#define STORAGE_SPI_MODE SHARED_SPI
+#endif
 
 /*******************************************************************************
  * MACROS
@@ -79,11 +90,18 @@ Storage::Storage(void) noexcept {
     /* Create the configuration */
     SdSpiConfig config = SdSpiConfig(
         GPIO_SPI_CS_SD,
-        SHARED_SPI,
-        SD_SCK_MHZ(40),
+        STORAGE_SPI_MODE,
+        SD_SCK_MHZ(STORAGE_SPI_CLOCK_MHZ),
         HWManager::GetSPIBus()
     );
 
+    /* Create the bus lock */
+    this->_busDepth = 0;
+    this->_busLock = xSemaphoreCreateRecursiveMutex();
+    if (nullptr == this->_busLock) {
+        PANIC("Failed to create the storage bus lock.\n");
+    }
+
     /* Init the SD card */
     if (!this->_sdCard.begin(config)) {
         PANIC(
@@ -114,17 +132,65 @@ Storage::~Storage(void) noexcept {
 FsFile Storage::Open(const char* kpPath, const oflag_t kpMode) noexcept {
     FsFile file;
 
-    file.open(kpPath, kpMode);
+    if (E_Return::NO_ERROR == AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        file.open(kpPath, kpMode);
+        ReleaseSPIBus();
+    }
 
     return file;
 }
 
 bool Storage::Remove(const char* kpPath) noexcept {
-    return this->_sdCard.remove(kpPath);
+    bool success;
+
+    success = false;
+    if (E_Return::NO_ERROR == AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        success = this->_sdCard.remove(kpPath);
+        ReleaseSPIBus();
+    }
+
+    return success;
 }
 
 void Storage::Format(void) noexcept {
-    if (!this->_sdCard.format()) {
-        PANIC("Failed to format SD Card.\n");
+    if (E_Return::NO_ERROR == AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        if (!this->_sdCard.format()) {
+            PANIC("Failed to format SD Card.\n");
+        }
+        ReleaseSPIBus();
+    }
+    else {
+        PANIC("Failed to acquire the storage bus.\n");
+    }
+}
+
+E_Return Storage::AcquireSPIBus(const uint64_t kTimeoutNs) noexcept {
+    E_Return error;
+
+    if (pdPASS == xSemaphoreTakeRecursive(
+                    this->_busLock,
+                    pdMS_TO_TICKS(kTimeoutNs / 1000000ULL))) {
+        ++this->_busDepth;
+        error = E_Return::NO_ERROR;
+    }
+    else {
+        error = E_Return::ERR_STORAGE_BUS_TIMEOUT;
+    }
+
+    return error;
+}
+
+void Storage::ReleaseSPIBus(void) noexcept {
+    --this->_busDepth;
+
+#if STORAGE_DEDICATED_SPI
+    /* End the multi-block transfers from the task that started them */
+    if (0 == this->_busDepth) {
+        this->_sdCard.card()->syncDevice();
+    }
+#endif
+
+    if (pdPASS != xSemaphoreGiveRecursive(this->_busLock)) {
+        PANIC("Failed to release the storage bus lock.\n");
     }
 }
\ No newline at end of file
@@ -21,9 +21,13 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
 /* Included headers */
-#include <BSP.h>           /* Hardware services */
+#include <HAL.h>           /* Hardware abstraction layer */
 #include <cstdint>         /* Standard int types */
+#include <cstring>         /* Standard memory functions */
 #include <Logger.h>        /* Logger services */
 #include <HealthMonitor.h> /* Health monitor watchdogs */
 
@@ -71,6 +75,8 @@
 /*******************************************************************************
  * CLASS METHODS
  ******************************************************************************/
+S_TimeoutStats Timeout::_SPSTATS[TIMEOUT_STATS_MAX];
+T_HALSpinLock Timeout::_SLOCK = HAL_SPINLOCK_INITIALIZER;
 
 Timeout::Timeout(const uint64_t kTimeoutNs,
                  const uint64_t kWatchdogNs /* = 0 */,
@@ -85,8 +91,9 @@ Timeout::Timeout(const uint64_t kTimeoutNs,
     this->_pWDHandler = pHandler;
     this->_nextWatchdogEvent = 0;
     this->_nextTimeEvent = 0;
-
-    Serial.flush();
+    this->_lastNotify = 0;
+    this->_wakeDeadline = 0;
+    this->_statsSlot = TIMEOUT_STATS_MAX;
 
     /* First tick */
     Notify();
@@ -114,6 +121,13 @@ Timeout::~Timeout(void) noexcept {
 
     LOG_DEBUG("Destroying timeout.\n");
 
+    /* Release the statistics slot, readers copy it under the lock */
+    if (TIMEOUT_STATS_MAX > this->_statsSlot) {
+        HAL::EnterCritical(Timeout::_SLOCK);
+        Timeout::_SPSTATS[this->_statsSlot].pName = nullptr;
+        HAL::ExitCritical(Timeout::_SLOCK);
+    }
+
     if (0 != this->_wdTimeout && nullptr != this->_pWDHandler) {
         pHM = SystemState::GetInstance()->GetHealthMonitor();
         error = pHM->RemoveWatchdog(this->_watchdogId);
@@ -127,9 +141,38 @@ Timeout::~Timeout(void) noexcept {
 }
 
 void Timeout::Notify(void) noexcept{
-    uint64_t currentTime;
+    Notify(HAL::GetTime());
+}
+
+void Timeout::Notify(const uint64_t kTime) noexcept{
+    S_TimeoutStats* pStats;
+    uint64_t        currentTime;
+    uint64_t        deadline;
+
+    currentTime = kTime;
 
-    currentTime = HWManager::GetTime();
+    /* Record the period of the last cycle */
+    if (TIMEOUT_STATS_MAX > this->_statsSlot && 0 != this->_lastNotify) {
+        pStats = &Timeout::_SPSTATS[this->_statsSlot];
+
+        /* Tickless tasks set their deadline, others use the nominal one */
+        deadline = this->_wakeDeadline;
+        if (0 == deadline) {
+            deadline = this->_lastNotify + pStats->periodNs;
+        }
+
+        HAL::EnterCritical(Timeout::_SLOCK);
+        RecordSample(pStats->period, currentTime - this->_lastNotify);
+        if (currentTime >= deadline) {
+            RecordSample(pStats->jitter, currentTime - deadline);
+        }
+        if (currentTime > this->_nextTimeEvent) {
+            ++pStats->overruns;
+        }
+        HAL::ExitCritical(Timeout::_SLOCK);
+    }
+    this->_lastNotify = currentTime;
+    this->_wakeDeadline = 0;
 
     this->_nextTimeEvent = currentTime + this->_timeout;
     if (0 != this->_wdTimeout) {
@@ -138,7 +181,11 @@ void Timeout::Notify(void) noexcept{
 }
 
 bool Timeout::HasTimedOut(void) const noexcept{
-    return (HWManager::GetTime() > this->_nextTimeEvent);
+    return HasTimedOut(HAL::GetTime());
+}
+
+bool Timeout::HasTimedOut(const uint64_t kTime) const noexcept{
+    return (kTime > this->_nextTimeEvent);
 }
 
 uint64_t Timeout::GetNextTimeEvent(void) const noexcept{
@@ -149,6 +196,150 @@ uint64_t Timeout::GetNextWatchdogEvent(void) const noexcept{
     return this->_nextWatchdogEvent;
 }
 
+void Timeout::NotifyEnd(void) noexcept {
+    uint64_t currentTime;
+
+    if (TIMEOUT_STATS_MAX > this->_statsSlot && 0 != this->_lastNotify) {
+        currentTime = HAL::GetTime();
+
+        HAL::EnterCritical(Timeout::_SLOCK);
+        RecordSample(
+            Timeout::_SPSTATS[this->_statsSlot].execution,
+            currentTime - this->_lastNotify
+        );
+        HAL::ExitCritical(Timeout::_SLOCK);
+    }
+}
+
+void Timeout::SetWakeDeadline(const uint64_t kTime) noexcept {
+    this->_wakeDeadline = kTime;
+}
+
+E_Return Timeout::EnableStats(const char*    pkName,
+                              const uint64_t kPeriodNs) noexcept {
+    E_Return        error;
+    S_TimeoutStats* pStats;
+    uint32_t        i;
+
+    error = E_Return::NO_ERROR;
+    if (TIMEOUT_STATS_MAX == this->_statsSlot) {
+        /* The first period starts on the next notification */
+        this->_lastNotify = 0;
+
+        /* Register in the first free slot */
+        HAL::EnterCritical(Timeout::_SLOCK);
+        for (i = 0;
+             TIMEOUT_STATS_MAX > i && TIMEOUT_STATS_MAX == this->_statsSlot;
+             ++i) {
+            pStats = &Timeout::_SPSTATS[i];
+            if (nullptr == pStats->pName) {
+                memset(pStats, 0, sizeof(S_TimeoutStats));
+                pStats->pName = pkName;
+                pStats->periodNs = kPeriodNs;
+                this->_statsSlot = i;
+            }
+        }
+        HAL::ExitCritical(Timeout::_SLOCK);
+
+        if (TIMEOUT_STATS_MAX == this->_statsSlot) {
+            LOG_ERROR("No free timeout statistics slot for %s.\n", pkName);
+            error = E_Return::ERR_MEMORY;
+        }
+    }
+
+    return error;
+}
+
+bool Timeout::GetStats(const uint32_t kIndex, S_TimeoutStats* pStats)
+noexcept {
+    bool isValid;
+
+    isValid = false;
+    if (TIMEOUT_STATS_MAX > kIndex) {
+        HAL::EnterCritical(Timeout::_SLOCK);
+        if (nullptr != Timeout::_SPSTATS[kIndex].pName) {
+            *pStats = Timeout::_SPSTATS[kIndex];
+            isValid = true;
+        }
+        HAL::ExitCritical(Timeout::_SLOCK);
+    }
+
+    return isValid;
+}
+
+uint64_t Timeout::GetPercentile(const S_TimeoutHistogram& krHistogram,
+                                const uint8_t             kPercent) noexcept {
+    uint64_t rank;
+    uint64_t total;
+    uint64_t upper;
+    uint32_t i;
+    uint32_t msb;
+
+    upper = 0;
+    if (0 != krHistogram.count) {
+        /* Find the bucket of the sample at the percentile rank */
+        rank = ((uint64_t)krHistogram.count * kPercent + 99) / 100;
+        if (0 == rank) {
+            rank = 1;
+        }
+        total = 0;
+        i = 0;
+        while (TIMEOUT_HIST_BUCKETS > i && total < rank) {
+            total += krHistogram.buckets[i];
+            ++i;
+        }
+
+        /* Get the upper bound of the bucket in microseconds */
+        i = i - 1;
+        if (4 > i) {
+            upper = i;
+        }
+        else {
+            msb = i / 4 + 1;
+            upper = ((uint64_t)(5 + i % 4) << (msb - 2)) - 1;
+        }
+        upper *= 1000;
+
+        if (upper > krHistogram.maxNs) {
+            upper = krHistogram.maxNs;
+        }
+        if (upper < krHistogram.minNs) {
+            upper = krHistogram.minNs;
+        }
+    }
+
+    return upper;
+}
+
+void Timeout::RecordSample(S_TimeoutHistogram& rHistogram,
+                           const uint64_t      kValueNs) noexcept {
+    uint64_t valueUs;
+    uint32_t index;
+    uint32_t msb;
+
+    /* Log-linear buckets, 2 bits of mantissa */
+    valueUs = kValueNs / 1000;
+    if (4 > valueUs) {
+        index = (uint32_t)valueUs;
+    }
+    else {
+        msb = 63 - __builtin_clzll(valueUs);
+        index = 4 * (msb - 1) + ((valueUs >> (msb - 2)) & 0x3);
+    }
+    if (TIMEOUT_HIST_BUCKETS <= index) {
+        index = TIMEOUT_HIST_BUCKETS - 1;
+    }
+    ++rHistogram.buckets[index];
+
+    if (0 == rHistogram.count || kValueNs < rHistogram.minNs) {
+        rHistogram.minNs = kValueNs;
+    }
+    if (kValueNs > rHistogram.maxNs) {
+        rHistogram.maxNs = kValueNs;
+    }
+    ++rHistogram.count;
+}
+
 void Timeout::ExecuteHandler(void) const noexcept{
     if (nullptr != this->_pWDHandler) {
         LOG_DEBUG("Executing timeout handler %d.\n", this->_watchdogId);
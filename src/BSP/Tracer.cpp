@@ -0,0 +1,355 @@
+/*******************************************************************************
+ * @file Tracer.cpp
+ *
+ * @see Tracer.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware events tracer.
+ *
+ * @details Firmware events tracer. The traced sections record timestamped
+ * begin and end events in per-core rings, the rings are exported as a
+ * timeline by the maintenance server and the API.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>   /* Atomic types */
+#include <cstdio>   /* Standard IO */
+#include <cstdint>  /* Standard integer definitions */
+#include <cstring>  /* String manipulation */
+#include <HAL.h>    /* Hardware abstraction layer */
+#include <Errors.h> /* Errors definitions */
+
+/* Header file */
+#include <Tracer.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the mask of the ring positions. */
+#define TRACE_RING_MASK (TRACE_RING_SIZE - 1)
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The traced sections names, by section. */
+static const char* spkEventNames[E_TraceEvent::TRACE_EVENT_COUNT] = {
+    "io_task",
+    "hm_rt_task",
+    "hm_action",
+    "web_page",
+    "api_route",
+    "log_serial",
+    "log_ram",
+    "log_journal"
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+S_TraceSlot* Tracer::_SPRINGS[TRACE_CORE_COUNT] = { nullptr };
+std::atomic<uint32_t> Tracer::_SPHEADS[TRACE_CORE_COUNT];
+std::atomic<uint32_t> Tracer::_SPSTARTS[TRACE_CORE_COUNT];
+std::atomic<bool> Tracer::_SISSTARTED(false);
+
+E_Return Tracer::Start(void) noexcept {
+    E_Return retCode;
+    uint32_t i;
+    uint32_t j;
+
+    retCode = E_Return::NO_ERROR;
+    for (i = 0; E_Return::NO_ERROR == retCode && TRACE_CORE_COUNT > i; ++i) {
+        if (nullptr == Tracer::_SPRINGS[i]) {
+            /* The rings are only allocated when tracing is used */
+            Tracer::_SPRINGS[i] = (S_TraceSlot*)HAL::Allocate(
+                sizeof(S_TraceSlot) * TRACE_RING_SIZE,
+                true
+            );
+            if (nullptr == Tracer::_SPRINGS[i]) {
+                retCode = E_Return::ERR_MEMORY;
+            }
+            else {
+                for (j = 0; TRACE_RING_SIZE > j; ++j) {
+                    Tracer::_SPRINGS[i][j].sequence.store(
+                        0,
+                        std::memory_order_relaxed
+                    );
+                }
+            }
+        }
+    }
+
+    if (E_Return::NO_ERROR == retCode) {
+        for (i = 0; TRACE_CORE_COUNT > i; ++i) {
+            Tracer::_SPSTARTS[i].store(
+                Tracer::_SPHEADS[i].load(std::memory_order_relaxed),
+                std::memory_order_relaxed
+            );
+        }
+
+        /* Publish the rings with the start */
+        Tracer::_SISSTARTED.store(true, std::memory_order_release);
+    }
+
+    return retCode;
+}
+
+void Tracer::Stop(void) noexcept {
+    Tracer::_SISSTARTED.store(false, std::memory_order_relaxed);
+}
+
+bool Tracer::IsStarted(void) noexcept {
+    return Tracer::_SISSTARTED.load(std::memory_order_relaxed);
+}
+
+void Tracer::Record(const E_TraceEvent kEvent,
+                    const E_TracePhase kPhase) noexcept {
+    S_TraceSlot* pSlot;
+    uint32_t     index;
+    uint8_t      core;
+
+    if (Tracer::_SISSTARTED.load(std::memory_order_acquire)) {
+        /* A preempted or migrated task only shares the claim counter */
+        core  = HAL::GetCoreId();
+        index = Tracer::_SPHEADS[core].fetch_add(
+            1,
+            std::memory_order_relaxed
+        );
+        pSlot = &Tracer::_SPRINGS[core][index & TRACE_RING_MASK];
+
+        /* The readers skip the slot until its new sequence is published */
+        pSlot->sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        pSlot->event.time  = HAL::GetTime();
+        pSlot->event.task  = (uintptr_t)HAL::GetCurrentTask();
+        pSlot->event.event = (uint8_t)kEvent;
+        pSlot->event.phase = (uint8_t)kPhase;
+        pSlot->event.core  = core;
+        pSlot->sequence.store(index + 1, std::memory_order_release);
+    }
+}
+
+void Tracer::OpenCursor(S_TraceCursor& rCursor) noexcept {
+    uint32_t start;
+    uint32_t end;
+    uint32_t i;
+
+    rCursor.core = 0;
+    rCursor.lost = 0;
+    for (i = 0; TRACE_CORE_COUNT > i; ++i) {
+        start = 0;
+        end   = 0;
+        if (nullptr != Tracer::_SPRINGS[i]) {
+            start = Tracer::_SPSTARTS[i].load(std::memory_order_relaxed);
+            end   = Tracer::_SPHEADS[i].load(std::memory_order_acquire);
+
+            /* Only the last ring of events is left */
+            if (TRACE_RING_SIZE < end - start) {
+                rCursor.lost += end - start - TRACE_RING_SIZE;
+                start = end - TRACE_RING_SIZE;
+            }
+        }
+        rCursor.pNext[i] = start;
+        rCursor.pEnd[i]  = end;
+    }
+}
+
+bool Tracer::ReadCursor(S_TraceCursor& rCursor,
+                        S_TraceEvent&  rEvent) noexcept {
+    S_TraceSlot* pSlot;
+    uint32_t     index;
+    uint32_t     sequence;
+    bool         isRead;
+
+    isRead = false;
+    while (!isRead && TRACE_CORE_COUNT > rCursor.core) {
+        if (rCursor.pEnd[rCursor.core] != rCursor.pNext[rCursor.core]) {
+            index = rCursor.pNext[rCursor.core]++;
+            pSlot = &Tracer::_SPRINGS[rCursor.core][index & TRACE_RING_MASK];
+
+            /* The event is valid if the slot was not rewritten meanwhile */
+            sequence = pSlot->sequence.load(std::memory_order_acquire);
+            rEvent   = pSlot->event;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            isRead = index + 1 == sequence &&
+                     sequence == pSlot->sequence.load(
+                         std::memory_order_relaxed
+                     );
+            if (!isRead) {
+                ++rCursor.lost;
+            }
+        }
+        else {
+            ++rCursor.core;
+        }
+    }
+
+    return isRead;
+}
+
+const char* Tracer::GetName(const uint8_t kEvent) noexcept {
+    const char* pkName;
+
+    pkName = "unknown";
+    if (E_TraceEvent::TRACE_EVENT_COUNT > kEvent) {
+        pkName = spkEventNames[kEvent];
+    }
+
+    return pkName;
+}
+
+void Tracer::OpenExport(S_TraceExport& rExport) noexcept {
+    /* The names are taken first, the tasks of the tail events are alive */
+    rExport.taskCount = HAL::GetTasks(rExport.pTasks, TRACE_MAX_TASKS);
+    rExport.task     = 0;
+    rExport.part     = E_TraceExportPart::TRACE_EXPORT_HEADER;
+    rExport.isFirst  = true;
+    rExport.itemSize = 0;
+    OpenCursor(rExport.cursor);
+}
+
+size_t Tracer::ReadExport(S_TraceExport& rExport,
+                          char*          pBuffer,
+                          const size_t   kSize) noexcept {
+    size_t size;
+    bool   isFull;
+
+    size   = 0;
+    isFull = false;
+    while (!isFull) {
+        if (0 == rExport.itemSize) {
+            rExport.itemSize = FormatItem(rExport);
+        }
+
+        /* The items are never split, an item left is sent on the next read */
+        if (0 != rExport.itemSize && kSize - size >= rExport.itemSize) {
+            memcpy(pBuffer + size, rExport.pItem, rExport.itemSize);
+            size += rExport.itemSize;
+            rExport.itemSize = 0;
+        }
+        else {
+            isFull = true;
+        }
+    }
+
+    return size;
+}
+
+size_t Tracer::FormatItem(S_TraceExport& rExport) noexcept {
+    S_TraceEvent event;
+    int          length;
+    bool         isFormatted;
+
+    length      = 0;
+    isFormatted = false;
+    while (!isFormatted) {
+        isFormatted = true;
+        switch (rExport.part) {
+            case E_TraceExportPart::TRACE_EXPORT_HEADER:
+                length = snprintf(
+                    rExport.pItem,
+                    sizeof(rExport.pItem),
+                    "{\"displayTimeUnit\":\"ns\",\"traceEvents\":["
+                    "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,"
+                    "\"args\":{\"name\":\"rthr\"}}"
+                );
+                rExport.isFirst = false;
+                rExport.part    = E_TraceExportPart::TRACE_EXPORT_TASKS;
+                break;
+            case E_TraceExportPart::TRACE_EXPORT_TASKS:
+                if (rExport.taskCount > rExport.task) {
+                    /* The tasks names are firmware names, not escaped */
+                    length = snprintf(
+                        rExport.pItem,
+                        sizeof(rExport.pItem),
+                        ",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                        "\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                        (unsigned long)(uintptr_t)
+                            rExport.pTasks[rExport.task].task,
+                        rExport.pTasks[rExport.task].pName
+                    );
+                    ++rExport.task;
+                }
+                else {
+                    rExport.part = E_TraceExportPart::TRACE_EXPORT_EVENTS;
+                    isFormatted  = false;
+                }
+                break;
+            case E_TraceExportPart::TRACE_EXPORT_EVENTS:
+                if (ReadCursor(rExport.cursor, event)) {
+                    /* The timestamps are in microseconds */
+                    length = snprintf(
+                        rExport.pItem,
+                        sizeof(rExport.pItem),
+                        ",{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03u,"
+                        "\"pid\":0,\"tid\":%lu,\"args\":{\"core\":%u}}",
+                        GetName(event.event),
+                        E_TracePhase::TRACE_PHASE_BEGIN == event.phase ?
+                            'B' :
+                            'E',
+                        (unsigned long long)(event.time / 1000ULL),
+                        (unsigned int)(event.time % 1000ULL),
+                        (unsigned long)event.task,
+                        (unsigned int)event.core
+                    );
+                }
+                else {
+                    rExport.part = E_TraceExportPart::TRACE_EXPORT_FOOTER;
+                    isFormatted  = false;
+                }
+                break;
+            case E_TraceExportPart::TRACE_EXPORT_FOOTER:
+                length = snprintf(
+                    rExport.pItem,
+                    sizeof(rExport.pItem),
+                    "],\"otherData\":{\"lost\":%lu}}",
+                    (unsigned long)rExport.cursor.lost
+                );
+                rExport.part = E_TraceExportPart::TRACE_EXPORT_DONE;
+                break;
+            default:
+                length = 0;
+                break;
+        }
+    }
+
+    return (0 < length && sizeof(rExport.pItem) > (size_t)length) ?
+        (size_t)length :
+        0;
+}
@@ -21,11 +21,16 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
 /* Included headers */
 #include <BSP.h>               /* BSP Layer */
 #include <string>              /* Standard string */
+#include <algorithm>           /* Standard algorithms */
 #include <WiFi.h>              /* WiFi services */
 #include <cstdint>             /* Standard integer definitions */
+#include <cstddef>             /* Standard definitions */
 #include <Errors.h>            /* Error definitions */
 #include <Logger.h>            /* Logger services */
 #include <Timeout.h>           /* Timeout manager */
@@ -35,6 +40,12 @@
 #include <WiFiValidator.h>     /* WiFi Settings validator */
 #include <WebServerHandlers.h> /* WebServer URL handlers */
 #include <APIServerHandlers.h> /* APIServer URL handlers */
+#include <KeepAliveServer.h>   /* Persistent connections server */
+#include <WiFiPower.h>         /* WiFi power-save scheduler */
+#include <TaskRegistry.h>      /* Firmware tasks registry */
+#include <lwip/sockets.h>      /* lwIP sockets readiness */
+#include <esp_wifi.h>          /* WiFi driver association */
+#include <rom/crc.h>           /* CRC32 services */
 
 /* Header file */
 #include <WiFiModule.h>
@@ -50,23 +61,22 @@
 
 /** @brief Connection timeout in nanoseconds. */
 #define NODE_CONNECT_TIMEOUT_NS 15000000000 // 15 seconds
+/** @brief Targeted connection timeout in nanoseconds. */
+#define NODE_FAST_CONNECT_TIMEOUT_NS 3000000000ULL
+/** @brief Connection status polling period in nanoseconds. */
+#define NODE_CONNECT_POLL_NS 50000000ULL
+/** @brief Defines the fast connect cache validity marker. */
+#define WIFI_FAST_CACHE_MAGIC 0x57464331
 
-/** @brief Defines the Web Server Task name. */
-#define WEB_SERVER_TASK_NAME "WEB-SRV_TASK"
-/** @brief Defines the Web Server Task stack size in bytes. */
-#define WEB_SERVER_TASK_STACK 4096
-/** @brief Defines the Web Server Task priority. */
-#define WEB_SERVER_TASK_PRIO (configMAX_PRIORITIES - 2)
-/** @brief Defines the Web Server Task mapped core. */
-#define WEB_SERVER_TASK_CORE 1
-/** @brief Defines the API Server Task name. */
-#define API_SERVER_TASK_NAME "API-SRV_TASK"
-/** @brief Defines the API Server Task stack size in bytes. */
-#define API_SERVER_TASK_STACK 4096
-/** @brief Defines the API Server Task priority. */
-#define API_SERVER_TASK_PRIO (configMAX_PRIORITIES - 2)
-/** @brief Defines the API Server Task mapped core. */
-#define API_SERVER_TASK_CORE 1
+/**
+ * @brief Defines the maximal time in microseconds the servers task blocks on
+ * the connected clients sockets waiting for data.
+ */
+#define WEB_SERVER_CLIENT_WAIT_US 50000
+/** @brief Defines the servers task idle wait after traffic in milliseconds. */
+#define WEB_SERVER_IDLE_MIN_MS 1
+/** @brief Defines the servers task maximal idle wait in milliseconds. */
+#define WEB_SERVER_IDLE_MAX_MS 16
 
 /** @brief Defines the WiFiModule Health Report period in nanoseconds. */
 #define WIFI_MODULE_HM_REPORT_PERIOD_NS 1000000000ULL
@@ -77,13 +87,42 @@
 /** @brief Defines the WiFiModule Health Report name. */
 #define WIFI_MODULE_HM_REPORT_NAME "HM_WIFIMODULE"
 
+/** @brief Defines the mask bit of a setting identifier. */
+#define WIFI_SETTING_MASK(ID) (1UL << (uint32_t)(ID))
+
+/** @brief Defines the settings applied by rebinding the servers. */
+#define WIFI_PORT_SETTINGS (                  \
+    WIFI_SETTING_MASK(SETTING_ID_WEB_PORT) |  \
+    WIFI_SETTING_MASK(SETTING_ID_API_PORT)    \
+)
+
 /** @brief Mininal accepted RSSI */
 #define WIFI_MIN_RSSI -80
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-/* None */
+/** @brief Last successful connection, kept in RTC memory across resets. */
+typedef struct {
+    /** @brief The validity marker. */
+    uint32_t magic;
+    /** @brief The CRC32 of the credentials used for the connection. */
+    uint32_t credentialsKey;
+    /** @brief The BSSID of the access point. */
+    uint8_t pBssid[6];
+    /** @brief The channel of the access point. */
+    int32_t channel;
+    /** @brief The DHCP leased address. */
+    uint32_t ip;
+    /** @brief The DHCP leased gateway. */
+    uint32_t gateway;
+    /** @brief The DHCP leased subnet mask. */
+    uint32_t subnet;
+    /** @brief The DHCP leased DNS server. */
+    uint32_t dns;
+    /** @brief The CRC32 of the previous fields. */
+    uint32_t checksum;
+} S_WiFiFastCache;
 
 /*******************************************************************************
  * MACROS
@@ -95,27 +134,36 @@
  * @details Gets the specified settings. An error to the HM is trigered in case
  * of failure and the default value is provided.
  *
- * @param[in] NAME The name of the settings to get.
+ * @param[in] ID The identifier of the settings to get.
  * @param[out] BUFFER The buffer that receives the setting value.
  * @param[in] SIZE The size of the setting.
  * @param[out] ERROR The error buffer.
  * @param[in] SETTINGS The settings object to use to retrieve the setting.
  */
-#define GET_SETTING(NAME, BUFFER, SIZE, ERROR, SETTINGS) {                   \
-    ERROR = SETTINGS->GetSettings(NAME, (uint8_t*)BUFFER, SIZE);             \
+#define GET_SETTING(ID, BUFFER, SIZE, ERROR, SETTINGS) {                     \
+    static_assert(SettingSize(ID) == SIZE, "Invalid setting size");          \
+    ERROR = SETTINGS->GetSetting(ID, (uint8_t*)BUFFER, SIZE);                \
     if (E_Return::NO_ERROR != ERROR) {                                       \
         if (E_Return::ERR_SETTING_NOT_FOUND == ERROR) {                      \
             LOG_ERROR(                                                       \
                 "Failed to get setting %s. Trying to get default.\n",        \
-                NAME                                                         \
+                SettingName(ID)                                              \
             );                                                               \
-            ERROR = SETTINGS->GetDefault(NAME, (uint8_t*)BUFFER, SIZE);      \
+            ERROR = SETTINGS->GetDefault(ID, (uint8_t*)BUFFER, SIZE);        \
             if (E_Return::NO_ERROR != ERROR) {                               \
-                PANIC("Failed to get setting %s. Error: %d\n", NAME, ERROR); \
+                PANIC(                                                       \
+                    "Failed to get setting %s. Error: %d\n",                 \
+                    SettingName(ID),                                         \
+                    ERROR                                                    \
+                );                                                           \
             }                                                                \
         }                                                                    \
         else {                                                               \
-            PANIC("Failed to get setting %s. Error: %d\n", NAME, ERROR);     \
+            PANIC(                                                           \
+                "Failed to get setting %s. Error: %d\n",                     \
+                SettingName(ID),                                             \
+                ERROR                                                        \
+            );                                                               \
         }                                                                    \
     }                                                                        \
 }
@@ -126,16 +174,21 @@
  * @details Sets the specified settings. An error to the HM is trigered in case
  * of failure.
  *
- * @param[in] NAME The name of the settings to set.
+ * @param[in] ID The identifier of the settings to set.
  * @param[out] BUFFER The buffer that contains the setting value.
  * @param[in] SIZE The size of the setting.
  * @param[out] ERROR The error buffer.
  * @param[in] SETTINGS The settings object to use to retrieve the setting.
  */
-#define SET_SETTING(NAME, BUFFER, SIZE, ERROR, SETTINGS) {              \
-    ERROR = SETTINGS->SetSettings(NAME, (uint8_t*)BUFFER, SIZE);        \
+#define SET_SETTING(ID, BUFFER, SIZE, ERROR, SETTINGS) {                \
+    static_assert(SettingSize(ID) == SIZE, "Invalid setting size");     \
+    ERROR = SETTINGS->SetSetting(ID, (uint8_t*)BUFFER, SIZE);           \
     if (E_Return::NO_ERROR != ERROR) {                                  \
-        PANIC("Failed to set setting %s. Error: %d\n", NAME, ERROR);    \
+        PANIC(                                                          \
+            "Failed to set setting %s. Error: %d\n",                    \
+            SettingName(ID),                                            \
+            ERROR                                                       \
+        );                                                              \
     }                                                                   \
 }
 
@@ -144,14 +197,69 @@
  * STATIC FUNCTIONS DECLARATIONS
  ******************************************************************************/
 /**
- * @brief Server handle client routine.
+ * @brief Servers handle client routine.
+ *
+ * @details Servers handle client routine. This routine serves the clients of
+ * all the servers from a single event loop.
+ *
+ * @param[in] pServers The servers set to use.
+ */
+static void WebServerHandleRoutine(void* pServers);
+
+/**
+ * @brief Waits for the current clients of the servers to be ready.
+ *
+ * @details Waits for the current clients of the servers to be ready. When
+ * clients are connected and none has pending data, the calling task blocks on
+ * the clients sockets until data is received, a client closes or
+ * WEB_SERVER_CLIENT_WAIT_US elapsed.
+ *
+ * @param[in] pServers The servers set to use.
+ *
+ * @return The function returns true if a client is connected, false if all
+ * the servers are idle.
+ */
+static bool WaitClientEvent(S_ServersSet* pServers) noexcept;
+
+/**
+ * @brief Returns the key of the node credentials.
+ *
+ * @details Returns the key of the node credentials. The key binds the fast
+ * connect cache to the network it was filled for.
+ *
+ * @param[in] krConfig The WiFi configuration.
+ *
+ * @return The CRC32 of the SSID and password is returned.
+ */
+static uint32_t GetCredentialsKey(const S_WiFiConfig& krConfig) noexcept;
+
+/**
+ * @brief Returns the checksum of the fast connect cache.
+ *
+ * @return The CRC32 of the cache fields, without the checksum, is returned.
+ */
+static uint32_t GetFastCacheChecksum(void) noexcept;
+
+/**
+ * @brief Tells if the fast connect cache can be used.
+ *
+ * @param[in] kCredentialsKey The key of the current credentials.
  *
- * @details Server handle client routine. This routine will handle new clients
- * to the server.
+ * @return true if the cache is valid and was filled with the same
+ * credentials, false otherwise.
+ */
+static bool IsFastCacheValid(const uint32_t kCredentialsKey) noexcept;
+
+/**
+ * @brief Formats an address of a parsed configuration as its setting.
  *
- * @param[in] pServer The server to use.
+ * @param[in] krConfig The parsed configuration.
+ * @param[in] kAddress The address to format.
+ * @param[out] pBuffer The setting buffer, empty when the address is not set.
  */
-static void WebServerHandleRoutine(void* pServer);
+static void FormatAddress(const S_WiFiParsedConfig& krConfig,
+                          const E_WiFiAddress       kAddress,
+                          char*                     pBuffer) noexcept;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -164,14 +272,156 @@ static void WebServerHandleRoutine(void* pServer);
 /* None */
 
 /************************** Static global variables ***************************/
-/* None */
+/**
+ * @brief The fast connect cache. The RTC memory is not initialized on reset,
+ * the content is validated by its marker and checksum.
+ */
+static RTC_NOINIT_ATTR S_WiFiFastCache sFastCache;
+
+/** @brief The settings applied by the WiFi module. */
+static const E_SettingId spkWiFiSettings[] = {
+    SETTING_ID_IS_AP,
+    SETTING_ID_NODE_SSID,
+    SETTING_ID_NODE_PASS,
+    SETTING_ID_NODE_STATIC,
+    SETTING_ID_NODE_ST_IP,
+    SETTING_ID_NODE_ST_GATE,
+    SETTING_ID_NODE_ST_SUBNET,
+    SETTING_ID_NODE_ST_PDNS,
+    SETTING_ID_NODE_ST_SDNS,
+    SETTING_ID_WEB_PORT,
+    SETTING_ID_API_PORT
+};
 
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
-static void WebServerHandleRoutine(void* pServer) {
+static void WebServerHandleRoutine(void* pServers) {
+    S_ServersSet* pSet;
+    uint32_t      idleWaitMs;
+    uint32_t      i;
+    bool          isConnected;
+
+    pSet = (S_ServersSet*)pServers;
+
+    /* The routine blocks on its own, disable the servers polling delay */
+    for (i = 0; nullptr != pSet->pServers[i]; ++i) {
+        pSet->pServers[i]->enableDelay(false);
+    }
+    idleWaitMs = WEB_SERVER_IDLE_MIN_MS;
+
     while (true) {
-        ((WebServer*)pServer)->handleClient();
+        /* Servers are dispatched by listening port */
+        for (i = 0; nullptr != pSet->pServers[i]; ++i) {
+            pSet->pServers[i]->handleClient();
+        }
+        pSet->pKeepAliveServer->HandleClients();
+        pSet->pEventStream->Update();
+
+        /* The responses are sent, apply the committed settings */
+        pSet->pModule->ApplySettingsChanges();
+
+        /* Connected clients keep the radio awake */
+        isConnected = WaitClientEvent(pSet);
+        pSet->pPower->Update(isConnected);
+
+        if (isConnected) {
+            idleWaitMs = WEB_SERVER_IDLE_MIN_MS;
+        }
+        else {
+            /* The listening socket is not exposed, back off while idle */
+            vTaskDelay(pdMS_TO_TICKS(idleWaitMs));
+            idleWaitMs = std::min(
+                idleWaitMs * 2,
+                (uint32_t)WEB_SERVER_IDLE_MAX_MS
+            );
+        }
+    }
+}
+
+static bool WaitClientEvent(S_ServersSet* pServers) noexcept {
+    WiFiClient     client;
+    fd_set         readSet;
+    struct timeval timeout;
+    int            socket;
+    int            maxSocket;
+    bool           isConnected;
+    bool           hasData;
+    uint32_t       i;
+
+    FD_ZERO(&readSet);
+    maxSocket = -1;
+    isConnected = false;
+    hasData = false;
+    for (i = 0; nullptr != pServers->pServers[i]; ++i) {
+        client = pServers->pServers[i]->client();
+        if (client.connected()) {
+            isConnected = true;
+            hasData |= (0 != client.available());
+            socket = client.fd();
+            if (0 <= socket) {
+                FD_SET(socket, &readSet);
+                maxSocket = std::max(maxSocket, socket);
+            }
+        }
+    }
+    isConnected |= pServers->pKeepAliveServer->AddWaitSockets(
+        readSet,
+        maxSocket,
+        hasData
+    );
+
+    /* Only block when no client can progress */
+    if (!hasData && 0 <= maxSocket) {
+        timeout.tv_sec = 0;
+        timeout.tv_usec = WEB_SERVER_CLIENT_WAIT_US;
+        select(maxSocket + 1, &readSet, nullptr, nullptr, &timeout);
+    }
+
+    return isConnected;
+}
+
+static uint32_t GetCredentialsKey(const S_WiFiConfig& krConfig) noexcept {
+    uint32_t key;
+
+    key = crc32_le(
+        0,
+        (const uint8_t*)krConfig.ssid,
+        strnlen(krConfig.ssid, SSID_SIZE_BYTES)
+    );
+    key = crc32_le(
+        key,
+        (const uint8_t*)krConfig.password,
+        strnlen(krConfig.password, PASS_SIZE_BYTES)
+    );
+
+    return key;
+}
+
+static uint32_t GetFastCacheChecksum(void) noexcept {
+    return crc32_le(
+        0,
+        (const uint8_t*)&sFastCache,
+        offsetof(S_WiFiFastCache, checksum)
+    );
+}
+
+static bool IsFastCacheValid(const uint32_t kCredentialsKey) noexcept {
+    return WIFI_FAST_CACHE_MAGIC == sFastCache.magic &&
+           kCredentialsKey == sFastCache.credentialsKey &&
+           GetFastCacheChecksum() == sFastCache.checksum;
+}
+
+static void FormatAddress(const S_WiFiParsedConfig& krConfig,
+                          const E_WiFiAddress       kAddress,
+                          char*                     pBuffer) noexcept {
+    memset(pBuffer, 0, IP_ADDR_SIZE_BYTES + 1);
+    if (krConfig.pIsSet[kAddress]) {
+        (void)ip4addr_ntoa_r(
+            &krConfig.pAddresses[kAddress],
+            pBuffer,
+            IP_ADDR_SIZE_BYTES + 1
+        );
     }
 }
 
@@ -182,7 +432,9 @@ static void WebServerHandleRoutine(void* pServer) {
 WiFiModule::WiFiModule(void) noexcept
 {
     HealthMonitor* pHM;
+    Settings*      pSettings;
     E_Return       result;
+    uint32_t       i;
 
     /* Setup the WiFi service as Access Point with the provided SSID and
     * password
@@ -196,12 +448,44 @@ WiFiModule::WiFiModule(void) noexcept
     memset(this->_config.subnet, 0, IP_ADDR_SIZE_BYTES + 1);
     memset(this->_config.primaryDNS, 0, IP_ADDR_SIZE_BYTES + 1);
     memset(this->_config.secondaryDNS, 0, IP_ADDR_SIZE_BYTES + 1);
+    memset(&this->_storedConfig, 0, sizeof(S_WiFiParsedConfig));
 
     /* Set as not started */
     this->_isStarted = false;
+    this->_isLeaseReused = false;
+    this->_isLinkUp = false;
 
     this->_pWebServer = nullptr;
     this->_pAPIServer = nullptr;
+    this->_servers.pServers[0] = nullptr;
+    this->_servers.pServers[1] = nullptr;
+    this->_servers.pKeepAliveServer = nullptr;
+    this->_servers.pEventStream = nullptr;
+    this->_servers.pPower = nullptr;
+    this->_servers.pModule = nullptr;
+
+    this->_pPower = new WiFiPower();
+    if (nullptr == this->_pPower) {
+        PANIC("Failed to create the WiFi power-save scheduler.\n");
+    }
+
+    /* Get notified of the WiFi settings changes, after each commit */
+    this->_pendingSettings = 0;
+    pSettings = SystemState::GetInstance()->GetSettings();
+    for (i = 0; sizeof(spkWiFiSettings) / sizeof(E_SettingId) > i; ++i) {
+        result = pSettings->Subscribe(
+            spkWiFiSettings[i],
+            OnSettingChange,
+            this
+        );
+        if (E_Return::NO_ERROR != result) {
+            PANIC(
+                "Failed to subscribe to setting %s. Error %d\n",
+                SettingName(spkWiFiSettings[i]),
+                result
+            );
+        }
+    }
 
     pHM = SystemState::GetInstance()->GetHealthMonitor();
 
@@ -237,116 +521,12 @@ WiFiModule::~WiFiModule(void) noexcept {
 }
 
 E_Return WiFiModule::Start(void) noexcept {
-    E_Return  error;
-    Settings* pSettings;
+    E_Return error;
 
     LOG_DEBUG("Starting WiFi module.\n");
 
     if (!this->_isStarted) {
-        pSettings = SystemState::GetInstance()->GetSettings();
-        /* Check if we should be AP */
-        GET_SETTING(
-            SETTING_IS_AP,
-            &this->_config.isAP,
-            sizeof(bool),
-            error,
-            pSettings
-        );
-
-        /* Check the AP Type */
-        memset(this->_config.ssid, 0, SSID_SIZE_BYTES + 1);
-        memset(this->_config.password, 0, PASS_SIZE_BYTES + 1);
-
-        if (!this->_config.isAP) {
-            LOG_INFO("Starting WiFi as node.\n");
-
-            memset(this->_config.ip, 0, IP_ADDR_SIZE_BYTES + 1);
-            memset(this->_config.gateway, 0, IP_ADDR_SIZE_BYTES + 1);
-            memset(this->_config.subnet, 0, IP_ADDR_SIZE_BYTES + 1);
-            memset(this->_config.primaryDNS, 0, IP_ADDR_SIZE_BYTES + 1);
-            memset(this->_config.secondaryDNS, 0, IP_ADDR_SIZE_BYTES + 1);
-
-            /* Get the node SSID */
-            GET_SETTING(
-                SETTING_NODE_SSID,
-                this->_config.ssid,
-                SSID_SIZE_BYTES,
-                error,
-                pSettings
-            );
-
-            /* Get the node password */
-            GET_SETTING(
-                SETTING_NODE_PASS,
-                this->_config.password,
-                PASS_SIZE_BYTES,
-                error,
-                pSettings
-            );
-
-            /* Get the static configuration */
-            GET_SETTING(
-                SETTING_NODE_STATIC,
-                &this->_config.isStatic,
-                sizeof(bool),
-                error,
-                pSettings
-            );
-            GET_SETTING(
-                SETTING_NODE_ST_IP,
-                this->_config.ip,
-                IP_ADDR_SIZE_BYTES,
-                error,
-                pSettings
-            );
-            GET_SETTING(
-                SETTING_NODE_ST_GATE,
-                this->_config.gateway,
-                IP_ADDR_SIZE_BYTES,
-                error,
-                pSettings
-            );
-            GET_SETTING(
-                SETTING_NODE_ST_SUBNET,
-                this->_config.subnet,
-                IP_ADDR_SIZE_BYTES,
-                error,
-                pSettings
-            );
-            GET_SETTING(
-                SETTING_NODE_ST_PDNS,
-                this->_config.primaryDNS,
-                IP_ADDR_SIZE_BYTES,
-                error,
-                pSettings
-            );
-            GET_SETTING(
-                SETTING_NODE_ST_SDNS,
-                this->_config.secondaryDNS,
-                IP_ADDR_SIZE_BYTES,
-                error,
-                pSettings
-            );
-
-            /* Start the node */
-            error = StartNode();
-        }
-        else {
-            LOG_INFO("Starting WiFi as AP.\n");
-
-            memcpy(
-                this->_config.ssid,
-                HWManager::GetHWUID(),
-                strnlen(HWManager::GetHWUID(), SSID_SIZE_BYTES)
-            );
-            memcpy(
-                this->_config.password,
-                HWManager::GetMacAddress(),
-                strnlen(HWManager::GetMacAddress(), PASS_SIZE_BYTES)
-            );
-            error = StartAP();
-        }
-
+        error = StartNetwork(SystemState::GetInstance()->GetSettings());
         if (E_Return::NO_ERROR == error) {
             this->_isStarted = true;
         }
@@ -367,11 +547,12 @@ E_Return WiFiModule::StartWebServers(void) noexcept {
 
     LOG_DEBUG("Starting Web Servers.\n");
 
-    /* Get the ports from settings */
+    /* Get the ports from settings, with their pending changes */
+    this->_pendingSettings &= (uint32_t)~WIFI_PORT_SETTINGS;
     pSettings = SystemState::GetInstance()->GetSettings();
 
     GET_SETTING(
-        SETTING_WEB_PORT,
+        SETTING_ID_WEB_PORT,
         &this->_config.webPort,
         sizeof(uint16_t),
         result,
@@ -379,7 +560,7 @@ E_Return WiFiModule::StartWebServers(void) noexcept {
     );
 
     GET_SETTING(
-        SETTING_API_PORT,
+        SETTING_ID_API_PORT,
         &this->_config.apiPort,
         sizeof(uint16_t),
         result,
@@ -403,7 +584,7 @@ E_Return WiFiModule::StartWebServers(void) noexcept {
             delete this->_pAPIServer;
             this->_pAPIServer = nullptr;
         }
-        this->_pAPIServer = new WebServer(this->_config.apiPort);
+        this->_pAPIServer = new KeepAliveServer(this->_config.apiPort);
 
         if (nullptr == this->_pAPIServer) {
             LOG_ERROR("Failed to instanciate the API server.\n");
@@ -446,9 +627,10 @@ void WiFiModule::GetConfiguration(S_WiFiConfig* pConfig) const noexcept {
 
 E_Return WiFiModule::SetConfiguration(const S_WiFiConfigRequest& krConfig)
 noexcept {
-    E_Return  result;
-    Settings* pSettings;
-    uint8_t   buffer[64];
+    E_Return           result;
+    Settings*          pSettings;
+    S_WiFiParsedConfig config;
+    char               pAddress[IP_ADDR_SIZE_BYTES + 1];
 
     LOG_DEBUG("Setting new WiFi configuration.\n");
     LOG_DEBUG(
@@ -477,131 +659,117 @@ noexcept {
         krConfig.apiPort.first
     );
 
-    result = ValidateConfiguration(krConfig);
+    pSettings = SystemState::GetInstance()->GetSettings();
 
-    /* Once all is valid, stop the servers */
-    if (E_Return::NO_ERROR == result) {
-        pSettings = SystemState::GetInstance()->GetSettings();
+    /* The commits of other modules may have changed the stored settings */
+    if (0 != this->_pendingSettings) {
+        LoadStoredConfiguration(pSettings);
+    }
 
+    result = ValidateConfiguration(krConfig, config);
+
+    /* Skip the commit of a stored configuration */
+    if (E_Return::NO_ERROR == result &&
+        config.hash == this->_storedConfig.hash &&
+        0 == memcmp(&config, &this->_storedConfig, sizeof(config))) {
+        LOG_INFO("WiFi settings unchanged.\n");
+    }
+    /* Once all is valid, save the configuration */
+    else if (E_Return::NO_ERROR == result) {
         LOG_DEBUG("Applying new WiFi configuration.\n");
 
-        /* Apply the configuration */
         SET_SETTING(
-            SETTING_IS_AP,
-            &krConfig.isAP.first,
+            SETTING_ID_IS_AP,
+            &config.isAP,
             sizeof(bool),
             result,
             pSettings
         );
-        memset(buffer, 0, sizeof(buffer));
-        memcpy(buffer, krConfig.ssid.first.c_str(), krConfig.ssid.first.size());
         SET_SETTING(
-            SETTING_NODE_SSID,
-            buffer,
+            SETTING_ID_NODE_SSID,
+            config.ssid,
             SSID_SIZE_BYTES,
             result,
             pSettings
         );
-        memset(buffer, 0, sizeof(buffer));
-        memcpy(
-            buffer,
-            krConfig.password.first.c_str(),
-            krConfig.password.first.size()
-        );
         SET_SETTING(
-            SETTING_NODE_PASS,
-            buffer,
+            SETTING_ID_NODE_PASS,
+            config.password,
             PASS_SIZE_BYTES,
             result,
             pSettings
         );
         SET_SETTING(
-            SETTING_NODE_STATIC,
-            &krConfig.isStatic.first,
+            SETTING_ID_NODE_STATIC,
+            &config.isStatic,
             sizeof(bool),
             result,
             pSettings
         );
-        memset(buffer, 0, sizeof(buffer));
-        memcpy(buffer, krConfig.ip.first.c_str(), krConfig.ip.first.size());
+        FormatAddress(config, E_WiFiAddress::WIFI_ADDR_IP, pAddress);
         SET_SETTING(
-            SETTING_NODE_ST_IP,
-            buffer,
+            SETTING_ID_NODE_ST_IP,
+            pAddress,
             IP_ADDR_SIZE_BYTES,
             result,
             pSettings
         );
-        memset(buffer, 0, sizeof(buffer));
-        memcpy(
-            buffer,
-            krConfig.gateway.first.c_str(),
-            krConfig.gateway.first.size()
-        );
+        FormatAddress(config, E_WiFiAddress::WIFI_ADDR_GATEWAY, pAddress);
         SET_SETTING(
-            SETTING_NODE_ST_GATE,
-            buffer,
+            SETTING_ID_NODE_ST_GATE,
+            pAddress,
             IP_ADDR_SIZE_BYTES,
             result,
             pSettings
         );
-        memset(buffer, 0, sizeof(buffer));
-        memcpy(
-            buffer,
-            krConfig.subnet.first.c_str(),
-            krConfig.subnet.first.size()
-        );
+        FormatAddress(config, E_WiFiAddress::WIFI_ADDR_SUBNET, pAddress);
         SET_SETTING(
-            SETTING_NODE_ST_SUBNET,
-            buffer,
+            SETTING_ID_NODE_ST_SUBNET,
+            pAddress,
             IP_ADDR_SIZE_BYTES,
             result,
             pSettings
         );
-        memset(buffer, 0, sizeof(buffer));
-        memcpy(
-            buffer,
-            krConfig.primaryDNS.first.c_str(),
-            krConfig.primaryDNS.first.size()
-        );
+        FormatAddress(config, E_WiFiAddress::WIFI_ADDR_PRIMARY_DNS, pAddress);
         SET_SETTING(
-            SETTING_NODE_ST_PDNS,
-            buffer,
+            SETTING_ID_NODE_ST_PDNS,
+            pAddress,
             IP_ADDR_SIZE_BYTES,
             result,
             pSettings
         );
-        memset(buffer, 0, sizeof(buffer));
-        memcpy(
-            buffer,
-            krConfig.secondaryDNS.first.c_str(),
-            krConfig.secondaryDNS.first.size()
+        FormatAddress(
+            config,
+            E_WiFiAddress::WIFI_ADDR_SECONDARY_DNS,
+            pAddress
         );
         SET_SETTING(
-            SETTING_NODE_ST_SDNS,
-            buffer,
+            SETTING_ID_NODE_ST_SDNS,
+            pAddress,
             IP_ADDR_SIZE_BYTES,
             result,
             pSettings
         );
         SET_SETTING(
-            SETTING_WEB_PORT,
-            &krConfig.webPort.first,
+            SETTING_ID_WEB_PORT,
+            &config.webPort,
             sizeof(uint16_t),
             result,
             pSettings
         );
         SET_SETTING(
-            SETTING_API_PORT,
-            &krConfig.apiPort.first,
+            SETTING_ID_API_PORT,
+            &config.apiPort,
             sizeof(uint16_t),
             result,
             pSettings
         );
         result = pSettings->Commit();
 
+        /* The changes are applied by the servers task after the response */
         if (E_Return::NO_ERROR == result) {
-            LOG_INFO("WiFi settings updated, rebooting...\n");
-            HWManager::Reboot(false);
+            memcpy(&this->_storedConfig, &config, sizeof(config));
+            LOG_INFO("WiFi settings updated.\n");
         }
         else {
             PANIC("Error while commiting WiFi settings. Error %d\n", result);
@@ -611,6 +779,228 @@ noexcept {
     return result;
 }
 
+E_Return WiFiModule::SetLatencyBudget(const uint16_t kBudgetMs) noexcept {
+    E_Return  result;
+    Settings* pSettings;
+
+    LOG_DEBUG("Setting WiFi latency budget to %d ms.\n", kBudgetMs);
+
+    if (WIFI_PS_MAX_BUDGET_MS < kBudgetMs) {
+        LOG_ERROR("Invalid WiFi latency budget: %d ms.\n", kBudgetMs);
+        result = E_Return::ERR_WIFI_INVALID_LATENCY;
+    }
+    else {
+        pSettings = SystemState::GetInstance()->GetSettings();
+        SET_SETTING(
+            SETTING_ID_WIFI_LAT_MS,
+            &kBudgetMs,
+            sizeof(uint16_t),
+            result,
+            pSettings
+        );
+        result = pSettings->Commit();
+
+        /* The interval applies at the next association, no restart */
+        if (E_Return::NO_ERROR == result) {
+            this->_pPower->SetLatencyBudget(
+                this->_config.isAP ? 0 : kBudgetMs
+            );
+        }
+        else {
+            LOG_ERROR(
+                "Failed to commit the latency budget. Error %d\n",
+                result
+            );
+        }
+    }
+
+    return result;
+}
+
+WiFiPower* WiFiModule::GetPower(void) const noexcept {
+    return this->_pPower;
+}
+
+bool WiFiModule::IsLinkUp(void) const noexcept {
+    return this->_isLinkUp;
+}
+
+void WiFiModule::ApplySettingsChanges(void) noexcept {
+    Settings* pSettings;
+    E_Return  error;
+    uint32_t  pending;
+
+    pending = this->_pendingSettings.exchange(0);
+    if (0 != pending) {
+        pSettings = SystemState::GetInstance()->GetSettings();
+        LoadStoredConfiguration(pSettings);
+
+        /* The listening sockets are rebound, open connections are kept */
+        if (0 != (pending & WIFI_SETTING_MASK(SETTING_ID_WEB_PORT))) {
+            this->_config.webPort = this->_storedConfig.webPort;
+            LOG_INFO("Web server moved to port %d.\n", this->_config.webPort);
+            this->_pWebServer->stop();
+            this->_pWebServer->begin(this->_config.webPort);
+        }
+        if (0 != (pending & WIFI_SETTING_MASK(SETTING_ID_API_PORT))) {
+            this->_config.apiPort = this->_storedConfig.apiPort;
+            LOG_INFO("API server moved to port %d.\n", this->_config.apiPort);
+            this->_pAPIServer->stop();
+            this->_pAPIServer->begin(this->_config.apiPort);
+        }
+
+        /* The other settings change the network, restart it */
+        if (0 != (pending & ~WIFI_PORT_SETTINGS)) {
+            LOG_INFO("WiFi network settings changed, restarting network.\n");
+
+            /* No background reconnection during the restart */
+            this->_isStarted = false;
+            WiFi.softAPdisconnect(true);
+            WiFi.disconnect(true);
+
+            error = StartNetwork(pSettings);
+            if (E_Return::NO_ERROR != error) {
+                LOG_ERROR(
+                    "Failed to restart the WiFi network. Error %d\n",
+                    error
+                );
+            }
+            this->_isStarted = true;
+        }
+    }
+}
+
+E_Return WiFiModule::StartNetwork(Settings* pSettings) noexcept {
+    E_Return error;
+    uint16_t budgetMs;
+
+    /* The network settings read here include their pending changes */
+    this->_pendingSettings &= WIFI_PORT_SETTINGS;
+    LoadStoredConfiguration(pSettings);
+
+    /* Check if we should be AP */
+    GET_SETTING(
+        SETTING_ID_IS_AP,
+        &this->_config.isAP,
+        sizeof(bool),
+        error,
+        pSettings
+    );
+
+    /*
+     * The access point serves its stations, it never sleeps. The budget
+     * is set before the association that reads its listen interval.
+     */
+    GET_SETTING(
+        SETTING_ID_WIFI_LAT_MS,
+        &budgetMs,
+        sizeof(uint16_t),
+        error,
+        pSettings
+    );
+    this->_pPower->SetLatencyBudget(this->_config.isAP ? 0 : budgetMs);
+
+    /* Check the AP Type */
+    memset(this->_config.ssid, 0, SSID_SIZE_BYTES + 1);
+    memset(this->_config.password, 0, PASS_SIZE_BYTES + 1);
+
+    if (!this->_config.isAP) {
+        LOG_INFO("Starting WiFi as node.\n");
+
+        memset(this->_config.ip, 0, IP_ADDR_SIZE_BYTES + 1);
+        memset(this->_config.gateway, 0, IP_ADDR_SIZE_BYTES + 1);
+        memset(this->_config.subnet, 0, IP_ADDR_SIZE_BYTES + 1);
+        memset(this->_config.primaryDNS, 0, IP_ADDR_SIZE_BYTES + 1);
+        memset(this->_config.secondaryDNS, 0, IP_ADDR_SIZE_BYTES + 1);
+
+        /* Get the node SSID */
+        GET_SETTING(
+            SETTING_ID_NODE_SSID,
+            this->_config.ssid,
+            SSID_SIZE_BYTES,
+            error,
+            pSettings
+        );
+
+        /* Get the node password */
+        GET_SETTING(
+            SETTING_ID_NODE_PASS,
+            this->_config.password,
+            PASS_SIZE_BYTES,
+            error,
+            pSettings
+        );
+
+        /* Get the static configuration */
+        GET_SETTING(
+            SETTING_ID_NODE_STATIC,
+            &this->_config.isStatic,
+            sizeof(bool),
+            error,
+            pSettings
+        );
+        GET_SETTING(
+            SETTING_ID_NODE_ST_IP,
+            this->_config.ip,
+            IP_ADDR_SIZE_BYTES,
+            error,
+            pSettings
+        );
+        GET_SETTING(
+            SETTING_ID_NODE_ST_GATE,
+            this->_config.gateway,
+            IP_ADDR_SIZE_BYTES,
+            error,
+            pSettings
+        );
+        GET_SETTING(
+            SETTING_ID_NODE_ST_SUBNET,
+            this->_config.subnet,
+            IP_ADDR_SIZE_BYTES,
+            error,
+            pSettings
+        );
+        GET_SETTING(
+            SETTING_ID_NODE_ST_PDNS,
+            this->_config.primaryDNS,
+            IP_ADDR_SIZE_BYTES,
+            error,
+            pSettings
+        );
+        GET_SETTING(
+            SETTING_ID_NODE_ST_SDNS,
+            this->_config.secondaryDNS,
+            IP_ADDR_SIZE_BYTES,
+            error,
+            pSettings
+        );
+
+        /* Start the node */
+        error = StartNode();
+    }
+    else {
+        LOG_INFO("Starting WiFi as AP.\n");
+
+        this->_config.isStatic = false;
+
+        memcpy(
+            this->_config.ssid,
+            HWManager::GetHWUID(),
+            strnlen(HWManager::GetHWUID(), SSID_SIZE_BYTES)
+        );
+        memcpy(
+            this->_config.password,
+            HWManager::GetMacAddress(),
+            strnlen(HWManager::GetMacAddress(), PASS_SIZE_BYTES)
+        );
+        error = StartAP();
+    }
+
+    this->_isLinkUp = (E_Return::NO_ERROR == error && !this->_config.isAP);
+
+    return error;
+}
+
 E_Return WiFiModule::StartAP(void) noexcept {
     bool        retVal;
     E_Return    error;
@@ -652,8 +1042,9 @@ E_Return WiFiModule::StartAP(void) noexcept {
 
 E_Return WiFiModule::StartNode(void) noexcept {
     E_Return    error;
-    Timeout     connTimeout(NODE_CONNECT_TIMEOUT_NS);
     bool        wifiStatus;
+    bool        isConnected;
+    uint32_t    credentialsKey;
     IPAddress   ipAddr;
     IPAddress   gatewayIpAddr;
     IPAddress   subnetAddr;
@@ -687,15 +1078,26 @@ E_Return WiFiModule::StartNode(void) noexcept {
             error = E_Return::ERR_WIFI_CONN;
         }
     }
+    else {
+        /* Null addresses restore the DHCP client after a static restart */
+        WiFi.config(IPAddress(), IPAddress(), IPAddress());
+    }
     if (E_Return::NO_ERROR == error) {
-        /* Connect to existing network */
-        WiFi.begin(this->_config.ssid, this->_config.password);
-        connTimeout.Notify();
-        while (WL_CONNECTED != WiFi.status() && !connTimeout.HasTimedOut()) {
-            HWManager::DelayExecNs(500000000);
+        /* Try the last access point first, the scan is skipped */
+        credentialsKey = GetCredentialsKey(this->_config);
+        isConnected = false;
+        this->_isLeaseReused = false;
+        if (IsFastCacheValid(credentialsKey)) {
+            isConnected = ConnectFast();
         }
 
-        if (WL_CONNECTED == WiFi.status()) {
+        /* Full scan and association */
+        if (!isConnected) {
+            BeginStation(0, nullptr);
+            isConnected = WaitConnection(NODE_CONNECT_TIMEOUT_NS);
+        }
+
+        if (isConnected) {
             ip = WiFi.localIP().toString();
             memset(this->_config.ip, 0, IP_ADDR_SIZE_BYTES + 1);
             memcpy(this->_config.ip, ip.c_str(), ip.length());
@@ -704,6 +1106,7 @@ E_Return WiFiModule::StartNode(void) noexcept {
             LOG_INFO("    SSID: %s\n", this->_config.ssid);
             LOG_INFO("    IP Address: %s\n", this->_config.ip);
 
+            SaveFastConnect(credentialsKey);
             error = E_Return::NO_ERROR;
         }
         else {
@@ -715,6 +1118,124 @@ E_Return WiFiModule::StartNode(void) noexcept {
     return error;
 }
 
+bool WiFiModule::ConnectFast(void) noexcept {
+    bool isConnected;
+    bool isLeaseUsed;
+
+    LOG_DEBUG(
+        "Fast connect on channel %d.\n",
+        (int)sFastCache.channel
+    );
+
+    /* The cached lease skips the DHCP exchange */
+    isLeaseUsed = false;
+#if WIFI_FAST_CONNECT_REUSE_LEASE
+    if (!this->_config.isStatic && 0 != sFastCache.ip) {
+        isLeaseUsed = WiFi.config(
+            IPAddress(sFastCache.ip),
+            IPAddress(sFastCache.gateway),
+            IPAddress(sFastCache.subnet),
+            IPAddress(sFastCache.dns)
+        );
+    }
+#endif
+
+    BeginStation(sFastCache.channel, sFastCache.pBssid);
+    isConnected = WaitConnection(NODE_FAST_CONNECT_TIMEOUT_NS);
+    this->_isLeaseReused = isLeaseUsed && isConnected;
+
+    if (!isConnected) {
+        LOG_INFO("Fast connect failed, scanning for the network.\n");
+
+        /* The access point moved, the cache is not reused */
+        sFastCache.magic = 0;
+        WiFi.disconnect();
+        if (isLeaseUsed) {
+            /* Null addresses restore the DHCP client */
+            WiFi.config(IPAddress(), IPAddress(), IPAddress());
+        }
+    }
+
+    return isConnected;
+}
+
+bool WiFiModule::WaitConnection(const uint64_t kTimeoutNs) const noexcept {
+    Timeout connTimeout(kTimeoutNs);
+
+    connTimeout.Notify();
+    while (WL_CONNECTED != WiFi.status() && !connTimeout.HasTimedOut()) {
+        HWManager::DelayExecNs(NODE_CONNECT_POLL_NS);
+    }
+
+    return WL_CONNECTED == WiFi.status();
+}
+
+void WiFiModule::SaveFastConnect(const uint32_t kCredentialsKey) noexcept {
+    const uint8_t* kpBssid;
+
+    kpBssid = WiFi.BSSID();
+    if (nullptr != kpBssid) {
+        sFastCache.magic = WIFI_FAST_CACHE_MAGIC;
+        sFastCache.credentialsKey = kCredentialsKey;
+        memcpy(sFastCache.pBssid, kpBssid, sizeof(sFastCache.pBssid));
+        sFastCache.channel = WiFi.channel();
+
+        /*
+         * Static configurations have no lease to reuse. A reused lease was
+         * not renewed by DHCP, it is dropped so the next connection runs DHCP.
+         */
+        if (this->_config.isStatic || this->_isLeaseReused) {
+            sFastCache.ip = 0;
+            sFastCache.gateway = 0;
+            sFastCache.subnet = 0;
+            sFastCache.dns = 0;
+        }
+        else {
+            sFastCache.ip = (uint32_t)WiFi.localIP();
+            sFastCache.gateway = (uint32_t)WiFi.gatewayIP();
+            sFastCache.subnet = (uint32_t)WiFi.subnetMask();
+            sFastCache.dns = (uint32_t)WiFi.dnsIP(0);
+        }
+        sFastCache.checksum = GetFastCacheChecksum();
+    }
+}
+
+void WiFiModule::StartReconnect(void) noexcept {
+    if (this->_isStarted &&
+        !this->_config.isAP &&
+        WL_CONNECTED != WiFi.status()) {
+        /* The association is started without waiting for it */
+        if (IsFastCacheValid(GetCredentialsKey(this->_config))) {
+            LOG_INFO("Reconnecting to the last access point.\n");
+            BeginStation(sFastCache.channel, sFastCache.pBssid);
+        }
+        else {
+            LOG_INFO("Reconnecting to network %s.\n", this->_config.ssid);
+            BeginStation(0, nullptr);
+        }
+    }
+}
+
+void WiFiModule::BeginStation(const int32_t  kChannel,
+                              const uint8_t* kpBssid) noexcept {
+    esp_err_t error;
+
+    /* The configuration is applied without connecting */
+    WiFi.begin(
+        this->_config.ssid,
+        this->_config.password,
+        kChannel,
+        kpBssid,
+        false
+    );
+    this->_pPower->ConfigureStation();
+
+    error = esp_wifi_connect();
+    if (ESP_OK != error) {
+        LOG_ERROR("Failed to start the WiFi association. Error %d\n", error);
+    }
+}
+
 E_Return WiFiModule::ConfigureServers(void) noexcept {
     E_Return result;
 
@@ -740,55 +1261,46 @@ E_Return WiFiModule::ConfigureServers(void) noexcept {
 }
 
 E_Return WiFiModule::ConfigureServerTasks(void) noexcept {
-    E_Return  result;
-    BaseType_t createRes;
+    E_Return result;
+    bool     isCreated;
 
-    LOG_DEBUG("Creating Web and API server handlers tasks.\n");
+    LOG_DEBUG("Creating Web and API servers task.\n");
 
-    /* Start the web server task */
-    createRes = xTaskCreatePinnedToCore(
+    /* Both servers are served by the same event loop */
+    this->_servers.pServers[0] = this->_pWebServer;
+    this->_servers.pServers[1] = nullptr;
+    this->_servers.pKeepAliveServer = this->_pAPIServer;
+    this->_servers.pEventStream = this->_pWebServerHandler->GetEventStream();
+    this->_servers.pPower = this->_pPower;
+    this->_servers.pModule = this;
+
+    isCreated = TaskRegistry::CreateTask(
+        E_TaskId::TASK_ID_SERVERS,
         WebServerHandleRoutine,
-        WEB_SERVER_TASK_NAME,
-        WEB_SERVER_TASK_STACK,
-        this->_pWebServer,
-        WEB_SERVER_TASK_PRIO,
-        &this->_pWebServerTask,
-        WEB_SERVER_TASK_CORE
+        &this->_servers,
+        this->_pServersTask
     );
-    if (pdPASS == createRes) {
-        /* Start the API server task */
-        createRes = xTaskCreatePinnedToCore(
-            WebServerHandleRoutine,
-            API_SERVER_TASK_NAME,
-            API_SERVER_TASK_STACK,
-            this->_pAPIServer,
-            API_SERVER_TASK_PRIO,
-            &this->_pAPIServerTask,
-            API_SERVER_TASK_CORE
-        );
-        if (pdPASS != createRes) {
-            /* Delete the first task */
-            vTaskDelete(this->_pWebServerTask);
-
-            LOG_ERROR("Failed to create the API handler task.\n");
-            result = E_Return::ERR_API_SERVER_TASK;
-        }
-        else {
-            result = E_Return::NO_ERROR;
-        }
+    if (isCreated) {
+        result = E_Return::NO_ERROR;
     }
     else {
-        LOG_ERROR("Failed to create the web handler task.\n");
+        LOG_ERROR("Failed to create the servers task.\n");
         result = E_Return::ERR_WEB_SERVER_TASK;
     }
 
     return result;
 }
 
-E_Return WiFiModule::ValidateConfiguration(const S_WiFiConfigRequest& krConfig)
+E_Return WiFiModule::ValidateConfiguration(const S_WiFiConfigRequest& krConfig,
+                                           S_WiFiParsedConfig&        rConfig)
 const noexcept {
 
     E_Return result;
+    bool     isStatic;
+
+    /* The padding is part of the hash */
+    memset(&rConfig, 0, sizeof(S_WiFiParsedConfig));
+    isStatic = krConfig.isStatic.first;
 
     /* Validate the new switches */
     if (!WiFiValidator::ValidateSwitches(krConfig)) {
@@ -803,19 +1315,45 @@ const noexcept {
         result = E_Return::ERR_WIFI_INVALID_PASSWORD;
     }
     /* Validate the new IP */
-    else if (!WiFiValidator::ValidateIP(krConfig)) {
+    else if (!WiFiValidator::ParseAddress(
+                 krConfig.ip,
+                 isStatic,
+                 E_WiFiAddress::WIFI_ADDR_IP,
+                 rConfig
+             )) {
         result = E_Return::ERR_WIFI_INVALID_IP;
     }
     /* Validate the new gateway */
-    else if (!WiFiValidator::ValidateGateway(krConfig)) {
+    else if (!WiFiValidator::ParseAddress(
+                 krConfig.gateway,
+                 isStatic,
+                 E_WiFiAddress::WIFI_ADDR_GATEWAY,
+                 rConfig
+             )) {
         result = E_Return::ERR_WIFI_INVALID_GATEWAY;
     }
     /* Validate the new subnet */
-    else if (!WiFiValidator::ValidateSubnet(krConfig)) {
+    else if (!WiFiValidator::ParseAddress(
+                 krConfig.subnet,
+                 isStatic,
+                 E_WiFiAddress::WIFI_ADDR_SUBNET,
+                 rConfig
+             )) {
         result = E_Return::ERR_WIFI_INVALID_SUBNET;
     }
     /* Validate the new primary and secondary dns */
-    else if (!WiFiValidator::ValidateDNS(krConfig)) {
+    else if (!WiFiValidator::ParseAddress(
+                 krConfig.primaryDNS,
+                 isStatic,
+                 E_WiFiAddress::WIFI_ADDR_PRIMARY_DNS,
+                 rConfig
+             ) ||
+             !WiFiValidator::ParseAddress(
+                 krConfig.secondaryDNS,
+                 isStatic,
+                 E_WiFiAddress::WIFI_ADDR_SECONDARY_DNS,
+                 rConfig
+             )) {
         result = E_Return::ERR_WIFI_INVALID_DNS;
     }
     /* Validate the new web and api ports */
@@ -823,12 +1361,134 @@ const noexcept {
         result = E_Return::ERR_WIFI_INVALID_PORTS;
     }
     else {
+        /* The sizes were validated, the strings stay null-terminated */
+        rConfig.isAP = krConfig.isAP.first;
+        rConfig.isStatic = isStatic;
+        memcpy(
+            rConfig.ssid,
+            krConfig.ssid.first.c_str(),
+            krConfig.ssid.first.size()
+        );
+        memcpy(
+            rConfig.password,
+            krConfig.password.first.c_str(),
+            krConfig.password.first.size()
+        );
+        rConfig.webPort = krConfig.webPort.first;
+        rConfig.apiPort = krConfig.apiPort.first;
+        rConfig.hash = WiFiValidator::Hash(rConfig);
         result = E_Return::NO_ERROR;
     }
 
     return result;
 }
 
+void WiFiModule::LoadStoredConfiguration(Settings* pSettings) noexcept {
+    E_Return result;
+    char     pAddresses[E_WiFiAddress::WIFI_ADDR_COUNT][IP_ADDR_SIZE_BYTES + 1];
+    uint8_t  i;
+
+    memset(&this->_storedConfig, 0, sizeof(S_WiFiParsedConfig));
+    memset(pAddresses, 0, sizeof(pAddresses));
+
+    GET_SETTING(
+        SETTING_ID_IS_AP,
+        &this->_storedConfig.isAP,
+        sizeof(bool),
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_NODE_SSID,
+        this->_storedConfig.ssid,
+        SSID_SIZE_BYTES,
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_NODE_PASS,
+        this->_storedConfig.password,
+        PASS_SIZE_BYTES,
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_NODE_STATIC,
+        &this->_storedConfig.isStatic,
+        sizeof(bool),
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_NODE_ST_IP,
+        pAddresses[E_WiFiAddress::WIFI_ADDR_IP],
+        IP_ADDR_SIZE_BYTES,
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_NODE_ST_GATE,
+        pAddresses[E_WiFiAddress::WIFI_ADDR_GATEWAY],
+        IP_ADDR_SIZE_BYTES,
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_NODE_ST_SUBNET,
+        pAddresses[E_WiFiAddress::WIFI_ADDR_SUBNET],
+        IP_ADDR_SIZE_BYTES,
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_NODE_ST_PDNS,
+        pAddresses[E_WiFiAddress::WIFI_ADDR_PRIMARY_DNS],
+        IP_ADDR_SIZE_BYTES,
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_NODE_ST_SDNS,
+        pAddresses[E_WiFiAddress::WIFI_ADDR_SECONDARY_DNS],
+        IP_ADDR_SIZE_BYTES,
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_WEB_PORT,
+        &this->_storedConfig.webPort,
+        sizeof(uint16_t),
+        result,
+        pSettings
+    );
+    GET_SETTING(
+        SETTING_ID_API_PORT,
+        &this->_storedConfig.apiPort,
+        sizeof(uint16_t),
+        result,
+        pSettings
+    );
+
+    /* Empty or invalid stored addresses are not set */
+    for (i = 0; E_WiFiAddress::WIFI_ADDR_COUNT > i; ++i) {
+        this->_storedConfig.pIsSet[i] = WiFiValidator::ParseIp(
+            pAddresses[i],
+            this->_storedConfig.pAddresses[i]
+        );
+    }
+    this->_storedConfig.hash = WiFiValidator::Hash(this->_storedConfig);
+}
+
+void WiFiModule::OnSettingChange(const E_SettingId kId, void* pArgs)
+noexcept {
+    WiFiModule* pModule;
+
+    pModule = (WiFiModule*)pArgs;
+
+    LOG_DEBUG("WiFi setting %s changed.\n", SettingName(kId));
+    pModule->_pendingSettings |= WIFI_SETTING_MASK(kId);
+}
+
 WiFiModuleHealthReporter::WiFiModuleHealthReporter(
     const S_HMReporterParam& krParam,
     WiFiModule*              pModule) noexcept :
@@ -845,6 +1505,9 @@ void WiFiModuleHealthReporter::OnDegraded(void) noexcept {
         "WiFi module is degraded, expecting to recover before unhealthy"
         " status.\n"
     );
+
+    /* Recover in the background, the restart is kept for unhealthy */
+    this->_pModule->StartReconnect();
 }
 
 void WiFiModuleHealthReporter::OnUnhealthy(void) noexcept {
@@ -860,6 +1523,7 @@ void WiFiModuleHealthReporter::OnUnhealthy(void) noexcept {
         WiFi.disconnect();
     }
     this->_pModule->_isStarted = false;
+    this->_pModule->_isLinkUp = false;
 
     /* Restart */
     result = this->_pModule->Start();
@@ -881,9 +1545,13 @@ bool WiFiModuleHealthReporter::PerformCheck(void) noexcept {
         if (checkResult) {
             checkResult &= WiFi.RSSI() >= WIFI_MIN_RSSI;
         }
+
+        /* The publishers buffer their traffic while the link is down */
+        this->_pModule->_isLinkUp = checkResult;
     }
     else {
         checkResult &= this->_pModule->_isStarted;
+        this->_pModule->_isLinkUp = false;
     }
 
     return checkResult;
@@ -0,0 +1,268 @@
+/*******************************************************************************
+ * @file WiFiPower.cpp
+ *
+ * @see WiFiPower.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief WiFi power-save scheduler.
+ *
+ * @details WiFi power-save scheduler. The radio sleeps between the AP beacons
+ * within a request latency budget and is kept fully awake during the API and
+ * web sessions. The residency in each state gives the estimated current draw.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
+/* Included headers */
+#include <cstdint>    /* Standard integer definitions */
+#include <algorithm>  /* std::min, std::max */
+#include <BSP.h>      /* Time services */
+#include <Logger.h>   /* Logger services */
+#include <esp_wifi.h> /* WiFi driver power save */
+
+/* Header file */
+#include <WiFiPower.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+WiFiPower::WiFiPower(void) noexcept {
+    this->_budgetMs = 0;
+    this->_budgetInterval = 0;
+    this->_listenInterval = 0;
+    this->_isAwake = true;
+    this->_lastUpdate = HWManager::GetTime();
+    this->_lastActivity = this->_lastUpdate;
+    this->_awakeNs = 0;
+    this->_sleepNs = 0;
+    this->_charge = 0;
+    this->_wakeups = 0;
+    this->_responses = 0;
+    this->_serviceNs = 0;
+    this->_serviceMaxNs = 0;
+}
+
+void WiFiPower::SetLatencyBudget(const uint16_t kBudgetMs) noexcept {
+    uint64_t currentTime;
+
+    currentTime = HWManager::GetTime();
+    Account(currentTime);
+
+    this->_budgetMs = kBudgetMs;
+    this->_budgetInterval = GetListenInterval(kBudgetMs);
+
+    /* The power save restarts when the current session ends */
+    ApplyState(true);
+    this->_lastActivity = currentTime;
+
+    LOG_INFO(
+        "WiFi latency budget %d ms, listen interval %d.\n",
+        kBudgetMs,
+        this->_budgetInterval
+    );
+}
+
+void WiFiPower::ConfigureStation(void) noexcept {
+    wifi_config_t config;
+    esp_err_t     error;
+
+    error = esp_wifi_get_config(WIFI_IF_STA, &config);
+    if (ESP_OK == error) {
+        config.sta.listen_interval = this->_budgetInterval;
+        error = esp_wifi_set_config(WIFI_IF_STA, &config);
+    }
+
+    if (ESP_OK == error) {
+        this->_listenInterval = this->_budgetInterval;
+    }
+    else {
+        LOG_ERROR("Failed to set the listen interval. Error %d\n", error);
+        this->_listenInterval = 0;
+    }
+}
+
+void WiFiPower::Update(const bool kIsActive) noexcept {
+    uint64_t currentTime;
+
+    currentTime = HWManager::GetTime();
+    Account(currentTime);
+
+    if (kIsActive) {
+        this->_lastActivity = currentTime;
+        if (!this->_isAwake) {
+            ApplyState(true);
+            ++this->_wakeups;
+        }
+    }
+    else if (this->_isAwake &&
+             0 != this->_budgetInterval &&
+             0 != this->_listenInterval &&
+             WIFI_PS_IDLE_NS <= currentTime - this->_lastActivity) {
+        ApplyState(false);
+    }
+}
+
+void WiFiPower::RecordResponse(const uint64_t kDurationNs) noexcept {
+    ++this->_responses;
+    this->_serviceNs += kDurationNs;
+    this->_serviceMaxNs = std::max(this->_serviceMaxNs, kDurationNs);
+}
+
+void WiFiPower::GetStats(S_WiFiPowerStats& rStats) noexcept {
+    uint64_t totalUs;
+    uint32_t periodUs;
+
+    Account(HWManager::GetTime());
+
+    rStats.budgetMs = this->_budgetMs;
+    rStats.listenInterval = this->_listenInterval;
+    rStats.isAwake = this->_isAwake;
+    rStats.awakeMs = this->_awakeNs / 1000000ULL;
+    rStats.sleepMs = this->_sleepNs / 1000000ULL;
+    rStats.wakeups = this->_wakeups;
+    rStats.sleepCurrentUa = GetSleepCurrent(this->_listenInterval);
+
+    totalUs = (this->_awakeNs + this->_sleepNs) / 1000ULL;
+    if (0 != totalUs) {
+        rStats.avgCurrentUa = (uint32_t)(this->_charge / totalUs);
+    }
+    else {
+        rStats.avgCurrentUa = WIFI_POWER_RX_UA;
+    }
+
+    /* The first frame of a session waits for the next listened beacon */
+    periodUs = this->_listenInterval * WIFI_PS_BEACON_INTERVAL_US;
+    rStats.wakeLatencyAvgUs = periodUs / 2;
+    rStats.wakeLatencyMaxUs = periodUs;
+
+    rStats.responses = this->_responses;
+    if (0 != this->_responses) {
+        rStats.serviceAvgUs = (uint32_t)(
+            this->_serviceNs / this->_responses / 1000ULL
+        );
+    }
+    else {
+        rStats.serviceAvgUs = 0;
+    }
+    rStats.serviceMaxUs = (uint32_t)(this->_serviceMaxNs / 1000ULL);
+}
+
+uint16_t WiFiPower::GetListenInterval(const uint16_t kBudgetMs) noexcept {
+    uint32_t interval;
+
+    interval = (uint32_t)kBudgetMs * 1000 / WIFI_PS_BEACON_INTERVAL_US;
+
+    return (uint16_t)std::min(
+        interval,
+        (uint32_t)WIFI_PS_MAX_LISTEN_INTERVAL
+    );
+}
+
+uint32_t WiFiPower::GetSleepCurrent(const uint16_t kListenInterval)
+noexcept {
+    uint64_t periodUs;
+    uint64_t wakeUs;
+    uint32_t current;
+
+    if (0 == kListenInterval) {
+        current = WIFI_POWER_RX_UA;
+    }
+    else {
+        /* The radio is awake for each listened beacon only */
+        periodUs = (uint64_t)kListenInterval * WIFI_PS_BEACON_INTERVAL_US;
+        wakeUs = std::min((uint64_t)WIFI_POWER_BEACON_WAKE_US, periodUs);
+        current = WIFI_POWER_SLEEP_UA + (uint32_t)(
+            (uint64_t)(WIFI_POWER_RX_UA - WIFI_POWER_SLEEP_UA) *
+            wakeUs / periodUs
+        );
+    }
+
+    return current;
+}
+
+void WiFiPower::Account(const uint64_t kTime) noexcept {
+    uint64_t elapsed;
+    uint32_t current;
+
+    elapsed = kTime - this->_lastUpdate;
+    if (this->_isAwake) {
+        this->_awakeNs += elapsed;
+        current = WIFI_POWER_RX_UA;
+    }
+    else {
+        this->_sleepNs += elapsed;
+        current = GetSleepCurrent(this->_listenInterval);
+    }
+    this->_charge += elapsed / 1000ULL * current;
+    this->_lastUpdate = kTime;
+}
+
+void WiFiPower::ApplyState(const bool kIsAwake) noexcept {
+    wifi_ps_type_t mode;
+    esp_err_t      error;
+
+    /* The listen interval of the association is used by the modem sleep */
+    if (kIsAwake) {
+        mode = WIFI_PS_NONE;
+    }
+    else {
+        mode = WIFI_PS_MAX_MODEM;
+    }
+
+    error = esp_wifi_set_ps(mode);
+    if (ESP_OK != error) {
+        LOG_ERROR("Failed to set the WiFi power save. Error %d\n", error);
+    }
+
+    this->_isAwake = kIsAwake;
+}
@@ -22,8 +22,11 @@
  ******************************************************************************/
 
 /* Included headers */
-#include <cstdint>      /* Standard integer definitions */
-#include <WiFiModule.h> /* WiFi module configuration */
+#include <HAL.h>           /* Hardware abstraction layer */
+#include <cstdint>         /* Standard integer definitions */
+#include <cstddef>         /* Standard definitions */
+#include <WiFiModule.h>    /* WiFi module configuration */
+#include <lwip/ip4_addr.h> /* lwIP IPv4 addresses */
 
 /* Header file */
 #include <WiFiValidator.h>
@@ -120,80 +123,55 @@ noexcept {
 }
 
 bool WiFiValidator::ValidateIP(const S_WiFiConfigRequest& krConfig) noexcept {
-    /* Check if static, allow empty */
-    if (!krConfig.isStatic.first &&
-        (!krConfig.ip.second || 0 == krConfig.ip.first.size())) {
-        return true;
-    }
-
-    /* Check if set */
-    if (!krConfig.ip.second) {
-        return false;
-    }
-    /* Check content */
-    return CheckIpFormat(krConfig.ip.first.c_str());
+    S_WiFiParsedConfig config;
+
+    return ParseAddress(
+        krConfig.ip,
+        krConfig.isStatic.first,
+        E_WiFiAddress::WIFI_ADDR_IP,
+        config
+    );
 }
 
 bool WiFiValidator::ValidateGateway(const S_WiFiConfigRequest& krConfig)
 noexcept {
-    /* Check if static, allow empty */
-    if (!krConfig.isStatic.first &&
-        (!krConfig.gateway.second || 0 == krConfig.gateway.first.size())) {
-        return true;
-    }
-
-    /* Check if set */
-    if (!krConfig.gateway.second) {
-        return false;
-    }
-
-    /* Check content */
-    return CheckIpFormat(krConfig.gateway.first.c_str());
+    S_WiFiParsedConfig config;
+
+    return ParseAddress(
+        krConfig.gateway,
+        krConfig.isStatic.first,
+        E_WiFiAddress::WIFI_ADDR_GATEWAY,
+        config
+    );
 }
 
 bool WiFiValidator::ValidateSubnet(const S_WiFiConfigRequest& krConfig)
 noexcept {
-    /* Check if static, allow empty */
-    if (!krConfig.isStatic.first &&
-        (!krConfig.subnet.second || 0 == krConfig.subnet.first.size())) {
-        return true;
-    }
-
-    /* Check if set */
-    if (!krConfig.subnet.second) {
-        return false;
-    }
-
-    /* Check content */
-    return CheckIpFormat(krConfig.subnet.first.c_str());
+    S_WiFiParsedConfig config;
+
+    return ParseAddress(
+        krConfig.subnet,
+        krConfig.isStatic.first,
+        E_WiFiAddress::WIFI_ADDR_SUBNET,
+        config
+    );
 }
 
 bool WiFiValidator::ValidateDNS(const S_WiFiConfigRequest& krConfig) noexcept {
-    /* Check if static, allow empty */
-    if (!krConfig.isStatic.first) {
-        if (krConfig.primaryDNS.second &&
-            0 != krConfig.primaryDNS.first.size()) {
-            if (!CheckIpFormat(krConfig.primaryDNS.first.c_str())) {
-                return false;
-            }
-        }
-        if (krConfig.secondaryDNS.second &&
-            0 != krConfig.secondaryDNS.first.size()) {
-            if (!CheckIpFormat(krConfig.secondaryDNS.first.c_str())) {
-                return false;
-            }
-        }
-        return true;
-    }
-
-    /* Check if set */
-    if (!krConfig.primaryDNS.second || !krConfig.secondaryDNS.second) {
-        return false;
-    }
-
-    /* Check content */
-    return CheckIpFormat(krConfig.primaryDNS.first.c_str()) &&
-           CheckIpFormat(krConfig.secondaryDNS.first.c_str());
+    S_WiFiParsedConfig config;
+
+    return ParseAddress(
+               krConfig.primaryDNS,
+               krConfig.isStatic.first,
+               E_WiFiAddress::WIFI_ADDR_PRIMARY_DNS,
+               config
+           ) &&
+           ParseAddress(
+               krConfig.secondaryDNS,
+               krConfig.isStatic.first,
+               E_WiFiAddress::WIFI_ADDR_SECONDARY_DNS,
+               config
+           );
 }
 
 bool WiFiValidator::ValidatePorts(const S_WiFiConfigRequest& krConfig)
@@ -211,41 +189,79 @@ noexcept {
     return true;
 }
 
-bool WiFiValidator::CheckIpFormat(const char* kpIp) noexcept {
+bool WiFiValidator::ParseAddress(const std::pair<APIString, bool>& krAddress,
+                                 const bool                        kIsStatic,
+                                 const E_WiFiAddress               kAddress,
+                                 S_WiFiParsedConfig&               rConfig)
+noexcept {
+    bool isValid;
+
+    /* Check if static, allow empty */
+    if (!kIsStatic && (!krAddress.second || 0 == krAddress.first.size())) {
+        ip4_addr_set_zero(&rConfig.pAddresses[kAddress]);
+        rConfig.pIsSet[kAddress] = false;
+        isValid = true;
+    }
+    /* Check if set and parse the content */
+    else if (krAddress.second &&
+             ParseIp(krAddress.first.c_str(), rConfig.pAddresses[kAddress])) {
+        rConfig.pIsSet[kAddress] = true;
+        isValid = true;
+    }
+    else {
+        isValid = false;
+    }
+
+    return isValid;
+}
+
+bool WiFiValidator::ParseIp(const char* kpIp, ip4_addr_t& rAddress) noexcept {
+    uint8_t  pNibles[3];
     char     current;
     uint8_t  dots;
     uint32_t nible;
+    bool     isValid;
 
     dots = 0;
     nible = 0;
-    while (*kpIp) {
+    isValid = true;
+    while (isValid && '\0' != *kpIp) {
         current = *kpIp++;
         if ('0' <= current && '9' >= current) {
             nible = nible * 10 + (current - '0');
 
             /* Out of range */
-            if (255 < nible) {
-                return false;
-            }
+            isValid = 255 >= nible;
         }
-        else if (current == '.') {
-            /* Too many dots */
-            if (3 == dots) {
-                return false;
-            }
-            ++dots;
+        else if ('.' == current && 3 > dots) {
+            pNibles[dots++] = (uint8_t)nible;
             nible = 0;
         }
         else {
-            /* Invalid character */
-            return false;
+            /* Invalid character or too many dots */
+            isValid = false;
         }
     }
 
     /* Incorrect number of dots */
-    if (3 != dots) {
-        return false;
+    isValid = isValid && 3 == dots;
+    if (isValid) {
+        IP4_ADDR(
+            &rAddress,
+            pNibles[0],
+            pNibles[1],
+            pNibles[2],
+            (uint8_t)nible
+        );
     }
 
-    return true;
-}
\ No newline at end of file
+    return isValid;
+}
+
+uint32_t WiFiValidator::Hash(const S_WiFiParsedConfig& krConfig) noexcept {
+    return HAL::Crc32(
+        0,
+        (const uint8_t*)&krConfig,
+        offsetof(S_WiFiParsedConfig, hash)
+    );
+}
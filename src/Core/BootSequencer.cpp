@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * @file BootSequencer.cpp
+ *
+ * @see BootSequencer.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Dependency ordered boot sequencer.
+ *
+ * @details Dependency ordered boot sequencer. The boot is described as a table
+ * of stages with their dependencies, the stages that do not depend on each
+ * other are executed at the same time on their core.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstdint>                 /* Standard integer definitions */
+#include <BSP.h>                   /* Time services */
+#include <Errors.h>                /* Errors definitions */
+#include <Logger.h>                /* Logger services */
+#include <Arduino.h>               /* Arduino framework */
+#include <freertos/event_groups.h> /* FreeRTOS event groups */
+
+/* Header file */
+#include <BootSequencer.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+BootSequencer::BootSequencer(const S_BootStage* kpStages,
+                             const uint32_t     kStageCount) noexcept {
+    uint32_t i;
+
+    if (BOOT_MAX_STAGES < kStageCount) {
+        PANIC("Too many boot stages: %d.\n", kStageCount);
+    }
+
+    this->_pkStages = kpStages;
+    this->_stageCount = kStageCount;
+    for (i = 0; kStageCount > i; ++i) {
+        this->_pContexts[i].pSequencer = this;
+        this->_pContexts[i].index = i;
+        this->_pContexts[i].result = E_Return::NO_ERROR;
+        this->_pContexts[i].startTime = 0;
+        this->_pContexts[i].endTime = 0;
+    }
+
+    this->_events = xEventGroupCreate();
+    if (nullptr == this->_events) {
+        PANIC("Failed to create the boot sequencer events.\n");
+    }
+}
+
+BootSequencer::~BootSequencer(void) noexcept {
+    vEventGroupDelete(this->_events);
+}
+
+E_Return BootSequencer::Run(uint32_t& rFailedStage) noexcept {
+    E_Return    result;
+    BaseType_t  createRes;
+    UBaseType_t priority;
+    uint64_t    startTime;
+    uint32_t    allMask;
+    uint32_t    i;
+
+    /* The stages run at the priority of the booting task */
+    priority = uxTaskPriorityGet(nullptr);
+    startTime = HWManager::GetTime();
+    allMask = 0;
+
+    /* All the tasks are created, each one waits for its dependencies */
+    for (i = 0; this->_stageCount > i; ++i) {
+        allMask |= BOOT_DEPENDS_ON(i);
+        createRes = xTaskCreatePinnedToCore(
+            StageRoutine,
+            this->_pkStages[i].pkName,
+            BOOT_STAGE_STACK,
+            &this->_pContexts[i],
+            priority,
+            nullptr,
+            this->_pkStages[i].core
+        );
+        if (pdPASS != createRes) {
+            PANIC(
+                "Failed to create the boot stage task %s.\n",
+                this->_pkStages[i].pkName
+            );
+        }
+    }
+
+    xEventGroupWaitBits(this->_events, allMask, pdFALSE, pdTRUE, portMAX_DELAY);
+
+    /* Dependencies come first, the first error is a root failure */
+    result = E_Return::NO_ERROR;
+    for (i = 0; this->_stageCount > i; ++i) {
+        LOG_DEBUG(
+            "Boot stage %s: started at %llu us, took %llu us.\n",
+            this->_pkStages[i].pkName,
+            (this->_pContexts[i].startTime - startTime) / 1000ULL,
+            (this->_pContexts[i].endTime -
+             this->_pContexts[i].startTime) / 1000ULL
+        );
+        if (E_Return::NO_ERROR == result &&
+            E_Return::NO_ERROR != this->_pContexts[i].result) {
+            result = this->_pContexts[i].result;
+            rFailedStage = i;
+        }
+    }
+
+    LOG_INFO(
+        "Boot stages completed in %llu us.\n",
+        (HWManager::GetTime() - startTime) / 1000ULL
+    );
+
+    return result;
+}
+
+void BootSequencer::StageRoutine(void* pContext) noexcept {
+    S_BootStageContext* pStage;
+    BootSequencer*      pSequencer;
+    const S_BootStage*  kpDesc;
+    uint32_t            i;
+
+    pStage = (S_BootStageContext*)pContext;
+    pSequencer = pStage->pSequencer;
+    kpDesc = &pSequencer->_pkStages[pStage->index];
+
+    if (0 != kpDesc->dependencies) {
+        xEventGroupWaitBits(
+            pSequencer->_events,
+            kpDesc->dependencies,
+            pdFALSE,
+            pdTRUE,
+            portMAX_DELAY
+        );
+    }
+
+    /* A failed dependency skips the stage, its error is propagated */
+    pStage->result = E_Return::NO_ERROR;
+    for (i = 0; pStage->index > i; ++i) {
+        if (0 != (kpDesc->dependencies & BOOT_DEPENDS_ON(i)) &&
+            E_Return::NO_ERROR != pSequencer->_pContexts[i].result) {
+            pStage->result = pSequencer->_pContexts[i].result;
+        }
+    }
+
+    pStage->startTime = HWManager::GetTime();
+    if (E_Return::NO_ERROR == pStage->result) {
+        pStage->result = kpDesc->routine();
+    }
+    else {
+        LOG_ERROR("Skipped boot stage %s.\n", kpDesc->pkName);
+    }
+    pStage->endTime = HWManager::GetTime();
+
+    /* The event group orders the result before the completion */
+    xEventGroupSetBits(pSequencer->_events, BOOT_DEPENDS_ON(pStage->index));
+
+    vTaskDelete(nullptr);
+}
@@ -13,6 +13,8 @@
  *
  * @details Weather Station Firmware default setting repository. This file 
  * is auto-generated and contains the default settings used by the firmware.
+ * The defaults are a constant table laid out as the settings values, it is
+ * kept in flash.
  *
  * @copyright Alexy Torres Aurora Dugo
  ******************************************************************************/
@@ -22,10 +24,12 @@
  ******************************************************************************/
 #include <cstdint>       /* Standard int types */
 #include <Settings.h>    /* Settings */
-#include <unordered_map> /* Settings map */
+#include <SettingsIds.h> /* Settings identifiers */
+
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
+/* None */
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
@@ -53,28 +57,61 @@
 /* None */
 
 /************************** Static global variables ***************************/
-/** @brief Default setting for is_ap item. */
-static const bool skis_ap = true;
-/** @brief Default setting for node_ssid item. */
-static const char* sknode_ssid = "RTHR_NODE\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0";
-/** @brief Default setting for node_pass item. */
-static const char* sknode_pass = "RTHR_PASS\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0";
-/** @brief Default setting for web_port item. */
-static const uint16_t skweb_port = 80;
-/** @brief Default setting for api_port item. */
-static const uint16_t skapi_port = 8333;
-/** @brief Default setting for node_static item. */
-static const bool sknode_static = false;
-/** @brief Default setting for node_st_ip item. */
-static const char* sknode_st_ip = "192.168.1.200\0\0";
-/** @brief Default setting for node_st_gate item. */
-static const char* sknode_st_gate = "192.168.1.100\0\0";
-/** @brief Default setting for node_st_subnet item. */
-static const char* sknode_st_subnet = "255.255.255.0\0\0";
-/** @brief Default setting for node_st_pdns item. */
-static const char* sknode_st_pdns = "1.1.1.1\0\0\0\0\0\0\0\0";
-/** @brief Default setting for node_st_sdns item. */
-static const char* sknode_st_sdns = "4.4.4.4\0\0\0\0\0\0\0\0";
+/**
+ * @brief Default settings values, by setting offset. The names are only
+ * resolved to identifiers, no default is copied in memory.
+ */
+static constexpr uint8_t skSettingsDefaults[SETTINGS_VALUES_SIZE] = {
+    /* is_ap */
+    0x01,
+    /* node_ssid */
+    0x52, 0x54, 0x48, 0x52, 0x5F, 0x4E, 0x4F, 0x44, 0x45, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* node_pass */
+    0x52, 0x54, 0x48, 0x52, 0x5F, 0x50, 0x41, 0x53, 0x53, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* web_port */
+    0x50, 0x00,
+    /* api_port */
+    0x8D, 0x20,
+    /* node_static */
+    0x00,
+    /* node_st_ip */
+    0x31, 0x39, 0x32, 0x2E, 0x31, 0x36, 0x38, 0x2E, 0x31, 0x2E, 0x32, 0x30,
+    0x30, 0x00, 0x00,
+    /* node_st_gate */
+    0x31, 0x39, 0x32, 0x2E, 0x31, 0x36, 0x38, 0x2E, 0x31, 0x2E, 0x31, 0x30,
+    0x30, 0x00, 0x00,
+    /* node_st_subnet */
+    0x32, 0x35, 0x35, 0x2E, 0x32, 0x35, 0x35, 0x2E, 0x32, 0x35, 0x35, 0x2E,
+    0x30, 0x00, 0x00,
+    /* node_st_pdns */
+    0x31, 0x2E, 0x31, 0x2E, 0x31, 0x2E, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    /* node_st_sdns */
+    0x34, 0x2E, 0x34, 0x2E, 0x34, 0x2E, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    /* wifi_lat_ms */
+    0x00, 0x00,
+    /* tlm_mode */
+    0x00,
+    /* tlm_host */
+    0x30, 0x2E, 0x30, 0x2E, 0x30, 0x2E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    /* tlm_port */
+    0x5B, 0x07,
+    /* tlm_period_s */
+    0x0A, 0x00,
+    /* task_cfg */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
 
 /*******************************************************************************
  * FUNCTIONS
@@ -84,82 +121,6 @@ static const char* sknode_st_sdns = "4.4.4.4\0\0\0\0\0\0\0\0";
 /*******************************************************************************
  * CLASS METHODS
  ******************************************************************************/
-void Settings::InitializeDefault(void) noexcept {
-	this->_defaults.emplace(
-		SETTING_IS_AP,
-		S_SettingField {
-			.pValue = (uint8_t*)&skis_ap,
-			.fieldSize = 1
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_NODE_SSID,
-		S_SettingField {
-			.pValue = (uint8_t*)sknode_ssid,
-			.fieldSize = 32
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_NODE_PASS,
-		S_SettingField {
-			.pValue = (uint8_t*)sknode_pass,
-			.fieldSize = 32
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_WEB_PORT,
-		S_SettingField {
-			.pValue = (uint8_t*)&skweb_port,
-			.fieldSize = 2
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_API_PORT,
-		S_SettingField {
-			.pValue = (uint8_t*)&skapi_port,
-			.fieldSize = 2
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_NODE_STATIC,
-		S_SettingField {
-			.pValue = (uint8_t*)&sknode_static,
-			.fieldSize = 1
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_NODE_ST_IP,
-		S_SettingField {
-			.pValue = (uint8_t*)sknode_st_ip,
-			.fieldSize = 15
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_NODE_ST_GATE,
-		S_SettingField {
-			.pValue = (uint8_t*)sknode_st_gate,
-			.fieldSize = 15
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_NODE_ST_SUBNET,
-		S_SettingField {
-			.pValue = (uint8_t*)sknode_st_subnet,
-			.fieldSize = 15
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_NODE_ST_PDNS,
-		S_SettingField {
-			.pValue = (uint8_t*)sknode_st_pdns,
-			.fieldSize = 15
-		}
-	);
-	this->_defaults.emplace(
-		SETTING_NODE_ST_SDNS,
-		S_SettingField {
-			.pValue = (uint8_t*)sknode_st_sdns,
-			.fieldSize = 15
-		}
-	);
-}
\ No newline at end of file
+const uint8_t* Settings::GetDefaultValue(const E_SettingId kId) noexcept {
+    return skSettingsDefaults + SettingOffset(kId);
+}
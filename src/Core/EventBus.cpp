@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * @file EventBus.cpp
+ *
+ * @see EventBus.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Subsystems publish/subscribe event bus.
+ *
+ * @details Subsystems publish/subscribe event bus. The producers only enqueue
+ * typed events in the lock-free queues of the subscribers, the subscribers
+ * receive them in batches on their own task.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>   /* Atomic types */
+#include <cstdint>  /* Standard integer definitions */
+#include <HAL.h>    /* Hardware abstraction layer */
+#include <Errors.h> /* Errors definitions */
+
+/* Header file */
+#include <EventBus.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the mask of the queue positions. */
+#define EVENT_BUS_QUEUE_MASK (EVENT_BUS_QUEUE_SIZE - 1)
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+S_EventSubscriber EventBus::_SPSUBSCRIBERS[EVENT_BUS_MAX_SUBSCRIBERS];
+std::atomic<uint8_t> EventBus::_SSUBSCRIBERCOUNT(0);
+T_HALSpinLock EventBus::_SLOCK = HAL_SPINLOCK_INITIALIZER;
+
+E_Return EventBus::Subscribe(const uint32_t kMask,
+                             T_HALTask      task,
+                             uint8_t&       rSubId) noexcept {
+    S_EventSubscriber* pSubscriber;
+    E_Return           retCode;
+    uint8_t            count;
+    uint32_t           i;
+
+    HAL::EnterCritical(EventBus::_SLOCK);
+    count = EventBus::_SSUBSCRIBERCOUNT.load(std::memory_order_relaxed);
+    if (EVENT_BUS_MAX_SUBSCRIBERS > count) {
+        pSubscriber = &EventBus::_SPSUBSCRIBERS[count];
+        for (i = 0; EVENT_BUS_QUEUE_SIZE > i; ++i) {
+            pSubscriber->pSlots[i].sequence.store(
+                i,
+                std::memory_order_relaxed
+            );
+        }
+        pSubscriber->head.store(0, std::memory_order_relaxed);
+        pSubscriber->tail.store(0, std::memory_order_relaxed);
+        pSubscriber->dropped.store(0, std::memory_order_relaxed);
+        pSubscriber->mask = kMask;
+        pSubscriber->task = task;
+
+        /* Publish the subscriber once it is ready */
+        EventBus::_SSUBSCRIBERCOUNT.store(
+            count + 1,
+            std::memory_order_release
+        );
+        rSubId  = count;
+        retCode = E_Return::NO_ERROR;
+    }
+    else {
+        retCode = E_Return::ERR_EVENT_FULL;
+    }
+    HAL::ExitCritical(EventBus::_SLOCK);
+
+    return retCode;
+}
+
+void EventBus::Publish(const S_Event& krEvent) noexcept {
+    S_EventSubscriber* pSubscriber;
+    S_Event            event;
+    uint8_t            count;
+    uint8_t            i;
+
+    event      = krEvent;
+    event.time = HAL::GetTime();
+
+    count = EventBus::_SSUBSCRIBERCOUNT.load(std::memory_order_acquire);
+    for (i = 0; count > i; ++i) {
+        pSubscriber = &EventBus::_SPSUBSCRIBERS[i];
+        if (0 != (pSubscriber->mask & EVENT_MASK(event.id))) {
+            if (EventBus::Enqueue(*pSubscriber, event)) {
+                if (nullptr != pSubscriber->task) {
+                    HAL::NotifyTask(pSubscriber->task);
+                }
+            }
+            else {
+                pSubscriber->dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+uint32_t EventBus::Receive(const uint8_t  kSubId,
+                           S_Event*       pEvents,
+                           const uint32_t kMaxCount) noexcept {
+    S_EventSubscriber* pSubscriber;
+    S_EventSlot*       pSlot;
+    uint32_t           received;
+    uint32_t           tail;
+    bool               isEmpty;
+
+    received = 0;
+    if (EventBus::_SSUBSCRIBERCOUNT.load(std::memory_order_acquire) >
+        kSubId) {
+        pSubscriber = &EventBus::_SPSUBSCRIBERS[kSubId];
+        tail        = pSubscriber->tail.load(std::memory_order_relaxed);
+        isEmpty     = false;
+        while (!isEmpty && kMaxCount > received) {
+            pSlot = &pSubscriber->pSlots[tail & EVENT_BUS_QUEUE_MASK];
+
+            /* The slot is published when its sequence moved past the tail */
+            if (pSlot->sequence.load(std::memory_order_acquire) ==
+                tail + 1) {
+                pEvents[received++] = pSlot->event;
+
+                /* Release the slot for the next round of the producers */
+                pSlot->sequence.store(
+                    tail + EVENT_BUS_QUEUE_SIZE,
+                    std::memory_order_release
+                );
+                ++tail;
+            }
+            else {
+                isEmpty = true;
+            }
+        }
+        pSubscriber->tail.store(tail, std::memory_order_relaxed);
+    }
+
+    return received;
+}
+
+uint32_t EventBus::GetDroppedCount(const uint8_t kSubId) noexcept {
+    uint32_t dropped;
+
+    dropped = 0;
+    if (EventBus::_SSUBSCRIBERCOUNT.load(std::memory_order_acquire) >
+        kSubId) {
+        dropped = EventBus::_SPSUBSCRIBERS[kSubId].dropped.load(
+            std::memory_order_relaxed
+        );
+    }
+
+    return dropped;
+}
+
+bool EventBus::Enqueue(S_EventSubscriber& rSubscriber,
+                       const S_Event&     krEvent) noexcept {
+    S_EventSlot* pSlot;
+    uint32_t     head;
+    uint32_t     sequence;
+    int32_t      difference;
+    bool         isQueued;
+    bool         isDone;
+
+    isQueued = false;
+    isDone   = false;
+    head     = rSubscriber.head.load(std::memory_order_relaxed);
+    while (!isDone) {
+        pSlot      = &rSubscriber.pSlots[head & EVENT_BUS_QUEUE_MASK];
+        sequence   = pSlot->sequence.load(std::memory_order_acquire);
+        difference = (int32_t)(sequence - head);
+        if (0 == difference) {
+            /* The slot is free, claim it against the other producers */
+            if (rSubscriber.head.compare_exchange_weak(
+                    head,
+                    head + 1,
+                    std::memory_order_relaxed)) {
+                pSlot->event = krEvent;
+                pSlot->sequence.store(head + 1, std::memory_order_release);
+                isQueued = true;
+                isDone   = true;
+            }
+        }
+        else if (0 > difference) {
+            /* The subscriber did not release the slot, the queue is full */
+            isDone = true;
+        }
+        else {
+            head = rSubscriber.head.load(std::memory_order_relaxed);
+        }
+    }
+
+    return isQueued;
+}
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * @file HandlerStats.cpp
+ *
+ * @see HandlerStats.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Request handlers statistics.
+ *
+ * @details Request handlers statistics. The web and API servers account the
+ * service time of each route and the free heap at the end of each request.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstring>   /* memset */
+#include <cstdint>   /* Standard integer definitions */
+#include <Logger.h>  /* Logger services */
+#include <HAL.h>     /* Hardware abstraction layer */
+#include <Timeout.h> /* Timing histograms */
+
+/* Header file */
+#include <HandlerStats.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+S_HandlerStats HandlerStats::_SPSTATS[HANDLER_STATS_MAX];
+uint32_t HandlerStats::_SCOUNT = 0;
+uint64_t HandlerStats::_SWINDOWSTART = 0;
+T_HALSpinLock HandlerStats::_SLOCK = HAL_SPINLOCK_INITIALIZER;
+
+uint32_t HandlerStats::Register(const char* kpServer,
+                                const char* kpPath) noexcept {
+    S_HandlerStats* pStats;
+    uint32_t        id;
+
+    id = HANDLER_STATS_INVALID_ID;
+
+    HAL::EnterCritical(HandlerStats::_SLOCK);
+    if (HANDLER_STATS_MAX > HandlerStats::_SCOUNT) {
+        id = HandlerStats::_SCOUNT++;
+        pStats = &HandlerStats::_SPSTATS[id];
+
+        memset(pStats, 0, sizeof(S_HandlerStats));
+        pStats->pkServer = kpServer;
+        pStats->pkPath = kpPath;
+        pStats->heapLowWater = UINT32_MAX;
+    }
+    HAL::ExitCritical(HandlerStats::_SLOCK);
+
+    if (HANDLER_STATS_INVALID_ID == id) {
+        LOG_ERROR("No handler statistics slot left for %s.\n", kpPath);
+    }
+
+    return id;
+}
+
+void HandlerStats::Record(const uint32_t kId,
+                          const uint64_t kServiceNs) noexcept {
+    S_HALHeapStats  heapStats;
+    S_HandlerStats* pStats;
+
+    if (HANDLER_STATS_MAX > kId) {
+        /* The heap is read outside of the critical section */
+        HAL::GetHeapStats(heapStats);
+
+        HAL::EnterCritical(HandlerStats::_SLOCK);
+        pStats = &HandlerStats::_SPSTATS[kId];
+        Timeout::RecordSample(pStats->service, kServiceNs);
+        pStats->totalNs += kServiceNs;
+        if (heapStats.freeSize < pStats->heapLowWater) {
+            pStats->heapLowWater = (uint32_t)heapStats.freeSize;
+        }
+        HAL::ExitCritical(HandlerStats::_SLOCK);
+    }
+}
+
+bool HandlerStats::GetStats(const uint32_t  kIndex,
+                            S_HandlerStats& rStats) noexcept {
+    bool isValid;
+
+    isValid = false;
+
+    HAL::EnterCritical(HandlerStats::_SLOCK);
+    if (HandlerStats::_SCOUNT > kIndex) {
+        rStats = HandlerStats::_SPSTATS[kIndex];
+        isValid = true;
+    }
+    HAL::ExitCritical(HandlerStats::_SLOCK);
+
+    return isValid;
+}
+
+uint64_t HandlerStats::GetWindowStart(void) noexcept {
+    uint64_t windowStart;
+
+    HAL::EnterCritical(HandlerStats::_SLOCK);
+    windowStart = HandlerStats::_SWINDOWSTART;
+    HAL::ExitCritical(HandlerStats::_SLOCK);
+
+    return windowStart;
+}
+
+void HandlerStats::Reset(void) noexcept {
+    S_HandlerStats* pStats;
+    uint64_t        now;
+    uint32_t        i;
+
+    now = HAL::GetTime();
+
+    HAL::EnterCritical(HandlerStats::_SLOCK);
+    for (i = 0; HandlerStats::_SCOUNT > i; ++i) {
+        pStats = &HandlerStats::_SPSTATS[i];
+
+        memset(&pStats->service, 0, sizeof(pStats->service));
+        pStats->totalNs = 0;
+        pStats->heapLowWater = UINT32_MAX;
+    }
+    HandlerStats::_SWINDOWSTART = now;
+    HAL::ExitCritical(HandlerStats::_SLOCK);
+
+    LOG_INFO("Handler statistics reset.\n");
+}
@@ -21,13 +21,19 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
 /* Included headers */
 #include <BSP.h>             /* Hardware layer services */
+#include <algorithm>         /* std::min */
 #include <Logger.h>          /* Logger services */
 #include <Timeout.h>         /* Timeout manager */
 #include <SystemState.h>     /* System State services. */
+#include <TaskRegistry.h>    /* Firmware tasks registry */
 #include <IOLedManager.h>    /* IO Led manager */
 #include <IOButtonManager.h> /* IO Button manager */
+#include <Tracer.h>          /* Events tracer */
 
 /* Header file */
 #include <IOTask.h>
@@ -35,20 +41,12 @@
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/** @brief Main loop period in nanoseconds. */
-#define HW_IO_TASK_PERIOD_NS 25000000ULL
+/** @brief Main loop maximal sleep time in nanoseconds. */
+#define HW_IO_TASK_PERIOD_NS 250000000ULL
 /** @brief Main loop period tolerance in nanoseconds. */
-#define HW_IO_TASK_PERIOD_TOLERANCE_NS 1250000ULL
+#define HW_IO_TASK_PERIOD_TOLERANCE_NS 12500000ULL
 /** @brief Main loop watchdog timeout in nanoseconds. */
 #define HW_IO_TASK_WD_TIMEOUT_NS (2 * HW_IO_TASK_PERIOD_NS)
-/** @brief Hardware Real-Time Task name. */
-#define HW_IO_TASK_NAME "HW-IO_TASK"
-/** @brief Hardware Real-Time Task stack size in bytes. */
-#define HW_IO_TASK_STACK 4096
-/** @brief Hardware Real-Time Task priority. */
-#define HW_IO_TASK_PRIO (configMAX_PRIORITIES - 1)
-/** @brief Hardware Real-Time Task mapped core ID. */
-#define HW_IO_TASK_CORE 0
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
@@ -88,7 +86,7 @@ static IOTask* spIOTask = nullptr;
  * CLASS METHODS
  ******************************************************************************/
 IOTask::IOTask(void) noexcept {
-    BaseType_t result;
+    bool       isCreated;
 
     /* Check instance */
     if (nullptr != spIOTask) {
@@ -107,21 +105,28 @@ IOTask::IOTask(void) noexcept {
     if (nullptr == this->_pTimeout) {
         PANIC("Failed to create the IO task deadline manager.\n");
     }
+    if (E_Return::NO_ERROR != this->_pTimeout->EnableStats(
+            TaskRegistry::GetName(E_TaskId::TASK_ID_IO),
+            HW_IO_TASK_PERIOD_NS
+        )) {
+        LOG_ERROR("Failed to enable the IO task timing statistics.\n");
+    }
 
     /* Create the task */
-    result = xTaskCreatePinnedToCore(
+    isCreated = TaskRegistry::CreateTask(
+        E_TaskId::TASK_ID_IO,
         IOTask::IOTaskRoutine,
-        HW_IO_TASK_NAME,
-        HW_IO_TASK_STACK,
         this,
-        HW_IO_TASK_PRIO,
-        &this->_IOTaskHandle,
-        HW_IO_TASK_CORE
+        this->_IOTaskHandle
     );
-    if (pdPASS != result) {
+    if (!isCreated) {
         PANIC("Failed to create the IO task routine task.\n");
     }
 
+    /* The IO managers wake the task on their events */
+    this->_pSysState->GetIOButtonManager()->SetNotifyTask(this->_IOTaskHandle);
+    this->_pSysState->GetIOLedManager()->SetNotifyTask(this->_IOTaskHandle);
+
     /* Set instance and set as started */
     spIOTask = this;
 
@@ -140,40 +145,46 @@ void IOTask::IOTaskRoutine(void* pParam) noexcept {
     IOLedManager*    pLed;
     IOButtonManager* pBtn;
     IOTask*          pIOTask;
-    BaseType_t       result;
-    TickType_t       lastWakeTime;
+    uint64_t         currentTime;
+    uint64_t         waitNs;
 
     /* Get the task */
     pIOTask = (IOTask*)pParam;
 
     /* First tick */
     pIOTask->_pTimeout->Notify();
-    lastWakeTime = xTaskGetTickCount();
 
     while (true) {
+        TRACE_BEGIN(E_TraceEvent::TRACE_IO_TASK);
+
+        /* The cycle time is read once and passed down */
+        currentTime = HWManager::GetTime();
+
         /* Manage deadline miss */
-        if (pIOTask->_pTimeout->HasTimedOut()) {
+        if (pIOTask->_pTimeout->HasTimedOut(currentTime)) {
             PANIC("IO task deadline miss.\n");
         }
-        pIOTask->_pTimeout->Notify();
+        pIOTask->_pTimeout->Notify(currentTime);
 
         /* Get the instances */
         pLed = pIOTask->_pSysState->GetIOLedManager();
         pBtn = pIOTask->_pSysState->GetIOButtonManager();
 
-        /* Update the IO buttons */
-        pBtn->Update();
-
-        /* Update the LED */
-        pLed->Update();
-
-        /* Wait for period */
-        result = xTaskDelayUntil(
-            &lastWakeTime,
-            HW_IO_TASK_PERIOD_NS / 1000000 / portTICK_PERIOD_MS
+        /* Update the IO buttons and LEDs, get their next deadline */
+        waitNs = std::min(
+            pBtn->Update(currentTime),
+            pLed->Update(currentTime)
+        );
+        waitNs = std::min(waitNs, (uint64_t)HW_IO_TASK_PERIOD_NS);
+        pIOTask->_pTimeout->SetWakeDeadline(currentTime + waitNs);
+        pIOTask->_pTimeout->NotifyEnd();
+        TRACE_END(E_TraceEvent::TRACE_IO_TASK);
+
+        /* Sleep until the next deadline or IO event */
+        ulTaskNotifyTake(
+            pdTRUE,
+            (waitNs + 1000000ULL * portTICK_PERIOD_MS - 1) /
+            1000000ULL / portTICK_PERIOD_MS
         );
-        if (pdPASS != result) {
-            PANIC("IO task periodic wait failed. Error %d\n", result);
-        }
     }
 }
\ No newline at end of file
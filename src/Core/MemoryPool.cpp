@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * @file MemoryPool.cpp
+ *
+ * @see MemoryPool.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Subsystem memory pools.
+ *
+ * @details Subsystem memory pools. Each subsystem allocates its strings and
+ * containers nodes from its own fixed-block pools instead of the general
+ * heap, the usage of each subsystem is accounted separately.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <new>             /* std::bad_alloc */
+#include <cstdlib>         /* malloc, free */
+#include <cstring>         /* memset */
+#include <cstdint>         /* Standard integer definitions */
+#include <Logger.h>        /* Logger services */
+#include <HAL.h>           /* Hardware abstraction layer */
+
+/* Header file */
+#include <MemoryPool.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Memory pool block size. */
+typedef struct {
+    /** @brief The size of the blocks in bytes, a multiple of 8. */
+    uint16_t blockSize;
+    /** @brief The number of blocks. */
+    uint16_t blockCount;
+} S_MemPoolClass;
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+static_assert(
+    4 == E_MemPoolId::MEM_POOL_COUNT,
+    "The pools tables must list every pool."
+);
+
+/**
+ * @brief The block sizes of each pool, by increasing size. The web pages
+ * grow by doubling, the settings and reporters are mostly container nodes
+ * and short names.
+ */
+static const S_MemPoolClass
+spkPoolClasses[E_MemPoolId::MEM_POOL_COUNT][MEMPOOL_CLASS_COUNT] = {
+    /* MEM_POOL_WEB */
+    {{256, 16}, {2048, 8}, {8192, 4}},
+    /* MEM_POOL_API */
+    {{32, 16}, {64, 16}, {256, 4}},
+    /* MEM_POOL_SETTINGS */
+    {{64, 192}, {256, 8}, {1024, 4}},
+    /* MEM_POOL_HM */
+    {{32, 32}, {64, 16}, {128, 4}}
+};
+
+/** @brief The pools names, by pool. */
+static const char* spkPoolNames[E_MemPoolId::MEM_POOL_COUNT] = {
+    "web",
+    "api",
+    "settings",
+    "hm"
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+MemoryPool::S_Pool MemoryPool::_SPPOOLS[E_MemPoolId::MEM_POOL_COUNT];
+T_HALSpinLock MemoryPool::_SPLOCKS[E_MemPoolId::MEM_POOL_COUNT] = {
+    HAL_SPINLOCK_INITIALIZER,
+    HAL_SPINLOCK_INITIALIZER,
+    HAL_SPINLOCK_INITIALIZER,
+    HAL_SPINLOCK_INITIALIZER
+};
+bool MemoryPool::_SISINIT = false;
+
+void MemoryPool::Init(void) noexcept {
+    const S_MemPoolClass* pkClass;
+    S_FreeBlock*          pBlock;
+    uint8_t*              pMemory;
+    size_t                size;
+    uint8_t               pool;
+    uint8_t               i;
+    uint16_t              j;
+
+    if (!MemoryPool::_SISINIT) {
+        MemoryPool::_SISINIT = true;
+
+        for (pool = 0; E_MemPoolId::MEM_POOL_COUNT > pool; ++pool) {
+            size = 0;
+            for (i = 0; MEMPOOL_CLASS_COUNT > i; ++i) {
+                pkClass = &spkPoolClasses[pool][i];
+                size += (size_t)pkClass->blockSize * pkClass->blockCount;
+            }
+
+            /* Each pool is carved once, the blocks are never returned */
+            pMemory = nullptr;
+#if MEMPOOL_PSRAM
+            pMemory = (uint8_t*)HAL::Allocate(size, true);
+#endif
+            if (nullptr == pMemory) {
+                pMemory = (uint8_t*)HAL::Allocate(size, false);
+            }
+
+            if (nullptr != pMemory) {
+                HAL::EnterCritical(MemoryPool::_SPLOCKS[pool]);
+                for (i = 0; MEMPOOL_CLASS_COUNT > i; ++i) {
+                    pkClass = &spkPoolClasses[pool][i];
+                    MemoryPool::_SPPOOLS[pool].pStart[i] = pMemory;
+                    MemoryPool::_SPPOOLS[pool].pFree[i] = nullptr;
+                    for (j = 0; pkClass->blockCount > j; ++j) {
+                        pBlock = (S_FreeBlock*)(
+                            pMemory + (size_t)j * pkClass->blockSize
+                        );
+                        pBlock->pNext = MemoryPool::_SPPOOLS[pool].pFree[i];
+                        MemoryPool::_SPPOOLS[pool].pFree[i] = pBlock;
+                    }
+                    pMemory += (size_t)pkClass->blockSize * pkClass->blockCount;
+                    MemoryPool::_SPPOOLS[pool].stats.blockCount +=
+                        pkClass->blockCount;
+                }
+                MemoryPool::_SPPOOLS[pool].stats.poolSize = size;
+                HAL::ExitCritical(MemoryPool::_SPLOCKS[pool]);
+            }
+            else {
+                LOG_ERROR(
+                    "Failed to carve the %s memory pool, using the heap.\n",
+                    spkPoolNames[pool]
+                );
+            }
+        }
+    }
+}
+
+void* MemoryPool::Allocate(const E_MemPoolId kPool, const size_t kSize) {
+    S_Pool*      pPool;
+    S_FreeBlock* pBlock;
+    uint16_t     blockSize;
+    uint8_t      i;
+
+    pPool = &MemoryPool::_SPPOOLS[kPool];
+    pBlock = nullptr;
+
+    /* The smallest fitting size is tried first, then the larger ones */
+    HAL::EnterCritical(MemoryPool::_SPLOCKS[kPool]);
+    for (i = 0; MEMPOOL_CLASS_COUNT > i && nullptr == pBlock; ++i) {
+        blockSize = spkPoolClasses[kPool][i].blockSize;
+        if (blockSize >= kSize && nullptr != pPool->pFree[i]) {
+            pBlock = pPool->pFree[i];
+            pPool->pFree[i] = pBlock->pNext;
+            pPool->stats.used += blockSize;
+            ++pPool->stats.usedBlocks;
+            if (pPool->stats.highWater < pPool->stats.used) {
+                pPool->stats.highWater = pPool->stats.used;
+            }
+        }
+    }
+    HAL::ExitCritical(MemoryPool::_SPLOCKS[kPool]);
+
+    if (nullptr == pBlock) {
+        pBlock = (S_FreeBlock*)malloc(kSize);
+        if (nullptr == pBlock) {
+            throw std::bad_alloc();
+        }
+
+        HAL::EnterCritical(MemoryPool::_SPLOCKS[kPool]);
+        pPool->stats.heapUsed += kSize;
+        ++pPool->stats.fallbacks;
+        HAL::ExitCritical(MemoryPool::_SPLOCKS[kPool]);
+    }
+
+    return pBlock;
+}
+
+void MemoryPool::Release(const E_MemPoolId kPool,
+                         void*             pMemory,
+                         const size_t      kSize) noexcept {
+    const S_MemPoolClass* pkClass;
+    S_Pool*               pPool;
+    S_FreeBlock*          pBlock;
+    uint8_t*              pStart;
+    bool                  isPooled;
+    uint8_t               i;
+
+    pPool = &MemoryPool::_SPPOOLS[kPool];
+    pBlock = (S_FreeBlock*)pMemory;
+    isPooled = false;
+
+    if (nullptr != pMemory) {
+        /* The memory belongs to the block size whose range contains it */
+        HAL::EnterCritical(MemoryPool::_SPLOCKS[kPool]);
+        for (i = 0; MEMPOOL_CLASS_COUNT > i && !isPooled; ++i) {
+            pkClass = &spkPoolClasses[kPool][i];
+            pStart = pPool->pStart[i];
+            if (nullptr != pStart &&
+                pStart <= (uint8_t*)pMemory &&
+                pStart + (size_t)pkClass->blockSize * pkClass->blockCount >
+                (uint8_t*)pMemory) {
+                pBlock->pNext = pPool->pFree[i];
+                pPool->pFree[i] = pBlock;
+                pPool->stats.used -= pkClass->blockSize;
+                --pPool->stats.usedBlocks;
+                isPooled = true;
+            }
+        }
+        if (!isPooled) {
+            pPool->stats.heapUsed -= kSize;
+        }
+        HAL::ExitCritical(MemoryPool::_SPLOCKS[kPool]);
+
+        if (!isPooled) {
+            free(pMemory);
+        }
+    }
+}
+
+void MemoryPool::GetStats(const E_MemPoolId kPool,
+                          S_MemPoolStats&   rStats) noexcept {
+    if (E_MemPoolId::MEM_POOL_COUNT > kPool) {
+        HAL::EnterCritical(MemoryPool::_SPLOCKS[kPool]);
+        rStats = MemoryPool::_SPPOOLS[kPool].stats;
+        HAL::ExitCritical(MemoryPool::_SPLOCKS[kPool]);
+    }
+    else {
+        memset(&rStats, 0, sizeof(S_MemPoolStats));
+    }
+}
+
+const char* MemoryPool::GetName(const E_MemPoolId kPool) noexcept {
+    const char* pkName;
+
+    pkName = "unknown";
+    if (E_MemPoolId::MEM_POOL_COUNT > kPool) {
+        pkName = spkPoolNames[kPool];
+    }
+
+    return pkName;
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * @file Metrics.cpp
+ *
+ * @see Metrics.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware always-on metrics counters.
+ *
+ * @details Firmware always-on metrics counters. The subsystems increment
+ * lock-free counters on their hot paths, the counters are only read and
+ * formatted when the metrics are scraped.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <atomic>         /* Atomic types */
+#include <cstdint>        /* Standard integer definitions */
+#include <cstddef>        /* Standard size type */
+#include <HandlerStats.h> /* Request handlers identifiers */
+
+/* Header file */
+#include <Metrics.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+std::atomic<uint32_t> Metrics::_SPCOUNTERS[METRIC_COUNTER_MAX];
+std::atomic<uint32_t> Metrics::_SPREQUESTS[HANDLER_STATS_MAX];
+std::atomic<uint32_t> Metrics::_SPBYTES[HANDLER_STATS_MAX];
+
+void Metrics::Add(const E_MetricCounter kCounter,
+                  const uint32_t        kValue) noexcept {
+    if (METRIC_COUNTER_MAX > kCounter) {
+        Metrics::_SPCOUNTERS[kCounter].fetch_add(
+            kValue,
+            std::memory_order_relaxed
+        );
+    }
+}
+
+uint32_t Metrics::Get(const E_MetricCounter kCounter) noexcept {
+    uint32_t value;
+
+    value = 0;
+    if (METRIC_COUNTER_MAX > kCounter) {
+        value = Metrics::_SPCOUNTERS[kCounter].load(std::memory_order_relaxed);
+    }
+
+    return value;
+}
+
+void Metrics::RecordRequest(const uint32_t kId, const size_t kBytes) noexcept {
+    if (HANDLER_STATS_MAX > kId) {
+        Metrics::_SPREQUESTS[kId].fetch_add(1, std::memory_order_relaxed);
+        Metrics::_SPBYTES[kId].fetch_add(
+            (uint32_t)kBytes,
+            std::memory_order_relaxed
+        );
+    }
+}
+
+bool Metrics::GetRequests(const uint32_t kId, S_MetricRoute& rRoute) noexcept {
+    bool isValid;
+
+    isValid = HANDLER_STATS_MAX > kId;
+    if (isValid) {
+        rRoute.requests = Metrics::_SPREQUESTS[kId].load(
+            std::memory_order_relaxed
+        );
+        rRoute.bytes = Metrics::_SPBYTES[kId].load(std::memory_order_relaxed);
+    }
+
+    return isValid;
+}
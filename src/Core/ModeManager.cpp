@@ -22,15 +22,18 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
 /* Included headers */
 #include <BSP.h>                          /* Hardware services*/
 #include <Logger.h>                       /* Firmware logger */
 #include <Errors.h>                       /* Error codes */
+#include <EventBus.h>                     /* Subsystems events */
 #include <IOTask.h>                       /* IO Task manager */
 #include <rom/rtc.h>                      /* RTC services */
 #include <Arduino.h>                      /* Arduino library */
 #include <version.h>                      /* Versionning info */
-#include <Storage.h>                      /* Storage manager */
 #include <Settings.h>                     /* Settings services */
 #include <WebServer.h>                    /* Web server services */
 #include <WiFiModule.h>                   /* WiFi Module driver */
@@ -39,6 +42,16 @@
 #include <ResetManager.h>                 /* Reset manager services */
 #include <HealthMonitor.h>                /* Health Monitoring */
 #include <IOButtonManager.h>              /* IO Button manager */
+#include <BootSequencer.h>                /* Boot stages sequencer */
+#include <BootTrace.h>                    /* Boot phases trace */
+#include <BootRecord.h>                   /* Boot mode and reset record */
+#include <TelemetryPublisher.h>           /* Telemetry publisher */
+#include <SensorEngine.h>                 /* Sensor acquisition engine */
+#include <BME280Sensor.h>                 /* BME280 sensor driver */
+#include <ChipTempSensor.h>               /* On-chip temperature sensor */
+#include <TimeSeriesStore.h>              /* Sensor history store */
+#include <SystemMonitor.h>                /* Runtime system monitor */
+#include <TaskRegistry.h>                 /* Firmware tasks registry */
 #include <MaintenanceWebServerHandlers.h> /* Maintenance mode URL handlers */
 
 /* Header file */
@@ -48,12 +61,28 @@
 /*******************************************************************************
  * CONSTANTS
  ******************************************************************************/
-/** @brief Defines the path to the execution mode setting file. */
-#define FIRMWARE_MODE_PATH "rthrws_mode"
-
 /** @brief Defines the maintenance web server port. */
 #define MAINTENANCE_WEB_SERVER_PORT 8888
 
+/** @brief Health monitor boot stage. */
+#define BOOT_STAGE_HM 0
+/** @brief Settings boot stage. */
+#define BOOT_STAGE_SETTINGS 1
+/** @brief IO managers and task boot stage. */
+#define BOOT_STAGE_IO 2
+/** @brief WiFi creation and association boot stage. */
+#define BOOT_STAGE_WIFI 3
+/** @brief Web and API servers boot stage. */
+#define BOOT_STAGE_SERVERS 4
+/** @brief Telemetry publisher boot stage. */
+#define BOOT_STAGE_TELEMETRY 5
+/** @brief Sensors acquisition boot stage. */
+#define BOOT_STAGE_SENSORS 6
+/** @brief Sensors history store boot stage. */
+#define BOOT_STAGE_HISTORY 7
+/** @brief System monitor boot stage. */
+#define BOOT_STAGE_MONITOR 8
+
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
@@ -67,7 +96,87 @@
 /*******************************************************************************
  * STATIC FUNCTIONS DECLARATIONS
  ******************************************************************************/
-/* None */
+/**
+ * @brief Health monitor boot stage.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootHealthMonitor(void) noexcept;
+
+/**
+ * @brief Settings boot stage.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootSettings(void) noexcept;
+
+/**
+ * @brief IO boot stage.
+ *
+ * @details IO boot stage. Creates the buttons and leds managers, the reset
+ * action and the IO task.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootIO(void) noexcept;
+
+/**
+ * @brief WiFi boot stage.
+ *
+ * @details WiFi boot stage. Creates the WiFi module and associates.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootWiFi(void) noexcept;
+
+/**
+ * @brief Servers boot stage.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootServers(void) noexcept;
+
+/**
+ * @brief Telemetry boot stage.
+ *
+ * @details Telemetry boot stage. The telemetry is optional, a configuration
+ * error is logged and does not fail the boot.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootTelemetry(void) noexcept;
+
+/**
+ * @brief Sensors boot stage.
+ *
+ * @details Sensors boot stage. Creates the sensor engine and its sensors,
+ * then starts the acquisition. The sensors are started by the acquisition
+ * task, an absent sensor does not fail the boot.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootSensors(void) noexcept;
+
+/**
+ * @brief Sensors history boot stage.
+ *
+ * @details Sensors history boot stage. Creates and starts the time series
+ * store. The acquisition does not depend on the store, a failed start does
+ * not fail the boot.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootHistory(void) noexcept;
+
+/**
+ * @brief System monitor boot stage.
+ *
+ * @details System monitor boot stage. Creates and starts the system monitor.
+ * The monitor is a diagnostic, a failed start does not fail the boot.
+ *
+ * @return The function returns the success or error status.
+ */
+static E_Return BootMonitor(void) noexcept;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -80,70 +189,307 @@
 /* None */
 
 /************************** Static global variables ***************************/
-/* None */
+/**
+ * @brief The nominal boot stages. The WiFi association runs on the WiFi core
+ * while the IO are brought up on the other one. The stages creating tasks
+ * wait for the settings holding the tasks placements.
+ */
+static constexpr S_BootStage skNominalStages[] = {
+    {"BOOT_HM", BootHealthMonitor, 0, 0},
+    {"BOOT_SETTINGS", BootSettings, 0, 1},
+    {"BOOT_IO", BootIO, BOOT_DEPENDS_ON(BOOT_STAGE_SETTINGS), 1},
+    {
+        "BOOT_WIFI",
+        BootWiFi,
+        BOOT_DEPENDS_ON(BOOT_STAGE_HM) | BOOT_DEPENDS_ON(BOOT_STAGE_SETTINGS),
+        0
+    },
+    {"BOOT_SERVERS", BootServers, BOOT_DEPENDS_ON(BOOT_STAGE_WIFI), 1},
+    {"BOOT_TELEMETRY", BootTelemetry, BOOT_DEPENDS_ON(BOOT_STAGE_WIFI), 1},
+    {
+        "BOOT_SENSORS",
+        BootSensors,
+        BOOT_DEPENDS_ON(BOOT_STAGE_HM) | BOOT_DEPENDS_ON(BOOT_STAGE_SETTINGS),
+        1
+    },
+    {"BOOT_HISTORY", BootHistory, BOOT_DEPENDS_ON(BOOT_STAGE_SENSORS), 1},
+    {
+        "BOOT_MONITOR",
+        BootMonitor,
+        BOOT_DEPENDS_ON(BOOT_STAGE_HM) | BOOT_DEPENDS_ON(BOOT_STAGE_SETTINGS),
+        1
+    }
+};
+
+static_assert(
+    BootSequencer::IsOrdered(
+        skNominalStages,
+        sizeof(skNominalStages) / sizeof(skNominalStages[0])
+    ),
+    "The boot stages must only depend on the stages before them."
+);
 
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
-/* None */
+static E_Return BootHealthMonitor(void) noexcept {
+    E_Return result;
 
-/*******************************************************************************
- * CLASS METHODS
- ******************************************************************************/
-ModeManager::ModeManager(void) noexcept {
-    /* Init the mode */
-    this->_currentMode = E_Mode::MODE_MAINTENANCE;
+    if (nullptr != new HealthMonitor()) {
+        BootTrace::Mark(E_BootPhase::BOOT_PHASE_HM);
+        result = E_Return::NO_ERROR;
+    }
+    else {
+        LOG_ERROR("Failed to instanciate the Health Monitor.\n");
+        result = E_Return::ERR_MEMORY;
+    }
 
-    /* Get the last reset reason */
-    GetLastReset();
+    return result;
 }
 
-ModeManager::~ModeManager(void) noexcept {
-    PANIC("Tried to destroy the Mode manager.\n");
-}
+static E_Return BootSettings(void) noexcept {
+    E_Return result;
 
-E_Return ModeManager::SetMode(const E_Mode kMode) noexcept {
-    E_Return     retVal;
-    FsFile       file;
-    Settings*    pSettings;
-    SystemState* pSysState;
+    if (nullptr != new Settings()) {
+        /* The tasks created from now on use the stored placements */
+        TaskRegistry::LoadOverrides();
+        BootTrace::Mark(E_BootPhase::BOOT_PHASE_SETTINGS);
+        result = E_Return::NO_ERROR;
+    }
+    else {
+        LOG_ERROR("Failed to instanciate the Settings.\n");
+        result = E_Return::ERR_MEMORY;
+    }
 
-    pSettings = nullptr;
+    return result;
+}
 
-    pSysState = SystemState::GetInstance();
-    if (nullptr != pSysState) {
-        pSettings = pSysState->GetSettings();
-    }
+static E_Return BootIO(void) noexcept {
+    IOButtonManager* pBtnManager;
+    IOLedManager*    pLedManager;
+    ResetManager*    pResetManager;
+    IOTask*          pIOTask;
+    E_Return         result;
+    uint32_t         resetSubId;
 
-    if (nullptr != pSettings) {
-        file = SystemState::GetInstance()->GetStorage()->Open(
-            FIRMWARE_MODE_PATH,
-            O_RDWR | O_CREAT
+    result = E_Return::ERR_MEMORY;
+    pBtnManager = new IOButtonManager();
+    pLedManager = new IOLedManager();
+    pResetManager = new ResetManager();
+    if (nullptr == pBtnManager ||
+        nullptr == pLedManager ||
+        nullptr == pResetManager) {
+        LOG_ERROR("Failed to instanciate the IO managers.\n");
+    }
+    else {
+        /* Setup reset */
+        result = pBtnManager->Subscribe(
+            E_ButtonID::BUTTON_RESET,
+            BTN_EDGE_MASK(E_ButtonEdge::BTN_EDGE_PRESS) |
+            BTN_EDGE_MASK(E_ButtonEdge::BTN_EDGE_RELEASE) |
+            BTN_EDGE_MASK(E_ButtonEdge::BTN_EDGE_KEEP) |
+            BTN_EDGE_MASK(E_ButtonEdge::BTN_EDGE_TIMER),
+            pResetManager,
+            resetSubId
         );
+        if (E_Return::NO_ERROR != result) {
+            LOG_ERROR("Failed to add reset action. Error %d\n", result);
+        }
     }
 
-    if (file.isOpen()) {
-        if (sizeof(E_Mode) !=
-            file.write(&kMode, sizeof(E_Mode))) {
-            retVal = E_Return::ERR_MODE_FILE_WRITE;
+    /* Create the IO task */
+    if (E_Return::NO_ERROR == result) {
+        pIOTask = new IOTask();
+        if (nullptr != pIOTask) {
+            BootTrace::Mark(E_BootPhase::BOOT_PHASE_IO);
         }
         else {
-            retVal = E_Return::NO_ERROR;
+            LOG_ERROR("Failed to instanciate the IO Task.\n");
+            result = E_Return::ERR_MEMORY;
         }
+    }
+
+    return result;
+}
+
+static E_Return BootWiFi(void) noexcept {
+    WiFiModule* pWifiModule;
+    E_Return    result;
 
-        if (!file.close()) {
-            LOG_ERROR("Failed to close mode file.\n");
+    pWifiModule = new WiFiModule();
+    if (nullptr != pWifiModule) {
+        result = pWifiModule->Start();
+        if (E_Return::NO_ERROR == result) {
+            BootTrace::Mark(E_BootPhase::BOOT_PHASE_WIFI);
+        }
+        else {
+            LOG_ERROR("Failed to start the WiFi module. Error: %d\n", result);
         }
     }
     else {
-        LOG_ERROR("Failed to write execution mode.\n");
-        retVal = E_Return::ERR_MODE_FILE_OPEN;
+        LOG_ERROR("Failed to instanciate the WiFi Module.\n");
+        result = E_Return::ERR_MEMORY;
     }
 
-    if (E_Return::NO_ERROR == retVal) {
-        HWManager::Reboot(false);
+    return result;
+}
+
+static E_Return BootServers(void) noexcept {
+    E_Return result;
+
+    result = SystemState::GetInstance()->GetWiFiModule()->StartWebServers();
+    if (E_Return::NO_ERROR == result) {
+        BootTrace::Mark(E_BootPhase::BOOT_PHASE_SERVERS);
+    }
+    else {
+        LOG_ERROR("Failed to start the Web Servers. Error: %d\n", result);
     }
 
+    return result;
+}
+
+static E_Return BootTelemetry(void) noexcept {
+    TelemetryPublisher* pPublisher;
+    E_Return            result;
+
+    pPublisher = new TelemetryPublisher();
+    if (nullptr != pPublisher) {
+        result = pPublisher->Start();
+        if (E_Return::NO_ERROR != result) {
+            LOG_ERROR("Failed to start the telemetry. Error: %d\n", result);
+            result = E_Return::NO_ERROR;
+        }
+    }
+    else {
+        LOG_ERROR("Failed to instanciate the telemetry publisher.\n");
+        result = E_Return::ERR_MEMORY;
+    }
+
+    return result;
+}
+
+static E_Return BootSensors(void) noexcept {
+    SensorEngine* pEngine;
+    Sensor*       pSensors[2];
+    E_Return      result;
+    uint32_t      sensorId;
+    uint32_t      i;
+
+    pEngine = new SensorEngine();
+    pSensors[0] = new ChipTempSensor();
+    pSensors[1] = new BME280Sensor(
+        E_SensorBus::SENSOR_BUS_SPI,
+        GPIO_SPI_CS_BME280
+    );
+    if (nullptr == pEngine ||
+        nullptr == pSensors[0] ||
+        nullptr == pSensors[1]) {
+        LOG_ERROR("Failed to instanciate the sensors.\n");
+        result = E_Return::ERR_MEMORY;
+    }
+    else {
+        result = E_Return::NO_ERROR;
+        for (i = 0;
+             sizeof(pSensors) / sizeof(pSensors[0]) > i &&
+             E_Return::NO_ERROR == result;
+             ++i) {
+            result = pEngine->AddSensor(pSensors[i], sensorId);
+            if (E_Return::NO_ERROR != result) {
+                LOG_ERROR(
+                    "Failed to add sensor %s. Error %d\n",
+                    pSensors[i]->GetName(),
+                    result
+                );
+            }
+        }
+    }
+
+    if (E_Return::NO_ERROR == result) {
+        result = pEngine->Start();
+        if (E_Return::NO_ERROR != result) {
+            LOG_ERROR("Failed to start the sensors. Error: %d\n", result);
+        }
+    }
+
+    return result;
+}
+
+static E_Return BootHistory(void) noexcept {
+    TimeSeriesStore* pStore;
+    E_Return         result;
+
+    pStore = new TimeSeriesStore();
+    if (nullptr != pStore) {
+        result = pStore->Start();
+        if (E_Return::NO_ERROR != result) {
+            LOG_ERROR("Failed to start the history. Error: %d\n", result);
+            result = E_Return::NO_ERROR;
+        }
+    }
+    else {
+        LOG_ERROR("Failed to instanciate the time series store.\n");
+        result = E_Return::ERR_MEMORY;
+    }
+
+    return result;
+}
+
+static E_Return BootMonitor(void) noexcept {
+    SystemMonitor* pMonitor;
+    E_Return       result;
+
+    pMonitor = new SystemMonitor();
+    if (nullptr != pMonitor) {
+        result = pMonitor->Start();
+        if (E_Return::NO_ERROR != result) {
+            LOG_ERROR("Failed to start the monitor. Error: %d\n", result);
+            result = E_Return::NO_ERROR;
+        }
+    }
+    else {
+        LOG_ERROR("Failed to instanciate the system monitor.\n");
+        result = E_Return::ERR_MEMORY;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+ModeManager::ModeManager(void) noexcept {
+    /* The mode is read from the RTC record, before the SD card is mounted */
+    BootRecord::Load();
+    this->_currentMode = BootRecord::GetMode();
+    this->_pMaintServer = nullptr;
+    this->_pMaintHandlers = nullptr;
+
+    /* Get the last reset reason */
+    GetLastReset();
+}
+
+ModeManager::~ModeManager(void) noexcept {
+    PANIC("Tried to destroy the Mode manager.\n");
+}
+
+E_Return ModeManager::SetMode(const E_Mode kMode) noexcept {
+    E_Return retVal;
+    S_Event  event;
+
+    /* The RTC record survives the reboot even if the NVS copy failed */
+    BootRecord::SetResetCause(E_ResetCause::RESET_CAUSE_REQUEST, "Mode change");
+    retVal = BootRecord::SetMode(kMode);
+    if (E_Return::NO_ERROR != retVal) {
+        LOG_ERROR("The execution mode will not survive a power cycle.\n");
+    }
+
+    /* The subscribers are served during the reboot flush delay */
+    event.id                   = E_EventId::EVENT_MODE_CHANGE;
+    event.data.modeChange.mode = kMode;
+    EventBus::Publish(event);
+
+    HWManager::Reboot(false);
+
     return retVal;
 }
 
@@ -153,8 +499,6 @@ E_Mode ModeManager::GetMode(void) const noexcept {
 
 void ModeManager::StartFirmware(void) noexcept {
     SystemState* pSystemState;
-    Storage*     pStorage;
-    FsFile       file;
 
     /* Init system state */
     pSystemState = SystemState::GetInstance();
@@ -162,32 +506,6 @@ void ModeManager::StartFirmware(void) noexcept {
         /* Set system state */
         pSystemState->SetModeManager(this);
 
-        /* Init storage */
-        pStorage = pSystemState->GetStorage();
-        if (nullptr != pStorage) {
-            /* Read the current mode */
-            file = pStorage->Open(FIRMWARE_MODE_PATH, O_RDONLY);
-            if (file.isOpen()) {
-                if (sizeof(E_Mode) !=
-                    file.read(&this->_currentMode, sizeof(E_Mode))) {
-                    LOG_ERROR("Failed to read execution mode.\n");
-                    this->_currentMode = E_Mode::MODE_MAINTENANCE;
-                }
-
-                if (!file.close()) {
-                    LOG_ERROR("Failed to close mode file.\n");
-                }
-            }
-            else {
-                LOG_ERROR("Failed to load execution mode.\n");
-                this->_currentMode = E_Mode::MODE_MAINTENANCE;
-            }
-        }
-        else {
-            LOG_ERROR("Failed to instanciate the Storage Manager.\n");
-            this->_currentMode = E_Mode::MODE_MAINTENANCE;
-        }
-
         /* Check force maintenance */
         if (this->_forceMaintenance) {
             LOG_INFO("Maintenance mode is forced.\n");
@@ -200,6 +518,8 @@ void ModeManager::StartFirmware(void) noexcept {
         this->_currentMode = E_Mode::MODE_FAULTED;
     }
 
+    BootTrace::Mark(E_BootPhase::BOOT_PHASE_MODE);
+
     /* Load the current mode */
     if (E_Mode::MODE_NOMINAL == this->_currentMode) {
         LOG_INFO("Booting in nominal mode.\n");
@@ -212,63 +532,26 @@ void ModeManager::StartFirmware(void) noexcept {
     else {
         LOG_ERROR("Faulted mode enacted.\n");
     }
+
+    BootTrace::Mark(E_BootPhase::BOOT_PHASE_READY);
 }
 
 void ModeManager::StartNominal(void) const noexcept {
-    HealthMonitor*   pHealthMon;
-    WiFiModule*      pWifiModule;
-    Settings*        pSettings;
-    IOButtonManager* pBtnManager;
-    IOLedManager*    pLedManager;
-    ResetManager*    pResetManager;
-    IOTask*          pIOTask;
-    E_Return         result;
-    uint32_t         resetActionId;
+    E_Return result;
+    uint32_t failedStage;
 
-    pHealthMon = new HealthMonitor();
-    if (nullptr == pHealthMon) {
-        PANIC("Failed to instanciate the Health Monitor.\n");
-    }
-    pSettings = new Settings();
-    if (nullptr == pSettings) {
-        PANIC("Failed to instanciate the Settings.\n");
-    }
-    pWifiModule = new WiFiModule();
-    if (nullptr == pWifiModule) {
-        PANIC("Failed to instanciate the WiFi Module.\n");
-    }
-    pBtnManager = new IOButtonManager();
-    if (nullptr == pBtnManager) {
-        PANIC("Failed to instanciate the IO Button Manager.\n");
-    }
-    pLedManager = new IOLedManager();
-    if (nullptr == pLedManager) {
-        PANIC("Failed to instanciate the IO Led Manager.\n");
-    }
-
-    /* Setup reset */
-    pResetManager = new ResetManager();
-    result = pBtnManager->AddAction(pResetManager, resetActionId);
-    if (E_Return::NO_ERROR != result) {
-        PANIC("Failed to add reset action. Error %d\n", result);
-    }
-
-    /* Create the IO task */
-    pIOTask = new IOTask();
-    if (nullptr == pIOTask) {
-        PANIC("Failed to instanciate the IO Task.\n");
-    }
+    BootSequencer sequencer(
+        skNominalStages,
+        sizeof(skNominalStages) / sizeof(skNominalStages[0])
+    );
 
-    /* Initialize the WiFi */
-    result = pWifiModule->Start();
+    result = sequencer.Run(failedStage);
     if (E_Return::NO_ERROR != result) {
-        PANIC("Failed to start the WiFi module. Error: %d\n", result);
-    }
-
-    /* Start the web servers */
-    result = pWifiModule->StartWebServers();
-    if (E_Return::NO_ERROR != result) {
-        PANIC("Failed to start the Web Servers. Error: %d\n", result);
+        PANIC(
+            "Failed boot stage %s. Error: %d\n",
+            skNominalStages[failedStage].pkName,
+            result
+        );
     }
 }
 
@@ -291,6 +574,7 @@ void ModeManager::StartMaintenance(void) noexcept {
         memcpy(wifiIp, ip.c_str(), ip.length());
 
         LOG_INFO("    IP Address: %s\n", wifiIp);
+        BootTrace::Mark(E_BootPhase::BOOT_PHASE_WIFI);
 
         /* Start the maintenance web server */
         StartMaintenanceServer();
@@ -301,16 +585,17 @@ void ModeManager::StartMaintenance(void) noexcept {
 }
 
 void ModeManager::StartMaintenanceServer(void) noexcept {
-    MaintenanceWebServerHandlers* pHandlers;
-
     this->_pMaintServer = new WebServer(MAINTENANCE_WEB_SERVER_PORT);
     if (nullptr != this->_pMaintServer) {
 
         /* Create the handler */
-        pHandlers = new MaintenanceWebServerHandlers(this->_pMaintServer);
-        if (nullptr != pHandlers) {
+        this->_pMaintHandlers = new MaintenanceWebServerHandlers(
+            this->_pMaintServer
+        );
+        if (nullptr != this->_pMaintHandlers) {
             /* Start the server */
             this->_pMaintServer->begin();
+            BootTrace::Mark(E_BootPhase::BOOT_PHASE_SERVERS);
 
             LOG_INFO(
                 "Started maintenance interface on port %d.\n",
@@ -328,9 +613,10 @@ void ModeManager::StartMaintenanceServer(void) noexcept {
 
 void ModeManager::PeriodicUpdate(void) noexcept {
     if (E_Mode::MODE_MAINTENANCE == this->_currentMode &&
-        nullptr != this->_pMaintServer) {
-        /* Handle maintenance web server */
+        nullptr != this->_pMaintHandlers) {
+        /* Handle maintenance web server and its live stream */
         this->_pMaintServer->handleClient();
+        this->_pMaintHandlers->GetEventStream()->Update();
     }
     else if (E_Mode::MODE_FAULTED == this->_currentMode) {
         LOG_ERROR("Faulted instance. Please re-flash the firmware.\n");
@@ -344,9 +630,11 @@ void ModeManager::PeriodicUpdate(void) noexcept {
 
 void ModeManager::GetLastReset(void) noexcept {
     esp_reset_reason_t cpuReset;
-    /* Get the CPUs resets */
-    cpuReset = esp_reset_reason();
-    LOG_INFO("Reset reason: %d.\n", cpuReset);
+    S_ResetInfo        reset;
+
+    /* Get the CPUs resets, recorded with the firmware reset cause */
+    BootRecord::GetLastReset(reset);
+    cpuReset = (esp_reset_reason_t)reset.hwReason;
 
     switch (cpuReset) {
         case ESP_RST_UNKNOWN:
@@ -366,4 +654,9 @@ void ModeManager::GetLastReset(void) noexcept {
         default:
             this->_forceMaintenance = true;
     }
+
+    /* A critical error restarts cleanly, the record keeps its cause */
+    if (E_ResetCause::RESET_CAUSE_CRITICAL == reset.cause) {
+        this->_forceMaintenance = true;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * @file OutageBuffer.cpp
+ *
+ * @see OutageBuffer.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Store-and-forward buffer.
+ *
+ * @details Store-and-forward buffer. The records that cannot be sent while
+ * the uplink is down are kept in a bounded memory queue, then in an overflow
+ * file on the SD card, until they are drained in order.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstring>         /* memcpy */
+#include <cstdint>         /* Standard integer definitions */
+#include <algorithm>       /* std::min */
+#include <BSP.h>           /* Hardware services */
+#include <Errors.h>        /* Errors definitions */
+#include <Logger.h>        /* Logger services */
+#include <Storage.h>       /* Storage manager */
+#include <SystemState.h>   /* System state */
+#include <esp_heap_caps.h> /* Capability based allocation */
+
+/* Header file */
+#include <OutageBuffer.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+OutageBuffer::OutageBuffer(const size_t   kRecordSize,
+                           const uint32_t kQueueRecords,
+                           const char*    kpPath) noexcept {
+    this->_recordSize = kRecordSize;
+    this->_capacity = kQueueRecords;
+    this->_head = 0;
+    this->_count = 0;
+    this->_kpPath = kpPath;
+    this->_fileHead = 0;
+    this->_fileCount = 0;
+    this->_dropped = 0;
+
+    /* The queue is allocated once, external memory is preferred */
+    this->_pQueue = (uint8_t*)heap_caps_malloc(
+        kQueueRecords * kRecordSize,
+        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+    );
+    if (nullptr == this->_pQueue) {
+        this->_pQueue = (uint8_t*)heap_caps_malloc(
+            kQueueRecords * kRecordSize,
+            MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+        );
+    }
+    if (nullptr == this->_pQueue) {
+        PANIC("Failed to allocate the outage queue.\n");
+    }
+}
+
+OutageBuffer::~OutageBuffer(void) noexcept {
+    PANIC("Tried to destroy an outage buffer.\n");
+}
+
+void OutageBuffer::Reset(void) noexcept {
+    Storage* pStorage;
+
+    this->_head = 0;
+    this->_count = 0;
+    this->_fileHead = 0;
+    this->_fileCount = 0;
+    this->_dropped = 0;
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage &&
+        E_Return::NO_ERROR == pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        pStorage->Remove(this->_kpPath);
+        pStorage->ReleaseSPIBus();
+    }
+}
+
+E_Return OutageBuffer::Push(const void* kpRecord) noexcept {
+    E_Return error;
+
+    error = E_Return::NO_ERROR;
+    if (0 == this->_fileCount && this->_capacity > this->_count) {
+        memcpy(
+            this->_pQueue +
+            ((this->_head + this->_count) % this->_capacity) *
+            this->_recordSize,
+            kpRecord,
+            this->_recordSize
+        );
+        ++this->_count;
+    }
+    else if (!Spill(kpRecord)) {
+        if (0 == this->_fileCount) {
+            /* Without the file, the queue keeps the most recent records */
+            memcpy(
+                this->_pQueue + this->_head * this->_recordSize,
+                kpRecord,
+                this->_recordSize
+            );
+            this->_head = (this->_head + 1) % this->_capacity;
+        }
+        /* Otherwise the record cannot overtake the spilled ones */
+        ++this->_dropped;
+        error = E_Return::ERR_OUTAGE_FULL;
+    }
+
+    return error;
+}
+
+uint32_t OutageBuffer::Peek(void* pRecords, const uint32_t kMaxCount) noexcept {
+    uint32_t count;
+    uint32_t first;
+
+    if (0 != this->_fileCount && this->_capacity > this->_count) {
+        Refill();
+    }
+
+    /* The records wrap at most once around the end of the queue */
+    count = std::min(this->_count, kMaxCount);
+    first = std::min(count, this->_capacity - this->_head);
+    memcpy(
+        pRecords,
+        this->_pQueue + this->_head * this->_recordSize,
+        first * this->_recordSize
+    );
+    memcpy(
+        (uint8_t*)pRecords + first * this->_recordSize,
+        this->_pQueue,
+        (count - first) * this->_recordSize
+    );
+
+    return count;
+}
+
+void OutageBuffer::Release(const uint32_t kCount) noexcept {
+    uint32_t count;
+
+    count = std::min(this->_count, kCount);
+    this->_head = (this->_head + count) % this->_capacity;
+    this->_count -= count;
+}
+
+uint32_t OutageBuffer::GetCount(void) const noexcept {
+    return this->_count + this->_fileCount;
+}
+
+void OutageBuffer::GetStats(S_OutageStats& rStats) const noexcept {
+    rStats.queued = this->_count;
+    rStats.spilled = this->_fileCount;
+    rStats.dropped = this->_dropped;
+}
+
+bool OutageBuffer::Spill(const void* kpRecord) noexcept {
+    Storage* pStorage;
+    FsFile   file;
+    bool     isWritten;
+
+    isWritten = false;
+    pStorage = SystemState::GetInstance()->GetStorage();
+
+    /* The file only shrinks once drained, its length is bounded */
+    if (nullptr != pStorage &&
+        OUTAGE_FILE_MAX_RECORDS > this->_fileHead + this->_fileCount &&
+        E_Return::NO_ERROR == pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        file = pStorage->Open(this->_kpPath, O_RDWR | O_CREAT);
+        if (file.isOpen()) {
+            isWritten =
+                file.seekSet(
+                    (uint64_t)(this->_fileHead + this->_fileCount) *
+                    this->_recordSize
+                ) &&
+                this->_recordSize == file.write(kpRecord, this->_recordSize);
+            file.close();
+        }
+        pStorage->ReleaseSPIBus();
+    }
+
+    if (isWritten) {
+        if (0 == this->_fileCount) {
+            LOG_DEBUG("Outage queue full, spilling to %s.\n", this->_kpPath);
+        }
+        ++this->_fileCount;
+    }
+
+    return isWritten;
+}
+
+void OutageBuffer::Refill(void) noexcept {
+    Storage* pStorage;
+    FsFile   file;
+    uint32_t count;
+    uint32_t tail;
+    uint32_t first;
+    size_t   size;
+    bool     isRead;
+
+    isRead = false;
+    count = std::min(
+        std::min(this->_capacity - this->_count, this->_fileCount),
+        (uint32_t)OUTAGE_REFILL_RECORDS
+    );
+    tail = (this->_head + this->_count) % this->_capacity;
+    first = std::min(count, this->_capacity - tail);
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage &&
+        E_Return::NO_ERROR == pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        file = pStorage->Open(this->_kpPath, O_RDONLY);
+        if (file.isOpen()) {
+            /* The free space of the queue wraps at most once */
+            size = first * this->_recordSize;
+            isRead = file.seekSet(
+                         (uint64_t)this->_fileHead * this->_recordSize
+                     ) &&
+                     (int)size == file.read(
+                         this->_pQueue + tail * this->_recordSize,
+                         size
+                     );
+            size = (count - first) * this->_recordSize;
+            if (isRead && 0 != size) {
+                isRead = (int)size == file.read(this->_pQueue, size);
+            }
+            file.close();
+        }
+
+        if (isRead) {
+            this->_count += count;
+            this->_fileHead += count;
+            this->_fileCount -= count;
+            if (0 == this->_fileCount) {
+                pStorage->Remove(this->_kpPath);
+                this->_fileHead = 0;
+            }
+        }
+        pStorage->ReleaseSPIBus();
+    }
+}
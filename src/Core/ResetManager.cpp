@@ -21,6 +21,9 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
 /* Included headers */
 #include <BSP.h>             /* Hardware layer */
 #include <cstdint>           /* Standard Integer Definitions */
@@ -120,7 +123,6 @@ static const S_LedState sNoneLedState = {
  ******************************************************************************/
 ResetManager::ResetManager(void) noexcept {
     this->_state = E_ResetState::RESET_NONE;
-    this->_resetStartTime = 0;
 
     LOG_DEBUG("Reset Manager initialized.\n");
 }
@@ -129,23 +131,25 @@ ResetManager::~ResetManager(void) noexcept {
     PANIC("Tried to destroy the Reset Manager.\n");
 }
 
-void ResetManager::Execute(
-    const uint64_t kpBtnLastPress[E_ButtonID::BUTTON_MAX_ID],
-    const E_ButtonState kpBtnStates[E_ButtonID::BUTTON_MAX_ID])
-    noexcept {
+void ResetManager::OnEvent(const uint32_t     kSubId,
+                           const E_ButtonID   kBtnId,
+                           const E_ButtonEdge kEdge,
+                           const uint64_t     kTime) noexcept {
+    IOLedManager*    pLed;
+    IOButtonManager* pBtn;
 
-    IOLedManager* pLed;
+    (void)kBtnId;
 
-    /* Get the IO led manager */
+    /* Get the IO managers */
     pLed = SystemState::GetInstance()->GetIOLedManager();
+    pBtn = SystemState::GetInstance()->GetIOButtonManager();
 
     switch (this->_state) {
         case E_ResetState::RESET_NONE:
             /* Check if the reset button is keeped */
-            if (E_ButtonState::BTN_STATE_KEEP ==
-                kpBtnStates[E_ButtonID::BUTTON_RESET]) {
+            if (E_ButtonEdge::BTN_EDGE_KEEP == kEdge) {
                 /* Wait for timeout */
-                this->_resetStartTime = HWManager::GetTime();
+                pBtn->SetTimer(kSubId, kTime + RESET_PERFORM_WAIT_NS);
                 this->_state = E_ResetState::RESET_WAIT;
                 pLed->SetState(E_LedID::LED_INFO, sWaitLedState);
 
@@ -155,24 +159,16 @@ void ResetManager::Execute(
             break;
 
         case E_ResetState::RESET_WAIT:
-            if (E_ButtonState::BTN_STATE_KEEP ==
-                kpBtnStates[E_ButtonID::BUTTON_RESET]) {
+            /* The timer expires while the button is still keeped */
+            if (E_ButtonEdge::BTN_EDGE_TIMER == kEdge) {
+                this->_state = E_ResetState::RESET_PERFORM_WAIT_UP;
+                pLed->SetState(E_LedID::LED_INFO, sWaitUpLedState);
 
-                /* Wait for timeout */
-                if (RESET_PERFORM_WAIT_NS <=
-                    HWManager::GetTime() - this->_resetStartTime) {
-                    /* Perform reset */
-                    this->_resetStartTime = HWManager::GetTime();
-                    this->_state = E_ResetState::RESET_PERFORM_WAIT_UP;
-                    pLed->SetState(E_LedID::LED_INFO, sWaitUpLedState);
-
-                    LOG_DEBUG(
-                        "Reset manager transitioning: WAIT -> WAIT_UP.\n"
-                    );
-                }
+                LOG_DEBUG("Reset manager transitioning: WAIT -> WAIT_UP.\n");
             }
-            else {
+            else if (E_ButtonEdge::BTN_EDGE_RELEASE == kEdge) {
                 /* Go back to none */
+                pBtn->SetTimer(kSubId, 0);
                 this->_state = E_ResetState::RESET_NONE;
                 pLed->SetState(E_LedID::LED_INFO, sNoneLedState);
             }
@@ -181,9 +177,8 @@ void ResetManager::Execute(
 
         case E_ResetState::RESET_PERFORM_WAIT_UP:
             /* Check that the button is up again */
-            if (E_ButtonState::BTN_STATE_UP ==
-                kpBtnStates[E_ButtonID::BUTTON_RESET]) {
-                this->_resetStartTime = HWManager::GetTime();
+            if (E_ButtonEdge::BTN_EDGE_RELEASE == kEdge) {
+                pBtn->SetTimer(kSubId, kTime + RESET_PERFORM_TIMEOUT_NS);
                 this->_state = E_ResetState::RESET_PERFORM_WAIT_DOWN;
                 pLed->SetState(E_LedID::LED_INFO, sWaitDownLedState);
 
@@ -196,36 +191,31 @@ void ResetManager::Execute(
 
         case E_ResetState::RESET_PERFORM_WAIT_DOWN:
             /* Wait for confirmation timeout check */
-            if (RESET_PERFORM_TIMEOUT_NS <=
-                HWManager::GetTime() - this->_resetStartTime) {
+            if (E_ButtonEdge::BTN_EDGE_TIMER == kEdge) {
                 this->_state = E_ResetState::RESET_NONE;
                 pLed->SetState(E_LedID::LED_INFO, sNoneLedState);
-                break;
 
                 LOG_DEBUG(
-                    "Reset manager transitioning: WAIT_UP -> NONE.\n"
+                    "Reset manager transitioning: WAIT_DOWN -> NONE.\n"
                 );
             }
-
             /* Check that the button is down again */
-            if (E_ButtonState::BTN_STATE_DOWN ==
-                kpBtnStates[E_ButtonID::BUTTON_RESET]) {
+            else if (E_ButtonEdge::BTN_EDGE_PRESS == kEdge) {
+                pBtn->SetTimer(kSubId, 0);
                 this->_state = E_ResetState::RESET_PERFORM;
 
                 LOG_DEBUG(
-                    "Reset manager transitioning: WAIT_UP -> PERFORM.\n"
+                    "Reset manager transitioning: WAIT_DOWN -> PERFORM.\n"
                 );
-            }
-            break;
 
-        case E_ResetState::RESET_PERFORM:
-            PerformReset();
-            this->_state = E_ResetState::RESET_NONE;
-            pLed->SetState(E_LedID::LED_INFO, sNoneLedState);
+                PerformReset();
+                this->_state = E_ResetState::RESET_NONE;
+                pLed->SetState(E_LedID::LED_INFO, sNoneLedState);
 
-            LOG_DEBUG(
-                "Reset manager transitioning: PERFORM -> NONE.\n"
-            );
+                LOG_DEBUG(
+                    "Reset manager transitioning: PERFORM -> NONE.\n"
+                );
+            }
             break;
 
         default:
@@ -22,14 +22,22 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
 /* Included headers */
 #include <string>          /* Standard strings */
+#include <cstring>         /* String manipulation */
 #include <Logger.h>        /* Logger services */
 #include <Errors.h>        /* Errors definitions */
 #include <Storage.h>       /* Preference storage */
-#include <Arduino.h>       /* Arduino framework */
+#include <HAL.h>           /* Hardware abstraction layer */
 #include <SystemState.h>   /* System state services */
 #include <unordered_map>   /* Settings map */
+#include <unordered_set>   /* Modified settings set */
+#include <atomic>          /* Atomic sequence counter */
+#include <EventBus.h>      /* Subsystems events */
+#include <Metrics.h>       /* Metrics counters */
 /* Header file */
 #include <Settings.h>
 
@@ -39,17 +47,69 @@
  ******************************************************************************/
 /** @brief Defines the name of the preference instance. */
 #define SETTINGS_PREF_NAME "rthrws_settings"
+/** @brief Defines the name of the alternate settings file. */
+#define SETTINGS_PREF_ALT_NAME "rthrws_settings.b"
+/** @brief Defines the number of settings files. */
+#define SETTINGS_FILE_COUNT 2
+
+/** @brief Defines the settings file magic, not a valid legacy name start. */
+#define SETTINGS_FILE_MAGIC 0x53544EA5
+/** @brief Defines the settings file format version. */
+#define SETTINGS_FILE_VERSION 2
+/** @brief Defines the maximal settings file size in bytes. */
+#define SETTINGS_FILE_MAX_SIZE (SETTINGS_ARENA_SIZE / 2)
+/** @brief Defines the journal size after which the settings are compacted. */
+#define SETTINGS_JOURNAL_MAX_SIZE 2048
+
+/**
+ * @brief Defines the number of snapshot read attempts before falling back to
+ * the locked read.
+ */
+#define SETTINGS_SNAPSHOT_RETRIES 8
 
 /** @brief Defines the settings lock timeout in nanoseconds. */
 #define SETTINGS_LOCK_TIMEOUT_NS 20000000ULL
-/** @brief Defines the settings lock timeout in ticks. */
-#define SETTINGS_LOCK_TIMEOUT_TICKS \
-    (pdMS_TO_TICKS(SETTINGS_LOCK_TIMEOUT_NS / 1000000ULL))
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-/* None */
+
+/**
+ * @brief Settings file header. The header is followed by the entries, each
+ * entry is followed by its name, without terminator, and its value. The
+ * entries are followed by the journal records appended on commit.
+ */
+typedef struct __attribute__((packed)) {
+    /** @brief File magic. */
+    uint32_t magic;
+    /** @brief File format version. */
+    uint16_t version;
+    /** @brief Number of entries in the file. */
+    uint16_t count;
+    /** @brief Size of the entries in bytes. */
+    uint32_t payloadSize;
+    /** @brief Compaction generation, the newest file is the active one. */
+    uint32_t generation;
+    /** @brief CRC32 of the entries. */
+    uint32_t checksum;
+} S_SettingsFileHeader;
+
+/** @brief Settings file entry. */
+typedef struct __attribute__((packed)) {
+    /** @brief Size of the setting name. */
+    uint8_t nameSize;
+    /** @brief Size of the setting value. */
+    uint16_t valueSize;
+} S_SettingsFileEntry;
+
+/**
+ * @brief Settings journal record trailer. A journal record is an entry, its
+ * name, its value and this trailer.
+ */
+typedef struct __attribute__((packed)) {
+    /** @brief CRC32 of the record entry, name and value. */
+    uint32_t checksum;
+} S_SettingsJournalTrailer;
 
 /*******************************************************************************
  * MACROS
@@ -59,7 +119,32 @@
 /*******************************************************************************
  * STATIC FUNCTIONS DECLARATIONS
  ******************************************************************************/
-/* None */
+
+/**
+ * @brief Gets the identifier of a setting.
+ *
+ * @details Gets the identifier of a setting from its name.
+ *
+ * @param[in] krName The setting name.
+ *
+ * @return The setting identifier is returned, SETTING_ID_MAX if the setting
+ * is not identified.
+ */
+static E_SettingId GetSettingId(const std::string& krName) noexcept;
+
+/**
+ * @brief Tells if a setting fits in a file entry.
+ *
+ * @details Tells if the name and value sizes of a setting fit in the sizes
+ * fields of a settings file entry.
+ *
+ * @param[in] krName The setting name.
+ * @param[in] kFieldSize The setting value size.
+ *
+ * @return true is returned when the setting fits in a file entry.
+ */
+static bool FitsFileEntry(const std::string& krName,
+                          const size_t       kFieldSize) noexcept;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -72,12 +157,33 @@
 /* None */
 
 /************************** Static global variables ***************************/
-/* None */
+/** @brief Settings files, used as A/B slots on compaction. */
+static const char* skpSettingsFiles[SETTINGS_FILE_COUNT] = {
+    SETTINGS_PREF_NAME,
+    SETTINGS_PREF_ALT_NAME
+};
 
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
-/* None */
+
+static E_SettingId GetSettingId(const std::string& krName) noexcept {
+    uint8_t id;
+
+    id = 0;
+    while (SETTING_ID_MAX > id &&
+           0 != krName.compare(SettingName((E_SettingId)id))) {
+        ++id;
+    }
+
+    return (E_SettingId)id;
+}
+
+static bool FitsFileEntry(const std::string& krName,
+                          const size_t       kFieldSize) noexcept {
+    return 0 < krName.size() && UINT8_MAX >= krName.size() &&
+           UINT16_MAX >= kFieldSize;
+}
 
 /*******************************************************************************
  * CLASS METHODS
@@ -86,15 +192,38 @@
 Settings::Settings(void) noexcept {
     /* Start the settings preference */
     this->_pStorage = SystemState::GetInstance()->GetStorage();
+    this->_isStorageLoaded = false;
+    this->_activeFile = 0;
+    memset(this->_isValueLoaded, 0, sizeof(this->_isValueLoaded));
+    this->_valuesSequence.store(0);
+    this->_changedIds = 0;
+    memset(this->_subscribers, 0, sizeof(this->_subscribers));
+    this->_generation = 0;
+    this->_activeSize = 0;
+    this->_journalSize = 0;
 
     /* Create the lock */
-    this->_lock = xSemaphoreCreateMutex();
+    this->_lock = HAL::CreateMutex();
     if (nullptr == this->_lock) {
         PANIC("Failed to create the Settings lock.\n");
     }
 
-    /* Initializes the default settings */
-    InitializeDefault();
+    /* Create the values arena, external memory is preferred */
+#if SETTINGS_ARENA_PSRAM
+    this->_pArena = (uint8_t*)HAL::Allocate(SETTINGS_ARENA_SIZE, true);
+#else
+    this->_pArena = nullptr;
+#endif
+    this->_isArenaExternal = (nullptr != this->_pArena);
+    if (nullptr == this->_pArena) {
+        this->_pArena = (uint8_t*)HAL::Allocate(SETTINGS_ARENA_SIZE, false);
+    }
+    if (nullptr == this->_pArena) {
+        PANIC("Failed to create the Settings arena.\n");
+    }
+    this->_arenaUsed        = 0;
+    this->_arenaPeak        = 0;
+    this->_arenaCompactions = 0;
 
     /* Add to system state */
     SystemState::GetInstance()->SetSettings(this);
@@ -109,24 +238,48 @@ Settings::~Settings(void) noexcept {
 E_Return Settings::GetSettings(const std::string& krName,
                                uint8_t*           pData,
                                const size_t       kDataLength) noexcept {
-    std::unordered_map<std::string, S_SettingField>::const_iterator it;
-    E_Return                                                        error;
+    T_SettingsCache::const_iterator it;
+    E_Return                        error;
+    E_SettingId                     id;
+    bool                            isStored;
 
     LOG_DEBUG("Getting setting %s.\n", krName.c_str());
 
-    if (pdPASS == xSemaphoreTake(this->_lock, SETTINGS_LOCK_TIMEOUT_TICKS)) {
+    if (HAL::TakeMutex(this->_lock, SETTINGS_LOCK_TIMEOUT_NS)) {
         /* Get the setting */
         it = this->_cache.find(krName);
 
         /* First check, if not exists, try to load from storage */
-        if (this->_cache.end() == it &&
-            E_Return::NO_ERROR == LoadFromStorage()) {
+        isStored = false;
+        if (this->_cache.end() == it) {
+            isStored = (E_Return::NO_ERROR == LoadFromStorage());
+            if (isStored) {
                 LOG_DEBUG("Loaded setting %s from NVS\n", krName.c_str());
                 it = this->_cache.find(krName);
+            }
         }
 
+        /* Identified settings never set fall through to their default */
+        id = GetSettingId(krName);
+        if (this->_cache.end() == it && isStored && SETTING_ID_MAX != id) {
+            if (kDataLength == SettingSize(id)) {
+                memcpy(pData, GetDefaultValue(id), kDataLength);
+
+                error = E_Return::NO_ERROR;
+            }
+            else {
+                LOG_ERROR(
+                    "Invalid setting size: %s (%d vs %d).\n",
+                    krName.c_str(),
+                    kDataLength,
+                    SettingSize(id)
+                );
+
+                error = E_Return::ERR_SETTING_NOT_FOUND;
+            }
+        }
         /* Second check, if still not exists, it is a failure */
-        if (this->_cache.end() != it) {
+        else if (this->_cache.end() != it) {
 
             /* Check size */
             if (kDataLength == it->second.fieldSize) {
@@ -152,7 +305,7 @@ E_Return Settings::GetSettings(const std::string& krName,
             error = E_Return::ERR_SETTING_NOT_FOUND;
         }
 
-        if (pdPASS != xSemaphoreGive(this->_lock)) {
+        if (!HAL::GiveMutex(this->_lock)) {
             PANIC("Failed to release the settings lock.\n");
         }
     }
@@ -167,32 +320,15 @@ E_Return Settings::GetSettings(const std::string& krName,
 E_Return Settings::GetDefault(const std::string& krName,
                               uint8_t*           pData,
                               const size_t       kDataLength) noexcept {
-    std::unordered_map<std::string, const S_SettingField>::const_iterator it;
-    E_Return                                                              error;
+    E_Return    error;
+    E_SettingId id;
 
     LOG_DEBUG("Getting default setting %s.\n", krName.c_str());
 
-    /* Get the setting */
-    it = this->_defaults.find(krName);
-
-    /* Second check, if still not exists, it is a failure */
-    if (this->_defaults.end() != it) {
-        /* Check size */
-        if (kDataLength == it->second.fieldSize) {
-            /* Get the value */
-            memcpy(pData, it->second.pValue, kDataLength);
-
-            error = E_Return::NO_ERROR;
-        }
-        else {
-            LOG_ERROR(
-                "Invalid setting size: %s (%d vs %d).\n",
-                krName.c_str(),
-                kDataLength,
-                it->second.fieldSize
-            );
-            error = E_Return::ERR_SETTING_NOT_FOUND;
-        }
+    /* Only the identified settings have a default */
+    id = GetSettingId(krName);
+    if (SETTING_ID_MAX != id) {
+        error = GetDefault(id, pData, kDataLength);
     }
     else {
         LOG_ERROR("Default setting %s not found.\n", krName.c_str());
@@ -205,134 +341,350 @@ E_Return Settings::GetDefault(const std::string& krName,
 E_Return Settings::SetSettings(const std::string& krName,
                                const uint8_t*     kpData,
                                const size_t       kDataLength) noexcept {
-    std::unordered_map<std::string, S_SettingField>::iterator it;
-    E_Return                                                  error;
-    S_SettingField                                            setting;
+    T_SettingsCache::iterator it;
+    E_Return                  error;
+    S_SettingField            setting;
+    E_SettingId               id;
+    bool                      isChanged;
 
     LOG_DEBUG("Setting setting %s.\n", krName.c_str());
 
     if (15 > krName.size()) {
-        setting.pValue = new uint8_t[kDataLength];
-
-        if (nullptr != setting.pValue) {
-            /* Set the field size */
-            setting.fieldSize = kDataLength;
-            memcpy(setting.pValue, kpData, kDataLength);
-
-            if (pdPASS == xSemaphoreTake(
-                    this->_lock,
-                    SETTINGS_LOCK_TIMEOUT_TICKS)
-                ) {
-                try {
-                    /* Get the setting and remove it exists */
-                    it = this->_cache.find(krName);
-                    if (this->_cache.end() != it) {
-                        /* Release memory and clear entry */
-                        delete[] it->second.pValue;
-                        this->_cache.erase(it);
-                    }
-
-                    this->_cache.emplace(krName, setting);
+        if (HAL::TakeMutex(this->_lock, SETTINGS_LOCK_TIMEOUT_NS)) {
+            try {
+                /* Values of the same size are updated in place */
+                isChanged = true;
+                it = this->_cache.find(krName);
+                if (this->_cache.end() != it &&
+                    kDataLength == it->second.fieldSize) {
+                    isChanged = (
+                        0 != memcmp(it->second.pValue, kpData, kDataLength)
+                    );
+                    memcpy(it->second.pValue, kpData, kDataLength);
 
                     error = E_Return::NO_ERROR;
                 }
-                catch (std::exception& rExc) {
+                else {
+                    setting.pValue    = ArenaAllocate(kDataLength);
+                    setting.fieldSize = kDataLength;
+                    if (nullptr != setting.pValue) {
+                        memcpy(setting.pValue, kpData, kDataLength);
+
+                        /* The previous value is reclaimed by compaction */
+                        it = this->_cache.find(krName);
+                        if (this->_cache.end() != it) {
+                            it->second = setting;
+                        }
+                        else {
+                            this->_cache.emplace(krName, setting);
+                        }
+
+                        error = E_Return::NO_ERROR;
+                    }
+                    else {
+                        LOG_ERROR(
+                            "Failed to allocate setting %s.\n",
+                            krName.c_str()
+                        );
 
-                    LOG_ERROR(
-                        "Failed to set setting %s.\n",
-                        krName.c_str()
-                    );
+                        error = E_Return::ERR_MEMORY;
+                    }
+                }
 
-                    delete[] setting.pValue;
-                    error = E_Return::ERR_MEMORY;
+                /* Only the modified settings are written and notified */
+                if (E_Return::NO_ERROR == error && isChanged) {
+                    this->_dirty.insert(krName);
+
+                    /* Update the identified setting value */
+                    id = GetSettingId(krName);
+                    if (SETTING_ID_MAX != id) {
+                        UpdateValue(id, kpData, kDataLength);
+                        this->_changedIds |= (1UL << id);
+                    }
                 }
+            }
+            catch (std::exception& rExc) {
+                LOG_ERROR("Failed to set setting %s.\n", krName.c_str());
+
+                error = E_Return::ERR_MEMORY;
+            }
+
+            if (!HAL::GiveMutex(this->_lock)) {
+                PANIC("Failed to release the setting lock.\n");
+            }
+        }
+        else {
+            LOG_ERROR("Failed to acquire settings lock.\n");
+            error = E_Return::ERR_SETTING_TIMEOUT;
+        }
+    }
+    else {
+        LOG_ERROR("Invalid setting name: %s.\n", krName.c_str());
+
+        error = E_Return::ERR_SETTING_INVALID;
+    }
+
+    return error;
+}
+
+E_Return Settings::GetSetting(const E_SettingId kId,
+                              uint8_t*          pData,
+                              const size_t      kDataLength) noexcept {
+    E_Return error;
+
+    if (SETTING_ID_MAX > kId && SettingSize(kId) == kDataLength) {
+        /* Loaded values are read without the lock */
+        if (ReadValueSnapshot(kId, pData, kDataLength)) {
+            error = E_Return::NO_ERROR;
+        }
+        else if (HAL::TakeMutex(
+                this->_lock,
+                SETTINGS_LOCK_TIMEOUT_NS)
+            ) {
+            error = E_Return::NO_ERROR;
+            if (!this->_isValueLoaded[kId]) {
+                error = LoadValue(kId);
+            }
+
+            if (E_Return::NO_ERROR == error) {
+                memcpy(pData, this->_values + SettingOffset(kId), kDataLength);
+            }
+
+            if (!HAL::GiveMutex(this->_lock)) {
+                PANIC("Failed to release the settings lock.\n");
+            }
+        }
+        else {
+            LOG_ERROR("Failed to acquire settings lock.\n");
+
+            error = E_Return::ERR_SETTING_TIMEOUT;
+        }
+    }
+    else {
+        LOG_ERROR("Invalid setting identifier or size: %d.\n", kId);
+
+        error = E_Return::ERR_SETTING_NOT_FOUND;
+    }
+
+    return error;
+}
+
+E_Return Settings::GetDefault(const E_SettingId kId,
+                              uint8_t*          pData,
+                              const size_t      kDataLength) noexcept {
+    E_Return error;
+
+    if (SETTING_ID_MAX > kId && SettingSize(kId) == kDataLength) {
+        memcpy(pData, GetDefaultValue(kId), kDataLength);
+
+        error = E_Return::NO_ERROR;
+    }
+    else if (SETTING_ID_MAX > kId) {
+        LOG_ERROR(
+            "Invalid setting size: %s (%d vs %d).\n",
+            SettingName(kId),
+            kDataLength,
+            SettingSize(kId)
+        );
+
+        error = E_Return::ERR_SETTING_NOT_FOUND;
+    }
+    else {
+        LOG_ERROR("Invalid setting identifier: %d.\n", kId);
+
+        error = E_Return::ERR_SETTING_NOT_FOUND;
+    }
+
+    return error;
+}
+
+E_Return Settings::SetSetting(const E_SettingId kId,
+                              const uint8_t*    kpData,
+                              const size_t      kDataLength) noexcept {
+    E_Return error;
+
+    if (SETTING_ID_MAX > kId && SettingSize(kId) == kDataLength) {
+        error = SetSettings(SettingName(kId), kpData, kDataLength);
+    }
+    else {
+        LOG_ERROR("Invalid setting identifier or size: %d.\n", kId);
+
+        error = E_Return::ERR_SETTING_INVALID;
+    }
 
-                if (pdPASS != xSemaphoreGive(this->_lock)) {
-                    PANIC("Failed to release the setting lock.\n");
+    return error;
+}
+
+E_Return Settings::Subscribe(const E_SettingId        kId,
+                             const T_SettingsCallback kCallback,
+                             void*                    pArgs) noexcept {
+    E_Return error;
+    uint8_t  i;
+    uint8_t  freeSlot;
+
+    if (SETTING_ID_MAX > kId && nullptr != kCallback) {
+        if (HAL::TakeMutex(
+                this->_lock,
+                SETTINGS_LOCK_TIMEOUT_NS)
+            ) {
+            /* Add the setting to an existing subscriber or use a free slot */
+            freeSlot = SETTINGS_MAX_SUBSCRIBERS;
+            for (i = 0; SETTINGS_MAX_SUBSCRIBERS > i; ++i) {
+                if (this->_subscribers[i].callback == kCallback &&
+                    this->_subscribers[i].pArgs == pArgs) {
+                    freeSlot = i;
+                }
+                else if (SETTINGS_MAX_SUBSCRIBERS == freeSlot &&
+                         0 == this->_subscribers[i].ids) {
+                    freeSlot = i;
                 }
             }
+
+            if (SETTINGS_MAX_SUBSCRIBERS != freeSlot) {
+                this->_subscribers[freeSlot].callback = kCallback;
+                this->_subscribers[freeSlot].pArgs    = pArgs;
+                this->_subscribers[freeSlot].ids     |= (1UL << kId);
+
+                error = E_Return::NO_ERROR;
+            }
             else {
-                LOG_ERROR("Failed to acquire settings lock.\n");
-                delete[] setting.pValue;
-                error = E_Return::ERR_SETTING_TIMEOUT;
+                LOG_ERROR("No free settings subscriber slot.\n");
+
+                error = E_Return::ERR_MEMORY;
+            }
+
+            if (!HAL::GiveMutex(this->_lock)) {
+                PANIC("Failed to release the settings lock.\n");
             }
         }
         else {
-            LOG_ERROR(
-                "Failed to allocate setting %s.\n",
-                krName.c_str()
-            );
+            LOG_ERROR("Failed to acquire settings lock.\n");
 
-            error = E_Return::ERR_MEMORY;
+            error = E_Return::ERR_SETTING_TIMEOUT;
         }
     }
     else {
-        LOG_ERROR("Invalid setting name: %s.\n", krName.c_str());
+        LOG_ERROR("Invalid settings subscription: %d.\n", kId);
+
+        error = E_Return::ERR_SETTING_INVALID;
+    }
+
+    return error;
+}
+
+E_Return Settings::Unsubscribe(const E_SettingId        kId,
+                               const T_SettingsCallback kCallback,
+                               void*                    pArgs) noexcept {
+    E_Return error;
+    uint8_t  i;
+
+    if (SETTING_ID_MAX > kId) {
+        if (HAL::TakeMutex(
+                this->_lock,
+                SETTINGS_LOCK_TIMEOUT_NS)
+            ) {
+            for (i = 0; SETTINGS_MAX_SUBSCRIBERS > i; ++i) {
+                if (this->_subscribers[i].callback == kCallback &&
+                    this->_subscribers[i].pArgs == pArgs) {
+                    this->_subscribers[i].ids &= ~(1UL << kId);
+                }
+            }
+
+            if (!HAL::GiveMutex(this->_lock)) {
+                PANIC("Failed to release the settings lock.\n");
+            }
+
+            error = E_Return::NO_ERROR;
+        }
+        else {
+            LOG_ERROR("Failed to acquire settings lock.\n");
+
+            error = E_Return::ERR_SETTING_TIMEOUT;
+        }
+    }
+    else {
+        LOG_ERROR("Invalid settings subscription: %d.\n", kId);
 
         error = E_Return::ERR_SETTING_INVALID;
     }
 
     return error;
 }
-#include <BSP.h>
+
 E_Return Settings::Commit(void) noexcept {
-    std::unordered_map<std::string, S_SettingField>::const_iterator it;
-    E_Return                                                        error;
-    FsFile                                                          file;
+    T_SettingsNames::const_iterator it;
+    E_Return                        error;
+    size_t                          size;
+    uint32_t                        changedIds;
+    bool                            isValid;
+    S_SettingsSubscriber            subscribers[
+        SETTINGS_MAX_SUBSCRIBERS
+    ];
 
     LOG_DEBUG("Commiting settings.\n");
 
-    error = E_Return::NO_ERROR;
-    if (pdPASS == xSemaphoreTake(this->_lock, SETTINGS_LOCK_TIMEOUT_TICKS)) {
-
-        /* Clear the preference file */
-        this->_pStorage->Remove(SETTINGS_PREF_NAME);
-
-        /* Create the file */
-        file = this->_pStorage->Open(SETTINGS_PREF_NAME, O_RDWR | O_CREAT);
-        if (file.isOpen()) {
-            /* For all items in the cache, write to the preference */
-            for (it = this->_cache.begin(); this->_cache.end() != it; ++it) {
-                /* Write name */
-                if (file.write(it->first.c_str(), it->first.size() + 1) !=
-                    it->first.size() + 1) {
-                    LOG_ERROR("Failed to write setting name.\n");
-                    error = E_Return::ERR_SETTING_COMMIT_FAILURE;
-                    break;
-                }
+    if (HAL::TakeMutex(this->_lock, SETTINGS_LOCK_TIMEOUT_NS)) {
+        /* Get the active file, the modified settings are kept on load */
+        error = E_Return::NO_ERROR;
+        if (!this->_isStorageLoaded) {
+            error = LoadFromStorage();
+        }
 
-                /* Write size */
-                if (file.write(&it->second.fieldSize, sizeof(size_t)) !=
-                    sizeof(size_t)) {
-                    LOG_ERROR("Failed to write setting size.\n");
-                    error = E_Return::ERR_SETTING_COMMIT_FAILURE;
-                    break;
-                }
+        /*
+         * Invalid files are replaced, but a file that could not be read must
+         * not be superseded by an older generation.
+         */
+        if (E_Return::NO_ERROR == error ||
+            E_Return::ERR_SETTING_INVALID == error) {
+            /* Get the journal records size */
+            size    = 0;
+            isValid = true;
+            for (it = this->_dirty.begin(); this->_dirty.end() != it; ++it) {
+                size += sizeof(S_SettingsFileEntry) + it->size() +
+                        this->_cache[*it].fieldSize +
+                        sizeof(S_SettingsJournalTrailer);
+                isValid = isValid &&
+                          FitsFileEntry(*it, this->_cache[*it].fieldSize);
+            }
 
-                /* Write content */
-                if (file.write(it->second.pValue, it->second.fieldSize) !=
-                    it->second.fieldSize) {
-                    LOG_ERROR("Failed to write setting value.\n");
-                    error = E_Return::ERR_SETTING_COMMIT_FAILURE;
-                    break;
-                }
+            if (!isValid) {
+                LOG_ERROR("A setting does not fit in a journal record.\n");
+                error = E_Return::ERR_SETTING_INVALID;
+            }
+            else if (0 == size) {
+                error = E_Return::NO_ERROR;
+            }
+            else if (this->_isStorageLoaded &&
+                     SETTINGS_JOURNAL_MAX_SIZE >=
+                     this->_journalSize + size) {
+                error = AppendJournal(size);
+            }
+            else {
+                error = WriteToStorage();
             }
 
-            if (!file.close()) {
-                PANIC("Failed to close settings file.\n");
+            if (E_Return::NO_ERROR == error) {
+                this->_dirty.clear();
             }
         }
         else {
-            LOG_ERROR(
-                "Failed to open setting file. Error %d\n",
-                file.getError()
-            );
-            error = E_Return::ERR_SETTING_FILE_ERROR;
+            LOG_ERROR("Failed to load the settings before commit.\n");
+        }
+
+        /* Get the changes to notify once the lock is released */
+        changedIds = 0;
+        if (E_Return::NO_ERROR == error) {
+            changedIds        = this->_changedIds;
+            this->_changedIds = 0;
+            memcpy(subscribers, this->_subscribers, sizeof(subscribers));
         }
 
-        if (pdPASS != xSemaphoreGive(this->_lock)) {
+        if (!HAL::GiveMutex(this->_lock)) {
             PANIC("Failed to release the settings lock.\n");
         }
+
+        /* Subscribers may read the settings from their callback */
+        NotifySubscribers(changedIds, subscribers);
     }
     else {
         LOG_ERROR("Failed to acquire settings lock.\n");
@@ -344,24 +696,60 @@ E_Return Settings::Commit(void) noexcept {
 }
 
 E_Return Settings::ClearCache(void) noexcept {
-    std::unordered_map<std::string, S_SettingField>::const_iterator it;
-    E_Return                                                        error;
+    E_Return error;
 
     LOG_DEBUG("Clearing settings cache.\n");
 
     error = E_Return::NO_ERROR;
-    if (pdPASS == xSemaphoreTake(this->_lock, SETTINGS_LOCK_TIMEOUT_TICKS)) {
+    if (HAL::TakeMutex(this->_lock, SETTINGS_LOCK_TIMEOUT_NS)) {
+        this->_cache.clear();
+        this->_dirty.clear();
+        this->_changedIds = 0;
 
-        /* For all items in the cache, write to the preference */
-        for (it = this->_cache.begin(); this->_cache.end() != it; ++it) {
-            delete[] it->second.pValue;
+        BeginValuesUpdate();
+        memset(this->_isValueLoaded, 0, sizeof(this->_isValueLoaded));
+        EndValuesUpdate();
+
+        /* All the values are released at once */
+        this->_arenaUsed       = 0;
+        this->_isStorageLoaded = false;
+
+        if (!HAL::GiveMutex(this->_lock)) {
+            PANIC("Failed to release the settings lock.\n");
         }
+    }
+    else {
+        LOG_ERROR("Failed to acquire settings lock.\n");
 
-        this->_cache.clear();
+        error = E_Return::ERR_SETTING_TIMEOUT;
+    }
+
+    return error;
+}
+
+E_Return Settings::GetMemoryStats(S_SettingsMemoryStats* pStats) noexcept {
+    T_SettingsCache::const_iterator it;
+    S_HALHeapStats                  heapStats;
+    E_Return                        error;
+
+    if (HAL::TakeMutex(this->_lock, SETTINGS_LOCK_TIMEOUT_NS)) {
+        pStats->arenaSize        = SETTINGS_ARENA_SIZE;
+        pStats->arenaUsed        = this->_arenaUsed;
+        pStats->arenaPeak        = this->_arenaPeak;
+        pStats->arenaCompactions = this->_arenaCompactions;
+        pStats->isArenaExternal  = this->_isArenaExternal;
+        pStats->settingsCount    = this->_cache.size();
 
-        if (pdPASS != xSemaphoreGive(this->_lock)) {
+        pStats->liveSize = 0;
+        for (it = this->_cache.begin(); this->_cache.end() != it; ++it) {
+            pStats->liveSize += it->second.fieldSize;
+        }
+
+        if (!HAL::GiveMutex(this->_lock)) {
             PANIC("Failed to release the settings lock.\n");
         }
+
+        error = E_Return::NO_ERROR;
     }
     else {
         LOG_ERROR("Failed to acquire settings lock.\n");
@@ -369,114 +757,802 @@ E_Return Settings::ClearCache(void) noexcept {
         error = E_Return::ERR_SETTING_TIMEOUT;
     }
 
+    /* Internal heap state, the largest block shows the fragmentation */
+    HAL::GetHeapStats(heapStats);
+    pStats->heapFree         = heapStats.freeSize;
+    pStats->heapLargestBlock = heapStats.largestBlock;
+    pStats->heapMinFree      = heapStats.minFreeSize;
+
     return error;
 }
 
 E_Return Settings::LoadFromStorage(void) noexcept {
-    E_Return                                                        error;
-    S_SettingField                                                  setting;
-    size_t                                                          fieldSize;
-    int32_t                                                         readSize;
-    FsFile                                                          file;
-    std::unordered_map<std::string, S_SettingField>::const_iterator it;
-    std::string                                                     name;
+    E_Return             error;
+    S_SettingsFileHeader headers[SETTINGS_FILE_COUNT];
+    size_t               sizes[SETTINGS_FILE_COUNT];
+    bool                 isCandidate[SETTINGS_FILE_COUNT];
+    bool                 isCurrentFormat;
+    uint8_t*             pImage;
+    uint8_t*             pLegacyImage;
+    size_t               baseSize;
+    uint32_t             generation;
+    uint8_t              selected;
+    uint8_t              newest;
+    uint8_t              i;
 
     LOG_DEBUG("Loading setting from storage.\n");
 
-    file = this->_pStorage->Open(SETTINGS_PREF_NAME, O_RDONLY);
+    pImage       = nullptr;
+    pLegacyImage = nullptr;
+    baseSize     = 0;
+    generation   = 0;
+    selected     = SETTINGS_FILE_COUNT;
+
+    isCurrentFormat = false;
+    error = this->_pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS);
+    if (E_Return::NO_ERROR == error) {
+        /* Get the file headers */
+        for (i = 0; SETTINGS_FILE_COUNT > i; ++i) {
+            sizes[i] = 0;
+            if (E_Return::NO_ERROR == error) {
+                error = ReadImage(
+                    skpSettingsFiles[i],
+                    (uint8_t*)&headers[i],
+                    sizeof(S_SettingsFileHeader),
+                    &sizes[i]
+                );
+            }
+            isCandidate[i] = (
+                sizeof(S_SettingsFileHeader) <= sizes[i] &&
+                SETTINGS_FILE_MAX_SIZE >= sizes[i] &&
+                SETTINGS_FILE_MAGIC == headers[i].magic &&
+                SETTINGS_FILE_VERSION == headers[i].version
+            );
+            isCurrentFormat = isCurrentFormat || isCandidate[i];
+        }
+
+        /* Load the newest valid file in the arena, fall back on the other */
+        while (E_Return::NO_ERROR == error &&
+               SETTINGS_FILE_COUNT == selected &&
+               (isCandidate[0] || isCandidate[1])) {
+            newest = (isCandidate[0] &&
+                      (!isCandidate[1] ||
+                       headers[0].generation > headers[1].generation)) ? 0 : 1;
+            isCandidate[newest] = false;
+
+            pImage = ArenaAllocate(sizes[newest]);
+            if (nullptr != pImage) {
+                error = ReadImage(
+                    skpSettingsFiles[newest],
+                    pImage,
+                    sizes[newest],
+                    nullptr
+                );
+                if (E_Return::NO_ERROR == error) {
+                    baseSize = GetImageBaseSize(
+                        pImage,
+                        sizes[newest],
+                        &generation
+                    );
+                }
+                if (0 != baseSize) {
+                    selected = newest;
+                }
+                else {
+                    ArenaRelease(pImage, sizes[newest]);
+                    pImage = nullptr;
+                }
+            }
+            else {
+                LOG_ERROR("Failed to allocate the settings image.\n");
+                error = E_Return::ERR_MEMORY;
+            }
+        }
+
+        /*
+         * Previous format, migrated once from a temporary buffer. Current
+         * format files that failed their checks are corrupted, not legacy.
+         */
+        if (E_Return::NO_ERROR == error &&
+            SETTINGS_FILE_COUNT == selected &&
+            !isCurrentFormat &&
+            0 < sizes[0] &&
+            SETTINGS_FILE_MAX_SIZE >= sizes[0]) {
+            pLegacyImage = new uint8_t[sizes[0]];
+            if (nullptr != pLegacyImage) {
+                error = ReadImage(
+                    skpSettingsFiles[0],
+                    pLegacyImage,
+                    sizes[0],
+                    nullptr
+                );
+            }
+            else {
+                LOG_ERROR("Failed to allocate the settings image.\n");
+                error = E_Return::ERR_MEMORY;
+            }
+        }
+
+        this->_pStorage->ReleaseSPIBus();
+    }
+    else {
+        LOG_ERROR("Failed to acquire the storage bus.\n");
+    }
+
+    if (E_Return::NO_ERROR != error) {
+        LOG_ERROR("Failed to read the settings files.\n");
+    }
+    else if (SETTINGS_FILE_COUNT != selected) {
+        /* The cache points to the values in the image */
+        error = IndexImage(pImage, baseSize, sizes[selected]);
+
+        this->_isStorageLoaded = true;
+        this->_activeFile      = selected;
+        this->_generation      = generation;
+    }
+    else if (nullptr != pLegacyImage) {
+        /* Migrate from the name / size / value stream */
+        error = LoadLegacyImage(pLegacyImage, sizes[0]);
+        if (E_Return::NO_ERROR == error) {
+            LOG_INFO("Migrating the settings file.\n");
+            error = WriteToStorage();
+        }
+    }
+    else if (0 < sizes[0] || 0 < sizes[1]) {
+        LOG_ERROR("Invalid settings files.\n");
+        error = E_Return::ERR_SETTING_INVALID;
+    }
+
+    delete[] pLegacyImage;
+
+    return error;
+}
+
+E_Return Settings::LoadValue(const E_SettingId kId) noexcept {
+    T_SettingsCache::const_iterator it;
+    E_Return                        error;
+    bool                            isStored;
+
+    /* Get the setting, load from storage if not exists */
+    isStored = false;
+    it = this->_cache.find(SettingName(kId));
+    if (this->_cache.end() == it) {
+        isStored = (E_Return::NO_ERROR == LoadFromStorage());
+        if (isStored) {
+            it = this->_cache.find(SettingName(kId));
+        }
+    }
+
+    if (this->_cache.end() != it && SettingSize(kId) == it->second.fieldSize) {
+        UpdateValue(kId, it->second.pValue, it->second.fieldSize);
+
+        error = E_Return::NO_ERROR;
+    }
+    else if (this->_cache.end() == it && isStored) {
+        /* Never set, the value is the flash default until it is set */
+        UpdateValue(kId, GetDefaultValue(kId), SettingSize(kId));
+
+        error = E_Return::NO_ERROR;
+    }
+    else {
+        LOG_ERROR("Failed to get setting: %s.\n", SettingName(kId));
+
+        error = E_Return::ERR_SETTING_NOT_FOUND;
+    }
+
+    return error;
+}
+
+E_Return Settings::ReadImage(const char* kpPath,
+                             uint8_t*    pBuffer,
+                             const size_t kSize,
+                             size_t*     pFileSize) noexcept {
+    E_Return error;
+    T_HALFile   file;
+
+    if (nullptr != pFileSize) {
+        *pFileSize = 0;
+    }
+
+    file = this->_pStorage->Open(kpPath, O_RDONLY);
     if (file.isOpen()) {
+        if (nullptr != pFileSize) {
+            *pFileSize = file.size();
+        }
+
+        /* The requested part is read at once */
+        if (kSize <= file.size() &&
+            (int32_t)kSize != file.read(pBuffer, kSize)) {
+            LOG_ERROR("Failed to read the settings file %s.\n", kpPath);
+            error = E_Return::ERR_SETTING_FILE_ERROR;
+        }
+        else {
+            error = E_Return::NO_ERROR;
+        }
+
+        file.close();
+    }
+    else {
+        /* Nothing stored yet in this file */
         error = E_Return::NO_ERROR;
+    }
 
-        while (file.available()) {
-            name = "";
-            /* Read name */
-            name = GetSettingName(file);
-            if (0 == name.size()) {
-                LOG_ERROR("Failed to read setting name from storage.\n");
-                error = E_Return::ERR_SETTING_INVALID;
-                break;
-            }
-            LOG_DEBUG("Loading %s from storage.\n", name.c_str());
+    return error;
+}
 
-            /* Read size */
-            readSize = file.read(&fieldSize, sizeof(size_t));
-            if (sizeof(size_t) != readSize) {
-                LOG_ERROR("Failed to read setting size from storage.\n");
-                error = E_Return::ERR_SETTING_INVALID;
-                break;
-            }
-            setting.fieldSize = fieldSize;
-            LOG_DEBUG("\t Size %u\n", fieldSize);
-
-            /* Read value */
-            setting.pValue = new uint8_t[fieldSize];
-            if (nullptr != setting.pValue) {
-                readSize = file.read(setting.pValue, fieldSize);
-                if (fieldSize != readSize) {
-                    LOG_ERROR("Failed to load setting %s.\n",name.c_str());
-                    delete[] setting.pValue;
-                    error = E_Return::ERR_SETTING_INVALID;
-                    break;
+E_Return Settings::WriteToStorage(void) noexcept {
+    T_SettingsCache::const_iterator it;
+    E_Return                        error;
+    T_HALFile                          file;
+    S_SettingsFileHeader            header;
+    S_SettingsFileEntry             entry;
+    uint8_t*                        pImage;
+    uint8_t*                        pCursor;
+    size_t                          size;
+    uint8_t                         target;
+    bool                            isValid;
+
+    /* Get the image size, the file fields must hold the sizes and count */
+    size    = sizeof(S_SettingsFileHeader);
+    isValid = UINT16_MAX >= this->_cache.size();
+    for (it = this->_cache.begin(); this->_cache.end() != it; ++it) {
+        size += sizeof(S_SettingsFileEntry) + it->first.size() +
+                it->second.fieldSize;
+        isValid = isValid && FitsFileEntry(it->first, it->second.fieldSize);
+    }
+
+    /* A file larger than the loadable size would be rejected on boot */
+    pImage = nullptr;
+    error  = E_Return::NO_ERROR;
+    if (!isValid || SETTINGS_FILE_MAX_SIZE < size) {
+        LOG_ERROR("The settings do not fit in a settings file.\n");
+        error = E_Return::ERR_SETTING_INVALID;
+    }
+    else {
+        /* The image is built in the arena scratch space */
+        pImage = ArenaAllocate(size);
+        if (nullptr == pImage) {
+            LOG_ERROR("Failed to allocate the settings image.\n");
+            error = E_Return::ERR_MEMORY;
+        }
+    }
+
+    if (nullptr != pImage) {
+        /* Build the image */
+        pCursor = pImage + sizeof(S_SettingsFileHeader);
+        for (it = this->_cache.begin(); this->_cache.end() != it; ++it) {
+            entry.nameSize  = it->first.size();
+            entry.valueSize = it->second.fieldSize;
+            memcpy(pCursor, &entry, sizeof(S_SettingsFileEntry));
+            pCursor += sizeof(S_SettingsFileEntry);
+            memcpy(pCursor, it->first.c_str(), entry.nameSize);
+            pCursor += entry.nameSize;
+            memcpy(pCursor, it->second.pValue, entry.valueSize);
+            pCursor += entry.valueSize;
+        }
+
+        header.magic       = SETTINGS_FILE_MAGIC;
+        header.version     = SETTINGS_FILE_VERSION;
+        header.count       = this->_cache.size();
+        header.payloadSize = size - sizeof(S_SettingsFileHeader);
+        header.generation  = this->_generation + 1;
+        header.checksum    = HAL::Crc32(
+            0,
+            pImage + sizeof(S_SettingsFileHeader),
+            header.payloadSize
+        );
+        memcpy(pImage, &header, sizeof(S_SettingsFileHeader));
+
+        /*
+         * The compacted image is written in the inactive file, the active
+         * file stays valid until the new one is complete.
+         */
+        target = (this->_activeFile + 1) % SETTINGS_FILE_COUNT;
+
+        error = this->_pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS);
+        if (E_Return::NO_ERROR == error) {
+            this->_pStorage->Remove(skpSettingsFiles[target]);
+
+            /* Create the file and write the image at once */
+            file = this->_pStorage->Open(
+                skpSettingsFiles[target],
+                O_RDWR | O_CREAT
+            );
+            if (file.isOpen()) {
+                if (file.write(pImage, size) != size || !file.sync()) {
+                    LOG_ERROR("Failed to write the settings file.\n");
+                    error = E_Return::ERR_SETTING_COMMIT_FAILURE;
+                }
+                else {
+                    Metrics::Add(METRIC_SD_SETTINGS_BYTES, size);
+                }
+
+                if (!file.close()) {
+                    PANIC("Failed to close settings file.\n");
                 }
             }
             else {
-                LOG_ERROR("Failed to allocate setting %s.\n", name.c_str());
-                error = E_Return::ERR_MEMORY;
-                break;
+                LOG_ERROR(
+                    "Failed to open setting file. Error %d\n",
+                    file.getError()
+                );
+                error = E_Return::ERR_SETTING_FILE_ERROR;
             }
 
-            /* Add to cache */
-             try {
-                /* Get the setting and remove it exists */
-                it = this->_cache.find(name);
-                if (this->_cache.end() != it) {
-                    /* Release memory and clear entry */
-                    delete[] it->second.pValue;
-                    this->_cache.erase(it);
+            this->_pStorage->ReleaseSPIBus();
+        }
+        else {
+            LOG_ERROR("Failed to acquire the storage bus.\n");
+        }
+
+        if (E_Return::NO_ERROR == error) {
+            /* Swap the active file */
+            this->_isStorageLoaded = true;
+            this->_activeFile      = target;
+            this->_generation      = header.generation;
+            this->_activeSize      = size;
+            this->_journalSize     = 0;
+        }
+
+        ArenaRelease(pImage, size);
+    }
+
+    return error;
+}
+
+E_Return Settings::AppendJournal(const size_t kSize) noexcept {
+    T_SettingsNames::const_iterator it;
+    E_Return                        error;
+    T_HALFile                          file;
+    S_SettingsFileEntry             entry;
+    S_SettingsJournalTrailer        trailer;
+    const S_SettingField*           pkSetting;
+    uint8_t*                        pRecords;
+    uint8_t*                        pRecord;
+    uint8_t*                        pCursor;
+
+    /* The records are built in the arena scratch space */
+    pRecords = ArenaAllocate(kSize);
+    if (nullptr != pRecords) {
+        /* Build the records of the modified settings */
+        pCursor = pRecords;
+        for (it = this->_dirty.begin(); this->_dirty.end() != it; ++it) {
+            pkSetting = &this->_cache[*it];
+            pRecord   = pCursor;
+
+            entry.nameSize  = it->size();
+            entry.valueSize = pkSetting->fieldSize;
+            memcpy(pCursor, &entry, sizeof(S_SettingsFileEntry));
+            pCursor += sizeof(S_SettingsFileEntry);
+            memcpy(pCursor, it->c_str(), entry.nameSize);
+            pCursor += entry.nameSize;
+            memcpy(pCursor, pkSetting->pValue, entry.valueSize);
+            pCursor += entry.valueSize;
+
+            trailer.checksum = HAL::Crc32(0, pRecord, pCursor - pRecord);
+            memcpy(pCursor, &trailer, sizeof(S_SettingsJournalTrailer));
+            pCursor += sizeof(S_SettingsJournalTrailer);
+        }
+
+        error = this->_pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS);
+        if (E_Return::NO_ERROR == error) {
+            file = this->_pStorage->Open(
+                skpSettingsFiles[this->_activeFile],
+                O_RDWR
+            );
+            if (file.isOpen()) {
+                /* Drop a torn record left by a previous power loss */
+                if (file.size() != this->_activeSize) {
+                    file.truncate(this->_activeSize);
                 }
 
-                this->_cache.emplace(std::make_pair(name, setting));
+                if (!file.seekSet(this->_activeSize) ||
+                    file.write(pRecords, kSize) != kSize ||
+                    !file.sync()) {
+                    LOG_ERROR("Failed to append the settings journal.\n");
+                    error = E_Return::ERR_SETTING_COMMIT_FAILURE;
+                }
+                else {
+                    Metrics::Add(METRIC_SD_SETTINGS_BYTES, kSize);
+                }
 
-                error = E_Return::NO_ERROR;
+                if (!file.close()) {
+                    PANIC("Failed to close settings file.\n");
+                }
             }
-            catch (std::exception& rExc) {
+            else {
+                LOG_ERROR(
+                    "Failed to open setting file. Error %d\n",
+                    file.getError()
+                );
+                error = E_Return::ERR_SETTING_FILE_ERROR;
+            }
+
+            this->_pStorage->ReleaseSPIBus();
+        }
+        else {
+            LOG_ERROR("Failed to acquire the storage bus.\n");
+        }
+
+        if (E_Return::NO_ERROR == error) {
+            this->_activeSize  += kSize;
+            this->_journalSize += kSize;
+        }
+
+        ArenaRelease(pRecords, kSize);
+    }
+    else {
+        LOG_ERROR("Failed to allocate the settings journal records.\n");
+        error = E_Return::ERR_MEMORY;
+    }
+
+    return error;
+}
+
+size_t Settings::GetImageBaseSize(const uint8_t* kpImage,
+                                  const size_t   kSize,
+                                  uint32_t*      pGeneration) const noexcept {
+    S_SettingsFileHeader header;
+    S_SettingsFileEntry  entry;
+    size_t               offset;
+    uint16_t             i;
+    bool                 isValid;
+
+    isValid = false;
+    offset  = 0;
+    if (sizeof(S_SettingsFileHeader) <= kSize) {
+        memcpy(&header, kpImage, sizeof(S_SettingsFileHeader));
+
+        isValid = SETTINGS_FILE_MAGIC == header.magic &&
+                  SETTINGS_FILE_VERSION == header.version &&
+                  kSize - sizeof(S_SettingsFileHeader) >= header.payloadSize &&
+                  header.checksum == HAL::Crc32(
+                      0,
+                      kpImage + sizeof(S_SettingsFileHeader),
+                      header.payloadSize
+                  );
+
+        /* Check the entries bounds */
+        offset = sizeof(S_SettingsFileHeader);
+        for (i = 0; isValid && header.count > i; ++i) {
+            if (offset + sizeof(S_SettingsFileEntry) <= kSize) {
+                memcpy(&entry, kpImage + offset, sizeof(S_SettingsFileEntry));
+                offset += sizeof(S_SettingsFileEntry) + entry.nameSize +
+                          entry.valueSize;
+                isValid = (0 < entry.nameSize && offset <= kSize);
+            }
+            else {
+                isValid = false;
+            }
+        }
+        isValid = isValid &&
+                  sizeof(S_SettingsFileHeader) + header.payloadSize == offset;
+        *pGeneration = header.generation;
+    }
+
+    if (!isValid) {
+        offset = 0;
+    }
+
+    return offset;
+}
+
+E_Return Settings::IndexImage(uint8_t*     pImage,
+                              const size_t kBaseSize,
+                              const size_t kSize) noexcept {
+    E_Return                 error;
+    S_SettingsFileEntry      entry;
+    S_SettingsJournalTrailer trailer;
+    S_SettingField           setting;
+    std::string              name;
+    uint8_t*                 pCursor;
+    uint8_t*                 pRecord;
+    bool                     isJournal;
+    bool                     isValid;
+
+    error     = E_Return::NO_ERROR;
+    isJournal = false;
+    isValid   = true;
+
+    /* Values are used in place in the image, the journal overrides them */
+    pCursor = pImage + sizeof(S_SettingsFileHeader);
+    while (isValid && pImage + kSize > pCursor) {
+        isJournal = (pImage + kBaseSize <= pCursor);
+        pRecord   = pCursor;
+
+        if (isJournal &&
+            sizeof(S_SettingsFileEntry) > (size_t)(pImage + kSize - pCursor)) {
+            isValid = false;
+        }
+        else {
+            memcpy(&entry, pCursor, sizeof(S_SettingsFileEntry));
+            pCursor += sizeof(S_SettingsFileEntry);
+
+            if (isJournal) {
+                /* Journal records are checked, a torn tail is ignored */
+                isValid = (0 < entry.nameSize &&
+                           entry.nameSize + entry.valueSize +
+                           sizeof(S_SettingsJournalTrailer) <=
+                           (size_t)(pImage + kSize - pCursor));
+                if (isValid) {
+                    memcpy(
+                        &trailer,
+                        pCursor + entry.nameSize + entry.valueSize,
+                        sizeof(S_SettingsJournalTrailer)
+                    );
+                    isValid = trailer.checksum == HAL::Crc32(
+                        0,
+                        pRecord,
+                        sizeof(S_SettingsFileEntry) + entry.nameSize +
+                        entry.valueSize
+                    );
+                }
+            }
+        }
 
-                LOG_ERROR("Failed to load setting %s.\n",name.c_str());
-                delete[] setting.pValue;
+        if (isValid) {
+            name.assign((const char*)pCursor, entry.nameSize);
+            pCursor += entry.nameSize;
+            setting.pValue    = pCursor;
+            setting.fieldSize = entry.valueSize;
+            pCursor += entry.valueSize;
+            if (isJournal) {
+                pCursor += sizeof(S_SettingsJournalTrailer);
+            }
 
+            LOG_DEBUG("Loading %s from storage.\n", name.c_str());
+            if (E_Return::NO_ERROR != CacheLoadedValue(name, setting)) {
                 error = E_Return::ERR_MEMORY;
-                break;
             }
         }
+        else {
+            LOG_ERROR("Ignored torn settings journal record.\n");
+            pCursor = pRecord;
+        }
     }
-    else {
-        error = E_Return::ERR_SETTING_FILE_ERROR;
+
+    this->_activeSize  = pCursor - pImage;
+    this->_journalSize = this->_activeSize - kBaseSize;
+
+    return error;
+}
+
+E_Return Settings::LoadLegacyImage(const uint8_t* kpImage, const size_t kSize)
+noexcept {
+    E_Return       error;
+    S_SettingField setting;
+    size_t         offset;
+    size_t         nameSize;
+    std::string    name;
+
+    error  = E_Return::NO_ERROR;
+    offset = 0;
+    while (E_Return::NO_ERROR == error && kSize > offset) {
+        /* Read name, size and check the value bounds */
+        nameSize = strnlen((const char*)kpImage + offset, kSize - offset);
+        if (0 < nameSize &&
+            kSize - offset >= nameSize + 1 + sizeof(size_t)) {
+            name.assign((const char*)kpImage + offset, nameSize);
+            offset += nameSize + 1;
+            memcpy(&setting.fieldSize, kpImage + offset, sizeof(size_t));
+            offset += sizeof(size_t);
+
+            LOG_DEBUG("Loading %s from legacy storage.\n", name.c_str());
+
+            if (setting.fieldSize <= kSize - offset) {
+                setting.pValue = ArenaAllocate(setting.fieldSize);
+                if (nullptr != setting.pValue) {
+                    memcpy(setting.pValue, kpImage + offset, setting.fieldSize);
+                    offset += setting.fieldSize;
+
+                    error = CacheLoadedValue(name, setting);
+                }
+                else {
+                    LOG_ERROR("Failed to allocate setting %s.\n", name.c_str());
+                    error = E_Return::ERR_MEMORY;
+                }
+            }
+            else {
+                LOG_ERROR("Failed to load setting %s.\n", name.c_str());
+                error = E_Return::ERR_SETTING_INVALID;
+            }
+        }
+        else {
+            LOG_ERROR("Failed to read setting from storage.\n");
+            error = E_Return::ERR_SETTING_INVALID;
+        }
+    }
+
+    return error;
+}
+
+E_Return Settings::CacheLoadedValue(const std::string&    krName,
+                                    const S_SettingField& krSetting) noexcept {
+    T_SettingsCache::iterator it;
+    E_Return                  error;
+    E_SettingId               id;
+
+    error = E_Return::NO_ERROR;
+
+    /* Modified settings that are not committed yet are kept */
+    if (this->_dirty.end() == this->_dirty.find(krName)) {
+        try {
+            /* The previous value is reclaimed by compaction */
+            it = this->_cache.find(krName);
+            if (this->_cache.end() != it) {
+                it->second = krSetting;
+            }
+            else {
+                this->_cache.emplace(std::make_pair(krName, krSetting));
+            }
+
+            id = GetSettingId(krName);
+            if (SETTING_ID_MAX != id) {
+                UpdateValue(id, krSetting.pValue, krSetting.fieldSize);
+            }
+        }
+        catch (std::exception& rExc) {
+            LOG_ERROR("Failed to load setting %s.\n", krName.c_str());
+
+            error = E_Return::ERR_MEMORY;
+        }
     }
 
     return error;
 }
 
-std::string Settings::GetSettingName(FsFile& rFile) const noexcept {
-    std::string retStr;
-    int32_t     byte;
-    bool        readTerminator;
+bool Settings::ReadValueSnapshot(const E_SettingId kId,
+                                 uint8_t*          pData,
+                                 const size_t      kDataLength) const noexcept {
+    uint32_t sequence;
+    uint8_t  retries;
+    bool     isLoaded;
+    bool     isConsistent;
+
+    /*
+     * Sequence lock read: an odd sequence means an update is in progress, a
+     * changed sequence means the copy may be torn. Updates are only memory
+     * copies, the retries are bounded to let a preempted writer complete
+     * through the locked read.
+     */
+    retries = 0;
+    do {
+        sequence = this->_valuesSequence.load(std::memory_order_acquire);
+        isLoaded = false;
+        if (0 == (sequence & 1)) {
+            isLoaded = this->_isValueLoaded[kId];
+            if (isLoaded) {
+                memcpy(pData, this->_values + SettingOffset(kId), kDataLength);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        isConsistent = (
+            0 == (sequence & 1) &&
+            sequence == this->_valuesSequence.load(std::memory_order_relaxed)
+        );
+        ++retries;
+    } while (!isConsistent && SETTINGS_SNAPSHOT_RETRIES > retries);
+
+    return isConsistent && isLoaded;
+}
+
+void Settings::UpdateValue(const E_SettingId kId,
+                           const uint8_t*    kpData,
+                           const size_t      kDataLength) noexcept {
+    BeginValuesUpdate();
+
+    this->_isValueLoaded[kId] = (SettingSize(kId) == kDataLength);
+    if (this->_isValueLoaded[kId]) {
+        memcpy(this->_values + SettingOffset(kId), kpData, kDataLength);
+    }
+
+    EndValuesUpdate();
+}
 
-    readTerminator = false;
-    while(-1 != (byte = rFile.read())) {
-        /* Check if null terminator */
-        if (0 == byte) {
-            readTerminator = true;
-            break;
+void Settings::NotifySubscribers(const uint32_t              kChangedIds,
+                                 const S_SettingsSubscriber* kpSubscribers)
+noexcept {
+    S_Event event;
+    uint8_t i;
+    uint8_t id;
+
+    event.id = E_EventId::EVENT_SETTING_CHANGE;
+    for (id = 0; SETTING_ID_MAX > id && 0 != kChangedIds; ++id) {
+        if (0 != (kChangedIds & (1UL << id))) {
+            LOG_DEBUG("Notifying setting %s change.\n", SettingName((E_SettingId)id));
+
+            event.data.setting.id = (E_SettingId)id;
+            EventBus::Publish(event);
+
+            for (i = 0; SETTINGS_MAX_SUBSCRIBERS > i; ++i) {
+                if (0 != (kpSubscribers[i].ids & (1UL << id))) {
+                    kpSubscribers[i].callback(
+                        (E_SettingId)id,
+                        kpSubscribers[i].pArgs
+                    );
+                }
+            }
         }
+    }
+}
+
+void Settings::BeginValuesUpdate(void) noexcept {
+    this->_valuesSequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
 
-        /* Add to string */
-        retStr += (char)byte;
+void Settings::EndValuesUpdate(void) noexcept {
+    this->_valuesSequence.fetch_add(1, std::memory_order_release);
+}
+
+uint8_t* Settings::ArenaAllocate(const size_t kSize) noexcept {
+    uint8_t* pBuffer;
+
+    /* Reclaim the released values when the arena is full */
+    if (SETTINGS_ARENA_SIZE - this->_arenaUsed < kSize) {
+        CompactArena();
+    }
+
+    if (SETTINGS_ARENA_SIZE - this->_arenaUsed >= kSize) {
+        pBuffer = this->_pArena + this->_arenaUsed;
+        this->_arenaUsed += kSize;
+        if (this->_arenaPeak < this->_arenaUsed) {
+            this->_arenaPeak = this->_arenaUsed;
+        }
     }
+    else {
+        LOG_ERROR("Settings arena exhausted (%d bytes).\n", kSize);
+        pBuffer = nullptr;
+    }
+
+    return pBuffer;
+}
 
-    /* If no terminator is read error */
-    if (!readTerminator) {
-        retStr.clear();
+void Settings::ArenaRelease(const uint8_t* kpBuffer, const size_t kSize)
+noexcept {
+    /* Only the last allocation can be released */
+    if (this->_pArena + this->_arenaUsed == kpBuffer + kSize) {
+        this->_arenaUsed -= kSize;
     }
+}
 
-    return retStr;
-}
\ No newline at end of file
+void Settings::CompactArena(void) noexcept {
+    T_SettingsCache::iterator it;
+    S_SettingField*           pLowest;
+    uint8_t*                  pScan;
+    uint8_t*                  pDest;
+
+    /*
+     * Values are moved down in address order. The cache is small, the lowest
+     * value above the scan address is searched at each step to avoid any
+     * allocation.
+     */
+    pScan = this->_pArena;
+    pDest = this->_pArena;
+    do {
+        pLowest = nullptr;
+        for (it = this->_cache.begin(); this->_cache.end() != it; ++it) {
+            if (0 < it->second.fieldSize &&
+                pScan <= it->second.pValue &&
+                (nullptr == pLowest || pLowest->pValue > it->second.pValue)) {
+                pLowest = &it->second;
+            }
+        }
+
+        if (nullptr != pLowest) {
+            pScan = pLowest->pValue + pLowest->fieldSize;
+            memmove(pDest, pLowest->pValue, pLowest->fieldSize);
+            pLowest->pValue = pDest;
+            pDest += pLowest->fieldSize;
+        }
+    } while (nullptr != pLowest);
+
+    LOG_DEBUG(
+        "Compacted settings arena from %d to %d bytes.\n",
+        this->_arenaUsed,
+        pDest - this->_pArena
+    );
+
+    this->_arenaUsed = pDest - this->_pArena;
+    ++this->_arenaCompactions;
+}
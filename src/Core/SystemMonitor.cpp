@@ -0,0 +1,345 @@
+/*******************************************************************************
+ * @file SystemMonitor.cpp
+ *
+ * @see SystemMonitor.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Runtime system monitor.
+ *
+ * @details Runtime system monitor. The CPU usage and the stack watermark of
+ * the tasks, the memory and the sockets usage are sampled periodically and
+ * kept for a short time window.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstring>         /* memset, strncpy */
+#include <cstdint>         /* Standard integer definitions */
+#include <algorithm>       /* std::min */
+#include <BSP.h>           /* Hardware services */
+#include <Errors.h>        /* Errors definitions */
+#include <Logger.h>        /* Logger services */
+#include <Arduino.h>       /* Arduino framework */
+#include <SystemState.h>   /* System state */
+#include <TaskRegistry.h>  /* Firmware tasks registry */
+#include <lwip/sockets.h>  /* lwIP sockets */
+#include <esp_heap_caps.h> /* Capability based allocation */
+
+/* Header file */
+#include <SystemMonitor.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the samples lock timeout in ticks. */
+#define SYSMON_LOCK_TIMEOUT_TICKS pdMS_TO_TICKS(100)
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+SystemMonitor::SystemMonitor(void) noexcept {
+    this->_head = 0;
+    this->_count = 0;
+    this->_counterCount = 0;
+    this->_totalRunTime = 0;
+    this->_taskHandle = nullptr;
+    memset(&this->_current, 0, sizeof(S_SysMonSample));
+
+    /* The window is allocated once, external memory is preferred */
+    this->_pSamples = (S_SysMonSample*)heap_caps_malloc(
+        SYSMON_WINDOW_SAMPLES * sizeof(S_SysMonSample),
+        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+    );
+    if (nullptr == this->_pSamples) {
+        this->_pSamples = (S_SysMonSample*)heap_caps_malloc(
+            SYSMON_WINDOW_SAMPLES * sizeof(S_SysMonSample),
+            MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+        );
+    }
+    if (nullptr == this->_pSamples) {
+        PANIC("Failed to allocate the system monitor window.\n");
+    }
+
+    this->_lock = xSemaphoreCreateMutex();
+    if (nullptr == this->_lock) {
+        PANIC("Failed to create the system monitor lock.\n");
+    }
+
+    SystemState::GetInstance()->SetSystemMonitor(this);
+}
+
+SystemMonitor::~SystemMonitor(void) noexcept {
+    PANIC("Tried to destroy the system monitor.\n");
+}
+
+E_Return SystemMonitor::Start(void) noexcept {
+    bool       isCreated;
+    E_Return   result;
+
+    isCreated = TaskRegistry::CreateTask(
+        E_TaskId::TASK_ID_SYSMON,
+        TaskRoutine,
+        this,
+        this->_taskHandle
+    );
+    if (isCreated) {
+#if !SYSMON_HAS_RUN_TIME
+        LOG_INFO("Run time statistics disabled, CPU usage not sampled.\n");
+#endif
+        result = E_Return::NO_ERROR;
+    }
+    else {
+        LOG_ERROR("Failed to create the system monitor task.\n");
+        result = E_Return::ERR_MEMORY;
+    }
+
+    return result;
+}
+
+uint32_t SystemMonitor::GetSampleCount(void) const noexcept {
+    return this->_count;
+}
+
+bool SystemMonitor::GetSample(const uint32_t  kIndex,
+                              S_SysMonSample& rSample) const noexcept {
+    bool isCopied;
+
+    isCopied = false;
+    if (pdPASS == xSemaphoreTake(this->_lock, SYSMON_LOCK_TIMEOUT_TICKS)) {
+        if (this->_count > kIndex) {
+            rSample = this->_pSamples[
+                (this->_head + kIndex) % SYSMON_WINDOW_SAMPLES
+            ];
+            isCopied = true;
+        }
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the system monitor lock.\n");
+        }
+    }
+
+    return isCopied;
+}
+
+bool SystemMonitor::GetLatest(S_SysMonSample& rSample) const noexcept {
+    uint32_t count;
+
+    /* A sample is only ever added, the newest index stays valid */
+    count = this->_count;
+    return 0 != count && GetSample(count - 1, rSample);
+}
+
+void SystemMonitor::TaskRoutine(void* pParam) noexcept {
+    SystemMonitor* pMonitor;
+    TickType_t     lastWake;
+    BaseType_t     delayRes;
+
+    pMonitor = (SystemMonitor*)pParam;
+    lastWake = xTaskGetTickCount();
+
+    while (true) {
+        pMonitor->Sample();
+
+        delayRes = xTaskDelayUntil(
+            &lastWake,
+            pdMS_TO_TICKS(SYSMON_PERIOD_NS / 1000000ULL)
+        );
+        if (pdPASS != delayRes) {
+            lastWake = xTaskGetTickCount();
+        }
+    }
+}
+
+void SystemMonitor::Sample(void) noexcept {
+    S_SysMonSample* pSample;
+
+    /* The sample is built outside of the lock, the readers never wait */
+    pSample = &this->_current;
+    pSample->timeMs = (uint32_t)(HWManager::GetTime() / 1000000ULL);
+    pSample->internalFree = heap_caps_get_free_size(
+        MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+    );
+    pSample->internalLargest = heap_caps_get_largest_free_block(
+        MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+    );
+    pSample->psramFree = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    pSample->psramLargest = heap_caps_get_largest_free_block(
+        MALLOC_CAP_SPIRAM
+    );
+    pSample->socketsUsed = CountSockets();
+    pSample->socketsMax = CONFIG_LWIP_MAX_SOCKETS;
+    SampleTasks(*pSample);
+    TaskRegistry::SaveStackProfile();
+
+    if (pdPASS == xSemaphoreTake(this->_lock, SYSMON_LOCK_TIMEOUT_TICKS)) {
+        if (SYSMON_WINDOW_SAMPLES == this->_count) {
+            this->_head = (this->_head + 1) % SYSMON_WINDOW_SAMPLES;
+            --this->_count;
+        }
+        this->_pSamples[
+            (this->_head + this->_count) % SYSMON_WINDOW_SAMPLES
+        ] = *pSample;
+        ++this->_count;
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the system monitor lock.\n");
+        }
+    }
+}
+
+void SystemMonitor::SampleTasks(S_SysMonSample& rSample) noexcept {
+    S_TaskCounter pCounters[SYSMON_MAX_STATES];
+    S_SysMonTask  task;
+    TaskHandle_t  pIdles[portNUM_PROCESSORS];
+    BaseType_t    affinity;
+    uint32_t      stateCount;
+    uint32_t      totalRunTime;
+    uint32_t      period;
+    uint32_t      runTime;
+    uint32_t      usage;
+    uint32_t      i;
+    uint32_t      j;
+    E_TaskId      id;
+    bool          isFound;
+
+    totalRunTime = 0;
+    stateCount = uxTaskGetSystemState(
+        this->_pStates,
+        SYSMON_MAX_STATES,
+        &totalRunTime
+    );
+    period = totalRunTime - this->_totalRunTime;
+
+    for (i = 0; portNUM_PROCESSORS > i; ++i) {
+        pIdles[i] = xTaskGetIdleTaskHandleForCPU(i);
+        rSample.pCoreLoad[i] = 0;
+    }
+
+    rSample.taskCount = 0;
+    for (i = 0; stateCount > i; ++i) {
+        /* The usage is the run time since the previous sample */
+        runTime = this->_pStates[i].ulRunTimeCounter;
+        isFound = false;
+        for (j = 0; this->_counterCount > j && !isFound; ++j) {
+            if (this->_pCounters[j].number ==
+                this->_pStates[i].xTaskNumber) {
+                runTime -= this->_pCounters[j].runTime;
+                isFound = true;
+            }
+        }
+        usage = (0 != period && SYSMON_HAS_RUN_TIME) ?
+                (uint32_t)std::min(
+                    (uint64_t)runTime * 1000 / period,
+                    (uint64_t)1000
+                ) :
+                0;
+        pCounters[i].number = this->_pStates[i].xTaskNumber;
+        pCounters[i].runTime = this->_pStates[i].ulRunTimeCounter;
+
+        for (j = 0; portNUM_PROCESSORS > j; ++j) {
+            if (pIdles[j] == this->_pStates[i].xHandle &&
+                0 != period &&
+                SYSMON_HAS_RUN_TIME) {
+                rSample.pCoreLoad[j] = 1000 - usage;
+            }
+        }
+
+        memset(&task, 0, sizeof(S_SysMonTask));
+        strncpy(
+            task.pName,
+            this->_pStates[i].pcTaskName,
+            SYSMON_TASK_NAME_SIZE - 1
+        );
+        task.stackFree = this->_pStates[i].usStackHighWaterMark;
+        if (TaskRegistry::Find(this->_pStates[i].pcTaskName, id)) {
+            TaskRegistry::RecordStackFree(id, task.stackFree);
+        }
+        task.cpuPermille = usage;
+        affinity = xTaskGetAffinity(this->_pStates[i].xHandle);
+        task.core = (portNUM_PROCESSORS > affinity) ?
+                    (int8_t)affinity :
+                    SYSMON_CORE_ANY;
+
+        /* The tasks are kept by decreasing usage, the idlest are dropped */
+        j = rSample.taskCount;
+        if (SYSMON_MAX_TASKS > j) {
+            ++rSample.taskCount;
+        }
+        else if (rSample.pTasks[j - 1].cpuPermille < usage) {
+            --j;
+        }
+        if (SYSMON_MAX_TASKS > j) {
+            while (0 < j && rSample.pTasks[j - 1].cpuPermille < usage) {
+                rSample.pTasks[j] = rSample.pTasks[j - 1];
+                --j;
+            }
+            rSample.pTasks[j] = task;
+        }
+    }
+
+    /* The counters of the deleted tasks are forgotten */
+    memcpy(this->_pCounters, pCounters, stateCount * sizeof(S_TaskCounter));
+    this->_counterCount = stateCount;
+    this->_totalRunTime = totalRunTime;
+}
+
+uint16_t SystemMonitor::CountSockets(void) noexcept {
+    uint16_t count;
+    int      socket;
+
+    /* A closed descriptor is rejected by lwIP */
+    count = 0;
+    for (socket = LWIP_SOCKET_OFFSET;
+         LWIP_SOCKET_OFFSET + CONFIG_LWIP_MAX_SOCKETS > socket;
+         ++socket) {
+        if (0 <= lwip_fcntl(socket, F_GETFL, 0)) {
+            ++count;
+        }
+    }
+
+    return count;
+}
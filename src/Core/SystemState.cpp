@@ -22,16 +22,14 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
 /* Included headers */
-#include <BSP.h>             /* HW layer services */
-#include <string>            /* Standard strings */
-#include <Logger.h>          /* Logger services */
-#include <Storage.h>         /* Storage manager */
-#include <Settings.h>        /* Settings service */
-#include <WiFiModule.h>      /* WiFi module */
-#include <IOLedManager.h>    /* IO Led Manager */
-#include <HealthMonitor.h>   /* HM services */
-#include <IOButtonManager.h> /* IO Button Manager */
+#include <Logger.h>       /* Logger services */
+#include <Snapshot.h>     /* Lock-free published snapshot */
+#include <HMReporter.h>   /* HM reporter states */
+#include <SensorEngine.h> /* Sensor engine limits */
 
 /* Header file */
 #include <SystemState.h>
@@ -44,7 +42,14 @@
 /*******************************************************************************
  * STRUCTURES AND TYPES
  ******************************************************************************/
-/* None */
+static_assert(
+    E_HMStatus::HM_DISABLED + 1 == SYSTEM_HEALTH_STATES,
+    "The health summary counts every HM state."
+);
+static_assert(
+    SENSOR_MAX_SENSORS * SENSOR_MAX_CHANNELS <= SYSTEM_LIVE_MAX_READINGS,
+    "The latest readings hold every sensor channel."
+);
 
 /*******************************************************************************
  * MACROS
@@ -70,6 +75,12 @@
 /** @brief Stores the current singleton instance. */
 SystemState* SystemState::_SPINSTANCE = nullptr;
 
+/** @brief The readings before the first acquisition. */
+static const S_LiveReadings skNoReadings = {};
+
+/** @brief The health before the first check. */
+static const S_LiveHealth skNoHealth = {};
+
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
@@ -148,5 +159,52 @@ ModeManager* SystemState::GetModeManager(void) const noexcept {
     return this->_pModeManager;
 }
 
-SystemState::SystemState(void) noexcept {
+void SystemState::SetSensorEngine(SensorEngine* pSensorEngine) noexcept {
+    this->_pSensorEngine = pSensorEngine;
+}
+
+SensorEngine* SystemState::GetSensorEngine(void) const noexcept {
+    return this->_pSensorEngine;
+}
+
+void SystemState::SetTimeSeriesStore(TimeSeriesStore* pStore) noexcept {
+    this->_pTimeSeriesStore = pStore;
+}
+
+TimeSeriesStore* SystemState::GetTimeSeriesStore(void) const noexcept {
+    return this->_pTimeSeriesStore;
+}
+
+void SystemState::SetSystemMonitor(SystemMonitor* pMonitor) noexcept {
+    this->_pSystemMonitor = pMonitor;
+}
+
+SystemMonitor* SystemState::GetSystemMonitor(void) const noexcept {
+    return this->_pSystemMonitor;
+}
+
+void SystemState::PublishReadings(const S_LiveReadings& krReadings) noexcept {
+    this->_readings.Publish(krReadings);
+}
+
+void SystemState::PublishHealth(const S_LiveHealth& krHealth) noexcept {
+    this->_health.Publish(krHealth);
+}
+
+bool SystemState::GetLiveState(S_LiveState& rState) const noexcept {
+    bool isConsistent;
+
+    rState.readingsVersion = this->_readings.GetVersion();
+    isConsistent = this->_readings.Read(rState.readings);
+    rState.healthVersion = this->_health.GetVersion();
+    isConsistent = this->_health.Read(rState.health) && isConsistent;
+
+    return isConsistent;
+}
+
+SystemState::SystemState(void) noexcept :
+    _readings(skNoReadings), _health(skNoHealth) {
+    this->_pSensorEngine = nullptr;
+    this->_pTimeSeriesStore = nullptr;
+    this->_pSystemMonitor = nullptr;
 }
\ No newline at end of file
@@ -0,0 +1,469 @@
+/*******************************************************************************
+ * @file TaskRegistry.cpp
+ *
+ * @see TaskRegistry.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Firmware tasks registry.
+ *
+ * @details Firmware tasks registry. The core, priority and stack size of the
+ * firmware tasks are defined in a single table, each entry can be overridden
+ * in the settings.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstring>       /* strcmp, memset */
+#include <cstdint>       /* Standard integer definitions */
+#include <HAL.h>         /* Hardware abstraction layer */
+#include <Errors.h>      /* Errors definitions */
+#include <Logger.h>      /* Logger services */
+#include <Storage.h>     /* Storage manager */
+#include <Settings.h>    /* Settings services */
+#include <TaskStacks.h>  /* Generated stack table */
+#include <SystemState.h> /* System state */
+
+/* Header file */
+#include <TaskRegistry.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the stack profile file marker. */
+#define TASK_STACK_PROFILE_MAGIC 0x5453544B
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Entry of the tasks table. */
+typedef struct {
+    /** @brief The task name. */
+    const char* pkName;
+    /** @brief The default placement of the task. */
+    S_TaskConfig config;
+} S_TaskEntry;
+
+/** @brief Stack profile file content. */
+typedef struct {
+    /** @brief The file marker, TASK_STACK_PROFILE_MAGIC. */
+    uint32_t magic;
+    /** @brief The stack peaks in bytes, by task identifier. */
+    uint32_t pPeaks[E_TaskId::TASK_ID_COUNT];
+} S_TaskStackProfile;
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/**
+ * @brief The tasks table, by task identifier. The real-time tasks share the
+ * core of the IO and the WiFi stack, the servers run on the other one. The
+ * stack sizes are generated from the measured peaks.
+ */
+static constexpr S_TaskEntry skTasks[E_TaskId::TASK_ID_COUNT] = {
+    {"LOGGER_TASK", {TASK_STACK_LOGGER, HAL_IDLE_PRIORITY + 1, 0}},
+    {"HW-RT_TASK", {TASK_STACK_HM_RT, HAL_MAX_PRIORITY, 0}},
+    {"HM_ACTIONS_TASK", {TASK_STACK_HM_ACTIONS, HAL_MAX_PRIORITY - 1, 0}},
+    {"HM_CHECKS_TASK", {TASK_STACK_HM_CHECKS, HAL_MAX_PRIORITY - 1, 0}},
+    {"HW-IO_TASK", {TASK_STACK_IO, HAL_MAX_PRIORITY, 0}},
+    {"SENSORS_TASK", {TASK_STACK_SENSORS, HAL_MAX_PRIORITY - 2, 0}},
+    {"HTTP-SRV_TASK", {TASK_STACK_SERVERS, HAL_MAX_PRIORITY - 1, 1}},
+    {"TLM_TASK", {TASK_STACK_TELEMETRY, HAL_IDLE_PRIORITY + 1, 0}},
+    {"TSDB_TASK", {TASK_STACK_TSDB, HAL_IDLE_PRIORITY + 1, 0}},
+    {"SYSMON_TASK", {TASK_STACK_SYSMON, HAL_IDLE_PRIORITY + 1, 0}},
+    {"OTA_TASK", {TASK_STACK_OTA, HAL_IDLE_PRIORITY + 2, 1}}
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+S_TaskConfig TaskRegistry::_SPCONFIGS[E_TaskId::TASK_ID_COUNT] = {
+    skTasks[E_TaskId::TASK_ID_LOGGER].config,
+    skTasks[E_TaskId::TASK_ID_HM_RT].config,
+    skTasks[E_TaskId::TASK_ID_HM_ACTIONS].config,
+    skTasks[E_TaskId::TASK_ID_HM_CHECKS].config,
+    skTasks[E_TaskId::TASK_ID_IO].config,
+    skTasks[E_TaskId::TASK_ID_SENSORS].config,
+    skTasks[E_TaskId::TASK_ID_SERVERS].config,
+    skTasks[E_TaskId::TASK_ID_TELEMETRY].config,
+    skTasks[E_TaskId::TASK_ID_TSDB].config,
+    skTasks[E_TaskId::TASK_ID_SYSMON].config,
+    skTasks[E_TaskId::TASK_ID_OTA].config
+};
+uint32_t TaskRegistry::_SPSTACKPEAKS[E_TaskId::TASK_ID_COUNT] = {0};
+bool TaskRegistry::_SPROFILEDIRTY = false;
+bool TaskRegistry::_SPROFILELOADED = false;
+T_HALSpinLock TaskRegistry::_SLOCK = HAL_SPINLOCK_INITIALIZER;
+
+bool TaskRegistry::CreateTask(const E_TaskId   kId,
+                              T_HALTaskRoutine routine,
+                              void*            pParam,
+                              T_HALTask&       rTask) noexcept {
+    const S_TaskConfig* kpConfig;
+    bool                isCreated;
+
+    isCreated = false;
+    if (E_TaskId::TASK_ID_COUNT > kId) {
+        /* Not logged, the logger task is created by the logger itself */
+        kpConfig = &TaskRegistry::_SPCONFIGS[kId];
+        isCreated = HAL::CreateTask(
+            routine,
+            skTasks[kId].pkName,
+            kpConfig->stackSize,
+            pParam,
+            kpConfig->priority,
+            kpConfig->core,
+            rTask
+        );
+    }
+
+    return isCreated;
+}
+
+void TaskRegistry::LoadOverrides(void) noexcept {
+    S_TaskOverride pOverrides[TASK_MAX_OVERRIDES];
+    S_TaskConfig   config;
+    E_Return       error;
+    uint32_t       i;
+
+    error = ReadOverrides(pOverrides);
+    if (E_Return::NO_ERROR == error) {
+        for (i = 0; E_TaskId::TASK_ID_COUNT > i; ++i) {
+            if (0 != pOverrides[i].stackSize) {
+                config.stackSize = pOverrides[i].stackSize;
+                config.priority = pOverrides[i].priority;
+                config.core = pOverrides[i].core;
+
+                if (IsValid(config)) {
+                    LOG_INFO(
+                        "Task %s overridden: core %d, priority %d, "
+                        "stack %d.\n",
+                        skTasks[i].pkName,
+                        config.core,
+                        config.priority,
+                        config.stackSize
+                    );
+                    TaskRegistry::_SPCONFIGS[i] = config;
+                }
+                else {
+                    LOG_ERROR(
+                        "Ignored invalid override of task %s.\n",
+                        skTasks[i].pkName
+                    );
+                }
+            }
+        }
+    }
+    else {
+        LOG_ERROR("Failed to get the tasks overrides. Error %d\n", error);
+    }
+}
+
+const char* TaskRegistry::GetName(const E_TaskId kId) noexcept {
+    const char* kpName;
+
+    kpName = "UNKNOWN";
+    if (E_TaskId::TASK_ID_COUNT > kId) {
+        kpName = skTasks[kId].pkName;
+    }
+
+    return kpName;
+}
+
+bool TaskRegistry::Find(const char* kpName, E_TaskId& rId) noexcept {
+    uint32_t i;
+    bool     isFound;
+
+    isFound = false;
+    for (i = 0; E_TaskId::TASK_ID_COUNT > i && !isFound; ++i) {
+        if (0 == strcmp(kpName, skTasks[i].pkName)) {
+            rId = (E_TaskId)i;
+            isFound = true;
+        }
+    }
+
+    return isFound;
+}
+
+void TaskRegistry::GetConfig(const E_TaskId kId,
+                             S_TaskConfig&  rConfig) noexcept {
+    if (E_TaskId::TASK_ID_COUNT > kId) {
+        rConfig = TaskRegistry::_SPCONFIGS[kId];
+    }
+}
+
+bool TaskRegistry::GetOverride(const E_TaskId kId,
+                               S_TaskConfig&  rConfig) noexcept {
+    S_TaskOverride pOverrides[TASK_MAX_OVERRIDES];
+    bool           isSet;
+
+    isSet = false;
+    if (E_TaskId::TASK_ID_COUNT > kId) {
+        if (E_Return::NO_ERROR == ReadOverrides(pOverrides) &&
+            0 != pOverrides[kId].stackSize) {
+            rConfig.stackSize = pOverrides[kId].stackSize;
+            rConfig.priority = pOverrides[kId].priority;
+            rConfig.core = pOverrides[kId].core;
+            isSet = true;
+        }
+    }
+
+    return isSet;
+}
+
+E_Return TaskRegistry::SetOverride(const E_TaskId      kId,
+                                   const S_TaskConfig& krConfig) noexcept {
+    S_TaskOverride taskOverride;
+    E_Return       error;
+
+    if (E_TaskId::TASK_ID_COUNT > kId && IsValid(krConfig)) {
+        taskOverride.stackSize = (uint16_t)krConfig.stackSize;
+        taskOverride.priority = krConfig.priority;
+        taskOverride.core = krConfig.core;
+
+        error = StoreOverride(kId, taskOverride);
+    }
+    else {
+        LOG_ERROR("Invalid override of task %d.\n", kId);
+        error = E_Return::ERR_TASK_INVALID_CONFIG;
+    }
+
+    return error;
+}
+
+E_Return TaskRegistry::ClearOverride(const E_TaskId kId) noexcept {
+    S_TaskOverride taskOverride;
+    E_Return       error;
+
+    if (E_TaskId::TASK_ID_COUNT > kId) {
+        memset(&taskOverride, 0, sizeof(taskOverride));
+        error = StoreOverride(kId, taskOverride);
+    }
+    else {
+        LOG_ERROR("Invalid task %d.\n", kId);
+        error = E_Return::ERR_TASK_INVALID_CONFIG;
+    }
+
+    return error;
+}
+
+void TaskRegistry::RecordStackFree(const E_TaskId kId,
+                                   const uint32_t kStackFree) noexcept {
+    uint32_t used;
+
+    if (E_TaskId::TASK_ID_COUNT > kId) {
+        used = 0;
+        if (TaskRegistry::_SPCONFIGS[kId].stackSize > kStackFree) {
+            used = TaskRegistry::_SPCONFIGS[kId].stackSize - kStackFree;
+        }
+
+        HAL::EnterCritical(TaskRegistry::_SLOCK);
+        if (TaskRegistry::_SPSTACKPEAKS[kId] < used) {
+            TaskRegistry::_SPSTACKPEAKS[kId] = used;
+            TaskRegistry::_SPROFILEDIRTY = true;
+        }
+        HAL::ExitCritical(TaskRegistry::_SLOCK);
+    }
+}
+
+uint32_t TaskRegistry::GetStackPeak(const E_TaskId kId) noexcept {
+    uint32_t peak;
+
+    peak = 0;
+    if (E_TaskId::TASK_ID_COUNT > kId) {
+        HAL::EnterCritical(TaskRegistry::_SLOCK);
+        peak = TaskRegistry::_SPSTACKPEAKS[kId];
+        HAL::ExitCritical(TaskRegistry::_SLOCK);
+    }
+
+    return peak;
+}
+
+void TaskRegistry::SaveStackProfile(void) noexcept {
+#if TASK_STACK_PROFILE
+    S_TaskStackProfile profile;
+    Storage*           pStorage;
+    T_HALFile          file;
+    bool               isDirty;
+
+    if (!TaskRegistry::_SPROFILELOADED) {
+        LoadStackProfile();
+    }
+
+    HAL::EnterCritical(TaskRegistry::_SLOCK);
+    isDirty = TaskRegistry::_SPROFILEDIRTY && TaskRegistry::_SPROFILELOADED;
+    if (isDirty) {
+        TaskRegistry::_SPROFILEDIRTY = false;
+    }
+    memcpy(
+        profile.pPeaks,
+        TaskRegistry::_SPSTACKPEAKS,
+        sizeof(profile.pPeaks)
+    );
+    HAL::ExitCritical(TaskRegistry::_SLOCK);
+
+    /*
+     * The file is only written when a peak grew, the flash is spared. The
+     * previous peaks are never overwritten before they are merged.
+     */
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (isDirty &&
+        nullptr != pStorage &&
+        E_Return::NO_ERROR == pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        profile.magic = TASK_STACK_PROFILE_MAGIC;
+        file = pStorage->Open(
+            TASK_STACK_PROFILE_PATH,
+            O_WRONLY | O_CREAT | O_TRUNC
+        );
+        if (file.isOpen()) {
+            if (sizeof(profile) != file.write(&profile, sizeof(profile))) {
+                LOG_ERROR("Failed to write the stack profile.\n");
+            }
+            file.close();
+        }
+        pStorage->ReleaseSPIBus();
+    }
+#endif
+}
+
+bool TaskRegistry::IsValid(const S_TaskConfig& krConfig) noexcept {
+    return TASK_MIN_STACK <= krConfig.stackSize &&
+           TASK_MAX_STACK >= krConfig.stackSize &&
+           HAL_IDLE_PRIORITY < krConfig.priority &&
+           HAL_MAX_PRIORITY >= krConfig.priority &&
+           (HAL_CORE_ANY == krConfig.core ||
+            (0 <= krConfig.core && TASK_CORE_COUNT > krConfig.core));
+}
+
+E_Return TaskRegistry::StoreOverride(const E_TaskId        kId,
+                                     const S_TaskOverride& krOverride)
+noexcept {
+    S_TaskOverride pOverrides[TASK_MAX_OVERRIDES];
+    Settings*      pSettings;
+    E_Return       error;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    error = ReadOverrides(pOverrides);
+    if (E_Return::NO_ERROR == error) {
+        pOverrides[kId] = krOverride;
+        error = pSettings->SetSetting(
+            SETTING_ID_TASK_CFG,
+            (uint8_t*)pOverrides,
+            sizeof(pOverrides)
+        );
+    }
+    if (E_Return::NO_ERROR == error) {
+        error = pSettings->Commit();
+    }
+
+    if (E_Return::NO_ERROR == error) {
+        LOG_INFO("Stored the override of task %s.\n", skTasks[kId].pkName);
+    }
+    else {
+        LOG_ERROR(
+            "Failed to store the override of task %s. Error %d\n",
+            skTasks[kId].pkName,
+            error
+        );
+    }
+
+    return error;
+}
+
+E_Return TaskRegistry::ReadOverrides(S_TaskOverride* pOverrides) noexcept {
+    Settings* pSettings;
+    E_Return  error;
+
+    static_assert(
+        SettingSize(SETTING_ID_TASK_CFG) ==
+        TASK_MAX_OVERRIDES * sizeof(S_TaskOverride) &&
+        TASK_MAX_OVERRIDES >= E_TaskId::TASK_ID_COUNT,
+        "The tasks setting must hold an override per task."
+    );
+
+    /* The overrides are only stored once one is set */
+    pSettings = SystemState::GetInstance()->GetSettings();
+    error = pSettings->GetSetting(
+        SETTING_ID_TASK_CFG,
+        (uint8_t*)pOverrides,
+        SettingSize(SETTING_ID_TASK_CFG)
+    );
+    if (E_Return::ERR_SETTING_NOT_FOUND == error) {
+        error = pSettings->GetDefault(
+            SETTING_ID_TASK_CFG,
+            (uint8_t*)pOverrides,
+            SettingSize(SETTING_ID_TASK_CFG)
+        );
+    }
+
+    return error;
+}
+
+void TaskRegistry::LoadStackProfile(void) noexcept {
+#if TASK_STACK_PROFILE
+    S_TaskStackProfile profile;
+    Storage*           pStorage;
+    T_HALFile          file;
+    bool               isRead;
+    uint32_t           i;
+
+    isRead = false;
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage &&
+        E_Return::NO_ERROR == pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        file = pStorage->Open(TASK_STACK_PROFILE_PATH, O_RDONLY);
+        if (file.isOpen()) {
+            isRead = sizeof(profile) == file.read(&profile, sizeof(profile)) &&
+                     TASK_STACK_PROFILE_MAGIC == profile.magic;
+            file.close();
+        }
+        pStorage->ReleaseSPIBus();
+        TaskRegistry::_SPROFILELOADED = true;
+    }
+
+    if (isRead) {
+        HAL::EnterCritical(TaskRegistry::_SLOCK);
+        for (i = 0; E_TaskId::TASK_ID_COUNT > i; ++i) {
+            if (TaskRegistry::_SPSTACKPEAKS[i] < profile.pPeaks[i]) {
+                TaskRegistry::_SPSTACKPEAKS[i] = profile.pPeaks[i];
+            }
+        }
+        HAL::ExitCritical(TaskRegistry::_SLOCK);
+    }
+#endif
+}
@@ -0,0 +1,718 @@
+/*******************************************************************************
+ * @file TelemetryPublisher.cpp
+ *
+ * @see TelemetryPublisher.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Batched telemetry publisher.
+ *
+ * @details Batched telemetry publisher. The node status and the health of the
+ * reporters are sampled periodically and pushed in batches over UDP or MQTT at
+ * the configured interval.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstdio>          /* Standard IO */
+#include <cstdint>         /* Standard integer definitions */
+#include <cstring>         /* String manipulation */
+#include <algorithm>       /* std::min */
+#include <BSP.h>           /* Hardware services */
+#include <WiFi.h>          /* WiFi services */
+#include <Errors.h>        /* Errors definitions */
+#include <Logger.h>        /* Logger services */
+#include <Timeout.h>       /* Timeout manager */
+#include <WiFiUdp.h>       /* UDP transport */
+#include <Arduino.h>       /* Arduino framework */
+#include <Settings.h>      /* Settings services */
+#include <WiFiModule.h>    /* WiFi link state */
+#include <JsonWriter.h>    /* JSON payload writer */
+#include <SystemState.h>   /* System state provider */
+#include <TaskRegistry.h>  /* Firmware tasks registry */
+#include <OutageBuffer.h>  /* Store-and-forward buffer */
+#include <HealthMonitor.h> /* Reporters status */
+
+/* Header file */
+#include <TelemetryPublisher.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the MQTT CONNECT packet type. */
+#define MQTT_PACKET_CONNECT 0x10
+/** @brief Defines the MQTT CONNACK packet type. */
+#define MQTT_PACKET_CONNACK 0x20
+/** @brief Defines the MQTT QoS 0 PUBLISH packet type. */
+#define MQTT_PACKET_PUBLISH 0x30
+/** @brief Defines the MQTT PINGREQ packet type. */
+#define MQTT_PACKET_PINGREQ 0xC0
+/** @brief Defines the MQTT PINGRESP packet type. */
+#define MQTT_PACKET_PINGRESP 0xD0
+/** @brief Defines the MQTT clean session connect flag. */
+#define MQTT_FLAG_CLEAN_SESSION 0x02
+/** @brief Defines the MQTT 3.1.1 protocol level. */
+#define MQTT_PROTOCOL_LEVEL 0x04
+/** @brief Defines the broker response polling period in nanoseconds. */
+#define MQTT_POLL_NS 10000000ULL
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Reads a setting, the default value is used when it is not set.
+ *
+ * @param[in] kId The identifier of the setting.
+ * @param[out] pBuffer The buffer receiving the value.
+ * @param[in] kSize The size of the setting.
+ */
+static void LoadSetting(const E_SettingId kId,
+                        void*             pBuffer,
+                        const size_t      kSize) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The MQTT protocol name of the CONNECT packet. */
+static const char spkMQTTProtocol[] = "MQTT";
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static void LoadSetting(const E_SettingId kId,
+                        void*             pBuffer,
+                        const size_t      kSize) noexcept {
+    Settings* pSettings;
+    E_Return  error;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    error = pSettings->GetSetting(kId, (uint8_t*)pBuffer, kSize);
+    if (E_Return::ERR_SETTING_NOT_FOUND == error) {
+        error = pSettings->GetDefault(kId, (uint8_t*)pBuffer, kSize);
+    }
+    if (E_Return::NO_ERROR != error) {
+        PANIC(
+            "Failed to get setting %s. Error: %d\n",
+            SettingName(kId),
+            error
+        );
+    }
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+TelemetryPublisher::TelemetryPublisher(void) noexcept {
+    this->_mode = E_TelemetryMode::TELEMETRY_MODE_OFF;
+    this->_port = 0;
+    this->_periodNs = 0;
+    this->_backoffNs = 0;
+    this->_nextPublish = 0;
+    this->_head = 0;
+    this->_count = 0;
+    this->_dropped = 0;
+    this->_sequence = 0;
+    this->_pOutage = nullptr;
+    this->_drainCreditNs = 0;
+    this->_lastDrain = 0;
+    this->_lastMQTTSend = 0;
+    this->_pingTime = 0;
+    this->_taskHandle = nullptr;
+
+    snprintf(
+        this->_pTopic,
+        sizeof(this->_pTopic),
+        TELEMETRY_MQTT_TOPIC_PREFIX "%s/telemetry",
+        HWManager::GetHWUID()
+    );
+}
+
+TelemetryPublisher::~TelemetryPublisher(void) noexcept {
+    PANIC("Tried to destroy the telemetry publisher.\n");
+}
+
+E_Return TelemetryPublisher::Start(void) noexcept {
+    S_TelemetryConfig config;
+    bool              isCreated;
+    E_Return          result;
+
+    GetConfiguration(config);
+
+    this->_mode = (E_TelemetryMode)config.mode;
+    this->_port = config.port;
+    this->_periodNs = (uint64_t)std::max(config.periodS, (uint16_t)1) *
+                      1000000000ULL;
+    this->_backoffNs = this->_periodNs;
+    this->_nextPublish = HWManager::GetTime() + this->_periodNs;
+
+    if (E_TelemetryMode::TELEMETRY_MODE_OFF == this->_mode) {
+        LOG_INFO("Telemetry disabled.\n");
+        result = E_Return::NO_ERROR;
+    }
+    else if (!IsConfigValid(config, this->_host)) {
+        LOG_ERROR(
+            "Invalid telemetry configuration %s:%d.\n",
+            config.pHost,
+            this->_port
+        );
+        result = E_Return::ERR_TELEMETRY_INVALID_CONFIG;
+    }
+    else {
+        /* The samples of a previous boot have a stale time base */
+        this->_pOutage = new OutageBuffer(
+            sizeof(S_TelemetrySample),
+            TELEMETRY_OUTAGE_RECORDS,
+            TELEMETRY_OUTAGE_PATH
+        );
+        if (nullptr == this->_pOutage) {
+            PANIC("Failed to allocate the telemetry outage buffer.\n");
+        }
+        this->_pOutage->Reset();
+
+        isCreated = TaskRegistry::CreateTask(
+            E_TaskId::TASK_ID_TELEMETRY,
+            TaskRoutine,
+            this,
+            this->_taskHandle
+        );
+        if (isCreated) {
+            LOG_INFO(
+                "Publishing telemetry to %s:%d every %d s.\n",
+                config.pHost,
+                this->_port,
+                config.periodS
+            );
+            result = E_Return::NO_ERROR;
+        }
+        else {
+            LOG_ERROR("Failed to create the telemetry task.\n");
+            result = E_Return::ERR_MEMORY;
+        }
+    }
+
+    return result;
+}
+
+void TelemetryPublisher::GetConfiguration(S_TelemetryConfig& rConfig)
+noexcept {
+    memset(&rConfig, 0, sizeof(S_TelemetryConfig));
+    LoadSetting(SETTING_ID_TLM_MODE, &rConfig.mode, sizeof(rConfig.mode));
+    LoadSetting(
+        SETTING_ID_TLM_HOST,
+        rConfig.pHost,
+        SettingSize(SETTING_ID_TLM_HOST)
+    );
+    LoadSetting(SETTING_ID_TLM_PORT, &rConfig.port, sizeof(rConfig.port));
+    LoadSetting(
+        SETTING_ID_TLM_PERIOD_S,
+        &rConfig.periodS,
+        sizeof(rConfig.periodS)
+    );
+}
+
+E_Return TelemetryPublisher::SetConfiguration(
+    const S_TelemetryConfig& krConfig) noexcept {
+    Settings* pSettings;
+    IPAddress host;
+    char      pHost[SettingSize(SETTING_ID_TLM_HOST)];
+    E_Return  result;
+
+    if (SettingSize(SETTING_ID_TLM_HOST) <
+        strnlen(krConfig.pHost, sizeof(krConfig.pHost)) ||
+        0 == krConfig.periodS ||
+        !IsConfigValid(krConfig, host)) {
+        LOG_ERROR(
+            "Invalid telemetry configuration %d %s:%d.\n",
+            krConfig.mode,
+            krConfig.pHost,
+            krConfig.port
+        );
+        result = E_Return::ERR_TELEMETRY_INVALID_CONFIG;
+    }
+    else {
+        /* The stored string is padded to the setting size */
+        memset(pHost, 0, sizeof(pHost));
+        memcpy(
+            pHost,
+            krConfig.pHost,
+            strnlen(krConfig.pHost, sizeof(pHost))
+        );
+
+        pSettings = SystemState::GetInstance()->GetSettings();
+        result = pSettings->SetSetting(
+            SETTING_ID_TLM_MODE,
+            &krConfig.mode,
+            sizeof(krConfig.mode)
+        );
+        if (E_Return::NO_ERROR == result) {
+            result = pSettings->SetSetting(
+                SETTING_ID_TLM_HOST,
+                (const uint8_t*)pHost,
+                sizeof(pHost)
+            );
+        }
+        if (E_Return::NO_ERROR == result) {
+            result = pSettings->SetSetting(
+                SETTING_ID_TLM_PORT,
+                (const uint8_t*)&krConfig.port,
+                sizeof(krConfig.port)
+            );
+        }
+        if (E_Return::NO_ERROR == result) {
+            result = pSettings->SetSetting(
+                SETTING_ID_TLM_PERIOD_S,
+                (const uint8_t*)&krConfig.periodS,
+                sizeof(krConfig.periodS)
+            );
+        }
+        if (E_Return::NO_ERROR == result) {
+            result = pSettings->Commit();
+        }
+
+        if (E_Return::NO_ERROR == result) {
+            LOG_INFO("Telemetry settings updated, applied at next boot.\n");
+        }
+        else {
+            LOG_ERROR(
+                "Failed to store the telemetry settings. Error %d\n",
+                result
+            );
+        }
+    }
+
+    return result;
+}
+
+bool TelemetryPublisher::IsConfigValid(const S_TelemetryConfig& krConfig,
+                                       IPAddress&               rHost)
+noexcept {
+    bool isValid;
+
+    /* A disabled telemetry has no collector to check */
+    isValid = E_TelemetryMode::TELEMETRY_MODE_OFF == krConfig.mode ||
+              (E_TelemetryMode::TELEMETRY_MODE_MQTT >= krConfig.mode &&
+               rHost.fromString(krConfig.pHost) &&
+               0 != (uint32_t)rHost &&
+               0 != krConfig.port);
+
+    return isValid;
+}
+
+void TelemetryPublisher::TaskRoutine(void* pParam) noexcept {
+    TelemetryPublisher* pPublisher;
+    WiFiModule*         pWiFi;
+    TickType_t          lastWake;
+    BaseType_t          delayRes;
+    uint64_t            currentTime;
+    bool                isSent;
+
+    pPublisher = (TelemetryPublisher*)pParam;
+    lastWake = xTaskGetTickCount();
+
+    while (true) {
+        pPublisher->Sample();
+
+        currentTime = HWManager::GetTime();
+        pWiFi = SystemState::GetInstance()->GetWiFiModule();
+        if (nullptr == pWiFi || !pWiFi->IsLinkUp()) {
+            /* Outage, the samples are buffered until the link is back */
+        }
+        else if (pPublisher->_nextPublish <= currentTime ||
+                 (pPublisher->_backoffNs == pPublisher->_periodNs &&
+                  0 != pPublisher->_pOutage->GetCount())) {
+            /* The backlog is drained between the live publications */
+            if (pPublisher->_nextPublish <= currentTime) {
+                isSent = pPublisher->Publish();
+                pPublisher->_nextPublish = currentTime + pPublisher->_periodNs;
+            }
+            else {
+                isSent = true;
+            }
+            isSent = isSent && pPublisher->DrainBacklog();
+
+            if (isSent) {
+                pPublisher->_backoffNs = pPublisher->_periodNs;
+            }
+            else {
+                /* Back off while the collector does not keep up */
+                pPublisher->_backoffNs = std::min(
+                    pPublisher->_backoffNs * 2,
+                    (uint64_t)TELEMETRY_MAX_BACKOFF_NS
+                );
+                LOG_DEBUG(
+                    "Telemetry send failed, retrying in %llu s.\n",
+                    pPublisher->_backoffNs / 1000000000ULL
+                );
+                pPublisher->_nextPublish =
+                    currentTime + pPublisher->_backoffNs;
+            }
+        }
+
+        /* The broker session is kept open between the publications */
+        if (nullptr != pWiFi && pWiFi->IsLinkUp()) {
+            pPublisher->KeepAliveMQTT(HWManager::GetTime());
+        }
+
+        /* A slow send skips the missed samples instead of catching up */
+        delayRes = xTaskDelayUntil(
+            &lastWake,
+            TELEMETRY_SAMPLE_PERIOD_NS / 1000000 / portTICK_PERIOD_MS
+        );
+        if (pdPASS != delayRes) {
+            lastWake = xTaskGetTickCount();
+        }
+    }
+}
+
+void TelemetryPublisher::Sample(void) noexcept {
+    S_TelemetrySample* pSample;
+    HealthMonitor*     pHM;
+    S_HMActionStats    stats;
+
+    /* The oldest sample is moved to the backlog when the collector lags */
+    if (TELEMETRY_MAX_SAMPLES == this->_count) {
+        if (E_Return::NO_ERROR !=
+            this->_pOutage->Push(&this->_pSamples[this->_head])) {
+            ++this->_dropped;
+        }
+        this->_head = (this->_head + 1) % TELEMETRY_MAX_SAMPLES;
+        --this->_count;
+    }
+
+    pSample = &this->_pSamples[
+        (this->_head + this->_count) % TELEMETRY_MAX_SAMPLES
+    ];
+    pSample->timeMs = (uint32_t)(HWManager::GetTime() / 1000000ULL);
+    pSample->heapFree = ESP.getFreeHeap();
+    pSample->heapMin = ESP.getMinFreeHeap();
+    pSample->rssi = WiFi.isConnected() ? WiFi.RSSI() : 0;
+
+    pHM = SystemState::GetInstance()->GetHealthMonitor();
+    pHM->GetActionStats(stats);
+    pSample->hmPending = stats.pending;
+    pSample->hmDropped = stats.dropped;
+
+    ++this->_count;
+}
+
+bool TelemetryPublisher::Publish(void) noexcept {
+    uint32_t count;
+    uint32_t sent;
+    uint32_t i;
+
+    sent = 1;
+    while (0 != sent && 0 != this->_count) {
+        count = std::min(this->_count, (uint32_t)TELEMETRY_BATCH_MAX_SAMPLES);
+        for (i = 0; count > i; ++i) {
+            this->_pBatch[i] =
+                this->_pSamples[(this->_head + i) % TELEMETRY_MAX_SAMPLES];
+        }
+
+        /* Samples are only released once sent */
+        sent = SendBatch(count, false);
+        this->_head = (this->_head + sent) % TELEMETRY_MAX_SAMPLES;
+        this->_count -= sent;
+    }
+
+    return 0 != sent;
+}
+
+bool TelemetryPublisher::DrainBacklog(void) noexcept {
+    uint64_t currentTime;
+    uint32_t count;
+    uint32_t sent;
+
+    /* The credit grows with the time, up to a burst of payloads */
+    currentTime = HWManager::GetTime();
+    this->_drainCreditNs = std::min<uint64_t>(
+        this->_drainCreditNs + (currentTime - this->_lastDrain),
+        TELEMETRY_DRAIN_BURST * TELEMETRY_DRAIN_PAYLOAD_NS
+    );
+    this->_lastDrain = currentTime;
+
+    sent = 1;
+    count = 1;
+    while (0 != sent && 0 != count &&
+           TELEMETRY_DRAIN_PAYLOAD_NS <= this->_drainCreditNs) {
+        count = this->_pOutage->Peek(
+            this->_pBatch,
+            TELEMETRY_BATCH_MAX_SAMPLES
+        );
+        if (0 != count) {
+            sent = SendBatch(count, true);
+            this->_pOutage->Release(sent);
+            this->_drainCreditNs -= TELEMETRY_DRAIN_PAYLOAD_NS;
+        }
+    }
+
+    return 0 != sent;
+}
+
+uint32_t TelemetryPublisher::SendBatch(const uint32_t kCount,
+                                       const bool     kIsBacklog) noexcept {
+    size_t   size;
+    uint32_t count;
+
+    /* Halve the batch until it fits a payload */
+    count = kCount;
+    size = FormatBatch(count, kIsBacklog);
+    while (0 == size && 1 < count) {
+        count /= 2;
+        size = FormatBatch(count, kIsBacklog);
+    }
+
+    if (0 == size) {
+        LOG_ERROR("Telemetry sample does not fit a payload.\n");
+        ++this->_dropped;
+        count = 1;
+    }
+    else if (Send(size)) {
+        ++this->_sequence;
+    }
+    else {
+        count = 0;
+    }
+
+    return count;
+}
+
+size_t TelemetryPublisher::FormatBatch(const uint32_t kCount,
+                                       const bool     kIsBacklog) noexcept {
+    JsonWriter               writer(this->_pPayload, sizeof(this->_pPayload));
+    const S_TelemetrySample* kpSample;
+    uint32_t                 healthCount;
+    uint32_t                 i;
+
+    healthCount = SystemState::GetInstance()->GetHealthMonitor()->
+        GetReportersStatus(this->_pHealth, HM_MAX_REPORTERS);
+
+    writer.BeginObject();
+    writer.AddString("node", HWManager::GetHWUID());
+    writer.AddUInt("seq", this->_sequence);
+    writer.AddUInt("dropped", this->_dropped);
+    writer.AddBool("backlog", kIsBacklog);
+    writer.AddUInt("pending", this->_pOutage->GetCount());
+
+    writer.BeginArray("health");
+    for (i = 0; healthCount > i; ++i) {
+        writer.BeginObject();
+        writer.AddString("name", this->_pHealth[i].pName);
+        writer.AddUInt("status", this->_pHealth[i].status);
+        writer.AddUInt("failures", this->_pHealth[i].failures);
+        writer.AddUInt("total", this->_pHealth[i].totalFailures);
+        writer.EndObject();
+    }
+    writer.EndArray();
+
+    writer.BeginArray("samples");
+    for (i = 0; kCount > i; ++i) {
+        kpSample = &this->_pBatch[i];
+        writer.BeginObject();
+        writer.AddUInt("t", kpSample->timeMs);
+        writer.AddUInt("heap", kpSample->heapFree);
+        writer.AddUInt("heap_min", kpSample->heapMin);
+        writer.AddInt("rssi", kpSample->rssi);
+        writer.AddUInt("hm_pending", kpSample->hmPending);
+        writer.AddUInt("hm_dropped", kpSample->hmDropped);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    return writer.IsOverflowed() ? 0 : writer.GetSize();
+}
+
+bool TelemetryPublisher::Send(const size_t kSize) noexcept {
+    uint32_t topicLength;
+    bool     isSent;
+
+    isSent = false;
+    if (!WiFi.isConnected()) {
+        /* Nothing to do, the samples stay buffered */
+    }
+    else if (E_TelemetryMode::TELEMETRY_MODE_UDP == this->_mode) {
+        isSent = 1 == this->_udp.beginPacket(this->_host, this->_port) &&
+                 kSize == this->_udp.write(
+                     (const uint8_t*)this->_pPayload,
+                     kSize
+                 ) &&
+                 1 == this->_udp.endPacket();
+    }
+    else {
+        /* The broker connection is kept between the batches */
+        topicLength = strlen(this->_pTopic);
+        isSent = (this->_mqtt.connected() || ConnectMQTT()) &&
+                 WriteMQTTHeader(
+                     MQTT_PACKET_PUBLISH,
+                     2 + topicLength + kSize
+                 ) &&
+                 WriteMQTTString(this->_pTopic) &&
+                 kSize == this->_mqtt.write(
+                     (const uint8_t*)this->_pPayload,
+                     kSize
+                 );
+        if (isSent) {
+            this->_lastMQTTSend = HWManager::GetTime();
+        }
+        else {
+            this->_mqtt.stop();
+        }
+    }
+
+    return isSent;
+}
+
+bool TelemetryPublisher::ConnectMQTT(void) noexcept {
+    Timeout  connTimeout(TELEMETRY_CONNECT_TIMEOUT_NS);
+    uint8_t  pVarHeader[4];
+    uint8_t  pAck[4];
+    uint32_t remaining;
+    bool     isConnected;
+
+    LOG_DEBUG("Connecting to the telemetry broker.\n");
+
+    /* The broker closes the sessions idle for 1.5 keep alive intervals */
+    pVarHeader[0] = MQTT_PROTOCOL_LEVEL;
+    pVarHeader[1] = MQTT_FLAG_CLEAN_SESSION;
+    pVarHeader[2] = (uint8_t)(TELEMETRY_MQTT_KEEPALIVE_S >> 8);
+    pVarHeader[3] = (uint8_t)TELEMETRY_MQTT_KEEPALIVE_S;
+    remaining = 2 + strlen(spkMQTTProtocol) +
+                sizeof(pVarHeader) +
+                2 + strlen(HWManager::GetHWUID());
+
+    isConnected = 1 == this->_mqtt.connect(
+                      this->_host,
+                      this->_port,
+                      TELEMETRY_CONNECT_TIMEOUT_NS / 1000000ULL
+                  ) &&
+                  WriteMQTTHeader(MQTT_PACKET_CONNECT, remaining) &&
+                  WriteMQTTString(spkMQTTProtocol) &&
+                  sizeof(pVarHeader) == this->_mqtt.write(
+                      pVarHeader,
+                      sizeof(pVarHeader)
+                  ) &&
+                  WriteMQTTString(HWManager::GetHWUID());
+
+    /* Wait for the CONNACK */
+    if (isConnected) {
+        connTimeout.Notify();
+        while (sizeof(pAck) > (size_t)this->_mqtt.available() &&
+               this->_mqtt.connected() &&
+               !connTimeout.HasTimedOut()) {
+            HWManager::DelayExecNs(MQTT_POLL_NS);
+        }
+        isConnected = sizeof(pAck) == this->_mqtt.read(pAck, sizeof(pAck)) &&
+                      MQTT_PACKET_CONNACK == pAck[0] &&
+                      2 == pAck[1] &&
+                      0 == pAck[3];
+    }
+
+    if (isConnected) {
+        this->_lastMQTTSend = HWManager::GetTime();
+        this->_pingTime = 0;
+    }
+    else {
+        LOG_ERROR("Failed to connect to the telemetry broker.\n");
+        this->_mqtt.stop();
+    }
+
+    return isConnected;
+}
+
+void TelemetryPublisher::KeepAliveMQTT(const uint64_t kTime) noexcept {
+    uint8_t pPing[2];
+
+    if (E_TelemetryMode::TELEMETRY_MODE_MQTT == this->_mode &&
+        this->_mqtt.connected()) {
+        /* The QoS 0 publications are not acknowledged, only pings are */
+        while (0 < this->_mqtt.available()) {
+            if (MQTT_PACKET_PINGRESP == this->_mqtt.read()) {
+                this->_pingTime = 0;
+            }
+        }
+
+        if (0 != this->_pingTime &&
+            TELEMETRY_MQTT_KEEPALIVE_S * 1000000000ULL <=
+            kTime - this->_pingTime) {
+            LOG_ERROR("Telemetry broker ping timeout.\n");
+            this->_mqtt.stop();
+        }
+        else if (0 == this->_pingTime &&
+                 TELEMETRY_MQTT_KEEPALIVE_S * 500000000ULL <=
+                 kTime - this->_lastMQTTSend) {
+            pPing[0] = MQTT_PACKET_PINGREQ;
+            pPing[1] = 0;
+            if (sizeof(pPing) == this->_mqtt.write(pPing, sizeof(pPing))) {
+                this->_lastMQTTSend = kTime;
+                this->_pingTime = kTime;
+            }
+            else {
+                this->_mqtt.stop();
+            }
+        }
+    }
+}
+
+bool TelemetryPublisher::WriteMQTTHeader(const uint8_t  kType,
+                                         const uint32_t kRemaining) noexcept {
+    uint8_t  pHeader[5];
+    uint32_t remaining;
+    size_t   size;
+
+    /* The remaining length is encoded 7 bits at a time */
+    pHeader[0] = kType;
+    size = 1;
+    remaining = kRemaining;
+    do {
+        pHeader[size] = remaining & 0x7F;
+        remaining >>= 7;
+        if (0 != remaining) {
+            pHeader[size] |= 0x80;
+        }
+        ++size;
+    } while (0 != remaining && sizeof(pHeader) > size);
+
+    return size == this->_mqtt.write(pHeader, size);
+}
+
+bool TelemetryPublisher::WriteMQTTString(const char* kpStr) noexcept {
+    uint8_t pLength[2];
+    size_t  length;
+
+    length = strlen(kpStr);
+    pLength[0] = (uint8_t)(length >> 8);
+    pLength[1] = (uint8_t)length;
+
+    return sizeof(pLength) == this->_mqtt.write(pLength, sizeof(pLength)) &&
+           length == this->_mqtt.write((const uint8_t*)kpStr, length);
+}
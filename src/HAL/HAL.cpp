@@ -0,0 +1,255 @@
+/*******************************************************************************
+ * @file HAL.cpp
+ *
+ * @see HAL.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Hardware abstraction layer, ESP32 backend.
+ *
+ * @details Hardware abstraction layer, ESP32 backend. The services forward
+ * to FreeRTOS, the capability based allocator and the BSP.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <BSP.h>           /* Hardware services */
+#include <cstdint>         /* Standard integer definitions */
+#include <cstring>         /* String manipulation */
+#include <Arduino.h>       /* FreeRTOS services */
+#include <rom/crc.h>       /* CRC32 services */
+#include <esp_heap_caps.h> /* Capability based allocation */
+
+/* Header file */
+#include <HAL.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Converts a timeout to scheduler ticks.
+ *
+ * @param[in] kTimeoutNs The timeout in nanoseconds.
+ *
+ * @return The timeout rounded up to the tick is returned, portMAX_DELAY for
+ * HAL_WAIT_FOREVER.
+ */
+static TickType_t NsToTicks(const uint64_t kTimeoutNs) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static TickType_t NsToTicks(const uint64_t kTimeoutNs) noexcept {
+    TickType_t ticks;
+
+    if (HAL_WAIT_FOREVER == kTimeoutNs) {
+        ticks = portMAX_DELAY;
+    }
+    else {
+        ticks = (TickType_t)((kTimeoutNs + HAL_TICK_NS - 1) / HAL_TICK_NS);
+    }
+
+    return ticks;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+uint64_t HAL::GetTime(void) noexcept {
+    return HWManager::GetTime();
+}
+
+uint32_t HAL::GetCycleCount(void) noexcept {
+    return HWManager::GetCycleCount();
+}
+
+T_HALMutex HAL::CreateMutex(void) noexcept {
+    return xSemaphoreCreateMutex();
+}
+
+bool HAL::TakeMutex(T_HALMutex mutex, const uint64_t kTimeoutNs) noexcept {
+    return pdPASS == xSemaphoreTake(mutex, NsToTicks(kTimeoutNs));
+}
+
+bool HAL::GiveMutex(T_HALMutex mutex) noexcept {
+    return pdPASS == xSemaphoreGive(mutex);
+}
+
+void HAL::InitSpinLock(T_HALSpinLock& rLock) noexcept {
+    rLock = HAL_SPINLOCK_INITIALIZER;
+}
+
+void HAL::EnterCritical(T_HALSpinLock& rLock) noexcept {
+    taskENTER_CRITICAL(&rLock);
+}
+
+void HAL::ExitCritical(T_HALSpinLock& rLock) noexcept {
+    taskEXIT_CRITICAL(&rLock);
+}
+
+bool HAL::CreateTask(T_HALTaskRoutine routine,
+                     const char*      kpName,
+                     const uint32_t   kStackSize,
+                     void*            pParam,
+                     const uint32_t   kPriority,
+                     const int32_t    kCore,
+                     T_HALTask&       rTask) noexcept {
+    BaseType_t core;
+
+    core = kCore;
+    if (HAL_CORE_ANY == kCore) {
+        core = tskNO_AFFINITY;
+    }
+
+    return pdPASS == xTaskCreatePinnedToCore(
+        routine,
+        kpName,
+        kStackSize,
+        pParam,
+        kPriority,
+        &rTask,
+        core
+    );
+}
+
+T_HALTask HAL::GetCurrentTask(void) noexcept {
+    return xTaskGetCurrentTaskHandle();
+}
+
+uint8_t HAL::GetCoreId(void) noexcept {
+    return (uint8_t)xPortGetCoreID();
+}
+
+uint32_t HAL::GetTasks(S_HALTaskInfo* pTasks, const uint32_t kCount) noexcept {
+    TaskStatus_t* pStates;
+    uint32_t      count;
+    uint32_t      i;
+
+    /* The states are only needed while listing */
+    count = 0;
+    pStates = (TaskStatus_t*)Allocate(sizeof(TaskStatus_t) * kCount, true);
+    if (nullptr != pStates) {
+        count = uxTaskGetSystemState(pStates, kCount, nullptr);
+        for (i = 0; count > i; ++i) {
+            pTasks[i].task = pStates[i].xHandle;
+            strncpy(
+                pTasks[i].pName,
+                pStates[i].pcTaskName,
+                HAL_TASK_NAME_SIZE - 1
+            );
+            pTasks[i].pName[HAL_TASK_NAME_SIZE - 1] = 0;
+        }
+        heap_caps_free(pStates);
+    }
+
+    return count;
+}
+
+void HAL::Sleep(const uint64_t kDelayNs) noexcept {
+    TickType_t ticks;
+
+    ticks = NsToTicks(kDelayNs);
+    if (0 == ticks) {
+        ticks = 1;
+    }
+    vTaskDelay(ticks);
+}
+
+T_HALTick HAL::GetTick(void) noexcept {
+    return xTaskGetTickCount();
+}
+
+bool HAL::DelayUntil(T_HALTick& rLastWake, const uint64_t kPeriodNs) noexcept {
+    return pdPASS == xTaskDelayUntil(
+        &rLastWake,
+        (TickType_t)(kPeriodNs / HAL_TICK_NS)
+    );
+}
+
+void HAL::NotifyTask(T_HALTask task) noexcept {
+    xTaskNotifyGive(task);
+}
+
+uint32_t HAL::WaitNotify(const uint64_t kTimeoutNs) noexcept {
+    return ulTaskNotifyTake(pdTRUE, NsToTicks(kTimeoutNs));
+}
+
+T_HALQueue HAL::CreateQueue(const uint32_t kLength,
+                            const uint32_t kItemSize) noexcept {
+    return xQueueCreate(kLength, kItemSize);
+}
+
+bool HAL::SendQueue(T_HALQueue     queue,
+                    const void*    kpItem,
+                    const uint64_t kTimeoutNs) noexcept {
+    return pdPASS == xQueueSend(queue, kpItem, NsToTicks(kTimeoutNs));
+}
+
+bool HAL::ReceiveQueue(T_HALQueue     queue,
+                       void*          pItem,
+                       const uint64_t kTimeoutNs) noexcept {
+    return pdPASS == xQueueReceive(queue, pItem, NsToTicks(kTimeoutNs));
+}
+
+void* HAL::Allocate(const size_t kSize, const bool kIsExternal) noexcept {
+    uint32_t caps;
+
+    caps = kIsExternal ?
+           MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT :
+           MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+
+    return heap_caps_malloc(kSize, caps);
+}
+
+void HAL::GetHeapStats(S_HALHeapStats& rStats) noexcept {
+    rStats.freeSize = heap_caps_get_free_size(
+        MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+    );
+    rStats.largestBlock = heap_caps_get_largest_free_block(
+        MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+    );
+    rStats.minFreeSize = heap_caps_get_minimum_free_size(
+        MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+    );
+}
+
+uint32_t HAL::Crc32(const uint32_t kSeed,
+                    const uint8_t* kpData,
+                    const size_t   kSize) noexcept {
+    return crc32_le(kSeed, kpData, kSize);
+}
@@ -0,0 +1,580 @@
+/*******************************************************************************
+ * @file HALNative.cpp
+ *
+ * @see HAL.h, HALNative.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Hardware abstraction layer, host simulator backend.
+ *
+ * @details Hardware abstraction layer, host simulator backend. The tasks are
+ * detached host threads, the notifications, mutexes and queues are built on
+ * the standard threading library.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <new>                /* std::nothrow */
+#include <mutex>              /* Standard mutexes */
+#include <chrono>             /* Standard clocks */
+#include <thread>             /* Standard threads */
+#include <cerrno>             /* Host error numbers */
+#include <exception>          /* Standard exceptions */
+#include <cstdlib>            /* malloc */
+#include <cstring>            /* memcpy */
+#include <cstdint>            /* Standard integer definitions */
+#include <unistd.h>           /* Host file services */
+#include <sys/stat.h>         /* Host file status */
+#include <condition_variable> /* Standard condition variables */
+
+/* Header file */
+#include <HAL.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Simulated task. */
+struct S_HALNativeTask {
+    /** @brief The task routine. */
+    T_HALTaskRoutine routine;
+    /** @brief The routine parameter. */
+    void* pParam;
+    /** @brief The notifications lock. */
+    std::mutex lock;
+    /** @brief Signaled when a notification is given. */
+    std::condition_variable notified;
+    /** @brief The pending notifications. */
+    uint32_t notifications;
+};
+
+/** @brief Simulated mutex. */
+struct S_HALNativeMutex {
+    /** @brief The host mutex. */
+    std::recursive_timed_mutex lock;
+};
+
+/** @brief Simulated queue, a ring of fixed-size items. */
+struct S_HALNativeQueue {
+    /** @brief The queue lock. */
+    std::mutex lock;
+    /** @brief Signaled when an item is added. */
+    std::condition_variable notEmpty;
+    /** @brief Signaled when an item is removed. */
+    std::condition_variable notFull;
+    /** @brief The items storage. */
+    uint8_t* pItems;
+    /** @brief The number of items of the queue. */
+    uint32_t length;
+    /** @brief The size of an item in bytes. */
+    uint32_t itemSize;
+    /** @brief The index of the oldest item. */
+    uint32_t head;
+    /** @brief The number of queued items. */
+    uint32_t count;
+};
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Host thread entry of the simulated tasks.
+ *
+ * @param[in] pTask The task to run.
+ */
+static void TaskEntry(S_HALNativeTask* pTask) noexcept;
+
+/**
+ * @brief Returns the wait deadline of a timeout.
+ *
+ * @param[in] kTimeoutNs The timeout in nanoseconds, not HAL_WAIT_FOREVER.
+ *
+ * @return The deadline on the host steady clock is returned.
+ */
+static std::chrono::steady_clock::time_point GetDeadline(
+    const uint64_t kTimeoutNs
+) noexcept;
+
+/**
+ * @brief Waits on a condition variable until a condition holds.
+ *
+ * @param[in] rCondition The condition variable to wait on.
+ * @param[in] rGuard The held lock of the condition.
+ * @param[in] krValue The value tested by the condition.
+ * @param[in] kValue The value the condition waits to differ from.
+ * @param[in] kTimeoutNs The wait timeout in nanoseconds.
+ *
+ * @return true is returned when the value differs, false on timeout.
+ */
+static bool WaitWhile(std::condition_variable&      rCondition,
+                      std::unique_lock<std::mutex>& rGuard,
+                      const uint32_t&               krValue,
+                      const uint32_t                kValue,
+                      const uint64_t                kTimeoutNs) noexcept;
+
+/**
+ * @brief Builds the CRC32 table.
+ */
+static void BuildCrcTable(void) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The time origin of the simulator. */
+static const std::chrono::steady_clock::time_point skBootTime =
+    std::chrono::steady_clock::now();
+
+/** @brief The task of the calling thread, created on first use. */
+static thread_local S_HALNativeTask* spCurrentTask = nullptr;
+
+/** @brief The zlib CRC32 table, built on first use. */
+static uint32_t spCrcTable[256];
+/** @brief Guards the CRC32 table construction. */
+static std::once_flag sCrcTableFlag;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static void TaskEntry(S_HALNativeTask* pTask) noexcept {
+    spCurrentTask = pTask;
+    pTask->routine(pTask->pParam);
+}
+
+static std::chrono::steady_clock::time_point GetDeadline(
+    const uint64_t kTimeoutNs
+) noexcept {
+    return std::chrono::steady_clock::now() +
+           std::chrono::nanoseconds(kTimeoutNs);
+}
+
+static bool WaitWhile(std::condition_variable&      rCondition,
+                      std::unique_lock<std::mutex>& rGuard,
+                      const uint32_t&               krValue,
+                      const uint32_t                kValue,
+                      const uint64_t                kTimeoutNs) noexcept {
+    std::chrono::steady_clock::time_point deadline;
+    bool                                  isTimedOut;
+
+    isTimedOut = false;
+    if (HAL_WAIT_FOREVER == kTimeoutNs) {
+        while (kValue == krValue) {
+            rCondition.wait(rGuard);
+        }
+    }
+    else {
+        deadline = GetDeadline(kTimeoutNs);
+        while (kValue == krValue && !isTimedOut) {
+            isTimedOut = std::cv_status::timeout ==
+                         rCondition.wait_until(rGuard, deadline);
+        }
+    }
+
+    return kValue != krValue;
+}
+
+static void BuildCrcTable(void) noexcept {
+    uint32_t entry;
+    uint32_t index;
+    uint8_t  shift;
+
+    for (index = 0; 256 > index; ++index) {
+        entry = index;
+        for (shift = 0; 8 > shift; ++shift) {
+            entry = (entry >> 1) ^ ((entry & 1) ? 0xEDB88320UL : 0);
+        }
+        spCrcTable[index] = entry;
+    }
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+uint64_t HAL::GetTime(void) noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - skBootTime
+    ).count();
+}
+
+uint32_t HAL::GetCycleCount(void) noexcept {
+    /* The host counts one cycle per nanosecond */
+    return (uint32_t)HAL::GetTime();
+}
+
+T_HALMutex HAL::CreateMutex(void) noexcept {
+    return new (std::nothrow) S_HALNativeMutex();
+}
+
+bool HAL::TakeMutex(T_HALMutex mutex, const uint64_t kTimeoutNs) noexcept {
+    bool isTaken;
+
+    if (HAL_WAIT_FOREVER == kTimeoutNs) {
+        mutex->lock.lock();
+        isTaken = true;
+    }
+    else {
+        isTaken = mutex->lock.try_lock_until(GetDeadline(kTimeoutNs));
+    }
+
+    return isTaken;
+}
+
+bool HAL::GiveMutex(T_HALMutex mutex) noexcept {
+    mutex->lock.unlock();
+    return true;
+}
+
+void HAL::InitSpinLock(T_HALSpinLock& rLock) noexcept {
+    rLock.flag.clear(std::memory_order_release);
+}
+
+void HAL::EnterCritical(T_HALSpinLock& rLock) noexcept {
+    while (rLock.flag.test_and_set(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+void HAL::ExitCritical(T_HALSpinLock& rLock) noexcept {
+    rLock.flag.clear(std::memory_order_release);
+}
+
+bool HAL::CreateTask(T_HALTaskRoutine routine,
+                     const char*      kpName,
+                     const uint32_t   kStackSize,
+                     void*            pParam,
+                     const uint32_t   kPriority,
+                     const int32_t    kCore,
+                     T_HALTask&       rTask) noexcept {
+    S_HALNativeTask* pTask;
+    bool             isCreated;
+
+    /* The host schedules the threads */
+    (void)kpName;
+    (void)kStackSize;
+    (void)kPriority;
+    (void)kCore;
+
+    isCreated = false;
+    pTask = new (std::nothrow) S_HALNativeTask();
+    if (nullptr != pTask) {
+        pTask->routine = routine;
+        pTask->pParam = pParam;
+        pTask->notifications = 0;
+
+        /* The handle is valid before the routine starts */
+        rTask = pTask;
+        try {
+            std::thread(TaskEntry, pTask).detach();
+            isCreated = true;
+        }
+        catch (std::exception& rExc) {
+            (void)rExc;
+            rTask = nullptr;
+            delete pTask;
+        }
+    }
+
+    return isCreated;
+}
+
+T_HALTask HAL::GetCurrentTask(void) noexcept {
+    /* The threads not created by the HAL get a task on first use */
+    if (nullptr == spCurrentTask) {
+        spCurrentTask = new S_HALNativeTask();
+        spCurrentTask->routine = nullptr;
+        spCurrentTask->pParam = nullptr;
+        spCurrentTask->notifications = 0;
+    }
+
+    return spCurrentTask;
+}
+
+uint8_t HAL::GetCoreId(void) noexcept {
+    /* The host threads are not pinned */
+    return 0;
+}
+
+uint32_t HAL::GetTasks(S_HALTaskInfo* pTasks, const uint32_t kCount) noexcept {
+    /* The host threads are not listed */
+    (void)pTasks;
+    (void)kCount;
+
+    return 0;
+}
+
+void HAL::Sleep(const uint64_t kDelayNs) noexcept {
+    std::this_thread::sleep_for(std::chrono::nanoseconds(kDelayNs));
+}
+
+T_HALTick HAL::GetTick(void) noexcept {
+    return HAL::GetTime();
+}
+
+bool HAL::DelayUntil(T_HALTick& rLastWake, const uint64_t kPeriodNs) noexcept {
+    bool isDelayed;
+
+    rLastWake += kPeriodNs;
+    isDelayed = rLastWake > HAL::GetTime();
+    if (isDelayed) {
+        std::this_thread::sleep_until(
+            skBootTime + std::chrono::nanoseconds(rLastWake)
+        );
+    }
+
+    return isDelayed;
+}
+
+void HAL::NotifyTask(T_HALTask task) noexcept {
+    {
+        std::lock_guard<std::mutex> guard(task->lock);
+        ++task->notifications;
+    }
+    task->notified.notify_one();
+}
+
+uint32_t HAL::WaitNotify(const uint64_t kTimeoutNs) noexcept {
+    S_HALNativeTask* pTask;
+    uint32_t         notifications;
+
+    pTask = HAL::GetCurrentTask();
+    std::unique_lock<std::mutex> guard(pTask->lock);
+    (void)WaitWhile(
+        pTask->notified,
+        guard,
+        pTask->notifications,
+        0,
+        kTimeoutNs
+    );
+    notifications = pTask->notifications;
+    pTask->notifications = 0;
+
+    return notifications;
+}
+
+T_HALQueue HAL::CreateQueue(const uint32_t kLength,
+                            const uint32_t kItemSize) noexcept {
+    S_HALNativeQueue* pQueue;
+
+    pQueue = new (std::nothrow) S_HALNativeQueue();
+    if (nullptr != pQueue) {
+        pQueue->pItems = (uint8_t*)malloc((size_t)kLength * kItemSize);
+        pQueue->length = kLength;
+        pQueue->itemSize = kItemSize;
+        pQueue->head = 0;
+        pQueue->count = 0;
+        if (nullptr == pQueue->pItems) {
+            delete pQueue;
+            pQueue = nullptr;
+        }
+    }
+
+    return pQueue;
+}
+
+bool HAL::SendQueue(T_HALQueue     queue,
+                    const void*    kpItem,
+                    const uint64_t kTimeoutNs) noexcept {
+    bool     isSent;
+    uint32_t index;
+
+    std::unique_lock<std::mutex> guard(queue->lock);
+    isSent = WaitWhile(
+        queue->notFull,
+        guard,
+        queue->count,
+        queue->length,
+        kTimeoutNs
+    );
+    if (isSent) {
+        index = (queue->head + queue->count) % queue->length;
+        memcpy(
+            queue->pItems + (size_t)index * queue->itemSize,
+            kpItem,
+            queue->itemSize
+        );
+        ++queue->count;
+        guard.unlock();
+        queue->notEmpty.notify_one();
+    }
+
+    return isSent;
+}
+
+bool HAL::ReceiveQueue(T_HALQueue     queue,
+                       void*          pItem,
+                       const uint64_t kTimeoutNs) noexcept {
+    bool isReceived;
+
+    std::unique_lock<std::mutex> guard(queue->lock);
+    isReceived = WaitWhile(
+        queue->notEmpty,
+        guard,
+        queue->count,
+        0,
+        kTimeoutNs
+    );
+    if (isReceived) {
+        memcpy(
+            pItem,
+            queue->pItems + (size_t)queue->head * queue->itemSize,
+            queue->itemSize
+        );
+        queue->head = (queue->head + 1) % queue->length;
+        --queue->count;
+        guard.unlock();
+        queue->notFull.notify_one();
+    }
+
+    return isReceived;
+}
+
+void* HAL::Allocate(const size_t kSize, const bool kIsExternal) noexcept {
+    void* pMemory;
+
+    /* The host has no external memory */
+    pMemory = nullptr;
+    if (!kIsExternal) {
+        pMemory = malloc(kSize);
+    }
+
+    return pMemory;
+}
+
+void HAL::GetHeapStats(S_HALHeapStats& rStats) noexcept {
+    /* The host heap is not accounted */
+    rStats.freeSize = 0;
+    rStats.largestBlock = 0;
+    rStats.minFreeSize = 0;
+}
+
+uint32_t HAL::Crc32(const uint32_t kSeed,
+                    const uint8_t* kpData,
+                    const size_t   kSize) noexcept {
+    uint32_t crc;
+    uint32_t value;
+    size_t   i;
+
+    std::call_once(sCrcTableFlag, BuildCrcTable);
+
+    /* Same as the ROM function, the CRC is inverted in and out */
+    crc = ~kSeed;
+    for (i = 0; kSize > i; ++i) {
+        value = (crc ^ kpData[i]) & 0xFF;
+        crc = spCrcTable[value] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+HALNativeFile::HALNativeFile(void) noexcept {
+    this->_fd = -1;
+    this->_error = 0;
+}
+
+bool HALNativeFile::open(const char* kpPath, const oflag_t kFlags) noexcept {
+    this->_fd = ::open(kpPath, kFlags, 0644);
+    this->_error = (0 > this->_fd) ? errno : 0;
+
+    return 0 <= this->_fd;
+}
+
+bool HALNativeFile::isOpen(void) const noexcept {
+    return 0 <= this->_fd;
+}
+
+bool HALNativeFile::close(void) noexcept {
+    bool isClosed;
+
+    isClosed = false;
+    if (0 <= this->_fd) {
+        isClosed = 0 == ::close(this->_fd);
+        this->_fd = -1;
+    }
+
+    return isClosed;
+}
+
+int HALNativeFile::read(void* pBuffer, const size_t kSize) noexcept {
+    int readSize;
+
+    readSize = (int)::read(this->_fd, pBuffer, kSize);
+    this->_error = (0 > readSize) ? errno : 0;
+
+    return readSize;
+}
+
+size_t HALNativeFile::write(const void* kpBuffer,
+                            const size_t kSize) noexcept {
+    ssize_t written;
+
+    written = ::write(this->_fd, kpBuffer, kSize);
+    this->_error = (0 > written) ? errno : 0;
+
+    return (0 > written) ? 0 : (size_t)written;
+}
+
+bool HALNativeFile::seekSet(const uint64_t kPosition) noexcept {
+    bool isSet;
+
+    isSet = 0 <= lseek(this->_fd, (off_t)kPosition, SEEK_SET);
+    this->_error = isSet ? 0 : errno;
+
+    return isSet;
+}
+
+uint64_t HALNativeFile::size(void) const noexcept {
+    struct stat status;
+    uint64_t    fileSize;
+
+    fileSize = 0;
+    if (0 == fstat(this->_fd, &status)) {
+        fileSize = (uint64_t)status.st_size;
+    }
+
+    return fileSize;
+}
+
+bool HALNativeFile::sync(void) noexcept {
+    bool isSynced;
+
+    isSynced = 0 == fsync(this->_fd);
+    this->_error = isSynced ? 0 : errno;
+
+    return isSynced;
+}
+
+bool HALNativeFile::truncate(const uint64_t kSize) noexcept {
+    bool isTruncated;
+
+    isTruncated = 0 == ftruncate(this->_fd, (off_t)kSize);
+    this->_error = isTruncated ? 0 : errno;
+
+    return isTruncated;
+}
+
+int HALNativeFile::getError(void) const noexcept {
+    return this->_error;
+}
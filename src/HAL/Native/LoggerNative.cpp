@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * @file LoggerNative.cpp
+ *
+ * @see Logger.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Logger, host simulator backend.
+ *
+ * @details Logger, host simulator backend. The logs are formatted and written
+ * synchronously to the standard error of the host, the journals are not
+ * simulated.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <mutex>   /* Standard mutexes */
+#include <cstdio>  /* Standard error stream */
+#include <cstdlib> /* abort */
+#include <cstdarg> /* Variadic arguments */
+#include <cstdint> /* Standard Int Types */
+#include <HAL.h>   /* Hardware abstraction layer */
+
+/* Header file */
+#include <Logger.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+#ifndef LOGGER_NATIVE_PANIC_ABORT
+/**
+ * @brief Set to 1 to abort the simulator on critical logs, the target
+ * reboots.
+ */
+#define LOGGER_NATIVE_PANIC_ABORT 1
+#endif
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The levels tags, by level. */
+static const char* spkLevelTags[] = {
+    "CRITICAL",
+    "ERROR",
+    "INFO",
+    "DEBUG"
+};
+
+/** @brief Serializes the lines of the tasks. */
+static std::mutex sOutputLock;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+Logger* Logger::_SPINSTANCE = nullptr;
+
+Logger* Logger::GetInstance(void) noexcept {
+    if (nullptr == Logger::_SPINSTANCE) {
+        Logger::_SPINSTANCE = new Logger();
+    }
+
+    return Logger::_SPINSTANCE;
+}
+
+void Logger::LogLevel(const E_LogLevel  kLevel,
+                      const E_LogModule kModule,
+                      const char*       pkFile,
+                      const uint32_t    kLine,
+                      const char*       pkStr,
+                      ...) noexcept
+{
+    va_list argptr;
+    bool    isEnabled;
+
+    /* Critical logs are never filtered */
+    isEnabled = (LOG_LEVEL_CRITICAL == kLevel);
+    if (!isEnabled && LOG_LEVEL >= kLevel && LOG_MODULE_MAX > kModule) {
+        isEnabled = (this->_moduleLevels[kModule].load(
+            std::memory_order_relaxed
+        ) >= kLevel);
+    }
+
+    if (isEnabled) {
+        std::lock_guard<std::mutex> guard(sOutputLock);
+
+        fprintf(
+            stderr,
+            "[%llu][%s] %s:%u ",
+            (unsigned long long)(HAL::GetTime() / 1000000ULL),
+            spkLevelTags[kLevel],
+            pkFile,
+            kLine
+        );
+        va_start(argptr, pkStr);
+        vfprintf(stderr, pkStr, argptr);
+        va_end(argptr);
+
+#if LOGGER_NATIVE_PANIC_ABORT
+        if (LOG_LEVEL_CRITICAL == kLevel) {
+            fflush(stderr);
+            abort();
+        }
+#endif
+    }
+}
+
+void Logger::SetModuleLevel(const E_LogModule kModule,
+                            const E_LogLevel  kLevel) noexcept {
+    E_LogLevel level;
+
+    if (LOG_MODULE_MAX > kModule) {
+        /* Compiled out logs cannot be enabled */
+        level = kLevel;
+        if (LogModuleLevel(kModule) < level) {
+            level = LogModuleLevel(kModule);
+        }
+        this->_moduleLevels[kModule].store(
+            (uint8_t)level,
+            std::memory_order_relaxed
+        );
+    }
+}
+
+E_LogLevel Logger::GetModuleLevel(const E_LogModule kModule) const noexcept {
+    E_LogLevel level;
+
+    level = LOG_LEVEL_CRITICAL;
+    if (LOG_MODULE_MAX > kModule) {
+        level = (E_LogLevel)this->_moduleLevels[kModule].load(
+            std::memory_order_relaxed
+        );
+    }
+
+    return level;
+}
+
+void Logger::Flush(void) noexcept {
+    std::lock_guard<std::mutex> guard(sOutputLock);
+
+    fflush(stderr);
+}
+
+Logger::Logger() noexcept
+{
+    uint8_t module;
+
+    for (module = 0; LOG_MODULE_MAX > module; ++module) {
+        this->_moduleLevels[module].store(
+            (uint8_t)LogModuleLevel((E_LogModule)module),
+            std::memory_order_relaxed
+        );
+    }
+#if LOGGER_ASYNC_ENABLED
+    this->_writerTaskHandle = nullptr;
+#endif
+}
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ * @file StorageNative.cpp
+ *
+ * @see Storage.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Storage manager, host simulator backend.
+ *
+ * @details Storage manager, host simulator backend. The files are stored in
+ * the HAL_NATIVE_STORAGE_ROOT directory of the host, created on first use.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_BSP
+
+#include <string>        /* Standard strings */
+#include <cstdio>        /* remove */
+#include <cerrno>        /* Host error numbers */
+#include <dirent.h>      /* Host directories */
+#include <sys/stat.h>    /* mkdir */
+#include <HAL.h>         /* Hardware abstraction layer */
+#include <Logger.h>      /* Logger services */
+#include <SystemState.h> /* System state object */
+
+/* Header File */
+#include <Storage.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+Storage::Storage(void) noexcept {
+    /* Create the bus lock, the simulated mutexes are recursive */
+    this->_busDepth = 0;
+    this->_busLock = HAL::CreateMutex();
+    if (nullptr == this->_busLock) {
+        PANIC("Failed to create the storage bus lock.\n");
+    }
+
+    this->_sdCard.root = HAL_NATIVE_STORAGE_ROOT;
+    if (0 != mkdir(this->_sdCard.root.c_str(), 0755) && EEXIST != errno) {
+        PANIC(
+            "Failed to create the storage directory %s.\n",
+            this->_sdCard.root.c_str()
+        );
+    }
+
+    SystemState::GetInstance()->SetStorage(this);
+}
+
+Storage::~Storage(void) noexcept {
+    PANIC("Tried to destroy the Storage Manager.\n");
+}
+
+T_HALFile Storage::Open(const char* kpPath, const oflag_t kpMode) noexcept {
+    T_HALFile   file;
+    std::string path;
+
+    if (E_Return::NO_ERROR == AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        path = this->_sdCard.root + "/" + kpPath;
+        file.open(path.c_str(), kpMode);
+        ReleaseSPIBus();
+    }
+
+    return file;
+}
+
+bool Storage::Remove(const char* kpPath) noexcept {
+    std::string path;
+    bool        success;
+
+    success = false;
+    if (E_Return::NO_ERROR == AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        path = this->_sdCard.root + "/" + kpPath;
+        success = 0 == remove(path.c_str());
+        ReleaseSPIBus();
+    }
+
+    return success;
+}
+
+void Storage::Format(void) noexcept {
+    DIR*           pDir;
+    struct dirent* pEntry;
+    std::string    path;
+
+    if (E_Return::NO_ERROR == AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        pDir = opendir(this->_sdCard.root.c_str());
+        if (nullptr == pDir) {
+            PANIC("Failed to format the storage directory.\n");
+        }
+        else {
+            pEntry = readdir(pDir);
+            while (nullptr != pEntry) {
+                if (DT_REG == pEntry->d_type) {
+                    path = this->_sdCard.root + "/" + pEntry->d_name;
+                    (void)remove(path.c_str());
+                }
+                pEntry = readdir(pDir);
+            }
+            closedir(pDir);
+        }
+        ReleaseSPIBus();
+    }
+    else {
+        PANIC("Failed to acquire the storage bus.\n");
+    }
+}
+
+E_Return Storage::AcquireSPIBus(const uint64_t kTimeoutNs) noexcept {
+    E_Return error;
+
+    if (HAL::TakeMutex(this->_busLock, kTimeoutNs)) {
+        ++this->_busDepth;
+        error = E_Return::NO_ERROR;
+    }
+    else {
+        error = E_Return::ERR_STORAGE_BUS_TIMEOUT;
+    }
+
+    return error;
+}
+
+void Storage::ReleaseSPIBus(void) noexcept {
+    --this->_busDepth;
+
+    if (!HAL::GiveMutex(this->_busLock)) {
+        PANIC("Failed to release the storage bus lock.\n");
+    }
+}
@@ -21,11 +21,15 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_HM
+
 /* Included headers */
-#include <BSP.h>             /* Hardware layer */
+#include <HAL.h>             /* Hardware abstraction layer */
 #include <string>            /* Standard string */
 #include <cstdint>           /* Standard int types */
 #include <Logger.h>          /* Logger services */
+#include <EventBus.h>        /* Subsystems events */
 #include <HealthMonitor.h>   /* Health Monitor definitions */
 
 /* Header file */
@@ -72,6 +76,7 @@
  * CLASS METHODS
  ******************************************************************************/
 HMReporter::HMReporter(const S_HMReporterParam& krParam) noexcept {
+#if !HM_RT_TASK_TICKLESS
     if (0 != krParam.checkPeriodNs % HW_RT_TASK_PERIOD_NS) {
         LOG_ERROR(
             "Check period for %s is not a multiple of the HM period (%lluns).\n",
@@ -79,8 +84,9 @@ HMReporter::HMReporter(const S_HMReporterParam& krParam) noexcept {
             HW_RT_TASK_PERIOD_NS
         );
     }
+#endif
     this->_checkPeriodNs = krParam.checkPeriodNs;
-    this->_nextCheckNs = HWManager::GetTime() + krParam.checkPeriodNs;
+    this->_nextCheckNs = HAL::GetTime() + krParam.checkPeriodNs;
 
     if (0 == krParam.failToDegrade) {
         LOG_ERROR(
@@ -106,12 +112,16 @@ HMReporter::HMReporter(const S_HMReporterParam& krParam) noexcept {
         this->_failBeforeUnhealthy = krParam.failToUnhealthy;
     }
 
-    this->_name = krParam.name;
+    this->_name.assign(krParam.name.c_str(), krParam.name.size());
 
     this->_failCount = 0;
     this->_totalFailCount = 0;
     this->_status = E_HMStatus::HM_DISABLED;
     this->_hasRunningAction = false;
+    this->_checkState.store(HM_CHECK_IDLE);
+    this->_checkStartNs = 0;
+    this->_checkBudgetNs = krParam.checkPeriodNs;
+    this->_timedOutCount = 0;
 
     LOG_DEBUG("HM Reporter %s initialized.\n", this->_name.c_str());
 }
@@ -121,52 +131,147 @@ HMReporter::~HMReporter(void) noexcept {
 }
 
 void HMReporter::HealthCheck(const uint64_t kTime) noexcept {
-    HealthMonitor* pHM;
-    E_Return       result;
-
     if (kTime > this->_nextCheckNs) {
         /* Update next check */
         this->_nextCheckNs += this->_checkPeriodNs;
 
-        if (!PerformCheck()) {
-            /* On failure, increment the fail count */
-            ++this->_failCount;
-            ++this->_totalFailCount;
-            if (!this->_hasRunningAction) {
+        ApplyResult(PerformCheck());
+    }
+}
+
+bool HMReporter::ScheduleCheck(const uint64_t kTime) noexcept {
+    bool isScheduled;
 
-                /* Check if we reached an unhealthy state */
-                if (this->_failBeforeUnhealthy <= this->_failCount) {
-                    this->_status = E_HMStatus::HM_UNHEALTHY;
+    isScheduled = false;
+    if (kTime > this->_nextCheckNs &&
+        HM_CHECK_IDLE == this->_checkState.load()) {
+        /* Update next check */
+        this->_nextCheckNs += this->_checkPeriodNs;
 
-                    /* Execute action, status update will be made next iteration */
-                    this->_hasRunningAction = true;
+        this->_checkStartNs = kTime;
+        this->_checkState.store(HM_CHECK_RUNNING);
+        isScheduled = true;
+    }
 
-                }
-                else if (this->_failBeforeDegraded <= this->_failCount) {
-                    this->_status = E_HMStatus::HM_DEGRADED;
+    return isScheduled;
+}
 
-                    /* Execute action, status update will be made next iteration */
-                    this->_hasRunningAction = true;
-                }
+void HMReporter::ExecuteCheck(void) noexcept {
+    bool    isPassed;
+    uint8_t expected;
+
+    isPassed = PerformCheck();
+
+    /* The result is discarded if the budget was exceeded meanwhile */
+    expected = HM_CHECK_RUNNING;
+    if (this->_checkState.compare_exchange_strong(
+            expected,
+            HM_CHECK_COMPLETING
+        )) {
+        ApplyResult(isPassed);
+    }
+    else {
+        LOG_DEBUG(
+            "Discarded late health check result of %s.\n",
+            this->_name.c_str()
+        );
+    }
+    this->_checkState.store(HM_CHECK_IDLE);
+}
+
+void HMReporter::EnforceCheckBudget(const uint64_t kTime) noexcept {
+    uint8_t expected;
+
+    expected = HM_CHECK_RUNNING;
+    if (kTime - this->_checkStartNs > this->_checkBudgetNs &&
+        HM_CHECK_RUNNING == this->_checkState.load() &&
+        this->_checkState.compare_exchange_strong(
+            expected,
+            HM_CHECK_TIMED_OUT
+        )) {
+        ++this->_timedOutCount;
+        ApplyResult(false);
+    }
+}
+
+void HMReporter::CancelCheck(void) noexcept {
+    this->_checkState.store(HM_CHECK_IDLE);
+}
+
+void HMReporter::CancelAction(void) noexcept {
+    this->_hasRunningAction = false;
+}
 
-                /* Add action if necessary */
-                if (this->_hasRunningAction) {
-                    pHM = SystemState::GetInstance()->GetHealthMonitor();
-                    result = pHM->AddHMAction(this);
-                    if (E_Return::NO_ERROR != result) {
-                        PANIC(
-                            "Failed to add HM reporter action. Error %d\n",
-                            result
-                        );
-                    }
+void HMReporter::SetCheckBudget(const uint64_t kBudgetNs) noexcept {
+    this->_checkBudgetNs = kBudgetNs;
+}
+
+uint32_t HMReporter::GetTimedOutCount(void) const noexcept {
+    return this->_timedOutCount;
+}
+
+void HMReporter::ApplyResult(const bool kIsPassed) noexcept {
+    HealthMonitor* pHM;
+    E_Return       result;
+    E_HMStatus     previous;
+    S_Event        event;
+    bool           isEscalated;
+
+    previous = this->_status;
+    if (!kIsPassed) {
+        /* On failure, increment the fail count */
+        ++this->_failCount;
+        ++this->_totalFailCount;
+
+        /* A degraded reporter turning unhealthy raises its scheduled action */
+        isEscalated = this->_hasRunningAction &&
+                      E_HMStatus::HM_DEGRADED == this->_status &&
+                      this->_failBeforeUnhealthy <= this->_failCount;
+        if (!this->_hasRunningAction || isEscalated) {
+
+            /* Check if we reached an unhealthy state */
+            if (this->_failBeforeUnhealthy <= this->_failCount) {
+                this->_status = E_HMStatus::HM_UNHEALTHY;
+
+                /* Execute action, status update will be made next iteration */
+                this->_hasRunningAction = true;
+
+            }
+            else if (this->_failBeforeDegraded <= this->_failCount) {
+                this->_status = E_HMStatus::HM_DEGRADED;
+
+                /* Execute action, status update will be made next iteration */
+                this->_hasRunningAction = true;
+            }
+
+            /* Add action if necessary */
+            if (this->_hasRunningAction) {
+                pHM = SystemState::GetInstance()->GetHealthMonitor();
+                result = pHM->AddHMAction(this, this->_status);
+                if (E_Return::NO_ERROR != result) {
+                    /* Retried on the next failed check */
+                    LOG_ERROR(
+                        "Failed to add HM reporter action. Error %d\n",
+                        result
+                    );
+                    this->_hasRunningAction = isEscalated;
                 }
             }
         }
-        else {
-            /* No error, reset the status and fail count. */
-            this->_failCount = 0;
-            this->_status = E_HMStatus::HM_HEALTHY;
-        }
+    }
+    else {
+        /* No error, reset the status and fail count. */
+        this->_failCount = 0;
+        this->_status = E_HMStatus::HM_HEALTHY;
+    }
+
+    /* Only the transitions are published */
+    if (previous != this->_status) {
+        event.id                       = E_EventId::EVENT_HM_STATUS;
+        event.data.hmStatus.kpReporter = this;
+        event.data.hmStatus.previous   = previous;
+        event.data.hmStatus.status     = this->_status;
+        EventBus::Publish(event);
     }
 }
 
@@ -194,6 +299,20 @@ uint64_t HMReporter::GetTotalFailureCount(void) const noexcept {
     return this->_totalFailCount;
 }
 
-const std::string& HMReporter::GetName(void) const noexcept {
+const HMString& HMReporter::GetName(void) const noexcept {
     return this->_name;
+}
+
+uint64_t HMReporter::GetNextCheck(void) const noexcept {
+    uint64_t nextCheck;
+
+    /* A busy check is next due when its budget expires */
+    if (HM_CHECK_IDLE == this->_checkState.load()) {
+        nextCheck = this->_nextCheckNs;
+    }
+    else {
+        nextCheck = this->_checkStartNs + this->_checkBudgetNs;
+    }
+
+    return nextCheck;
 }
\ No newline at end of file
@@ -21,14 +21,19 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_HM
+
 /* Included headers */
-#include <BSP.h>             /* Hardware services */
+#include <HAL.h>             /* Hardware abstraction layer */
 #include <string>            /* Standard string */
 #include <cstdint>           /* Standard int types */
+#include <cstring>           /* String manipulation */
+#include <algorithm>         /* Standard heap algorithms */
 #include <Logger.h>          /* Logger services */
-#include <Arduino.h>         /* Arduino library */
-#include <Settings.h>        /* Firmware settings */
-#include <APIHandler.h>      /* API Handler errors */
+#include <TaskRegistry.h>    /* Firmware tasks registry */
+#include <Metrics.h>         /* Metrics counters */
+#include <Tracer.h>          /* Events tracer */
 
 /* Header file */
 #include <HealthMonitor.h>
@@ -38,32 +43,28 @@
  ******************************************************************************/
 /** @brief Defines the real-time task period tolerance in nanoseconds. */
 #define HW_RT_TASK_PERIOD_TOLERANCE_NS 500000ULL
+#if HM_RT_TASK_TICKLESS
+/** @brief Defines the real-time task maximal wait in nanoseconds. */
+#define HW_RT_TASK_MAX_WAIT_NS HM_RT_TASK_MAX_SLEEP_NS
+/** @brief Defines the real-time task wait tolerance, sleeps are rounded up. */
+#define HW_RT_TASK_WAIT_TOLERANCE_NS (3 * HAL_TICK_NS)
+/** @brief Defines the delay before an expired watchdog is checked again. */
+#define HM_WD_REARM_NS HW_RT_TASK_PERIOD_NS
+#else
+/** @brief Defines the real-time task maximal wait in nanoseconds. */
+#define HW_RT_TASK_MAX_WAIT_NS HW_RT_TASK_PERIOD_NS
+/** @brief Defines the real-time task wait tolerance in nanoseconds. */
+#define HW_RT_TASK_WAIT_TOLERANCE_NS HW_RT_TASK_PERIOD_TOLERANCE_NS
+/** @brief Defines the delay before an expired watchdog is checked again. */
+#define HM_WD_REARM_NS 0
+#endif
 /** @brief Real-time task watchdog timeout in nanoseconds. */
-#define HW_RT_TASK_WD_TIMEOUT_NS (2 * HW_RT_TASK_PERIOD_NS)
-
-/** @brief Hardware Real-Time Task name. */
-#define HW_RT_TASK_NAME "HW-RT_TASK"
-/** @brief Hardware Real-Time Task stack size in bytes. */
-#define HW_RT_TASK_STACK 4096
-/** @brief Hardware Real-Time Task priority. */
-#define HW_RT_TASK_PRIO (configMAX_PRIORITIES - 1)
-/** @brief Hardware Real-Time Task mapped core ID. */
-#define HW_RT_TASK_CORE 0
+#define HW_RT_TASK_WD_TIMEOUT_NS (2 * HW_RT_TASK_MAX_WAIT_NS)
+
+/** @brief Defines the identifier of the unpublished registry slots. */
+#define HM_INVALID_ID UINT32_MAX
 /** @brief Defines the watchdogs lock timeout in nanoseconds. */
 #define WD_LOCK_TIMEOUT_NS 1000000ULL
-/** @brief Defines the watchdogs lock timeout in ticks. */
-#define WD_LOCK_TIMEOUT_TICKS (pdMS_TO_TICKS(WD_LOCK_TIMEOUT_NS / 1000000ULL))
-
-/** @brief Actions Task name. */
-#define HM_ACTIONS_TASK_NAME "HM_ACTIONS_TASK"
-/** @brief Actions Task stack size in bytes. */
-#define HM_ACTIONS_TASK_STACK 4096
-/** @brief Actions Task priority. */
-#define HM_ACTIONS_TASK_PRIO (configMAX_PRIORITIES - 2)
-/** @brief Actions Task mapped core ID. */
-#define HM_ACTIONS_TASK_CORE 0
-/** @brief Defines the size of the actions queue. */
-#define HM_ACTIONS_TASK_QUEUE_LENGTH 10
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
@@ -78,7 +79,14 @@
 /*******************************************************************************
  * STATIC FUNCTIONS DECLARATIONS
  ******************************************************************************/
-/* None */
+/**
+ * @brief Returns the scheduling rank of a HM action severity.
+ *
+ * @param[in] kSeverity The health status that triggered the action.
+ *
+ * @return The rank of the severity, higher is more urgent.
+ */
+static uint8_t GetActionRank(const E_HMStatus kSeverity) noexcept;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -96,21 +104,66 @@
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
-/* None */
+static uint8_t GetActionRank(const E_HMStatus kSeverity) noexcept {
+    uint8_t rank;
+
+    if (E_HMStatus::HM_UNHEALTHY == kSeverity) {
+        rank = 2;
+    }
+    else if (E_HMStatus::HM_DEGRADED == kSeverity) {
+        rank = 1;
+    }
+    else {
+        rank = 0;
+    }
+
+    return rank;
+}
 
 /*******************************************************************************
  * CLASS METHODS
  ******************************************************************************/
 
 HealthMonitor::HealthMonitor(void) noexcept {
+    uint32_t i;
+
     this->_lastWDId = 0;
     this->_lastReporterId = 0;
+    this->_RTTaskHandle = nullptr;
 
-    this->_wdLock = xSemaphoreCreateMutex();
+    /* Initialize the registries */
+    for (i = 0; HM_MAX_WATCHDOGS > i; ++i) {
+        this->_wdSlots[i].pTimeout.store(nullptr);
+        this->_wdSlots[i].id.store(HM_INVALID_ID);
+    }
+    for (i = 0; HM_WD_PENDING_WORDS > i; ++i) {
+        this->_wdPending[i].store(0);
+    }
+    for (i = 0; HM_MAX_REPORTERS > i; ++i) {
+        this->_reporterSlots[i].pReporter.store(nullptr);
+        this->_reporterSlots[i].id.store(HM_INVALID_ID);
+    }
+    this->_wdEventsCount = 0;
+    this->_checkSequence.store(0);
+    this->_checkingSlot.store(HM_MAX_REPORTERS);
+
+    /* Initialize the actions scheduler */
+    HAL::InitSpinLock(this->_actionsLock);
+    this->_pendingActionsCount = 0;
+    this->_actionsSequence = 0;
+    this->_pRunningAction = nullptr;
+    memset(&this->_actionStats, 0, sizeof(this->_actionStats));
+
+    /* Initialize the checks accounting */
+    HAL::InitSpinLock(this->_checkStatsLock);
+    memset(&this->_checkStats, 0, sizeof(this->_checkStats));
+    this->_checkStats.minCycles = UINT32_MAX;
+
+    this->_wdLock = HAL::CreateMutex();
     if (nullptr == this->_wdLock) {
         PANIC("Failed to initialize Health Monitor Watchdogs lock.\n");
     }
-    this->_reportersLock = xSemaphoreCreateMutex();
+    this->_reportersLock = HAL::CreateMutex();
     if (nullptr == this->_reportersLock) {
         PANIC("Failed to initialize Health Monitor Reporters lock.\n");
     }
@@ -118,7 +171,8 @@ HealthMonitor::HealthMonitor(void) noexcept {
     /* Add to system state */
     SystemState::GetInstance()->SetHealthMonitor(this);
 
-    /* Initialize the HM tasks */
+    /* Initialize the HM tasks, checks are scheduled by the real-time task */
+    ChecksTaskInit();
     RealTimeTaskInit();
     ActionsTaskInit();
 
@@ -131,34 +185,43 @@ HealthMonitor::~HealthMonitor(void) noexcept {
 
 E_Return HealthMonitor::AddWatchdog(Timeout* pTimeout, uint32_t& rId) noexcept {
     E_Return error;
+    uint32_t slot;
 
     LOG_DEBUG("Adding HM watchdog.\n");
 
     /* Check settings */
     if (0 != pTimeout->GetNextWatchdogEvent()) {
-        if (pdPASS == xSemaphoreTake(this->_wdLock, WD_LOCK_TIMEOUT_TICKS)) {
-            if (this->_lastWDId < UINT32_MAX) {
-                try {
-                    this->_watchdogs.emplace(
-                        std::make_pair(this->_lastWDId, pTimeout)
-                    );
-                    rId = this->_lastWDId++;
-                    error = E_Return::NO_ERROR;
-                }
-                catch (std::exception& rExc) {
-                    LOG_ERROR(
-                        "Failed to add HM watchdog. Error %s.\n",
-                        rExc.what()
-                    );
-                    error = E_Return::ERR_UNKNOWN;
+        if (HAL::TakeMutex(this->_wdLock, WD_LOCK_TIMEOUT_NS)) {
+            /* Find a free slot */
+            slot = 0;
+            while (HM_MAX_WATCHDOGS > slot &&
+                   nullptr != this->_wdSlots[slot].pTimeout.load()) {
+                ++slot;
+            }
+
+            if (HM_INVALID_ID > this->_lastWDId &&
+                HM_MAX_WATCHDOGS > slot) {
+                /* Publish the slot, the real-time task schedules it */
+                this->_wdSlots[slot].pTimeout.store(pTimeout);
+                this->_wdSlots[slot].id.store(this->_lastWDId);
+                this->_wdPending[slot / 32].fetch_or(1UL << (slot % 32));
+
+                rId = this->_lastWDId++;
+                error = E_Return::NO_ERROR;
+
+#if HM_RT_TASK_TICKLESS
+                /* Reschedule the real-time task wake up */
+                if (nullptr != this->_RTTaskHandle) {
+                    HAL::NotifyTask(this->_RTTaskHandle);
                 }
+#endif
             }
             else {
                 LOG_ERROR("Failed to add HM watchdog. No more memory.\n");
                 error = E_Return::ERR_MEMORY;
             }
 
-            if (pdPASS != xSemaphoreGive(this->_wdLock)) {
+            if (!HAL::GiveMutex(this->_wdLock)) {
                 PANIC("Failed to release the HM watchdog lock.\n");
             }
         }
@@ -176,32 +239,33 @@ E_Return HealthMonitor::AddWatchdog(Timeout* pTimeout, uint32_t& rId) noexcept {
 }
 
 E_Return HealthMonitor::RemoveWatchdog(const uint32_t kId) noexcept {
-    E_Return                                         error;
-    std::unordered_map<uint32_t, Timeout*>::iterator it;
+    E_Return error;
+    uint32_t slot;
 
     LOG_DEBUG("Removing HM watchdog %d.\n", kId);
 
-    if (pdPASS == xSemaphoreTake(this->_wdLock, WD_LOCK_TIMEOUT_TICKS)) {
-        it = this->_watchdogs.find(kId);
-        if (this->_watchdogs.end() != it) {
-            try {
-                this->_watchdogs.erase(it);
-                error = E_Return::NO_ERROR;
-            }
-            catch (std::exception& rExc) {
-                LOG_ERROR(
-                    "Failed to remove HM watchdog. Error %s.\n",
-                    rExc.what()
-                );
-                error = E_Return::ERR_UNKNOWN;
-            }
+    if (HAL::TakeMutex(this->_wdLock, WD_LOCK_TIMEOUT_NS)) {
+        slot = 0;
+        while (HM_MAX_WATCHDOGS > slot &&
+               (HM_INVALID_ID == kId ||
+                kId != this->_wdSlots[slot].id.load())) {
+            ++slot;
+        }
+
+        if (HM_MAX_WATCHDOGS > slot) {
+            /* Unpublish, the scheduled events are discarded when expired */
+            this->_wdSlots[slot].id.store(HM_INVALID_ID);
+            WaitChecksDone();
+            this->_wdSlots[slot].pTimeout.store(nullptr);
+
+            error = E_Return::NO_ERROR;
         }
         else {
             LOG_ERROR("Failed to remove HM watchdog. No such ID.\n");
             error = E_Return::ERR_NO_SUCH_ID;
         }
 
-        if (pdPASS != xSemaphoreGive(this->_wdLock)) {
+        if (!HAL::GiveMutex(this->_wdLock)) {
             PANIC("Failed to release the HM watchdog lock.\n");
         }
     }
@@ -216,33 +280,41 @@ E_Return HealthMonitor::RemoveWatchdog(const uint32_t kId) noexcept {
 E_Return HealthMonitor::AddReporter(HMReporter* pReporter,
                                     uint32_t&   rId) noexcept {
     E_Return error;
+    uint32_t slot;
 
     LOG_DEBUG("Adding HM reporter.\n");
 
     /* Check settings */
-    if (pdPASS == xSemaphoreTake(this->_reportersLock, WD_LOCK_TIMEOUT_TICKS)) {
-        if (this->_lastReporterId < UINT32_MAX) {
-            try {
-                this->_reporters.emplace(
-                    std::make_pair(this->_lastReporterId, pReporter)
-                );
-                rId = this->_lastReporterId++;
-                error = E_Return::NO_ERROR;
-            }
-            catch (std::exception& rExc) {
-                LOG_ERROR(
-                    "Failed to add HM reporter. Error %s.\n",
-                    rExc.what()
-                );
-                error = E_Return::ERR_UNKNOWN;
+    if (HAL::TakeMutex(this->_reportersLock, WD_LOCK_TIMEOUT_NS)) {
+        /* Find a free slot */
+        slot = 0;
+        while (HM_MAX_REPORTERS > slot &&
+               nullptr != this->_reporterSlots[slot].pReporter.load()) {
+            ++slot;
+        }
+
+        if (HM_INVALID_ID > this->_lastReporterId &&
+            HM_MAX_REPORTERS > slot) {
+            /* Publish the slot */
+            this->_reporterSlots[slot].pReporter.store(pReporter);
+            this->_reporterSlots[slot].id.store(this->_lastReporterId);
+
+            rId = this->_lastReporterId++;
+            error = E_Return::NO_ERROR;
+
+#if HM_RT_TASK_TICKLESS
+            /* Reschedule the real-time task wake up */
+            if (nullptr != this->_RTTaskHandle) {
+                HAL::NotifyTask(this->_RTTaskHandle);
             }
+#endif
         }
         else {
             LOG_ERROR("Failed to add HM reporter. No more memory.\n");
             error = E_Return::ERR_MEMORY;
         }
 
-        if (pdPASS != xSemaphoreGive(this->_reportersLock)) {
+        if (!HAL::GiveMutex(this->_reportersLock)) {
             PANIC("Failed to release the HM reporter lock.\n");
         }
     }
@@ -255,25 +327,34 @@ E_Return HealthMonitor::AddReporter(HMReporter* pReporter,
 }
 
 E_Return HealthMonitor::RemoveReporter(const uint32_t kId) noexcept {
-    E_Return                                            error;
-    std::unordered_map<uint32_t, HMReporter*>::iterator it;
+    E_Return    error;
+    uint32_t    slot;
+    HMReporter* pReporter;
 
     LOG_DEBUG("Removing HM reporter %d.\n", kId);
 
-    if (pdPASS == xSemaphoreTake(this->_reportersLock, WD_LOCK_TIMEOUT_TICKS)) {
-        it = this->_reporters.find(kId);
-        if (this->_reporters.end() != it) {
-            try {
-                this->_reporters.erase(it);
-                error = E_Return::NO_ERROR;
-            }
-            catch (std::exception& rExc) {
-                LOG_ERROR(
-                    "Failed to remove HM reporter. Error %s.\n",
-                    rExc.what()
-                );
-                error = E_Return::ERR_UNKNOWN;
+    if (HAL::TakeMutex(this->_reportersLock, WD_LOCK_TIMEOUT_NS)) {
+        slot = 0;
+        while (HM_MAX_REPORTERS > slot &&
+               (HM_INVALID_ID == kId ||
+                kId != this->_reporterSlots[slot].id.load())) {
+            ++slot;
+        }
+
+        if (HM_MAX_REPORTERS > slot) {
+            /* Unpublish and wait for the HM tasks to release it */
+            this->_reporterSlots[slot].id.store(HM_INVALID_ID);
+            WaitChecksDone();
+            while (slot == this->_checkingSlot.load()) {
+                HAL::Sleep(HAL_TICK_NS);
             }
+            pReporter = this->_reporterSlots[slot].pReporter.load();
+            pReporter->CancelCheck();
+            CancelHMAction(pReporter);
+            pReporter->CancelAction();
+            this->_reporterSlots[slot].pReporter.store(nullptr);
+
+            error = E_Return::NO_ERROR;
         }
         else {
             LOG_ERROR(
@@ -281,7 +362,7 @@ E_Return HealthMonitor::RemoveReporter(const uint32_t kId) noexcept {
             error = E_Return::ERR_NO_SUCH_ID;
         }
 
-        if (pdPASS != xSemaphoreGive(this->_reportersLock)) {
+        if (!HAL::GiveMutex(this->_reportersLock)) {
             PANIC("Failed to release the HM reporter lock.\n");
         }
     }
@@ -293,188 +374,604 @@ E_Return HealthMonitor::RemoveReporter(const uint32_t kId) noexcept {
     return error;
 }
 
-E_Return HealthMonitor::AddHMAction(HMReporter* pReporter) noexcept {
-    BaseType_t result;
-    E_Return   retVal;
+E_Return HealthMonitor::AddHMAction(HMReporter*      pReporter,
+                                    const E_HMStatus kSeverity) noexcept {
+    E_Return retVal;
+    uint32_t i;
 
     LOG_DEBUG("Adding HM Action.\n");
 
-    /* Place the action in the actions queue */
-    result = xQueueSend(this->_actionsQueue, (void*)&pReporter, 0);
-    if (pdPASS != result) {
-        LOG_ERROR("Failed to add HM action. Action queue is full.\n");
-        /* We should never have too many actions */
+    HAL::EnterCritical(this->_actionsLock);
+
+    /* Merge with the pending action of the reporter if any */
+    i = 0;
+    while (this->_pendingActionsCount > i &&
+           pReporter != this->_pendingActions[i].pReporter) {
+        ++i;
+    }
+
+    if (this->_pendingActionsCount > i) {
+        if (GetActionRank(kSeverity) >
+            GetActionRank(this->_pendingActions[i].severity)) {
+            this->_pendingActions[i].severity = kSeverity;
+        }
+        ++this->_actionStats.coalesced;
+        retVal = E_Return::NO_ERROR;
+    }
+    else if (HM_MAX_PENDING_ACTIONS > this->_pendingActionsCount) {
+        this->_pendingActions[i].pReporter = pReporter;
+        this->_pendingActions[i].severity = kSeverity;
+        this->_pendingActions[i].sequence = this->_actionsSequence++;
+        ++this->_pendingActionsCount;
+        retVal = E_Return::NO_ERROR;
+    }
+    else {
+        ++this->_actionStats.dropped;
         retVal = E_Return::ERR_HM_FULL;
     }
+
+    HAL::ExitCritical(this->_actionsLock);
+
+    if (E_Return::NO_ERROR == retVal) {
+        HAL::NotifyTask(this->_actionsTaskHandle);
+    }
     else {
-        retVal = E_Return::NO_ERROR;
+        LOG_ERROR("Failed to add HM action. Too many pending actions.\n");
     }
 
     return retVal;
 }
 
+void HealthMonitor::GetActionStats(S_HMActionStats& rStats) noexcept {
+    HAL::EnterCritical(this->_actionsLock);
+    rStats = this->_actionStats;
+    rStats.pending = this->_pendingActionsCount;
+    rStats.running = (nullptr != this->_pRunningAction) ? 1 : 0;
+    HAL::ExitCritical(this->_actionsLock);
+}
+
+void HealthMonitor::GetCheckStats(S_HMCheckStats& rStats,
+                                  const bool      kReset) noexcept {
+    HAL::EnterCritical(this->_checkStatsLock);
+    rStats = this->_checkStats;
+    if (kReset) {
+        this->_checkStats.count = 0;
+        this->_checkStats.minCycles = UINT32_MAX;
+        this->_checkStats.maxCycles = 0;
+        this->_checkStats.totalCycles = 0;
+        this->_checkStats.droppedChecks = 0;
+    }
+    HAL::ExitCritical(this->_checkStatsLock);
+}
+
+uint32_t HealthMonitor::GetReportersStatus(S_HMReporterStatus* pStatus,
+                                           const uint32_t      kMaxCount)
+noexcept {
+    HMReporter* pReporter;
+    uint32_t    count;
+    uint32_t    i;
+
+    count = 0;
+    if (HAL::TakeMutex(this->_reportersLock, WD_LOCK_TIMEOUT_NS)) {
+        /* The lock keeps the reporters registered while they are read */
+        for (i = 0; HM_MAX_REPORTERS > i && kMaxCount > count; ++i) {
+            pReporter = this->_reporterSlots[i].pReporter.load();
+            if (HM_INVALID_ID != this->_reporterSlots[i].id.load() &&
+                nullptr != pReporter) {
+                strncpy(
+                    pStatus[count].pName,
+                    pReporter->GetName().c_str(),
+                    HM_REPORTER_NAME_SIZE - 1
+                );
+                pStatus[count].pName[HM_REPORTER_NAME_SIZE - 1] = 0;
+                pStatus[count].status = pReporter->GetStatus();
+                pStatus[count].failures = pReporter->GetFailureCount();
+                pStatus[count].totalFailures =
+                    pReporter->GetTotalFailureCount();
+                ++count;
+            }
+        }
+
+        if (!HAL::GiveMutex(this->_reportersLock)) {
+            PANIC("Failed to release the HM reporter lock.\n");
+        }
+    }
+    else {
+        LOG_ERROR("Failed to acquire reporters lock.\n");
+    }
+
+    return count;
+}
+
+bool HealthMonitor::PopHMAction(HMReporter*& rpReporter) noexcept {
+    uint32_t i;
+    uint32_t selected;
+    uint8_t  rank;
+    uint8_t  selectedRank;
+    bool     isPending;
+
+    HAL::EnterCritical(this->_actionsLock);
+
+    isPending = (0 != this->_pendingActionsCount);
+    if (isPending) {
+        /* Highest severity first, then oldest */
+        selected = 0;
+        selectedRank = GetActionRank(this->_pendingActions[0].severity);
+        for (i = 1; this->_pendingActionsCount > i; ++i) {
+            rank = GetActionRank(this->_pendingActions[i].severity);
+            if (rank > selectedRank ||
+                (rank == selectedRank &&
+                 (int32_t)(this->_pendingActions[i].sequence -
+                           this->_pendingActions[selected].sequence) < 0)) {
+                selected = i;
+                selectedRank = rank;
+            }
+        }
+
+        rpReporter = this->_pendingActions[selected].pReporter;
+        this->_pRunningAction = rpReporter;
+
+        /* Order is kept by the sequence, compact with the last entry */
+        --this->_pendingActionsCount;
+        this->_pendingActions[selected] =
+            this->_pendingActions[this->_pendingActionsCount];
+    }
+
+    HAL::ExitCritical(this->_actionsLock);
+
+    return isPending;
+}
+
+void HealthMonitor::CancelHMAction(const HMReporter* pReporter) noexcept {
+    uint32_t i;
+    bool     isRunning;
+
+    HAL::EnterCritical(this->_actionsLock);
+    i = 0;
+    while (this->_pendingActionsCount > i &&
+           pReporter != this->_pendingActions[i].pReporter) {
+        ++i;
+    }
+    if (this->_pendingActionsCount > i) {
+        --this->_pendingActionsCount;
+        this->_pendingActions[i] =
+            this->_pendingActions[this->_pendingActionsCount];
+    }
+    isRunning = (pReporter == this->_pRunningAction);
+    HAL::ExitCritical(this->_actionsLock);
+
+    /* Wait for the running action to end */
+    while (isRunning) {
+        HAL::Sleep(HAL_TICK_NS);
+        HAL::EnterCritical(this->_actionsLock);
+        isRunning = (pReporter == this->_pRunningAction);
+        HAL::ExitCritical(this->_actionsLock);
+    }
+}
+
 void HealthMonitor::RealTimeTaskRoutine(void* pHealthMonitor) noexcept {
-    BaseType_t     result;
+    bool           isDelayed;
     HealthMonitor* pHM;
-    TickType_t     lastWakeTime;
+    T_HALTick      lastWakeTime;
+    uint64_t       nextEvent;
+    uint64_t       currentTime;
+    uint32_t       startCycles;
 
     /* Get HM instance */
     pHM = (HealthMonitor*)pHealthMonitor;
 
     /* First tick */
     pHM->_pTimeout->Notify();
-    lastWakeTime = xTaskGetTickCount();
+    lastWakeTime = HAL::GetTick();
 
     while (true) {
+        TRACE_BEGIN(E_TraceEvent::TRACE_HM_RT_TASK);
+
+        /* The cycle time is read once and passed down */
+        currentTime = HAL::GetTime();
+
         /* Manage deadline miss */
-        if (pHM->_pTimeout->HasTimedOut()) {
+        if (pHM->_pTimeout->HasTimedOut(currentTime)) {
             PANIC("HM RT task deadline miss.\n");
         }
-        pHM->_pTimeout->Notify();
+        pHM->_pTimeout->Notify(currentTime);
+
+        /* Perform HM checks, removals wait for the sequence to be even */
+        pHM->_checkSequence.fetch_add(1);
+        startCycles = HAL::GetCycleCount();
+        nextEvent = pHM->CheckWatchdogs(currentTime);
+        pHM->AccountCheck(HAL::GetCycleCount() - startCycles);
+        nextEvent = std::min(nextEvent, pHM->CheckReporters(currentTime));
+        pHM->_checkSequence.fetch_add(1);
+#if HM_RT_TASK_TICKLESS
+        pHM->_pTimeout->SetWakeDeadline(
+            std::min(
+                nextEvent,
+                currentTime + (uint64_t)HM_RT_TASK_MAX_SLEEP_NS
+            )
+        );
+#endif
+        pHM->_pTimeout->NotifyEnd();
+        TRACE_END(E_TraceEvent::TRACE_HM_RT_TASK);
+
+#if HM_RT_TASK_TICKLESS
+        /* Wait for the next deadline */
+        (void)isDelayed;
+        (void)lastWakeTime;
+        pHM->WaitNextEvent(nextEvent);
+#else
+        /* Wait for period */
+        (void)nextEvent;
+        isDelayed = HAL::DelayUntil(lastWakeTime, HW_RT_TASK_PERIOD_NS);
+        if (!isDelayed) {
+            PANIC("HM RT task periodic wait failed.\n");
+        }
+#endif
+    }
+}
 
-        /* Perform HM checks */
-        pHM->CheckWatchdogs();
-        pHM->CheckReporters();
+void HealthMonitor::HMChecksTaskRoutine(void* pHealthMonitor) noexcept {
+    HealthMonitor*   pHM;
+    HMReporter*      pReporter;
+    S_HMCheckRequest request;
+    bool             isReceived;
 
-        /* Wait for period */
-        result = xTaskDelayUntil(
-            &lastWakeTime,
-            HW_RT_TASK_PERIOD_NS / 1000000 / portTICK_PERIOD_MS
+    pHM = (HealthMonitor*)pHealthMonitor;
+
+    while (true) {
+        /* Get the next check */
+        isReceived = HAL::ReceiveQueue(
+            pHM->_checksQueue,
+            (void*)&request,
+            HAL_WAIT_FOREVER
         );
-        if (pdPASS != result) {
-            PANIC("HM RT task periodic wait failed. Error %d\n", result);
+
+        if (!isReceived) {
+            PANIC("Failed to retrieve HM check from queue.\n");
         }
+
+        /* Announce the slot, then check the reporter was not removed */
+        pHM->_checkingSlot.store(request.slot);
+        if (request.id == pHM->_reporterSlots[request.slot].id.load()) {
+            pReporter = pHM->_reporterSlots[request.slot].pReporter.load();
+            pReporter->ExecuteCheck();
+        }
+        pHM->_checkingSlot.store(HM_MAX_REPORTERS);
+
+        pHM->PublishHealth();
     }
 }
 
+void HealthMonitor::PublishHealth(void) noexcept {
+    S_LiveHealth health;
+    HMReporter*  pReporter;
+    E_HMStatus   status;
+    uint32_t     id;
+    uint32_t     i;
+
+    memset(&health, 0, sizeof(S_LiveHealth));
+    health.status = E_HMStatus::HM_HEALTHY;
+    for (i = 0; HM_MAX_REPORTERS > i; ++i) {
+        id = this->_reporterSlots[i].id.load();
+        if (HM_INVALID_ID != id) {
+            /* Same protocol as the checks, removals wait for the slot */
+            this->_checkingSlot.store(i);
+            if (id == this->_reporterSlots[i].id.load()) {
+                pReporter = this->_reporterSlots[i].pReporter.load();
+                status = pReporter->GetStatus();
+                ++health.pCounts[status];
+                if (E_HMStatus::HM_DISABLED != status &&
+                    health.status < status) {
+                    health.status = status;
+                }
+            }
+            this->_checkingSlot.store(HM_MAX_REPORTERS);
+        }
+    }
+    health.time = HAL::GetTime();
+
+    SystemState::GetInstance()->PublishHealth(health);
+}
+
 void HealthMonitor::HMActionTaskRoutine(void* pHealthMonitor) noexcept {
     HealthMonitor* pHM;
     HMReporter*    pReporter;
-    BaseType_t     result;
 
     pHM = (HealthMonitor*)pHealthMonitor;
 
     while (true) {
-        /* Get the next job */
-        result = xQueueReceive(
-            pHM->_actionsQueue,
-            (void*)&pReporter,
-            portMAX_DELAY
+        /* Wait for actions, notifications are accumulated */
+        (void)HAL::WaitNotify(HAL_WAIT_FOREVER);
+
+        /* Execute all the pending actions by priority */
+        while (pHM->PopHMAction(pReporter)) {
+            TRACE_BEGIN(E_TraceEvent::TRACE_HM_ACTION);
+            pReporter->ExecuteAction();
+            TRACE_END(E_TraceEvent::TRACE_HM_ACTION);
+
+            HAL::EnterCritical(pHM->_actionsLock);
+            pHM->_pRunningAction = nullptr;
+            ++pHM->_actionStats.executed;
+            HAL::ExitCritical(pHM->_actionsLock);
+        }
+    }
+}
+
+uint64_t HealthMonitor::CheckWatchdogs(const uint64_t kTime) noexcept {
+    uint64_t        nextEvent;
+    S_WatchdogEvent event;
+    Timeout*        pTimeout;
+    uint32_t        pending;
+    uint32_t        word;
+
+    /* Schedule the newly published watchdogs */
+    for (word = 0; HM_WD_PENDING_WORDS > word; ++word) {
+        pending = this->_wdPending[word].exchange(0);
+        while (0 != pending) {
+            event.slot = word * 32 + __builtin_ctz(pending);
+            event.id = this->_wdSlots[event.slot].id.load();
+            pTimeout = GetEventTimeout(event);
+            if (nullptr != pTimeout) {
+                event.deadline = pTimeout->GetNextWatchdogEvent();
+                ScheduleWatchdogEvent(event);
+            }
+            pending &= pending - 1;
+        }
+    }
+
+    /* Only visit the expired entries, earliest deadline first */
+    while (0 != this->_wdEventsCount &&
+           this->_wdEvents[0].deadline < kTime) {
+        std::pop_heap(
+            this->_wdEvents,
+            this->_wdEvents + this->_wdEventsCount,
+            IsLaterWatchdogEvent
         );
+        event = this->_wdEvents[--this->_wdEventsCount];
+
+        pTimeout = GetEventTimeout(event);
+        if (nullptr != pTimeout) {
+            /* Check for dealine miss, the timeout may have been notified
+             * since the entry was scheduled.
+             */
+            nextEvent = pTimeout->GetNextWatchdogEvent();
+            if (nextEvent < kTime) {
+                pTimeout->ExecuteHandler();
+                Metrics::Add(METRIC_WATCHDOG_MISSES, 1);
+
+                /* Check again on the next period until notified */
+                nextEvent = kTime + HM_WD_REARM_NS;
+            }
 
-        if (pdPASS != result) {
-            PANIC("Failed to retrieve HM Action from queue.\n");
+            event.deadline = nextEvent;
+            ScheduleWatchdogEvent(event);
         }
+    }
 
-        /* Execute the action */
-        pReporter->ExecuteAction();
+    nextEvent = UINT64_MAX;
+    if (0 != this->_wdEventsCount) {
+        nextEvent = this->_wdEvents[0].deadline;
     }
+
+    return nextEvent;
 }
 
-void HealthMonitor::CheckWatchdogs(void) const noexcept {
-    uint64_t                                               currentTime;
-    std::unordered_map<uint32_t, Timeout*>::const_iterator it;
-
-    /* Check for watchdogs */
-    currentTime = HWManager::GetTime();
-    if (pdPASS == xSemaphoreTake(this->_wdLock, WD_LOCK_TIMEOUT_TICKS)) {
-        for (it = this->_watchdogs.begin();
-             this->_watchdogs.end() != it;
-             ++it) {
-            /* Check for dealine miss */
-            if (it->second->GetNextWatchdogEvent() < currentTime) {
-                it->second->ExecuteHandler();
-            }
-        }
+void HealthMonitor::AccountCheck(const uint32_t kCycles) noexcept {
+    HAL::EnterCritical(this->_checkStatsLock);
+    ++this->_checkStats.count;
+    this->_checkStats.totalCycles += kCycles;
+    if (this->_checkStats.minCycles > kCycles) {
+        this->_checkStats.minCycles = kCycles;
+    }
+    if (this->_checkStats.maxCycles < kCycles) {
+        this->_checkStats.maxCycles = kCycles;
+    }
+    this->_checkStats.events = this->_wdEventsCount;
+    HAL::ExitCritical(this->_checkStatsLock);
+}
+
+bool HealthMonitor::IsLaterWatchdogEvent(const S_WatchdogEvent& krFirst,
+                                         const S_WatchdogEvent& krSecond)
+noexcept {
+    return krFirst.deadline > krSecond.deadline;
+}
+
+Timeout* HealthMonitor::GetEventTimeout(const S_WatchdogEvent& krEvent)
+const noexcept {
+    Timeout* pTimeout;
+
+    /* The identifier is revoked before the timeout is released */
+    pTimeout = nullptr;
+    if (HM_INVALID_ID != krEvent.id &&
+        krEvent.id == this->_wdSlots[krEvent.slot].id.load()) {
+        pTimeout = this->_wdSlots[krEvent.slot].pTimeout.load();
+    }
+
+    return pTimeout;
+}
 
-        if (pdPASS != xSemaphoreGive(this->_wdLock)) {
-            PANIC("Failed to release HM watchdog lock.\n");
+void HealthMonitor::ScheduleWatchdogEvent(const S_WatchdogEvent& krEvent)
+noexcept {
+    uint32_t i;
+    uint32_t kept;
+
+    /* Drop the events of the removed watchdogs when full */
+    if (HM_WD_EVENTS_CAPACITY == this->_wdEventsCount) {
+        kept = 0;
+        for (i = 0; this->_wdEventsCount > i; ++i) {
+            if (nullptr != GetEventTimeout(this->_wdEvents[i])) {
+                this->_wdEvents[kept++] = this->_wdEvents[i];
+            }
         }
+        this->_wdEventsCount = kept;
+        std::make_heap(
+            this->_wdEvents,
+            this->_wdEvents + this->_wdEventsCount,
+            IsLaterWatchdogEvent
+        );
     }
-    else {
-        PANIC("Failed to take HM watchdog lock.\n");
+
+    /* At most one event per registered watchdog is valid */
+    if (HM_WD_EVENTS_CAPACITY == this->_wdEventsCount) {
+        PANIC("HM watchdogs deadlines heap is full.\n");
     }
+
+    this->_wdEvents[this->_wdEventsCount++] = krEvent;
+    std::push_heap(
+        this->_wdEvents,
+        this->_wdEvents + this->_wdEventsCount,
+        IsLaterWatchdogEvent
+    );
 }
 
-void HealthMonitor::CheckReporters(void) const noexcept {
-    uint64_t                                                  currentTime;
-    std::unordered_map<uint32_t, HMReporter*>::const_iterator it;
+void HealthMonitor::WaitChecksDone(void) const noexcept {
+    uint32_t sequence;
 
-    /* Check for HM reporters */
-    currentTime = HWManager::GetTime();
-    if (pdPASS == xSemaphoreTake(this->_reportersLock, WD_LOCK_TIMEOUT_TICKS)) {
-        for (it = this->_reporters.begin();
-             this->_reporters.end() != it;
-             ++it) {
-            it->second->HealthCheck(currentTime);
+    /* Handlers run in the real-time task, it cannot wait for itself */
+    sequence = this->_checkSequence.load();
+    if (0 != (sequence & 1) &&
+        HAL::GetCurrentTask() != this->_RTTaskHandle) {
+        while (sequence == this->_checkSequence.load()) {
+            HAL::Sleep(HAL_TICK_NS);
         }
+    }
+}
+
+uint64_t HealthMonitor::CheckReporters(const uint64_t kTime) noexcept {
+    uint64_t         earliestEvent;
+    HMReporter*      pReporter;
+    S_HMCheckRequest request;
+    uint32_t         i;
 
-        if (pdPASS != xSemaphoreGive(this->_reportersLock)) {
-            PANIC("Failed to release HM reporter lock.\n");
+    /* Check for HM reporters */
+    earliestEvent = UINT64_MAX;
+    for (i = 0; HM_MAX_REPORTERS > i; ++i) {
+        request.id = this->_reporterSlots[i].id.load();
+        if (HM_INVALID_ID != request.id) {
+            pReporter = this->_reporterSlots[i].pReporter.load();
+            if (nullptr != pReporter) {
+                /* Only schedule, the checks task performs the check */
+                pReporter->EnforceCheckBudget(kTime);
+                if (pReporter->ScheduleCheck(kTime)) {
+                    request.slot = i;
+                    if (!HAL::SendQueue(
+                            this->_checksQueue,
+                            (void*)&request,
+                            0
+                        )) {
+                        /* The check is retried on the next period */
+                        pReporter->CancelCheck();
+                        HAL::EnterCritical(this->_checkStatsLock);
+                        ++this->_checkStats.droppedChecks;
+                        HAL::ExitCritical(this->_checkStatsLock);
+                    }
+                }
+                earliestEvent = std::min(
+                    earliestEvent,
+                    pReporter->GetNextCheck()
+                );
+            }
         }
     }
-    else {
-        PANIC("Failed to take HM reporter lock.\n");
+
+    return earliestEvent;
+}
+
+void HealthMonitor::WaitNextEvent(const uint64_t kNextEvent) noexcept {
+    uint64_t currentTime;
+    uint64_t sleepNs;
+
+    currentTime = HAL::GetTime();
+    sleepNs = 0;
+    if (kNextEvent > currentTime) {
+        sleepNs = std::min(
+            kNextEvent - currentTime,
+            (uint64_t)HM_RT_TASK_MAX_SLEEP_NS
+        );
     }
+
+    /*
+     * Round up, the deadlines are checked after their expiration. A past
+     * deadline still sleeps one tick so the lower priority tasks run.
+     */
+    sleepNs += HAL_TICK_NS;
+
+    /* Registrations notify the task to compute a new deadline */
+    (void)HAL::WaitNotify(sleepNs);
 }
 
 void HealthMonitor::RealTimeTaskInit(void) noexcept {
-    BaseType_t result;
+    bool isCreated;
 
     LOG_DEBUG("Initializing HM RT task.\n");
 
     /* Create the timeout */
     this->_pTimeout = new Timeout(
-        HW_RT_TASK_PERIOD_NS + HW_RT_TASK_PERIOD_TOLERANCE_NS,
+        HW_RT_TASK_MAX_WAIT_NS + HW_RT_TASK_WAIT_TOLERANCE_NS,
         HW_RT_TASK_WD_TIMEOUT_NS,
         HealthMonitor::DeadlineMissHandler
     );
     if (nullptr == this->_pTimeout) {
         PANIC("Failed to create the HM RT task deadline manager.\n");
     }
+    if (E_Return::NO_ERROR != this->_pTimeout->EnableStats(
+            TaskRegistry::GetName(E_TaskId::TASK_ID_HM_RT),
+            HW_RT_TASK_PERIOD_NS
+        )) {
+        LOG_ERROR("Failed to enable the HM RT task timing statistics.\n");
+    }
 
     /* Create the real-time high-priority task */
-    result = xTaskCreatePinnedToCore(
+    isCreated = TaskRegistry::CreateTask(
+        E_TaskId::TASK_ID_HM_RT,
         HealthMonitor::RealTimeTaskRoutine,
-        HW_RT_TASK_NAME,
-        HW_RT_TASK_STACK,
         this,
-        HW_RT_TASK_PRIO,
-        &this->_RTTaskHandle,
-        HW_RT_TASK_CORE
+        this->_RTTaskHandle
     );
-    if (pdPASS != result) {
+    if (!isCreated) {
         PANIC("Failed to create the HM RT task.\n");
     }
 }
 
 void HealthMonitor::ActionsTaskInit(void) noexcept {
-    BaseType_t result;
-
-    /* Create the actions queue */
-    this->_actionsQueue = xQueueCreate(
-        HM_ACTIONS_TASK_QUEUE_LENGTH,
-        sizeof(HMReporter*)
-    );
-    if (nullptr == this->_actionsQueue) {
-        PANIC("Failed to create the HM action task queue.\n");
-    }
+    bool isCreated;
 
     /* Create the real-time high-priority task */
-    result = xTaskCreatePinnedToCore(
+    isCreated = TaskRegistry::CreateTask(
+        E_TaskId::TASK_ID_HM_ACTIONS,
         HMActionTaskRoutine,
-        HM_ACTIONS_TASK_NAME,
-        HM_ACTIONS_TASK_STACK,
         this,
-        HM_ACTIONS_TASK_PRIO,
-        &this->_actionsTaskHandle,
-        HM_ACTIONS_TASK_CORE
+        this->_actionsTaskHandle
     );
-    if (pdPASS != result) {
+    if (!isCreated) {
         PANIC("Failed to create the HM action task.\n");
     }
 }
 
+void HealthMonitor::ChecksTaskInit(void) noexcept {
+    bool isCreated;
+
+    /* One check in flight per reporter at most */
+    this->_checksQueue = HAL::CreateQueue(
+        HM_MAX_REPORTERS,
+        sizeof(S_HMCheckRequest)
+    );
+    if (nullptr == this->_checksQueue) {
+        PANIC("Failed to create the HM checks task queue.\n");
+    }
+
+    isCreated = TaskRegistry::CreateTask(
+        E_TaskId::TASK_ID_HM_CHECKS,
+        HMChecksTaskRoutine,
+        this,
+        this->_checksTaskHandle
+    );
+    if (!isCreated) {
+        PANIC("Failed to create the HM checks task.\n");
+    }
+}
+
 void HealthMonitor::DeadlineMissHandler(void) noexcept {
     PANIC("HM RT Task watchdog trigerred.\n");
-}
\ No newline at end of file
+}
+
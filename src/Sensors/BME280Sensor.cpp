@@ -0,0 +1,352 @@
+/*******************************************************************************
+ * @file BME280Sensor.cpp
+ *
+ * @see BME280Sensor.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief BME280 temperature, humidity and pressure sensor driver.
+ *
+ * @details BME280 temperature, humidity and pressure sensor driver. The sensor
+ * runs in normal mode and the eight measurement registers are read in a
+ * single burst, then compensated with the factory calibration.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstring>     /* memset */
+#include <cstdint>     /* Standard integer definitions */
+#include <BSP.h>       /* Delays */
+#include <SPI.h>       /* SPI modes */
+#include <Errors.h>    /* Errors definitions */
+#include <Logger.h>    /* Logger services */
+#include <Sensor.h>    /* Sensor interface */
+#include <SensorBus.h> /* Sensor bus accesses */
+
+/* Header file */
+#include <BME280Sensor.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Chip identifier register. */
+#define BME280_REG_ID 0xD0
+/** @brief Soft reset register. */
+#define BME280_REG_RESET 0xE0
+/** @brief Humidity control register. */
+#define BME280_REG_CTRL_HUM 0xF2
+/** @brief Measurement control register. */
+#define BME280_REG_CTRL_MEAS 0xF4
+/** @brief Configuration register. */
+#define BME280_REG_CONFIG 0xF5
+/** @brief First measurement register, pressure MSB. */
+#define BME280_REG_DATA 0xF7
+/** @brief First temperature and pressure calibration register. */
+#define BME280_REG_CALIB_TP 0x88
+/** @brief First humidity calibration register. */
+#define BME280_REG_CALIB_H 0xE1
+
+/** @brief Expected chip identifier. */
+#define BME280_CHIP_ID 0x60
+/** @brief Soft reset command. */
+#define BME280_RESET_CMD 0xB6
+/** @brief Start-up time after a soft reset in nanoseconds. */
+#define BME280_RESET_DELAY_NS 2000000ULL
+/** @brief Humidity oversampling x1. */
+#define BME280_CTRL_HUM_VALUE 0x01
+/** @brief Temperature and pressure oversampling x1, normal mode. */
+#define BME280_CTRL_MEAS_VALUE 0x27
+/** @brief 1 s standby, filter off. */
+#define BME280_CONFIG_VALUE 0xA0
+
+/** @brief Size of the measurement burst in bytes. */
+#define BME280_DATA_SIZE 8
+/** @brief Size of the temperature and pressure calibration in bytes. */
+#define BME280_CALIB_TP_SIZE 26
+/** @brief Size of the humidity calibration in bytes. */
+#define BME280_CALIB_H_SIZE 7
+/** @brief Raw temperature of a skipped measurement. */
+#define BME280_SKIPPED_TEMP 0x80000
+
+/** @brief SPI read flag of the register address. */
+#define BME280_SPI_READ 0x80
+/** @brief SPI write mask of the register address. */
+#define BME280_SPI_WRITE_MASK 0x7F
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/** @brief Reads a little endian unsigned 16 bits value. */
+#define BME280_U16(PBUF, IDX) \
+    ((uint16_t)((PBUF)[(IDX)] | ((uint16_t)(PBUF)[(IDX) + 1] << 8)))
+
+/** @brief Reads a little endian signed 16 bits value. */
+#define BME280_S16(PBUF, IDX) ((int16_t)BME280_U16(PBUF, IDX))
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+BME280Sensor::BME280Sensor(const E_SensorBus kBus, const uint8_t kDevice)
+noexcept : Sensor("BME280", BME280_PERIOD_NS) {
+    this->_transfer.bus = kBus;
+    this->_transfer.device = kDevice;
+    this->_transfer.reg = BME280_REG_DATA;
+    this->_transfer.size = BME280_DATA_SIZE;
+    this->_transfer.spiMode = SPI_MODE0;
+    if (E_SensorBus::SENSOR_BUS_SPI == kBus) {
+        this->_transfer.reg |= BME280_SPI_READ;
+        this->_transfer.clockHz = BME280_SPI_CLOCK_HZ;
+    }
+    else {
+        this->_transfer.clockHz = SENSOR_I2C_CLOCK_HZ;
+    }
+    memset(&this->_calib, 0, sizeof(this->_calib));
+}
+
+BME280Sensor::~BME280Sensor(void) noexcept {
+    /* Nothing to do */
+}
+
+E_Return BME280Sensor::Init(void) noexcept {
+    E_Return error;
+    uint8_t  pCalibTP[BME280_CALIB_TP_SIZE];
+    uint8_t  pCalibH[BME280_CALIB_H_SIZE];
+    uint8_t  chipId;
+
+    SensorBus::Setup(this->_transfer);
+
+    /* Check the device then reset it */
+    error = ReadRegisters(BME280_REG_ID, &chipId, 1);
+    if (E_Return::NO_ERROR == error && BME280_CHIP_ID != chipId) {
+        LOG_ERROR("Unsupported BME280 chip identifier 0x%x.\n", chipId);
+        error = E_Return::ERR_SENSOR_DEVICE;
+    }
+    if (E_Return::NO_ERROR == error) {
+        error = WriteRegister(BME280_REG_RESET, BME280_RESET_CMD);
+        HWManager::DelayExecNs(BME280_RESET_DELAY_NS);
+    }
+
+    /* Read the factory calibration */
+    if (E_Return::NO_ERROR == error) {
+        error = ReadRegisters(
+            BME280_REG_CALIB_TP,
+            pCalibTP,
+            BME280_CALIB_TP_SIZE
+        );
+    }
+    if (E_Return::NO_ERROR == error) {
+        error = ReadRegisters(BME280_REG_CALIB_H, pCalibH, BME280_CALIB_H_SIZE);
+    }
+    if (E_Return::NO_ERROR == error) {
+        this->_calib.t1 = BME280_U16(pCalibTP, 0);
+        this->_calib.t2 = BME280_S16(pCalibTP, 2);
+        this->_calib.t3 = BME280_S16(pCalibTP, 4);
+        this->_calib.p1 = BME280_U16(pCalibTP, 6);
+        this->_calib.p2 = BME280_S16(pCalibTP, 8);
+        this->_calib.p3 = BME280_S16(pCalibTP, 10);
+        this->_calib.p4 = BME280_S16(pCalibTP, 12);
+        this->_calib.p5 = BME280_S16(pCalibTP, 14);
+        this->_calib.p6 = BME280_S16(pCalibTP, 16);
+        this->_calib.p7 = BME280_S16(pCalibTP, 18);
+        this->_calib.p8 = BME280_S16(pCalibTP, 20);
+        this->_calib.p9 = BME280_S16(pCalibTP, 22);
+        this->_calib.h1 = pCalibTP[25];
+        this->_calib.h2 = BME280_S16(pCalibH, 0);
+        this->_calib.h3 = pCalibH[2];
+        this->_calib.h4 = (int16_t)(
+            ((int16_t)(int8_t)pCalibH[3] << 4) | (pCalibH[4] & 0x0F)
+        );
+        this->_calib.h5 = (int16_t)(
+            ((int16_t)(int8_t)pCalibH[5] << 4) | (pCalibH[4] >> 4)
+        );
+        this->_calib.h6 = (int8_t)pCalibH[6];
+    }
+
+    /* The humidity control is applied by the measurement control write */
+    if (E_Return::NO_ERROR == error) {
+        error = WriteRegister(BME280_REG_CTRL_HUM, BME280_CTRL_HUM_VALUE);
+    }
+    if (E_Return::NO_ERROR == error) {
+        error = WriteRegister(BME280_REG_CONFIG, BME280_CONFIG_VALUE);
+    }
+    if (E_Return::NO_ERROR == error) {
+        error = WriteRegister(BME280_REG_CTRL_MEAS, BME280_CTRL_MEAS_VALUE);
+    }
+
+    return error;
+}
+
+void BME280Sensor::GetTransfer(S_SensorTransfer& rTransfer) const noexcept {
+    rTransfer = this->_transfer;
+}
+
+uint32_t BME280Sensor::Decode(const uint8_t*  kpFrame,
+                              S_SensorSample* pSamples) noexcept {
+    uint32_t count;
+
+    count = 0;
+    if (Compensate(
+            this->_calib,
+            kpFrame,
+            pSamples[0].value,
+            pSamples[1].value,
+            pSamples[2].value)) {
+        pSamples[0].quantity = E_SensorQuantity::SENSOR_QTY_TEMPERATURE;
+        pSamples[1].quantity = E_SensorQuantity::SENSOR_QTY_HUMIDITY;
+        pSamples[2].quantity = E_SensorQuantity::SENSOR_QTY_PRESSURE;
+        count = 3;
+    }
+
+    return count;
+}
+
+bool BME280Sensor::Compensate(const S_BME280Calibration& krCalib,
+                              const uint8_t*             kpFrame,
+                              float&                     rTemperature,
+                              float&                     rHumidity,
+                              float&                     rPressure) noexcept {
+    int32_t rawPress;
+    int32_t rawTemp;
+    int32_t rawHum;
+    int32_t tFine;
+    int32_t var1;
+    int32_t var2;
+    int32_t hum;
+    int64_t pVar1;
+    int64_t pVar2;
+    int64_t press;
+    bool    isValid;
+
+    rawPress = ((int32_t)kpFrame[0] << 12) |
+               ((int32_t)kpFrame[1] << 4) |
+               (kpFrame[2] >> 4);
+    rawTemp = ((int32_t)kpFrame[3] << 12) |
+              ((int32_t)kpFrame[4] << 4) |
+              (kpFrame[5] >> 4);
+    rawHum = ((int32_t)kpFrame[6] << 8) | kpFrame[7];
+
+    /* Fixed-point compensation of the datasheet */
+    isValid = (BME280_SKIPPED_TEMP != rawTemp && 0 != krCalib.p1);
+    if (isValid) {
+        var1 = ((((rawTemp >> 3) - ((int32_t)krCalib.t1 << 1))) *
+                ((int32_t)krCalib.t2)) >> 11;
+        var2 = (((((rawTemp >> 4) - ((int32_t)krCalib.t1)) *
+                  ((rawTemp >> 4) - ((int32_t)krCalib.t1))) >> 12) *
+                ((int32_t)krCalib.t3)) >> 14;
+        tFine = var1 + var2;
+        rTemperature = (float)((tFine * 5 + 128) >> 8) / 100.0f;
+
+        pVar1 = (int64_t)tFine - 128000;
+        pVar2 = pVar1 * pVar1 * (int64_t)krCalib.p6;
+        pVar2 += (pVar1 * (int64_t)krCalib.p5) << 17;
+        pVar2 += (int64_t)krCalib.p4 << 35;
+        pVar1 = ((pVar1 * pVar1 * (int64_t)krCalib.p3) >> 8) +
+                ((pVar1 * (int64_t)krCalib.p2) << 12);
+        pVar1 = ((((int64_t)1 << 47) + pVar1) * (int64_t)krCalib.p1) >> 33;
+        isValid = (0 != pVar1);
+    }
+    if (isValid) {
+        press = 1048576 - rawPress;
+        press = (((press << 31) - pVar2) * 3125) / pVar1;
+        pVar1 = ((int64_t)krCalib.p9 * (press >> 13) * (press >> 13)) >> 25;
+        pVar2 = ((int64_t)krCalib.p8 * press) >> 19;
+        press = ((press + pVar1 + pVar2) >> 8) + ((int64_t)krCalib.p7 << 4);
+        rPressure = (float)press / 25600.0f;
+
+        hum = tFine - (int32_t)76800;
+        hum = (((((rawHum << 14) - ((int32_t)krCalib.h4 << 20) -
+                  ((int32_t)krCalib.h5 * hum)) + (int32_t)16384) >> 15) *
+               (((((((hum * (int32_t)krCalib.h6) >> 10) *
+                    (((hum * (int32_t)krCalib.h3) >> 11) +
+                     (int32_t)32768)) >> 10) + (int32_t)2097152) *
+                 (int32_t)krCalib.h2 + 8192) >> 14));
+        hum -= (((((hum >> 15) * (hum >> 15)) >> 7) *
+                 (int32_t)krCalib.h1) >> 4);
+        hum = (0 > hum) ? 0 : hum;
+        hum = (419430400 < hum) ? 419430400 : hum;
+        rHumidity = (float)(hum >> 12) / 1024.0f;
+    }
+
+    return isValid;
+}
+
+E_Return BME280Sensor::ReadRegisters(const uint8_t kReg,
+                                     uint8_t*      pBuffer,
+                                     const uint8_t kSize) noexcept {
+    S_SensorTransfer transfer;
+    E_Return         error;
+
+    transfer = this->_transfer;
+    transfer.reg = kReg;
+    transfer.size = kSize;
+    if (E_SensorBus::SENSOR_BUS_SPI == transfer.bus) {
+        transfer.reg |= BME280_SPI_READ;
+    }
+
+    error = SensorBus::Acquire(transfer.bus);
+    if (E_Return::NO_ERROR == error) {
+        error = SensorBus::Read(transfer, pBuffer);
+        SensorBus::Release(transfer.bus);
+    }
+
+    return error;
+}
+
+E_Return BME280Sensor::WriteRegister(const uint8_t kReg,
+                                     const uint8_t kValue) noexcept {
+    E_Return error;
+    uint8_t  reg;
+
+    reg = kReg;
+    if (E_SensorBus::SENSOR_BUS_SPI == this->_transfer.bus) {
+        reg &= BME280_SPI_WRITE_MASK;
+    }
+
+    error = SensorBus::Acquire(this->_transfer.bus);
+    if (E_Return::NO_ERROR == error) {
+        error = SensorBus::Write(this->_transfer, reg, kValue);
+        SensorBus::Release(this->_transfer.bus);
+    }
+
+    return error;
+}
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * @file ChipTempSensor.cpp
+ *
+ * @see ChipTempSensor.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief On-chip temperature sensor driver.
+ *
+ * @details On-chip temperature sensor driver. The die temperature follows the
+ * enclosure temperature and the compute load, it is sampled for the health
+ * reports.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cmath>     /* std::isnan */
+#include <cstring>   /* memset */
+#include <cstdint>   /* Standard integer definitions */
+#include <Errors.h>  /* Errors definitions */
+#include <Sensor.h>  /* Sensor interface */
+#include <Arduino.h> /* On-chip temperature */
+
+/* Header file */
+#include <ChipTempSensor.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+ChipTempSensor::ChipTempSensor(void) noexcept :
+Sensor("CHIP_TEMP", CHIP_TEMP_PERIOD_NS) {
+}
+
+ChipTempSensor::~ChipTempSensor(void) noexcept {
+    /* Nothing to do */
+}
+
+E_Return ChipTempSensor::Init(void) noexcept {
+    return E_Return::NO_ERROR;
+}
+
+void ChipTempSensor::GetTransfer(S_SensorTransfer& rTransfer) const noexcept {
+    memset(&rTransfer, 0, sizeof(rTransfer));
+    rTransfer.bus = E_SensorBus::SENSOR_BUS_NONE;
+}
+
+uint32_t ChipTempSensor::Decode(const uint8_t*  kpFrame,
+                                S_SensorSample* pSamples) noexcept {
+    uint32_t count;
+    float    value;
+
+    (void)kpFrame;
+
+    count = 0;
+    value = temperatureRead();
+    if (!std::isnan(value)) {
+        pSamples[0].value = value;
+        pSamples[0].quantity = E_SensorQuantity::SENSOR_QTY_TEMPERATURE;
+        count = 1;
+    }
+
+    return count;
+}
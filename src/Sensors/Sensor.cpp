@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * @file Sensor.cpp
+ *
+ * @see Sensor.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Sensor driver interface.
+ *
+ * @details Sensor driver interface. A sensor describes the bus transfer that
+ * reads all its measurement registers at once and decodes the received frame
+ * into samples. The bus accesses are performed by the sensor engine.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+
+/* Header file */
+#include <Sensor.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+Sensor::Sensor(const char* kpName, const uint64_t kPeriodNs) noexcept {
+    this->_kpName = kpName;
+    this->_periodNs = kPeriodNs;
+}
+
+Sensor::~Sensor(void) noexcept {
+    /* Nothing to do */
+}
+
+const char* Sensor::GetName(void) const noexcept {
+    return this->_kpName;
+}
+
+uint64_t Sensor::GetPeriod(void) const noexcept {
+    return this->_periodNs;
+}
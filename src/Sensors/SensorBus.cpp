@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * @file SensorBus.cpp
+ *
+ * @see SensorBus.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Sensor bus accesses.
+ *
+ * @details Sensor bus accesses. Burst register reads and writes on the shared
+ * SPI bus and on the I2C bus. The SPI bus is shared with the SD card and is
+ * granted by the storage bus lock.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstring>       /* memset */
+#include <cstdint>       /* Standard integer definitions */
+#include <BSP.h>         /* SPI bus and pins */
+#include <SPI.h>         /* SPI transactions */
+#include <Wire.h>        /* I2C transactions */
+#include <Errors.h>      /* Errors definitions */
+#include <Logger.h>      /* Logger services */
+#include <Sensor.h>      /* Sensor transfers */
+#include <Storage.h>     /* Storage bus lock */
+#include <SystemState.h> /* System state */
+
+/* Header file */
+#include <SensorBus.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the value clocked out during the SPI reads. */
+#define SENSOR_SPI_FILL 0xFF
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief See SensorBus.h */
+bool SensorBus::_SI2CINIT = false;
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+void SensorBus::Setup(const S_SensorTransfer& krTransfer) noexcept {
+    if (E_SensorBus::SENSOR_BUS_SPI == krTransfer.bus) {
+        pinMode(krTransfer.device, OUTPUT);
+        digitalWrite(krTransfer.device, HIGH);
+        HWManager::GetSPIBus();
+    }
+    else if (E_SensorBus::SENSOR_BUS_I2C == krTransfer.bus &&
+             !SensorBus::_SI2CINIT) {
+        if (Wire.begin(GPIO_I2C_SDA, GPIO_I2C_SCL, SENSOR_I2C_CLOCK_HZ)) {
+            SensorBus::_SI2CINIT = true;
+        }
+        else {
+            LOG_ERROR("Failed to start the I2C bus.\n");
+        }
+    }
+}
+
+E_Return SensorBus::Acquire(const E_SensorBus kBus) noexcept {
+    Storage* pStorage;
+    E_Return error;
+
+    error = E_Return::NO_ERROR;
+    if (E_SensorBus::SENSOR_BUS_SPI == kBus) {
+        pStorage = SystemState::GetInstance()->GetStorage();
+        if (nullptr != pStorage) {
+            error = pStorage->AcquireSPIBus(SENSOR_BUS_TIMEOUT_NS);
+        }
+    }
+
+    return error;
+}
+
+void SensorBus::Release(const E_SensorBus kBus) noexcept {
+    Storage* pStorage;
+
+    if (E_SensorBus::SENSOR_BUS_SPI == kBus) {
+        pStorage = SystemState::GetInstance()->GetStorage();
+        if (nullptr != pStorage) {
+            pStorage->ReleaseSPIBus();
+        }
+    }
+}
+
+E_Return SensorBus::Read(const S_SensorTransfer& krTransfer,
+                         uint8_t*                pBuffer) noexcept {
+    SPIClass* pSPI;
+    E_Return  error;
+
+    error = E_Return::NO_ERROR;
+    if (E_SensorBus::SENSOR_BUS_SPI == krTransfer.bus) {
+        /* The register and the frame are clocked in one transaction */
+        pSPI = HWManager::GetSPIBus();
+        memset(pBuffer, SENSOR_SPI_FILL, krTransfer.size);
+        pSPI->beginTransaction(
+            SPISettings(krTransfer.clockHz, MSBFIRST, krTransfer.spiMode)
+        );
+        digitalWrite(krTransfer.device, LOW);
+        pSPI->transfer(krTransfer.reg);
+        pSPI->transferBytes(pBuffer, pBuffer, krTransfer.size);
+        digitalWrite(krTransfer.device, HIGH);
+        pSPI->endTransaction();
+    }
+    else if (E_SensorBus::SENSOR_BUS_I2C == krTransfer.bus) {
+        /* Repeated start, the driver performs the write-read at once */
+        Wire.beginTransmission(krTransfer.device);
+        Wire.write(krTransfer.reg);
+        if (0 != Wire.endTransmission(false) ||
+            krTransfer.size != Wire.requestFrom(
+                krTransfer.device,
+                (size_t)krTransfer.size
+            ) ||
+            krTransfer.size != Wire.readBytes(pBuffer, krTransfer.size)) {
+            error = E_Return::ERR_SENSOR_BUS;
+        }
+    }
+
+    return error;
+}
+
+E_Return SensorBus::Write(const S_SensorTransfer& krTransfer,
+                          const uint8_t           kReg,
+                          const uint8_t           kValue) noexcept {
+    SPIClass* pSPI;
+    E_Return  error;
+    uint8_t   pFrame[2];
+
+    error = E_Return::NO_ERROR;
+    pFrame[0] = kReg;
+    pFrame[1] = kValue;
+    if (E_SensorBus::SENSOR_BUS_SPI == krTransfer.bus) {
+        pSPI = HWManager::GetSPIBus();
+        pSPI->beginTransaction(
+            SPISettings(krTransfer.clockHz, MSBFIRST, krTransfer.spiMode)
+        );
+        digitalWrite(krTransfer.device, LOW);
+        pSPI->writeBytes(pFrame, sizeof(pFrame));
+        digitalWrite(krTransfer.device, HIGH);
+        pSPI->endTransaction();
+    }
+    else if (E_SensorBus::SENSOR_BUS_I2C == krTransfer.bus) {
+        Wire.beginTransmission(krTransfer.device);
+        Wire.write(pFrame, sizeof(pFrame));
+        if (0 != Wire.endTransmission()) {
+            error = E_Return::ERR_SENSOR_BUS;
+        }
+    }
+
+    return error;
+}
@@ -0,0 +1,446 @@
+/*******************************************************************************
+ * @file SensorDSP.cpp
+ *
+ * @see SensorDSP.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Sensor filtering kernels.
+ *
+ * @details Sensor filtering kernels. The kernels filter and derive blocks of
+ * values gathered from the acquisition ring, the filters state is kept
+ * between the blocks.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cmath>    /* Math library */
+#include <cstdint>  /* Standard integer definitions */
+#include <cstring>  /* memcpy */
+#include <Errors.h> /* Errors definitions */
+#include <Sensor.h> /* Sensor samples */
+
+/* Header file */
+#include <SensorDSP.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Magnus formula b coefficient. */
+#define DSP_MAGNUS_B 17.62f
+/** @brief Magnus formula c coefficient in degrees Celsius. */
+#define DSP_MAGNUS_C 243.12f
+/** @brief Barometric formula altitude scale in meters. */
+#define DSP_BARO_SCALE 44330.77f
+/** @brief Barometric formula exponent. */
+#define DSP_BARO_EXP 0.190263f
+/** @brief Natural logarithm of 2. */
+#define DSP_LN2 0.69314718f
+/** @brief Square root of 2. */
+#define DSP_SQRT2 1.41421356f
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/** @brief Branchless minimum of two values. */
+#define DSP_MIN(A, B) (((A) < (B)) ? (A) : (B))
+/** @brief Branchless maximum of two values. */
+#define DSP_MAX(A, B) (((A) < (B)) ? (B) : (A))
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Returns the median of three values.
+ *
+ * @param[in] kA The first value.
+ * @param[in] kB The second value.
+ * @param[in] kC The third value.
+ *
+ * @return The median is returned.
+ */
+static inline float Median3(const float kA,
+                            const float kB,
+                            const float kC) noexcept;
+
+/**
+ * @brief Returns the median of a window.
+ *
+ * @param[in] kpWindow The window values.
+ * @param[in] kSize The window size, odd.
+ *
+ * @return The median is returned.
+ */
+static float MedianN(const float* kpWindow, const uint32_t kSize) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static inline float Median3(const float kA,
+                            const float kB,
+                            const float kC) noexcept {
+    return DSP_MAX(DSP_MIN(kA, kB), DSP_MIN(DSP_MAX(kA, kB), kC));
+}
+
+static float MedianN(const float* kpWindow, const uint32_t kSize) noexcept {
+    float    pSorted[DSP_MAX_MEDIAN];
+    float    value;
+    float    median;
+    uint32_t i;
+    uint32_t j;
+
+    if (3 == kSize) {
+        median = Median3(kpWindow[0], kpWindow[1], kpWindow[2]);
+    }
+    else if (5 == kSize) {
+        /* The extremes of the two pairs cannot be the median */
+        median = Median3(
+            kpWindow[4],
+            DSP_MAX(
+                DSP_MIN(kpWindow[0], kpWindow[1]),
+                DSP_MIN(kpWindow[2], kpWindow[3])
+            ),
+            DSP_MIN(
+                DSP_MAX(kpWindow[0], kpWindow[1]),
+                DSP_MAX(kpWindow[2], kpWindow[3])
+            )
+        );
+    }
+    else {
+        /* Insertion sort, the window is small */
+        for (i = 0; kSize > i; ++i) {
+            value = kpWindow[i];
+            j = i;
+            while (0 < j && value < pSorted[j - 1]) {
+                pSorted[j] = pSorted[j - 1];
+                --j;
+            }
+            pSorted[j] = value;
+        }
+        median = pSorted[kSize / 2];
+    }
+
+    return median;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+uint32_t SensorDSP::Gather(const S_SensorSample* kpSamples,
+                           const uint32_t        kCount,
+                           const uint8_t         kSensorId,
+                           const uint8_t         kQuantity,
+                           float*                pValues,
+                           const uint32_t        kMaxCount) noexcept {
+    uint32_t i;
+    uint32_t count;
+
+    count = 0;
+    for (i = 0; kCount > i && kMaxCount > count; ++i) {
+        if (kSensorId == kpSamples[i].sensorId &&
+            kQuantity == kpSamples[i].quantity) {
+            pValues[count] = kpSamples[i].value;
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+E_Return SensorDSP::InitMovingAverage(S_DSPMovingAverage& rState,
+                                      const uint32_t      kSize) noexcept {
+    E_Return error;
+
+    if (0 == kSize || DSP_MAX_WINDOW < kSize) {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+    else {
+        rState.sum = 0.0f;
+        rState.size = kSize;
+        rState.index = 0;
+        rState.count = 0;
+        error = E_Return::NO_ERROR;
+    }
+
+    return error;
+}
+
+void SensorDSP::MovingAverage(S_DSPMovingAverage& rState,
+                              const float*        kpIn,
+                              float*              pOut,
+                              const uint32_t      kCount) noexcept {
+    float    sum;
+    float    inverse;
+    float    value;
+    uint32_t index;
+    uint32_t count;
+    uint32_t i;
+    uint32_t j;
+
+    /* The running sum removes the value leaving the window */
+    sum = rState.sum;
+    index = rState.index;
+    count = rState.count;
+    inverse = 1.0f / (float)rState.size;
+    for (i = 0; kCount > i; ++i) {
+        value = kpIn[i];
+        if (rState.size == count) {
+            sum += value - rState.pWindow[index];
+        }
+        else {
+            sum += value;
+            ++count;
+        }
+        rState.pWindow[index] = value;
+        ++index;
+
+        if (rState.size == index) {
+            /* The rounding errors are dropped once per window */
+            index = 0;
+            sum = 0.0f;
+            for (j = 0; count > j; ++j) {
+                sum += rState.pWindow[j];
+            }
+        }
+
+        if (rState.size == count) {
+            pOut[i] = sum * inverse;
+        }
+        else {
+            pOut[i] = sum / (float)count;
+        }
+    }
+    rState.sum = sum;
+    rState.index = index;
+    rState.count = count;
+}
+
+E_Return SensorDSP::InitMedian(S_DSPMedian&   rState,
+                               const uint32_t kSize) noexcept {
+    E_Return error;
+
+    if (0 == kSize % 2 || DSP_MAX_MEDIAN < kSize) {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+    else {
+        rState.size = kSize;
+        rState.index = 0;
+        rState.count = 0;
+        error = E_Return::NO_ERROR;
+    }
+
+    return error;
+}
+
+void SensorDSP::Median(S_DSPMedian&   rState,
+                       const float*   kpIn,
+                       float*         pOut,
+                       const uint32_t kCount) noexcept {
+    float    value;
+    uint32_t i;
+
+    for (i = 0; kCount > i; ++i) {
+        value = kpIn[i];
+        rState.pWindow[rState.index] = value;
+        ++rState.index;
+        if (rState.size == rState.index) {
+            rState.index = 0;
+        }
+
+        /* The median does not depend on the order of the window */
+        if (rState.size == rState.count) {
+            pOut[i] = MedianN(rState.pWindow, rState.size);
+        }
+        else {
+            ++rState.count;
+            pOut[i] = value;
+        }
+    }
+}
+
+E_Return SensorDSP::InitEma(S_DSPEma& rState, const float kAlpha) noexcept {
+    E_Return error;
+
+    if (!(0.0f < kAlpha && 1.0f >= kAlpha)) {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+    else {
+        rState.alpha = kAlpha;
+        rState.value = 0.0f;
+        rState.isInit = false;
+        error = E_Return::NO_ERROR;
+    }
+
+    return error;
+}
+
+void SensorDSP::Ema(S_DSPEma&      rState,
+                    const float*   kpIn,
+                    float*         pOut,
+                    const uint32_t kCount) noexcept {
+    float    value;
+    float    alpha;
+    uint32_t i;
+
+    i = 0;
+    if (!rState.isInit && 0 != kCount) {
+        rState.value = kpIn[0];
+        rState.isInit = true;
+        pOut[0] = kpIn[0];
+        i = 1;
+    }
+
+    value = rState.value;
+    alpha = rState.alpha;
+    for (; kCount > i; ++i) {
+        value += alpha * (kpIn[i] - value);
+        pOut[i] = value;
+    }
+    rState.value = value;
+}
+
+void SensorDSP::DewPoint(const float*   kpTemperature,
+                         const float*   kpHumidity,
+                         float*         pOut,
+                         const uint32_t kCount) noexcept {
+    float    temperature;
+    float    humidity;
+    float    gamma;
+    uint32_t i;
+
+    for (i = 0; kCount > i; ++i) {
+        temperature = kpTemperature[i];
+        humidity = kpHumidity[i];
+
+        /* Also rejects the failed readings */
+        if (0.0f < humidity && INFINITY > humidity &&
+            -DSP_MAGNUS_C < temperature && INFINITY > temperature) {
+            gamma = FastLog2(humidity * 0.01f) * DSP_LN2 +
+                    DSP_MAGNUS_B * temperature / (DSP_MAGNUS_C + temperature);
+            pOut[i] = DSP_MAGNUS_C * gamma / (DSP_MAGNUS_B - gamma);
+        }
+        else {
+            pOut[i] = NAN;
+        }
+    }
+}
+
+void SensorDSP::PressureAltitude(const float*   kpPressure,
+                                 float*         pOut,
+                                 const uint32_t kCount,
+                                 const float    kSeaLevel) noexcept {
+    float    inverse;
+    float    pressure;
+    uint32_t i;
+
+    inverse = 1.0f / kSeaLevel;
+    for (i = 0; kCount > i; ++i) {
+        pressure = kpPressure[i];
+        if (0.0f < pressure && INFINITY > pressure) {
+            pOut[i] = DSP_BARO_SCALE * (
+                1.0f -
+                FastExp2(DSP_BARO_EXP * FastLog2(pressure * inverse))
+            );
+        }
+        else {
+            pOut[i] = NAN;
+        }
+    }
+}
+
+float SensorDSP::DewPointScalar(const float kTemperature,
+                                const float kHumidity) noexcept {
+    float gamma;
+
+    gamma = logf(kHumidity / 100.0f) +
+            DSP_MAGNUS_B * kTemperature / (DSP_MAGNUS_C + kTemperature);
+
+    return DSP_MAGNUS_C * gamma / (DSP_MAGNUS_B - gamma);
+}
+
+float SensorDSP::PressureAltitudeScalar(const float kPressure,
+                                        const float kSeaLevel) noexcept {
+    return DSP_BARO_SCALE * (1.0f - powf(kPressure / kSeaLevel, DSP_BARO_EXP));
+}
+
+float SensorDSP::FastLog2(const float kValue) noexcept {
+    uint32_t bits;
+    int32_t  exponent;
+    float    mantissa;
+    float    t;
+    float    t2;
+
+    /* Split the exponent and center the mantissa on 1 */
+    memcpy(&bits, &kValue, sizeof(bits));
+    exponent = (int32_t)((bits >> 23) & 0xFF) - 127;
+    bits = (bits & 0x007FFFFF) | 0x3F800000;
+    memcpy(&mantissa, &bits, sizeof(bits));
+    if (DSP_SQRT2 < mantissa) {
+        mantissa *= 0.5f;
+        ++exponent;
+    }
+
+    /* log2(m) = 2 / ln(2) * atanh((m - 1) / (m + 1)) */
+    t = (mantissa - 1.0f) / (mantissa + 1.0f);
+    t2 = t * t;
+
+    return (float)exponent +
+           t * (2.88539008f +
+                t2 * (0.96179669f +
+                      t2 * (0.57707802f +
+                            t2 * 0.41219858f)));
+}
+
+float SensorDSP::FastExp2(const float kValue) noexcept {
+    int32_t  integer;
+    uint32_t bits;
+    float    fraction;
+    float    result;
+
+    /* Round to the nearest integer, the fraction is in [-0.5, 0.5] */
+    integer = (int32_t)(kValue + 0.5f);
+    if ((float)integer > kValue + 0.5f) {
+        --integer;
+    }
+    fraction = (kValue - (float)integer) * DSP_LN2;
+
+    result = 1.0f +
+             fraction * (1.0f +
+             fraction * (0.5f +
+             fraction * (0.16666667f +
+             fraction * (0.04166667f +
+             fraction * (0.00833333f +
+             fraction * 0.00138889f)))));
+
+    /* Scale by the integer power of 2 */
+    memcpy(&bits, &result, sizeof(bits));
+    bits += (uint32_t)integer << 23;
+    memcpy(&result, &bits, sizeof(bits));
+
+    return result;
+}
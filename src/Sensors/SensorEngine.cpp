@@ -0,0 +1,551 @@
+/*******************************************************************************
+ * @file SensorEngine.cpp
+ *
+ * @see SensorEngine.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Sensor acquisition engine.
+ *
+ * @details Sensor acquisition engine. The periodic acquisition task reads the
+ * due sensors with one acquisition per bus and publishes the samples in a
+ * preallocated ring buffer. The ring is read without locks.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <atomic>          /* Standard atomic types */
+#include <cstdint>         /* Standard integer definitions */
+#include <algorithm>       /* std::min */
+#include <BSP.h>           /* Time services */
+#include <Errors.h>        /* Errors definitions */
+#include <Logger.h>        /* Logger services */
+#include <Sensor.h>        /* Sensor interface */
+#include <Timeout.h>       /* Timeout services */
+#include <SensorBus.h>     /* Sensor bus accesses */
+#include <SystemState.h>   /* System state */
+#include <TaskRegistry.h>  /* Firmware tasks registry */
+#include <HealthMonitor.h> /* HM services */
+#include <esp_heap_caps.h> /* Capability based allocation */
+
+/* Header file */
+#include <SensorEngine.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Acquisition period tolerance in nanoseconds. */
+#define SENSOR_TASK_TOLERANCE_NS 50000000ULL
+/** @brief Acquisition watchdog timeout in nanoseconds. */
+#define SENSOR_TASK_WD_TIMEOUT_NS (5 * SENSOR_TASK_MAX_SLEEP_NS)
+
+/** @brief Sensor health reports failures before degraded. */
+#define SENSOR_HM_FAIL_TO_DEGRADE 1
+/** @brief Sensor health reports failures before unhealthy. */
+#define SENSOR_HM_FAIL_TO_UNHEALTHY 3
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+SensorEngine::SensorEngine(void) noexcept {
+    uint32_t i;
+
+    this->_sensorCount = 0;
+    this->_writeSeq.store(0);
+    this->_latest.time = 0;
+    this->_latest.count = 0;
+    this->_pTimeout = nullptr;
+    this->_taskHandle = nullptr;
+    for (i = 0; SENSOR_MAX_SENSORS > i; ++i) {
+        this->_pSlots[i].pSensor = nullptr;
+        this->_pSlots[i].pReporter = nullptr;
+        this->_pSlots[i].needsInit.store(true);
+        this->_pSlots[i].reads.store(0);
+        this->_pSlots[i].errors.store(0);
+        this->_pSlots[i].failures.store(0);
+    }
+
+    /* The ring is allocated once, external memory is preferred */
+    this->_pRing = (S_SensorSample*)heap_caps_malloc(
+        SENSOR_RING_SIZE * sizeof(S_SensorSample),
+        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+    );
+    if (nullptr == this->_pRing) {
+        this->_pRing = (S_SensorSample*)heap_caps_malloc(
+            SENSOR_RING_SIZE * sizeof(S_SensorSample),
+            MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+        );
+    }
+    if (nullptr == this->_pRing) {
+        PANIC("Failed to allocate the sensor samples ring.\n");
+    }
+
+    SystemState::GetInstance()->SetSensorEngine(this);
+
+    LOG_DEBUG("Sensor engine initialized.\n");
+}
+
+SensorEngine::~SensorEngine(void) noexcept {
+    PANIC("Tried to destroy the Sensor engine.\n");
+}
+
+E_Return SensorEngine::AddSensor(Sensor* pSensor, uint32_t& rId) noexcept {
+    S_SensorSlot* pSlot;
+    E_Return      error;
+    uint64_t      period;
+
+    if (nullptr == pSensor || nullptr != this->_taskHandle) {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+    else if (SENSOR_MAX_SENSORS <= this->_sensorCount) {
+        error = E_Return::ERR_SENSOR_FULL;
+    }
+    else {
+        pSlot = &this->_pSlots[this->_sensorCount];
+        pSensor->GetTransfer(pSlot->transfer);
+        if (SENSOR_MAX_TRANSFER_SIZE < pSlot->transfer.size) {
+            error = E_Return::ERR_INVALID_PARAM;
+        }
+        else {
+            period = pSensor->GetPeriod();
+            pSlot->pReporter = new SensorHealthReporter(
+                S_HMReporterParam {
+                    SENSOR_HM_CHECK_PERIODS * period,
+                    SENSOR_HM_FAIL_TO_DEGRADE,
+                    SENSOR_HM_FAIL_TO_UNHEALTHY,
+                    pSensor->GetName()
+                },
+                this,
+                this->_sensorCount
+            );
+            if (nullptr == pSlot->pReporter) {
+                error = E_Return::ERR_MEMORY;
+            }
+            else {
+                error = SystemState::GetInstance()->GetHealthMonitor()->
+                    AddReporter(pSlot->pReporter, pSlot->reporterId);
+                if (E_Return::NO_ERROR != error) {
+                    delete pSlot->pReporter;
+                    pSlot->pReporter = nullptr;
+                }
+            }
+        }
+
+        if (E_Return::NO_ERROR == error) {
+            pSlot->pSensor = pSensor;
+            pSlot->nextRead = 0;
+            rId = this->_sensorCount;
+            ++this->_sensorCount;
+        }
+    }
+
+    return error;
+}
+
+E_Return SensorEngine::Start(void) noexcept {
+    bool       isCreated;
+    E_Return   error;
+
+    error = E_Return::NO_ERROR;
+    if (nullptr == this->_taskHandle) {
+        this->_pTimeout = new Timeout(
+            SENSOR_TASK_MAX_SLEEP_NS + SENSOR_TASK_TOLERANCE_NS,
+            SENSOR_TASK_WD_TIMEOUT_NS,
+            SensorEngine::DeadlineMissHandler
+        );
+        if (nullptr == this->_pTimeout) {
+            error = E_Return::ERR_MEMORY;
+        }
+        else if (E_Return::NO_ERROR != this->_pTimeout->EnableStats(
+                    TaskRegistry::GetName(E_TaskId::TASK_ID_SENSORS),
+                    SENSOR_TASK_MAX_SLEEP_NS
+                 )) {
+            LOG_ERROR("Failed to enable the sensors task statistics.\n");
+        }
+    }
+    if (E_Return::NO_ERROR == error && nullptr == this->_taskHandle) {
+        isCreated = TaskRegistry::CreateTask(
+            E_TaskId::TASK_ID_SENSORS,
+            SensorEngine::TaskRoutine,
+            this,
+            this->_taskHandle
+        );
+        if (!isCreated) {
+            LOG_ERROR("Failed to create the sensors task.\n");
+            error = E_Return::ERR_MEMORY;
+        }
+        else {
+            LOG_INFO("Started %d sensors.\n", this->_sensorCount);
+        }
+    }
+
+    return error;
+}
+
+uint32_t SensorEngine::GetSequence(void) const noexcept {
+    return this->_writeSeq.load(std::memory_order_acquire);
+}
+
+uint32_t SensorEngine::ReadSamples(uint32_t&       rSequence,
+                                   S_SensorSample* pBuffer,
+                                   const uint32_t  kMaxCount) const noexcept {
+    uint32_t start;
+    uint32_t end;
+    uint32_t count;
+    uint32_t i;
+    int32_t  overwritten;
+
+    /* The oldest slot is the next one written, it is skipped */
+    end = this->_writeSeq.load(std::memory_order_acquire);
+    start = rSequence;
+    if (SENSOR_RING_SIZE - 1 < end - start) {
+        start = end - (SENSOR_RING_SIZE - 1);
+    }
+    count = std::min(end - start, kMaxCount);
+
+    for (i = 0; count > i; ++i) {
+        pBuffer[i] = this->_pRing[(start + i) & (SENSOR_RING_SIZE - 1)];
+    }
+
+    /*
+     * The writer may have wrapped during the copy. The slot of the sample
+     * being written is also dropped since it could be torn.
+     */
+    std::atomic_thread_fence(std::memory_order_acquire);
+    end = this->_writeSeq.load(std::memory_order_relaxed);
+    overwritten = (int32_t)(end + 1 - SENSOR_RING_SIZE - start);
+    if (0 < overwritten) {
+        if ((uint32_t)overwritten >= count) {
+            count = 0;
+        }
+        else {
+            count -= overwritten;
+            for (i = 0; count > i; ++i) {
+                pBuffer[i] = pBuffer[i + overwritten];
+            }
+        }
+        start += overwritten;
+    }
+
+    rSequence = start + count;
+
+    return count;
+}
+
+uint32_t SensorEngine::GetSensorCount(void) const noexcept {
+    return this->_sensorCount;
+}
+
+E_Return SensorEngine::GetSensorStatus(const uint32_t  kId,
+                                       S_SensorStatus& rStatus) const noexcept {
+    const S_SensorSlot* kpSlot;
+    E_Return            error;
+
+    if (this->_sensorCount > kId) {
+        kpSlot = &this->_pSlots[kId];
+        rStatus.pkName = kpSlot->pSensor->GetName();
+        rStatus.periodNs = kpSlot->pSensor->GetPeriod();
+        rStatus.reads = kpSlot->reads.load(std::memory_order_relaxed);
+        rStatus.errors = kpSlot->errors.load(std::memory_order_relaxed);
+        rStatus.health = kpSlot->pReporter->GetStatus();
+        error = E_Return::NO_ERROR;
+    }
+    else {
+        error = E_Return::ERR_NO_SUCH_ID;
+    }
+
+    return error;
+}
+
+void SensorEngine::RequestInit(const uint32_t kId) noexcept {
+    if (this->_sensorCount > kId) {
+        this->_pSlots[kId].needsInit.store(true);
+        if (nullptr != this->_taskHandle) {
+            xTaskNotifyGive(this->_taskHandle);
+        }
+    }
+}
+
+bool SensorEngine::IsSensorHealthy(const uint32_t kId,
+                                   uint32_t&      rLastReads) const noexcept {
+    const S_SensorSlot* kpSlot;
+    uint32_t            reads;
+    bool                isHealthy;
+
+    isHealthy = false;
+    if (this->_sensorCount > kId) {
+        kpSlot = &this->_pSlots[kId];
+        reads = kpSlot->reads.load(std::memory_order_relaxed);
+        isHealthy = !kpSlot->needsInit.load() &&
+                    0 == kpSlot->failures.load(std::memory_order_relaxed) &&
+                    reads != rLastReads;
+        rLastReads = reads;
+    }
+
+    return isHealthy;
+}
+
+void SensorEngine::TaskRoutine(void* pParam) noexcept {
+    SensorEngine* pEngine;
+    uint64_t      currentTime;
+    uint64_t      waitNs;
+
+    pEngine = (SensorEngine*)pParam;
+
+    pEngine->_pTimeout->Notify();
+
+    while (true) {
+        currentTime = HWManager::GetTime();
+        pEngine->_pTimeout->Notify(currentTime);
+
+        waitNs = std::min(
+            pEngine->Acquire(currentTime),
+            (uint64_t)SENSOR_TASK_MAX_SLEEP_NS
+        );
+        pEngine->_pTimeout->SetWakeDeadline(currentTime + waitNs);
+        pEngine->_pTimeout->NotifyEnd();
+
+        /* Sleep until the next read or a restart request */
+        ulTaskNotifyTake(
+            pdTRUE,
+            (waitNs + 1000000ULL * portTICK_PERIOD_MS - 1) /
+            1000000ULL / portTICK_PERIOD_MS
+        );
+    }
+}
+
+void SensorEngine::DeadlineMissHandler(void) noexcept {
+    PANIC("Sensors task watchdog triggered.\n");
+}
+
+uint64_t SensorEngine::Acquire(const uint64_t kTime) noexcept {
+    S_SensorSample pSamples[SENSOR_MAX_CHANNELS];
+    S_SensorSlot*  pSlot;
+    E_Return       error;
+    uint64_t       nextRead;
+    uint32_t       count;
+    uint32_t       i;
+    uint32_t       j;
+    bool           isUpdated;
+
+    /* Start the new and failed sensors */
+    for (i = 0; this->_sensorCount > i; ++i) {
+        pSlot = &this->_pSlots[i];
+        pSlot->isRead = false;
+        if (pSlot->needsInit.load() && pSlot->nextRead <= kTime) {
+            error = pSlot->pSensor->Init();
+            if (E_Return::NO_ERROR == error) {
+                pSlot->needsInit.store(false);
+                pSlot->nextRead = kTime;
+                LOG_INFO("Started sensor %s.\n", pSlot->pSensor->GetName());
+            }
+            else {
+                pSlot->errors.fetch_add(1, std::memory_order_relaxed);
+                pSlot->failures.fetch_add(1, std::memory_order_relaxed);
+                pSlot->nextRead = kTime + SENSOR_INIT_RETRY_NS;
+                LOG_ERROR(
+                    "Failed to start sensor %s. Error %d\n",
+                    pSlot->pSensor->GetName(),
+                    error
+                );
+            }
+        }
+    }
+
+    /* One acquisition per bus, the frames are decoded without the bus */
+    ReadBus(E_SensorBus::SENSOR_BUS_SPI, kTime);
+    ReadBus(E_SensorBus::SENSOR_BUS_I2C, kTime);
+    ReadBus(E_SensorBus::SENSOR_BUS_NONE, kTime);
+
+    nextRead = kTime + SENSOR_TASK_MAX_SLEEP_NS;
+    isUpdated = false;
+    for (i = 0; this->_sensorCount > i; ++i) {
+        pSlot = &this->_pSlots[i];
+        if (pSlot->isRead) {
+            if (E_SensorBus::SENSOR_BUS_NONE == pSlot->transfer.bus) {
+                count = pSlot->pSensor->Decode(nullptr, pSamples);
+            }
+            else {
+                count = pSlot->pSensor->Decode(pSlot->pFrame, pSamples);
+            }
+
+            if (0 != count) {
+                for (j = 0; count > j; ++j) {
+                    pSamples[j].time = kTime;
+                    pSamples[j].sensorId = (uint8_t)i;
+                    Publish(pSamples[j]);
+                    UpdateLatest(pSamples[j]);
+                }
+                isUpdated = true;
+                pSlot->reads.fetch_add(1, std::memory_order_relaxed);
+                pSlot->failures.store(0, std::memory_order_relaxed);
+            }
+            else {
+                pSlot->errors.fetch_add(1, std::memory_order_relaxed);
+                pSlot->failures.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        nextRead = std::min(nextRead, pSlot->nextRead);
+    }
+
+    /* The readers copy all the channels of the cycle at once */
+    if (isUpdated) {
+        this->_latest.time = kTime;
+        SystemState::GetInstance()->PublishReadings(this->_latest);
+    }
+
+    return (nextRead > kTime) ? nextRead - kTime : 0;
+}
+
+void SensorEngine::ReadBus(const E_SensorBus kBus, const uint64_t kTime)
+noexcept {
+    S_SensorSlot* pSlot;
+    uint64_t      period;
+    uint32_t      i;
+    bool          isAcquired;
+    bool          isBusy;
+
+    isAcquired = false;
+    isBusy = false;
+    for (i = 0; this->_sensorCount > i && !isBusy; ++i) {
+        pSlot = &this->_pSlots[i];
+        if (kBus == pSlot->transfer.bus &&
+            !pSlot->needsInit.load() &&
+            pSlot->nextRead <= kTime) {
+            /* The bus is acquired for the first due sensor only */
+            if (!isAcquired) {
+                isAcquired = (E_Return::NO_ERROR == SensorBus::Acquire(kBus));
+                /* Busy bus, the sensors are read at the next cycle */
+                isBusy = !isAcquired;
+            }
+        }
+        else {
+            pSlot = nullptr;
+        }
+
+        if (nullptr != pSlot && isAcquired) {
+            if (E_SensorBus::SENSOR_BUS_NONE == kBus ||
+                E_Return::NO_ERROR == SensorBus::Read(
+                    pSlot->transfer,
+                    pSlot->pFrame
+                )) {
+                pSlot->isRead = true;
+            }
+            else {
+                pSlot->errors.fetch_add(1, std::memory_order_relaxed);
+                pSlot->failures.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /* Late reads do not accumulate, the schedule restarts from now */
+            period = pSlot->pSensor->GetPeriod();
+            pSlot->nextRead += period;
+            if (pSlot->nextRead <= kTime) {
+                pSlot->nextRead = kTime + period;
+            }
+        }
+    }
+
+    if (isAcquired) {
+        SensorBus::Release(kBus);
+    }
+}
+
+void SensorEngine::Publish(const S_SensorSample& krSample) noexcept {
+    uint32_t sequence;
+
+    /* Single writer, the slot is complete before the sequence moves */
+    sequence = this->_writeSeq.load(std::memory_order_relaxed);
+    this->_pRing[sequence & (SENSOR_RING_SIZE - 1)] = krSample;
+    this->_writeSeq.store(sequence + 1, std::memory_order_release);
+}
+
+void SensorEngine::UpdateLatest(const S_SensorSample& krSample) noexcept {
+    uint32_t i;
+    bool     isFound;
+
+    isFound = false;
+    for (i = 0; this->_latest.count > i && !isFound; ++i) {
+        if (krSample.sensorId == this->_latest.pReadings[i].sensorId &&
+            krSample.quantity == this->_latest.pReadings[i].quantity) {
+            this->_latest.pReadings[i] = krSample;
+            isFound = true;
+        }
+    }
+    if (!isFound && SYSTEM_LIVE_MAX_READINGS > this->_latest.count) {
+        this->_latest.pReadings[this->_latest.count] = krSample;
+        ++this->_latest.count;
+    }
+}
+
+SensorHealthReporter::SensorHealthReporter(const S_HMReporterParam& krParam,
+                                           SensorEngine*            pEngine,
+                                           const uint32_t           kId)
+noexcept : HMReporter(krParam) {
+    this->_pEngine = pEngine;
+    this->_id = kId;
+    this->_lastReads = 0;
+}
+
+SensorHealthReporter::~SensorHealthReporter(void) noexcept {
+    /* Nothing to do */
+}
+
+void SensorHealthReporter::OnDegraded(void) noexcept {
+    LOG_ERROR("Sensor %s is degraded, restarting.\n", GetName().c_str());
+    this->_pEngine->RequestInit(this->_id);
+}
+
+void SensorHealthReporter::OnUnhealthy(void) noexcept {
+    /* A missing sensor does not stop the node, the restarts are retried */
+    LOG_ERROR("Sensor %s is unhealthy.\n", GetName().c_str());
+    this->_pEngine->RequestInit(this->_id);
+}
+
+bool SensorHealthReporter::PerformCheck(void) noexcept {
+    return this->_pEngine->IsSensorHealthy(this->_id, this->_lastReads);
+}
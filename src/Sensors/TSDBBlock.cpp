@@ -0,0 +1,429 @@
+/*******************************************************************************
+ * @file TSDBBlock.cpp
+ *
+ * @see TSDBBlock.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Time series compressed block codec.
+ *
+ * @details Time series compressed block codec. The points of a series are
+ * packed in sector-sized blocks with delta-of-delta encoded timestamps and
+ * XOR encoded values.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstring>  /* memcpy, memset */
+#include <cstdint>  /* Standard integer definitions */
+#include <Errors.h> /* Errors definitions */
+
+/* Header file */
+#include <TSDBBlock.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Number of bits available after the header. */
+#define TSDB_BLOCK_BITS ((TSDB_BLOCK_SIZE - sizeof(S_TSDBBlockHeader)) * 8)
+
+/**
+ * @brief Maximal size of an encoded point in bits: the largest timestamp
+ * class and a value with a new XOR window.
+ */
+#define TSDB_POINT_MAX_BITS (4 + 64 + 2 + 5 + 5 + 32)
+
+/** @brief Number of timestamp classes after the zero delta-of-delta. */
+#define TSDB_TIME_CLASS_COUNT 4
+
+/** @brief No XOR window is defined yet. */
+#define TSDB_NO_WINDOW 32
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Timestamp delta-of-delta class. */
+typedef struct {
+    /** @brief The class prefix. */
+    uint8_t prefix;
+    /** @brief The class prefix length in bits. */
+    uint8_t prefixBits;
+    /** @brief The delta-of-delta length in bits. */
+    uint8_t valueBits;
+} S_TSDBTimeClass;
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/**
+ * @brief The timestamp classes, from the smallest. A class of n bits stores
+ * the delta-of-delta in [-(2^(n-1) - 1), 2^(n-1)], the last one is raw.
+ */
+static const S_TSDBTimeClass skTimeClasses[TSDB_TIME_CLASS_COUNT] = {
+    {0x2, 2, 7},
+    {0x6, 3, 9},
+    {0xE, 4, 12},
+    {0xF, 4, 64}
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+void TSDBBlock::Create(uint8_t* pBlock, S_TSDBCodec& rCodec) noexcept {
+    S_TSDBBlockHeader header;
+
+    memset(pBlock, 0, TSDB_BLOCK_SIZE);
+    header.magic = TSDB_BLOCK_MAGIC;
+    header.count = 0;
+    header.bitCount = 0;
+    header.firstTime = 0;
+    header.lastTime = 0;
+    memcpy(pBlock, &header, sizeof(S_TSDBBlockHeader));
+
+    rCodec.pBlock = pBlock;
+    rCodec.count = 0;
+    rCodec.index = 0;
+    rCodec.bitPos = 0;
+    rCodec.prevTime = 0;
+    rCodec.prevDelta = 0;
+    rCodec.prevValue = 0;
+    rCodec.prevLeading = TSDB_NO_WINDOW;
+    rCodec.prevTrailing = 0;
+}
+
+E_Return TSDBBlock::Append(S_TSDBCodec&  rCodec,
+                           const int64_t kTime,
+                           const float   kValue) noexcept {
+    S_TSDBBlockHeader header;
+    E_Return          error;
+    int64_t           delta;
+    int64_t           dod;
+    uint32_t          value;
+    uint32_t          xorValue;
+    uint8_t           leading;
+    uint8_t           trailing;
+    uint8_t           meaningful;
+    uint8_t           timeClass;
+
+    memcpy(&value, &kValue, sizeof(uint32_t));
+    TSDBBlock::GetHeader(rCodec.pBlock, header);
+
+    if (0 == rCodec.count) {
+        header.firstTime = kTime;
+        TSDBBlock::WriteBits(rCodec, value, 32);
+        delta = 0;
+        error = E_Return::NO_ERROR;
+    }
+    else if (kTime < rCodec.prevTime) {
+        delta = 0;
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+    else if (TSDB_BLOCK_BITS < rCodec.bitPos + TSDB_POINT_MAX_BITS ||
+             UINT16_MAX == rCodec.count) {
+        delta = 0;
+        error = E_Return::ERR_TSDB_BLOCK_FULL;
+    }
+    else {
+        /* Timestamp: a regular period only costs one bit */
+        delta = kTime - rCodec.prevTime;
+        dod = delta - rCodec.prevDelta;
+        if (0 == dod) {
+            TSDBBlock::WriteBits(rCodec, 0, 1);
+        }
+        else {
+            timeClass = 0;
+            while (TSDB_TIME_CLASS_COUNT - 1 > timeClass &&
+                   ((1LL << (skTimeClasses[timeClass].valueBits - 1)) < dod ||
+                    -((1LL << (skTimeClasses[timeClass].valueBits - 1)) - 1) >
+                    dod)) {
+                ++timeClass;
+            }
+            TSDBBlock::WriteBits(
+                rCodec,
+                skTimeClasses[timeClass].prefix,
+                skTimeClasses[timeClass].prefixBits
+            );
+            if (TSDB_TIME_CLASS_COUNT - 1 == timeClass) {
+                TSDBBlock::WriteBits(rCodec, (uint64_t)dod, 64);
+            }
+            else {
+                TSDBBlock::WriteBits(
+                    rCodec,
+                    (uint64_t)(dod +
+                    (1LL << (skTimeClasses[timeClass].valueBits - 1)) - 1),
+                    skTimeClasses[timeClass].valueBits
+                );
+            }
+        }
+
+        /* Value: only the bits changed from the previous one are stored */
+        xorValue = value ^ rCodec.prevValue;
+        if (0 == xorValue) {
+            TSDBBlock::WriteBits(rCodec, 0, 1);
+        }
+        else {
+            leading = __builtin_clz(xorValue);
+            trailing = __builtin_ctz(xorValue);
+            if (TSDB_NO_WINDOW != rCodec.prevLeading &&
+                leading >= rCodec.prevLeading &&
+                trailing >= rCodec.prevTrailing) {
+                meaningful = 32 - rCodec.prevLeading - rCodec.prevTrailing;
+                TSDBBlock::WriteBits(rCodec, 0x2, 2);
+                TSDBBlock::WriteBits(
+                    rCodec,
+                    xorValue >> rCodec.prevTrailing,
+                    meaningful
+                );
+            }
+            else {
+                meaningful = 32 - leading - trailing;
+                TSDBBlock::WriteBits(rCodec, 0x3, 2);
+                TSDBBlock::WriteBits(rCodec, leading, 5);
+                TSDBBlock::WriteBits(rCodec, meaningful - 1, 5);
+                TSDBBlock::WriteBits(rCodec, xorValue >> trailing, meaningful);
+                rCodec.prevLeading = leading;
+                rCodec.prevTrailing = trailing;
+            }
+        }
+        error = E_Return::NO_ERROR;
+    }
+
+    if (E_Return::NO_ERROR == error) {
+        rCodec.prevDelta = delta;
+        rCodec.prevTime = kTime;
+        rCodec.prevValue = value;
+        ++rCodec.count;
+        rCodec.index = rCodec.count;
+
+        header.count = rCodec.count;
+        header.bitCount = rCodec.bitPos;
+        header.lastTime = kTime;
+        memcpy(rCodec.pBlock, &header, sizeof(S_TSDBBlockHeader));
+    }
+
+    return error;
+}
+
+E_Return TSDBBlock::Open(uint8_t* pBlock, S_TSDBCodec& rCodec) noexcept {
+    S_TSDBBlockHeader header;
+    E_Return          error;
+
+    TSDBBlock::GetHeader(pBlock, header);
+    if (TSDB_BLOCK_MAGIC != header.magic ||
+        TSDB_BLOCK_BITS < header.bitCount ||
+        header.bitCount < header.count ||
+        header.lastTime < header.firstTime) {
+        error = E_Return::ERR_TSDB_INVALID_BLOCK;
+    }
+    else {
+        rCodec.pBlock = pBlock;
+        rCodec.count = header.count;
+        rCodec.index = 0;
+        rCodec.bitPos = 0;
+        rCodec.prevTime = header.firstTime;
+        rCodec.prevDelta = 0;
+        rCodec.prevValue = 0;
+        rCodec.prevLeading = TSDB_NO_WINDOW;
+        rCodec.prevTrailing = 0;
+        error = E_Return::NO_ERROR;
+    }
+
+    return error;
+}
+
+bool TSDBBlock::Next(S_TSDBCodec& rCodec,
+                     int64_t&     rTime,
+                     float&       rValue) noexcept {
+    S_TSDBBlockHeader header;
+    bool              isValid;
+    int64_t           dod;
+    uint32_t          xorValue;
+    uint8_t           timeClass;
+    uint8_t           meaningful;
+
+    isValid = rCodec.index < rCodec.count;
+    if (isValid && 0 == rCodec.index) {
+        rCodec.prevValue = (uint32_t)TSDBBlock::ReadBits(rCodec, 32);
+    }
+    else if (isValid) {
+        /* Timestamp class from its unary prefix */
+        dod = 0;
+        if (0 != TSDBBlock::ReadBits(rCodec, 1)) {
+            timeClass = 0;
+            while (TSDB_TIME_CLASS_COUNT - 1 > timeClass &&
+                   0 != TSDBBlock::ReadBits(rCodec, 1)) {
+                ++timeClass;
+            }
+            if (TSDB_TIME_CLASS_COUNT - 1 == timeClass) {
+                dod = (int64_t)TSDBBlock::ReadBits(rCodec, 64);
+            }
+            else {
+                dod = (int64_t)TSDBBlock::ReadBits(
+                    rCodec,
+                    skTimeClasses[timeClass].valueBits
+                ) - ((1LL << (skTimeClasses[timeClass].valueBits - 1)) - 1);
+            }
+        }
+        rCodec.prevDelta += dod;
+        rCodec.prevTime += rCodec.prevDelta;
+
+        /* Value */
+        if (0 != TSDBBlock::ReadBits(rCodec, 1)) {
+            if (0 != TSDBBlock::ReadBits(rCodec, 1)) {
+                rCodec.prevLeading = TSDBBlock::ReadBits(rCodec, 5);
+                meaningful = TSDBBlock::ReadBits(rCodec, 5) + 1;
+                if (32 < rCodec.prevLeading + meaningful) {
+                    isValid = false;
+                }
+                else {
+                    rCodec.prevTrailing = 32 - rCodec.prevLeading - meaningful;
+                }
+            }
+            else if (TSDB_NO_WINDOW == rCodec.prevLeading) {
+                isValid = false;
+            }
+
+            if (isValid) {
+                meaningful = 32 - rCodec.prevLeading - rCodec.prevTrailing;
+                xorValue = (uint32_t)TSDBBlock::ReadBits(rCodec, meaningful);
+                rCodec.prevValue ^= xorValue << rCodec.prevTrailing;
+            }
+        }
+    }
+
+    /* A corrupted stream ends the block */
+    TSDBBlock::GetHeader(rCodec.pBlock, header);
+    if (isValid && header.bitCount < rCodec.bitPos) {
+        isValid = false;
+    }
+
+    if (isValid) {
+        rTime = rCodec.prevTime;
+        memcpy(&rValue, &rCodec.prevValue, sizeof(float));
+        ++rCodec.index;
+    }
+    else {
+        rCodec.index = rCodec.count;
+    }
+
+    return isValid;
+}
+
+E_Return TSDBBlock::Resume(uint8_t* pBlock, S_TSDBCodec& rCodec) noexcept {
+    uint8_t* pData;
+    E_Return error;
+    uint32_t decoded;
+    int64_t  time;
+    float    value;
+
+    error = TSDBBlock::Open(pBlock, rCodec);
+    if (E_Return::NO_ERROR == error) {
+        decoded = 0;
+        while (TSDBBlock::Next(rCodec, time, value)) {
+            ++decoded;
+        }
+        if (decoded != rCodec.count) {
+            error = E_Return::ERR_TSDB_INVALID_BLOCK;
+        }
+        else if (TSDB_BLOCK_BITS > rCodec.bitPos) {
+            /* Clear the unused bits, the encoder only sets bits */
+            pData = pBlock + sizeof(S_TSDBBlockHeader) + rCodec.bitPos / 8;
+            *pData &= (uint8_t)(0xFF00 >> (rCodec.bitPos % 8));
+            memset(
+                pData + 1,
+                0,
+                TSDB_BLOCK_BITS / 8 - rCodec.bitPos / 8 - 1
+            );
+        }
+    }
+
+    return error;
+}
+
+void TSDBBlock::GetHeader(const uint8_t*     kpBlock,
+                          S_TSDBBlockHeader& rHeader) noexcept {
+    memcpy(&rHeader, kpBlock, sizeof(S_TSDBBlockHeader));
+}
+
+void TSDBBlock::WriteBits(S_TSDBCodec&   rCodec,
+                          const uint64_t kValue,
+                          const uint8_t  kCount) noexcept {
+    uint8_t* pData;
+    uint8_t  remaining;
+    uint8_t  free;
+    uint8_t  size;
+
+    /* Bits are packed from the most significant, a byte at most per step */
+    pData = rCodec.pBlock + sizeof(S_TSDBBlockHeader);
+    remaining = kCount;
+    while (0 < remaining) {
+        free = 8 - (rCodec.bitPos % 8);
+        size = (remaining < free) ? remaining : free;
+        pData[rCodec.bitPos / 8] |= (uint8_t)(
+            ((kValue >> (remaining - size)) & ((1U << size) - 1)) <<
+            (free - size)
+        );
+        rCodec.bitPos += size;
+        remaining -= size;
+    }
+}
+
+uint64_t TSDBBlock::ReadBits(S_TSDBCodec&  rCodec,
+                             const uint8_t kCount) noexcept {
+    const uint8_t* kpData;
+    uint64_t       value;
+    uint8_t        remaining;
+    uint8_t        free;
+    uint8_t        size;
+
+    kpData = rCodec.pBlock + sizeof(S_TSDBBlockHeader);
+    value = 0;
+    remaining = kCount;
+    while (0 < remaining && TSDB_BLOCK_BITS > rCodec.bitPos) {
+        free = 8 - (rCodec.bitPos % 8);
+        size = (remaining < free) ? remaining : free;
+        value = (value << size) |
+                ((kpData[rCodec.bitPos / 8] >> (free - size)) &
+                 ((1U << size) - 1));
+        rCodec.bitPos += size;
+        remaining -= size;
+    }
+
+    /* Reads past the block are seen as zeros and detected by the caller */
+    if (0 < remaining) {
+        value = (64 > remaining) ? (value << remaining) : 0;
+        rCodec.bitPos += remaining;
+    }
+
+    return value;
+}
@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * @file TSDBRollup.cpp
+ *
+ * @see TSDBRollup.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Time series rollup tiers.
+ *
+ * @details Time series rollup tiers. The raw series are aggregated in
+ * minute, hour and day buckets while they are stored, each tier has its own
+ * series and retention.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint> /* Standard integer definitions */
+
+/* Header file */
+#include <TSDBRollup.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Tier parameters. */
+typedef struct {
+    /** @brief The bucket period in milliseconds. */
+    int64_t period;
+    /** @brief The retention in milliseconds, 0 is forever. */
+    int64_t retention;
+} S_TSDBTierParam;
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The tiers parameters, from the finest. */
+static const S_TSDBTierParam skTiers[TSDB_TIER_MAX] = {
+    {0, TSDB_RETENTION_RAW_MS},
+    {60000LL, TSDB_RETENTION_MINUTE_MS},
+    {3600000LL, TSDB_RETENTION_HOUR_MS},
+    {86400000LL, TSDB_RETENTION_DAY_MS}
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+void TSDBRollup::Init(S_TSDBRollupState& rState,
+                      const uint16_t     kId) noexcept {
+    uint8_t i;
+
+    rState.id = kId;
+    rState.isUsed = true;
+    for (i = 0; TSDB_TIER_MAX > i; ++i) {
+        rState.pBuckets[i].start = 0;
+        rState.pBuckets[i].count = 0;
+        rState.pBuckets[i].min = 0.0f;
+        rState.pBuckets[i].max = 0.0f;
+        rState.pBuckets[i].sum = 0.0;
+    }
+}
+
+bool TSDBRollup::Add(S_TSDBBucket&    rBucket,
+                     const E_TSDBTier kTier,
+                     const int64_t    kTime,
+                     const float      kValue,
+                     S_TSDBBucket&    rClosed) noexcept {
+    int64_t start;
+    bool    isClosed;
+
+    /* Buckets are aligned on the period, negative times round down */
+    start = kTime - kTime % skTiers[kTier].period;
+    if (0 > kTime % skTiers[kTier].period) {
+        start -= skTiers[kTier].period;
+    }
+
+    isClosed = false;
+    if (0 != rBucket.count && start != rBucket.start) {
+        rClosed = rBucket;
+        rBucket.count = 0;
+        isClosed = true;
+    }
+
+    if (0 == rBucket.count) {
+        rBucket.start = start;
+        rBucket.min = kValue;
+        rBucket.max = kValue;
+        rBucket.sum = 0.0;
+    }
+    else if (kValue < rBucket.min) {
+        rBucket.min = kValue;
+    }
+    else if (kValue > rBucket.max) {
+        rBucket.max = kValue;
+    }
+    rBucket.sum += kValue;
+    ++rBucket.count;
+
+    return isClosed;
+}
+
+float TSDBRollup::GetAggregate(const S_TSDBBucket&   krBucket,
+                               const E_TSDBAggregate kAggregate) noexcept {
+    float value;
+
+    if (E_TSDBAggregate::TSDB_AGG_MIN == kAggregate) {
+        value = krBucket.min;
+    }
+    else if (E_TSDBAggregate::TSDB_AGG_MAX == kAggregate) {
+        value = krBucket.max;
+    }
+    else {
+        value = (float)(krBucket.sum / krBucket.count);
+    }
+
+    return value;
+}
+
+int64_t TSDBRollup::GetPeriod(const E_TSDBTier kTier) noexcept {
+    return skTiers[kTier].period;
+}
+
+int64_t TSDBRollup::GetRetention(const E_TSDBTier kTier) noexcept {
+    return skTiers[kTier].retention;
+}
+
+E_TSDBTier TSDBRollup::SelectTier(const int64_t kStep,
+                                  const int64_t kFrom,
+                                  const int64_t kNow) noexcept {
+    uint8_t tier;
+
+    /* Coarsest tier still finer than the resolution */
+    tier = E_TSDBTier::TSDB_TIER_RAW;
+    while (TSDB_TIER_MAX - 1 > tier && skTiers[tier + 1].period <= kStep) {
+        ++tier;
+    }
+
+    /* The finer tiers may not cover the range anymore */
+    while (TSDB_TIER_MAX - 1 > tier &&
+           0 != skTiers[tier].retention &&
+           kNow - skTiers[tier].retention > kFrom) {
+        ++tier;
+    }
+
+    return (E_TSDBTier)tier;
+}
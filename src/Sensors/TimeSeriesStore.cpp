@@ -0,0 +1,1098 @@
+/*******************************************************************************
+ * @file TimeSeriesStore.cpp
+ *
+ * @see TimeSeriesStore.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Compressed time-series store.
+ *
+ * @details Compressed time-series store. Each series is stored on the SD card
+ * in append-only segment files of compressed sector-sized blocks, with a
+ * block time index used for the range reads.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_CORE
+
+/* Included headers */
+#include <cstring>         /* memcpy, memset */
+#include <cstdint>         /* Standard integer definitions */
+#include <BSP.h>           /* Time services */
+#include <Errors.h>        /* Errors definitions */
+#include <Logger.h>        /* Logger services */
+#include <Sensor.h>        /* Sensor samples */
+#include <Storage.h>       /* Storage manager */
+#include <TSDBBlock.h>     /* Block codec */
+#include <TSDBRollup.h>    /* Rollup tiers */
+#include <SystemState.h>   /* System state */
+#include <TaskRegistry.h>  /* Firmware tasks registry */
+#include <SensorEngine.h>  /* Samples ring */
+#include <esp_heap_caps.h> /* Capability based allocation */
+
+/* Header file */
+#include <TimeSeriesStore.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Number of samples read from the ring at once. */
+#define TSDB_INGEST_BATCH 64
+
+/** @brief Defines the series states lock timeout in nanoseconds. */
+#define TSDB_LOCK_TIMEOUT_NS (2 * STORAGE_BUS_TIMEOUT_NS)
+/** @brief Defines the series states lock timeout in ticks. */
+#define TSDB_LOCK_TIMEOUT_TICKS \
+    (pdMS_TO_TICKS(TSDB_LOCK_TIMEOUT_NS / 1000000ULL))
+
+/** @brief Defines the store files prefix. */
+#define TSDB_PATH "rthr_tsdb"
+/** @brief Defines the store time base file path. */
+#define TSDB_TIME_PATH "rthr_tsdb.time"
+
+static_assert(
+    64 >= SENSOR_MAX_SENSORS,
+    "The raw series identifiers must fit the rollup identifiers."
+);
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/** @brief Series catalog, the range of segments of a series. */
+typedef struct __attribute__((packed)) {
+    /** @brief The oldest segment. */
+    uint32_t firstSegment;
+    /** @brief The newest segment. */
+    uint32_t lastSegment;
+} S_TSDBCatalog;
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Builds the path of a series segment.
+ *
+ * @param[in] kId The series identifier.
+ * @param[in] kSegment The segment.
+ * @param[out] pPath The buffer receiving the path, must be at least
+ * TSDB_PATH_SIZE bytes.
+ */
+static void GetSegmentPath(const uint16_t kId,
+                           const uint32_t kSegment,
+                           char*          pPath) noexcept;
+
+/**
+ * @brief Builds the path of a series segment block index.
+ *
+ * @param[in] kId The series identifier.
+ * @param[in] kSegment The segment.
+ * @param[out] pPath The buffer receiving the path, must be at least
+ * TSDB_PATH_SIZE bytes.
+ */
+static void GetIndexPath(const uint16_t kId,
+                         const uint32_t kSegment,
+                         char*          pPath) noexcept;
+
+/**
+ * @brief Builds the path of a series catalog.
+ *
+ * @param[in] kId The series identifier.
+ * @param[out] pPath The buffer receiving the path, must be at least
+ * TSDB_PATH_SIZE bytes.
+ */
+static void GetCatalogPath(const uint16_t kId, char* pPath) noexcept;
+
+/**
+ * @brief Reads an entry of a block index.
+ *
+ * @param[in] rIndex The open block index.
+ * @param[in] kBlock The block of the entry.
+ * @param[out] rEntry The entry read.
+ *
+ * @return true if the entry was read, false otherwise.
+ */
+static bool ReadIndexEntry(FsFile&           rIndex,
+                           const uint32_t    kBlock,
+                           S_TSDBIndexEntry& rEntry) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static void GetSegmentPath(const uint16_t kId,
+                           const uint32_t kSegment,
+                           char*          pPath) noexcept {
+    snprintf(
+        pPath,
+        TSDB_PATH_SIZE,
+        "%s_%04x.%u",
+        TSDB_PATH,
+        (unsigned int)kId,
+        (unsigned int)kSegment
+    );
+}
+
+static void GetIndexPath(const uint16_t kId,
+                         const uint32_t kSegment,
+                         char*          pPath) noexcept {
+    snprintf(
+        pPath,
+        TSDB_PATH_SIZE,
+        "%s_%04x.%u.idx",
+        TSDB_PATH,
+        (unsigned int)kId,
+        (unsigned int)kSegment
+    );
+}
+
+static void GetCatalogPath(const uint16_t kId, char* pPath) noexcept {
+    snprintf(
+        pPath,
+        TSDB_PATH_SIZE,
+        "%s_%04x.cat",
+        TSDB_PATH,
+        (unsigned int)kId
+    );
+}
+
+static bool ReadIndexEntry(FsFile&           rIndex,
+                           const uint32_t    kBlock,
+                           S_TSDBIndexEntry& rEntry) noexcept {
+    return rIndex.seekSet(kBlock * sizeof(S_TSDBIndexEntry)) &&
+           sizeof(S_TSDBIndexEntry) ==
+           rIndex.read(&rEntry, sizeof(S_TSDBIndexEntry));
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+TimeSeriesStore::TimeSeriesStore(void) noexcept {
+    uint32_t i;
+
+    this->_timeBase = 0;
+    this->_readSeq = 0;
+    this->_lastFlush = 0;
+    this->_taskHandle = nullptr;
+    memset(&this->_stats, 0, sizeof(S_TSDBStats));
+
+    /* The open blocks are allocated once, external memory is preferred */
+    this->_pBlocks = (uint8_t*)heap_caps_malloc(
+        TSDB_MAX_SERIES * TSDB_BLOCK_SIZE,
+        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+    );
+    if (nullptr == this->_pBlocks) {
+        this->_pBlocks = (uint8_t*)heap_caps_malloc(
+            TSDB_MAX_SERIES * TSDB_BLOCK_SIZE,
+            MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+        );
+    }
+    if (nullptr == this->_pBlocks) {
+        PANIC("Failed to allocate the time series blocks.\n");
+    }
+
+    for (i = 0; TSDB_MAX_SERIES > i; ++i) {
+        this->_pSeries[i].isUsed = false;
+        this->_pSeries[i].pBlock = this->_pBlocks + i * TSDB_BLOCK_SIZE;
+    }
+    for (i = 0; TSDB_MAX_ROLLUPS > i; ++i) {
+        this->_pRollups[i].isUsed = false;
+    }
+
+    this->_lock = xSemaphoreCreateMutex();
+    if (nullptr == this->_lock) {
+        PANIC("Failed to create the time series store lock.\n");
+    }
+
+    SystemState::GetInstance()->SetTimeSeriesStore(this);
+
+    LOG_DEBUG("Time series store initialized.\n");
+}
+
+TimeSeriesStore::~TimeSeriesStore(void) noexcept {
+    PANIC("Tried to destroy the Time series store.\n");
+}
+
+E_Return TimeSeriesStore::Start(void) noexcept {
+    bool       isCreated;
+    E_Return   error;
+
+    error = E_Return::NO_ERROR;
+    if (nullptr == this->_taskHandle) {
+        LoadTimeBase();
+        this->_lastFlush = HWManager::GetTime();
+
+        isCreated = TaskRegistry::CreateTask(
+            E_TaskId::TASK_ID_TSDB,
+            TimeSeriesStore::TaskRoutine,
+            this,
+            this->_taskHandle
+        );
+        if (!isCreated) {
+            LOG_ERROR("Failed to create the time series store task.\n");
+            error = E_Return::ERR_MEMORY;
+        }
+        else {
+            LOG_INFO("Started the time series store.\n");
+        }
+    }
+
+    return error;
+}
+
+int64_t TimeSeriesStore::GetStoreTime(const uint64_t kTimeNs) const noexcept {
+    return this->_timeBase + (int64_t)(kTimeNs / 1000000ULL);
+}
+
+E_Return TimeSeriesStore::Append(const uint16_t kId,
+                                 const int64_t  kTime,
+                                 const float    kValue) noexcept {
+    S_TSDBSeries* pSeries;
+    E_Return      error;
+    E_Return      writeError;
+
+    if (pdPASS == xSemaphoreTake(this->_lock, TSDB_LOCK_TIMEOUT_TICKS)) {
+        pSeries = GetSeries(kId);
+        if (nullptr == pSeries) {
+            error = E_Return::ERR_TSDB_FULL;
+        }
+        else {
+            error = TSDBBlock::Append(pSeries->codec, kTime, kValue);
+            if (E_Return::ERR_TSDB_BLOCK_FULL == error) {
+                /* The point starts the next block, even if the write failed */
+                writeError = WriteBlock(pSeries, true);
+                error = TSDBBlock::Append(pSeries->codec, kTime, kValue);
+                if (E_Return::NO_ERROR != writeError) {
+                    error = writeError;
+                }
+            }
+            if (0 != pSeries->codec.count) {
+                pSeries->isDirty = true;
+            }
+            if (E_Return::NO_ERROR == error ||
+                E_Return::ERR_TSDB_STORAGE == error) {
+                ++this->_stats.points;
+            }
+        }
+
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the time series store lock.\n");
+        }
+    }
+    else {
+        error = E_Return::ERR_TSDB_STORAGE;
+    }
+
+    return error;
+}
+
+void TimeSeriesStore::Flush(void) noexcept {
+    uint32_t i;
+
+    if (pdPASS == xSemaphoreTake(this->_lock, TSDB_LOCK_TIMEOUT_TICKS)) {
+        for (i = 0; TSDB_MAX_SERIES > i; ++i) {
+            if (this->_pSeries[i].isUsed && this->_pSeries[i].isDirty) {
+                WriteBlock(&this->_pSeries[i], false);
+            }
+        }
+
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the time series store lock.\n");
+        }
+    }
+    else {
+        LOG_ERROR("Failed to acquire the time series store lock.\n");
+    }
+
+    this->_lastFlush = HWManager::GetTime();
+}
+
+E_Return TimeSeriesStore::RemoveSeries(const uint16_t kId) noexcept {
+    Storage* pStorage;
+    E_Return error;
+    char     pPath[TSDB_PATH_SIZE];
+    uint32_t first;
+    uint32_t last;
+    uint32_t blockCount;
+    uint32_t i;
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr == pStorage) {
+        error = E_Return::ERR_TSDB_STORAGE;
+    }
+    else if (pdPASS == xSemaphoreTake(this->_lock, TSDB_LOCK_TIMEOUT_TICKS)) {
+        error = pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS);
+        if (E_Return::NO_ERROR == error) {
+            if (ReadCatalog(kId, first, last, blockCount)) {
+                for (i = first; last >= i; ++i) {
+                    GetSegmentPath(kId, i, pPath);
+                    pStorage->Remove(pPath);
+                    GetIndexPath(kId, i, pPath);
+                    pStorage->Remove(pPath);
+                }
+                GetCatalogPath(kId, pPath);
+                pStorage->Remove(pPath);
+            }
+            pStorage->ReleaseSPIBus();
+
+            /* The series is loaded again on its next point */
+            for (i = 0; TSDB_MAX_SERIES > i; ++i) {
+                if (this->_pSeries[i].isUsed && kId == this->_pSeries[i].id) {
+                    this->_pSeries[i].isUsed = false;
+                    --this->_stats.seriesCount;
+                }
+            }
+        }
+
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the time series store lock.\n");
+        }
+    }
+    else {
+        error = E_Return::ERR_TSDB_STORAGE;
+    }
+
+    return error;
+}
+
+E_Return TimeSeriesStore::OpenCursor(const uint16_t kId,
+                                     const int64_t  kFrom,
+                                     const int64_t  kTo,
+                                     S_TSDBCursor&  rCursor) noexcept {
+    Storage* pStorage;
+    E_Return error;
+    uint32_t first;
+    uint32_t blockCount;
+    uint32_t i;
+    bool     isFound;
+
+    rCursor.id = kId;
+    rCursor.from = kFrom;
+    rCursor.to = kTo;
+    rCursor.segment = 0;
+    rCursor.lastSegment = 0;
+    rCursor.block = 0;
+    rCursor.period = 0;
+    rCursor.isBlockOpen = false;
+    rCursor.isDone = true;
+
+    isFound = false;
+    first = 0;
+    blockCount = 0;
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (kTo < kFrom) {
+        error = E_Return::ERR_INVALID_PARAM;
+    }
+    else if (nullptr == pStorage) {
+        error = E_Return::ERR_TSDB_STORAGE;
+    }
+    else if (pdPASS == xSemaphoreTake(this->_lock, TSDB_LOCK_TIMEOUT_TICKS)) {
+        /* The loaded series are ahead of their catalog */
+        for (i = 0; TSDB_MAX_SERIES > i && !isFound; ++i) {
+            if (this->_pSeries[i].isUsed && kId == this->_pSeries[i].id) {
+                first = this->_pSeries[i].firstSegment;
+                rCursor.lastSegment = this->_pSeries[i].lastSegment;
+                blockCount = this->_pSeries[i].blockCount;
+                isFound = true;
+            }
+        }
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the time series store lock.\n");
+        }
+
+        error = pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS);
+        if (E_Return::NO_ERROR == error) {
+            if (!isFound) {
+                isFound = ReadCatalog(
+                    kId,
+                    first,
+                    rCursor.lastSegment,
+                    blockCount
+                );
+            }
+            if (isFound) {
+                rCursor.isDone = false;
+                SeekCursor(rCursor, first, blockCount);
+            }
+            else {
+                error = E_Return::ERR_NO_SUCH_ID;
+            }
+            pStorage->ReleaseSPIBus();
+        }
+    }
+    else {
+        error = E_Return::ERR_TSDB_STORAGE;
+    }
+
+    return error;
+}
+
+E_Return TimeSeriesStore::OpenRangeCursor(const uint16_t        kId,
+                                          const E_TSDBAggregate kAggregate,
+                                          const int64_t         kFrom,
+                                          const int64_t         kTo,
+                                          const int64_t         kStep,
+                                          S_TSDBCursor&         rCursor)
+noexcept {
+    E_TSDBTier tier;
+    E_Return   error;
+    int64_t    period;
+    int64_t    from;
+
+    tier = TSDBRollup::SelectTier(
+        kStep,
+        kFrom,
+        GetStoreTime(HWManager::GetTime())
+    );
+    if (E_TSDBTier::TSDB_TIER_RAW == tier) {
+        error = OpenCursor(kId, kFrom, kTo, rCursor);
+    }
+    else {
+        /* The bucket holding the range start is stored at its start */
+        period = TSDBRollup::GetPeriod(tier);
+        from = kFrom - kFrom % period;
+        if (0 > kFrom % period) {
+            from -= period;
+        }
+        error = OpenCursor(
+            TSDB_ROLLUP_ID(kId, tier, kAggregate),
+            from,
+            kTo,
+            rCursor
+        );
+        rCursor.period = period;
+    }
+
+    return error;
+}
+
+bool TimeSeriesStore::ReadCursor(S_TSDBCursor& rCursor,
+                                 int64_t&      rTime,
+                                 float&        rValue) noexcept {
+    bool isFound;
+
+    isFound = false;
+    while (!isFound && !rCursor.isDone) {
+        if (!rCursor.isBlockOpen) {
+            LoadCursorBlock(rCursor);
+        }
+        else if (TSDBBlock::Next(rCursor.codec, rTime, rValue)) {
+            if (rCursor.to < rTime) {
+                rCursor.isDone = true;
+            }
+            else if (rCursor.from <= rTime) {
+                isFound = true;
+            }
+        }
+        else {
+            rCursor.isBlockOpen = false;
+            ++rCursor.block;
+        }
+    }
+
+    return isFound;
+}
+
+void TimeSeriesStore::GetStats(S_TSDBStats& rStats) const noexcept {
+    if (pdPASS == xSemaphoreTake(this->_lock, TSDB_LOCK_TIMEOUT_TICKS)) {
+        rStats = this->_stats;
+        if (pdPASS != xSemaphoreGive(this->_lock)) {
+            PANIC("Failed to release the time series store lock.\n");
+        }
+    }
+    else {
+        memset(&rStats, 0, sizeof(S_TSDBStats));
+    }
+}
+
+void TimeSeriesStore::TaskRoutine(void* pParam) noexcept {
+    TimeSeriesStore* pStore;
+
+    pStore = (TimeSeriesStore*)pParam;
+
+    while (true) {
+        pStore->Ingest();
+        if (TSDB_FLUSH_PERIOD_NS <= HWManager::GetTime() - pStore->_lastFlush) {
+            pStore->Flush();
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(TSDB_TASK_PERIOD_NS / 1000000ULL));
+    }
+}
+
+void TimeSeriesStore::Ingest(void) noexcept {
+    S_SensorSample pSamples[TSDB_INGEST_BATCH];
+    SensorEngine*  pEngine;
+    int64_t        time;
+    uint32_t       sequence;
+    uint32_t       count;
+    uint32_t       i;
+    uint16_t       id;
+
+    pEngine = SystemState::GetInstance()->GetSensorEngine();
+    if (nullptr != pEngine) {
+        do {
+            /* The ring skips the samples overwritten before being read */
+            sequence = this->_readSeq;
+            count = pEngine->ReadSamples(
+                this->_readSeq,
+                pSamples,
+                TSDB_INGEST_BATCH
+            );
+            this->_stats.dropped += this->_readSeq - sequence - count;
+
+            for (i = 0; count > i; ++i) {
+                id = TSDB_SERIES_ID(pSamples[i].sensorId, pSamples[i].quantity);
+                time = GetStoreTime(pSamples[i].time);
+                if (E_Return::ERR_INVALID_PARAM != Append(id,
+                                                          time,
+                                                          pSamples[i].value)) {
+                    Rollup(id, time, pSamples[i].value);
+                }
+            }
+        } while (TSDB_INGEST_BATCH == count);
+    }
+}
+
+void TimeSeriesStore::Rollup(const uint16_t kId,
+                             const int64_t  kTime,
+                             const float    kValue) noexcept {
+    S_TSDBRollupState* pState;
+    S_TSDBBucket       closed;
+    uint32_t           i;
+    uint8_t            tier;
+    uint8_t            aggregate;
+
+    pState = nullptr;
+    for (i = 0; TSDB_MAX_ROLLUPS > i && nullptr == pState; ++i) {
+        if (this->_pRollups[i].isUsed && kId == this->_pRollups[i].id) {
+            pState = &this->_pRollups[i];
+        }
+    }
+    for (i = 0; TSDB_MAX_ROLLUPS > i && nullptr == pState; ++i) {
+        if (!this->_pRollups[i].isUsed) {
+            pState = &this->_pRollups[i];
+            TSDBRollup::Init(*pState, kId);
+        }
+    }
+
+    if (nullptr != pState) {
+        for (tier = E_TSDBTier::TSDB_TIER_MINUTE;
+             TSDB_TIER_MAX > tier;
+             ++tier) {
+            if (TSDBRollup::Add(pState->pBuckets[tier],
+                                (E_TSDBTier)tier,
+                                kTime,
+                                kValue,
+                                closed)) {
+                for (aggregate = E_TSDBAggregate::TSDB_AGG_AVG;
+                     TSDB_AGG_MAX_ID > aggregate;
+                     ++aggregate) {
+                    Append(
+                        TSDB_ROLLUP_ID(kId, tier, aggregate),
+                        closed.start,
+                        TSDBRollup::GetAggregate(
+                            closed,
+                            (E_TSDBAggregate)aggregate
+                        )
+                    );
+                }
+            }
+        }
+    }
+}
+
+void TimeSeriesStore::ApplyRetention(S_TSDBSeries* pSeries,
+                                     const int64_t kNow) noexcept {
+    Storage*         pStorage;
+    FsFile           index;
+    S_TSDBIndexEntry entry;
+    char             pPath[TSDB_PATH_SIZE];
+    int64_t          retention;
+    bool             isExpired;
+    bool             isChanged;
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    retention = TSDBRollup::GetRetention(TSDB_SERIES_TIER(pSeries->id));
+    isChanged = false;
+    isExpired = nullptr != pStorage && 0 != retention;
+    while (isExpired && pSeries->firstSegment < pSeries->lastSegment) {
+        /* The last block of a segment holds its newest point */
+        GetIndexPath(pSeries->id, pSeries->firstSegment, pPath);
+        index = pStorage->Open(pPath, O_RDONLY);
+        isExpired = index.isOpen() &&
+                    ReadIndexEntry(index, TSDB_SEGMENT_BLOCKS - 1, entry) &&
+                    kNow - retention > entry.lastTime;
+        index.close();
+
+        if (isExpired) {
+            pStorage->Remove(pPath);
+            GetSegmentPath(pSeries->id, pSeries->firstSegment, pPath);
+            pStorage->Remove(pPath);
+            ++pSeries->firstSegment;
+            isChanged = true;
+        }
+    }
+
+    if (isChanged) {
+        WriteCatalog(pSeries);
+    }
+}
+
+S_TSDBSeries* TimeSeriesStore::GetSeries(const uint16_t kId) noexcept {
+    S_TSDBSeries* pSeries;
+    S_TSDBSeries* pFree;
+    uint32_t      i;
+
+    pSeries = nullptr;
+    pFree = nullptr;
+    for (i = 0; TSDB_MAX_SERIES > i && nullptr == pSeries; ++i) {
+        if (!this->_pSeries[i].isUsed) {
+            if (nullptr == pFree) {
+                pFree = &this->_pSeries[i];
+            }
+        }
+        else if (kId == this->_pSeries[i].id) {
+            pSeries = &this->_pSeries[i];
+        }
+    }
+
+    if (nullptr == pSeries && nullptr != pFree) {
+        pSeries = pFree;
+        pSeries->id = kId;
+        LoadSeries(pSeries);
+        pSeries->isUsed = true;
+        ++this->_stats.seriesCount;
+    }
+    else if (nullptr == pSeries) {
+        LOG_ERROR("No free time series for series 0x%04x.\n", kId);
+    }
+
+    return pSeries;
+}
+
+void TimeSeriesStore::LoadSeries(S_TSDBSeries* pSeries) noexcept {
+    Storage* pStorage;
+    bool     isFound;
+    bool     isResumed;
+
+    pSeries->isDirty = false;
+    pSeries->firstSegment = 0;
+    pSeries->lastSegment = 0;
+    pSeries->blockCount = 0;
+    isResumed = false;
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage &&
+        E_Return::NO_ERROR == pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        isFound = ReadCatalog(
+            pSeries->id,
+            pSeries->firstSegment,
+            pSeries->lastSegment,
+            pSeries->blockCount
+        );
+        if (isFound && TSDB_SEGMENT_BLOCKS <= pSeries->blockCount) {
+            /* Stopped before the next segment was recorded */
+            ++pSeries->lastSegment;
+            pSeries->blockCount = 0;
+            isFound = false;
+        }
+
+        if (!isFound) {
+            WriteCatalog(pSeries);
+        }
+        else if (ReadBlock(pSeries->id,
+                           pSeries->lastSegment,
+                           pSeries->blockCount,
+                           pSeries->pBlock)) {
+            /* Continue the open block written by the last flush */
+            isResumed = E_Return::NO_ERROR == TSDBBlock::Resume(
+                pSeries->pBlock,
+                pSeries->codec
+            );
+        }
+
+        if (isResumed) {
+            ApplyRetention(pSeries, pSeries->codec.prevTime);
+        }
+
+        pStorage->ReleaseSPIBus();
+    }
+    else {
+        ++this->_stats.errors;
+    }
+
+    if (!isResumed) {
+        TSDBBlock::Create(pSeries->pBlock, pSeries->codec);
+    }
+}
+
+E_Return TimeSeriesStore::WriteBlock(S_TSDBSeries* pSeries,
+                                     const bool    kIsSealed) noexcept {
+    Storage*          pStorage;
+    FsFile            file;
+    E_Return          error;
+    S_TSDBBlockHeader header;
+    S_TSDBIndexEntry  entry;
+    char              pPath[TSDB_PATH_SIZE];
+
+    error = E_Return::ERR_TSDB_STORAGE;
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage &&
+        E_Return::NO_ERROR == pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        /* The block is written at its position, the file is only appended */
+        GetSegmentPath(pSeries->id, pSeries->lastSegment, pPath);
+        file = pStorage->Open(pPath, O_RDWR | O_CREAT);
+        if (file.isOpen()) {
+            if (0 == file.size()) {
+                /* Keep the append cost flat with a contiguous extent */
+                file.preAllocate(TSDB_SEGMENT_BLOCKS * TSDB_BLOCK_SIZE);
+            }
+            if (file.seekSet(pSeries->blockCount * TSDB_BLOCK_SIZE) &&
+                TSDB_BLOCK_SIZE == file.write(pSeries->pBlock,
+                                              TSDB_BLOCK_SIZE)) {
+                error = E_Return::NO_ERROR;
+            }
+            file.close();
+        }
+
+        if (E_Return::NO_ERROR == error && kIsSealed) {
+            TSDBBlock::GetHeader(pSeries->pBlock, header);
+            entry.firstTime = header.firstTime;
+            entry.lastTime = header.lastTime;
+            GetIndexPath(pSeries->id, pSeries->lastSegment, pPath);
+            file = pStorage->Open(pPath, O_WRONLY | O_CREAT | O_APPEND);
+            if (!file.isOpen() ||
+                sizeof(S_TSDBIndexEntry) !=
+                file.write(&entry, sizeof(S_TSDBIndexEntry))) {
+                error = E_Return::ERR_TSDB_STORAGE;
+            }
+            file.close();
+
+            if (E_Return::NO_ERROR == error) {
+                ++this->_stats.blocks;
+                ++pSeries->blockCount;
+                if (TSDB_SEGMENT_BLOCKS <= pSeries->blockCount) {
+                    ++pSeries->lastSegment;
+                    pSeries->blockCount = 0;
+                    WriteCatalog(pSeries);
+                    ApplyRetention(pSeries, header.lastTime);
+                }
+            }
+        }
+
+        if (E_Return::NO_ERROR == error) {
+            SaveTimeBase();
+        }
+
+        pStorage->ReleaseSPIBus();
+    }
+
+    if (E_Return::NO_ERROR == error) {
+        pSeries->isDirty = false;
+    }
+    else {
+        ++this->_stats.errors;
+        LOG_ERROR("Failed to write series 0x%04x.\n", pSeries->id);
+    }
+
+    /* On error the block is dropped, the points cannot be kept forever */
+    if (kIsSealed) {
+        TSDBBlock::Create(pSeries->pBlock, pSeries->codec);
+    }
+
+    return error;
+}
+
+bool TimeSeriesStore::ReadCatalog(const uint16_t kId,
+                                  uint32_t&      rFirst,
+                                  uint32_t&      rLast,
+                                  uint32_t&      rBlockCount) const noexcept {
+    Storage*      pStorage;
+    FsFile        file;
+    S_TSDBCatalog catalog;
+    char          pPath[TSDB_PATH_SIZE];
+    bool          isFound;
+
+    isFound = false;
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage) {
+        GetCatalogPath(kId, pPath);
+        file = pStorage->Open(pPath, O_RDONLY);
+        if (file.isOpen()) {
+            isFound = sizeof(S_TSDBCatalog) ==
+                      file.read(&catalog, sizeof(S_TSDBCatalog)) &&
+                      catalog.firstSegment <= catalog.lastSegment;
+            file.close();
+        }
+    }
+
+    if (isFound) {
+        rFirst = catalog.firstSegment;
+        rLast = catalog.lastSegment;
+        rBlockCount = 0;
+        GetIndexPath(kId, rLast, pPath);
+        file = pStorage->Open(pPath, O_RDONLY);
+        if (file.isOpen()) {
+            rBlockCount = file.size() / sizeof(S_TSDBIndexEntry);
+            file.close();
+        }
+    }
+
+    return isFound;
+}
+
+void TimeSeriesStore::WriteCatalog(const S_TSDBSeries* kpSeries) const
+noexcept {
+    Storage*      pStorage;
+    FsFile        file;
+    S_TSDBCatalog catalog;
+    char          pPath[TSDB_PATH_SIZE];
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage) {
+        catalog.firstSegment = kpSeries->firstSegment;
+        catalog.lastSegment = kpSeries->lastSegment;
+        GetCatalogPath(kpSeries->id, pPath);
+        file = pStorage->Open(pPath, O_WRONLY | O_CREAT | O_TRUNC);
+        if (file.isOpen()) {
+            file.write(&catalog, sizeof(S_TSDBCatalog));
+            file.close();
+        }
+    }
+}
+
+void TimeSeriesStore::SeekCursor(S_TSDBCursor&  rCursor,
+                                 const uint32_t kFirst,
+                                 const uint32_t kBlockCount) const noexcept {
+    Storage*         pStorage;
+    FsFile           index;
+    S_TSDBIndexEntry entry;
+    char             pPath[TSDB_PATH_SIZE];
+    uint32_t         low;
+    uint32_t         high;
+    uint32_t         middle;
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+
+    /* Last segment starting before the range */
+    rCursor.segment = kFirst;
+    low = kFirst;
+    high = rCursor.lastSegment + 1;
+    while (low < high) {
+        middle = low + (high - low) / 2;
+        GetIndexPath(rCursor.id, middle, pPath);
+        index = pStorage->Open(pPath, O_RDONLY);
+        if (index.isOpen() &&
+            ReadIndexEntry(index, 0, entry) &&
+            entry.firstTime <= rCursor.from) {
+            rCursor.segment = middle;
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+        index.close();
+    }
+
+    /* First block of the segment ending in the range */
+    low = 0;
+    if (rCursor.lastSegment == rCursor.segment) {
+        high = kBlockCount;
+    }
+    else {
+        high = TSDB_SEGMENT_BLOCKS;
+    }
+    GetIndexPath(rCursor.id, rCursor.segment, pPath);
+    index = pStorage->Open(pPath, O_RDONLY);
+    if (index.isOpen()) {
+        while (low < high) {
+            middle = low + (high - low) / 2;
+            if (ReadIndexEntry(index, middle, entry) &&
+                entry.lastTime < rCursor.from) {
+                low = middle + 1;
+            }
+            else {
+                high = middle;
+            }
+        }
+        index.close();
+    }
+    rCursor.block = low;
+}
+
+bool TimeSeriesStore::LoadCursorBlock(S_TSDBCursor& rCursor) noexcept {
+    Storage*          pStorage;
+    S_TSDBBlockHeader header;
+    uint32_t          i;
+    bool              isLoaded;
+    bool              isTail;
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    isLoaded = false;
+    while (!isLoaded && !rCursor.isDone) {
+        if (TSDB_SEGMENT_BLOCKS <= rCursor.block) {
+            ++rCursor.segment;
+            rCursor.block = 0;
+        }
+
+        if (rCursor.lastSegment < rCursor.segment) {
+            rCursor.isDone = true;
+        }
+        else {
+            /* The open block of the series is read from memory */
+            isTail = false;
+            if (pdPASS == xSemaphoreTake(this->_lock,
+                                         TSDB_LOCK_TIMEOUT_TICKS)) {
+                for (i = 0; TSDB_MAX_SERIES > i && !isTail; ++i) {
+                    if (this->_pSeries[i].isUsed &&
+                        rCursor.id == this->_pSeries[i].id &&
+                        rCursor.segment == this->_pSeries[i].lastSegment &&
+                        rCursor.block == this->_pSeries[i].blockCount) {
+                        memcpy(
+                            rCursor.pBlock,
+                            this->_pSeries[i].pBlock,
+                            TSDB_BLOCK_SIZE
+                        );
+                        isTail = true;
+                    }
+                }
+                if (pdPASS != xSemaphoreGive(this->_lock)) {
+                    PANIC("Failed to release the time series store lock.\n");
+                }
+            }
+
+            isLoaded = isTail;
+            if (!isLoaded &&
+                nullptr != pStorage &&
+                E_Return::NO_ERROR ==
+                pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+                isLoaded = ReadBlock(
+                    rCursor.id,
+                    rCursor.segment,
+                    rCursor.block,
+                    rCursor.pBlock
+                );
+                pStorage->ReleaseSPIBus();
+            }
+
+            if (!isLoaded) {
+                /* End of the series, or a segment removed while reading */
+                if (rCursor.lastSegment == rCursor.segment) {
+                    rCursor.isDone = true;
+                }
+                else {
+                    rCursor.block = TSDB_SEGMENT_BLOCKS;
+                }
+            }
+            else if (E_Return::NO_ERROR != TSDBBlock::Open(rCursor.pBlock,
+                                                           rCursor.codec)) {
+                LOG_ERROR(
+                    "Corrupted block %u of series 0x%04x.\n",
+                    rCursor.block,
+                    rCursor.id
+                );
+                isLoaded = false;
+                ++rCursor.block;
+            }
+            else {
+                TSDBBlock::GetHeader(rCursor.pBlock, header);
+                if (rCursor.to < header.firstTime) {
+                    isLoaded = false;
+                    rCursor.isDone = true;
+                }
+            }
+        }
+    }
+
+    rCursor.isBlockOpen = isLoaded;
+
+    return isLoaded;
+}
+
+bool TimeSeriesStore::ReadBlock(const uint16_t kId,
+                                const uint32_t kSegment,
+                                const uint32_t kBlock,
+                                uint8_t*       pBlock) const noexcept {
+    Storage* pStorage;
+    FsFile   file;
+    char     pPath[TSDB_PATH_SIZE];
+    bool     isRead;
+
+    isRead = false;
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage) {
+        GetSegmentPath(kId, kSegment, pPath);
+        file = pStorage->Open(pPath, O_RDONLY);
+        if (file.isOpen()) {
+            isRead = file.seekSet(kBlock * TSDB_BLOCK_SIZE) &&
+                     TSDB_BLOCK_SIZE == file.read(pBlock, TSDB_BLOCK_SIZE);
+            file.close();
+        }
+    }
+
+    return isRead;
+}
+
+void TimeSeriesStore::LoadTimeBase(void) noexcept {
+    Storage* pStorage;
+    FsFile   file;
+    int64_t  lastTime;
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage &&
+        E_Return::NO_ERROR == pStorage->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)) {
+        file = pStorage->Open(TSDB_TIME_PATH, O_RDONLY);
+        if (file.isOpen()) {
+            /* The points of the previous boots are all older */
+            if (sizeof(int64_t) == file.read(&lastTime, sizeof(int64_t)) &&
+                0 <= lastTime) {
+                this->_timeBase = lastTime + 1;
+            }
+            file.close();
+        }
+        pStorage->ReleaseSPIBus();
+    }
+}
+
+void TimeSeriesStore::SaveTimeBase(void) const noexcept {
+    Storage* pStorage;
+    FsFile   file;
+    int64_t  lastTime;
+
+    pStorage = SystemState::GetInstance()->GetStorage();
+    if (nullptr != pStorage) {
+        lastTime = GetStoreTime(HWManager::GetTime());
+        file = pStorage->Open(TSDB_TIME_PATH, O_WRONLY | O_CREAT | O_TRUNC);
+        if (file.isOpen()) {
+            file.write(&lastTime, sizeof(int64_t));
+            file.close();
+        }
+    }
+}
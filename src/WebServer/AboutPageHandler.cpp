@@ -21,6 +21,9 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
 /* Included headers */
 #include <BSP.h>         /* BSP Services */
 #include <string>        /* Standard string */
@@ -28,6 +31,7 @@
 #include <Errors.h>      /* Errors definitions */
 #include <version.h>     /* Versioning */
 #include <PageHandler.h> /* Page Handler interface */
+#include <BootTrace.h>   /* Boot phases trace */
 
 /* Header file */
 #include <AboutPageHandler.h>
@@ -83,17 +87,22 @@ AboutPageHandler::~AboutPageHandler(void) noexcept {
     PANIC("Tried to destroy the About page handler.\n");
 }
 
-void AboutPageHandler::Generate(std::string& rPageTitle,
-                                std::string& rPageBody) noexcept {
-    rPageTitle = ABOUT_PAGE_TITLE;
+const char* AboutPageHandler::GetTitle(void) const noexcept {
+    return ABOUT_PAGE_TITLE;
+}
+
+void AboutPageHandler::Generate(PageSink& rSink) noexcept {
+    uint32_t i;
+    uint32_t time;
 
     /* Title + Header information */
-    rPageBody =
+    rSink.Write(
         "<div>"
         "   <h2>Real-Time High-Reliability Weather Station</h2>"
-        "   <h3>HWUID: ";
-    rPageBody += HWManager::GetHWUID();
-    rPageBody +=
+        "   <h3>HWUID: "
+    );
+    rSink.Write(HWManager::GetHWUID());
+    rSink.Write(
         "  | " VERSION " </h3>"
         "<p>Real-Time High-Reliability Weather Station is designed by "
         "<a href=\"https://me.olsontek.dev\">Alexy Torres</a>. It is made to be"
@@ -102,6 +111,29 @@ void AboutPageHandler::Generate(std::string& rPageTitle,
         "<p>Version / Build | " VERSION "</p>"
         "<p>GitHub Project: <a "
         "href=\"https://github.com/Oxmose/ESP32Weather\">"
-        "ESP32Weather</a></p>";
-    rPageBody += "</div>";
+        "ESP32Weather</a></p>"
+        "</div>"
+    );
+
+    /* Boot timings of the running build */
+    rSink.Write(
+        "<div>"
+        "<h3>Boot trace | Build " BUILD_NUMBER "</h3>"
+        "<table><tr><th>Phase</th><th>Completed at (ms)</th></tr>"
+    );
+    for (i = 0; E_BootPhase::BOOT_PHASE_COUNT > i; ++i) {
+        time = BootTrace::GetTime((E_BootPhase)i);
+        rSink.Write("<tr><td>");
+        rSink.Write(BootTrace::GetName((E_BootPhase)i));
+        rSink.Write("</td><td>");
+        if (0 != time) {
+            rSink.Write(std::to_string(time / 1000) + "." +
+                        std::to_string((time % 1000) / 100));
+        }
+        else {
+            rSink.Write("-");
+        }
+        rSink.Write("</td></tr>");
+    }
+    rSink.Write("</table></div>");
 }
\ No newline at end of file
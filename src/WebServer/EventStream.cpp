@@ -0,0 +1,393 @@
+/*******************************************************************************
+ * @file EventStream.cpp
+ *
+ * @see EventStream.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Server-Sent Events live stream.
+ *
+ * @details Server-Sent Events live stream. The stream pushes the new RAM
+ * journal logs and the status counters to the attached clients, only the data
+ * produced since the last push is sent.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
+/* Included headers */
+#include <cstdio>          /* Standard IO */
+#include <cstdint>         /* Standard integer definitions */
+#include <cstdlib>         /* String conversions */
+#include <cstring>         /* String manipulation */
+#include <algorithm>       /* std::min */
+#include <BSP.h>           /* Time services */
+#include <WiFi.h>          /* WiFi services */
+#include <Logger.h>        /* Logger services */
+#include <Arduino.h>       /* Arduino Framework */
+#include <WebServer.h>     /* Web server services */
+#include <JsonWriter.h>    /* JSON status writer */
+#include <SystemState.h>   /* System state provider */
+#include <HealthMonitor.h> /* HM actions statistics */
+
+/* Header file */
+#include <EventStream.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the size of the status JSON document. */
+#define EVENT_STATUS_JSON_SIZE 160
+/** @brief Defines the size of a decimal 32 bits counter with its end. */
+#define EVENT_COUNTER_SIZE 11
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/**
+ * @brief Appends a string literal to the frame of a client.
+ *
+ * @param[in, out] CLIENT The client to write to.
+ * @param[in] LITERAL The string literal to append.
+ */
+#define APPEND_LITERAL(CLIENT, LITERAL)                                     \
+    Append(CLIENT, LITERAL, sizeof(LITERAL) - 1)
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief The stream response header. */
+static const char spkStreamHeader[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n"
+    "retry: 3000\n\n";
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+EventStream::EventStream(void) noexcept {
+    uint32_t i;
+
+    for (i = 0; EVENT_STREAM_MAX_CLIENTS > i; ++i) {
+        this->_pClients[i].logStream.position = 0;
+        this->_pClients[i].logStream.sequence = 0;
+        this->_pClients[i].logStream.lost = 0;
+        this->_pClients[i].lastPush = 0;
+    }
+    SampleStatus(this->_status);
+    this->_lastSample = HWManager::GetTime();
+    this->_frameSize = 0;
+}
+
+bool EventStream::Attach(WebServer* pServer) noexcept {
+    S_EventClient* pClient;
+    Logger*        pLogger;
+    uint32_t       i;
+
+    pClient = nullptr;
+    for (i = 0; EVENT_STREAM_MAX_CLIENTS > i && nullptr == pClient; ++i) {
+        if (!this->_pClients[i].client.connected()) {
+            pClient = &this->_pClients[i];
+        }
+    }
+
+    if (nullptr != pClient) {
+        /* The stream keeps the connection once the server released it */
+        pClient->client = pServer->client();
+
+        /* Resume after the last log received, by default only the new logs
+         * are streamed.
+         */
+        pLogger = Logger::GetInstance();
+        pLogger->OpenRamJournalTail(&pClient->logStream);
+        if (pServer->hasHeader(EVENT_STREAM_LAST_ID_HEADER)) {
+            pLogger->SeekRamJournalStream(
+                &pClient->logStream,
+                strtoul(
+                    pServer->header(EVENT_STREAM_LAST_ID_HEADER).c_str(),
+                    NULL,
+                    10
+                )
+            );
+        }
+        else if (pServer->hasArg(EVENT_STREAM_SEQUENCE_ARG)) {
+            pLogger->SeekRamJournalStream(
+                &pClient->logStream,
+                strtoul(
+                    pServer->arg(EVENT_STREAM_SEQUENCE_ARG).c_str(),
+                    NULL,
+                    10
+                )
+            );
+        }
+        pClient->lastPush = HWManager::GetTime();
+
+        this->_frameSize = 0;
+        if (!APPEND_LITERAL(*pClient, spkStreamHeader) ||
+            !Flush(*pClient) ||
+            !PushStatus(*pClient)) {
+            pClient->client.stop();
+        }
+        else {
+            LOG_DEBUG("Attached event stream client %d.\n", i - 1);
+        }
+    }
+
+    return nullptr != pClient;
+}
+
+void EventStream::Update(void) noexcept {
+    S_EventStatus status;
+    uint64_t      currentTime;
+    uint32_t      i;
+    bool          isStatusChanged;
+    bool          isOk;
+
+    /* The counters are sampled once for all the clients */
+    currentTime = HWManager::GetTime();
+    isStatusChanged = false;
+    if (EVENT_STREAM_STATUS_PERIOD_NS <= currentTime - this->_lastSample &&
+        HasClients()) {
+        SampleStatus(status);
+        this->_lastSample = currentTime;
+        if (0 != memcmp(&status, &this->_status, sizeof(status))) {
+            this->_status = status;
+            isStatusChanged = true;
+        }
+    }
+
+    for (i = 0; EVENT_STREAM_MAX_CLIENTS > i; ++i) {
+        if (this->_pClients[i].client.connected()) {
+            isOk = PushLogs(this->_pClients[i]);
+            if (isOk && isStatusChanged) {
+                isOk = PushStatus(this->_pClients[i]);
+            }
+
+            /* Comments keep the proxies open and detect dead clients */
+            if (isOk &&
+                this->_pClients[i].lastPush + EVENT_STREAM_HEARTBEAT_NS <
+                currentTime) {
+                isOk = APPEND_LITERAL(this->_pClients[i], ":\n\n") &&
+                       Flush(this->_pClients[i]);
+            }
+
+            if (!isOk) {
+                this->_pClients[i].client.stop();
+            }
+        }
+        else {
+            /* Release the socket of the clients that left */
+            this->_pClients[i].client.stop();
+        }
+    }
+}
+
+bool EventStream::HasClients(void) noexcept {
+    uint32_t i;
+    bool     hasClients;
+
+    hasClients = false;
+    for (i = 0; EVENT_STREAM_MAX_CLIENTS > i && !hasClients; ++i) {
+        hasClients = this->_pClients[i].client.connected();
+    }
+
+    return hasClients;
+}
+
+bool EventStream::PushLogs(S_EventClient& rClient) noexcept {
+    Logger*  pLogger;
+    char     pCounter[EVENT_COUNTER_SIZE];
+    size_t   readBytes;
+    size_t   length;
+    size_t   start;
+    size_t   i;
+    uint32_t chunks;
+    bool     isOk;
+
+    pLogger = Logger::GetInstance();
+
+    /* Nothing is logged here, the logs would feed the stream back */
+    isOk = true;
+    chunks = 0;
+    do {
+        readBytes = pLogger->ReadRamJournalStream(
+            (uint8_t*)this->_pLogBuffer,
+            sizeof(this->_pLogBuffer),
+            &rClient.logStream
+        );
+
+        if (0 != rClient.logStream.lost) {
+            /* The client is told about the logs it will never receive */
+            length = snprintf(
+                pCounter,
+                sizeof(pCounter),
+                "%lu",
+                (unsigned long)rClient.logStream.lost
+            );
+            rClient.logStream.lost = 0;
+
+            this->_frameSize = 0;
+            isOk = APPEND_LITERAL(rClient, "event: overrun\ndata: ") &&
+                   Append(rClient, pCounter, length) &&
+                   APPEND_LITERAL(rClient, "\n\n") &&
+                   Flush(rClient);
+        }
+
+        if (isOk && 0 < readBytes) {
+            /* One data field per log line */
+            this->_frameSize = 0;
+            isOk = APPEND_LITERAL(rClient, "event: log\n");
+            start = 0;
+            for (i = 0; isOk && readBytes >= i; ++i) {
+                if (readBytes == i ||
+                    '\n' == this->_pLogBuffer[i] ||
+                    '\r' == this->_pLogBuffer[i]) {
+                    if (i > start) {
+                        isOk = APPEND_LITERAL(rClient, "data: ") &&
+                               Append(
+                                   rClient,
+                                   this->_pLogBuffer + start,
+                                   i - start
+                               ) &&
+                               APPEND_LITERAL(rClient, "\n");
+                    }
+                    start = i + 1;
+                }
+            }
+            /* The browser resumes from the identifier on reconnection */
+            length = snprintf(
+                pCounter,
+                sizeof(pCounter),
+                "%lu",
+                (unsigned long)rClient.logStream.sequence
+            );
+            isOk = isOk &&
+                   APPEND_LITERAL(rClient, "id: ") &&
+                   Append(rClient, pCounter, length) &&
+                   APPEND_LITERAL(rClient, "\n\n") &&
+                   Flush(rClient);
+        }
+
+        ++chunks;
+    } while (isOk && 0 < readBytes && EVENT_STREAM_MAX_CHUNKS > chunks);
+
+    return isOk;
+}
+
+bool EventStream::PushStatus(S_EventClient& rClient) noexcept {
+    char       pJson[EVENT_STATUS_JSON_SIZE];
+    JsonWriter writer(pJson, sizeof(pJson));
+
+    writer.BeginObject();
+    writer.AddUInt("uptime_s", HWManager::GetTime() / 1000000000ULL);
+    writer.AddUInt("heap_free", this->_status.heapFree);
+    writer.AddUInt("heap_min", this->_status.heapMin);
+    writer.AddUInt("hm_pending", this->_status.hmPending);
+    writer.AddUInt("hm_executed", this->_status.hmExecuted);
+    writer.AddUInt("hm_dropped", this->_status.hmDropped);
+    writer.EndObject();
+
+    this->_frameSize = 0;
+    return APPEND_LITERAL(rClient, "event: status\ndata: ") &&
+           Append(rClient, writer.GetData(), writer.GetSize()) &&
+           APPEND_LITERAL(rClient, "\n\n") &&
+           Flush(rClient);
+}
+
+void EventStream::SampleStatus(S_EventStatus& rStatus) noexcept {
+    HealthMonitor*  pHM;
+    S_HMActionStats stats;
+
+    memset(&rStatus, 0, sizeof(rStatus));
+    rStatus.heapFree = ESP.getFreeHeap();
+    rStatus.heapMin = ESP.getMinFreeHeap();
+
+    /* The HM is not started in every mode */
+    pHM = SystemState::GetInstance()->GetHealthMonitor();
+    if (nullptr != pHM) {
+        pHM->GetActionStats(stats);
+        rStatus.hmPending = stats.pending;
+        rStatus.hmExecuted = stats.executed;
+        rStatus.hmDropped = stats.dropped;
+    }
+}
+
+bool EventStream::Append(S_EventClient& rClient,
+                         const char*    kpData,
+                         const size_t   kSize) noexcept {
+    size_t copied;
+    size_t length;
+    bool   isOk;
+
+    isOk = true;
+    copied = 0;
+    while (isOk && kSize > copied) {
+        length = std::min(
+            kSize - copied,
+            sizeof(this->_pFrame) - this->_frameSize
+        );
+        memcpy(this->_pFrame + this->_frameSize, kpData + copied, length);
+        this->_frameSize += length;
+        copied += length;
+
+        if (sizeof(this->_pFrame) == this->_frameSize) {
+            isOk = Flush(rClient);
+        }
+    }
+
+    return isOk;
+}
+
+bool EventStream::Flush(S_EventClient& rClient) noexcept {
+    bool isOk;
+
+    isOk = true;
+    if (0 != this->_frameSize) {
+        isOk = (this->_frameSize == rClient.client.write(
+            (const uint8_t*)this->_pFrame,
+            this->_frameSize
+        ));
+        if (isOk) {
+            rClient.lastPush = HWManager::GetTime();
+        }
+        this->_frameSize = 0;
+    }
+
+    return isOk;
+}
@@ -21,6 +21,9 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
 /* Included headers */
 #include <BSP.h>         /* BSP Services */
 #include <string>        /* Standard string */
@@ -86,115 +89,124 @@ IndexPageHandler::~IndexPageHandler(void) noexcept {
     PANIC("Tried to destroy the Index page handler.\n");
 }
 
-void IndexPageHandler::Generate(std::string& rPageTitle,
-                                std::string& rPageBody) noexcept {
-
-    rPageTitle = INDEX_PAGE_TITLE;
+const char* IndexPageHandler::GetTitle(void) const noexcept {
+    return INDEX_PAGE_TITLE;
+}
 
+void IndexPageHandler::Generate(PageSink& rSink) noexcept {
     /* Title + Header information */
-    rPageBody =
+    rSink.Write(
         "<div>"
         "   <h1>Real-Time High-Reliability Weather Station</h1>"
-        "   <h2>HWUID: ";
-    rPageBody += HWManager::GetHWUID();
-    rPageBody +=
+        "   <h2>HWUID: "
+    );
+    rSink.Write(HWManager::GetHWUID());
+    rSink.Write(
         "  | " VERSION "</h2>"
-        "</div>";
+        "</div>"
+    );
 
     /* Network information */
-    GenerateNetwork(rPageBody);
+    GenerateNetwork(rSink);
 
     /* General system information */
-    GenerateSystem(rPageBody);
+    GenerateSystem(rSink);
 }
 
-void IndexPageHandler::GenerateNetwork(std::string& rBuffer) const noexcept {
+void IndexPageHandler::GenerateNetwork(PageSink& rSink) const noexcept {
     WiFiModule*  pWiFiModule;
     S_WiFiConfig config;
 
     pWiFiModule = SystemState::GetInstance()->GetWiFiModule();
     pWiFiModule->GetConfiguration(&config);
 
-    rBuffer += "<div>";
-    rBuffer += "<h3>==== Network ====</h3>";
-
-    rBuffer += "<table>";
-    rBuffer += "<tr>";
-    rBuffer += "<td>MAC Address</td><td>" +
-                 std::string(HWManager::GetMacAddress()) +
-                 "</td>";
-    rBuffer += "</tr>";
-    rBuffer += "<tr>";
-    rBuffer += "<td>Mode</td>";
+    rSink.Write("<div>");
+    rSink.Write("<h3>==== Network ====</h3>");
+
+    rSink.Write("<table>");
+    rSink.Write("<tr>");
+    rSink.Write("<td>MAC Address</td><td>");
+    rSink.Write(HWManager::GetMacAddress());
+    rSink.Write("</td>");
+    rSink.Write("</tr>");
+    rSink.Write("<tr>");
+    rSink.Write("<td>Mode</td>");
     if (config.isAP) {
-        rBuffer += "<td>Access Point</td>";
+        rSink.Write("<td>Access Point</td>");
     }
     else {
-        rBuffer += "<td>Node</v>";
+        rSink.Write("<td>Node</v>");
     }
-    rBuffer += "</tr>";
-    rBuffer += "<tr>";
+    rSink.Write("</tr>");
+    rSink.Write("<tr>");
 
-    rBuffer += "<td>SSID</td><td>" + std::string(config.ssid) + "</td>";
-    rBuffer += "</tr>";
+    rSink.Write("<td>SSID</td><td>");
+    rSink.Write(config.ssid);
+    rSink.Write("</td>");
+    rSink.Write("</tr>");
     if (config.isAP) {
-        rBuffer += "<tr>";
-        rBuffer += "<td>Password</td><td>" + std::string(config.password) +
-            "</td>";
-        rBuffer += "</tr>";
+        rSink.Write("<tr>");
+        rSink.Write("<td>Password</td><td>");
+        rSink.Write(config.password);
+        rSink.Write("</td>");
+        rSink.Write("</tr>");
     }
-    rBuffer += "<tr>";
-    rBuffer += "<td>IP Address</td><td>" + std::string(config.ip) + "</td>";
-    rBuffer += "</tr>";
+    rSink.Write("<tr>");
+    rSink.Write("<td>IP Address</td><td>");
+    rSink.Write(config.ip);
+    rSink.Write("</td>");
+    rSink.Write("</tr>");
     if (!config.isAP) {
-        rBuffer += "<tr>";
-        rBuffer += "<td>RSSI</td><td>" +
-                    std::to_string(WiFi.RSSI()) +
-                    "</td>";
-        rBuffer += "</tr>";
+        rSink.Write("<tr>");
+        rSink.Write("<td>RSSI</td><td>");
+        rSink.WriteInt(WiFi.RSSI());
+        rSink.Write("</td>");
+        rSink.Write("</tr>");
     }
-    rBuffer += "</table>";
-    rBuffer += "</div>";
+    rSink.Write("</table>");
+    rSink.Write("</div>");
 }
 
-void IndexPageHandler::GenerateSystem(std::string& rBuffer) const noexcept {
+void IndexPageHandler::GenerateSystem(PageSink& rSink) const noexcept {
     uint64_t uptime;
 
-    rBuffer += "<div>";
-    rBuffer += "<h3>==== System ====</h3>";
+    rSink.Write("<div>");
+    rSink.Write("<h3>==== System ====</h3>");
 
-    rBuffer += "<table>";
-    rBuffer += "<tr>";
-    rBuffer += "<th>Uptime D</th><th>Uptime h</th><th>Uptime m</th>"
-               "<th>Uptime s</th><th>Uptime ms</th><th>Uptime us</th>"
-               "<th>Uptime ns</th>";
-    rBuffer += "</tr>";
+    rSink.Write("<table>");
+    rSink.Write("<tr>");
+    rSink.Write(
+        "<th>Uptime D</th><th>Uptime h</th><th>Uptime m</th>"
+        "<th>Uptime s</th><th>Uptime ms</th><th>Uptime us</th>"
+        "<th>Uptime ns</th>"
+    );
+    rSink.Write("</tr>");
 
     uptime = HWManager::GetTime();
 
-    rBuffer += "<tr>";
-    rBuffer += "<td>";
-    rBuffer += std::to_string(uptime / 86400000000000ULL);
-    rBuffer += "</td>";
-    rBuffer += "<td>";
-    rBuffer += std::to_string((uptime / 3600000000000ULL) % 24);
-    rBuffer += "</td>";
-    rBuffer += "<td>";
-    rBuffer += std::to_string((uptime / 60000000000ULL) % 60);
-    rBuffer += "</td>";
-    rBuffer += "<td>";
-    rBuffer += std::to_string((uptime / 1000000000ULL) % 60);
-    rBuffer += "</td>";
-    rBuffer += "<td>";
-    rBuffer += std::to_string((uptime / 1000000ULL) % 1000);
-    rBuffer += "</td>";
-    rBuffer += "<td>";
-    rBuffer += std::to_string((uptime / 1000ULL) % 1000);
-    rBuffer += "</td>";
-    rBuffer += "<td>";
-    rBuffer += std::to_string(uptime % 1000);
-    rBuffer += "</td>";
-    rBuffer += "</tr>";
-    rBuffer += "</table>";
-    rBuffer += "</div>";
+    rSink.Write("<tr>");
+    rSink.Write("<td>");
+    rSink.WriteUInt(uptime / 86400000000000ULL);
+    rSink.Write("</td>");
+    rSink.Write("<td>");
+    rSink.WriteUInt((uptime / 3600000000000ULL) % 24);
+    rSink.Write("</td>");
+    rSink.Write("<td>");
+    rSink.WriteUInt((uptime / 60000000000ULL) % 60);
+    rSink.Write("</td>");
+    rSink.Write("<td>");
+    rSink.WriteUInt((uptime / 1000000000ULL) % 60);
+    rSink.Write("</td>");
+    rSink.Write("<td>");
+    rSink.WriteUInt((uptime / 1000000ULL) % 1000);
+    rSink.Write("</td>");
+    rSink.Write("<td>");
+    rSink.WriteUInt((uptime / 1000ULL) % 1000);
+    rSink.Write("</td>");
+    rSink.Write("<td>");
+    rSink.WriteUInt(uptime % 1000);
+    rSink.Write("</td>");
+    rSink.Write("</tr>");
+    rSink.Write("</table>");
+    rSink.Write("</div>");
 }
\ No newline at end of file
@@ -0,0 +1,332 @@
+/*******************************************************************************
+ * @file LogSearch.cpp
+ *
+ * @see LogSearch.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Journal logs search filter.
+ *
+ * @details Journal logs search filter. The formated logs read from the
+ * journals are filtered by level, time and pattern, only the matching lines
+ * are kept.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
+/* Included headers */
+#include <cstring>  /* memcmp, memchr, memmove */
+#include <cstdint>  /* Standard integer definitions */
+#include <Logger.h> /* Logger services */
+
+/* Header file */
+#include <LogSearch.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the offset of the level tag in a formated log. */
+#define LOG_HEADER_TAG_OFFSET 1
+/** @brief Defines the offset of the timestamp in a formated log. */
+#define LOG_HEADER_TIME_OFFSET 9
+/** @brief Defines the end of the timestamp in a formated log. */
+#define LOG_HEADER_TIME_END ']'
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Returns the level of a formated log.
+ *
+ * @param[in] kpLine The formated log.
+ * @param[in] kSize The size of the log in bytes.
+ *
+ * @return The level of the log is returned, lines without a known level tag
+ * are debug lines.
+ */
+static E_LogLevel GetLineLevel(const char* kpLine, const size_t kSize);
+
+/**
+ * @brief Returns the timestamp of a formated log.
+ *
+ * @param[in] kpLine The formated log.
+ * @param[in] kSize The size of the log in bytes.
+ * @param[out] rTime The timestamp of the log in nanoseconds.
+ *
+ * @return true is returned when the log has a timestamp.
+ */
+static bool GetLineTime(const char*  kpLine,
+                        const size_t kSize,
+                        uint64_t&    rTime);
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static E_LogLevel GetLineLevel(const char* kpLine, const size_t kSize) {
+    E_LogLevel level;
+
+    level = E_LogLevel::LOG_LEVEL_DEBUG;
+    if (LOG_HEADER_TAG_OFFSET < kSize && '[' == kpLine[0]) {
+        switch (kpLine[LOG_HEADER_TAG_OFFSET]) {
+            case 'C':
+                level = E_LogLevel::LOG_LEVEL_CRITICAL;
+                break;
+            case 'E':
+                level = E_LogLevel::LOG_LEVEL_ERROR;
+                break;
+            case 'I':
+                level = E_LogLevel::LOG_LEVEL_INFO;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return level;
+}
+
+static bool GetLineTime(const char*  kpLine,
+                        const size_t kSize,
+                        uint64_t&    rTime) {
+    size_t i;
+    bool   hasDigit;
+
+    rTime    = 0;
+    hasDigit = false;
+
+    /* The timestamp is right aligned after the level tag */
+    i = LOG_HEADER_TIME_OFFSET;
+    if ('[' == kpLine[0]) {
+        while (kSize > i && ' ' == kpLine[i]) {
+            ++i;
+        }
+        while (kSize > i && '0' <= kpLine[i] && '9' >= kpLine[i]) {
+            rTime    = rTime * 10 + (kpLine[i] - '0');
+            hasDigit = true;
+            ++i;
+        }
+    }
+
+    return hasDigit && kSize > i && LOG_HEADER_TIME_END == kpLine[i];
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+LogSearch::LogSearch(void) noexcept {
+    this->Configure("", E_LogLevel::LOG_LEVEL_DEBUG, 0, UINT64_MAX);
+}
+
+LogSearch::~LogSearch(void) noexcept {
+    PANIC("Tried to destroy a log search.\n");
+}
+
+bool LogSearch::Configure(const char*      kpPattern,
+                          const E_LogLevel kLevel,
+                          const uint64_t   kFromNs,
+                          const uint64_t   kToNs) noexcept {
+    uint8_t* pSkip;
+    size_t   length;
+    size_t   start;
+    size_t   i;
+    size_t   j;
+
+    this->_level    = kLevel;
+    this->_fromNs   = kFromNs;
+    this->_toNs     = kToNs;
+    this->_hasRange = 0 != kFromNs || UINT64_MAX != kToNs;
+
+    this->_pieceCount = 0;
+    this->_isValid    = false;
+
+    length = strlen(kpPattern);
+    if (LOG_SEARCH_PATTERN_MAX >= length &&
+        nullptr == memchr(kpPattern, '\n', length)) {
+        memcpy(this->_pPattern, kpPattern, length + 1);
+        this->_isValid = true;
+
+        /* Split the pieces, consecutive wildcards make no empty piece */
+        start = 0;
+        for (i = 0; length >= i && this->_isValid; ++i) {
+            if (length == i || LOG_SEARCH_WILDCARD == this->_pPattern[i]) {
+                this->_pPattern[i] = 0;
+
+                if (i > start && LOG_SEARCH_PIECES_MAX > this->_pieceCount) {
+                    this->_pPieceStart[this->_pieceCount]  = start;
+                    this->_pPieceLength[this->_pieceCount] = i - start;
+
+                    /* Skip distance of the last compared byte */
+                    pSkip = this->_pSkip[this->_pieceCount];
+                    memset(pSkip, i - start, 256);
+                    for (j = start; i - 1 > j; ++j) {
+                        pSkip[(uint8_t)this->_pPattern[j]] = i - 1 - j;
+                    }
+                    ++this->_pieceCount;
+                }
+                else if (i > start) {
+                    this->_isValid = false;
+                }
+                start = i + 1;
+            }
+        }
+    }
+
+    if (!this->_isValid) {
+        this->_pieceCount = 0;
+        LOG_DEBUG("Invalid log search pattern.\n");
+    }
+
+    return this->_isValid;
+}
+
+size_t LogSearch::Filter(char*        pBlock,
+                         const size_t kSize,
+                         const bool   kIsLast,
+                         size_t&      rConsumed) const noexcept {
+    const char* pNewLine;
+    size_t      kept;
+    size_t      pos;
+    size_t      hit;
+    size_t      lineStart;
+    size_t      lineEnd;
+    bool        isDone;
+
+    kept   = 0;
+    pos    = 0;
+    isDone = false;
+    while (!isDone && kSize > pos) {
+        /* Only the lines holding the first piece are checked */
+        hit = pos;
+        if (0 < this->_pieceCount) {
+            hit += this->Find(0, pBlock + pos, kSize - pos);
+        }
+
+        lineStart = hit;
+        while (pos < lineStart && '\n' != pBlock[lineStart - 1]) {
+            --lineStart;
+        }
+
+        pNewLine = (const char*)memchr(pBlock + hit, '\n', kSize - hit);
+        if (nullptr != pNewLine) {
+            lineEnd = pNewLine - pBlock + 1;
+        }
+        else if (!kIsLast && LOG_SEARCH_LINE_MAX > kSize - lineStart) {
+            /* The line ends in the next block */
+            lineEnd = lineStart;
+            isDone  = true;
+        }
+        else {
+            lineEnd = kSize;
+        }
+
+        if (lineStart < lineEnd &&
+            this->IsMatch(pBlock + lineStart, lineEnd - lineStart)) {
+            memmove(pBlock + kept, pBlock + lineStart, lineEnd - lineStart);
+            kept += lineEnd - lineStart;
+        }
+        pos = lineEnd;
+    }
+
+    rConsumed = pos;
+
+    return kept;
+}
+
+size_t LogSearch::Find(const uint8_t kPiece,
+                       const char*   kpData,
+                       const size_t  kSize) const noexcept {
+    const uint8_t* kpSkip;
+    const char*    kpKey;
+    size_t         length;
+    size_t         pos;
+    size_t         found;
+    uint8_t        last;
+
+    kpKey  = this->_pPattern + this->_pPieceStart[kPiece];
+    kpSkip = this->_pSkip[kPiece];
+    length = this->_pPieceLength[kPiece];
+
+    found = kSize;
+    if (length <= kSize) {
+        pos = 0;
+        while (kSize == found && kSize - length >= pos) {
+            last = (uint8_t)kpData[pos + length - 1];
+            if ((uint8_t)kpKey[length - 1] == last &&
+                0 == memcmp(kpData + pos, kpKey, length - 1)) {
+                found = pos;
+            }
+            else {
+                pos += kpSkip[last];
+            }
+        }
+    }
+
+    return found;
+}
+
+bool LogSearch::IsMatch(const char* kpLine, const size_t kSize)
+const noexcept {
+    uint64_t time;
+    size_t   offset;
+    size_t   found;
+    uint8_t  i;
+    bool     isMatch;
+
+    isMatch = this->_isValid;
+
+    if (isMatch && E_LogLevel::LOG_LEVEL_DEBUG > this->_level) {
+        isMatch = GetLineLevel(kpLine, kSize) <= this->_level;
+    }
+    if (isMatch && this->_hasRange) {
+        isMatch = GetLineTime(kpLine, kSize, time) &&
+                  this->_fromNs <= time && this->_toNs >= time;
+    }
+
+    /* The pieces follow each other in the line */
+    offset = 0;
+    for (i = 0; this->_pieceCount > i && isMatch; ++i) {
+        found = this->Find(i, kpLine + offset, kSize - offset);
+        if (kSize - offset == found) {
+            isMatch = false;
+        }
+        else {
+            offset += found + this->_pPieceLength[i];
+        }
+    }
+
+    return isMatch;
+}
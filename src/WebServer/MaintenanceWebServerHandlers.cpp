@@ -21,16 +21,27 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
 /* Included headers */
-#include <BSP.h>           /* Hardware layer */
-#include <Errors.h>        /* Errors definitions */
-#include <Logger.h>        /* Logger services */
-#include <Arduino.h>       /* Arduino Framework */
-#include <version.h>       /* Versioning  */
-#include <Settings.h>      /* Settings services */
-#include <WebServer.h>     /* Web server services */
-#include <SystemState.h>   /* Get the system state */
-#include <ModeManager.h>   /* Mode management */
+#include <string>             /* std::to_string */
+#include <BSP.h>              /* Hardware layer */
+#include <Errors.h>           /* Errors definitions */
+#include <Logger.h>           /* Logger services */
+#include <Arduino.h>          /* Arduino Framework */
+#include <version.h>          /* Versioning  */
+#include <Settings.h>         /* Settings services */
+#include <WebServer.h>        /* Web server services */
+#include <SystemState.h>      /* Get the system state */
+#include <ModeManager.h>      /* Mode management */
+#include <StaticAssetsData.h> /* Static assets content */
+#include <StaticAssets.h>     /* Cacheable static assets */
+#include <EventStream.h>      /* Live events stream */
+#include <MemoryPool.h>       /* Subsystem memory pools */
+#include <PageSink.h>         /* Page output sink */
+#include <LogSearch.h>        /* Journal logs search */
+#include <Tracer.h>           /* Events tracer */
 
 /* Header file */
 #include <MaintenanceWebServerHandlers.h>
@@ -43,15 +54,43 @@
 #define PAGE_URL_INDEX "/"
 /** @brief Defines the reboot URL */
 #define PAGE_URL_MONITOR "/reboot"
+/*
+ * The log URLs and the sequence header are also used by
+ * webassets/maintenance.js and must be kept in sync.
+ */
 /** @brief Defines the RAM log loading request URL. */
 #define RAM_LOGS_LOAD_URL "/loadram"
+/** @brief Defines the RAM log download request URL. */
+#define RAM_LOGS_DOWNLOAD_URL "/downloadram"
 /** @brief Defines the journal log loading request URL. */
 #define JOURNAL_LOGS_LOAD_URL "/loadjournal"
+/** @brief Defines the response header providing the next log sequence. */
+#define LOG_SEQUENCE_HEADER "X-Log-Sequence"
+/** @brief Defines the log search request URL. */
+#define LOG_SEARCH_URL "/searchlogs"
 /** @brief Defines the clear log request URL. */
 #define CLEAR_LOGS_URL "/clearlogs"
+/** @brief Defines the log level request URL. */
+#define LOG_LEVEL_URL "/loglevel"
+/** @brief Defines the live events stream URL. */
+#define EVENTS_URL "/events"
+/** @brief Defines the trace download request URL. */
+#define TRACE_DOWNLOAD_URL "/trace"
+/** @brief Defines the tracing start and stop request URL. */
+#define TRACE_STATE_URL "/tracestate"
+/** @brief Defines the stylesheet URL */
+#define ASSET_URL_STYLE "/style.css"
+/** @brief Defines the script URL */
+#define ASSET_URL_SCRIPT "/maintenance.js"
 
 /** @brief Defines the amount of logs to lazy load. */
 #define LOG_LAZY_LOAD_SIZE 512
+/** @brief Defines the size of the log download chunks (TCP segment size). */
+#define LOG_STREAM_CHUNK_SIZE 1436
+/** @brief Defines the maximal journal time of a range request in seconds. */
+#define LOG_RANGE_MAX_SEC (UINT64_MAX / 1000000000ULL)
+/** @brief Defines the size of the log search read blocks. */
+#define LOG_SEARCH_BLOCK_SIZE 4096
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
@@ -82,6 +121,51 @@
 /** @brief Stores the current web server instance. */
 static MaintenanceWebServerHandlers* spInstance = nullptr;
 
+/** @brief Page shell start, up to the title. */
+static const char spkPageHeaderStart[] =
+    "<!DOCTYPE html>\n"
+    "<html lang='en'>\n"
+    "<head>\n"
+    "<meta name='viewport' "
+    "content='width=device-width, initial-scale=1' "
+    "charset='UTF-8'/>\n"
+    "<title>\n";
+
+/** @brief Page shell after the title. */
+static const char spkPageHeaderEnd[] =
+    "</title>\n"
+    "<link rel='stylesheet' href='" ASSET_URL_STYLE "'/>\n"
+    "<script src='" ASSET_URL_SCRIPT "'></script>\n"
+    "</head>\n"
+    "<body>";
+
+/** @brief Page shell footer. */
+static const char spkPageFooter[] = "</div></body>\n</html>";
+
+/** @brief The maintenance server static assets. */
+static S_StaticAsset sAssets[] = {
+    {
+        ASSET_URL_STYLE,
+        ASSET_MAINTENANCE_CSS_TYPE,
+        gkAssetMaintenanceCss,
+        ASSET_MAINTENANCE_CSS_SIZE,
+        gkAssetMaintenanceCssGz,
+        ASSET_MAINTENANCE_CSS_GZ_SIZE,
+        {0},
+        {0}
+    },
+    {
+        ASSET_URL_SCRIPT,
+        ASSET_MAINTENANCE_JS_TYPE,
+        gkAssetMaintenanceJs,
+        ASSET_MAINTENANCE_JS_SIZE,
+        gkAssetMaintenanceJsGz,
+        ASSET_MAINTENANCE_JS_GZ_SIZE,
+        {0},
+        {0}
+    }
+};
+
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
@@ -94,13 +178,41 @@ MaintenanceWebServerHandlers::MaintenanceWebServerHandlers(WebServer* pServer)
 noexcept {
     this->_pServer = pServer;
 
+    this->_pEvents = new EventStream();
+    if (nullptr == this->_pEvents) {
+        PANIC("Failed to allocate the maintenance events stream.\n");
+    }
+
+    this->_pArena = new RequestArena(REQUEST_ARENA_SIZE);
+    if (nullptr == this->_pArena) {
+        PANIC("Failed to allocate the maintenance request arena.\n");
+    }
+
+    this->_pSearch = new LogSearch();
+    if (nullptr == this->_pSearch) {
+        PANIC("Failed to allocate the maintenance log search.\n");
+    }
+
     /* Configure the handlers */
     this->_pServer->onNotFound(HandleNotFound);
     this->_pServer->on(PAGE_URL_INDEX, HandleIndex);
     this->_pServer->on(PAGE_URL_MONITOR, HandleReboot);
     this->_pServer->on(RAM_LOGS_LOAD_URL, HandleRamLoad);
+    this->_pServer->on(RAM_LOGS_DOWNLOAD_URL, HandleRamDownload);
     this->_pServer->on(JOURNAL_LOGS_LOAD_URL, HandleJournalLoad);
+    this->_pServer->on(LOG_SEARCH_URL, HandleLogSearch);
     this->_pServer->on(CLEAR_LOGS_URL, HandleClearLogs);
+    this->_pServer->on(LOG_LEVEL_URL, HandleLogLevel);
+    this->_pServer->on(EVENTS_URL, HTTP_GET, HandleEvents);
+    this->_pServer->on(TRACE_DOWNLOAD_URL, HTTP_GET, HandleTraceDownload);
+    this->_pServer->on(TRACE_STATE_URL, HandleTraceState);
+
+    /* Serve the cacheable assets */
+    StaticAssets::Register(
+        this->_pServer,
+        sAssets,
+        sizeof(sAssets) / sizeof(sAssets[0])
+    );
 
     /* Set the instance */
     spInstance = this;
@@ -114,72 +226,94 @@ MaintenanceWebServerHandlers::~MaintenanceWebServerHandlers(void) {
     );
 }
 
+EventStream* MaintenanceWebServerHandlers::GetEventStream(void)
+const noexcept {
+    return this->_pEvents;
+}
+
 void MaintenanceWebServerHandlers::HandleNotFound(void) noexcept {
-    std::string header;
-    std::string footer;
-    std::string page;
+    PageSink sink(
+        spInstance->_pServer,
+        404,
+        "text/html",
+        spInstance->_pArena
+    );
 
     LOG_DEBUG(
         "Handling Web page not found: %s\n",
         spInstance->_pServer->uri().c_str()
     );
 
-    /* Generate the page */
-    spInstance->GetPageHeader(header, "Not Found");
-    spInstance->GetPageFooter(footer);
-    page = header + "<h1>Not Found</h1>" + footer;
-
-    /* Send */
-    spInstance->GenericHandler(page, 404);
+    /* Generate and send the page */
+    spInstance->WritePageHeader(sink, "Not Found");
+    sink.Write("<h1>Not Found</h1>");
+    spInstance->EndPage(sink);
+    spInstance->_pArena->Reset();
 }
 
 void MaintenanceWebServerHandlers::HandleIndex(void) noexcept {
-    std::string title;
-    std::string page;
-    std::string footer;
-    std::string header;
+    PageSink sink(
+        spInstance->_pServer,
+        200,
+        "text/html",
+        spInstance->_pArena
+    );
+
+    spInstance->WritePageHeader(sink, "");
 
-    page =
+    sink.Write(
         "<div>"
         "   <h1>Real-Time High-Reliability Weather Station</h1>"
-        "   <h2>HWUID: ";
-    page += HWManager::GetHWUID();
-    page +=
+        "   <h2>HWUID: "
+    );
+    sink.Write(HWManager::GetHWUID());
+    sink.Write(
         "  | " VERSION "</h2>"
-        "</div>";
-
-    page += "<div>";
-    page += "<h3>==== Maintenance Mode ====</h3>";
-    page += "<table>";
-    page += "<tr>";
-    page += "<td><a href=\"/reboot?mode=0\">Reboot in nominal</a></td>";
-    page += "<td><a href=\"/reboot?mode=1\">Reboot in maintenance</a></td>";
-    page += "</tr>";
-    page += "</table>";
-    page += "</div>";
-
-    spInstance->GetFormatedLogs(page);
+        "</div>"
+    );
 
-    /* Generate the page */
-    spInstance->GetPageHeader(header, title);
-    spInstance->GetPageFooter(footer);
+    sink.Write(
+        "<div>"
+        "<h3>==== Maintenance Mode ====</h3>"
+        "<table>"
+        "<tr>"
+        "<td><a href=\"/reboot?mode=0\">Reboot in nominal</a></td>"
+        "<td><a href=\"/reboot?mode=1\">Reboot in maintenance</a></td>"
+        "</tr>"
+        "<tr>"
+        "<td><a href=\"" TRACE_STATE_URL "?state="
+    );
+    sink.Write(Tracer::IsStarted() ? "0\">Stop" : "1\">Start");
+    sink.Write(
+        " tracing</a></td>"
+        "<td><a href=\"" TRACE_DOWNLOAD_URL "\">Download trace</a></td>"
+        "</tr>"
+        "</table>"
+        "</div>"
+    );
 
+    spInstance->GetFormatedSettingsMemory(sink);
+    spInstance->GetFormatedMemoryPools(sink);
+    spInstance->GetFormatedLogLevels(sink);
+    spInstance->GetFormatedLogs(sink);
 
     /* Send */
-    spInstance->GenericHandler(header + page + footer, 200);
+    spInstance->EndPage(sink);
+    spInstance->_pArena->Reset();
 }
 
 void MaintenanceWebServerHandlers::HandleReboot(void) noexcept {
-    std::string title;
-    std::string page;
-    std::string footer;
-    std::string header;
-    String      arg;
-    E_Return    error;
+    PageSink sink(
+        spInstance->_pServer,
+        200,
+        "text/html",
+        spInstance->_pArena
+    );
+    String   arg;
+    E_Return error;
 
     /* Generate the page */
-    spInstance->GetPageHeader(header, title);
-    spInstance->GetPageFooter(footer);
+    spInstance->WritePageHeader(sink, "");
 
     if (spInstance->_pServer->hasArg("mode")) {
         arg = spInstance->_pServer->arg("mode");
@@ -188,9 +322,9 @@ void MaintenanceWebServerHandlers::HandleReboot(void) noexcept {
         if (arg.equals("0")) {
             LOG_DEBUG("Setting firmware to nominal mode.\n");
 
-            /* Send */
-            page = "<div><h1>Rebooting in nominal mode.</h1></div>";
-            spInstance->GenericHandler(header + page + footer, 200);
+            /* The page is delivered before the reboot */
+            sink.Write("<div><h1>Rebooting in nominal mode.</h1></div>");
+            spInstance->EndPage(sink);
 
             error = SystemState::GetInstance()->GetModeManager()->SetMode(
                 E_Mode::MODE_NOMINAL
@@ -202,9 +336,9 @@ void MaintenanceWebServerHandlers::HandleReboot(void) noexcept {
         else if (arg.equals("1")) {
             LOG_DEBUG("Setting firmware to maintenance mode.\n");
 
-            /* Send */
-            page = "<div><h1>Rebooting in maintenance mode.</h1></div>";
-            spInstance->GenericHandler(header + page + footer, 200);
+            /* The page is delivered before the reboot */
+            sink.Write("<div><h1>Rebooting in maintenance mode.</h1></div>");
+            spInstance->EndPage(sink);
 
             error = SystemState::GetInstance()->GetModeManager()->SetMode(
                 E_Mode::MODE_MAINTENANCE
@@ -214,110 +348,265 @@ void MaintenanceWebServerHandlers::HandleReboot(void) noexcept {
             }
         }
         else {
-            page = "<div><h1>Unknown reboot mode.</h1></div>";
+            sink.Write("<div><h1>Unknown reboot mode.</h1></div>");
         }
     }
     else {
-        page = "<div><h1>Unknown reboot mode.</h1></div>";
+        sink.Write("<div><h1>Unknown reboot mode.</h1></div>");
     }
 
     /* Send */
-    spInstance->GenericHandler(header + page + footer, 200);
+    spInstance->EndPage(sink);
+    spInstance->_pArena->Reset();
 }
 
 void MaintenanceWebServerHandlers::HandleRamLoad(void) noexcept {
     Logger*                pLogger;
     S_RamJournalDescriptor logDesc;
-    char                   pBuffer[LOG_LAZY_LOAD_SIZE + 1];
+    char*                  pBuffer;
     size_t                 readBytes;
+    uint32_t               sequence;
     String                 arg;
 
     pLogger = Logger::GetInstance();
 
-    /* Get the current offset */
-    if (spInstance->_pServer->hasArg("offset")) {
-        arg = spInstance->_pServer->arg("offset");
+    pBuffer = (char*)spInstance->_pArena->Allocate(LOG_LAZY_LOAD_SIZE);
+    if (nullptr != pBuffer) {
+        readBytes = 0;
 
-        sscanf(arg.c_str(), "%zu", &readBytes);
+        /* Get the oldest log loaded, the new logs do not move it */
+        if (spInstance->_pServer->hasArg("seq")) {
+            arg = spInstance->_pServer->arg("seq");
 
-        /* Open and offset */
-        pLogger->OpenRamJournal(&logDesc);
-        pLogger->SeekRamJournal(&logDesc, readBytes);
+            sequence = (uint32_t)strtoul(arg.c_str(), NULL, 10);
 
-        /* Read journal */
-        readBytes = pLogger->ReadRamJournal(
-            (uint8_t*)pBuffer,
-            LOG_LAZY_LOAD_SIZE,
-            &logDesc
-        );
-        pBuffer[readBytes] = 0;
+            /* Open and seek */
+            pLogger->OpenRamJournal(&logDesc);
+            pLogger->SeekRamJournal(&logDesc, sequence);
+
+            /* Read journal */
+            readBytes = pLogger->ReadRamJournal(
+                (uint8_t*)pBuffer,
+                LOG_LAZY_LOAD_SIZE,
+                &logDesc
+            );
+
+            /* The RAM journal is binary, provide the next cursor */
+            spInstance->_pServer->sendHeader(
+                LOG_SEQUENCE_HEADER,
+                String(std::to_string(logDesc.sequence).c_str())
+            );
+        }
+
+        /* Update page length and send */
+        spInstance->SendBuffer(pBuffer, readBytes);
     }
     else {
-        readBytes = 0;
+        LOG_ERROR("Failed to allocate the RAM logs buffer.\n");
+        spInstance->_pServer->setContentLength(0);
+        spInstance->_pServer->send(500, "text/html", "");
     }
+    spInstance->_pArena->Reset();
+}
 
-    /* Update page length and send */
-    spInstance->_pServer->setContentLength(readBytes);
-    spInstance->_pServer->send(200, "text/html", pBuffer);
+void MaintenanceWebServerHandlers::HandleRamDownload(void) noexcept {
+    Logger*            pLogger;
+    S_RamJournalStream stream;
+    char*              pBuffer;
+    size_t             readBytes;
+
+    pLogger = Logger::GetInstance();
+
+    /* Keep the web server task stack small */
+    pBuffer = (char*)spInstance->_pArena->Allocate(LOG_STREAM_CHUNK_SIZE);
+    if (nullptr != pBuffer) {
+        /* Unknown length selects the chunked transfer encoding */
+        spInstance->_pServer->sendHeader(
+            "Content-Disposition",
+            "attachment; filename=\"rthr_ram_logs.txt\""
+        );
+        spInstance->_pServer->setContentLength(CONTENT_LENGTH_UNKNOWN);
+        spInstance->_pServer->send(200, "text/plain", "");
+
+        /* Stream the journal, one chunk per read */
+        pLogger->OpenRamJournalStream(&stream);
+        do {
+            readBytes = pLogger->ReadRamJournalStream(
+                (uint8_t*)pBuffer,
+                LOG_STREAM_CHUNK_SIZE,
+                &stream
+            );
+            if (0 < readBytes) {
+                spInstance->_pServer->sendContent(pBuffer, readBytes);
+            }
+        } while (0 < readBytes);
+
+        /* Terminating chunk */
+        spInstance->_pServer->sendContent("");
+    }
+    else {
+        LOG_ERROR("Failed to allocate the RAM logs download buffer.\n");
+        spInstance->_pServer->setContentLength(0);
+        spInstance->_pServer->send(500, "text/html", "");
+    }
+    spInstance->_pArena->Reset();
 }
 
 void MaintenanceWebServerHandlers::HandleJournalLoad(void) noexcept {
-    Logger* pLogger;
-    char    pBuffer[LOG_LAZY_LOAD_SIZE + 1];
-    size_t  readBytes;
-    size_t  offset;
-    size_t  fileSize;
-    String  arg;
-    FsFile  journal;
+    Logger*            pLogger;
+    char*              pBuffer;
+    size_t             readBytes;
+    unsigned long long fromSec;
+    unsigned long long toSec;
+    String             arg;
 
     pLogger = Logger::GetInstance();
 
-    /* Get the current offset */
-    if (spInstance->_pServer->hasArg("offset")) {
-        arg = spInstance->_pServer->arg("offset");
+    /* Get the time range or the current offset */
+    if (spInstance->_pServer->hasArg("from")) {
+        fromSec = strtoull(spInstance->_pServer->arg("from").c_str(), NULL, 10);
+        toSec   = LOG_RANGE_MAX_SEC;
+        arg     = spInstance->_pServer->arg("to");
+        if (!arg.isEmpty()) {
+            toSec = strtoull(arg.c_str(), NULL, 10);
+        }
+        fromSec = fromSec < LOG_RANGE_MAX_SEC ? fromSec : LOG_RANGE_MAX_SEC;
+        toSec   = toSec < LOG_RANGE_MAX_SEC ? toSec : LOG_RANGE_MAX_SEC;
 
-        sscanf(arg.c_str(), "%zu", &readBytes);
+        spInstance->SendJournalRange(
+            fromSec * 1000000000ULL,
+            toSec * 1000000000ULL
+        );
+    }
+    else {
+        pBuffer = (char*)spInstance->_pArena->Allocate(LOG_LAZY_LOAD_SIZE);
+        if (nullptr != pBuffer) {
+            readBytes = 0;
+            if (spInstance->_pServer->hasArg("offset")) {
+                arg = spInstance->_pServer->arg("offset");
 
-        /* Open */
-        journal = pLogger->OpenPersistenJournal();
-        if (journal.isOpen()) {
+                sscanf(arg.c_str(), "%zu", &readBytes);
 
-            /* Read from end of file, get the size */
-            fileSize = journal.size();
-            if (fileSize > readBytes) {
-                /* Get the current cursor */
-                offset = fileSize - readBytes;
+                /* Read the journal, offset from the end */
+                readBytes = pLogger->ReadPersistentJournal(
+                    (uint8_t*)pBuffer,
+                    LOG_LAZY_LOAD_SIZE,
+                    readBytes
+                );
+            }
 
-                /* Get the next cursor */
-                if (LOG_LAZY_LOAD_SIZE < offset) {
-                    offset -= LOG_LAZY_LOAD_SIZE;
-                    readBytes = LOG_LAZY_LOAD_SIZE;
-                }
-                else {
-                    readBytes = offset;
-                    offset = 0;
-                }
-                /* Get the number of bytes to read */
-                journal.seek(offset);
-                readBytes = journal.read(pBuffer, readBytes);
-                pBuffer[readBytes] = 0;
+            /* Update page length and send */
+            spInstance->SendBuffer(pBuffer, readBytes);
+        }
+        else {
+            LOG_ERROR("Failed to allocate the journal logs buffer.\n");
+            spInstance->_pServer->setContentLength(0);
+            spInstance->_pServer->send(500, "text/html", "");
+        }
+    }
+    spInstance->_pArena->Reset();
+}
+
+void MaintenanceWebServerHandlers::HandleLogSearch(void) noexcept {
+    Logger*  pLogger;
+    char*    pBuffer;
+    uint64_t fromNs;
+    uint64_t toNs;
+    uint64_t bootNs;
+    int      level;
+    String   arg;
+    bool     isRam;
+    bool     isValid;
+
+    pLogger = Logger::GetInstance();
+
+    pBuffer = (char*)spInstance->_pArena->Allocate(LOG_SEARCH_BLOCK_SIZE);
+    if (nullptr != pBuffer) {
+        /* Get the filters, the time range is expressed in journal time */
+        level = E_LogLevel::LOG_LEVEL_DEBUG;
+        arg   = spInstance->_pServer->arg("level");
+        if (!arg.isEmpty()) {
+            level = -1;
+            sscanf(arg.c_str(), "%d", &level);
+        }
+
+        fromNs = 0;
+        toNs   = UINT64_MAX;
+        arg    = spInstance->_pServer->arg("from");
+        if (!arg.isEmpty()) {
+            fromNs = strtoull(arg.c_str(), NULL, 10);
+            fromNs = fromNs < LOG_RANGE_MAX_SEC ? fromNs : LOG_RANGE_MAX_SEC;
+            fromNs *= 1000000000ULL;
+        }
+        arg = spInstance->_pServer->arg("to");
+        if (!arg.isEmpty()) {
+            toNs = strtoull(arg.c_str(), NULL, 10);
+            toNs = toNs < LOG_RANGE_MAX_SEC ? toNs : LOG_RANGE_MAX_SEC;
+            toNs *= 1000000000ULL;
+        }
+
+        arg     = spInstance->_pServer->arg("source");
+        isRam   = arg.equals("ram");
+        isValid = (isRam || arg.equals("journal")) &&
+                  E_LogLevel::LOG_LEVEL_CRITICAL <= level &&
+                  E_LogLevel::LOG_LEVEL_DEBUG >= level;
+
+        if (isValid && isRam) {
+            /* The RAM logs are timestamped with the uptime of this boot */
+            bootNs = pLogger->GetJournalTime() - HWManager::GetTime();
+            fromNs = fromNs > bootNs ? fromNs - bootNs : 0;
+            if (UINT64_MAX != toNs && toNs < bootNs) {
+                /* The range ends before this boot */
+                fromNs = UINT64_MAX;
+                toNs   = 0;
+            }
+            else if (UINT64_MAX != toNs) {
+                toNs -= bootNs;
+            }
+
+            isValid = spInstance->_pSearch->Configure(
+                spInstance->_pServer->arg("q").c_str(),
+                (E_LogLevel)level,
+                fromNs,
+                toNs
+            );
+        }
+        else if (isValid) {
+            /* The journal logs are timestamped with the uptime of their boot,
+             * the range only selects the indexed blocks.
+             */
+            isValid = spInstance->_pSearch->Configure(
+                spInstance->_pServer->arg("q").c_str(),
+                (E_LogLevel)level,
+                0,
+                UINT64_MAX
+            );
+        }
+
+        if (isValid) {
+            spInstance->_pServer->setContentLength(CONTENT_LENGTH_UNKNOWN);
+            spInstance->_pServer->send(200, "text/plain", "");
+
+            if (isRam) {
+                spInstance->SearchRamJournal(pBuffer);
             }
             else {
-                readBytes = 0;
+                spInstance->SearchJournalRange(pBuffer, fromNs, toNs);
             }
-            journal.close();
+
+            /* Terminating chunk */
+            spInstance->_pServer->sendContent("");
         }
         else {
-            readBytes = 0;
+            spInstance->_pServer->send(400, "text/plain", "Invalid search.");
         }
     }
     else {
-        readBytes = 0;
+        LOG_ERROR("Failed to allocate the log search buffer.\n");
+        spInstance->_pServer->setContentLength(0);
+        spInstance->_pServer->send(500, "text/html", "");
     }
-
-    /* Update page length and send */
-    spInstance->_pServer->setContentLength(readBytes);
-    spInstance->_pServer->send(200, "text/html", pBuffer);
+    spInstance->_pArena->Reset();
 }
 
 void MaintenanceWebServerHandlers::HandleClearLogs(void) noexcept {
@@ -346,210 +635,533 @@ void MaintenanceWebServerHandlers::HandleClearLogs(void) noexcept {
     spInstance->_pServer->send(200, "text/html", "");
 }
 
-void MaintenanceWebServerHandlers::GetPageHeader(std::string&       rHeaderStr,
-                                                 const std::string& krTitle)
-const noexcept {
-    rHeaderStr.clear();
-    rHeaderStr += "<!DOCTYPE html>\n"
-                  "<html lang='en'>\n"
-                  "<head>\n";
-    rHeaderStr += "<meta name='viewport' ";
-    rHeaderStr += "content='width=device-width, initial-scale=1' "
-                  "charset='UTF-8'/>\n"
-                  "<title>\n";
-    rHeaderStr += krTitle;
-    rHeaderStr += "</title>\n";
-    GeneratePageCSS(rHeaderStr);
-    GeneratePageScripts(rHeaderStr);
-    rHeaderStr += "</head>\n"
-                  "<body>";
+void MaintenanceWebServerHandlers::HandleLogLevel(void) noexcept {
+    Logger* pLogger;
+    int     module;
+    int     level;
+
+    pLogger = Logger::GetInstance();
+
+    /* Get the module and its new level */
+    if (spInstance->_pServer->hasArg("module") &&
+        spInstance->_pServer->hasArg("level")) {
+        module = -1;
+        level  = -1;
+        sscanf(spInstance->_pServer->arg("module").c_str(), "%d", &module);
+        sscanf(spInstance->_pServer->arg("level").c_str(), "%d", &level);
+
+        if (0 <= module && LOG_MODULE_MAX > module &&
+            LOG_LEVEL_ERROR <= level && LOG_LEVEL_DEBUG >= level) {
+            pLogger->SetModuleLevel((E_LogModule)module, (E_LogLevel)level);
+        }
+    }
+
+    /* Go back to the index */
+    spInstance->_pServer->sendHeader("Location", PAGE_URL_INDEX);
+    spInstance->_pServer->setContentLength(0);
+    spInstance->_pServer->send(302, "text/html", "");
 }
 
-void MaintenanceWebServerHandlers::GetPageFooter(std::string& rFooterStr)
-const noexcept {
-    rFooterStr.clear();
-    rFooterStr += "</div></body>\n</html>";
+void MaintenanceWebServerHandlers::HandleEvents(void) noexcept {
+    if (!spInstance->_pEvents->Attach(spInstance->_pServer)) {
+        spInstance->_pServer->send(503, "text/plain", "Too many streams.");
+    }
 }
 
-void MaintenanceWebServerHandlers::GeneratePageCSS(std::string& rHeaderStr)
-const noexcept {
-    rHeaderStr +=
-        "<style>"
-        "body {"
-        "font-family: monospace;"
-        "}"
-        "table, th, td {"
-        "border: 1px dashed gray;"
-        "border-collapse: collapse;"
-        "}"
-        "td, th {"
-        "padding: 5px;"
-        "}"
-        ".log_text {"
-        "border: 1px dashed gray;"
-        "padding: 5px;"
-        "}"
-        "</style>";
+void MaintenanceWebServerHandlers::HandleTraceDownload(void) noexcept {
+    S_TraceExport* pExport;
+    char*          pBuffer;
+    size_t         readBytes;
+
+    /* Keep the web server task stack small */
+    pExport = (S_TraceExport*)spInstance->_pArena->Allocate(
+        sizeof(S_TraceExport)
+    );
+    pBuffer = (char*)spInstance->_pArena->Allocate(LOG_STREAM_CHUNK_SIZE);
+    if (nullptr != pExport && nullptr != pBuffer) {
+        /* Unknown length selects the chunked transfer encoding */
+        spInstance->_pServer->sendHeader(
+            "Content-Disposition",
+            "attachment; filename=\"rthr_trace.json\""
+        );
+        spInstance->_pServer->setContentLength(CONTENT_LENGTH_UNKNOWN);
+        spInstance->_pServer->send(200, "application/json", "");
+
+        /* Stream the trace, one chunk per read */
+        Tracer::OpenExport(*pExport);
+        do {
+            readBytes = Tracer::ReadExport(
+                *pExport,
+                pBuffer,
+                LOG_STREAM_CHUNK_SIZE
+            );
+            if (0 < readBytes) {
+                spInstance->_pServer->sendContent(pBuffer, readBytes);
+            }
+        } while (0 < readBytes);
+
+        /* Terminating chunk */
+        spInstance->_pServer->sendContent("");
+    }
+    else {
+        LOG_ERROR("Failed to allocate the trace download buffer.\n");
+        spInstance->_pServer->setContentLength(0);
+        spInstance->_pServer->send(500, "text/html", "");
+    }
+    spInstance->_pArena->Reset();
 }
 
-void MaintenanceWebServerHandlers::GeneratePageScripts(std::string& rHeaderStr)
-const noexcept {
-    rHeaderStr +=
-        "<script>"
-
-        /* Logs lazy loading generic */
-        "function loadLogs(offset, update_item, item, url){"
-        "var xhr = new XMLHttpRequest();"
-        "xhr.onreadystatechange = function() {"
-        "if (xhr.readyState === 4){"
-        "update_item.innerHTML = xhr.responseText + update_item.innerHTML;"
-        "item.setAttribute('loaded', parseInt(offset) + xhr.responseText.length);"
-        "};"
-        "};"
-        "xhr.open('GET', url + '?offset=' + offset);"
-        "xhr.send();"
-        "}"
-
-        /* Logs clear generic */
-        "function clearLogs(logId){"
-        "var xhr = new XMLHttpRequest();"
-        "xhr.onreadystatechange = function() {"
-        "if (xhr.readyState === 4){"
-        "item = 0;"
-        "if (logId == 0) {"
-        "item=document.getElementById('load_more_ram');"
-        "update_item=document.getElementById('ram_logs');"
-        "}"
-        "else if (logId == 1) {"
-        "item=document.getElementById('load_more_journal');"
-        "update_item=document.getElementById('journal_logs');"
-        "}"
-        "update_item.innerHTML = '';"
-        "item.setAttribute('loaded', 0);"
-        "};"
-        "};"
-        "xhr.open('GET', '" CLEAR_LOGS_URL"?logtype=' + logId);"
-        "xhr.send();"
-        "}"
-
-        /* Document ready */
-        "document.addEventListener('DOMContentLoaded', function() {"
-
-        /* Ram lazy loading */
-        "loadMoreRam = document.getElementById('load_more_ram');"
-        "loadMoreRam.onclick = function(){"
-        "loadLogs(loadMoreRam.getAttribute('loaded'),"
-        "document.getElementById('ram_logs'), loadMoreRam, '"
-        RAM_LOGS_LOAD_URL
-        "');"
-        "return false;};"
-
-        /* Journal lazy loading */
-        "loadMoreJour = document.getElementById('load_more_journal');"
-        "loadMoreJour.onclick = function(){"
-        "loadLogs(loadMoreJour.getAttribute('loaded'),"
-        "document.getElementById('journal_logs'), loadMoreJour, '"
-        JOURNAL_LOGS_LOAD_URL
-        "');"
-        "return false;};"
-
-        /* Log Clear */
-        "resetJour = document.getElementById('reset_file');"
-        "resetJour.onclick = function(){clearLogs(1); return false;};"
-        "resetRam = document.getElementById('reset_ram');"
-        "resetRam.onclick = function(){clearLogs(0); return false;};"
-
-        "});"
-
-        "</script>";
+void MaintenanceWebServerHandlers::HandleTraceState(void) noexcept {
+    E_Return error;
+    String   arg;
+
+    if (spInstance->_pServer->hasArg("state")) {
+        arg = spInstance->_pServer->arg("state");
+        if (arg.equals("1")) {
+            error = Tracer::Start();
+            if (E_Return::NO_ERROR != error) {
+                LOG_ERROR("Failed to start the tracing: %d.\n", error);
+            }
+        }
+        else if (arg.equals("0")) {
+            Tracer::Stop();
+        }
+    }
+
+    /* Go back to the index */
+    spInstance->_pServer->sendHeader("Location", PAGE_URL_INDEX);
+    spInstance->_pServer->setContentLength(0);
+    spInstance->_pServer->send(302, "text/html", "");
+}
+
+void MaintenanceWebServerHandlers::SendJournalRange(const uint64_t kFromNs,
+                                                    const uint64_t kToNs)
+noexcept {
+    Logger* pLogger;
+    char*   pBuffer;
+    char*   pStart;
+    size_t  startOffset;
+    size_t  endOffset;
+    size_t  toRead;
+    size_t  readBytes;
+    bool    isFirst;
+
+    pLogger = Logger::GetInstance();
+
+    pBuffer = (char*)this->_pArena->Allocate(LOG_STREAM_CHUNK_SIZE);
+    if (nullptr != pBuffer) {
+        /* Locate the range, offsets are expressed from the end */
+        startOffset = pLogger->FindPersistentJournalOffset(kFromNs, false);
+        endOffset   = pLogger->FindPersistentJournalOffset(kToNs, true);
+        LOG_DEBUG(
+            "Sending journal range %zu to %zu.\n",
+            startOffset,
+            endOffset
+        );
+
+        this->_pServer->setContentLength(CONTENT_LENGTH_UNKNOWN);
+        this->_pServer->send(200, "text/plain", "");
+
+        isFirst = true;
+        while (startOffset > endOffset) {
+            toRead = startOffset - endOffset;
+            toRead = toRead < LOG_STREAM_CHUNK_SIZE ?
+                     toRead : LOG_STREAM_CHUNK_SIZE;
+            readBytes = pLogger->ReadPersistentJournal(
+                (uint8_t*)pBuffer,
+                toRead,
+                startOffset - toRead
+            );
+
+            if (0 == readBytes) {
+                /* The journal changed under the range, stop here */
+                startOffset = endOffset;
+            }
+            else {
+                startOffset -= readBytes;
+
+                /* Indexed blocks may start in the middle of a log */
+                pStart = pBuffer;
+                if (isFirst &&
+                    pLogger->GetPersistentJournalSize() > startOffset +
+                                                          readBytes) {
+                    pStart = (char*)memchr(pBuffer, '\n', readBytes);
+                    pStart = nullptr != pStart ? pStart + 1 :
+                                                 pBuffer + readBytes;
+                }
+                isFirst = false;
+
+                if (pStart < pBuffer + readBytes) {
+                    this->_pServer->sendContent(
+                        pStart,
+                        pBuffer + readBytes - pStart
+                    );
+                }
+            }
+        }
+
+        /* Terminating chunk */
+        this->_pServer->sendContent("");
+    }
+    else {
+        LOG_ERROR("Failed to allocate the journal range buffer.\n");
+        this->_pServer->setContentLength(0);
+        this->_pServer->send(500, "text/html", "");
+    }
+}
+
+void MaintenanceWebServerHandlers::SearchRamJournal(char* pBuffer) noexcept {
+    Logger*            pLogger;
+    S_RamJournalStream stream;
+    size_t             pending;
+    size_t             readBytes;
+
+    pLogger = Logger::GetInstance();
+
+    pending = 0;
+    pLogger->OpenRamJournalStream(&stream);
+    do {
+        readBytes = pLogger->ReadRamJournalStream(
+            (uint8_t*)pBuffer + pending,
+            LOG_SEARCH_BLOCK_SIZE - pending,
+            &stream
+        );
+        this->SendMatches(pBuffer, pending, readBytes, 0 == readBytes);
+    } while (0 < readBytes);
+}
+
+void MaintenanceWebServerHandlers::SearchJournalRange(char*          pBuffer,
+                                                      const uint64_t kFromNs,
+                                                      const uint64_t kToNs)
+noexcept {
+    Logger* pLogger;
+    char*   pStart;
+    size_t  startOffset;
+    size_t  endOffset;
+    size_t  toRead;
+    size_t  readBytes;
+    size_t  pending;
+    bool    isFirst;
+
+    pLogger = Logger::GetInstance();
+
+    /* Locate the range, offsets are expressed from the end */
+    startOffset = pLogger->FindPersistentJournalOffset(kFromNs, false);
+    endOffset   = pLogger->FindPersistentJournalOffset(kToNs, true);
+    LOG_DEBUG("Searching journal range %zu to %zu.\n", startOffset, endOffset);
+
+    pending = 0;
+    isFirst = true;
+    do {
+        readBytes = 0;
+        if (startOffset > endOffset) {
+            toRead = startOffset - endOffset;
+            toRead = toRead < LOG_SEARCH_BLOCK_SIZE - pending ?
+                     toRead : LOG_SEARCH_BLOCK_SIZE - pending;
+            readBytes = pLogger->ReadPersistentJournal(
+                (uint8_t*)pBuffer + pending,
+                toRead,
+                startOffset - toRead
+            );
+
+            if (0 == readBytes) {
+                /* The journal changed under the range, stop here */
+                startOffset = endOffset;
+            }
+            else {
+                startOffset -= readBytes;
+
+                /* Indexed blocks may start in the middle of a log */
+                if (isFirst &&
+                    pLogger->GetPersistentJournalSize() > startOffset +
+                                                          readBytes) {
+                    pStart = (char*)memchr(pBuffer, '\n', readBytes);
+                    pStart = nullptr != pStart ? pStart + 1 :
+                                                 pBuffer + readBytes;
+                    readBytes -= pStart - pBuffer;
+                    memmove(pBuffer, pStart, readBytes);
+                }
+            }
+            isFirst = false;
+        }
+
+        this->SendMatches(
+            pBuffer,
+            pending,
+            readBytes,
+            startOffset <= endOffset
+        );
+    } while (startOffset > endOffset);
 }
 
-void MaintenanceWebServerHandlers::GenericHandler(const std::string& krPage,
-                                                  const int32_t      kCode)
+void MaintenanceWebServerHandlers::SendMatches(char*        pBuffer,
+                                               size_t&      rPending,
+                                               const size_t kReadBytes,
+                                               const bool   kIsLast)
 noexcept {
+    size_t size;
+    size_t kept;
+    size_t consumed;
+
+    /* The unterminated line of the previous block leads the buffer */
+    size = rPending + kReadBytes;
+    kept = this->_pSearch->Filter(pBuffer, size, kIsLast, consumed);
+    if (0 < kept) {
+        this->_pServer->sendContent(pBuffer, kept);
+    }
+
+    rPending = size - consumed;
+    memmove(pBuffer, pBuffer + consumed, rPending);
+}
+
+void MaintenanceWebServerHandlers::WritePageHeader(PageSink&   rSink,
+                                                   const char* kpTitle)
+const noexcept {
+    /* The shell is constant, only the title is inserted */
+    rSink.Write(spkPageHeaderStart, sizeof(spkPageHeaderStart) - 1);
+    rSink.Write(kpTitle);
+    rSink.Write(spkPageHeaderEnd, sizeof(spkPageHeaderEnd) - 1);
+}
+
+void MaintenanceWebServerHandlers::EndPage(PageSink& rSink) const noexcept {
+    if (!rSink.IsEnded()) {
+        rSink.Write(spkPageFooter, sizeof(spkPageFooter) - 1);
+        rSink.End();
+    }
+}
+
+void MaintenanceWebServerHandlers::SendBuffer(const char*  kpBuffer,
+                                              const size_t kSize) noexcept {
     /* Update page length and send */
-    this->_pServer->setContentLength(krPage.size());
-    this->_pServer->send(kCode, "text/html", krPage.c_str());
+    this->_pServer->setContentLength(kSize);
+    this->_pServer->send(200, "text/html", "");
+    if (0 != kSize) {
+        this->_pServer->sendContent(kpBuffer, kSize);
+    }
+}
+
+void MaintenanceWebServerHandlers::GetFormatedLogLevels(PageSink& rSink)
+const noexcept {
+    static const char* spkLevelNames[] = {
+        "CRITICAL", "ERROR", "INFO", "DEBUG"
+    };
+
+    Logger*    pLogger;
+    E_LogLevel level;
+    uint8_t    module;
+    uint8_t    i;
+
+    pLogger = Logger::GetInstance();
+
+    rSink.Write(
+        "<div><h2>==== Log Levels ====</h2></div>"
+        "<table>"
+        "<tr><th>Module</th><th>Level</th><th>Set</th></tr>"
+    );
+    for (module = 0; LOG_MODULE_MAX > module; ++module) {
+        level = pLogger->GetModuleLevel((E_LogModule)module);
+
+        rSink.Write("<tr><td>");
+        rSink.Write(Logger::GetModuleName((E_LogModule)module));
+        rSink.Write("</td><td>");
+        rSink.Write(spkLevelNames[level]);
+        rSink.Write("</td><td>");
+
+        /* Levels above the compile-time level are compiled out */
+        for (i = LOG_LEVEL_ERROR;
+             LogModuleLevel((E_LogModule)module) >= i;
+             ++i) {
+            rSink.Write("<a href=\"" LOG_LEVEL_URL "?module=");
+            rSink.WriteUInt(module);
+            rSink.Write("&level=");
+            rSink.WriteUInt(i);
+            rSink.Write("\">");
+            rSink.Write(spkLevelNames[i]);
+            rSink.Write("</a> ");
+        }
+        rSink.Write("</td></tr>");
+    }
+    rSink.Write("</table>");
+}
+
+void MaintenanceWebServerHandlers::GetFormatedSettingsMemory(
+    PageSink& rSink
+) const noexcept {
+    S_SettingsMemoryStats stats;
+
+    rSink.Write("<div><h2>==== Settings Memory ====</h2></div>");
+    if (E_Return::NO_ERROR ==
+        SystemState::GetInstance()->GetSettings()->GetMemoryStats(&stats)) {
+        rSink.Write("<table><tr><td>Arena</td><td>");
+        rSink.WriteUInt(stats.arenaUsed);
+        rSink.Write(" / ");
+        rSink.WriteUInt(stats.arenaSize);
+        rSink.Write(" B (");
+        rSink.Write(stats.isArenaExternal ? "PSRAM" : "internal");
+        rSink.Write(")</td></tr><tr><td>Arena peak</td><td>");
+        rSink.WriteUInt(stats.arenaPeak);
+        rSink.Write(" B</td></tr><tr><td>Live values</td><td>");
+        rSink.WriteUInt(stats.liveSize);
+        rSink.Write(" B in ");
+        rSink.WriteUInt(stats.settingsCount);
+        rSink.Write(" settings</td></tr><tr><td>Compactions</td><td>");
+        rSink.WriteUInt(stats.arenaCompactions);
+        rSink.Write("</td></tr><tr><td>Internal heap free</td><td>");
+        rSink.WriteUInt(stats.heapFree);
+        rSink.Write(" B (min ");
+        rSink.WriteUInt(stats.heapMinFree);
+        rSink.Write(" B)</td></tr><tr><td>Largest free block</td><td>");
+        rSink.WriteUInt(stats.heapLargestBlock);
+        rSink.Write(" B</td></tr></table>");
+    }
+    else {
+        rSink.Write("<div>Settings memory unavailable.</div>");
+    }
+}
+
+void MaintenanceWebServerHandlers::GetFormatedMemoryPools(PageSink& rSink)
+const noexcept {
+    S_MemPoolStats      stats;
+    S_RequestArenaStats arenaStats;
+    uint8_t             pool;
+
+    rSink.Write(
+        "<div><h2>==== Memory Pools ====</h2></div>"
+        "<table>"
+        "<tr><th>Pool</th><th>Used</th><th>High-water</th>"
+        "<th>Blocks</th><th>Heap</th><th>Fallbacks</th></tr>"
+    );
+    for (pool = 0; E_MemPoolId::MEM_POOL_COUNT > pool; ++pool) {
+        MemoryPool::GetStats((E_MemPoolId)pool, stats);
+
+        rSink.Write("<tr><td>");
+        rSink.Write(MemoryPool::GetName((E_MemPoolId)pool));
+        rSink.Write("</td><td>");
+        rSink.WriteUInt(stats.used);
+        rSink.Write(" / ");
+        rSink.WriteUInt(stats.poolSize);
+        rSink.Write(" B</td><td>");
+        rSink.WriteUInt(stats.highWater);
+        rSink.Write(" B</td><td>");
+        rSink.WriteUInt(stats.usedBlocks);
+        rSink.Write(" / ");
+        rSink.WriteUInt(stats.blockCount);
+        rSink.Write("</td><td>");
+        rSink.WriteUInt(stats.heapUsed);
+        rSink.Write(" B</td><td>");
+        rSink.WriteUInt(stats.fallbacks);
+        rSink.Write("</td></tr>");
+    }
+    rSink.Write("</table>");
+
+    this->_pArena->GetStats(arenaStats);
+    rSink.Write("<table><tr><td>Request arena peak</td><td>");
+    rSink.WriteUInt(arenaStats.peak);
+    rSink.Write(" / ");
+    rSink.WriteUInt(arenaStats.size);
+    rSink.Write(" B over ");
+    rSink.WriteUInt(arenaStats.requests);
+    rSink.Write(" requests, ");
+    rSink.WriteUInt(arenaStats.failures);
+    rSink.Write(" refused</td></tr></table>");
 }
 
-void MaintenanceWebServerHandlers::GetFormatedLogs(std::string& rPage) const
+void MaintenanceWebServerHandlers::GetFormatedLogs(PageSink& rSink) const
 noexcept {
     Logger*                pLogger;
     S_RamJournalDescriptor logDesc;
-    char                   pBuffer[LOG_LAZY_LOAD_SIZE + 1];
+    char*                  pBuffer;
     size_t                 readBytes;
-    FsFile                 journal;
-    size_t                 fileSize;
+    uint32_t               next;
 
     pLogger = Logger::GetInstance();
 
-    rPage += "<div><h2>==== Log Journals ====</h2></div>";
-    rPage += "<table>";
-    rPage += "<tr>";
-    rPage += "<td><a id=\"reset_ram\" href=\"#\">Clear RAM Logs</a></td>";
-    rPage += "<td><a id=\"reset_file\" href=\"#\">Clear Journal Logs</a></td>";
-    rPage += "</tr>";
-    rPage += "</table>";
+    rSink.Write(
+        "<div><h2>==== Log Journals ====</h2></div>"
+        "<table>"
+        "<tr>"
+        "<td><a id=\"reset_ram\" href=\"#\">Clear RAM Logs</a></td>"
+        "<td><a id=\"reset_file\" href=\"#\">Clear Journal Logs</a></td>"
+        "<td><a href=\"" RAM_LOGS_DOWNLOAD_URL "\">Download RAM Logs</a></td>"
+        "</tr>"
+        "</table>"
+        "<div><form action=\"" LOG_SEARCH_URL "\">"
+        "Search <select name=\"source\">"
+        "<option value=\"ram\">RAM</option>"
+        "<option value=\"journal\">Journal</option>"
+        "</select> Level <select name=\"level\">"
+        "<option value=\"3\">DEBUG</option>"
+        "<option value=\"2\">INFO</option>"
+        "<option value=\"1\">ERROR</option>"
+        "<option value=\"0\">CRITICAL</option>"
+        "</select> Pattern <input name=\"q\" size=\"20\"> "
+        "From (s) <input name=\"from\" size=\"10\"> "
+        "To (s) <input name=\"to\" size=\"10\"> "
+        "<input type=\"submit\" value=\"Search\">"
+        "</form></div>"
+    );
 
+    /* The read buffer lives until the request completes */
+    pBuffer = (char*)this->_pArena->Allocate(LOG_LAZY_LOAD_SIZE);
 
-    /* Get the RAM logs */
+    /* Get the RAM logs, the live logs start after the newest one */
     pLogger->OpenRamJournal(&logDesc);
-    rPage += "<div><h3>==== RAM Logs ====</h3></div>";
-    rPage += "<div class=\"log_text\"><p>";
-
-
-    readBytes = pLogger->ReadRamJournal(
-        (uint8_t*)pBuffer,
-        LOG_LAZY_LOAD_SIZE,
-        &logDesc
+    next = logDesc.sequence;
+    rSink.Write(
+        "<div><h3>==== RAM Logs ====</h3></div>"
+        "<div class=\"log_text\"><p>"
     );
-    pBuffer[readBytes] = 0;
 
-    rPage += "<p>";
-    rPage += "<a id=\"load_more_ram\" loaded=\"";
-    rPage += std::to_string(readBytes);
-    rPage += "\" href=\"#\">Load previous...<a><br />";
-    rPage += "<pre id=\"ram_logs\">";
-    rPage += pBuffer;
-    rPage += "</pre></p>";
-    rPage += "</div>";
+    readBytes = 0;
+    if (nullptr != pBuffer) {
+        readBytes = pLogger->ReadRamJournal(
+            (uint8_t*)pBuffer,
+            LOG_LAZY_LOAD_SIZE,
+            &logDesc
+        );
+    }
 
+    rSink.Write("<p><a id=\"load_more_ram\" loaded=\"");
+    rSink.WriteUInt(logDesc.sequence);
+    rSink.Write(
+        "\" href=\"#\">Load previous...<a><br />"
+        "<pre id=\"ram_logs\" next=\""
+    );
+    rSink.WriteUInt(next);
+    rSink.Write("\">");
+    rSink.Write(pBuffer, readBytes);
+    rSink.Write("</pre></p></div>");
 
     /* Get the journal logs */
-    rPage += "<div><h3>==== Journal Logs ====</h3></div>";
-    rPage += "<div class=\"log_text\"><p>";
-
-    journal = pLogger->OpenPersistenJournal();
-    if (journal.isOpen()) {
-        /* Read from end of file, get the size */
-        fileSize = journal.size();
-
-        /* Get the next cursor */
-        if (LOG_LAZY_LOAD_SIZE < fileSize) {
-            journal.seek(fileSize - LOG_LAZY_LOAD_SIZE);
-            readBytes = LOG_LAZY_LOAD_SIZE;
-        }
-        else {
-            readBytes = fileSize;
-        }
-        /* Get the number of bytes to read */
-        readBytes = journal.read(pBuffer, readBytes);
-        pBuffer[readBytes] = 0;
-        journal.close();
-    }
-    else {
-        readBytes = 0;
-    }
-    pBuffer[readBytes] = 0;
+    rSink.Write(
+        "<div><h3>==== Journal Logs ====</h3></div>"
+        "<div><form action=\"" JOURNAL_LOGS_LOAD_URL "\">"
+        "Journal time: "
+    );
+    rSink.WriteUInt(pLogger->GetJournalTime() / 1000000000ULL);
+    rSink.Write(
+        "s | From (s) <input name=\"from\" size=\"10\"> "
+        "To (s) <input name=\"to\" size=\"10\"> "
+        "<input type=\"submit\" value=\"Get range\">"
+        "</form></div>"
+        "<div class=\"log_text\"><p>"
+    );
 
-    rPage += "<p>";
-    rPage += "<a id=\"load_more_journal\" loaded=\"";
-    rPage += std::to_string(readBytes);
-    rPage += "\" href=\"#\">Load previous...<a><br />";
-    rPage += "<pre id=\"journal_logs\">";
-    rPage += pBuffer;
+    readBytes = 0;
+    if (nullptr != pBuffer) {
+        readBytes = pLogger->ReadPersistentJournal(
+            (uint8_t*)pBuffer,
+            LOG_LAZY_LOAD_SIZE,
+            0
+        );
+    }
 
-    rPage += "</pre></p>";
-    rPage += "</div>";
+    rSink.Write("<p><a id=\"load_more_journal\" loaded=\"");
+    rSink.WriteUInt(readBytes);
+    rSink.Write(
+        "\" href=\"#\">Load previous...<a><br />"
+        "<pre id=\"journal_logs\">"
+    );
+    rSink.Write(pBuffer, readBytes);
+    rSink.Write("</pre></p></div>");
 }
-
@@ -21,11 +21,16 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
 /* Included headers */
-#include <string>        /* Standard string */
-#include <Errors.h>      /* Errors definitions */
-#include <Logger.h>      /* Logger services */
-#include <PageHandler.h> /* Page Handler interface */
+#include <string>          /* Standard string */
+#include <Errors.h>        /* Errors definitions */
+#include <Logger.h>        /* Logger services */
+#include <PageHandler.h>   /* Page Handler interface */
+#include <SystemState.h>   /* System state */
+#include <SystemMonitor.h> /* Monitor samples */
 
 /* Header file */
 #include <MonitorPageHandler.h>
@@ -50,7 +55,17 @@
 /*******************************************************************************
  * STATIC FUNCTIONS DECLARATIONS
  ******************************************************************************/
-/* None */
+/**
+ * @brief Writes a permille value as a percentage with one decimal.
+ *
+ * @details Writes a permille value as a percentage with one decimal. The CPU
+ * usages are only sampled with the run time statistics, "n/a" is written
+ * when they are disabled.
+ *
+ * @param[out] rSink The sink that receives the value.
+ * @param[in] kPermille The value in permille.
+ */
+static void WritePermille(PageSink& rSink, const uint32_t kPermille) noexcept;
 
 /*******************************************************************************
  * GLOBAL VARIABLES
@@ -63,12 +78,55 @@
 /* None */
 
 /************************** Static global variables ***************************/
-/* None */
+/** @brief The monitor page status, filled by the live events stream. */
+static const char spkMonitorHead[] =
+    "<div>"
+    "<h1>Monitor</h1>"
+    "<table>"
+    "<tr><td>Uptime (s)</td><td id='uptime_s'>-</td></tr>"
+    "<tr><td>Free heap</td><td id='heap_free'>-</td></tr>"
+    "<tr><td>Lowest free heap</td><td id='heap_min'>-</td></tr>"
+    "<tr><td>HM pending actions</td><td id='hm_pending'>-</td></tr>"
+    "<tr><td>HM executed actions</td><td id='hm_executed'>-</td></tr>"
+    "<tr><td>HM dropped actions</td><td id='hm_dropped'>-</td></tr>"
+    "</table>";
+
+/** @brief The monitor page logs, filled by the live events stream. */
+static const char spkMonitorBody[] =
+    "<h2>Logs</h2>"
+    "<pre id='logs'></pre>"
+    "</div>"
+    "<script>"
+    "if(window.EventSource){"
+    "var s=new EventSource('/events');"
+    "var l=document.getElementById('logs');"
+    "s.addEventListener('log',function(e){"
+    "l.appendChild(document.createTextNode(e.data+'\\n'));"
+    "window.scrollTo(0,document.body.scrollHeight);"
+    "});"
+    "s.addEventListener('status',function(e){"
+    "var d=JSON.parse(e.data);"
+    "for(var k in d){"
+    "var c=document.getElementById(k);"
+    "if(c){c.textContent=d[k];}"
+    "}"
+    "});"
+    "}"
+    "</script>";
 
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
-/* None */
+static void WritePermille(PageSink& rSink, const uint32_t kPermille) noexcept {
+    if (SYSMON_HAS_RUN_TIME) {
+        rSink.WriteUInt(kPermille / 10);
+        rSink.Write(".");
+        rSink.WriteUInt(kPermille % 10);
+    }
+    else {
+        rSink.Write("n/a");
+    }
+}
 
 /*******************************************************************************
  * CLASS METHODS
@@ -81,11 +139,77 @@ MonitorPageHandler::~MonitorPageHandler(void) noexcept {
     PANIC("Tried to destroy the Monitor page handler.\n");
 }
 
-void MonitorPageHandler::Generate(std::string& rPageTitle,
-                                  std::string& rPageBody) noexcept {
-    rPageTitle = MONITOR_PAGE_TITLE;
-    rPageBody =
-        "<div>"
-        "   <h1>Monitor</h1>"
-        "</div";
+const char* MonitorPageHandler::GetTitle(void) const noexcept {
+    return MONITOR_PAGE_TITLE;
+}
+
+void MonitorPageHandler::Generate(PageSink& rSink) noexcept {
+    /* The content is pushed by the events stream once the page loaded */
+    rSink.Write(spkMonitorHead, sizeof(spkMonitorHead) - 1);
+    GenerateSystem(rSink);
+    rSink.Write(spkMonitorBody, sizeof(spkMonitorBody) - 1);
+}
+
+void MonitorPageHandler::GenerateSystem(PageSink& rSink) noexcept {
+    SystemMonitor*      pMonitor;
+    const S_SysMonTask* kpTask;
+    uint32_t            i;
+
+    rSink.Write("<h2>System</h2>");
+    pMonitor = SystemState::GetInstance()->GetSystemMonitor();
+    if (nullptr == pMonitor || !pMonitor->GetLatest(this->_sample)) {
+        rSink.Write("<p>The system monitor has no sample.</p>");
+    }
+    else {
+        rSink.Write("<table>");
+        for (i = 0; portNUM_PROCESSORS > i; ++i) {
+            rSink.Write("<tr><td>Core ");
+            rSink.WriteUInt(i);
+            rSink.Write(" load (%)</td><td>");
+            WritePermille(rSink, this->_sample.pCoreLoad[i]);
+            rSink.Write("</td></tr>");
+        }
+        rSink.Write("<tr><td>Sockets</td><td>");
+        rSink.WriteUInt(this->_sample.socketsUsed);
+        rSink.Write(" / ");
+        rSink.WriteUInt(this->_sample.socketsMax);
+        rSink.Write("</td></tr></table>");
+
+        /* The fragmentation shows as a largest block far below the free */
+        rSink.Write(
+            "<h3>Memory</h3><table><tr><th>Region</th><th>Free</th>"
+            "<th>Largest block</th></tr><tr><td>SRAM</td><td>"
+        );
+        rSink.WriteUInt(this->_sample.internalFree);
+        rSink.Write("</td><td>");
+        rSink.WriteUInt(this->_sample.internalLargest);
+        rSink.Write("</td></tr><tr><td>PSRAM</td><td>");
+        rSink.WriteUInt(this->_sample.psramFree);
+        rSink.Write("</td><td>");
+        rSink.WriteUInt(this->_sample.psramLargest);
+        rSink.Write("</td></tr></table>");
+
+        rSink.Write(
+            "<h3>Tasks</h3><table><tr><th>Task</th><th>Core</th>"
+            "<th>CPU (%)</th><th>Free stack</th></tr>"
+        );
+        for (i = 0; this->_sample.taskCount > i; ++i) {
+            kpTask = &this->_sample.pTasks[i];
+            rSink.Write("<tr><td>");
+            rSink.Write(kpTask->pName);
+            rSink.Write("</td><td>");
+            if (SYSMON_CORE_ANY == kpTask->core) {
+                rSink.Write("-");
+            }
+            else {
+                rSink.WriteInt(kpTask->core);
+            }
+            rSink.Write("</td><td>");
+            WritePermille(rSink, kpTask->cpuPermille);
+            rSink.Write("</td><td>");
+            rSink.WriteUInt(kpTask->stackFree);
+            rSink.Write("</td></tr>");
+        }
+        rSink.Write("</table>");
+    }
 }
\ No newline at end of file
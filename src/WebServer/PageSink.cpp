@@ -0,0 +1,211 @@
+/*******************************************************************************
+ * @file PageSink.cpp
+ *
+ * @see PageSink.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Web server response output sink.
+ *
+ * @details Web server response output sink. Pages are written in a small fixed
+ * buffer that is sent as an HTTP chunk each time it fills.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/* Included headers */
+#include <string>      /* Standard strings */
+#include <cstring>     /* Standard string manipulation */
+#include <algorithm>   /* Standard algorithms */
+#include <Arduino.h>   /* Arduino Framework */
+#include <WebServer.h> /* Web server services */
+
+/* Header file */
+#include <PageSink.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the maximal number of decimal digits of a 64 bits value. */
+#define PAGE_SINK_MAX_DIGITS 20
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+PageSink::PageSink(WebServer*    pServer,
+                   const int32_t kCode,
+                   const char*   pkContentType,
+                   RequestArena* pArena) noexcept {
+    this->_pServer = pServer;
+    this->_code = kCode;
+    this->_pkContentType = pkContentType;
+    this->_used = 0;
+    this->_size = 0;
+    this->_isStarted = false;
+    this->_isEnded = false;
+
+    this->_pBuffer = nullptr;
+    if (nullptr != pArena) {
+        this->_pBuffer = (char*)pArena->Allocate(PAGE_SINK_ARENA_BUFFER_SIZE);
+    }
+    if (nullptr != this->_pBuffer) {
+        this->_capacity = PAGE_SINK_ARENA_BUFFER_SIZE;
+    }
+    else {
+        this->_pBuffer = this->_pLocal;
+        this->_capacity = PAGE_SINK_BUFFER_SIZE;
+    }
+}
+
+PageSink::~PageSink(void) noexcept {
+    End();
+}
+
+void PageSink::Write(const char* kpData, const size_t kSize) noexcept {
+    size_t toCopy;
+    size_t offset;
+
+    if (!this->_isEnded) {
+        this->_size += kSize;
+        if (this->_capacity <= kSize) {
+            /* Do not copy large blocks, they are flash-resident constants */
+            Flush();
+            this->_pServer->sendContent(kpData, kSize);
+        }
+        else {
+            offset = 0;
+            while (kSize > offset) {
+                toCopy = std::min(
+                    kSize - offset,
+                    this->_capacity - this->_used
+                );
+                memcpy(this->_pBuffer + this->_used, kpData + offset, toCopy);
+                this->_used += toCopy;
+                offset += toCopy;
+
+                if (this->_capacity == this->_used) {
+                    Flush();
+                }
+            }
+        }
+    }
+}
+
+void PageSink::Write(const char* kpStr) noexcept {
+    Write(kpStr, strlen(kpStr));
+}
+
+void PageSink::Write(const std::string& krStr) noexcept {
+    Write(krStr.c_str(), krStr.size());
+}
+
+void PageSink::WriteUInt(const uint64_t kValue) noexcept {
+    char     pDigits[PAGE_SINK_MAX_DIGITS];
+    size_t   position;
+    uint64_t value;
+
+    /* Digits are produced from the end */
+    position = PAGE_SINK_MAX_DIGITS;
+    value = kValue;
+    do {
+        --position;
+        pDigits[position] = (char)('0' + value % 10);
+        value /= 10;
+    } while (0 != value);
+
+    Write(pDigits + position, PAGE_SINK_MAX_DIGITS - position);
+}
+
+void PageSink::WriteInt(const int64_t kValue) noexcept {
+    if (0 > kValue) {
+        Write("-", 1);
+        WriteUInt(0 - (uint64_t)kValue);
+    }
+    else {
+        WriteUInt((uint64_t)kValue);
+    }
+}
+
+void PageSink::End(void) noexcept {
+    if (!this->_isEnded) {
+        if (!this->_isStarted) {
+            /* The whole response fits in the buffer, send its exact size */
+            this->_pServer->setContentLength(this->_used);
+            this->_pServer->send(this->_code, this->_pkContentType, "");
+            if (0 != this->_used) {
+                this->_pServer->sendContent(this->_pBuffer, this->_used);
+            }
+            this->_isStarted = true;
+        }
+        else {
+            Flush();
+
+            /* Terminating chunk */
+            this->_pServer->sendContent("");
+        }
+        this->_used = 0;
+        this->_isEnded = true;
+    }
+}
+
+bool PageSink::IsEnded(void) const noexcept {
+    return this->_isEnded;
+}
+
+size_t PageSink::GetSize(void) const noexcept {
+    return this->_size;
+}
+
+void PageSink::Flush(void) noexcept {
+    if (!this->_isStarted) {
+        /* Unknown length selects the chunked transfer encoding */
+        this->_pServer->setContentLength(CONTENT_LENGTH_UNKNOWN);
+        this->_pServer->send(this->_code, this->_pkContentType, "");
+        this->_isStarted = true;
+    }
+    if (0 != this->_used) {
+        this->_pServer->sendContent(this->_pBuffer, this->_used);
+        this->_used = 0;
+    }
+}
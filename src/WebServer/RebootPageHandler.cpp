@@ -21,6 +21,9 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
 /* Included headers */
 #include <string>              /* Standard string */
 #include <Errors.h>            /* Errors definitions */
@@ -84,16 +87,15 @@ RebootPageHandler::~RebootPageHandler(void) noexcept {
     PANIC("Tried to destroy the Reboot page handler.\n");
 }
 
-void RebootPageHandler::Generate(std::string& rPageTitle,
-                                 std::string& rPageBody) noexcept {
+const char* RebootPageHandler::GetTitle(void) const noexcept {
+    return REBOOT_PAGE_TITLE;
+}
+
+void RebootPageHandler::Generate(PageSink& rSink) noexcept {
     WebServer*         pServer;
     WebServerHandlers* pHandlers;
     E_Return           error;
     String             arg;
-    std::string        header;
-    std::string        footer;
-
-    rPageTitle = REBOOT_PAGE_TITLE;
 
     pHandlers = GetHandlers();
     pServer = pHandlers->GetServer();
@@ -103,12 +105,9 @@ void RebootPageHandler::Generate(std::string& rPageTitle,
 
         /* Get the reboot mode */
         if (arg.equals("0")) {
-            /* Send */
-            pHandlers->GetPageHeader(header, rPageTitle);
-            pHandlers->GetPageFooter(footer);
-
-            rPageBody = "<div><h1>Rebooting in nominal mode.</h1></div>";
-            pHandlers->GenericHandler(header + rPageBody + footer, 200);
+            /* Send the whole page before the mode change reboots us */
+            rSink.Write("<div><h1>Rebooting in nominal mode.</h1></div>");
+            pHandlers->EndPage(rSink);
 
             error = SystemState::GetInstance()->GetModeManager()->SetMode(
                 E_Mode::MODE_NOMINAL
@@ -118,12 +117,9 @@ void RebootPageHandler::Generate(std::string& rPageTitle,
             }
         }
         else if (arg.equals("1")) {
-            /* Send */
-            pHandlers->GetPageHeader(header, rPageTitle);
-            pHandlers->GetPageFooter(footer);
-
-            rPageBody = "<div><h1>Rebooting in maintenance mode.</h1></div>";
-            pHandlers->GenericHandler(header + rPageBody + footer, 200);
+            /* Send the whole page before the mode change reboots us */
+            rSink.Write("<div><h1>Rebooting in maintenance mode.</h1></div>");
+            pHandlers->EndPage(rSink);
 
             error = SystemState::GetInstance()->GetModeManager()->SetMode(
                 E_Mode::MODE_MAINTENANCE
@@ -133,10 +129,10 @@ void RebootPageHandler::Generate(std::string& rPageTitle,
             }
         }
         else {
-            rPageBody = "<div><h1>Unknown reboot mode.</h1></div>";
+            rSink.Write("<div><h1>Unknown reboot mode.</h1></div>");
         }
     }
     else {
-        rPageBody = "<div><h1>Unknown reboot mode.</h1></div>";
+        rSink.Write("<div><h1>Unknown reboot mode.</h1></div>");
     }
 }
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * @file RequestArena.cpp
+ *
+ * @see RequestArena.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Per-request memory arena.
+ *
+ * @details Per-request memory arena. The buffers needed to handle a request
+ * are taken from a bump-pointer arena that is reset when the request
+ * completes, no memory is allocated from the heap while handling requests.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
+/* Included headers */
+#include <exception>    /* Standard exceptions */
+#include <cstdint>      /* Standard integer definitions */
+#include <Logger.h>     /* Logger services */
+#include <MemoryPool.h> /* Web memory pool */
+
+/* Header file */
+#include <RequestArena.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+RequestArena::RequestArena(const size_t kSize) noexcept {
+    this->_size = kSize;
+    this->_used = 0;
+    this->_stats.size = kSize;
+    this->_stats.peak = 0;
+    this->_stats.requests = 0;
+    this->_stats.failures = 0;
+
+    /* The arena is taken once, it is accounted to the web pool */
+    this->_pMemory = nullptr;
+    try {
+        this->_pMemory = (uint8_t*)MemoryPool::Allocate(
+            E_MemPoolId::MEM_POOL_WEB,
+            kSize
+        );
+    }
+    catch (std::exception& rExc) {
+        this->_size = 0;
+        PANIC(
+            "Failed to allocate the request arena. Error: %s.\n",
+            rExc.what()
+        );
+    }
+}
+
+RequestArena::~RequestArena(void) noexcept {
+    PANIC("Tried to destroy a request arena.\n");
+}
+
+void* RequestArena::Allocate(const size_t kSize) noexcept {
+    void*  pMemory;
+    size_t size;
+
+    size = (kSize + REQUEST_ARENA_ALIGN - 1) & ~(REQUEST_ARENA_ALIGN - 1);
+    if (this->_size - this->_used >= size) {
+        pMemory = this->_pMemory + this->_used;
+        this->_used += size;
+    }
+    else {
+        LOG_DEBUG("Request arena exhausted, %zu bytes refused.\n", kSize);
+        pMemory = nullptr;
+        ++this->_stats.failures;
+    }
+
+    return pMemory;
+}
+
+void RequestArena::Reset(void) noexcept {
+    if (this->_stats.peak < this->_used) {
+        this->_stats.peak = this->_used;
+    }
+    ++this->_stats.requests;
+    this->_used = 0;
+}
+
+void RequestArena::GetStats(S_RequestArenaStats& rStats) const noexcept {
+    rStats = this->_stats;
+}
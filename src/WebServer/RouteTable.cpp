@@ -0,0 +1,244 @@
+/*******************************************************************************
+ * @file RouteTable.cpp
+ *
+ * @see RouteTable.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief HTTP servers route table.
+ *
+ * @details HTTP servers route table. Routes are described by a constant table
+ * sorted by path, checked at compile time. Requests are matched on the raw URI
+ * bytes by binary search, without any allocation.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>     /* Standard integer definitions */
+#include <cstring>     /* String manipulation */
+#include <algorithm>   /* std::min */
+#include <Arduino.h>   /* Arduino Framework */
+#include <WebServer.h> /* Web server services */
+
+/* Header file */
+#include <RouteTable.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Compares a route path to an URI.
+ *
+ * @param[in] krRoute The route.
+ * @param[in] kpUri The URI.
+ * @param[in] kLength The URI length in bytes.
+ *
+ * @return A negative value if the route sorts first, 0 if the path and the
+ * URI are equal, a positive value otherwise.
+ */
+static int32_t CompareRoute(const S_Route& krRoute,
+                            const char*    kpUri,
+                            const size_t   kLength) noexcept;
+
+/**
+ * @brief Tells if a route accepts a method.
+ *
+ * @param[in] krRoute The route.
+ * @param[in] kMethod The request method.
+ *
+ * @return true if the route accepts the method.
+ */
+static bool AcceptsMethod(const S_Route&   krRoute,
+                          const HTTPMethod kMethod) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/* None */
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static int32_t CompareRoute(const S_Route& krRoute,
+                            const char*    kpUri,
+                            const size_t   kLength) noexcept {
+    int32_t result;
+
+    result = memcmp(
+        krRoute.pkPath,
+        kpUri,
+        std::min(krRoute.pathLength, kLength)
+    );
+    if (0 == result && krRoute.pathLength != kLength) {
+        result = (krRoute.pathLength < kLength) ? -1 : 1;
+    }
+
+    return result;
+}
+
+static bool AcceptsMethod(const S_Route&   krRoute,
+                          const HTTPMethod kMethod) noexcept {
+    return HTTP_ANY == krRoute.method || kMethod == krRoute.method;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+RouteTable::RouteTable(const S_Route*     kpRoutes,
+                       const size_t       kCount,
+                       const RouteHandler handler) noexcept {
+    this->_pkRoutes = kpRoutes;
+    this->_count = kCount;
+    this->_handler = handler;
+    this->_rawHandler = nullptr;
+    this->_rawFilter = nullptr;
+    this->_rawId = 0;
+    this->_pkMatch = nullptr;
+}
+
+void RouteTable::SetRawHandler(const uint32_t        kId,
+                               const RouteRawHandler handler) noexcept {
+    this->_rawId = kId;
+    this->_rawHandler = handler;
+}
+
+void RouteTable::SetRawFilter(const RouteRawFilter filter) noexcept {
+    this->_rawFilter = filter;
+}
+
+const S_Route* RouteTable::Find(const char*      kpUri,
+                                const size_t     kLength,
+                                const HTTPMethod kMethod,
+                                E_RouteMatch&    rMatch) const noexcept {
+    const S_Route* pkFound;
+    size_t         low;
+    size_t         high;
+    size_t         middle;
+    size_t         i;
+    int32_t        result;
+
+    /* Exact paths */
+    pkFound = nullptr;
+    low = 0;
+    high = this->_count;
+    while (low < high && nullptr == pkFound) {
+        middle = low + (high - low) / 2;
+        result = CompareRoute(this->_pkRoutes[middle], kpUri, kLength);
+        if (0 == result) {
+            pkFound = &this->_pkRoutes[middle];
+        }
+        else if (0 > result) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+
+    /* Longest prefix */
+    if (nullptr == pkFound) {
+        for (i = 0; this->_count > i; ++i) {
+            if (this->_pkRoutes[i].isPrefix &&
+                this->_pkRoutes[i].pathLength <= kLength &&
+                0 == memcmp(
+                    this->_pkRoutes[i].pkPath,
+                    kpUri,
+                    this->_pkRoutes[i].pathLength
+                ) &&
+                (nullptr == pkFound ||
+                 pkFound->pathLength < this->_pkRoutes[i].pathLength)) {
+                pkFound = &this->_pkRoutes[i];
+            }
+        }
+    }
+
+    if (nullptr == pkFound) {
+        rMatch = E_RouteMatch::ROUTE_NO_MATCH;
+    }
+    else if (!AcceptsMethod(*pkFound, kMethod)) {
+        rMatch = E_RouteMatch::ROUTE_METHOD_MISMATCH;
+        pkFound = nullptr;
+    }
+    else {
+        rMatch = E_RouteMatch::ROUTE_MATCH;
+    }
+
+    return pkFound;
+}
+
+bool RouteTable::canHandle(HTTPMethod method, String uri) {
+    E_RouteMatch match;
+
+    this->_pkMatch = Find(uri.c_str(), uri.length(), method, match);
+
+    return nullptr != this->_pkMatch;
+}
+
+bool RouteTable::handle(WebServer& server,
+                        HTTPMethod requestMethod,
+                        String     requestUri) {
+    bool isHandled;
+
+    (void)server;
+    (void)requestMethod;
+    (void)requestUri;
+
+    /* The server always calls canHandle first */
+    isHandled = (nullptr != this->_pkMatch);
+    if (isHandled) {
+        this->_handler(*this->_pkMatch);
+        this->_pkMatch = nullptr;
+    }
+
+    return isHandled;
+}
+
+bool RouteTable::canRaw(String uri) {
+    (void)uri;
+
+    /* The server always calls canHandle first */
+    return nullptr != this->_rawHandler &&
+           nullptr != this->_pkMatch &&
+           (this->_rawId == this->_pkMatch->id ||
+            (nullptr != this->_rawFilter &&
+             this->_rawFilter(*this->_pkMatch)));
+}
+
+void RouteTable::raw(WebServer& server, String requestUri, HTTPRaw& raw) {
+    (void)server;
+    (void)requestUri;
+
+    if (canRaw(requestUri)) {
+        this->_rawHandler(*this->_pkMatch, raw);
+    }
+}
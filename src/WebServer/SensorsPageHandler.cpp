@@ -21,11 +21,18 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
 /* Included headers */
-#include <string>        /* Standard string */
-#include <Errors.h>      /* Errors definitions */
-#include <Logger.h>      /* Logger services */
-#include <PageHandler.h> /* Page Handler interface */
+#include <cstdio>         /* snprintf */
+#include <string>         /* Standard string */
+#include <BSP.h>          /* Time services */
+#include <Errors.h>       /* Errors definitions */
+#include <Logger.h>       /* Logger services */
+#include <PageHandler.h>  /* Page Handler interface */
+#include <SystemState.h>  /* System state */
+#include <SensorEngine.h> /* Sensor engine */
 
 /* Header file */
 #include <SensorsPageHandler.h>
@@ -36,6 +43,10 @@
  ******************************************************************************/
 /** @brief Defines the sensors page title */
 #define SENSORS_PAGE_TITLE "Sensors"
+/** @brief Defines the number of recent samples scanned for the readings */
+#define SENSORS_PAGE_SAMPLES 32
+/** @brief Defines the size of the value formatting buffer */
+#define SENSORS_PAGE_VALUE_SIZE 16
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
@@ -63,7 +74,20 @@
 /* None */
 
 /************************** Static global variables ***************************/
-/* None */
+/** @brief The quantities names. */
+static const char* const spkQuantityNames[E_SensorQuantity::SENSOR_QTY_MAX] = {
+    "Temperature (C)",
+    "Humidity (%)",
+    "Pressure (hPa)"
+};
+
+/** @brief The health status names. */
+static const char* const spkHealthNames[] = {
+    "Healthy",
+    "Degraded",
+    "Unhealthy",
+    "Disabled"
+};
 
 /*******************************************************************************
  * FUNCTIONS
@@ -81,11 +105,93 @@ SensorsPageHandler::~SensorsPageHandler(void) noexcept {
     PANIC("Tried to destroy the Sensors page handler.\n");
 }
 
-void SensorsPageHandler::Generate(std::string& rPageTitle,
-                                  std::string& rPageBody) noexcept {
-    rPageTitle = SENSORS_PAGE_TITLE;
-    rPageBody =
-        "<div>"
-        "   <h1>Sensors</h1>"
-        "</div";
+const char* SensorsPageHandler::GetTitle(void) const noexcept {
+    return SENSORS_PAGE_TITLE;
+}
+
+void SensorsPageHandler::Generate(PageSink& rSink) noexcept {
+    S_SensorSample pSamples[SENSORS_PAGE_SAMPLES];
+    S_SensorStatus status;
+    SensorEngine*  pEngine;
+    uint64_t       currentTime;
+    uint32_t       sequence;
+    uint32_t       count;
+    uint32_t       i;
+    uint32_t       j;
+    bool           isNewest;
+    char           pValue[SENSORS_PAGE_VALUE_SIZE];
+
+    rSink.Write("<div><h1>Sensors</h1>");
+
+    pEngine = SystemState::GetInstance()->GetSensorEngine();
+    if (nullptr == pEngine) {
+        rSink.Write("<p>The sensors are not started.</p></div>");
+    }
+    else {
+        /* The ring is read without lock, the acquisition is never delayed */
+        sequence = pEngine->GetSequence();
+        sequence = (SENSORS_PAGE_SAMPLES < sequence) ?
+                   sequence - SENSORS_PAGE_SAMPLES : 0;
+        count = pEngine->ReadSamples(sequence, pSamples, SENSORS_PAGE_SAMPLES);
+        currentTime = HWManager::GetTime();
+
+        rSink.Write(
+            "<h3>Readings</h3><table><tr><th>Sensor</th><th>Quantity</th>"
+            "<th>Value</th><th>Age (ms)</th></tr>"
+        );
+        for (i = count; 0 < i; --i) {
+            /* Only the newest sample of each quantity is displayed */
+            isNewest = true;
+            for (j = i; count > j && isNewest; ++j) {
+                isNewest = (pSamples[j].sensorId != pSamples[i - 1].sensorId ||
+                            pSamples[j].quantity != pSamples[i - 1].quantity);
+            }
+            if (isNewest &&
+                E_Return::NO_ERROR == pEngine->GetSensorStatus(
+                    pSamples[i - 1].sensorId,
+                    status
+                ) &&
+                E_SensorQuantity::SENSOR_QTY_MAX > pSamples[i - 1].quantity) {
+                snprintf(
+                    pValue,
+                    SENSORS_PAGE_VALUE_SIZE,
+                    "%.2f",
+                    pSamples[i - 1].value
+                );
+                rSink.Write("<tr><td>");
+                rSink.Write(status.pkName);
+                rSink.Write("</td><td>");
+                rSink.Write(spkQuantityNames[pSamples[i - 1].quantity]);
+                rSink.Write("</td><td>");
+                rSink.Write(pValue);
+                rSink.Write("</td><td>");
+                rSink.WriteUInt(
+                    (currentTime - pSamples[i - 1].time) / 1000000ULL
+                );
+                rSink.Write("</td></tr>");
+            }
+        }
+        rSink.Write("</table>");
+
+        rSink.Write(
+            "<h3>Status</h3><table><tr><th>Sensor</th><th>Period (ms)</th>"
+            "<th>Reads</th><th>Errors</th><th>Health</th></tr>"
+        );
+        for (i = 0; pEngine->GetSensorCount() > i; ++i) {
+            if (E_Return::NO_ERROR == pEngine->GetSensorStatus(i, status)) {
+                rSink.Write("<tr><td>");
+                rSink.Write(status.pkName);
+                rSink.Write("</td><td>");
+                rSink.WriteUInt(status.periodNs / 1000000ULL);
+                rSink.Write("</td><td>");
+                rSink.WriteUInt(status.reads);
+                rSink.Write("</td><td>");
+                rSink.WriteUInt(status.errors);
+                rSink.Write("</td><td>");
+                rSink.Write(spkHealthNames[status.health]);
+                rSink.Write("</td></tr>");
+            }
+        }
+        rSink.Write("</table></div>");
+    }
 }
\ No newline at end of file
@@ -21,6 +21,9 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
 /* Included headers */
 #include <string>        /* Standard string */
 #include <Errors.h>      /* Errors definitions */
@@ -83,17 +86,20 @@ SettingsPageHandler::~SettingsPageHandler(void) noexcept {
     PANIC("Tried to destroy the Settings page handler.\n");
 }
 
-void SettingsPageHandler::Generate(std::string& rPageTitle,
-                                   std::string& rPageBody) noexcept {
-    rPageTitle = SETTINGS_PAGE_TITLE;
-    rPageBody =
+const char* SettingsPageHandler::GetTitle(void) const noexcept {
+    return SETTINGS_PAGE_TITLE;
+}
+
+void SettingsPageHandler::Generate(PageSink& rSink) noexcept {
+    rSink.Write(
         "<div>"
         "   <h1>Settings</h1>"
-        "</div>";
-    GenerateNetworkSettings(rPageBody);
+        "</div>"
+    );
+    GenerateNetworkSettings(rSink);
 }
 
-void SettingsPageHandler::GenerateNetworkSettings(std::string& rPageBuffer)
+void SettingsPageHandler::GenerateNetworkSettings(PageSink& rSink)
 const noexcept {
     WiFiModule*  pWiFiModule;
     S_WiFiConfig config;
@@ -101,98 +107,106 @@ const noexcept {
     pWiFiModule = SystemState::GetInstance()->GetWiFiModule();
     pWiFiModule->GetConfiguration(&config);
 
-    rPageBuffer += "<h2>==== Access Point Settings ====</h2>";
-    rPageBuffer += "<div>";
+    rSink.Write("<h2>==== Access Point Settings ====</h2>");
+    rSink.Write("<div>");
     /* State of AP mode */
-    rPageBuffer += "<table>";
-    rPageBuffer += "<tr><td>";
-    rPageBuffer += "Access Point Enabled";
-    rPageBuffer += "</td><td>";
-    rPageBuffer += "<input type=\"checkbox\" id=\"ap_enable\" "
-                   "name=\"ap_enable\" disabled ";
+    rSink.Write("<table>");
+    rSink.Write("<tr><td>");
+    rSink.Write("Access Point Enabled");
+    rSink.Write("</td><td>");
+    rSink.Write(
+        "<input type=\"checkbox\" id=\"ap_enable\" "
+        "name=\"ap_enable\" disabled "
+    );
 
     if (config.isAP) {
-        rPageBuffer += "checked";
+        rSink.Write("checked");
     }
-    rPageBuffer += "/></td></tr></table>";
-    rPageBuffer += "</div>";
+    rSink.Write("/></td></tr></table>");
+    rSink.Write("</div>");
 
-    rPageBuffer += "<h2>==== Node Settings ====</h2>";
-    rPageBuffer += "<div>";
-    rPageBuffer += "<table>";
+    rSink.Write("<h2>==== Node Settings ====</h2>");
+    rSink.Write("<div>");
+    rSink.Write("<table>");
 
     /* Network SSID */
-    rPageBuffer += "<tr><td>Network SSID</td><td>";
-    rPageBuffer += config.ssid;
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>Network SSID</td><td>");
+    rSink.Write(config.ssid);
+    rSink.Write("</td></tr>");
 
     /* Network Password */
-    rPageBuffer += "<tr><td>Network Password</td><td>";
-    rPageBuffer += config.password;
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>Network Password</td><td>");
+    rSink.Write(config.password);
+    rSink.Write("</td></tr>");
 
     /* Network Static / Dynamic mode */
-    rPageBuffer += "<tr><td>Static Configuration";
-    rPageBuffer += "</td><td>";
-    rPageBuffer += "<input type=\"checkbox\" id=\"net_stat_en\" "
-                   "name=\"net_stat_en\" disabled ";
+    rSink.Write("<tr><td>Static Configuration");
+    rSink.Write("</td><td>");
+    rSink.Write(
+        "<input type=\"checkbox\" id=\"net_stat_en\" "
+        "name=\"net_stat_en\" disabled "
+    );
 
     if (config.isStatic) {
-        rPageBuffer += "checked";
+        rSink.Write("checked");
     }
-    rPageBuffer += "/></td></tr>";
+    rSink.Write("/></td></tr>");
 
     /* Network Static IP */
-    rPageBuffer += "<tr><td>Node IP</td><td>";
-    rPageBuffer += config.ip;
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>Node IP</td><td>");
+    rSink.Write(config.ip);
+    rSink.Write("</td></tr>");
 
     /* Network Static Gateway */
-    rPageBuffer += "<tr><td>Gateway IP</td><td>";
-    rPageBuffer += config.gateway;
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>Gateway IP</td><td>");
+    rSink.Write(config.gateway);
+    rSink.Write("</td></tr>");
 
     /* Network Subnet */
-    rPageBuffer += "<tr><td>Subnet</td><td>";
-    rPageBuffer += config.subnet;
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>Subnet</td><td>");
+    rSink.Write(config.subnet);
+    rSink.Write("</td></tr>");
 
     /* Network Primary DNS */
-    rPageBuffer += "<tr><td>Primary DNS</td><td>";
-    rPageBuffer += config.primaryDNS;
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>Primary DNS</td><td>");
+    rSink.Write(config.primaryDNS);
+    rSink.Write("</td></tr>");
 
     /* Network Secondary DNS */
-    rPageBuffer += "<tr><td>Secondary DNS</td><td>";
-    rPageBuffer += config.secondaryDNS;
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>Secondary DNS</td><td>");
+    rSink.Write(config.secondaryDNS);
+    rSink.Write("</td></tr>");
 
-    rPageBuffer += "</table></div>";
+    rSink.Write("</table></div>");
 
-    rPageBuffer += "<h2>==== Interfaces Settings ====</h2>";
-    rPageBuffer += "<div>";
-    rPageBuffer += "<table>";
+    rSink.Write("<h2>==== Interfaces Settings ====</h2>");
+    rSink.Write("<div>");
+    rSink.Write("<table>");
 
     /* Web interface port */
-    rPageBuffer += "<tr><td>Web Interface Port</td><td>";
-    rPageBuffer += std::to_string(config.webPort);
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>Web Interface Port</td><td>");
+    rSink.WriteUInt(config.webPort);
+    rSink.Write("</td></tr>");
     /* API interface port */
-    rPageBuffer += "<tr><td>API Interface Port</td><td>";
-    rPageBuffer += std::to_string(config.apiPort);
-    rPageBuffer += "</td></tr>";
+    rSink.Write("<tr><td>API Interface Port</td><td>");
+    rSink.WriteUInt(config.apiPort);
+    rSink.Write("</td></tr>");
 
-    rPageBuffer += "</table></div>";
+    rSink.Write("</table></div>");
 
     /* Execution modes */
-    rPageBuffer += "<div>";
-    rPageBuffer += "<h2>==== Maintenance Mode ====</h2>";
-    rPageBuffer += "<table>";
-    rPageBuffer += "<tr>";
-    rPageBuffer += "<td><a href=\"/reboot?mode=0\">Reboot in nominal mode</a></td>";
-    rPageBuffer += "<td><a href=\"/reboot?mode=1\">Reboot in maintenance mode</a></td>";
-    rPageBuffer += "</tr>";
-    rPageBuffer += "</table>";
-    rPageBuffer += "</div>";
+    rSink.Write("<div>");
+    rSink.Write("<h2>==== Maintenance Mode ====</h2>");
+    rSink.Write("<table>");
+    rSink.Write("<tr>");
+    rSink.Write(
+        "<td><a href=\"/reboot?mode=0\">Reboot in nominal mode</a></td>"
+    );
+    rSink.Write(
+        "<td><a href=\"/reboot?mode=1\">Reboot in maintenance mode</a></td>"
+    );
+    rSink.Write("</tr>");
+    rSink.Write("</table>");
+    rSink.Write("</div>");
 }
 
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * @file StaticAssets.cpp
+ *
+ * @see StaticAssets.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Web servers static assets.
+ *
+ * @details Web servers static assets. Serves the flash-resident CSS and
+ * scripts as cacheable resources validated with their ETag.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
+/* Included headers */
+#include <cstdio>        /* Standard IO */
+#include <Logger.h>      /* Logger services */
+#include <Arduino.h>     /* Arduino Framework */
+#include <WebServer.h>   /* Web server services */
+#include <EventStream.h> /* Event streams headers */
+
+/* Header file */
+#include <StaticAssets.h>
+
+/*******************************************************************************
+ * CONSTANTS
+ ******************************************************************************/
+/** @brief Defines the request header carrying the cached ETag. */
+#define STATIC_ASSET_IF_NONE_MATCH "If-None-Match"
+/** @brief Defines the request header listing the accepted encodings. */
+#define STATIC_ASSET_ACCEPT_ENCODING "Accept-Encoding"
+/** @brief Defines the gzip content encoding token. */
+#define STATIC_ASSET_GZIP "gzip"
+/**
+ * @brief Defines the assets cache policy. The browsers keep the assets but
+ * revalidate them on each use, firmware updates are seen immediately.
+ */
+#define STATIC_ASSET_CACHE_CONTROL "no-cache"
+
+/** @brief FNV-1a 32 bits offset basis. */
+#define FNV1A_OFFSET_BASIS 0x811C9DC5UL
+/** @brief FNV-1a 32 bits prime. */
+#define FNV1A_PRIME 0x01000193UL
+
+/*******************************************************************************
+ * STRUCTURES AND TYPES
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * MACROS
+ ******************************************************************************/
+/* None */
+
+/*******************************************************************************
+ * STATIC FUNCTIONS DECLARATIONS
+ ******************************************************************************/
+/**
+ * @brief Hashes a buffer with FNV-1a.
+ *
+ * @param[in] kpData The buffer to hash.
+ * @param[in] kSize The size of the buffer in bytes.
+ *
+ * @return The 32 bits hash of the buffer.
+ */
+static uint32_t HashAsset(const uint8_t* kpData, const size_t kSize) noexcept;
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Imported global variables **************************/
+/* None */
+
+/************************* Exported global variables **************************/
+/* None */
+
+/************************** Static global variables ***************************/
+/** @brief Request headers retained by the servers. */
+static const char* spkCollectedHeaders[] = {
+    STATIC_ASSET_IF_NONE_MATCH,
+    STATIC_ASSET_ACCEPT_ENCODING,
+    EVENT_STREAM_LAST_ID_HEADER
+};
+
+/*******************************************************************************
+ * FUNCTIONS
+ ******************************************************************************/
+static uint32_t HashAsset(const uint8_t* kpData, const size_t kSize) noexcept {
+    uint32_t hash;
+    size_t   i;
+
+    hash = FNV1A_OFFSET_BASIS;
+    for (i = 0; kSize > i; ++i) {
+        hash ^= kpData[i];
+        hash *= FNV1A_PRIME;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+ * CLASS METHODS
+ ******************************************************************************/
+void StaticAssets::Register(WebServer*     pServer,
+                            S_StaticAsset* pAssets,
+                            const size_t   kCount) noexcept {
+    S_StaticAsset* pAsset;
+    size_t         i;
+
+    pServer->collectHeaders(
+        spkCollectedHeaders,
+        sizeof(spkCollectedHeaders) / sizeof(spkCollectedHeaders[0])
+    );
+
+    for (i = 0; kCount > i; ++i) {
+        pAsset = &pAssets[i];
+
+        /* The content is constant, the tag only changes with the firmware */
+        snprintf(
+            pAsset->pETag,
+            STATIC_ASSET_ETAG_SIZE,
+            "\"%08lx\"",
+            (unsigned long)HashAsset(pAsset->pkData, pAsset->size)
+        );
+        if (nullptr != pAsset->pkGzData) {
+            snprintf(
+                pAsset->pGzETag,
+                STATIC_ASSET_ETAG_SIZE,
+                "\"%08lx\"",
+                (unsigned long)HashAsset(pAsset->pkGzData, pAsset->gzSize)
+            );
+        }
+
+        pServer->on(pAsset->pkUrl, HTTP_GET, [pServer, pAsset]() {
+            StaticAssets::Send(pServer, *pAsset);
+        });
+
+        LOG_DEBUG(
+            "Registered static asset %s, ETag %s.\n",
+            pAsset->pkUrl,
+            pAsset->pETag
+        );
+    }
+}
+
+void StaticAssets::Send(WebServer* pServer, const S_StaticAsset& krAsset)
+noexcept {
+    const uint8_t* pkData;
+    const char*    pkETag;
+    size_t         size;
+
+    /* Each encoding is a distinct representation with its own tag */
+    if (nullptr != krAsset.pkGzData &&
+        pServer->hasHeader(STATIC_ASSET_ACCEPT_ENCODING) &&
+        0 <= pServer->header(STATIC_ASSET_ACCEPT_ENCODING).indexOf(
+            STATIC_ASSET_GZIP
+        )) {
+        pkData = krAsset.pkGzData;
+        size   = krAsset.gzSize;
+        pkETag = krAsset.pGzETag;
+        pServer->sendHeader("Content-Encoding", STATIC_ASSET_GZIP);
+    }
+    else {
+        pkData = krAsset.pkData;
+        size   = krAsset.size;
+        pkETag = krAsset.pETag;
+    }
+    if (nullptr != krAsset.pkGzData) {
+        pServer->sendHeader("Vary", STATIC_ASSET_ACCEPT_ENCODING);
+    }
+    pServer->sendHeader("ETag", pkETag);
+    pServer->sendHeader("Cache-Control", STATIC_ASSET_CACHE_CONTROL);
+
+    if (pServer->hasHeader(STATIC_ASSET_IF_NONE_MATCH) &&
+        pServer->header(STATIC_ASSET_IF_NONE_MATCH).equals(pkETag)) {
+        pServer->setContentLength(0);
+        pServer->send(304, krAsset.pkContentType, "");
+    }
+    else {
+        pServer->send_P(
+            200,
+            krAsset.pkContentType,
+            (const char*)pkData,
+            size
+        );
+    }
+}
\ No newline at end of file
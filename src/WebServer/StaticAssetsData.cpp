@@ -0,0 +1,363 @@
+/*******************************************************************************
+ * @file StaticAssetsData.cpp
+ *
+ * @see StaticAssets.h
+ *
+ * @author Alexy Torres Aurora Dugo
+ *
+ * @date 14/10/2026
+ *
+ * @version 1.0
+ *
+ * @brief Weather Station Firmware static assets content.
+ *
+ * @details Weather Station Firmware static assets content. This file is
+ * auto-generated from the webassets directory and contains the identity and
+ * gzip encoded content of the static assets served by the firmware.
+ *
+ * @copyright Alexy Torres Aurora Dugo
+ ******************************************************************************/
+
+/*******************************************************************************
+ * INCLUDES
+ ******************************************************************************/
+#include <cstdint>            /* Standard int types */
+#include <StaticAssetsData.h> /* Static assets content */
+
+/*******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************/
+
+/************************* Exported global variables **************************/
+/** @brief Identity content of the style.css asset. */
+const uint8_t gkAssetStyleCss[] = {
+    0x62, 0x6F, 0x64, 0x79, 0x20, 0x7B, 0x0A, 0x66, 0x6F, 0x6E, 0x74, 0x2D,
+    0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x20, 0x6D, 0x6F, 0x6E, 0x6F,
+    0x73, 0x70, 0x61, 0x63, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x2C, 0x20, 0x74, 0x64, 0x20, 0x7B,
+    0x0A, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x70, 0x78,
+    0x20, 0x64, 0x61, 0x73, 0x68, 0x65, 0x64, 0x20, 0x67, 0x72, 0x61, 0x79,
+    0x3B, 0x0A, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C,
+    0x6C, 0x61, 0x70, 0x73, 0x65, 0x3A, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x61,
+    0x70, 0x73, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x74, 0x64, 0x2C, 0x20, 0x74,
+    0x68, 0x20, 0x7B, 0x0A, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A,
+    0x20, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x7D,
+};
+
+/** @brief Gzip encoded content of the style.css asset. */
+const uint8_t gkAssetStyleCssGz[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x35, 0x8C,
+    0x41, 0x0E, 0x80, 0x20, 0x0C, 0x04, 0xEF, 0xBC, 0xA2, 0x0F, 0xD0, 0x83,
+    0x07, 0x2F, 0xF8, 0x9A, 0x62, 0xAB, 0x98, 0x20, 0x6D, 0x80, 0x83, 0xC4,
+    0xF8, 0x77, 0xD1, 0xE8, 0x61, 0x93, 0x4D, 0x66, 0x77, 0x9C, 0x50, 0x85,
+    0xD3, 0x2C, 0x12, 0x4B, 0xBF, 0xE0, 0xBE, 0x85, 0x6A, 0x61, 0x97, 0x28,
+    0x59, 0x71, 0xE6, 0xC9, 0x5C, 0xA6, 0xA0, 0x0B, 0xDC, 0x41, 0xF1, 0x2D,
+    0xD4, 0x96, 0x4E, 0x12, 0x71, 0xB2, 0x30, 0xE8, 0x01, 0x84, 0xD9, 0x33,
+    0xC1, 0x9A, 0xB0, 0x4E, 0x1F, 0xE8, 0x67, 0x09, 0x01, 0x35, 0xB3, 0x85,
+    0xBF, 0xBD, 0x16, 0x7A, 0x14, 0xED, 0xAE, 0x48, 0xB4, 0xC5, 0xD5, 0xC2,
+    0xA8, 0x47, 0x03, 0x37, 0x16, 0x49, 0xF1, 0x06, 0x7F, 0x00, 0x00, 0x00,
+};
+
+/** @brief Identity content of the maintenance.css asset. */
+const uint8_t gkAssetMaintenanceCss[] = {
+    0x62, 0x6F, 0x64, 0x79, 0x20, 0x7B, 0x0A, 0x66, 0x6F, 0x6E, 0x74, 0x2D,
+    0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x20, 0x6D, 0x6F, 0x6E, 0x6F,
+    0x73, 0x70, 0x61, 0x63, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x2C, 0x20, 0x74, 0x64, 0x20, 0x7B,
+    0x0A, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x70, 0x78,
+    0x20, 0x64, 0x61, 0x73, 0x68, 0x65, 0x64, 0x20, 0x67, 0x72, 0x61, 0x79,
+    0x3B, 0x0A, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C,
+    0x6C, 0x61, 0x70, 0x73, 0x65, 0x3A, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x61,
+    0x70, 0x73, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x74, 0x64, 0x2C, 0x20, 0x74,
+    0x68, 0x20, 0x7B, 0x0A, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A,
+    0x20, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6C, 0x6F, 0x67,
+    0x5F, 0x74, 0x65, 0x78, 0x74, 0x20, 0x7B, 0x0A, 0x62, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x64, 0x61, 0x73, 0x68,
+    0x65, 0x64, 0x20, 0x67, 0x72, 0x61, 0x79, 0x3B, 0x0A, 0x70, 0x61, 0x64,
+    0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x35, 0x70, 0x78, 0x3B, 0x0A, 0x7D,
+};
+
+/** @brief Gzip encoded content of the maintenance.css asset. */
+const uint8_t gkAssetMaintenanceCssGz[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7D, 0x8C,
+    0x31, 0x0A, 0xC3, 0x30, 0x10, 0x04, 0x7B, 0xBD, 0xE2, 0x1E, 0x10, 0x07,
+    0x52, 0xA4, 0x91, 0x1F, 0x13, 0x4E, 0xBE, 0xB3, 0x6C, 0x90, 0x75, 0x42,
+    0xBA, 0x42, 0x22, 0xE4, 0xEF, 0x96, 0x43, 0xDC, 0xB8, 0x48, 0xB1, 0xB0,
+    0xB0, 0x3B, 0xE3, 0x84, 0x1A, 0xBC, 0xCD, 0x2C, 0x51, 0x87, 0x19, 0xB7,
+    0x35, 0x34, 0x0B, 0x9B, 0x44, 0x29, 0x09, 0x27, 0x1E, 0xCD, 0xC7, 0x28,
+    0xBA, 0xC0, 0x37, 0xD0, 0xA5, 0x87, 0xFA, 0xD3, 0x49, 0x26, 0xCE, 0x16,
+    0x1E, 0xA9, 0x02, 0x61, 0x59, 0x98, 0xC0, 0x67, 0x6C, 0xE3, 0x6F, 0x18,
+    0x26, 0x09, 0x01, 0x53, 0x61, 0x0B, 0x67, 0xFB, 0x5A, 0xE8, 0x50, 0x74,
+    0x3C, 0x21, 0xD1, 0x1A, 0xBD, 0x85, 0x67, 0xAA, 0xC7, 0x70, 0x0F, 0xE2,
+    0x5F, 0xCA, 0x55, 0xFF, 0xA9, 0x2F, 0xD0, 0x0E, 0xFA, 0xAA, 0xF9, 0x53,
+    0xB4, 0x00, 0x00, 0x00,
+};
+
+/** @brief Identity content of the maintenance.js asset. */
+const uint8_t gkAssetMaintenanceJs[] = {
+    0x2F, 0x2A, 0x20, 0x4C, 0x6F, 0x67, 0x73, 0x20, 0x6C, 0x61, 0x7A, 0x79,
+    0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x67, 0x65, 0x6E,
+    0x65, 0x72, 0x69, 0x63, 0x20, 0x2A, 0x2F, 0x0A, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x4C, 0x6F, 0x67,
+    0x73, 0x28, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x2C, 0x20, 0x6F, 0x66, 0x66,
+    0x73, 0x65, 0x74, 0x2C, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F,
+    0x69, 0x74, 0x65, 0x6D, 0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2C, 0x20,
+    0x75, 0x72, 0x6C, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x78,
+    0x68, 0x72, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x58, 0x4D, 0x4C,
+    0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28,
+    0x29, 0x3B, 0x0A, 0x78, 0x68, 0x72, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61,
+    0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67,
+    0x65, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x28, 0x29, 0x20, 0x7B, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x78, 0x68, 0x72,
+    0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20,
+    0x3D, 0x3D, 0x3D, 0x20, 0x34, 0x29, 0x20, 0x7B, 0x0A, 0x75, 0x70, 0x64,
+    0x61, 0x74, 0x65, 0x5F, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x69, 0x6E, 0x6E,
+    0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x78, 0x68, 0x72,
+    0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x54, 0x65, 0x78,
+    0x74, 0x20, 0x2B, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x69,
+    0x74, 0x65, 0x6D, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D,
+    0x4C, 0x3B, 0x0A, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x78, 0x68,
+    0x72, 0x2E, 0x67, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73,
+    0x65, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x27, 0x58, 0x2D, 0x4C,
+    0x6F, 0x67, 0x2D, 0x53, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x27,
+    0x29, 0x3B, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x65, 0x78, 0x74, 0x20,
+    0x3D, 0x3D, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x20, 0x7B, 0x0A, 0x6E,
+    0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49,
+    0x6E, 0x74, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x2B,
+    0x20, 0x78, 0x68, 0x72, 0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73,
+    0x65, 0x54, 0x65, 0x78, 0x74, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+    0x3B, 0x0A, 0x7D, 0x0A, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x73, 0x65, 0x74,
+    0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x27, 0x6C,
+    0x6F, 0x61, 0x64, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x6E, 0x65, 0x78, 0x74,
+    0x29, 0x3B, 0x0A, 0x7D, 0x3B, 0x0A, 0x7D, 0x3B, 0x0A, 0x78, 0x68, 0x72,
+    0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x27, 0x47, 0x45, 0x54, 0x27, 0x2C,
+    0x20, 0x75, 0x72, 0x6C, 0x20, 0x2B, 0x20, 0x27, 0x3F, 0x27, 0x20, 0x2B,
+    0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x20, 0x2B, 0x20, 0x27, 0x3D, 0x27,
+    0x20, 0x2B, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x3B, 0x0A,
+    0x78, 0x68, 0x72, 0x2E, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x29, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x2F, 0x2A, 0x20, 0x4C, 0x6F, 0x67, 0x73, 0x20, 0x63, 0x6C,
+    0x65, 0x61, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x20,
+    0x2A, 0x2F, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x63, 0x6C, 0x65, 0x61, 0x72, 0x4C, 0x6F, 0x67, 0x73, 0x28, 0x6C, 0x6F,
+    0x67, 0x49, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x78,
+    0x68, 0x72, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x58, 0x4D, 0x4C,
+    0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28,
+    0x29, 0x3B, 0x0A, 0x78, 0x68, 0x72, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61,
+    0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67,
+    0x65, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x28, 0x29, 0x20, 0x7B, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x78, 0x68, 0x72,
+    0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20,
+    0x3D, 0x3D, 0x3D, 0x20, 0x34, 0x29, 0x20, 0x7B, 0x0A, 0x69, 0x74, 0x65,
+    0x6D, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x6C,
+    0x6F, 0x67, 0x49, 0x64, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x7B,
+    0x0A, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6C, 0x6F, 0x61,
+    0x64, 0x5F, 0x6D, 0x6F, 0x72, 0x65, 0x5F, 0x72, 0x61, 0x6D, 0x27, 0x29,
+    0x3B, 0x0A, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x69, 0x74, 0x65,
+    0x6D, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x61, 0x6D, 0x5F, 0x6C, 0x6F, 0x67,
+    0x73, 0x27, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x65, 0x6C, 0x73, 0x65, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x6C, 0x6F, 0x67, 0x49, 0x64, 0x20, 0x3D, 0x3D,
+    0x20, 0x31, 0x29, 0x20, 0x7B, 0x0A, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x27, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x6D, 0x6F, 0x72, 0x65, 0x5F,
+    0x6A, 0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C, 0x27, 0x29, 0x3B, 0x0A, 0x75,
+    0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x27, 0x6A, 0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C, 0x5F, 0x6C, 0x6F,
+    0x67, 0x73, 0x27, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x75, 0x70, 0x64, 0x61,
+    0x74, 0x65, 0x5F, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x69, 0x6E, 0x6E, 0x65,
+    0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x27, 0x27, 0x3B, 0x0A,
+    0x69, 0x74, 0x65, 0x6D, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72,
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x27, 0x6C, 0x6F, 0x61, 0x64, 0x65,
+    0x64, 0x27, 0x2C, 0x20, 0x30, 0x29, 0x3B, 0x0A, 0x7D, 0x3B, 0x0A, 0x7D,
+    0x3B, 0x0A, 0x78, 0x68, 0x72, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x27,
+    0x47, 0x45, 0x54, 0x27, 0x2C, 0x20, 0x27, 0x2F, 0x63, 0x6C, 0x65, 0x61,
+    0x72, 0x6C, 0x6F, 0x67, 0x73, 0x3F, 0x6C, 0x6F, 0x67, 0x74, 0x79, 0x70,
+    0x65, 0x3D, 0x27, 0x20, 0x2B, 0x20, 0x6C, 0x6F, 0x67, 0x49, 0x64, 0x29,
+    0x3B, 0x0A, 0x78, 0x68, 0x72, 0x2E, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x29,
+    0x3B, 0x0A, 0x7D, 0x0A, 0x2F, 0x2A, 0x20, 0x44, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x2A, 0x2F,
+    0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64,
+    0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E,
+    0x65, 0x72, 0x28, 0x27, 0x44, 0x4F, 0x4D, 0x43, 0x6F, 0x6E, 0x74, 0x65,
+    0x6E, 0x74, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+    0x2F, 0x2A, 0x20, 0x52, 0x61, 0x6D, 0x20, 0x6C, 0x61, 0x7A, 0x79, 0x20,
+    0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x2A, 0x2F, 0x0A, 0x6C,
+    0x6F, 0x61, 0x64, 0x4D, 0x6F, 0x72, 0x65, 0x52, 0x61, 0x6D, 0x20, 0x3D,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x27, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x6D, 0x6F, 0x72, 0x65, 0x5F,
+    0x72, 0x61, 0x6D, 0x27, 0x29, 0x3B, 0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x4D,
+    0x6F, 0x72, 0x65, 0x52, 0x61, 0x6D, 0x2E, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
+    0x63, 0x6B, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x4C, 0x6F,
+    0x67, 0x73, 0x28, 0x0A, 0x27, 0x73, 0x65, 0x71, 0x27, 0x2C, 0x0A, 0x6C,
+    0x6F, 0x61, 0x64, 0x4D, 0x6F, 0x72, 0x65, 0x52, 0x61, 0x6D, 0x2E, 0x67,
+    0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28,
+    0x27, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x27, 0x29, 0x2C, 0x0A, 0x64,
+    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+    0x72, 0x61, 0x6D, 0x5F, 0x6C, 0x6F, 0x67, 0x73, 0x27, 0x29, 0x2C, 0x0A,
+    0x6C, 0x6F, 0x61, 0x64, 0x4D, 0x6F, 0x72, 0x65, 0x52, 0x61, 0x6D, 0x2C,
+    0x0A, 0x27, 0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x72, 0x61, 0x6D, 0x27, 0x0A,
+    0x29, 0x3B, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61,
+    0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x7D, 0x3B, 0x0A, 0x2F, 0x2A, 0x20, 0x4A,
+    0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x6C, 0x61, 0x7A, 0x79, 0x20,
+    0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x2A, 0x2F, 0x0A, 0x6C,
+    0x6F, 0x61, 0x64, 0x4D, 0x6F, 0x72, 0x65, 0x4A, 0x6F, 0x75, 0x72, 0x20,
+    0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
+    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x27, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x6D, 0x6F, 0x72, 0x65,
+    0x5F, 0x6A, 0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C, 0x27, 0x29, 0x3B, 0x0A,
+    0x6C, 0x6F, 0x61, 0x64, 0x4D, 0x6F, 0x72, 0x65, 0x4A, 0x6F, 0x75, 0x72,
+    0x2E, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+    0x6C, 0x6F, 0x61, 0x64, 0x4C, 0x6F, 0x67, 0x73, 0x28, 0x0A, 0x27, 0x6F,
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x27, 0x2C, 0x0A, 0x6C, 0x6F, 0x61, 0x64,
+    0x4D, 0x6F, 0x72, 0x65, 0x4A, 0x6F, 0x75, 0x72, 0x2E, 0x67, 0x65, 0x74,
+    0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x27, 0x6C,
+    0x6F, 0x61, 0x64, 0x65, 0x64, 0x27, 0x29, 0x2C, 0x0A, 0x64, 0x6F, 0x63,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6A, 0x6F,
+    0x75, 0x72, 0x6E, 0x61, 0x6C, 0x5F, 0x6C, 0x6F, 0x67, 0x73, 0x27, 0x29,
+    0x2C, 0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x4D, 0x6F, 0x72, 0x65, 0x4A, 0x6F,
+    0x75, 0x72, 0x2C, 0x0A, 0x27, 0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x6A, 0x6F,
+    0x75, 0x72, 0x6E, 0x61, 0x6C, 0x27, 0x0A, 0x29, 0x3B, 0x0A, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A,
+    0x7D, 0x3B, 0x0A, 0x2F, 0x2A, 0x20, 0x4C, 0x6F, 0x67, 0x20, 0x43, 0x6C,
+    0x65, 0x61, 0x72, 0x20, 0x2A, 0x2F, 0x0A, 0x72, 0x65, 0x73, 0x65, 0x74,
+    0x4A, 0x6F, 0x75, 0x72, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x65, 0x73, 0x65,
+    0x74, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x29, 0x3B, 0x0A, 0x72, 0x65,
+    0x73, 0x65, 0x74, 0x4A, 0x6F, 0x75, 0x72, 0x2E, 0x6F, 0x6E, 0x63, 0x6C,
+    0x69, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72,
+    0x4C, 0x6F, 0x67, 0x73, 0x28, 0x31, 0x29, 0x3B, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x20, 0x7D,
+    0x3B, 0x0A, 0x72, 0x65, 0x73, 0x65, 0x74, 0x52, 0x61, 0x6D, 0x20, 0x3D,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x27, 0x72, 0x65, 0x73, 0x65, 0x74, 0x5F, 0x72, 0x61, 0x6D, 0x27,
+    0x29, 0x3B, 0x0A, 0x72, 0x65, 0x73, 0x65, 0x74, 0x52, 0x61, 0x6D, 0x2E,
+    0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x63,
+    0x6C, 0x65, 0x61, 0x72, 0x4C, 0x6F, 0x67, 0x73, 0x28, 0x30, 0x29, 0x3B,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73,
+    0x65, 0x3B, 0x20, 0x7D, 0x3B, 0x0A, 0x2F, 0x2A, 0x20, 0x4C, 0x69, 0x76,
+    0x65, 0x20, 0x52, 0x41, 0x4D, 0x20, 0x6C, 0x6F, 0x67, 0x73, 0x2C, 0x20,
+    0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x72, 0x69, 0x67,
+    0x68, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x65, 0x73,
+    0x20, 0x2A, 0x2F, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x6E, 0x64,
+    0x6F, 0x77, 0x2E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x53, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x72, 0x61, 0x6D, 0x4C, 0x6F, 0x67,
+    0x73, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x61, 0x6D, 0x5F, 0x6C, 0x6F, 0x67,
+    0x73, 0x27, 0x29, 0x3B, 0x0A, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x53,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x28, 0x0A, 0x27, 0x2F, 0x65, 0x76, 0x65,
+    0x6E, 0x74, 0x73, 0x3F, 0x73, 0x65, 0x71, 0x3D, 0x27, 0x20, 0x2B, 0x20,
+    0x72, 0x61, 0x6D, 0x4C, 0x6F, 0x67, 0x73, 0x2E, 0x67, 0x65, 0x74, 0x41,
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x27, 0x6E, 0x65,
+    0x78, 0x74, 0x27, 0x29, 0x0A, 0x29, 0x3B, 0x0A, 0x65, 0x76, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C,
+    0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x6C, 0x6F, 0x67,
+    0x27, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28,
+    0x65, 0x29, 0x20, 0x7B, 0x0A, 0x72, 0x61, 0x6D, 0x4C, 0x6F, 0x67, 0x73,
+    0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64,
+    0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x54, 0x65, 0x78, 0x74, 0x4E, 0x6F, 0x64, 0x65,
+    0x28, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x20, 0x2B, 0x20, 0x27, 0x5C,
+    0x6E, 0x27, 0x29, 0x29, 0x3B, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x65, 0x76,
+    0x65, 0x6E, 0x74, 0x73, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E,
+    0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x6F,
+    0x76, 0x65, 0x72, 0x72, 0x75, 0x6E, 0x27, 0x2C, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x72,
+    0x61, 0x6D, 0x4C, 0x6F, 0x67, 0x73, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E,
+    0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x0A, 0x64, 0x6F, 0x63, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x54,
+    0x65, 0x78, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x27, 0x3D, 0x3D, 0x3D,
+    0x20, 0x27, 0x20, 0x2B, 0x20, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x2B, 0x20, 0x27, 0x20, 0x6C, 0x6F, 0x67, 0x73, 0x20, 0x6C, 0x6F, 0x73,
+    0x74, 0x20, 0x3D, 0x3D, 0x3D, 0x5C, 0x6E, 0x27, 0x29, 0x0A, 0x29, 0x3B,
+    0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x7D, 0x29, 0x3B,
+};
+
+/** @brief Gzip encoded content of the maintenance.js asset. */
+const uint8_t gkAssetMaintenanceJsGz[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xBD, 0x55,
+    0x4D, 0x6F, 0xDA, 0x40, 0x10, 0xBD, 0xFB, 0x57, 0xCC, 0x6D, 0xED, 0xD4,
+    0x01, 0x22, 0xF5, 0x86, 0x50, 0x94, 0x26, 0x51, 0x93, 0x0A, 0x5A, 0x89,
+    0xE4, 0x90, 0x43, 0x25, 0xE4, 0xDA, 0x63, 0xE3, 0xD6, 0xD9, 0x25, 0xBB,
+    0x6B, 0x12, 0x5A, 0xF1, 0xDF, 0x3B, 0xB3, 0x6B, 0xA8, 0x1D, 0x41, 0x02,
+    0x97, 0x4A, 0xC8, 0xB2, 0x99, 0xAF, 0x37, 0xEF, 0xCD, 0xCE, 0xF6, 0x4F,
+    0x60, 0xAC, 0x0A, 0x03, 0x55, 0xF2, 0x7B, 0x05, 0x95, 0x4A, 0xB2, 0x52,
+    0x16, 0x50, 0xA0, 0x44, 0x5D, 0xA6, 0x70, 0xD2, 0x0F, 0xF2, 0x5A, 0xA6,
+    0xB6, 0x54, 0xD2, 0xD9, 0xD8, 0x33, 0x5C, 0x24, 0x3A, 0x79, 0x8C, 0x41,
+    0xE5, 0xB9, 0x41, 0x1B, 0x43, 0xBD, 0xC8, 0x12, 0x8B, 0xB3, 0xD2, 0x22,
+    0xFD, 0xE9, 0x9F, 0xB5, 0xAE, 0x22, 0xF8, 0x13, 0x2C, 0x13, 0x0D, 0x2F,
+    0x73, 0x0D, 0x23, 0x90, 0xF8, 0x0C, 0x0F, 0x93, 0xF1, 0x8D, 0xB5, 0x8B,
+    0x29, 0x3E, 0xD5, 0x68, 0x6C, 0x18, 0x0D, 0x03, 0xB2, 0xF5, 0x94, 0xD4,
+    0x98, 0x64, 0x2B, 0x63, 0x29, 0x47, 0x3A, 0x4F, 0x64, 0x81, 0xE4, 0xBE,
+    0xA9, 0x19, 0x72, 0x96, 0x32, 0x87, 0x90, 0x3D, 0x9D, 0xDF, 0x1D, 0xFB,
+    0xC1, 0x68, 0x34, 0x82, 0x8F, 0x6C, 0x6B, 0xD5, 0xEE, 0x95, 0x92, 0x30,
+    0xDF, 0xDC, 0x4F, 0xC6, 0x94, 0xC0, 0xFB, 0x9B, 0x85, 0x92, 0x06, 0xEF,
+    0xF1, 0xC5, 0xC2, 0x07, 0xD8, 0xE9, 0x3A, 0x0C, 0x24, 0x5B, 0x7D, 0x40,
+    0x81, 0x76, 0xDA, 0xC4, 0xDC, 0x50, 0x2D, 0xD4, 0xA1, 0x78, 0x38, 0xA5,
+    0x8E, 0x4F, 0xEF, 0x18, 0xB2, 0x4C, 0x51, 0x10, 0x66, 0x46, 0xE3, 0x63,
+    0xA8, 0xAB, 0xBA, 0x72, 0x7D, 0x36, 0x39, 0x88, 0x17, 0x83, 0xB7, 0xD2,
+    0x86, 0x9E, 0x99, 0x88, 0x8A, 0xBE, 0xC6, 0xD1, 0xAB, 0x50, 0x16, 0x76,
+    0x3E, 0x0C, 0xD6, 0x81, 0x03, 0x42, 0x6E, 0x17, 0xD6, 0xEA, 0xF2, 0x47,
+    0x6D, 0x31, 0x14, 0xCC, 0x30, 0x66, 0x22, 0x06, 0x4E, 0x48, 0xB5, 0xD6,
+    0xEE, 0xE7, 0x58, 0x5A, 0xA0, 0x0C, 0xC5, 0xE7, 0xEB, 0x7B, 0xE1, 0xC8,
+    0xA5, 0xCC, 0xE2, 0x5C, 0xD0, 0xD3, 0x49, 0xC1, 0x5F, 0x23, 0xFE, 0x6A,
+    0xEA, 0xFA, 0x10, 0x83, 0x32, 0x63, 0x92, 0xD7, 0x41, 0xBF, 0x51, 0x38,
+    0xAD, 0x90, 0x04, 0xD9, 0x25, 0xAD, 0xB3, 0x38, 0x6D, 0x2B, 0x55, 0xDC,
+    0x66, 0xFF, 0x47, 0x3B, 0x26, 0x80, 0xFC, 0x07, 0x9E, 0x53, 0x57, 0x98,
+    0x49, 0x1D, 0xB4, 0x6C, 0x99, 0x4A, 0xEB, 0x47, 0x94, 0x96, 0xA5, 0xB9,
+    0xAE, 0x90, 0x5F, 0x3F, 0xAD, 0x6E, 0x33, 0xCF, 0xD4, 0xEC, 0x51, 0x69,
+    0x9C, 0x51, 0xFF, 0x2C, 0x4B, 0x4B, 0xDD, 0xB7, 0xE2, 0xC8, 0x7B, 0x46,
+    0x95, 0x8C, 0x70, 0xC4, 0x60, 0x65, 0x10, 0x3A, 0xC5, 0xCF, 0x8E, 0x2B,
+    0xFE, 0x53, 0xD5, 0x5A, 0x26, 0xD5, 0x11, 0x00, 0x9A, 0x88, 0x16, 0x88,
+    0x7D, 0x23, 0x2C, 0xC4, 0xF0, 0xCD, 0x19, 0x19, 0xEC, 0x1D, 0x10, 0xD1,
+    0x77, 0x7A, 0x72, 0x89, 0x73, 0x7A, 0xD8, 0xD5, 0x02, 0xDD, 0x78, 0x78,
+    0x6D, 0x77, 0x4C, 0xC7, 0x55, 0x83, 0x16, 0x9C, 0x4C, 0x3C, 0x19, 0x5B,
+    0xFC, 0x49, 0x96, 0x5D, 0x2F, 0xE9, 0x65, 0x5C, 0x1A, 0xCB, 0x83, 0x13,
+    0x8A, 0xAB, 0x6F, 0x93, 0x4B, 0x25, 0x2D, 0xFF, 0xB7, 0x81, 0xD2, 0x91,
+    0x9C, 0xF2, 0x4D, 0x69, 0x26, 0x3B, 0xEB, 0x84, 0x32, 0xF2, 0xEB, 0x84,
+    0x38, 0x63, 0xDB, 0x31, 0xC2, 0xB6, 0xE2, 0x68, 0xDE, 0xD2, 0xAA, 0x4C,
+    0x7F, 0xBD, 0x1E, 0xB2, 0xED, 0x62, 0x0A, 0x84, 0xC1, 0x27, 0x11, 0x77,
+    0x62, 0x8A, 0x5D, 0xEC, 0x45, 0x71, 0x70, 0xC0, 0x88, 0x74, 0x12, 0xC5,
+    0x81, 0xE8, 0xF3, 0x27, 0xC3, 0x0A, 0x08, 0x97, 0x46, 0x4B, 0x4A, 0x42,
+    0x9E, 0xD0, 0x0C, 0x39, 0x15, 0xA8, 0xEF, 0x2F, 0x5E, 0xDC, 0xBD, 0xBD,
+    0xB3, 0xFD, 0xE8, 0xC1, 0x6A, 0x07, 0x1F, 0xC0, 0x80, 0xDF, 0x01, 0x2D,
+    0x12, 0x5C, 0xDC, 0xD1, 0x2C, 0x74, 0xE7, 0xB4, 0x9B, 0x6D, 0x43, 0xC5,
+    0x06, 0xE4, 0x3E, 0x3A, 0x08, 0x11, 0x5C, 0xBA, 0x9D, 0x43, 0x1C, 0xD0,
+    0x16, 0x44, 0xFB, 0x1E, 0x01, 0xCE, 0x69, 0x96, 0x97, 0x95, 0x5B, 0xB5,
+    0xDB, 0x90, 0x3D, 0x6D, 0xB7, 0xD6, 0xD6, 0x59, 0x34, 0x84, 0x0E, 0x04,
+    0x58, 0x37, 0xF1, 0xEF, 0xCC, 0x9B, 0xAF, 0xD8, 0xCC, 0xDA, 0x26, 0xE0,
+    0xFD, 0x7A, 0x83, 0x5D, 0xF5, 0xB8, 0xE5, 0x72, 0x89, 0x30, 0xBD, 0x98,
+    0xF0, 0x59, 0x33, 0x31, 0x24, 0x0B, 0x3A, 0x96, 0x44, 0x35, 0xE8, 0xB2,
+    0x98, 0x5B, 0x48, 0x72, 0x8B, 0x1A, 0xEC, 0x1C, 0xC1, 0x2B, 0x00, 0x4A,
+    0xA2, 0x61, 0x72, 0x78, 0x07, 0x3D, 0x97, 0x32, 0x53, 0xCF, 0x3D, 0x77,
+    0xDA, 0xEE, 0xA8, 0xE9, 0x14, 0x59, 0x59, 0x42, 0xE6, 0x76, 0xF7, 0x81,
+    0x3B, 0x0D, 0x39, 0xDA, 0x34, 0x4B, 0xBB, 0x95, 0x8A, 0x06, 0xA3, 0xEF,
+    0x6D, 0xE7, 0x74, 0x44, 0xDC, 0x36, 0x68, 0x32, 0xBF, 0x1A, 0x0D, 0xBE,
+    0x79, 0x44, 0x14, 0x6C, 0x53, 0xED, 0x58, 0x00, 0x54, 0xAB, 0x7D, 0xE6,
+    0xDB, 0x30, 0x7B, 0xBE, 0xE1, 0xCB, 0x79, 0x59, 0x65, 0xE1, 0x16, 0x70,
+    0x4A, 0x6B, 0xC5, 0xBA, 0xEB, 0xEF, 0xAB, 0xCA, 0x30, 0xC4, 0x1E, 0x2D,
+    0xBC, 0x84, 0x2F, 0xAD, 0xEF, 0x52, 0x44, 0xBC, 0x83, 0xDE, 0xAA, 0xA6,
+    0x96, 0xA8, 0x75, 0x2D, 0x0F, 0xAA, 0x18, 0xEC, 0x2B, 0x29, 0xF8, 0xD2,
+    0xE1, 0xA6, 0xFF, 0xD5, 0x76, 0x0A, 0xD1, 0xC3, 0xF0, 0x4D, 0x3E, 0x62,
+    0x24, 0x41, 0x03, 0x65, 0xCD, 0xCF, 0xBF, 0xB5, 0x3B, 0x33, 0x16, 0x16,
+    0x09, 0x00, 0x00,
+};
+
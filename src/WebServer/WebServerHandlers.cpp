@@ -21,12 +21,23 @@
  * INCLUDES
  ******************************************************************************/
 
+/** @brief Log module of the file. */
+#define LOG_MODULE LOG_MODULE_WEB
+
 /* Included headers */
-#include <Errors.h>        /* Errors definitions */
-#include <Logger.h>        /* Logger services */
-#include <Arduino.h>       /* Arduino Framework */
-#include <Settings.h>      /* Settings services */
-#include <WebServer.h>     /* Web server services */
+#include <Errors.h>           /* Errors definitions */
+#include <Logger.h>           /* Logger services */
+#include <Arduino.h>          /* Arduino Framework */
+#include <Settings.h>         /* Settings services */
+#include <WebServer.h>        /* Web server services */
+#include <StaticAssetsData.h> /* Static assets content */
+#include <StaticAssets.h>     /* Cacheable static assets */
+#include <PageSink.h>         /* Page output sink */
+#include <EventStream.h>      /* Live events stream */
+#include <HandlerStats.h>     /* Request handlers statistics */
+#include <Metrics.h>          /* Metrics counters */
+#include <HAL.h>              /* Hardware abstraction layer */
+#include <Tracer.h>           /* Events tracer */
 
 /* Handlers */
 #include <PageHandler.h>         /* Page handler interface */
@@ -56,6 +67,13 @@
 #define PAGE_URL_ABOUT "/about"
 /** @brief Defines the reboot URL */
 #define PAGE_URL_REBOOT "/reboot"
+/** @brief Defines the live events stream URL */
+#define PAGE_URL_EVENTS "/events"
+/** @brief Defines the stylesheet URL */
+#define ASSET_URL_STYLE "/style.css"
+
+/** @brief Defines the server name of the handlers statistics. */
+#define PAGE_STATS_SERVER "web"
 
 /*******************************************************************************
  * STRUCTURES AND TYPES
@@ -71,17 +89,15 @@
  * @details  Creates a new web handler. This will add the handler to the
  * handlers table and generate a HM event in case of error.
  *
- * @param[in] URL The URL to handle.
+ * @param[in] ROUTE_ID The route handled by the handler.
  * @param[in] HANDLER_CLASS The class of the object used to handle the URL.
- * @param[out] HANDLER_OBJ The object that gets assigned the new handler.
  */
-#define CREATE_NEW_HANDLER(URL, HANDLER_CLASS, HANDLER_OBJ) {               \
-    HANDLER_OBJ = new HANDLER_CLASS(this);                                  \
-    if (nullptr == HANDLER_OBJ) {                                           \
-        PANIC("Failed to allocate a new handler for Web page %s.\n", URL);  \
+#define CREATE_NEW_HANDLER(ROUTE_ID, HANDLER_CLASS) {                       \
+    this->_pPageHandlers[ROUTE_ID] = new HANDLER_CLASS(this);               \
+    if (nullptr == this->_pPageHandlers[ROUTE_ID]) {                        \
+        PANIC("Failed to allocate a new handler for Web page %d.\n",        \
+              ROUTE_ID);                                                    \
     }                                                                       \
-    this->_pageHandlers.emplace(URL, HANDLER_OBJ);                          \
-    this->_pServer->on(URL, HandleKnownURL);                                \
 }
 
 /*******************************************************************************
@@ -103,6 +119,71 @@
 /** @brief Stores the current web server instance. */
 static WebServerHandlers* spInstance = nullptr;
 
+/** @brief Page shell start, up to the title. */
+static const char spkPageHeaderStart[] =
+    "<!DOCTYPE html>\n"
+    "<html lang='en'>\n"
+    "<head>\n"
+    "<meta name='viewport' "
+    "content='width=device-width, initial-scale=1' "
+    "charset='UTF-8'/>\n"
+    "<title>\n";
+
+/** @brief Page shell after the title. */
+static const char spkPageHeaderEnd[] =
+    "</title>\n"
+    "<link rel='stylesheet' href='" ASSET_URL_STYLE "'/>\n"
+    "</head>\n"
+    "<body>";
+
+/** @brief Page shell footer with the navigation. */
+static const char spkPageFooter[] =
+    "<br /><div>"
+    "<h2>==== Navigation ====</h2>"
+    "<table><tr>"
+    "<td><a href=\"/\">Home</a></td>"
+    "<td><a href=\"/monitor\">Monitor</a></td>"
+    "<td><a href=\"/settings\">Settings</a></td>"
+    "<td><a href=\"/sensors\">Sensors</a></td>"
+    "<td><a href=\"/about\">About</a></td>"
+    "</tr></table>"
+    "</div></body>\n</html>";
+
+/** @brief The web server static assets. */
+static S_StaticAsset sAssets[] = {
+    {
+        ASSET_URL_STYLE,
+        ASSET_STYLE_CSS_TYPE,
+        gkAssetStyleCss,
+        ASSET_STYLE_CSS_SIZE,
+        gkAssetStyleCssGz,
+        ASSET_STYLE_CSS_GZ_SIZE,
+        {0},
+        {0}
+    }
+};
+
+/** @brief The web server routes, sorted by path. */
+static constexpr S_Route skRoutes[] = {
+    ROUTE(PAGE_URL_INDEX, HTTP_ANY, false, E_PageRoute::PAGE_ROUTE_INDEX),
+    ROUTE(PAGE_URL_ABOUT, HTTP_ANY, false, E_PageRoute::PAGE_ROUTE_ABOUT),
+    ROUTE(PAGE_URL_EVENTS, HTTP_GET, false, E_PageRoute::PAGE_ROUTE_EVENTS),
+    ROUTE(PAGE_URL_MONITOR, HTTP_ANY, false, E_PageRoute::PAGE_ROUTE_MONITOR),
+    ROUTE(PAGE_URL_REBOOT, HTTP_ANY, false, E_PageRoute::PAGE_ROUTE_REBOOT),
+    ROUTE(PAGE_URL_SENSORS, HTTP_ANY, false, E_PageRoute::PAGE_ROUTE_SENSORS),
+    ROUTE(
+        PAGE_URL_SETTINGS,
+        HTTP_ANY,
+        false,
+        E_PageRoute::PAGE_ROUTE_SETTINGS
+    )
+};
+
+static_assert(
+    RouteTable::IsSorted(skRoutes, sizeof(skRoutes) / sizeof(skRoutes[0])),
+    "The web server routes must be sorted by path."
+);
+
 /*******************************************************************************
  * FUNCTIONS
  ******************************************************************************/
@@ -112,7 +193,8 @@ static WebServerHandlers* spInstance = nullptr;
  * CLASS METHODS
  ******************************************************************************/
 WebServerHandlers::WebServerHandlers(WebServer* pServer) noexcept {
-    PageHandler* pNewHandler;
+    RouteTable* pRoutes;
+    uint32_t    i;
 
     if (nullptr != spInstance) {
         PANIC("Tried to re-create the Web Server handlers manager.\n");
@@ -121,12 +203,52 @@ WebServerHandlers::WebServerHandlers(WebServer* pServer) noexcept {
     this->_pServer = pServer;
 
     /* Create the handlers */
-    CREATE_NEW_HANDLER(PAGE_URL_INDEX, IndexPageHandler, pNewHandler);
-    CREATE_NEW_HANDLER(PAGE_URL_MONITOR, MonitorPageHandler, pNewHandler);
-    CREATE_NEW_HANDLER(PAGE_URL_SETTINGS, SettingsPageHandler, pNewHandler);
-    CREATE_NEW_HANDLER(PAGE_URL_SENSORS, SensorsPageHandler, pNewHandler);
-    CREATE_NEW_HANDLER(PAGE_URL_ABOUT, AboutPageHandler, pNewHandler);
-    CREATE_NEW_HANDLER(PAGE_URL_REBOOT, RebootPageHandler, pNewHandler);
+    CREATE_NEW_HANDLER(E_PageRoute::PAGE_ROUTE_INDEX, IndexPageHandler);
+    CREATE_NEW_HANDLER(E_PageRoute::PAGE_ROUTE_MONITOR, MonitorPageHandler);
+    CREATE_NEW_HANDLER(E_PageRoute::PAGE_ROUTE_SETTINGS, SettingsPageHandler);
+    CREATE_NEW_HANDLER(E_PageRoute::PAGE_ROUTE_SENSORS, SensorsPageHandler);
+    CREATE_NEW_HANDLER(E_PageRoute::PAGE_ROUTE_ABOUT, AboutPageHandler);
+    CREATE_NEW_HANDLER(E_PageRoute::PAGE_ROUTE_REBOOT, RebootPageHandler);
+    this->_pPageHandlers[E_PageRoute::PAGE_ROUTE_EVENTS] = nullptr;
+
+    /* Account the service time of each page, the stream is not a request */
+    for (i = 0; sizeof(skRoutes) / sizeof(skRoutes[0]) > i; ++i) {
+        this->_pStatsIds[skRoutes[i].id] = HANDLER_STATS_INVALID_ID;
+        if (E_PageRoute::PAGE_ROUTE_EVENTS != skRoutes[i].id) {
+            this->_pStatsIds[skRoutes[i].id] = HandlerStats::Register(
+                PAGE_STATS_SERVER,
+                skRoutes[i].pkPath
+            );
+        }
+    }
+
+    this->_pEvents = new EventStream();
+    if (nullptr == this->_pEvents) {
+        PANIC("Failed to allocate the Web Server events stream.\n");
+    }
+
+    this->_pArena = new RequestArena(REQUEST_ARENA_SIZE);
+    if (nullptr == this->_pArena) {
+        PANIC("Failed to allocate the Web Server request arena.\n");
+    }
+
+    /* All the pages are dispatched by a single handler, owned by the server */
+    pRoutes = new RouteTable(
+        skRoutes,
+        sizeof(skRoutes) / sizeof(skRoutes[0]),
+        HandleRoute
+    );
+    if (nullptr == pRoutes) {
+        PANIC("Failed to allocate the Web Server route table.\n");
+    }
+    this->_pServer->addHandler(pRoutes);
+
+    /* Serve the cacheable assets */
+    StaticAssets::Register(
+        this->_pServer,
+        sAssets,
+        sizeof(sAssets) / sizeof(sAssets[0])
+    );
 
     /* Configure the not found handler */
     this->_pServer->onNotFound(HandleNotFound);
@@ -145,115 +267,92 @@ WebServer* WebServerHandlers::GetServer(void) const noexcept {
     return this->_pServer;
 }
 
+EventStream* WebServerHandlers::GetEventStream(void) const noexcept {
+    return this->_pEvents;
+}
+
 void WebServerHandlers::HandleNotFound(void) noexcept {
-    std::string header;
-    std::string footer;
-    std::string page;
+    PageSink sink(
+        spInstance->_pServer,
+        404,
+        "text/html",
+        spInstance->_pArena
+    );
 
     LOG_DEBUG(
         "Handling Web page not found: %s\n",
         spInstance->_pServer->uri().c_str()
     );
 
-    /* Generate the page */
-    spInstance->GetPageHeader(header, "Not Found");
-    spInstance->GetPageFooter(footer);
-    page = header + "<h1>Not Found</h1>" + footer;
-
-    /* Send */
-    spInstance->GenericHandler(page, 404);
+    /* Generate and send the page */
+    spInstance->WritePageHeader(sink, "Not Found");
+    sink.Write("<h1>Not Found</h1>");
+    spInstance->EndPage(sink);
+    spInstance->_pArena->Reset();
 }
 
-void WebServerHandlers::HandleKnownURL(void) noexcept {
-    std::unordered_map<std::string, PageHandler*>::const_iterator it;
-    std::string                                                   header;
-    std::string                                                   footer;
-    std::string                                                   page;
-    std::string                                                   title;
-    const char*                                                   pageUrl;
-    String                                                        pageURLStr;
-    int32_t                                                       code;
+void WebServerHandlers::HandleRoute(const S_Route& krRoute) noexcept {
+    /* The stream keeps the connection, no page sink must be opened */
+    if (E_PageRoute::PAGE_ROUTE_EVENTS == krRoute.id) {
+        HandleEvents();
+    }
+    else {
+        HandlePage(krRoute);
+    }
+}
 
-    LOG_DEBUG(
-        "Handling Web page: %s\n",
-        spInstance->_pServer->uri().c_str()
+void WebServerHandlers::HandlePage(const S_Route& krRoute) noexcept {
+    PageHandler* pHandler;
+    uint64_t     start;
+    PageSink     sink(
+        spInstance->_pServer,
+        200,
+        "text/html",
+        spInstance->_pArena
     );
 
-    /* Get the handler */
-    pageURLStr = spInstance->_pServer->uri();
-    pageUrl    = pageURLStr.c_str();
+    TRACE_BEGIN(E_TraceEvent::TRACE_WEB_PAGE);
+    start = HAL::GetTime();
 
-    it = spInstance->_pageHandlers.find(pageUrl);
-    if (spInstance->_pageHandlers.end() == it) {
-        spInstance->GetPageHeader(header, "Not Found");
-        spInstance->GetPageFooter(footer);
-        page = "<h1>Not Registered</h1>";
-        code = 500;
-    }
-    else {
-        it->second->Generate(title, page);
-        code = 200;
-    }
+    LOG_DEBUG("Handling Web page: %s\n", krRoute.pkPath);
 
-    /* Generate the page */
-    spInstance->GetPageHeader(header, title);
-    spInstance->GetPageFooter(footer);
+    /* The page is streamed while it is generated */
+    pHandler = spInstance->_pPageHandlers[krRoute.id];
+    spInstance->WritePageHeader(sink, pHandler->GetTitle());
+    pHandler->Generate(sink);
+    spInstance->EndPage(sink);
 
-    /* Send */
-    spInstance->GenericHandler(header + page + footer, code);
-}
+    /* The sink buffer is not used once the page ended */
+    spInstance->_pArena->Reset();
 
-void WebServerHandlers::GetPageHeader(std::string&       rHeaderStr,
-                                      const std::string& krTitle)
-const noexcept {
-    rHeaderStr.clear();
-    rHeaderStr += "<!DOCTYPE html>\n"
-                  "<html lang='en'>\n"
-                  "<head>\n";
-    rHeaderStr += "<meta name='viewport' ";
-    rHeaderStr += "content='width=device-width, initial-scale=1' "
-                  "charset='UTF-8'/>\n"
-                  "<title>\n";
-    rHeaderStr += krTitle;
-    rHeaderStr += "</title>\n";
-    GeneratePageCSS(rHeaderStr);
-    rHeaderStr += "</head>\n"
-                  "<body>";
+    HandlerStats::Record(
+        spInstance->_pStatsIds[krRoute.id],
+        HAL::GetTime() - start
+    );
+    Metrics::RecordRequest(spInstance->_pStatsIds[krRoute.id], sink.GetSize());
+    TRACE_END(E_TraceEvent::TRACE_WEB_PAGE);
 }
 
-void WebServerHandlers::GetPageFooter(std::string& rFooterStr) const noexcept {
-    rFooterStr.clear();
-    rFooterStr += "<br /><div>";
-    rFooterStr += "<h2>==== Navigation ====</h2>";
-    rFooterStr += "<table><tr>";
-    rFooterStr += "<td><a href=\"/\">Home</a></td>";
-    rFooterStr += "<td><a href=\"/monitor\">Monitor</a></td>";
-    rFooterStr += "<td><a href=\"/settings\">Settings</a></td>";
-    rFooterStr += "<td><a href=\"/sensors\">Sensors</a></td>";
-    rFooterStr += "<td><a href=\"/about\">About</a></td>";
-    rFooterStr += "</tr></table>";
-    rFooterStr += "</div></body>\n</html>";
+void WebServerHandlers::HandleEvents(void) noexcept {
+    LOG_DEBUG("Handling Web events stream.\n");
+
+    if (!spInstance->_pEvents->Attach(spInstance->_pServer)) {
+        LOG_DEBUG("Refused Web events stream, all slots are used.\n");
+        spInstance->_pServer->send(503, "text/plain", "Too many streams.");
+    }
 }
 
-void WebServerHandlers::GeneratePageCSS(std::string& rHeaderStr) const noexcept {
-    rHeaderStr +=
-        "<style>"
-        "   body {"
-        "       font-family: monospace;"
-        "   }"
-        "   table, th, td {"
-        "       border: 1px dashed gray;"
-        "       border-collapse: collapse;"
-        "   }"
-        "   td, th {"
-        "       padding: 5px;"
-        "   }"
-        "</style>";
+void WebServerHandlers::WritePageHeader(PageSink&   rSink,
+                                        const char* kpTitle) const noexcept {
+    /* The shell is constant, only the title is inserted */
+    rSink.Write(spkPageHeaderStart, sizeof(spkPageHeaderStart) - 1);
+    rSink.Write(kpTitle);
+    rSink.Write(spkPageHeaderEnd, sizeof(spkPageHeaderEnd) - 1);
 }
 
-void WebServerHandlers::GenericHandler(const std::string& krPage,
-                                       const int32_t      kCode) noexcept {
-    /* Update page length and send */
-    this->_pServer->setContentLength(krPage.size());
-    this->_pServer->send(kCode, "text/html", krPage.c_str());
+void WebServerHandlers::EndPage(PageSink& rSink) const noexcept {
+    if (!rSink.IsEnded()) {
+        rSink.Write(spkPageFooter, sizeof(spkPageFooter) - 1);
+        rSink.End();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,243 @@
+#include <unity.h>
+#include <HAL.h>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <Timeout.h>
+#include <version.h>
+#include <SystemState.h>
+#include <HealthMonitor.h>
+#include "Load.h"
+
+/** @brief Timeout of the load watchdogs in nanoseconds. */
+#define LOAD_HM_TIMEOUT_NS 1000000000ULL
+/** @brief Watchdog of the idle load watchdogs, never expires. */
+#define LOAD_HM_IDLE_WD_NS 3600000000000ULL
+/** @brief Watchdog of the expired load watchdogs. */
+#define LOAD_HM_EXPIRED_WD_NS 1000000ULL
+/** @brief Check period of the load reporters in nanoseconds. */
+#define LOAD_HM_CHECK_PERIOD_NS 100000000ULL
+/** @brief Duration of the checks accounting in nanoseconds. */
+#define LOAD_HM_DURATION_NS 1000000000ULL
+/** @brief Maximal number of load watchdogs, the Health Monitor owns one. */
+#define LOAD_HM_MAX_WATCHDOGS (HM_MAX_WATCHDOGS - 1)
+
+/** @brief Number of executed watchdog handlers. */
+static std::atomic<uint32_t> sHandlerCount(0);
+/** @brief Number of executed reporter checks. */
+static std::atomic<uint32_t> sCheckCount(0);
+/** @brief The load timeouts. */
+static Timeout* spTimeouts[HM_MAX_WATCHDOGS];
+
+static void LoadWatchdogHandler(void) {
+    sHandlerCount.fetch_add(1);
+}
+
+class LoadHMReporter : public HMReporter {
+    /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
+    public:
+        /**
+         * @brief Initializes the load reporter.
+         *
+         * @param[in] krParam The health reporter parameters.
+         */
+        LoadHMReporter(const S_HMReporterParam& krParam) noexcept :
+            HMReporter(krParam) {
+        }
+
+        /**
+         * @brief LoadHMReporter Destructor.
+         */
+        virtual ~LoadHMReporter(void) noexcept {
+
+        }
+
+    /******************* PROTECTED METHODS AND ATTRIBUTES *********************/
+    protected:
+        /**
+         * @brief Degraded action, the load reporters stay healthy.
+         */
+        virtual void OnDegraded(void) noexcept {
+
+        }
+
+        /**
+         * @brief Unhealthy action, the load reporters stay healthy.
+         */
+        virtual void OnUnhealthy(void) noexcept {
+
+        }
+
+        /**
+         * @brief Counts the check.
+         *
+         * @return The function returns true, the check passed.
+         */
+        virtual bool PerformCheck(void) noexcept {
+            sCheckCount.fetch_add(1);
+            return true;
+        }
+};
+
+/** @brief The load reporters. */
+static LoadHMReporter* spReporters[HM_MAX_REPORTERS];
+/** @brief The load reporters identifiers. */
+static uint32_t spReporterIds[HM_MAX_REPORTERS];
+
+static void ReportChecks(const char* pkName, const uint32_t kCount) {
+    S_HMCheckStats stats;
+    HealthMonitor* pHM;
+    char           pMessage[192];
+    uint64_t       average;
+
+    pHM = SystemState::GetInstance()->GetHealthMonitor();
+
+    /* The checks are run by the real-time task, only their cost is kept */
+    HAL::Sleep(HW_RT_TASK_PERIOD_NS);
+    pHM->GetCheckStats(stats, true);
+    HAL::Sleep(LOAD_HM_DURATION_NS);
+    pHM->GetCheckStats(stats, true);
+
+    TEST_ASSERT_NOT_EQUAL(0, stats.count);
+    average = stats.totalCycles / stats.count;
+    snprintf(
+        pMessage,
+        sizeof(pMessage),
+        "BENCH name=%s.n%lu build=native-%s iterations=%lu min=%lu avg=%llu "
+        "max=%lu avg_ns=%llu events=%lu",
+        pkName,
+        (unsigned long)kCount,
+        BUILD_NUMBER,
+        (unsigned long)stats.count,
+        (unsigned long)stats.minCycles,
+        (unsigned long long)average,
+        (unsigned long)stats.maxCycles,
+        (unsigned long long)average,
+        (unsigned long)stats.events
+    );
+    TEST_MESSAGE(pMessage);
+}
+
+static void LoadWatchdogs(const char*    pkName,
+                          const uint32_t kCount,
+                          const uint64_t kWatchdogNs) {
+    S_LoadResult result;
+    uint64_t     start;
+    uint32_t     i;
+
+    /* The timeouts register their watchdog on creation */
+    LoadStart(result, "native.hm.add_watchdog");
+    for (i = 0; kCount > i; ++i) {
+        start = HAL::GetTime();
+        spTimeouts[i] = new Timeout(
+            LOAD_HM_TIMEOUT_NS,
+            kWatchdogNs,
+            LoadWatchdogHandler
+        );
+        LoadAccount(result, start);
+        TEST_ASSERT_NOT_NULL(spTimeouts[i]);
+    }
+    LoadReport(result);
+
+    ReportChecks(pkName, kCount);
+
+    LoadStart(result, "native.hm.remove_watchdog");
+    for (i = 0; kCount > i; ++i) {
+        start = HAL::GetTime();
+        delete spTimeouts[i];
+        LoadAccount(result, start);
+    }
+    LoadReport(result);
+}
+
+void test_load_hm_watchdogs_idle(void) {
+    LoadWatchdogs("native.hm.check_watchdogs.idle", 1, LOAD_HM_IDLE_WD_NS);
+    LoadWatchdogs(
+        "native.hm.check_watchdogs.idle",
+        LOAD_HM_MAX_WATCHDOGS / 2,
+        LOAD_HM_IDLE_WD_NS
+    );
+    LoadWatchdogs(
+        "native.hm.check_watchdogs.idle",
+        LOAD_HM_MAX_WATCHDOGS,
+        LOAD_HM_IDLE_WD_NS
+    );
+}
+
+void test_load_hm_watchdogs_expired(void) {
+    sHandlerCount.store(0);
+    LoadWatchdogs(
+        "native.hm.check_watchdogs.expired",
+        LOAD_HM_MAX_WATCHDOGS,
+        LOAD_HM_EXPIRED_WD_NS
+    );
+    TEST_ASSERT_NOT_EQUAL(0, sHandlerCount.load());
+}
+
+void test_load_hm_reporters(void) {
+    S_HMReporterParam param;
+    S_LoadResult      result;
+    HealthMonitor*    pHM;
+    E_Return          error;
+    char              pMessage[192];
+    uint64_t          start;
+    uint32_t          checks;
+    uint32_t          i;
+
+    pHM = SystemState::GetInstance()->GetHealthMonitor();
+    TEST_ASSERT_NOT_NULL(pHM);
+
+    param.checkPeriodNs = LOAD_HM_CHECK_PERIOD_NS;
+    param.failToDegrade = 1;
+    param.failToUnhealthy = 2;
+    for (i = 0; HM_MAX_REPORTERS > i; ++i) {
+        param.name = "load_" + std::to_string(i);
+        spReporters[i] = new LoadHMReporter(param);
+        TEST_ASSERT_NOT_NULL(spReporters[i]);
+    }
+
+    LoadStart(result, "native.hm.add_reporter");
+    for (i = 0; HM_MAX_REPORTERS > i; ++i) {
+        start = HAL::GetTime();
+        error = pHM->AddReporter(spReporters[i], spReporterIds[i]);
+        LoadAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    }
+    LoadReport(result);
+
+    /* Every reporter is checked at least once per period */
+    HAL::Sleep(HW_RT_TASK_PERIOD_NS);
+    sCheckCount.store(0);
+    HAL::Sleep(LOAD_HM_DURATION_NS);
+    checks = sCheckCount.load();
+    snprintf(
+        pMessage,
+        sizeof(pMessage),
+        "BENCH name=native.hm.check_reporters.n%lu build=native-%s "
+        "checks_per_s=%lu",
+        (unsigned long)HM_MAX_REPORTERS,
+        BUILD_NUMBER,
+        (unsigned long)(checks * 1000000000ULL / LOAD_HM_DURATION_NS)
+    );
+    TEST_MESSAGE(pMessage);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(HM_MAX_REPORTERS, checks);
+
+    LoadStart(result, "native.hm.remove_reporter");
+    for (i = 0; HM_MAX_REPORTERS > i; ++i) {
+        start = HAL::GetTime();
+        error = pHM->RemoveReporter(spReporterIds[i]);
+        LoadAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    }
+    LoadReport(result);
+
+    for (i = 0; HM_MAX_REPORTERS > i; ++i) {
+        delete spReporters[i];
+    }
+}
+
+void HMLoadTests(void) {
+    RUN_TEST(test_load_hm_watchdogs_idle);
+    RUN_TEST(test_load_hm_watchdogs_expired);
+    RUN_TEST(test_load_hm_reporters);
+}
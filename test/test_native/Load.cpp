@@ -0,0 +1,51 @@
+#include <unity.h>
+#include <HAL.h>
+#include <cstdio>
+#include <version.h>
+#include "Load.h"
+
+void LoadStart(S_LoadResult& rResult, const char* pkName) {
+    rResult.pkName = pkName;
+    rResult.count = 0;
+    rResult.minNs = UINT64_MAX;
+    rResult.maxNs = 0;
+    rResult.totalNs = 0;
+}
+
+void LoadAccount(S_LoadResult& rResult, const uint64_t kStartNs) {
+    uint64_t duration;
+
+    duration = HAL::GetTime() - kStartNs;
+
+    ++rResult.count;
+    rResult.totalNs += duration;
+    if (rResult.minNs > duration) {
+        rResult.minNs = duration;
+    }
+    if (rResult.maxNs < duration) {
+        rResult.maxNs = duration;
+    }
+}
+
+void LoadReport(const S_LoadResult& krResult) {
+    char     pMessage[192];
+    uint64_t average;
+
+    TEST_ASSERT_NOT_EQUAL(0, krResult.count);
+
+    average = krResult.totalNs / krResult.count;
+    snprintf(
+        pMessage,
+        sizeof(pMessage),
+        "BENCH name=%s build=native-%s iterations=%lu min=%llu avg=%llu "
+        "max=%llu avg_ns=%llu",
+        krResult.pkName,
+        BUILD_NUMBER,
+        (unsigned long)krResult.count,
+        (unsigned long long)krResult.minNs,
+        (unsigned long long)average,
+        (unsigned long long)krResult.maxNs,
+        (unsigned long long)average
+    );
+    TEST_MESSAGE(pMessage);
+}
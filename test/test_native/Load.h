@@ -0,0 +1,49 @@
+#ifndef __LOAD_H__
+#define __LOAD_H__
+
+#include <cstdint>
+
+/** @brief Number of iterations of the fast load measures. */
+#define LOAD_ITERATIONS 4096
+/** @brief Number of iterations of the load measures touching the storage. */
+#define LOAD_STORAGE_ITERATIONS 16
+
+/** @brief Load measure accounting, in nanoseconds. */
+typedef struct {
+    /** @brief The measure name, reported as is. */
+    const char* pkName;
+    /** @brief Number of measured iterations. */
+    uint32_t count;
+    /** @brief Duration of the fastest iteration. */
+    uint64_t minNs;
+    /** @brief Duration of the slowest iteration. */
+    uint64_t maxNs;
+    /** @brief Duration of all the iterations. */
+    uint64_t totalNs;
+} S_LoadResult;
+
+/**
+ * @brief Starts a load measure.
+ *
+ * @param[out] rResult The measure accounting to initialize.
+ * @param[in] pkName The measure name.
+ */
+void LoadStart(S_LoadResult& rResult, const char* pkName);
+
+/**
+ * @brief Accounts an iteration of a load measure.
+ *
+ * @param[in, out] rResult The measure accounting.
+ * @param[in] kStartNs The time read before the iteration.
+ */
+void LoadAccount(S_LoadResult& rResult, const uint64_t kStartNs);
+
+/**
+ * @brief Reports a load measure. The line has the format of the on-target
+ * benchmarks, the build is tagged native and the cycles are nanoseconds.
+ *
+ * @param[in] krResult The measure accounting.
+ */
+void LoadReport(const S_LoadResult& krResult);
+
+#endif /* #ifndef __LOAD_H__ */
@@ -0,0 +1,69 @@
+#include <HAL.h>             /* Hardware abstraction layer */
+#include <Logger.h>          /* Firmware logger */
+#include <Storage.h>         /* Storage manager */
+#include <Settings.h>        /* Settings services */
+#include <MemoryPool.h>      /* Subsystem memory pools */
+#include <SystemState.h>     /* System state */
+#include <HealthMonitor.h>   /* Health Monitoring */
+#include <cstdio>            /* Standard streams */
+#include <cstdlib>           /* quick_exit */
+#include <unity.h>
+
+extern void HMLoadTests();
+extern void SettingsLoadTests();
+
+/** @brief Stores the Health Monitor instance. */
+static HealthMonitor* spHealthMon;
+/** @brief Stores the Settings instance. */
+static Settings* spSettings;
+/** @brief Stores the Storage Manager instance.  */
+static Storage* spStorage;
+/** @brief Stores the System State instance. */
+static SystemState* spSystemState;
+
+int main(void) {
+    uint8_t module;
+    int     result;
+
+    /* The load would be hidden by the logs */
+    for (module = 0; LOG_MODULE_MAX > module; ++module) {
+        Logger::GetInstance()->SetModuleLevel(
+            (E_LogModule)module,
+            LOG_LEVEL_ERROR
+        );
+    }
+
+    /* Init system state */
+    spSystemState = SystemState::GetInstance();
+    if (nullptr == spSystemState) {
+        PANIC("Failed to instanciate the System State.\n");
+    }
+    MemoryPool::Init();
+
+    /* Init system objects, the storage starts empty */
+    spStorage = new Storage();
+    if (nullptr == spStorage) {
+        PANIC("Failed to instanciate the Storage Manager.\n");
+    }
+    spStorage->Format();
+    spHealthMon = new HealthMonitor();
+    if (nullptr == spHealthMon) {
+        PANIC("Failed to instanciate the Health Monitor.\n");
+    }
+    spSettings = new Settings();
+    if (nullptr == spSettings) {
+        PANIC("Failed to instanciate the Settings.\n");
+    }
+
+    UNITY_BEGIN();
+
+    HMLoadTests();
+    SettingsLoadTests();
+
+    result = UNITY_END();
+
+    /* The simulated tasks never return, keep the static objects alive */
+    fflush(stdout);
+    Logger::GetInstance()->Flush();
+    std::quick_exit(result);
+}
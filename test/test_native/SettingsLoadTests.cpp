@@ -0,0 +1,132 @@
+#include <unity.h>
+#include <HAL.h>
+#include <string>
+#include <Settings.h>
+#include <SystemState.h>
+#include "Load.h"
+
+#ifndef LOAD_SETTINGS_COUNT
+/** @brief Number of settings of the large table. */
+#define LOAD_SETTINGS_COUNT 2048
+#endif
+
+/** @brief The names of the large table settings. */
+static std::string spNames[LOAD_SETTINGS_COUNT];
+
+void test_load_settings_table(void) {
+    S_LoadResult result;
+    Settings*    pSettings;
+    E_Return     error;
+    uint64_t     start;
+    uint32_t     value;
+    uint32_t     i;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    for (i = 0; LOAD_SETTINGS_COUNT > i; ++i) {
+        spNames[i] = "load_" + std::to_string(i);
+    }
+
+    /* The first write of a name adds it to the table */
+    LoadStart(result, "native.settings.set_new");
+    for (i = 0; LOAD_SETTINGS_COUNT > i; ++i) {
+        value = i;
+        start = HAL::GetTime();
+        error = pSettings->SetSettings(
+            spNames[i],
+            (uint8_t*)&value,
+            sizeof(value)
+        );
+        LoadAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    }
+    LoadReport(result);
+
+    LoadStart(result, "native.settings.get_by_name");
+    for (i = 0; LOAD_ITERATIONS > i; ++i) {
+        start = HAL::GetTime();
+        error = pSettings->GetSettings(
+            spNames[i % LOAD_SETTINGS_COUNT],
+            (uint8_t*)&value,
+            sizeof(value)
+        );
+        LoadAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+        TEST_ASSERT_EQUAL_UINT32(i % LOAD_SETTINGS_COUNT, value);
+    }
+    LoadReport(result);
+}
+
+void test_load_settings_commit(void) {
+    S_LoadResult result;
+    Settings*    pSettings;
+    E_Return     error;
+    uint64_t     start;
+    uint32_t     value;
+    uint32_t     i;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    /* The whole table is written, then single settings are journaled */
+    LoadStart(result, "native.settings.commit_table");
+    start = HAL::GetTime();
+    error = pSettings->Commit();
+    LoadAccount(result, start);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    LoadReport(result);
+
+    LoadStart(result, "native.settings.commit_one");
+    for (i = 0; LOAD_STORAGE_ITERATIONS > i; ++i) {
+        value = LOAD_SETTINGS_COUNT + i;
+        error = pSettings->SetSettings(
+            spNames[i],
+            (uint8_t*)&value,
+            sizeof(value)
+        );
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+
+        start = HAL::GetTime();
+        error = pSettings->Commit();
+        LoadAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    }
+    LoadReport(result);
+}
+
+void test_load_settings_load(void) {
+    S_LoadResult result;
+    Settings*    pSettings;
+    E_Return     error;
+    uint64_t     start;
+    uint32_t     value;
+    uint32_t     i;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    /* The first access after a cache clear loads the whole table */
+    LoadStart(result, "native.settings.load_from_storage");
+    for (i = 0; LOAD_STORAGE_ITERATIONS > i; ++i) {
+        error = pSettings->ClearCache();
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+
+        start = HAL::GetTime();
+        error = pSettings->GetSettings(
+            spNames[LOAD_SETTINGS_COUNT - 1],
+            (uint8_t*)&value,
+            sizeof(value)
+        );
+        LoadAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+        TEST_ASSERT_EQUAL_UINT32(LOAD_SETTINGS_COUNT - 1, value);
+    }
+    LoadReport(result);
+}
+
+void SettingsLoadTests(void) {
+    RUN_TEST(test_load_settings_table);
+    RUN_TEST(test_load_settings_commit);
+    RUN_TEST(test_load_settings_load);
+}
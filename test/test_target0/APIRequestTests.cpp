@@ -0,0 +1,63 @@
+#include <APIRequest.h>
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+
+void test_query_request_parsing(void) {
+    char pQuery[] = "mode=getsettings&ssid=My+Net%26Co&&flag&bad=%zz";
+
+    QueryAPIRequest request(pQuery);
+
+    TEST_ASSERT_FALSE(request.IsOverflowed());
+    TEST_ASSERT_EQUAL(4, request.GetArgCount());
+    TEST_ASSERT_EQUAL_STRING("mode", request.GetArgName(0).c_str());
+    TEST_ASSERT_EQUAL_STRING("getsettings", request.GetArg(0).c_str());
+    TEST_ASSERT_EQUAL_STRING("ssid", request.GetArgName(1).c_str());
+    TEST_ASSERT_EQUAL_STRING("My Net&Co", request.GetArg(1).c_str());
+    TEST_ASSERT_EQUAL_STRING("flag", request.GetArgName(2).c_str());
+    TEST_ASSERT_EQUAL_STRING("", request.GetArg(2).c_str());
+
+    /* Invalid escapes are kept as is */
+    TEST_ASSERT_EQUAL_STRING("%zz", request.GetNamedArg("bad").c_str());
+    TEST_ASSERT_EQUAL_STRING("My Net&Co", request.GetNamedArg("ssid").c_str());
+    TEST_ASSERT_EQUAL_STRING("", request.GetNamedArg("missing").c_str());
+    TEST_ASSERT_EQUAL_STRING("", request.GetArgName(4).c_str());
+}
+
+void test_query_request_overflow(void) {
+    char     pQuery[API_REQUEST_MAX_ARGS * 8];
+    size_t   used;
+    uint32_t i;
+
+    used = 0;
+    for (i = 0; API_REQUEST_MAX_ARGS + 1 > i; ++i) {
+        used += snprintf(pQuery + used, sizeof(pQuery) - used, "a%u=%u&",
+                         (unsigned int)i, (unsigned int)i);
+    }
+
+    QueryAPIRequest request(pQuery);
+
+    TEST_ASSERT_TRUE(request.IsOverflowed());
+    TEST_ASSERT_EQUAL(API_REQUEST_MAX_ARGS, request.GetArgCount());
+    TEST_ASSERT_EQUAL_STRING("0", request.GetNamedArg("a0").c_str());
+}
+
+void test_query_request_empty(void) {
+    char           pQuery[] = "";
+    const uint8_t* pkBody;
+    size_t         bodySize;
+
+    QueryAPIRequest request(pQuery);
+
+    TEST_ASSERT_FALSE(request.IsOverflowed());
+    TEST_ASSERT_EQUAL(0, request.GetArgCount());
+    TEST_ASSERT_FALSE(request.GetBody(pkBody, bodySize));
+}
+
+void APIRequestTests(void) {
+
+    RUN_TEST(test_query_request_parsing);
+    RUN_TEST(test_query_request_overflow);
+    RUN_TEST(test_query_request_empty);
+
+}
@@ -0,0 +1,42 @@
+#include <BootTrace.h>
+#include <unity.h>
+#include <Arduino.h>
+
+void test_boot_trace_mark_once(void) {
+    uint32_t first;
+
+    /* The test firmware does not run the boot phases */
+    TEST_ASSERT_EQUAL(0, BootTrace::GetTime(E_BootPhase::BOOT_PHASE_READY));
+
+    BootTrace::Mark(E_BootPhase::BOOT_PHASE_READY);
+    first = BootTrace::GetTime(E_BootPhase::BOOT_PHASE_READY);
+    TEST_ASSERT_NOT_EQUAL(0, first);
+
+    /* Only the first completion is kept */
+    delayMicroseconds(10);
+    BootTrace::Mark(E_BootPhase::BOOT_PHASE_READY);
+    TEST_ASSERT_EQUAL(first, BootTrace::GetTime(E_BootPhase::BOOT_PHASE_READY));
+}
+
+void test_boot_trace_names(void) {
+    TEST_ASSERT_EQUAL_STRING(
+        "setup",
+        BootTrace::GetName(E_BootPhase::BOOT_PHASE_SETUP)
+    );
+    TEST_ASSERT_EQUAL_STRING(
+        "ready",
+        BootTrace::GetName(E_BootPhase::BOOT_PHASE_READY)
+    );
+    TEST_ASSERT_EQUAL_STRING(
+        "unknown",
+        BootTrace::GetName(E_BootPhase::BOOT_PHASE_COUNT)
+    );
+    TEST_ASSERT_EQUAL(0, BootTrace::GetTime(E_BootPhase::BOOT_PHASE_COUNT));
+}
+
+void BootTraceTests(void) {
+
+    RUN_TEST(test_boot_trace_mark_once);
+    RUN_TEST(test_boot_trace_names);
+
+}
@@ -0,0 +1,154 @@
+#include <CborReader.h>
+#include <JsonWriter.h>
+#include <unity.h>
+#include <cstring>
+
+/** @brief Test structure decoded through a schema. */
+typedef struct {
+    bool     enabled;
+    uint8_t  level;
+    uint16_t port;
+    int32_t  offset;
+    uint64_t uptime;
+    char     name[8];
+} S_CborTestStruct;
+
+/** @brief Test structure schema. */
+static const S_JsonField skCborTestSchema[] = {
+    JSON_FIELD(S_CborTestStruct, enabled, "enabled", JSON_FIELD_BOOL, true),
+    JSON_FIELD(S_CborTestStruct, level, "level", JSON_FIELD_UINT8, false),
+    JSON_FIELD(S_CborTestStruct, port, "port", JSON_FIELD_UINT16, true),
+    JSON_FIELD(S_CborTestStruct, offset, "offset", JSON_FIELD_INT32, false),
+    JSON_FIELD(S_CborTestStruct, uptime, "uptime", JSON_FIELD_UINT64, false),
+    JSON_FIELD(S_CborTestStruct, name, "name", JSON_FIELD_STRING, false)
+};
+
+/** @brief Number of fields of the test schema. */
+#define CBOR_TEST_FIELDS \
+    (sizeof(skCborTestSchema) / sizeof(skCborTestSchema[0]))
+
+/**
+ * @brief Decodes a test document.
+ *
+ * @param[in] kpData The CBOR document.
+ * @param[in] kSize The document size in bytes.
+ * @param[out] rValue The decoded structure.
+ * @param[out] rFound The decoded fields.
+ *
+ * @return true is returned when the document is valid.
+ */
+static bool Decode(const void*       kpData,
+                   const size_t      kSize,
+                   S_CborTestStruct& rValue,
+                   uint32_t&         rFound) {
+    CborReader reader((const uint8_t*)kpData, kSize);
+
+    return reader.ReadFields(
+        &rValue,
+        skCborTestSchema,
+        CBOR_TEST_FIELDS,
+        rFound
+    );
+}
+
+void test_cbor_round_trip(void) {
+    char             pBuffer[128];
+    S_CborTestStruct value;
+    S_CborTestStruct decoded;
+    uint32_t         found;
+    JsonWriter       writer(pBuffer, sizeof(pBuffer));
+
+    value.enabled = true;
+    value.level = 200;
+    value.port = 8333;
+    value.offset = -2147483647 - 1;
+    value.uptime = 18446744073709551615ULL;
+    strcpy(value.name, "station");
+
+    /* The writer and the reader share the schema */
+    writer.SetEncoding(JSON_ENCODING_CBOR);
+    writer.BeginObject();
+    writer.AddFields(&value, skCborTestSchema, CBOR_TEST_FIELDS);
+    writer.EndObject();
+    TEST_ASSERT_FALSE(writer.IsOverflowed());
+
+    memset(&decoded, 0, sizeof(decoded));
+    TEST_ASSERT_TRUE(
+        Decode(writer.GetData(), writer.GetSize(), decoded, found)
+    );
+    TEST_ASSERT_EQUAL((1UL << CBOR_TEST_FIELDS) - 1, found);
+    TEST_ASSERT_TRUE(decoded.enabled);
+    TEST_ASSERT_EQUAL(value.level, decoded.level);
+    TEST_ASSERT_EQUAL(value.port, decoded.port);
+    TEST_ASSERT_EQUAL(value.offset, decoded.offset);
+    TEST_ASSERT_TRUE(value.uptime == decoded.uptime);
+    TEST_ASSERT_EQUAL_STRING(value.name, decoded.name);
+}
+
+void test_cbor_definite_map(void) {
+    S_CborTestStruct decoded;
+    uint32_t         found;
+
+    /* {"port": 80, "name": "ab"}, the other fields are untouched */
+    static const uint8_t skDocument[] = {
+        0xA2,
+        0x64, 'p', 'o', 'r', 't', 0x18, 0x50,
+        0x64, 'n', 'a', 'm', 'e', 0x62, 'a', 'b'
+    };
+
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.level = 7;
+    TEST_ASSERT_TRUE(
+        Decode(skDocument, sizeof(skDocument), decoded, found)
+    );
+    TEST_ASSERT_EQUAL(((1UL << 2) | (1UL << 5)), found);
+    TEST_ASSERT_EQUAL(80, decoded.port);
+    TEST_ASSERT_EQUAL(7, decoded.level);
+    TEST_ASSERT_EQUAL_STRING("ab", decoded.name);
+
+    /* Empty maps are valid */
+    TEST_ASSERT_TRUE(Decode("\xA0", 1, decoded, found));
+    TEST_ASSERT_EQUAL(0, found);
+}
+
+void test_cbor_invalid(void) {
+    S_CborTestStruct decoded;
+    uint32_t         found;
+
+    /* Unknown and duplicate keys */
+    TEST_ASSERT_FALSE(Decode("\xBF\x61x\x00\xFF", 5, decoded, found));
+    TEST_ASSERT_FALSE(
+        Decode("\xBF\x64port\x01\x64port\x02\xFF", 14, decoded, found)
+    );
+
+    /* Out of range integers and mismatched types */
+    TEST_ASSERT_FALSE(
+        Decode("\xA1\x65level\x19\x01\x00", 10, decoded, found)
+    );
+    TEST_ASSERT_FALSE(Decode("\xA1\x65level\x20", 8, decoded, found));
+    TEST_ASSERT_FALSE(
+        Decode("\xA1\x66offset\x1A\x80\x00\x00\x00", 13, decoded, found)
+    );
+    TEST_ASSERT_FALSE(Decode("\xA1\x67" "enabled\x01", 10, decoded, found));
+
+    /* Strings must fit their field and hold no null byte */
+    TEST_ASSERT_FALSE(
+        Decode("\xA1\x64name\x68" "abcdefgh", 15, decoded, found)
+    );
+    TEST_ASSERT_FALSE(
+        Decode("\xA1\x64name\x62" "a\x00", 9, decoded, found)
+    );
+
+    /* Truncated documents, trailing bytes and other roots */
+    TEST_ASSERT_FALSE(Decode("\xA1\x64port", 6, decoded, found));
+    TEST_ASSERT_FALSE(Decode("\xBF\x64port\x01", 7, decoded, found));
+    TEST_ASSERT_FALSE(Decode("\xA0\x00", 2, decoded, found));
+    TEST_ASSERT_FALSE(Decode("\x9F\xFF", 2, decoded, found));
+    TEST_ASSERT_FALSE(Decode("", 0, decoded, found));
+}
+
+void CborReaderTests(void) {
+    RUN_TEST(test_cbor_round_trip);
+    RUN_TEST(test_cbor_definite_map);
+    RUN_TEST(test_cbor_invalid);
+}
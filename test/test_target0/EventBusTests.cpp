@@ -0,0 +1,107 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <EventBus.h>
+
+/** @brief Settings events subscriber of the tests. */
+static uint8_t sSettingsSub;
+/** @brief Buttons events subscriber of the tests. */
+static uint8_t sButtonsSub;
+
+/**
+ * @brief Publishes a setting change event.
+ *
+ * @param[in] kId The changed setting.
+ */
+static void PublishSetting(const E_SettingId kId) {
+    S_Event event;
+
+    event.id              = E_EventId::EVENT_SETTING_CHANGE;
+    event.data.setting.id = kId;
+    EventBus::Publish(event);
+}
+
+void test_event_bus_subscribe(void) {
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        EventBus::Subscribe(
+            EVENT_MASK(E_EventId::EVENT_SETTING_CHANGE),
+            nullptr,
+            sSettingsSub
+        )
+    );
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        EventBus::Subscribe(
+            EVENT_MASK(E_EventId::EVENT_BUTTON),
+            nullptr,
+            sButtonsSub
+        )
+    );
+    TEST_ASSERT_NOT_EQUAL(sSettingsSub, sButtonsSub);
+}
+
+void test_event_bus_delivery(void) {
+    S_Event  pEvents[4];
+    S_Event  event;
+    uint32_t count;
+
+    /* Each subscriber only receives its events, in publication order */
+    PublishSetting(E_SettingId::SETTING_ID_IS_AP);
+    event.id                 = E_EventId::EVENT_BUTTON;
+    event.data.button.button = 1;
+    event.data.button.edge   = 2;
+    EventBus::Publish(event);
+    PublishSetting(E_SettingId::SETTING_ID_WEB_PORT);
+
+    count = EventBus::Receive(sSettingsSub, pEvents, 4);
+    TEST_ASSERT_EQUAL(2, count);
+    TEST_ASSERT_EQUAL(E_EventId::EVENT_SETTING_CHANGE, pEvents[0].id);
+    TEST_ASSERT_EQUAL(
+        E_SettingId::SETTING_ID_IS_AP,
+        pEvents[0].data.setting.id
+    );
+    TEST_ASSERT_EQUAL(
+        E_SettingId::SETTING_ID_WEB_PORT,
+        pEvents[1].data.setting.id
+    );
+    TEST_ASSERT_LESS_OR_EQUAL(pEvents[1].time, pEvents[0].time);
+
+    count = EventBus::Receive(sButtonsSub, pEvents, 4);
+    TEST_ASSERT_EQUAL(1, count);
+    TEST_ASSERT_EQUAL(1, pEvents[0].data.button.button);
+    TEST_ASSERT_EQUAL(2, pEvents[0].data.button.edge);
+
+    TEST_ASSERT_EQUAL(0, EventBus::Receive(sSettingsSub, pEvents, 4));
+}
+
+void test_event_bus_full(void) {
+    S_Event  pEvents[EVENT_BUS_QUEUE_SIZE];
+    uint32_t dropped;
+    uint32_t count;
+    uint32_t i;
+
+    /* A full queue drops and counts the events, it never blocks */
+    dropped = EventBus::GetDroppedCount(sSettingsSub);
+    for (i = 0; EVENT_BUS_QUEUE_SIZE + 3 > i; ++i) {
+        PublishSetting((E_SettingId)(i % SETTING_ID_MAX));
+    }
+    TEST_ASSERT_EQUAL(dropped + 3, EventBus::GetDroppedCount(sSettingsSub));
+
+    /* The batches are bounded, the queue wraps around */
+    count = EventBus::Receive(sSettingsSub, pEvents, 5);
+    TEST_ASSERT_EQUAL(5, count);
+    PublishSetting(E_SettingId::SETTING_ID_IS_AP);
+    count = EventBus::Receive(sSettingsSub, pEvents, EVENT_BUS_QUEUE_SIZE);
+    TEST_ASSERT_EQUAL(EVENT_BUS_QUEUE_SIZE - 4, count);
+    TEST_ASSERT_EQUAL(
+        E_SettingId::SETTING_ID_IS_AP,
+        pEvents[count - 1].data.setting.id
+    );
+    TEST_ASSERT_EQUAL(0, EventBus::GetDroppedCount(EVENT_BUS_MAX_SUBSCRIBERS));
+}
+
+void EventBusTests(void) {
+    RUN_TEST(test_event_bus_subscribe);
+    RUN_TEST(test_event_bus_delivery);
+    RUN_TEST(test_event_bus_full);
+}
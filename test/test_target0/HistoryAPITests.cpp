@@ -0,0 +1,112 @@
+#include <unity.h>
+#include <cmath>
+#include <cstring>
+#include <APIRequest.h>
+#include <TSDBRollup.h>
+#include <HistoryAPIHandler.h>
+
+/** @brief Current store time of the tests. */
+#define TEST_HISTORY_NOW 1000000000LL
+
+void test_history_query_parsing(void) {
+    char           pQuery[] = "series=0x12&from=100&to=200&step=60000"
+                              "&agg=max&format=csv";
+    char           pDefault[] = "series=18";
+    char           pBadAgg[] = "series=18&agg=median";
+    char           pBadRange[] = "series=18&from=300&to=200";
+    char           pBadSeries[] = "series=70000";
+    char           pNoSeries[] = "from=100";
+    S_HistoryQuery query;
+
+    QueryAPIRequest request(pQuery);
+    TEST_ASSERT_TRUE(
+        HistoryAPIHandler::ParseQuery(request, TEST_HISTORY_NOW, query)
+    );
+    TEST_ASSERT_EQUAL(0x12, query.id);
+    TEST_ASSERT_EQUAL_INT64(100, query.from);
+    TEST_ASSERT_EQUAL_INT64(200, query.to);
+    TEST_ASSERT_EQUAL_INT64(60000, query.step);
+    TEST_ASSERT_EQUAL(E_TSDBAggregate::TSDB_AGG_MAX, query.aggregate);
+    TEST_ASSERT_EQUAL(E_HistoryFormat::HISTORY_FORMAT_CSV, query.format);
+
+    /* The default range is the last day of raw points in JSON */
+    QueryAPIRequest defaultRequest(pDefault);
+    TEST_ASSERT_TRUE(
+        HistoryAPIHandler::ParseQuery(defaultRequest, TEST_HISTORY_NOW, query)
+    );
+    TEST_ASSERT_EQUAL_INT64(TEST_HISTORY_NOW, query.to);
+    TEST_ASSERT_EQUAL_INT64(TEST_HISTORY_NOW - HISTORY_DEFAULT_RANGE_MS,
+                            query.from);
+    TEST_ASSERT_EQUAL_INT64(0, query.step);
+    TEST_ASSERT_EQUAL(E_TSDBAggregate::TSDB_AGG_AVG, query.aggregate);
+    TEST_ASSERT_EQUAL(E_HistoryFormat::HISTORY_FORMAT_JSON, query.format);
+
+    QueryAPIRequest badAgg(pBadAgg);
+    TEST_ASSERT_FALSE(
+        HistoryAPIHandler::ParseQuery(badAgg, TEST_HISTORY_NOW, query)
+    );
+    QueryAPIRequest badRange(pBadRange);
+    TEST_ASSERT_FALSE(
+        HistoryAPIHandler::ParseQuery(badRange, TEST_HISTORY_NOW, query)
+    );
+    QueryAPIRequest badSeries(pBadSeries);
+    TEST_ASSERT_FALSE(
+        HistoryAPIHandler::ParseQuery(badSeries, TEST_HISTORY_NOW, query)
+    );
+    QueryAPIRequest noSeries(pNoSeries);
+    TEST_ASSERT_FALSE(
+        HistoryAPIHandler::ParseQuery(noSeries, TEST_HISTORY_NOW, query)
+    );
+}
+
+void test_history_point_format(void) {
+    char    pBuffer[48];
+    size_t  size;
+    int64_t time;
+    float   value;
+
+    size = HistoryAPIHandler::FormatPoint(
+        E_HistoryFormat::HISTORY_FORMAT_JSON, true, 1000, 21.5f,
+        pBuffer, sizeof(pBuffer)
+    );
+    pBuffer[size] = 0;
+    TEST_ASSERT_EQUAL_STRING("[1000,21.500]", pBuffer);
+
+    size = HistoryAPIHandler::FormatPoint(
+        E_HistoryFormat::HISTORY_FORMAT_JSON, false, 2000, NAN,
+        pBuffer, sizeof(pBuffer)
+    );
+    pBuffer[size] = 0;
+    TEST_ASSERT_EQUAL_STRING(",[2000,null]", pBuffer);
+
+    size = HistoryAPIHandler::FormatPoint(
+        E_HistoryFormat::HISTORY_FORMAT_CSV, false, 3000, -1.25f,
+        pBuffer, sizeof(pBuffer)
+    );
+    pBuffer[size] = 0;
+    TEST_ASSERT_EQUAL_STRING("3000,-1.250\n", pBuffer);
+
+    size = HistoryAPIHandler::FormatPoint(
+        E_HistoryFormat::HISTORY_FORMAT_BIN, false, 4000, 2.0f,
+        pBuffer, sizeof(pBuffer)
+    );
+    TEST_ASSERT_EQUAL(sizeof(int64_t) + sizeof(float), size);
+    memcpy(&time, pBuffer, sizeof(int64_t));
+    memcpy(&value, pBuffer + sizeof(int64_t), sizeof(float));
+    TEST_ASSERT_EQUAL_INT64(4000, time);
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, value);
+
+    /* Points not fitting are not truncated */
+    TEST_ASSERT_EQUAL(
+        0,
+        HistoryAPIHandler::FormatPoint(
+            E_HistoryFormat::HISTORY_FORMAT_JSON, true, 1000, 21.5f,
+            pBuffer, 8
+        )
+    );
+}
+
+void HistoryAPITests(void) {
+    RUN_TEST(test_history_query_parsing);
+    RUN_TEST(test_history_point_format);
+}
@@ -0,0 +1,168 @@
+#include <JsonWriter.h>
+#include <unity.h>
+#include <cstring>
+
+/** @brief Test structure serialized through a schema. */
+typedef struct {
+    bool     enabled;
+    uint16_t port;
+    int32_t  offset;
+    char     name[8];
+} S_JsonTestStruct;
+
+/** @brief Test structure schema. */
+static const S_JsonField skTestSchema[] = {
+    JSON_FIELD(S_JsonTestStruct, enabled, "enabled", JSON_FIELD_BOOL, false),
+    JSON_FIELD(S_JsonTestStruct, port, "port", JSON_FIELD_UINT16, true),
+    JSON_FIELD(S_JsonTestStruct, offset, "offset", JSON_FIELD_INT32, false),
+    JSON_FIELD(S_JsonTestStruct, name, "name", JSON_FIELD_STRING, false)
+};
+
+void test_json_nesting(void) {
+    char       pBuffer[128];
+    JsonWriter writer(pBuffer, sizeof(pBuffer));
+
+    writer.BeginObject();
+    writer.AddUInt("result", 0);
+    writer.BeginArray("values");
+    writer.AddInt(nullptr, -12);
+    writer.AddBool(nullptr, true);
+    writer.BeginObject();
+    writer.AddUInt("a", 18446744073709551615ULL);
+    writer.EndObject();
+    writer.EndArray();
+    writer.EndObject();
+
+    TEST_ASSERT_FALSE(writer.IsOverflowed());
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"result\": 0, \"values\": [-12, true, "
+        "{\"a\": 18446744073709551615}]}",
+        writer.GetData()
+    );
+    TEST_ASSERT_EQUAL(strlen(pBuffer), writer.GetSize());
+}
+
+void test_json_escaping(void) {
+    char       pBuffer[64];
+    JsonWriter writer(pBuffer, sizeof(pBuffer));
+
+    writer.BeginObject();
+    writer.AddString("s", "a\"b\\c\nd\x01");
+    writer.EndObject();
+
+    TEST_ASSERT_FALSE(writer.IsOverflowed());
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"s\": \"a\\\"b\\\\c\\nd\\u0001\"}",
+        writer.GetData()
+    );
+}
+
+void test_json_schema(void) {
+    char             pBuffer[128];
+    S_JsonTestStruct value;
+    JsonWriter       writer(pBuffer, sizeof(pBuffer));
+
+    value.enabled = true;
+    value.port = 8333;
+    value.offset = -5;
+    strcpy(value.name, "node");
+
+    writer.BeginObject();
+    writer.AddFields(
+        &value,
+        skTestSchema,
+        sizeof(skTestSchema) / sizeof(skTestSchema[0])
+    );
+    writer.EndObject();
+
+    TEST_ASSERT_FALSE(writer.IsOverflowed());
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"enabled\": true, \"port\": \"8333\", \"offset\": -5, "
+        "\"name\": \"node\"}",
+        writer.GetData()
+    );
+}
+
+void test_json_overflow(void) {
+    char       pBuffer[16];
+    JsonWriter writer(pBuffer, sizeof(pBuffer));
+
+    writer.BeginObject();
+    writer.AddString("key", "a long value");
+    writer.EndObject();
+
+    TEST_ASSERT_TRUE(writer.IsOverflowed());
+    TEST_ASSERT_TRUE(sizeof(pBuffer) > writer.GetSize());
+    TEST_ASSERT_EQUAL(writer.GetSize(), strlen(pBuffer));
+
+    /* The writer is usable again after a reset */
+    writer.Reset();
+    writer.BeginObject();
+    writer.EndObject();
+    TEST_ASSERT_FALSE(writer.IsOverflowed());
+    TEST_ASSERT_EQUAL_STRING("{}", writer.GetData());
+}
+
+void test_json_cbor(void) {
+    char             pBuffer[128];
+    S_JsonTestStruct value;
+    JsonWriter       writer(pBuffer, sizeof(pBuffer));
+
+    static const uint8_t skExpected[] = {
+        0xBF, 0x66, 'r', 'e', 's', 'u', 'l', 't', 0x00,
+        0x66, 'v', 'a', 'l', 'u', 'e', 's', 0x9F,
+        0x2B, 0xF5, 0x19, 0x03, 0xE8, 0x62, 'a', 'b', 0xFF,
+        0x67, 'e', 'n', 'a', 'b', 'l', 'e', 'd', 0xF5,
+        0x64, 'p', 'o', 'r', 't', 0x19, 0x20, 0x8D,
+        0x66, 'o', 'f', 'f', 's', 'e', 't', 0x24,
+        0x64, 'n', 'a', 'm', 'e', 0x64, 'n', 'o', 'd', 'e', 0xFF
+    };
+
+    value.enabled = true;
+    value.port = 8333;
+    value.offset = -5;
+    strcpy(value.name, "node");
+
+    /* Containers are indefinite, the schema fields keep their types */
+    writer.SetEncoding(JSON_ENCODING_CBOR);
+    TEST_ASSERT_EQUAL_STRING("application/cbor", writer.GetContentType());
+    writer.BeginObject();
+    writer.AddUInt("result", 0);
+    writer.BeginArray("values");
+    writer.AddInt(nullptr, -12);
+    writer.AddBool(nullptr, true);
+    writer.AddUInt(nullptr, 1000);
+    writer.AddString(nullptr, "ab");
+    writer.EndArray();
+    writer.AddFields(
+        &value,
+        skTestSchema,
+        sizeof(skTestSchema) / sizeof(skTestSchema[0])
+    );
+    writer.EndObject();
+
+    TEST_ASSERT_FALSE(writer.IsOverflowed());
+    TEST_ASSERT_EQUAL(sizeof(skExpected), writer.GetSize());
+    TEST_ASSERT_EQUAL_MEMORY(skExpected, writer.GetData(), writer.GetSize());
+
+    /* The encoding is kept by the resets */
+    writer.Reset();
+    writer.AddInt(nullptr, -4294967296LL);
+    TEST_ASSERT_EQUAL(JSON_ENCODING_CBOR, writer.GetEncoding());
+    TEST_ASSERT_EQUAL(5, writer.GetSize());
+    TEST_ASSERT_EQUAL_MEMORY(
+        "\x3A\xFF\xFF\xFF\xFF",
+        writer.GetData(),
+        writer.GetSize()
+    );
+}
+
+void JsonWriterTests(void) {
+
+    RUN_TEST(test_json_nesting);
+    RUN_TEST(test_json_escaping);
+    RUN_TEST(test_json_schema);
+    RUN_TEST(test_json_overflow);
+    RUN_TEST(test_json_cbor);
+
+}
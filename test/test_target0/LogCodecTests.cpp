@@ -0,0 +1,138 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <cstring>
+#include <LogCodec.h>
+
+/** @brief Packed frame capacity of the tests. */
+#define TEST_CODEC_CAPACITY 496
+
+/** @brief Raw data of the encoder. */
+static uint8_t spCodecRaw[LOG_CODEC_WINDOW_SIZE];
+/** @brief Match finder of the encoder. */
+static uint16_t spCodecHash[LOG_CODEC_HASH_SIZE];
+/** @brief Packed tokens of the encoder. */
+static uint8_t spCodecPacked[TEST_CODEC_CAPACITY];
+/** @brief Packed frame output. */
+static uint8_t spCodecFrame[TEST_CODEC_CAPACITY];
+/** @brief Decoded frame output. */
+static uint8_t spCodecDecoded[LOG_CODEC_WINDOW_SIZE];
+
+/**
+ * @brief Initializes a test encoder.
+ *
+ * @param[out] rEncoder The encoder to initialize.
+ */
+static void InitEncoder(S_LogCodecEncoder& rEncoder) {
+    rEncoder.pRaw     = spCodecRaw;
+    rEncoder.pHash    = spCodecHash;
+    rEncoder.pPacked  = spCodecPacked;
+    rEncoder.capacity = TEST_CODEC_CAPACITY;
+    LogCodec::Reset(rEncoder);
+}
+
+void test_log_codec_round_trip(void) {
+    S_LogCodecEncoder encoder;
+    char              pLine[96];
+    size_t            packedLen;
+    size_t            rawLen;
+    size_t            accepted;
+    size_t            length;
+    uint32_t          i;
+    bool              isFull;
+
+    InitEncoder(encoder);
+
+    /* Append logs until the frame is full, each pack decodes alone */
+    isFull = false;
+    for (i = 0; !isFull; ++i) {
+        length = snprintf(
+            pLine,
+            sizeof(pLine),
+            "[INFO  - %16u] Sensors.cpp:%u - Sampled %u\n",
+            i * 1000,
+            100 + i % 7,
+            i % 13
+        );
+        accepted = LogCodec::Append(encoder, (uint8_t*)pLine, length);
+        isFull   = length != accepted;
+
+        packedLen = LogCodec::Pack(encoder, spCodecFrame);
+        TEST_ASSERT_LESS_OR_EQUAL(TEST_CODEC_CAPACITY, packedLen);
+        TEST_ASSERT_TRUE(
+            LogCodec::Decode(
+                spCodecFrame,
+                packedLen,
+                spCodecDecoded,
+                sizeof(spCodecDecoded),
+                rawLen
+            )
+        );
+        TEST_ASSERT_EQUAL(encoder.rawLen, rawLen);
+        TEST_ASSERT_EQUAL_MEMORY(spCodecRaw, spCodecDecoded, rawLen);
+    }
+
+    /* Repetitive logs are compressed */
+    TEST_ASSERT_GREATER_THAN(2 * TEST_CODEC_CAPACITY, encoder.rawLen);
+}
+
+void test_log_codec_capacity(void) {
+    S_LogCodecEncoder encoder;
+    uint8_t           pData[1024];
+    size_t            packedLen;
+    size_t            accepted;
+    uint32_t          seed;
+    uint32_t          i;
+
+    InitEncoder(encoder);
+
+    /* Data without matches still fits the frame as literals */
+    seed = 1;
+    for (i = 0; sizeof(pData) > i; ++i) {
+        seed     = seed * 1103515245 + 12345;
+        pData[i] = (uint8_t)(seed >> 16);
+    }
+    accepted  = LogCodec::Append(encoder, pData, sizeof(pData));
+    packedLen = LogCodec::Pack(encoder, spCodecFrame);
+    TEST_ASSERT_LESS_THAN(sizeof(pData), accepted);
+    TEST_ASSERT_LESS_OR_EQUAL(TEST_CODEC_CAPACITY, packedLen);
+    TEST_ASSERT_EQUAL(0, LogCodec::Append(encoder, pData, sizeof(pData)));
+}
+
+void test_log_codec_corrupted(void) {
+    uint8_t pFrame[8];
+    size_t  rawLen;
+
+    /* Truncated literal run */
+    pFrame[0] = 10;
+    pFrame[1] = 'a';
+    TEST_ASSERT_FALSE(
+        LogCodec::Decode(pFrame, 2, spCodecDecoded, 16, rawLen)
+    );
+
+    /* Match reaching before the frame */
+    pFrame[0] = 0;
+    pFrame[1] = 'a';
+    pFrame[2] = 0x80;
+    pFrame[3] = 2;
+    pFrame[4] = 0;
+    TEST_ASSERT_FALSE(
+        LogCodec::Decode(pFrame, 5, spCodecDecoded, 16, rawLen)
+    );
+
+    /* Overlapping match repeats the literal, the output is bounded */
+    pFrame[3] = 1;
+    TEST_ASSERT_TRUE(
+        LogCodec::Decode(pFrame, 5, spCodecDecoded, 16, rawLen)
+    );
+    TEST_ASSERT_EQUAL(1 + LOG_CODEC_MIN_MATCH, rawLen);
+    TEST_ASSERT_EQUAL_MEMORY("aaaaa", spCodecDecoded, rawLen);
+    TEST_ASSERT_FALSE(
+        LogCodec::Decode(pFrame, 5, spCodecDecoded, 4, rawLen)
+    );
+}
+
+void LogCodecTests(void) {
+    RUN_TEST(test_log_codec_round_trip);
+    RUN_TEST(test_log_codec_capacity);
+    RUN_TEST(test_log_codec_corrupted);
+}
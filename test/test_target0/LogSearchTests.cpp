@@ -0,0 +1,104 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <cstring>
+#include <Logger.h>
+#include <LogSearch.h>
+
+/** @brief Logs of the tests, the second one is an unformated line. */
+static const char skpLogs[] =
+    "[ERROR -             1000] a.cpp:1 - Storage mount failed\n"
+    "continued line\n"
+    "[INFO  -             2000] Storage mounted\n"
+    "[CRIT  -             3000] b.cpp:2 - Storage corrupted\n"
+    "[DBG   -             4000] c.cpp:3 - Sensor sampled\n";
+
+/** @brief Stores the search of the tests, searches are never destroyed. */
+static LogSearch* spSearch = nullptr;
+
+/**
+ * @brief Filters the test logs in blocks of kBlock bytes.
+ *
+ * @param[out] pOutput The buffer receiving the matching lines.
+ * @param[in] kBlock The size of the read blocks.
+ *
+ * @return The size of the matching lines is returned.
+ */
+static size_t FilterLogs(char* pOutput, const size_t kBlock) {
+    char   pBlock[sizeof(skpLogs)];
+    size_t pending;
+    size_t pos;
+    size_t read;
+    size_t size;
+    size_t kept;
+    size_t consumed;
+    size_t total;
+
+    pending = 0;
+    pos     = 0;
+    total   = 0;
+    do {
+        read = sizeof(skpLogs) - 1 - pos;
+        read = read < kBlock - pending ? read : kBlock - pending;
+        memcpy(pBlock + pending, skpLogs + pos, read);
+        pos += read;
+
+        size = pending + read;
+        kept = spSearch->Filter(pBlock, size, 0 == read, consumed);
+        memcpy(pOutput + total, pBlock, kept);
+        total += kept;
+
+        pending = size - consumed;
+        memmove(pBlock, pBlock + consumed, pending);
+    } while (0 < read);
+    pOutput[total] = 0;
+
+    return total;
+}
+
+void test_log_search(void) {
+    char pOutput[sizeof(skpLogs)];
+
+    if (nullptr == spSearch) {
+        spSearch = new LogSearch();
+    }
+    TEST_ASSERT_NOT_NULL(spSearch);
+
+    /* An empty search keeps every line, the blocks cut the lines */
+    TEST_ASSERT_TRUE(
+        spSearch->Configure("", LOG_LEVEL_DEBUG, 0, UINT64_MAX)
+    );
+    FilterLogs(pOutput, 64);
+    TEST_ASSERT_EQUAL_STRING(skpLogs, pOutput);
+
+    /* The pieces appear in order, the lines cut by the blocks match */
+    TEST_ASSERT_TRUE(
+        spSearch->Configure("Storage*ed", LOG_LEVEL_DEBUG, 0, UINT64_MAX)
+    );
+    FilterLogs(pOutput, 80);
+    TEST_ASSERT_EQUAL_STRING(
+        "[ERROR -             1000] a.cpp:1 - Storage mount failed\n"
+        "[INFO  -             2000] Storage mounted\n"
+        "[CRIT  -             3000] b.cpp:2 - Storage corrupted\n",
+        pOutput
+    );
+
+    /* The level and the time range use the log header */
+    TEST_ASSERT_TRUE(
+        spSearch->Configure("Storage", LOG_LEVEL_ERROR, 2000, 3000)
+    );
+    FilterLogs(pOutput, sizeof(skpLogs));
+    TEST_ASSERT_EQUAL_STRING(
+        "[CRIT  -             3000] b.cpp:2 - Storage corrupted\n",
+        pOutput
+    );
+
+    /* Too many pieces are refused and match nothing */
+    TEST_ASSERT_FALSE(
+        spSearch->Configure("a*b*c*d*e", LOG_LEVEL_DEBUG, 0, UINT64_MAX)
+    );
+    TEST_ASSERT_EQUAL(0, FilterLogs(pOutput, sizeof(skpLogs)));
+}
+
+void LogSearchTests(void) {
+    RUN_TEST(test_log_search);
+}
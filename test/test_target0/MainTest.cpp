@@ -15,8 +15,28 @@
 
 extern void BSPTests();
 extern void SettingsTests();
+extern void StorageTests();
 extern void TimeoutTests();
+extern void JsonWriterTests();
+extern void RouteTableTests();
+extern void APIRequestTests();
+extern void BootTraceTests();
+extern void WiFiPowerTests();
 extern void ValidatorTest();
+extern void SensorTests();
+extern void TimeSeriesTests();
+extern void HistoryAPITests();
+extern void SensorDSPTests();
+extern void SnapshotTests();
+extern void OutageBufferTests();
+extern void SystemMonitorTests();
+extern void MemoryPoolTests();
+extern void RequestArenaTests();
+extern void LogSearchTests();
+extern void LogCodecTests();
+extern void EventBusTests();
+extern void CborReaderTests();
+extern void TracerTests();
 
 /** @brief Stores the Health Monitor instance. */
 static HealthMonitor* spHealthMon;
@@ -79,8 +99,28 @@ void setup(void) {
 
     BSPTests();
     SettingsTests();
+    StorageTests();
     TimeoutTests();
+    JsonWriterTests();
+    RouteTableTests();
+    APIRequestTests();
+    BootTraceTests();
+    WiFiPowerTests();
     ValidatorTest();
+    SensorTests();
+    TimeSeriesTests();
+    HistoryAPITests();
+    SensorDSPTests();
+    SnapshotTests();
+    OutageBufferTests();
+    SystemMonitorTests();
+    MemoryPoolTests();
+    RequestArenaTests();
+    LogSearchTests();
+    LogCodecTests();
+    EventBusTests();
+    CborReaderTests();
+    TracerTests();
 
     UNITY_END();
 }
@@ -0,0 +1,94 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <MemoryPool.h>
+#include <unordered_map>
+
+/** @brief Size larger than any block of the API pool. */
+#define TEST_POOL_OVERSIZE 4096
+
+void test_memory_pool_accounting(void) {
+    S_MemPoolStats before;
+    S_MemPoolStats stats;
+    void*          pFirst;
+    void*          pSecond;
+    void*          pLarge;
+
+    MemoryPool::Init();
+    MemoryPool::GetStats(E_MemPoolId::MEM_POOL_API, before);
+    TEST_ASSERT_NOT_EQUAL(0, before.poolSize);
+    TEST_ASSERT_NOT_EQUAL(0, before.blockCount);
+
+    /* A small allocation takes a block and moves the high-water mark */
+    pFirst = MemoryPool::Allocate(E_MemPoolId::MEM_POOL_API, 24);
+    pSecond = MemoryPool::Allocate(E_MemPoolId::MEM_POOL_API, 24);
+    TEST_ASSERT_NOT_NULL(pFirst);
+    TEST_ASSERT_NOT_NULL(pSecond);
+    TEST_ASSERT_NOT_EQUAL(pFirst, pSecond);
+    MemoryPool::GetStats(E_MemPoolId::MEM_POOL_API, stats);
+    TEST_ASSERT_EQUAL(before.usedBlocks + 2, stats.usedBlocks);
+    TEST_ASSERT_TRUE(stats.used > before.used);
+    TEST_ASSERT_TRUE(stats.highWater >= stats.used);
+    TEST_ASSERT_EQUAL(before.fallbacks, stats.fallbacks);
+
+    /* A released block is reused first */
+    MemoryPool::Release(E_MemPoolId::MEM_POOL_API, pSecond, 24);
+    TEST_ASSERT_EQUAL_PTR(
+        pSecond,
+        MemoryPool::Allocate(E_MemPoolId::MEM_POOL_API, 24)
+    );
+    MemoryPool::Release(E_MemPoolId::MEM_POOL_API, pSecond, 24);
+    MemoryPool::Release(E_MemPoolId::MEM_POOL_API, pFirst, 24);
+
+    /* A block too large for the pool is served and accounted by the heap */
+    pLarge = MemoryPool::Allocate(
+        E_MemPoolId::MEM_POOL_API,
+        TEST_POOL_OVERSIZE
+    );
+    TEST_ASSERT_NOT_NULL(pLarge);
+    MemoryPool::GetStats(E_MemPoolId::MEM_POOL_API, stats);
+    TEST_ASSERT_EQUAL(before.fallbacks + 1, stats.fallbacks);
+    TEST_ASSERT_EQUAL(before.heapUsed + TEST_POOL_OVERSIZE, stats.heapUsed);
+    MemoryPool::Release(
+        E_MemPoolId::MEM_POOL_API,
+        pLarge,
+        TEST_POOL_OVERSIZE
+    );
+
+    MemoryPool::GetStats(E_MemPoolId::MEM_POOL_API, stats);
+    TEST_ASSERT_EQUAL(before.used, stats.used);
+    TEST_ASSERT_EQUAL(before.usedBlocks, stats.usedBlocks);
+    TEST_ASSERT_EQUAL(before.heapUsed, stats.heapUsed);
+}
+
+void test_memory_pool_containers(void) {
+    S_MemPoolStats before;
+    S_MemPoolStats stats;
+
+    MemoryPool::Init();
+    MemoryPool::GetStats(E_MemPoolId::MEM_POOL_API, before);
+    {
+        std::unordered_map<
+            uint32_t,
+            APIString,
+            std::hash<uint32_t>,
+            std::equal_to<uint32_t>,
+            PoolAllocator<std::pair<const uint32_t, APIString>, MEM_POOL_API>
+        > map;
+
+        map[1] = "A string longer than the small string buffer";
+        map[2] = "Short";
+        TEST_ASSERT_EQUAL_STRING("Short", map[2].c_str());
+        MemoryPool::GetStats(E_MemPoolId::MEM_POOL_API, stats);
+        TEST_ASSERT_TRUE(stats.usedBlocks > before.usedBlocks);
+    }
+
+    /* Destroying the container returns every block */
+    MemoryPool::GetStats(E_MemPoolId::MEM_POOL_API, stats);
+    TEST_ASSERT_EQUAL(before.usedBlocks, stats.usedBlocks);
+    TEST_ASSERT_EQUAL(before.heapUsed, stats.heapUsed);
+}
+
+void MemoryPoolTests(void) {
+    RUN_TEST(test_memory_pool_accounting);
+    RUN_TEST(test_memory_pool_containers);
+}
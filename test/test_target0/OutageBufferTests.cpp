@@ -0,0 +1,78 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <Errors.h>
+#include <OutageBuffer.h>
+
+/** @brief Capacity of the memory queue of the tests. */
+#define TEST_OUTAGE_QUEUE 8
+
+/** @brief Number of records pushed, most of them spilled on the card. */
+#define TEST_OUTAGE_RECORDS 100
+
+/** @brief Stores the buffer of the tests, buffers are never destroyed. */
+static OutageBuffer* spBuffer = nullptr;
+
+void test_outage_fifo(void) {
+    S_OutageStats stats;
+    uint32_t      pRecords[TEST_OUTAGE_QUEUE];
+    uint32_t      record;
+    uint32_t      expected;
+    uint32_t      count;
+    uint32_t      i;
+
+    if (nullptr == spBuffer) {
+        spBuffer = new OutageBuffer(
+            sizeof(uint32_t),
+            TEST_OUTAGE_QUEUE,
+            "rthr_test_outage.bin"
+        );
+    }
+    TEST_ASSERT_NOT_NULL(spBuffer);
+    spBuffer->Reset();
+    TEST_ASSERT_EQUAL(0, spBuffer->GetCount());
+    TEST_ASSERT_EQUAL(0, spBuffer->Peek(pRecords, TEST_OUTAGE_QUEUE));
+
+    /* Past the queue, the records go to the overflow file */
+    for (record = 0; TEST_OUTAGE_RECORDS > record; ++record) {
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, spBuffer->Push(&record));
+    }
+    spBuffer->GetStats(stats);
+    TEST_ASSERT_EQUAL(TEST_OUTAGE_QUEUE, stats.queued);
+    TEST_ASSERT_EQUAL(TEST_OUTAGE_RECORDS - TEST_OUTAGE_QUEUE, stats.spilled);
+    TEST_ASSERT_EQUAL(0, stats.dropped);
+
+    /* Peeking twice returns the same records */
+    count = spBuffer->Peek(pRecords, 3);
+    TEST_ASSERT_EQUAL(3, count);
+    TEST_ASSERT_EQUAL(0, pRecords[0]);
+    count = spBuffer->Peek(pRecords, 3);
+    TEST_ASSERT_EQUAL(0, pRecords[0]);
+    spBuffer->Release(count);
+
+    /* Pushed while draining, the new records stay behind the old ones */
+    record = TEST_OUTAGE_RECORDS;
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, spBuffer->Push(&record));
+
+    expected = 3;
+    do {
+        count = spBuffer->Peek(pRecords, TEST_OUTAGE_QUEUE);
+        for (i = 0; count > i; ++i) {
+            TEST_ASSERT_EQUAL(expected, pRecords[i]);
+            ++expected;
+        }
+        spBuffer->Release(count);
+    } while (0 != count);
+    TEST_ASSERT_EQUAL(TEST_OUTAGE_RECORDS + 1, expected);
+    TEST_ASSERT_EQUAL(0, spBuffer->GetCount());
+
+    /* Once drained, the records are queued in memory again */
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, spBuffer->Push(&record));
+    spBuffer->GetStats(stats);
+    TEST_ASSERT_EQUAL(1, stats.queued);
+    TEST_ASSERT_EQUAL(0, stats.spilled);
+    spBuffer->Reset();
+}
+
+void OutageBufferTests(void) {
+    RUN_TEST(test_outage_fifo);
+}
@@ -0,0 +1,46 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <MemoryPool.h>
+#include <RequestArena.h>
+
+/** @brief Size of the arena of the tests. */
+#define TEST_ARENA_SIZE 256
+
+/** @brief Stores the arena of the tests, arenas are never destroyed. */
+static RequestArena* spArena = nullptr;
+
+void test_request_arena(void) {
+    S_RequestArenaStats stats;
+    uint8_t*            pFirst;
+    uint8_t*            pSecond;
+
+    if (nullptr == spArena) {
+        MemoryPool::Init();
+        spArena = new RequestArena(TEST_ARENA_SIZE);
+    }
+    TEST_ASSERT_NOT_NULL(spArena);
+    spArena->Reset();
+
+    /* The allocations are aligned and follow each other */
+    pFirst = (uint8_t*)spArena->Allocate(3);
+    pSecond = (uint8_t*)spArena->Allocate(16);
+    TEST_ASSERT_NOT_NULL(pFirst);
+    TEST_ASSERT_NOT_NULL(pSecond);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)pSecond % REQUEST_ARENA_ALIGN);
+    TEST_ASSERT_EQUAL_PTR(pFirst + REQUEST_ARENA_ALIGN, pSecond);
+
+    /* An exhausted arena refuses the allocation and counts it */
+    TEST_ASSERT_NULL(spArena->Allocate(TEST_ARENA_SIZE));
+    spArena->Reset();
+    spArena->GetStats(stats);
+    TEST_ASSERT_EQUAL(1, stats.failures);
+    TEST_ASSERT_EQUAL(REQUEST_ARENA_ALIGN + 16, stats.peak);
+
+    /* Once reset, the memory of the previous request is reused */
+    TEST_ASSERT_EQUAL_PTR(pFirst, spArena->Allocate(TEST_ARENA_SIZE));
+    spArena->Reset();
+}
+
+void RequestArenaTests(void) {
+    RUN_TEST(test_request_arena);
+}
@@ -0,0 +1,137 @@
+#include <RouteTable.h>
+#include <unity.h>
+#include <cstring>
+
+/** @brief Test routes, sorted by path. */
+static constexpr S_Route skTestRoutes[] = {
+    ROUTE("/", HTTP_ANY, false, 0),
+    ROUTE("/history/", HTTP_GET, true, 1),
+    ROUTE("/history/temp/", HTTP_GET, true, 2),
+    ROUTE("/ping", HTTP_POST, false, 3),
+    ROUTE("/wifi", HTTP_POST, false, 4)
+};
+
+static_assert(
+    RouteTable::IsSorted(
+        skTestRoutes,
+        sizeof(skTestRoutes) / sizeof(skTestRoutes[0])
+    ),
+    "Test routes must be sorted."
+);
+
+/** @brief Unsorted routes, rejected by the compile time check. */
+static constexpr S_Route skUnsortedRoutes[] = {
+    ROUTE("/wifi", HTTP_POST, false, 0),
+    ROUTE("/ping", HTTP_POST, false, 1)
+};
+
+static_assert(
+    !RouteTable::IsSorted(skUnsortedRoutes, 2),
+    "Unsorted routes must be detected."
+);
+
+static void TestRouteHandler(const S_Route& krRoute) {
+    (void)krRoute;
+}
+
+static void TestRawHandler(const S_Route& krRoute, HTTPRaw& rRaw) {
+    (void)krRoute;
+    (void)rRaw;
+}
+
+static bool TestRawFilter(const S_Route& krRoute) {
+    return 4 == krRoute.id;
+}
+
+static const S_Route* FindRoute(const RouteTable& krTable,
+                                const char*       kpUri,
+                                const HTTPMethod  kMethod,
+                                E_RouteMatch&     rMatch) {
+    return krTable.Find(kpUri, strlen(kpUri), kMethod, rMatch);
+}
+
+void test_route_exact(void) {
+    RouteTable     table(skTestRoutes, 5, TestRouteHandler);
+    const S_Route* pkRoute;
+    E_RouteMatch   match;
+
+    pkRoute = FindRoute(table, "/", HTTP_GET, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_MATCH, match);
+    TEST_ASSERT_EQUAL(0, pkRoute->id);
+
+    pkRoute = FindRoute(table, "/wifi", HTTP_POST, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_MATCH, match);
+    TEST_ASSERT_EQUAL(4, pkRoute->id);
+
+    pkRoute = FindRoute(table, "/pin", HTTP_POST, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_NO_MATCH, match);
+    TEST_ASSERT_TRUE(nullptr == pkRoute);
+
+    pkRoute = FindRoute(table, "/pingpong", HTTP_POST, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_NO_MATCH, match);
+    TEST_ASSERT_TRUE(nullptr == pkRoute);
+}
+
+void test_route_prefix(void) {
+    RouteTable     table(skTestRoutes, 5, TestRouteHandler);
+    const S_Route* pkRoute;
+    E_RouteMatch   match;
+
+    pkRoute = FindRoute(table, "/history/hum/1h", HTTP_GET, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_MATCH, match);
+    TEST_ASSERT_EQUAL(1, pkRoute->id);
+
+    /* The longest prefix wins */
+    pkRoute = FindRoute(table, "/history/temp/1h", HTTP_GET, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_MATCH, match);
+    TEST_ASSERT_EQUAL(2, pkRoute->id);
+
+    pkRoute = FindRoute(table, "/history", HTTP_GET, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_NO_MATCH, match);
+}
+
+void test_route_method(void) {
+    RouteTable     table(skTestRoutes, 5, TestRouteHandler);
+    const S_Route* pkRoute;
+    E_RouteMatch   match;
+
+    pkRoute = FindRoute(table, "/ping", HTTP_GET, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_METHOD_MISMATCH, match);
+    TEST_ASSERT_TRUE(nullptr == pkRoute);
+
+    pkRoute = FindRoute(table, "/history/temp/1h", HTTP_POST, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_METHOD_MISMATCH, match);
+
+    /* HTTP_ANY accepts all the methods */
+    pkRoute = FindRoute(table, "/", HTTP_DELETE, match);
+    TEST_ASSERT_EQUAL(E_RouteMatch::ROUTE_MATCH, match);
+}
+
+void test_route_raw(void) {
+    RouteTable table(skTestRoutes, 5, TestRouteHandler);
+
+    TEST_ASSERT_TRUE(table.canHandle(HTTP_POST, "/ping"));
+    TEST_ASSERT_FALSE(table.canRaw("/ping"));
+
+    table.SetRawHandler(3, TestRawHandler);
+    TEST_ASSERT_TRUE(table.canHandle(HTTP_POST, "/ping"));
+    TEST_ASSERT_TRUE(table.canRaw("/ping"));
+    TEST_ASSERT_TRUE(table.canHandle(HTTP_POST, "/wifi"));
+    TEST_ASSERT_FALSE(table.canRaw("/wifi"));
+
+    /* The filtered routes are also received as raw data */
+    table.SetRawFilter(TestRawFilter);
+    TEST_ASSERT_TRUE(table.canHandle(HTTP_POST, "/wifi"));
+    TEST_ASSERT_TRUE(table.canRaw("/wifi"));
+    TEST_ASSERT_TRUE(table.canHandle(HTTP_GET, "/"));
+    TEST_ASSERT_FALSE(table.canRaw("/"));
+}
+
+void RouteTableTests(void) {
+
+    RUN_TEST(test_route_exact);
+    RUN_TEST(test_route_prefix);
+    RUN_TEST(test_route_method);
+    RUN_TEST(test_route_raw);
+
+}
@@ -0,0 +1,226 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <cmath>
+#include <Errors.h>
+#include <Sensor.h>
+#include <SensorDSP.h>
+#include <algorithm>
+
+/** @brief Number of values of the benchmark blocks. */
+#define BENCH_DSP_COUNT 1024
+/** @brief Moving average window of the tests. */
+#define TEST_DSP_WINDOW 16
+
+static float sInput[BENCH_DSP_COUNT];
+static float sHumidity[BENCH_DSP_COUNT];
+static float sOutput[BENCH_DSP_COUNT];
+static float sReference[BENCH_DSP_COUNT];
+
+static void FillInput(void) {
+    uint32_t i;
+
+    for (i = 0; BENCH_DSP_COUNT > i; ++i) {
+        sInput[i] = 20.0f + (float)((i * 37) % 101) * 0.05f;
+        sHumidity[i] = 10.0f + (float)((i * 53) % 89);
+    }
+}
+
+static void ReportSpeedup(const char*    pkName,
+                          const uint32_t kNaiveCycles,
+                          const uint32_t kBlockCycles) {
+    char pMessage[128];
+
+    snprintf(
+        pMessage,
+        sizeof(pMessage),
+        "%s: naive %lu cycles/value, block %lu cycles/value, x%lu.%02lu",
+        pkName,
+        (unsigned long)(kNaiveCycles / BENCH_DSP_COUNT),
+        (unsigned long)(kBlockCycles / BENCH_DSP_COUNT),
+        (unsigned long)(kNaiveCycles / (kBlockCycles + 1)),
+        (unsigned long)((kNaiveCycles * 100ULL / (kBlockCycles + 1)) % 100)
+    );
+    TEST_MESSAGE(pMessage);
+}
+
+void test_dsp_filters(void) {
+    S_DSPMovingAverage average;
+    S_DSPMedian        median;
+    S_DSPEma           ema;
+    S_SensorSample     pSamples[4];
+    float              pValues[4];
+    float              pSpike[7] = {1.0f, 1.0f, 1.0f, 50.0f, 1.0f, 1.0f, 1.0f};
+    float              sum;
+    uint32_t           count;
+    uint32_t           i;
+    uint32_t           j;
+
+    FillInput();
+
+    /* Invalid parameters */
+    TEST_ASSERT_EQUAL(
+        E_Return::ERR_INVALID_PARAM,
+        SensorDSP::InitMovingAverage(average, DSP_MAX_WINDOW + 1)
+    );
+    TEST_ASSERT_EQUAL(
+        E_Return::ERR_INVALID_PARAM,
+        SensorDSP::InitMedian(median, 4)
+    );
+    TEST_ASSERT_EQUAL(
+        E_Return::ERR_INVALID_PARAM,
+        SensorDSP::InitEma(ema, 0.0f)
+    );
+
+    /* Moving average over two blocks against the window sum */
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        SensorDSP::InitMovingAverage(average, TEST_DSP_WINDOW)
+    );
+    SensorDSP::MovingAverage(average, sInput, sOutput, 100);
+    SensorDSP::MovingAverage(
+        average,
+        sInput + 100,
+        sOutput + 100,
+        BENCH_DSP_COUNT - 100
+    );
+    for (i = 0; BENCH_DSP_COUNT > i; ++i) {
+        count = std::min(i + 1, (uint32_t)TEST_DSP_WINDOW);
+        sum = 0.0f;
+        for (j = 0; count > j; ++j) {
+            sum += sInput[i - j];
+        }
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, sum / count, sOutput[i]);
+    }
+
+    /* Median removes a single spike */
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, SensorDSP::InitMedian(median, 3));
+    SensorDSP::Median(median, pSpike, pSpike, 7);
+    for (i = 2; 7 > i; ++i) {
+        TEST_ASSERT_EQUAL_FLOAT(1.0f, pSpike[i]);
+    }
+
+    /* Exponential smoothing starts at the first value */
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, SensorDSP::InitEma(ema, 0.5f));
+    pValues[0] = 10.0f;
+    pValues[1] = 20.0f;
+    SensorDSP::Ema(ema, pValues, pValues, 2);
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, pValues[0]);
+    TEST_ASSERT_EQUAL_FLOAT(15.0f, pValues[1]);
+
+    /* Derived values against the math library */
+    SensorDSP::DewPoint(sInput, sHumidity, sOutput, BENCH_DSP_COUNT);
+    for (i = 0; BENCH_DSP_COUNT > i; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(
+            0.001f,
+            SensorDSP::DewPointScalar(sInput[i], sHumidity[i]),
+            sOutput[i]
+        );
+    }
+    pValues[0] = 1013.25f;
+    pValues[1] = 900.0f;
+    pValues[2] = -1.0f;
+    SensorDSP::PressureAltitude(pValues, pValues, 3);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, pValues[0]);
+    TEST_ASSERT_FLOAT_WITHIN(
+        0.05f,
+        SensorDSP::PressureAltitudeScalar(900.0f),
+        pValues[1]
+    );
+    TEST_ASSERT_TRUE(std::isnan(pValues[2]));
+
+    /* Channel gathering from a ring batch */
+    for (i = 0; 4 > i; ++i) {
+        pSamples[i].time = i;
+        pSamples[i].value = (float)i;
+        pSamples[i].sensorId = 1;
+        pSamples[i].quantity = i % 2;
+    }
+    TEST_ASSERT_EQUAL(
+        2,
+        SensorDSP::Gather(pSamples, 4, 1, 1, pValues, 4)
+    );
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, pValues[0]);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, pValues[1]);
+}
+
+void test_dsp_benchmark(void) {
+    S_DSPMovingAverage average;
+    S_DSPMedian        median;
+    float              pWindow[5];
+    float              sum;
+    uint32_t           start;
+    uint32_t           naive;
+    uint32_t           block;
+    uint32_t           i;
+    uint32_t           j;
+
+    FillInput();
+
+    /* Moving average, the naive loop sums the whole window */
+    start = HWManager::GetCycleCount();
+    for (i = TEST_DSP_WINDOW; BENCH_DSP_COUNT > i; ++i) {
+        sum = 0.0f;
+        for (j = 0; TEST_DSP_WINDOW > j; ++j) {
+            sum += sInput[i - j];
+        }
+        sReference[i] = sum / TEST_DSP_WINDOW;
+    }
+    naive = HWManager::GetCycleCount() - start;
+    SensorDSP::InitMovingAverage(average, TEST_DSP_WINDOW);
+    start = HWManager::GetCycleCount();
+    SensorDSP::MovingAverage(average, sInput, sOutput, BENCH_DSP_COUNT);
+    block = HWManager::GetCycleCount() - start;
+    ReportSpeedup("Moving average", naive, block);
+    TEST_ASSERT_LESS_THAN(naive, block);
+
+    /* Median of 5, the naive loop sorts the window */
+    start = HWManager::GetCycleCount();
+    for (i = 4; BENCH_DSP_COUNT > i; ++i) {
+        for (j = 0; 5 > j; ++j) {
+            pWindow[j] = sInput[i - j];
+        }
+        std::sort(pWindow, pWindow + 5);
+        sReference[i] = pWindow[2];
+    }
+    naive = HWManager::GetCycleCount() - start;
+    SensorDSP::InitMedian(median, 5);
+    start = HWManager::GetCycleCount();
+    SensorDSP::Median(median, sInput, sOutput, BENCH_DSP_COUNT);
+    block = HWManager::GetCycleCount() - start;
+    ReportSpeedup("Median of 5", naive, block);
+    for (i = 4; BENCH_DSP_COUNT > i; ++i) {
+        TEST_ASSERT_EQUAL_FLOAT(sReference[i], sOutput[i]);
+    }
+
+    /* Dew point, the naive loop calls the math library */
+    start = HWManager::GetCycleCount();
+    for (i = 0; BENCH_DSP_COUNT > i; ++i) {
+        sReference[i] = SensorDSP::DewPointScalar(sInput[i], sHumidity[i]);
+    }
+    naive = HWManager::GetCycleCount() - start;
+    start = HWManager::GetCycleCount();
+    SensorDSP::DewPoint(sInput, sHumidity, sOutput, BENCH_DSP_COUNT);
+    block = HWManager::GetCycleCount() - start;
+    ReportSpeedup("Dew point", naive, block);
+
+    /* Pressure altitude */
+    for (i = 0; BENCH_DSP_COUNT > i; ++i) {
+        sHumidity[i] = 950.0f + sInput[i];
+    }
+    start = HWManager::GetCycleCount();
+    for (i = 0; BENCH_DSP_COUNT > i; ++i) {
+        sReference[i] = SensorDSP::PressureAltitudeScalar(sHumidity[i]);
+    }
+    naive = HWManager::GetCycleCount() - start;
+    start = HWManager::GetCycleCount();
+    SensorDSP::PressureAltitude(sHumidity, sOutput, BENCH_DSP_COUNT);
+    block = HWManager::GetCycleCount() - start;
+    ReportSpeedup("Pressure altitude", naive, block);
+    TEST_ASSERT_LESS_THAN(naive, block);
+}
+
+void SensorDSPTests(void) {
+    RUN_TEST(test_dsp_filters);
+    RUN_TEST(test_dsp_benchmark);
+}
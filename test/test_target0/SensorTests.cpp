@@ -0,0 +1,173 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <Errors.h>
+#include <Sensor.h>
+#include <SensorEngine.h>
+#include <BME280Sensor.h>
+#include <cstring>
+
+/** @brief Stores the sensor engine, only one can exist. */
+static SensorEngine* spEngine = nullptr;
+
+class TestSensor : public Sensor {
+    public:
+        TestSensor(const uint64_t kPeriodNs) noexcept :
+            Sensor("TEST_SENSOR", kPeriodNs) {
+            this->value = 0.0f;
+            this->isFailing = false;
+            this->initCount = 0;
+        }
+
+        virtual ~TestSensor(void) noexcept {
+        }
+
+        virtual E_Return Init(void) noexcept {
+            ++this->initCount;
+            return E_Return::NO_ERROR;
+        }
+
+        virtual void GetTransfer(S_SensorTransfer& rTransfer) const noexcept {
+            memset(&rTransfer, 0, sizeof(rTransfer));
+            rTransfer.bus = E_SensorBus::SENSOR_BUS_NONE;
+        }
+
+        virtual uint32_t Decode(const uint8_t*  kpFrame,
+                                S_SensorSample* pSamples) noexcept {
+            uint32_t count;
+
+            TEST_ASSERT_NULL(kpFrame);
+
+            count = 0;
+            if (!this->isFailing) {
+                this->value += 1.0f;
+                pSamples[0].value = this->value;
+                pSamples[0].quantity = E_SensorQuantity::SENSOR_QTY_TEMPERATURE;
+                pSamples[1].value = -this->value;
+                pSamples[1].quantity = E_SensorQuantity::SENSOR_QTY_PRESSURE;
+                count = 2;
+            }
+            return count;
+        }
+
+        volatile float    value;
+        volatile bool     isFailing;
+        volatile uint32_t initCount;
+};
+
+void test_sensor_bme280_compensation(void) {
+    S_BME280Calibration calib;
+    uint8_t             pFrame[8];
+    float               temperature;
+    float               humidity;
+    float               pressure;
+
+    /* Datasheet compensation example */
+    memset(&calib, 0, sizeof(calib));
+    calib.t1 = 27504;
+    calib.t2 = 26435;
+    calib.t3 = -1000;
+    calib.p1 = 36477;
+    calib.p2 = -10685;
+    calib.p3 = 3024;
+    calib.p4 = 2855;
+    calib.p5 = 140;
+    calib.p6 = -7;
+    calib.p7 = 15500;
+    calib.p8 = -14600;
+    calib.p9 = 6000;
+    calib.h1 = 75;
+    calib.h2 = 362;
+    calib.h4 = 323;
+    calib.h5 = 50;
+    calib.h6 = 30;
+
+    /* Raw pressure 415148, raw temperature 519888, raw humidity 0x6000 */
+    pFrame[0] = 0x65;
+    pFrame[1] = 0x5A;
+    pFrame[2] = 0xC0;
+    pFrame[3] = 0x7E;
+    pFrame[4] = 0xED;
+    pFrame[5] = 0x00;
+    pFrame[6] = 0x60;
+    pFrame[7] = 0x00;
+
+    TEST_ASSERT_TRUE(BME280Sensor::Compensate(
+        calib, pFrame, temperature, humidity, pressure
+    ));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 25.08f, temperature);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 1006.53f, pressure);
+    TEST_ASSERT_TRUE(0.0f <= humidity && 100.0f >= humidity);
+
+    /* Skipped measurements are rejected */
+    pFrame[3] = 0x80;
+    pFrame[4] = 0x00;
+    pFrame[5] = 0x00;
+    TEST_ASSERT_FALSE(BME280Sensor::Compensate(
+        calib, pFrame, temperature, humidity, pressure
+    ));
+}
+
+void test_sensor_engine(void) {
+    S_SensorSample pSamples[16];
+    S_SensorStatus status;
+    TestSensor*    pSensor;
+    uint32_t       sensorId;
+    uint32_t       sequence;
+    uint32_t       count;
+    uint32_t       initCount;
+    uint32_t       i;
+
+    pSensor = new TestSensor(10000000);
+    spEngine = new SensorEngine();
+    TEST_ASSERT_NOT_NULL(spEngine);
+
+    TEST_ASSERT_EQUAL(E_Return::ERR_INVALID_PARAM, spEngine->AddSensor(nullptr, sensorId));
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, spEngine->AddSensor(pSensor, sensorId));
+    TEST_ASSERT_EQUAL(0, sensorId);
+    TEST_ASSERT_EQUAL(0, spEngine->GetSequence());
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, spEngine->Start());
+
+    /* Sensors cannot be added once started */
+    TEST_ASSERT_EQUAL(E_Return::ERR_INVALID_PARAM, spEngine->AddSensor(pSensor, sensorId));
+
+    /* Samples are published in order at the sensor period */
+    vTaskDelay(105 / portTICK_PERIOD_MS);
+    TEST_ASSERT_GREATER_OR_EQUAL(1, pSensor->initCount);
+    sequence = 0;
+    count = spEngine->ReadSamples(sequence, pSamples, 16);
+    TEST_ASSERT_GREATER_OR_EQUAL(16, count);
+    TEST_ASSERT_EQUAL(count, sequence);
+    for (i = 0; count > i; i += 2) {
+        TEST_ASSERT_EQUAL(0, pSamples[i].sensorId);
+        TEST_ASSERT_EQUAL(E_SensorQuantity::SENSOR_QTY_TEMPERATURE, pSamples[i].quantity);
+        TEST_ASSERT_EQUAL(E_SensorQuantity::SENSOR_QTY_PRESSURE, pSamples[i + 1].quantity);
+        TEST_ASSERT_EQUAL_FLOAT((float)(i / 2 + 1), pSamples[i].value);
+        TEST_ASSERT_EQUAL_FLOAT(-pSamples[i].value, pSamples[i + 1].value);
+        TEST_ASSERT_EQUAL_UINT64(pSamples[i].time, pSamples[i + 1].time);
+        if (0 != i) {
+            TEST_ASSERT_GREATER_OR_EQUAL(9000000, pSamples[i].time - pSamples[i - 2].time);
+        }
+    }
+
+    /* Failed reads are accounted and a restart resumes the sampling */
+    pSensor->isFailing = true;
+    vTaskDelay(50 / portTICK_PERIOD_MS);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, spEngine->GetSensorStatus(sensorId, status));
+    TEST_ASSERT_EQUAL_STRING("TEST_SENSOR", status.pkName);
+    TEST_ASSERT_GREATER_THAN(0, status.errors);
+    sequence = spEngine->GetSequence();
+    initCount = pSensor->initCount;
+    pSensor->isFailing = false;
+    spEngine->RequestInit(sensorId);
+    vTaskDelay(50 / portTICK_PERIOD_MS);
+    TEST_ASSERT_GREATER_THAN(initCount, pSensor->initCount);
+    TEST_ASSERT_GREATER_THAN(sequence, spEngine->GetSequence());
+
+    TEST_ASSERT_EQUAL(E_Return::ERR_NO_SUCH_ID, spEngine->GetSensorStatus(1, status));
+}
+
+void SensorTests(void) {
+    RUN_TEST(test_sensor_bme280_compensation);
+    RUN_TEST(test_sensor_engine);
+}
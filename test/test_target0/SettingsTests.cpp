@@ -106,6 +106,329 @@ void test_commit(void) {
     TEST_ASSERT_EQUAL(24, buffer);
 }
 
+void test_commit_sizes(void) {
+    E_Return  result;
+    uint8_t   buffer8;
+    uint32_t  buffer32;
+    char      pBufferStr[64];
+    Settings* pSettings;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    buffer8  = 42;
+    buffer32 = 0xDEADBEEF;
+    memset(pBufferStr, 'S', sizeof(pBufferStr));
+
+    result = pSettings->SetSettings("commit_u8", &buffer8, sizeof(uint8_t));
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->SetSettings(
+        "commit_u32",
+        (uint8_t*)&buffer32,
+        sizeof(uint32_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->SetSettings(
+        "commit_str",
+        (uint8_t*)pBufferStr,
+        sizeof(pBufferStr)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    result = pSettings->Commit();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    result = pSettings->ClearCache();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    buffer8  = 0;
+    buffer32 = 0;
+    memset(pBufferStr, 0, sizeof(pBufferStr));
+
+    result = pSettings->GetSettings("commit_str", (uint8_t*)pBufferStr, 64);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL('S', pBufferStr[63]);
+    result = pSettings->GetSettings("commit_u8", &buffer8, sizeof(uint8_t));
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(42, buffer8);
+    result = pSettings->GetSettings(
+        "commit_u32",
+        (uint8_t*)&buffer32,
+        sizeof(uint32_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL_HEX32(0xDEADBEEF, buffer32);
+
+    /* Values loaded from storage can be updated and committed again */
+    buffer8 = 43;
+    result = pSettings->SetSettings("commit_u8", &buffer8, sizeof(uint8_t));
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->Commit();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->ClearCache();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    buffer8 = 0;
+    result = pSettings->GetSettings("commit_u8", &buffer8, sizeof(uint8_t));
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(43, buffer8);
+}
+
+void test_commit_oversized(void) {
+    E_Return       result;
+    Settings*      pSettings;
+    static uint8_t spBuffer[SETTINGS_ARENA_SIZE / 2];
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    result = pSettings->ClearCache();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    /* A file that would not be loadable is not written */
+    memset(spBuffer, 'O', sizeof(spBuffer));
+    result = pSettings->SetSettings("commit_big", spBuffer, sizeof(spBuffer));
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->Commit();
+    TEST_ASSERT_EQUAL(E_Return::ERR_SETTING_INVALID, result);
+
+    result = pSettings->ClearCache();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+}
+
+void test_commit_compaction(void) {
+    E_Return  result;
+    uint32_t  i;
+    uint32_t  buffer;
+    Settings* pSettings;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    /* Enough commits to fill the journal and compact it several times */
+    for (i = 0; 200 > i; ++i) {
+        result = pSettings->SetSettings(
+            "commit_journal",
+            (uint8_t*)&i,
+            sizeof(uint32_t)
+        );
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+        result = pSettings->Commit();
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    }
+
+    result = pSettings->ClearCache();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    buffer = 0;
+    result = pSettings->GetSettings(
+        "commit_journal",
+        (uint8_t*)&buffer,
+        sizeof(uint32_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(199, buffer);
+
+    /* Settings committed before the compactions are kept */
+    result = pSettings->GetSettings("commit_u8", (uint8_t*)&buffer, 1);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+}
+
+void test_identified(void) {
+    E_Return  result;
+    uint16_t  port;
+    uint16_t  buffer;
+    bool      isAP;
+    Settings* pSettings;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    /* Get the default */
+    result = pSettings->GetDefault(
+        SETTING_ID_API_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(8333, port);
+
+    /* Set through the identifier, read through both interfaces */
+    port = 8334;
+    result = pSettings->SetSetting(
+        SETTING_ID_API_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    buffer = 0;
+    result = pSettings->GetSetting(
+        SETTING_ID_API_PORT,
+        (uint8_t*)&buffer,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(8334, buffer);
+
+    buffer = 0;
+    result = pSettings->GetSettings(
+        SETTING_API_PORT,
+        (uint8_t*)&buffer,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(8334, buffer);
+
+    /* Set through the name, read through the identifier */
+    port = 8335;
+    result = pSettings->SetSettings(
+        SETTING_API_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->GetSetting(
+        SETTING_ID_API_PORT,
+        (uint8_t*)&buffer,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(8335, buffer);
+
+    /* Invalid sizes and identifiers */
+    result = pSettings->GetSetting(
+        SETTING_ID_IS_AP,
+        (uint8_t*)&buffer,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::ERR_SETTING_NOT_FOUND, result);
+    result = pSettings->SetSetting(SETTING_ID_MAX, (uint8_t*)&isAP, 1);
+    TEST_ASSERT_EQUAL(E_Return::ERR_SETTING_INVALID, result);
+
+    /* Restore the default */
+    port = 8333;
+    result = pSettings->SetSetting(
+        SETTING_ID_API_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+}
+
+void test_memory(void) {
+    E_Return              result;
+    uint32_t              i;
+    S_SettingsMemoryStats stats;
+    Settings*             pSettings;
+    size_t                arenaUsed;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    /* Updates of the same size do not consume the arena */
+    i = 0;
+    result = pSettings->SetSettings("arena_val", (uint8_t*)&i, sizeof(i));
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pSettings->GetMemoryStats(&stats));
+    arenaUsed = stats.arenaUsed;
+    for (i = 0; 1000 > i; ++i) {
+        result = pSettings->SetSettings("arena_val", (uint8_t*)&i, sizeof(i));
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    }
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pSettings->GetMemoryStats(&stats));
+    TEST_ASSERT_EQUAL(arenaUsed, stats.arenaUsed);
+    TEST_ASSERT_LESS_OR_EQUAL(stats.arenaSize, stats.arenaUsed);
+    TEST_ASSERT_LESS_OR_EQUAL(stats.arenaUsed, stats.liveSize);
+
+    /* The arena is released at once */
+    result = pSettings->ClearCache();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pSettings->GetMemoryStats(&stats));
+    TEST_ASSERT_EQUAL(0, stats.arenaUsed);
+    TEST_ASSERT_EQUAL(0, stats.settingsCount);
+}
+
+static volatile bool sIsCommitDone;
+
+static void SettingsCommitRoutine(void* pParam) {
+    uint32_t  i;
+    uint16_t  port;
+    Settings* pSettings;
+
+    pSettings = (Settings*)pParam;
+    for (i = 0; 20 > i; ++i) {
+        port = 8000 + i;
+        pSettings->SetSettings("commit_u32", (uint8_t*)&i, sizeof(uint32_t));
+        pSettings->SetSetting(
+            SETTING_ID_WEB_PORT,
+            (uint8_t*)&port,
+            sizeof(uint16_t)
+        );
+        pSettings->Commit();
+    }
+
+    sIsCommitDone = true;
+    vTaskDelete(nullptr);
+}
+
+void test_snapshot_read(void) {
+    E_Return  result;
+    uint16_t  port;
+    uint32_t  reads;
+    Settings* pSettings;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    port = 80;
+    result = pSettings->SetSetting(
+        SETTING_ID_WEB_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    /* Reads never time out while commits hold the settings lock */
+    sIsCommitDone = false;
+    TEST_ASSERT_EQUAL(
+        pdPASS,
+        xTaskCreate(
+            SettingsCommitRoutine,
+            "TestCommit",
+            4096,
+            pSettings,
+            1,
+            nullptr
+        )
+    );
+
+    reads = 0;
+    while (!sIsCommitDone) {
+        result = pSettings->GetSetting(
+            SETTING_ID_WEB_PORT,
+            (uint8_t*)&port,
+            sizeof(uint16_t)
+        );
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+        TEST_ASSERT_TRUE(80 == port || (8000 <= port && 8020 > port));
+        ++reads;
+        if (0 == reads % 64) {
+            vTaskDelay(1);
+        }
+    }
+
+    /* Restore the default */
+    port = 80;
+    result = pSettings->SetSetting(
+        SETTING_ID_WEB_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pSettings->Commit());
+}
+
 void test_default(void) {
     E_Return  result;
     uint8_t   buffer;
@@ -162,6 +485,99 @@ void test_default(void) {
     result = pSettings->GetDefault("node_st_sdns", (uint8_t*)ipBuff, 15);
     TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
     TEST_ASSERT_EQUAL_STRING("4.4.4.4", ipBuff);
+
+    /* The identifiers read the same flash defaults */
+    result = pSettings->GetDefault(
+        SETTING_ID_NODE_SSID,
+        (uint8_t*)ssidBuff,
+        32
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL_STRING("RTHR_NODE", ssidBuff);
+    result = pSettings->GetDefault(
+        SETTING_ID_WEB_PORT,
+        (uint8_t*)&uint16Buff,
+        sizeof(uint8_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::ERR_SETTING_NOT_FOUND, result);
+    result = pSettings->GetDefault(SETTING_ID_MAX, &buffer, sizeof(uint8_t));
+    TEST_ASSERT_EQUAL(E_Return::ERR_SETTING_NOT_FOUND, result);
+}
+
+static uint32_t sNotifiedCount;
+static uint32_t sNotifiedIds;
+
+static void SettingsChangedCallback(const E_SettingId kId, void* pArgs) {
+    ++sNotifiedCount;
+    sNotifiedIds |= (1UL << kId);
+    TEST_ASSERT_EQUAL_PTR(&sNotifiedCount, pArgs);
+}
+
+void test_subscribe(void) {
+    E_Return  result;
+    uint16_t  port;
+    Settings* pSettings;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    result = pSettings->Subscribe(
+        SETTING_ID_API_PORT,
+        SettingsChangedCallback,
+        &sNotifiedCount
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->Subscribe(
+        SETTING_ID_MAX,
+        SettingsChangedCallback,
+        &sNotifiedCount
+    );
+    TEST_ASSERT_EQUAL(E_Return::ERR_SETTING_INVALID, result);
+
+    /* Changes are notified once, after the commit */
+    sNotifiedCount = 0;
+    sNotifiedIds   = 0;
+    port = 8336;
+    result = pSettings->SetSetting(
+        SETTING_ID_API_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(0, sNotifiedCount);
+    result = pSettings->Commit();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(1, sNotifiedCount);
+    TEST_ASSERT_EQUAL_HEX32(1UL << SETTING_ID_API_PORT, sNotifiedIds);
+
+    /* Setting the same value is not a change */
+    result = pSettings->SetSetting(
+        SETTING_ID_API_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->Commit();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(1, sNotifiedCount);
+
+    /* Unsubscribed settings are not notified */
+    result = pSettings->Unsubscribe(
+        SETTING_ID_API_PORT,
+        SettingsChangedCallback,
+        &sNotifiedCount
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    port = 8333;
+    result = pSettings->SetSetting(
+        SETTING_ID_API_PORT,
+        (uint8_t*)&port,
+        sizeof(uint16_t)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pSettings->Commit();
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    TEST_ASSERT_EQUAL(1, sNotifiedCount);
 }
 
 void SettingsTests(void) {
@@ -170,5 +586,12 @@ void SettingsTests(void) {
     RUN_TEST(test_invalid);
     RUN_TEST(test_clear);
     RUN_TEST(test_commit);
+    RUN_TEST(test_commit_sizes);
+    RUN_TEST(test_commit_oversized);
+    RUN_TEST(test_commit_compaction);
+    RUN_TEST(test_identified);
+    RUN_TEST(test_memory);
+    RUN_TEST(test_snapshot_read);
+    RUN_TEST(test_subscribe);
     RUN_TEST(test_default);
 }
\ No newline at end of file
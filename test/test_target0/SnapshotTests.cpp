@@ -0,0 +1,113 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <atomic>
+#include <Snapshot.h>
+#include <SystemState.h>
+
+/** @brief Number of fields of the test value, larger than a copy unit. */
+#define TEST_SNAPSHOT_FIELDS 32
+/** @brief Number of publications of the writer task. */
+#define TEST_SNAPSHOT_PUBLICATIONS 20000
+
+/** @brief Multi-field test value, all the fields hold the same counter. */
+typedef struct {
+    uint32_t pFields[TEST_SNAPSHOT_FIELDS];
+} S_TestSnapshotValue;
+
+static const S_TestSnapshotValue skInitial = {};
+static Snapshot<S_TestSnapshotValue>* spSnapshot = nullptr;
+static std::atomic<bool> sIsWriterDone(false);
+
+static void SnapshotWriter(void* pParam) {
+    S_TestSnapshotValue value;
+    uint32_t            i;
+    uint32_t            j;
+
+    (void)pParam;
+
+    for (i = 1; TEST_SNAPSHOT_PUBLICATIONS >= i; ++i) {
+        for (j = 0; TEST_SNAPSHOT_FIELDS > j; ++j) {
+            value.pFields[j] = i;
+        }
+        spSnapshot->Publish(value);
+    }
+    sIsWriterDone.store(true);
+    vTaskDelete(nullptr);
+}
+
+void test_snapshot_consistency(void) {
+    S_TestSnapshotValue value;
+    uint32_t            last;
+    uint32_t            reads;
+    uint32_t            j;
+
+    spSnapshot = new Snapshot<S_TestSnapshotValue>(skInitial);
+    TEST_ASSERT_NOT_NULL(spSnapshot);
+
+    TEST_ASSERT_TRUE(spSnapshot->Read(value));
+    TEST_ASSERT_EQUAL(0, value.pFields[0]);
+    TEST_ASSERT_EQUAL(0, spSnapshot->GetVersion());
+
+    /* The writer runs on the other core, the reads race the publications */
+    sIsWriterDone.store(false);
+    TEST_ASSERT_EQUAL(
+        pdPASS,
+        xTaskCreatePinnedToCore(
+            SnapshotWriter,
+            "SNAP_WRITER",
+            4096,
+            nullptr,
+            uxTaskPriorityGet(nullptr),
+            nullptr,
+            1 - xPortGetCoreID()
+        )
+    );
+
+    last = 0;
+    reads = 0;
+    while (!sIsWriterDone.load()) {
+        if (spSnapshot->Read(value)) {
+            for (j = 1; TEST_SNAPSHOT_FIELDS > j; ++j) {
+                TEST_ASSERT_EQUAL(value.pFields[0], value.pFields[j]);
+            }
+            /* Publications are never seen out of order */
+            TEST_ASSERT_GREATER_OR_EQUAL(last, value.pFields[0]);
+            last = value.pFields[0];
+            ++reads;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(0, reads);
+
+    TEST_ASSERT_TRUE(spSnapshot->Read(value));
+    TEST_ASSERT_EQUAL(TEST_SNAPSHOT_PUBLICATIONS, value.pFields[0]);
+    TEST_ASSERT_EQUAL(TEST_SNAPSHOT_PUBLICATIONS, spSnapshot->GetVersion());
+
+    delete spSnapshot;
+    spSnapshot = nullptr;
+}
+
+void test_snapshot_live_state(void) {
+    S_LiveReadings readings = {};
+    S_LiveState    state;
+    SystemState*   pState;
+    uint32_t       version;
+
+    pState = SystemState::GetInstance();
+    TEST_ASSERT_TRUE(pState->GetLiveState(state));
+    version = state.readingsVersion;
+
+    readings.time = 1234;
+    readings.count = 1;
+    readings.pReadings[0].value = 21.5f;
+    pState->PublishReadings(readings);
+
+    TEST_ASSERT_TRUE(pState->GetLiveState(state));
+    TEST_ASSERT_EQUAL(version + 1, state.readingsVersion);
+    TEST_ASSERT_EQUAL(1, state.readings.count);
+    TEST_ASSERT_EQUAL_FLOAT(21.5f, state.readings.pReadings[0].value);
+}
+
+void SnapshotTests(void) {
+    RUN_TEST(test_snapshot_consistency);
+    RUN_TEST(test_snapshot_live_state);
+}
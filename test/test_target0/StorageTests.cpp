@@ -0,0 +1,281 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <Storage.h>
+#include <SystemState.h>
+#include <algorithm>
+
+/** @brief Benchmark file path. */
+#define BENCH_FILE_PATH "rthr_bench"
+/** @brief Sequential benchmark total size in bytes. */
+#define BENCH_SEQ_SIZE (256 * 1024)
+/** @brief Sequential benchmark transfer size in bytes. */
+#define BENCH_SEQ_CHUNK 4096
+/** @brief Random read benchmark transfer size in bytes. */
+#define BENCH_RAND_CHUNK 512
+/** @brief Small append benchmark transfer size in bytes. */
+#define BENCH_APPEND_SIZE 64
+/** @brief Number of samples of the latency benchmarks. */
+#define BENCH_SAMPLES 100
+
+static uint8_t sBenchBuffer[BENCH_SEQ_CHUNK];
+static uint64_t sSamples[BENCH_SAMPLES];
+
+static Storage* GetStorage(void) {
+    return SystemState::GetInstance()->GetStorage();
+}
+
+static void ReportThroughput(const char* pkName,
+                             const size_t kSize,
+                             const uint64_t kTimeNs) {
+    char     pMessage[128];
+    uint64_t rate;
+
+    /* Hundredths of MB/s */
+    rate = (uint64_t)kSize * 100000000000ULL / (kTimeNs + 1) / (1024 * 1024);
+
+    snprintf(
+        pMessage,
+        sizeof(pMessage),
+        "%s: %lu bytes in %lu us, %lu.%02lu MB/s",
+        pkName,
+        (unsigned long)kSize,
+        (unsigned long)(kTimeNs / 1000),
+        (unsigned long)(rate / 100),
+        (unsigned long)(rate % 100)
+    );
+    TEST_MESSAGE(pMessage);
+}
+
+static void ReportLatency(const char* pkName) {
+    char     pMessage[128];
+    uint64_t total;
+    uint32_t i;
+
+    total = 0;
+    for (i = 0; i < BENCH_SAMPLES; ++i) {
+        total += sSamples[i];
+    }
+    std::sort(sSamples, sSamples + BENCH_SAMPLES);
+
+    snprintf(
+        pMessage,
+        sizeof(pMessage),
+        "%s: avg %lu us, p50 %lu us, p99 %lu us, max %lu us",
+        pkName,
+        (unsigned long)(total / BENCH_SAMPLES / 1000),
+        (unsigned long)(sSamples[BENCH_SAMPLES / 2] / 1000),
+        (unsigned long)(sSamples[(BENCH_SAMPLES * 99) / 100 - 1] / 1000),
+        (unsigned long)(sSamples[BENCH_SAMPLES - 1] / 1000)
+    );
+    TEST_MESSAGE(pMessage);
+}
+
+void test_storage_seq_write() {
+    FsFile   file;
+    uint64_t time;
+    size_t   i;
+    bool     isOpen;
+    bool     isValid;
+
+    GetStorage()->Remove(BENCH_FILE_PATH);
+    memset(sBenchBuffer, 0xA5, sizeof(sBenchBuffer));
+
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        GetStorage()->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)
+    );
+    file = GetStorage()->Open(BENCH_FILE_PATH, O_RDWR | O_CREAT);
+    isOpen = file.isOpen();
+
+    /* Nothing is asserted while the bus is held */
+    isValid = isOpen;
+    time = HWManager::GetTime();
+    for (i = 0; isValid && i < BENCH_SEQ_SIZE; i += BENCH_SEQ_CHUNK) {
+        isValid = BENCH_SEQ_CHUNK == file.write(sBenchBuffer, BENCH_SEQ_CHUNK);
+    }
+    isValid = isValid && file.sync();
+    time = HWManager::GetTime() - time;
+    file.close();
+    GetStorage()->ReleaseSPIBus();
+
+    TEST_ASSERT_TRUE(isOpen);
+    TEST_ASSERT_TRUE(isValid);
+
+    ReportThroughput("Sequential write", BENCH_SEQ_SIZE, time);
+}
+
+void test_storage_seq_read() {
+    FsFile   file;
+    uint64_t time;
+    size_t   i;
+    bool     isOpen;
+    bool     isValid;
+
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        GetStorage()->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)
+    );
+    file = GetStorage()->Open(BENCH_FILE_PATH, O_RDONLY);
+    isOpen = file.isOpen();
+
+    isValid = isOpen;
+    time = HWManager::GetTime();
+    for (i = 0; isValid && i < BENCH_SEQ_SIZE; i += BENCH_SEQ_CHUNK) {
+        isValid = BENCH_SEQ_CHUNK == file.read(sBenchBuffer, BENCH_SEQ_CHUNK);
+    }
+    time = HWManager::GetTime() - time;
+    file.close();
+    GetStorage()->ReleaseSPIBus();
+
+    TEST_ASSERT_TRUE(isOpen);
+    TEST_ASSERT_TRUE(isValid);
+    TEST_ASSERT_EQUAL_HEX8(0xA5, sBenchBuffer[BENCH_SEQ_CHUNK - 1]);
+    ReportThroughput("Sequential read", BENCH_SEQ_SIZE, time);
+}
+
+void test_storage_rand_read() {
+    FsFile   file;
+    uint64_t time;
+    uint32_t offset;
+    uint32_t i;
+    bool     isOpen;
+    bool     isValid;
+
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        GetStorage()->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)
+    );
+    file = GetStorage()->Open(BENCH_FILE_PATH, O_RDONLY);
+    isOpen = file.isOpen();
+
+    isValid = isOpen;
+    for (i = 0; isValid && i < BENCH_SAMPLES; ++i) {
+        offset = (esp_random() % (BENCH_SEQ_SIZE / BENCH_RAND_CHUNK)) *
+                 BENCH_RAND_CHUNK;
+
+        time = HWManager::GetTime();
+        isValid = file.seek(offset) &&
+                  BENCH_RAND_CHUNK ==
+                      file.read(sBenchBuffer, BENCH_RAND_CHUNK);
+        sSamples[i] = HWManager::GetTime() - time;
+    }
+    file.close();
+    GetStorage()->ReleaseSPIBus();
+
+    TEST_ASSERT_TRUE(isOpen);
+    TEST_ASSERT_TRUE(isValid);
+    ReportLatency("Random read 512B");
+}
+
+void test_storage_rand_write() {
+    FsFile   file;
+    uint64_t time;
+    uint32_t offset;
+    uint32_t i;
+    bool     isOpen;
+    bool     isValid;
+
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        GetStorage()->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)
+    );
+    file = GetStorage()->Open(BENCH_FILE_PATH, O_RDWR);
+    isOpen = file.isOpen();
+
+    isValid = isOpen;
+    for (i = 0; isValid && i < BENCH_SAMPLES; ++i) {
+        offset = (esp_random() % (BENCH_SEQ_SIZE / BENCH_RAND_CHUNK)) *
+                 BENCH_RAND_CHUNK;
+
+        time = HWManager::GetTime();
+        isValid = file.seek(offset) &&
+                  BENCH_RAND_CHUNK ==
+                      file.write(sBenchBuffer, BENCH_RAND_CHUNK);
+        isValid = isValid && file.sync();
+        sSamples[i] = HWManager::GetTime() - time;
+    }
+    file.close();
+    GetStorage()->ReleaseSPIBus();
+
+    TEST_ASSERT_TRUE(isOpen);
+    TEST_ASSERT_TRUE(isValid);
+    ReportLatency("Random write 512B");
+}
+
+void test_storage_append() {
+    FsFile   file;
+    uint64_t time;
+    uint32_t i;
+    bool     isOpen;
+    bool     isValid;
+
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        GetStorage()->AcquireSPIBus(STORAGE_BUS_TIMEOUT_NS)
+    );
+    file = GetStorage()->Open(BENCH_FILE_PATH, O_RDWR | O_APPEND);
+    isOpen = file.isOpen();
+
+    isValid = isOpen;
+    for (i = 0; isValid && i < BENCH_SAMPLES; ++i) {
+        time = HWManager::GetTime();
+        isValid = BENCH_APPEND_SIZE ==
+                      file.write(sBenchBuffer, BENCH_APPEND_SIZE) &&
+                  file.sync();
+        sSamples[i] = HWManager::GetTime() - time;
+    }
+    file.close();
+    GetStorage()->ReleaseSPIBus();
+
+    TEST_ASSERT_TRUE(isOpen);
+    TEST_ASSERT_TRUE(isValid);
+
+    ReportLatency("Append 64B + sync");
+}
+
+void test_storage_open_close() {
+    FsFile   file;
+    uint64_t time;
+    uint32_t i;
+
+    for (i = 0; i < BENCH_SAMPLES; ++i) {
+        time = HWManager::GetTime();
+        file = GetStorage()->Open(BENCH_FILE_PATH, O_RDONLY);
+        TEST_ASSERT_TRUE(file.isOpen());
+        file.close();
+        sSamples[i] = HWManager::GetTime() - time;
+    }
+
+    TEST_ASSERT_TRUE(GetStorage()->Remove(BENCH_FILE_PATH));
+
+    ReportLatency("Open / close");
+}
+
+void test_storage_bus_arbitration() {
+    Storage* pStorage;
+
+    pStorage = GetStorage();
+
+    /* The bus lock is recursive */
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pStorage->AcquireSPIBus(0));
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pStorage->AcquireSPIBus(0));
+    pStorage->ReleaseSPIBus();
+    pStorage->ReleaseSPIBus();
+
+    /* The storage is usable after the bus was granted */
+    TEST_ASSERT_TRUE(pStorage->Open(BENCH_FILE_PATH, O_RDWR | O_CREAT).isOpen());
+    TEST_ASSERT_TRUE(pStorage->Remove(BENCH_FILE_PATH));
+}
+
+void StorageTests(void) {
+
+    RUN_TEST(test_storage_bus_arbitration);
+    RUN_TEST(test_storage_seq_write);
+    RUN_TEST(test_storage_seq_read);
+    RUN_TEST(test_storage_rand_read);
+    RUN_TEST(test_storage_rand_write);
+    RUN_TEST(test_storage_append);
+    RUN_TEST(test_storage_open_close);
+
+}
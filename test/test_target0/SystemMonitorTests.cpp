@@ -0,0 +1,55 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <Errors.h>
+#include <SystemState.h>
+#include <SystemMonitor.h>
+
+void test_system_monitor_sample(void) {
+    SystemMonitor* pMonitor;
+    S_SysMonSample sample;
+    uint32_t       i;
+
+    /* The monitor is never destroyed, it may exist from a previous run */
+    pMonitor = SystemState::GetInstance()->GetSystemMonitor();
+    if (nullptr == pMonitor) {
+        pMonitor = new SystemMonitor();
+        TEST_ASSERT_NOT_NULL(pMonitor);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pMonitor->Start());
+    }
+    TEST_ASSERT_EQUAL_PTR(
+        pMonitor,
+        SystemState::GetInstance()->GetSystemMonitor()
+    );
+
+    /* Two samples give the usage over a whole period */
+    delay(2 * SYSMON_PERIOD_NS / 1000000ULL + 100);
+    TEST_ASSERT_GREATER_OR_EQUAL(2, pMonitor->GetSampleCount());
+    TEST_ASSERT_TRUE(pMonitor->GetLatest(sample));
+    TEST_ASSERT_FALSE(pMonitor->GetSample(SYSMON_WINDOW_SAMPLES, sample));
+
+    TEST_ASSERT_LESS_OR_EQUAL(sample.internalFree, sample.internalLargest);
+    TEST_ASSERT_LESS_OR_EQUAL(sample.psramFree, sample.psramLargest);
+    TEST_ASSERT_LESS_OR_EQUAL(sample.socketsMax, sample.socketsUsed);
+    for (i = 0; portNUM_PROCESSORS > i; ++i) {
+        TEST_ASSERT_LESS_OR_EQUAL(1000, sample.pCoreLoad[i]);
+    }
+
+    /* The tasks are sorted by decreasing usage */
+    TEST_ASSERT_GREATER_THAN(0, sample.taskCount);
+    TEST_ASSERT_LESS_OR_EQUAL(SYSMON_MAX_TASKS, sample.taskCount);
+    for (i = 0; sample.taskCount > i; ++i) {
+        TEST_ASSERT_NOT_EQUAL(0, sample.pTasks[i].pName[0]);
+        TEST_ASSERT_GREATER_THAN(0, sample.pTasks[i].stackFree);
+        TEST_ASSERT_LESS_OR_EQUAL(1000, sample.pTasks[i].cpuPermille);
+        if (0 < i) {
+            TEST_ASSERT_LESS_OR_EQUAL(
+                sample.pTasks[i - 1].cpuPermille,
+                sample.pTasks[i].cpuPermille
+            );
+        }
+    }
+}
+
+void SystemMonitorTests(void) {
+    RUN_TEST(test_system_monitor_sample);
+}
@@ -0,0 +1,269 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <Errors.h>
+#include <Sensor.h>
+#include <TSDBBlock.h>
+#include <TSDBRollup.h>
+#include <TimeSeriesStore.h>
+
+/** @brief Series used by the tests, not produced by any sensor. */
+#define TEST_TSDB_SERIES 0xFFF0
+
+/** @brief Number of points of the store test. */
+#define TEST_TSDB_POINTS 1000
+
+/** @brief Stores the time series store, only one can exist. */
+static TimeSeriesStore* spStore = nullptr;
+
+static int64_t GetTestTime(const uint32_t kIndex) {
+    /* One second period with a few milliseconds of jitter */
+    return 1000000 + (int64_t)kIndex * 1000 + (kIndex % 3);
+}
+
+static float GetTestValue(const uint32_t kIndex) {
+    return 20.0f + (float)(kIndex % 50) * 0.01f;
+}
+
+void test_tsdb_block_codec(void) {
+    uint8_t     pBlock[TSDB_BLOCK_SIZE];
+    uint8_t     pCopy[TSDB_BLOCK_SIZE];
+    S_TSDBCodec codec;
+    E_Return    error;
+    uint32_t    count;
+    uint32_t    i;
+    int64_t     time;
+    float       value;
+
+    /* Fill a block */
+    TSDBBlock::Create(pBlock, codec);
+    count = 0;
+    do {
+        error = TSDBBlock::Append(
+            codec,
+            GetTestTime(count),
+            GetTestValue(count)
+        );
+        if (E_Return::NO_ERROR == error) {
+            ++count;
+        }
+    } while (E_Return::NO_ERROR == error);
+    TEST_ASSERT_EQUAL(E_Return::ERR_TSDB_BLOCK_FULL, error);
+
+    /* At least 4x smaller than the samples of the ring */
+    TEST_ASSERT_GREATER_THAN(
+        4 * TSDB_BLOCK_SIZE / sizeof(S_SensorSample),
+        count
+    );
+
+    /* Older points are refused */
+    TSDBBlock::Create(pCopy, codec);
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        TSDBBlock::Append(codec, 1000, 1.0f)
+    );
+    TEST_ASSERT_EQUAL(
+        E_Return::ERR_INVALID_PARAM,
+        TSDBBlock::Append(codec, 999, 1.0f)
+    );
+
+    /* Decode */
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, TSDBBlock::Open(pBlock, codec));
+    for (i = 0; count > i; ++i) {
+        TEST_ASSERT_TRUE(TSDBBlock::Next(codec, time, value));
+        TEST_ASSERT_EQUAL_INT64(GetTestTime(i), time);
+        TEST_ASSERT_EQUAL_FLOAT(GetTestValue(i), value);
+    }
+    TEST_ASSERT_FALSE(TSDBBlock::Next(codec, time, value));
+
+    /* Resume a partial block */
+    TSDBBlock::Create(pCopy, codec);
+    for (i = 0; 10 > i; ++i) {
+        TSDBBlock::Append(codec, GetTestTime(i), GetTestValue(i));
+    }
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, TSDBBlock::Resume(pCopy, codec));
+    for (i = 10; 20 > i; ++i) {
+        TEST_ASSERT_EQUAL(
+            E_Return::NO_ERROR,
+            TSDBBlock::Append(codec, GetTestTime(i), GetTestValue(i))
+        );
+    }
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, TSDBBlock::Open(pCopy, codec));
+    for (i = 0; 20 > i; ++i) {
+        TEST_ASSERT_TRUE(TSDBBlock::Next(codec, time, value));
+        TEST_ASSERT_EQUAL_INT64(GetTestTime(i), time);
+        TEST_ASSERT_EQUAL_FLOAT(GetTestValue(i), value);
+    }
+
+    /* Corrupted block */
+    pCopy[0] = 0;
+    TEST_ASSERT_EQUAL(
+        E_Return::ERR_TSDB_INVALID_BLOCK,
+        TSDBBlock::Open(pCopy, codec)
+    );
+}
+
+void test_tsdb_store_range(void) {
+    S_TSDBCursor* pCursor;
+    S_TSDBStats   stats;
+    uint32_t      i;
+    uint32_t      count;
+    int64_t       time;
+    float         value;
+
+    if (nullptr == spStore) {
+        spStore = new TimeSeriesStore();
+    }
+    TEST_ASSERT_NOT_NULL(spStore);
+    pCursor = new S_TSDBCursor;
+    TEST_ASSERT_NOT_NULL(pCursor);
+
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        spStore->RemoveSeries(TEST_TSDB_SERIES)
+    );
+    TEST_ASSERT_EQUAL(
+        E_Return::ERR_NO_SUCH_ID,
+        spStore->OpenCursor(TEST_TSDB_SERIES, 0, INT64_MAX, *pCursor)
+    );
+
+    for (i = 0; TEST_TSDB_POINTS > i; ++i) {
+        TEST_ASSERT_EQUAL(
+            E_Return::NO_ERROR,
+            spStore->Append(TEST_TSDB_SERIES, GetTestTime(i), GetTestValue(i))
+        );
+    }
+    spStore->GetStats(stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.blocks);
+
+    /* Whole series, sealed blocks and open block */
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        spStore->OpenCursor(TEST_TSDB_SERIES, 0, INT64_MAX, *pCursor)
+    );
+    count = 0;
+    while (spStore->ReadCursor(*pCursor, time, value)) {
+        TEST_ASSERT_EQUAL_INT64(GetTestTime(count), time);
+        TEST_ASSERT_EQUAL_FLOAT(GetTestValue(count), value);
+        ++count;
+    }
+    TEST_ASSERT_EQUAL(TEST_TSDB_POINTS, count);
+
+    /* Range in the middle, written on the card */
+    spStore->Flush();
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        spStore->OpenCursor(
+            TEST_TSDB_SERIES,
+            GetTestTime(400),
+            GetTestTime(700),
+            *pCursor
+        )
+    );
+    count = 400;
+    while (spStore->ReadCursor(*pCursor, time, value)) {
+        TEST_ASSERT_EQUAL_INT64(GetTestTime(count), time);
+        ++count;
+    }
+    TEST_ASSERT_EQUAL(701, count);
+
+    /* Empty and invalid ranges */
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        spStore->OpenCursor(
+            TEST_TSDB_SERIES,
+            GetTestTime(TEST_TSDB_POINTS) + 1,
+            INT64_MAX,
+            *pCursor
+        )
+    );
+    TEST_ASSERT_FALSE(spStore->ReadCursor(*pCursor, time, value));
+    TEST_ASSERT_EQUAL(
+        E_Return::ERR_INVALID_PARAM,
+        spStore->OpenCursor(TEST_TSDB_SERIES, 10, 0, *pCursor)
+    );
+
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        spStore->RemoveSeries(TEST_TSDB_SERIES)
+    );
+    delete pCursor;
+}
+
+void test_tsdb_rollup(void) {
+    S_TSDBRollupState state;
+    S_TSDBBucket      closed;
+    S_TSDBBucket*     pMinute;
+    uint32_t          i;
+    uint32_t          closedCount;
+
+    TSDBRollup::Init(state, 0x12);
+    pMinute = &state.pBuckets[E_TSDBTier::TSDB_TIER_MINUTE];
+
+    /* One point per second over three minutes */
+    closedCount = 0;
+    for (i = 0; 180 > i; ++i) {
+        if (TSDBRollup::Add(*pMinute,
+                            E_TSDBTier::TSDB_TIER_MINUTE,
+                            120000 + (int64_t)i * 1000,
+                            (float)(i % 60),
+                            closed)) {
+            ++closedCount;
+            TEST_ASSERT_EQUAL(60, closed.count);
+            TEST_ASSERT_EQUAL_INT64(120000 + (closedCount - 1) * 60000,
+                                    closed.start);
+            TEST_ASSERT_EQUAL_FLOAT(
+                0.0f,
+                TSDBRollup::GetAggregate(closed, E_TSDBAggregate::TSDB_AGG_MIN)
+            );
+            TEST_ASSERT_EQUAL_FLOAT(
+                59.0f,
+                TSDBRollup::GetAggregate(closed, E_TSDBAggregate::TSDB_AGG_MAX)
+            );
+            TEST_ASSERT_EQUAL_FLOAT(
+                29.5f,
+                TSDBRollup::GetAggregate(closed, E_TSDBAggregate::TSDB_AGG_AVG)
+            );
+        }
+    }
+    /* The last bucket stays open */
+    TEST_ASSERT_EQUAL(2, closedCount);
+    TEST_ASSERT_EQUAL(60, pMinute->count);
+
+    /* Rollup series do not collide with the raw series */
+    TEST_ASSERT_NOT_EQUAL(
+        0x12,
+        TSDB_ROLLUP_ID(0x12, E_TSDBTier::TSDB_TIER_MINUTE, TSDB_AGG_AVG)
+    );
+    TEST_ASSERT_EQUAL(
+        E_TSDBTier::TSDB_TIER_HOUR,
+        TSDB_SERIES_TIER(
+            TSDB_ROLLUP_ID(0x12, E_TSDBTier::TSDB_TIER_HOUR, TSDB_AGG_MAX)
+        )
+    );
+
+    /* Coarsest tier matching the resolution */
+    TEST_ASSERT_EQUAL(
+        E_TSDBTier::TSDB_TIER_RAW,
+        TSDBRollup::SelectTier(1000, 0, 0)
+    );
+    TEST_ASSERT_EQUAL(
+        E_TSDBTier::TSDB_TIER_MINUTE,
+        TSDBRollup::SelectTier(300000, 0, 0)
+    );
+    TEST_ASSERT_EQUAL(
+        E_TSDBTier::TSDB_TIER_DAY,
+        TSDBRollup::SelectTier(7 * 86400000LL, 0, 0)
+    );
+
+    /* Past the raw retention, the minute tier is used */
+    TEST_ASSERT_EQUAL(
+        E_TSDBTier::TSDB_TIER_MINUTE,
+        TSDBRollup::SelectTier(1000, 0, TSDB_RETENTION_RAW_MS + 1)
+    );
+}
+
+void TimeSeriesTests(void) {
+    RUN_TEST(test_tsdb_block_codec);
+    RUN_TEST(test_tsdb_store_range);
+    RUN_TEST(test_tsdb_rollup);
+}
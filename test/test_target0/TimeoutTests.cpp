@@ -3,6 +3,7 @@
 #include <Timeout.h>
 #include <BSP.h>
 #include <Errors.h>
+#include <cstring>
 
 static volatile uint32_t valueHandle = 55;
 
@@ -62,8 +63,121 @@ void test_timeout_destroy(void) {
     TEST_ASSERT_EQUAL_UINT32(55, valueHandle);
 }
 
+static bool GetTestStats(const char* pkName, S_TimeoutStats* pStats) {
+    uint32_t i;
+    bool     isFound;
+
+    isFound = false;
+    for (i = 0; i < TIMEOUT_STATS_MAX && !isFound; ++i) {
+        isFound = Timeout::GetStats(i, pStats) &&
+                  0 == strcmp(pkName, pStats->pName);
+    }
+
+    return isFound;
+}
+
+void test_timeout_stats(void) {
+    S_TimeoutStats stats;
+    uint32_t       jitterCount;
+    uint32_t       i;
+
+    {
+        Timeout timeout(15000000);
+
+        TEST_ASSERT_EQUAL(
+            E_Return::NO_ERROR,
+            timeout.EnableStats("TEST_STATS", 10000000)
+        );
+
+        for (i = 0; i < 50; ++i) {
+            timeout.Notify();
+            HWManager::DelayExecNs(1000000);
+            timeout.NotifyEnd();
+            HWManager::DelayExecNs(9000000);
+        }
+        HWManager::DelayExecNs(20000000);
+        timeout.Notify();
+
+        TEST_ASSERT_TRUE(GetTestStats("TEST_STATS", &stats));
+        TEST_ASSERT_EQUAL_UINT32(50, stats.period.count);
+        TEST_ASSERT_EQUAL_UINT32(50, stats.execution.count);
+        TEST_ASSERT_EQUAL_UINT32(1, stats.overruns);
+        TEST_ASSERT_GREATER_OR_EQUAL(10000000, stats.period.minNs);
+        TEST_ASSERT_GREATER_OR_EQUAL(30000000, stats.period.maxNs);
+        TEST_ASSERT_GREATER_OR_EQUAL(1000000, stats.execution.minNs);
+        TEST_ASSERT_LESS_THAN(2000000, Timeout::GetPercentile(stats.execution, 50));
+        TEST_ASSERT_LESS_THAN(13000000, Timeout::GetPercentile(stats.period, 50));
+        TEST_ASSERT_LESS_THAN(3000000, Timeout::GetPercentile(stats.jitter, 50));
+
+        /* Event wakes before the wake deadline are not jitter */
+        jitterCount = stats.jitter.count;
+        timeout.SetWakeDeadline(HWManager::GetTime() + 100000000);
+        timeout.Notify();
+        TEST_ASSERT_TRUE(GetTestStats("TEST_STATS", &stats));
+        TEST_ASSERT_EQUAL_UINT32(51, stats.period.count);
+        TEST_ASSERT_EQUAL_UINT32(jitterCount, stats.jitter.count);
+    }
+
+    /* Destroyed timeouts are no longer listed */
+    TEST_ASSERT_FALSE(GetTestStats("TEST_STATS", &stats));
+}
+
+void test_timeout_time_snapshot(void) {
+    Timeout  timeout(100000000);
+    uint64_t tickTime;
+    uint64_t time;
+    uint32_t cycles;
+
+    /* The passed time is used instead of reading it again */
+    time = HWManager::GetTime();
+    timeout.Notify(time);
+    TEST_ASSERT_EQUAL(false, timeout.HasTimedOut(time + 100000000));
+    TEST_ASSERT_EQUAL(true, timeout.HasTimedOut(time + 100000001));
+
+    /* The tick snapshot is at most a tick late and cached during the tick */
+    vTaskDelay(1);
+    tickTime = HWManager::GetTickTime();
+    time = HWManager::GetTime();
+    TEST_ASSERT_GREATER_OR_EQUAL(tickTime, time);
+    TEST_ASSERT_LESS_THAN(portTICK_PERIOD_MS * 1000000ULL, time - tickTime);
+    time = HWManager::GetTickTime();
+    TEST_ASSERT_GREATER_OR_EQUAL(tickTime, time);
+    TEST_ASSERT_LESS_THAN(portTICK_PERIOD_MS * 1000000ULL, time - tickTime);
+
+    /* The cycle counter matches the time for sub-millisecond waits */
+    cycles = HWManager::GetCycleCount();
+    HWManager::DelayExecNs(100000);
+    time = HWManager::CyclesToNs(HWManager::GetCycleCount() - cycles);
+    TEST_ASSERT_GREATER_OR_EQUAL(100000, time);
+    TEST_ASSERT_LESS_THAN(200000, time);
+}
+
+void test_timeout_delay_sleep(void) {
+    uint64_t busyWait;
+    uint64_t time;
+
+    /* Long delays sleep and only spin for the last partial tick */
+    busyWait = HWManager::GetBusyWaitTime();
+    time = HWManager::GetTime();
+    HWManager::DelayExecNs(10000000);
+    time = HWManager::GetTime() - time;
+    busyWait = HWManager::GetBusyWaitTime() - busyWait;
+    TEST_ASSERT_GREATER_OR_EQUAL(10000000, time);
+    TEST_ASSERT_LESS_THAN(10500000, time);
+    TEST_ASSERT_LESS_THAN(1000000, busyWait);
+
+    /* Short delays spin entirely */
+    busyWait = HWManager::GetBusyWaitTime();
+    HWManager::DelayExecNs(50000);
+    busyWait = HWManager::GetBusyWaitTime() - busyWait;
+    TEST_ASSERT_GREATER_OR_EQUAL(40000, busyWait);
+}
+
 void TimeoutTests(void) {
     RUN_TEST(test_timeout_base);
     RUN_TEST(test_timeout_destroy);
     RUN_TEST(test_timeout_wd);
+    RUN_TEST(test_timeout_stats);
+    RUN_TEST(test_timeout_time_snapshot);
+    RUN_TEST(test_timeout_delay_sleep);
 }
\ No newline at end of file
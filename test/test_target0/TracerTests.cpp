@@ -0,0 +1,89 @@
+#include <Tracer.h>
+#include <HAL.h>
+#include <unity.h>
+#include <cstring>
+
+/** @brief The export of the tests, too large for the test task stack. */
+static S_TraceExport sExport;
+
+void test_tracer_record(void) {
+    S_TraceCursor cursor;
+    S_TraceEvent  event;
+    uintptr_t     task;
+    uint32_t      begins;
+    uint32_t      ends;
+
+    task = (uintptr_t)HAL::GetCurrentTask();
+
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, Tracer::Start());
+    TEST_ASSERT_TRUE(Tracer::IsStarted());
+    TRACE_BEGIN(E_TraceEvent::TRACE_WEB_PAGE);
+    TRACE_END(E_TraceEvent::TRACE_WEB_PAGE);
+    Tracer::Stop();
+    TEST_ASSERT_FALSE(Tracer::IsStarted());
+
+    /* A stopped tracer records nothing */
+    TRACE_BEGIN(E_TraceEvent::TRACE_WEB_PAGE);
+
+    /* The other tasks of the test firmware are traced too */
+    begins = 0;
+    ends = 0;
+    Tracer::OpenCursor(cursor);
+    while (Tracer::ReadCursor(cursor, event)) {
+        if (task == event.task &&
+            E_TraceEvent::TRACE_WEB_PAGE == event.event) {
+            if (E_TracePhase::TRACE_PHASE_BEGIN == event.phase) {
+                ++begins;
+            }
+            else {
+                ++ends;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(1, begins);
+    TEST_ASSERT_EQUAL(1, ends);
+    TEST_ASSERT_EQUAL(0, cursor.lost);
+}
+
+void test_tracer_export(void) {
+    char   pBuffer[TRACE_ITEM_SIZE * 2];
+    char   pLast[TRACE_ITEM_SIZE * 2 + 1];
+    size_t size;
+    size_t lastSize;
+    bool   isFirst;
+
+    /* The document starts with the header and ends with the footer */
+    isFirst = true;
+    lastSize = 0;
+    Tracer::OpenExport(sExport);
+    do {
+        size = Tracer::ReadExport(sExport, pBuffer, sizeof(pBuffer));
+        TEST_ASSERT_TRUE(sizeof(pBuffer) >= size);
+        if (isFirst) {
+            TEST_ASSERT_NOT_EQUAL(0, size);
+            TEST_ASSERT_EQUAL(0, memcmp(pBuffer, "{\"displayTimeUnit\"", 18));
+            isFirst = false;
+        }
+        if (0 != size) {
+            memcpy(pLast, pBuffer, size);
+            lastSize = size;
+        }
+    } while (0 != size);
+    pLast[lastSize] = 0;
+    TEST_ASSERT_NOT_NULL(strstr(pLast, "],\"otherData\":{\"lost\":"));
+    TEST_ASSERT_EQUAL('}', pLast[lastSize - 1]);
+
+    TEST_ASSERT_EQUAL_STRING(
+        "web_page",
+        Tracer::GetName(E_TraceEvent::TRACE_WEB_PAGE)
+    );
+    TEST_ASSERT_EQUAL_STRING(
+        "unknown",
+        Tracer::GetName(E_TraceEvent::TRACE_EVENT_COUNT)
+    );
+}
+
+void TracerTests(void) {
+    RUN_TEST(test_tracer_record);
+    RUN_TEST(test_tracer_export);
+}
@@ -1,6 +1,7 @@
 #include <WiFiValidator.h>
 #include <unity.h>
 #include <iostream>
+#include <cstring>
 
 void TestSwitches(void) {
     S_WiFiConfigRequest config;
@@ -848,6 +849,57 @@ void TestPort(void) {
     TEST_ASSERT_EQUAL(WiFiValidator::ValidatePorts(config), true);
 }
 
+void TestParseIp(void) {
+    ip4_addr_t address;
+    ip4_addr_t expected;
+
+    /* The nibles are parsed in order */
+    TEST_ASSERT_EQUAL(WiFiValidator::ParseIp("192.168.1.254", address), true);
+    IP4_ADDR(&expected, 192, 168, 1, 254);
+    TEST_ASSERT_EQUAL(expected.addr, address.addr);
+
+    TEST_ASSERT_EQUAL(WiFiValidator::ParseIp("0.0.0.0", address), true);
+    TEST_ASSERT_EQUAL(0, address.addr);
+
+    /* Invalid addresses leave the output untouched */
+    TEST_ASSERT_EQUAL(WiFiValidator::ParseIp("1.2.3.256", address), false);
+    TEST_ASSERT_EQUAL(WiFiValidator::ParseIp("1.2.3", address), false);
+    TEST_ASSERT_EQUAL(WiFiValidator::ParseIp("1.2.3.4.", address), false);
+    TEST_ASSERT_EQUAL(WiFiValidator::ParseIp("1.2.a.4", address), false);
+    TEST_ASSERT_EQUAL(WiFiValidator::ParseIp("", address), false);
+    TEST_ASSERT_EQUAL(0, address.addr);
+}
+
+void TestHash(void) {
+    S_WiFiParsedConfig first;
+    S_WiFiParsedConfig second;
+
+    memset(&first, 0, sizeof(first));
+    memset(&second, 0, sizeof(second));
+    strcpy(first.ssid, "network");
+    strcpy(second.ssid, "network");
+    TEST_ASSERT_EQUAL(
+        WiFiValidator::ParseIp("10.0.0.1", first.pAddresses[0]),
+        true
+    );
+    TEST_ASSERT_EQUAL(
+        WiFiValidator::ParseIp("010.000.000.001", second.pAddresses[0]),
+        true
+    );
+
+    /* The equivalent addresses have the same binary form */
+    TEST_ASSERT_EQUAL(
+        WiFiValidator::Hash(first),
+        WiFiValidator::Hash(second)
+    );
+
+    second.webPort = 8080;
+    TEST_ASSERT_NOT_EQUAL(
+        WiFiValidator::Hash(first),
+        WiFiValidator::Hash(second)
+    );
+}
+
 void ValidatorTest(void) {
     RUN_TEST(TestSwitches);
     RUN_TEST(TestSSID);
@@ -857,4 +909,6 @@ void ValidatorTest(void) {
     RUN_TEST(TestSubnet);
     RUN_TEST(TestDNS);
     RUN_TEST(TestPort);
+    RUN_TEST(TestParseIp);
+    RUN_TEST(TestHash);
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include <WiFiPower.h>
+#include <unity.h>
+
+void test_wifi_power_listen_interval(void) {
+    /* Budgets shorter than a beacon interval never sleep */
+    TEST_ASSERT_EQUAL(0, WiFiPower::GetListenInterval(0));
+    TEST_ASSERT_EQUAL(0, WiFiPower::GetListenInterval(100));
+
+    TEST_ASSERT_EQUAL(1, WiFiPower::GetListenInterval(103));
+    TEST_ASSERT_EQUAL(2, WiFiPower::GetListenInterval(300));
+    TEST_ASSERT_EQUAL(9, WiFiPower::GetListenInterval(1000));
+
+    /* The interval is capped */
+    TEST_ASSERT_EQUAL(
+        WIFI_PS_MAX_LISTEN_INTERVAL,
+        WiFiPower::GetListenInterval(WIFI_PS_MAX_BUDGET_MS)
+    );
+}
+
+void test_wifi_power_sleep_current(void) {
+    uint32_t previous;
+    uint32_t current;
+    uint16_t i;
+
+    TEST_ASSERT_EQUAL(WIFI_POWER_RX_UA, WiFiPower::GetSleepCurrent(0));
+
+    /* Longer intervals draw less, never below the modem sleep current */
+    previous = WiFiPower::GetSleepCurrent(0);
+    for (i = 1; WIFI_PS_MAX_LISTEN_INTERVAL >= i; ++i) {
+        current = WiFiPower::GetSleepCurrent(i);
+        TEST_ASSERT_LESS_THAN(previous, current);
+        TEST_ASSERT_GREATER_OR_EQUAL(WIFI_POWER_SLEEP_UA, current);
+        previous = current;
+    }
+}
+
+void WiFiPowerTests(void) {
+
+    RUN_TEST(test_wifi_power_listen_interval);
+    RUN_TEST(test_wifi_power_sleep_current);
+
+}
@@ -10,6 +10,30 @@ static volatile bool isHmEventTriggered = false;
 static volatile uint32_t degradedTimes = 0;
 static volatile uint32_t unhealthyTimes = 0;
 static volatile bool startFail = false;
+static volatile uint64_t checkDelayNs = 0;
+static volatile uint64_t actionDelayNs = 0;
+static const void* volatile actionOrder[8];
+static volatile uint32_t actionCount = 0;
+
+static bool waitActions(const uint32_t kCount, const uint64_t kTimeoutNs) {
+    Timeout timeout(kTimeoutNs);
+
+    while (kCount > actionCount && !timeout.HasTimedOut()) {
+        HWManager::DelayExecNs(1000000);
+    }
+
+    return kCount <= actionCount;
+}
+
+static void recordAction(const void* pReporter) {
+    if (8 > actionCount) {
+        actionOrder[actionCount] = pReporter;
+    }
+    ++actionCount;
+    if (0 != actionDelayNs) {
+        HWManager::DelayExecNs(actionDelayNs);
+    }
+}
 
 class TestHMReporter : public HMReporter {
     /********************* PUBLIC METHODS AND ATTRIBUTES **********************/
@@ -46,6 +70,7 @@ class TestHMReporter : public HMReporter {
          * the inherited class.
          */
         virtual void OnDegraded(void) noexcept {
+            recordAction(this);
             ++degradedTimes;
         }
         /**
@@ -55,6 +80,7 @@ class TestHMReporter : public HMReporter {
          * the inherited class.
          */
         virtual void OnUnhealthy(void) noexcept {
+            recordAction(this);
             ++unhealthyTimes;
         }
         /**
@@ -67,6 +93,9 @@ class TestHMReporter : public HMReporter {
          * otherwise False.
          */
         virtual bool PerformCheck(void) noexcept {
+            if (0 != checkDelayNs) {
+                HWManager::DelayExecNs(checkDelayNs);
+            }
             return !startFail;
         }
 
@@ -585,12 +614,262 @@ void test_reporter1(void) {
     TEST_ASSERT_EQUAL(E_Return::ERR_NO_SUCH_ID, result);
 }
 
+void test_reporter_budget(void) {
+    E_Return result;
+    uint32_t reporterId;
+    TestHMReporter reporter(S_HMReporterParam {100000000, 5, 10, "TestSlowReporter"});
+
+    unhealthyTimes = 0;
+    degradedTimes = 0;
+    startFail = false;
+
+    /* The check exceeds its budget, it must be accounted as failed */
+    checkDelayNs = 250000000;
+    reporter.SetCheckBudget(50000000);
+
+    result = SystemState::GetInstance()->GetHealthMonitor()->AddReporter(&reporter, reporterId);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    HWManager::DelayExecNs(1000000000);
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, reporter.GetTimedOutCount());
+    TEST_ASSERT_EQUAL(reporter.GetTimedOutCount(), reporter.GetTotalFailureCount());
+    TEST_ASSERT_NOT_EQUAL(E_HMStatus::HM_HEALTHY, reporter.GetStatus());
+
+    /* Removal waits for the running check to finish */
+    result = SystemState::GetInstance()->GetHealthMonitor()->RemoveReporter(reporterId);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    checkDelayNs = 0;
+}
+
+void test_reporter_status(void) {
+    E_Return           result;
+    uint32_t           reporterId;
+    uint32_t           count;
+    uint32_t           i;
+    bool               isFound;
+    S_HMReporterStatus pStatus[HM_MAX_REPORTERS];
+    TestHMReporter reporter(S_HMReporterParam {100000000, 5, 10, "TestStatusReporter"});
+
+    startFail = false;
+    result = SystemState::GetInstance()->GetHealthMonitor()->AddReporter(&reporter, reporterId);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    count = SystemState::GetInstance()->GetHealthMonitor()->GetReportersStatus(pStatus, HM_MAX_REPORTERS);
+    isFound = false;
+    for (i = 0; count > i; ++i) {
+        if (0 == strcmp("TestStatusReporter", pStatus[i].pName)) {
+            TEST_ASSERT_EQUAL(E_HMStatus::HM_HEALTHY, pStatus[i].status);
+            TEST_ASSERT_EQUAL(0, pStatus[i].failures);
+            isFound = true;
+        }
+    }
+    TEST_ASSERT_TRUE(isFound);
+
+    /* The buffer size bounds the snapshot */
+    TEST_ASSERT_EQUAL(0, SystemState::GetInstance()->GetHealthMonitor()->GetReportersStatus(pStatus, 0));
+
+    result = SystemState::GetInstance()->GetHealthMonitor()->RemoveReporter(reporterId);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    count = SystemState::GetInstance()->GetHealthMonitor()->GetReportersStatus(pStatus, HM_MAX_REPORTERS);
+    for (i = 0; count > i; ++i) {
+        TEST_ASSERT_NOT_EQUAL(0, strcmp("TestStatusReporter", pStatus[i].pName));
+    }
+}
+
+void test_action_coalescing(void) {
+    HealthMonitor*  pHM;
+    S_HMActionStats before;
+    S_HMActionStats after;
+    TestHMReporter  reporterA(S_HMReporterParam {10000000, 1, 2, "TestActionA"});
+    TestHMReporter  reporterB(S_HMReporterParam {10000000, 1, 2, "TestActionB"});
+    TestHMReporter  reporterC(S_HMReporterParam {10000000, 1, 1, "TestActionC"});
+
+    pHM = SystemState::GetInstance()->GetHealthMonitor();
+    pHM->GetActionStats(before);
+
+    unhealthyTimes = 0;
+    degradedTimes = 0;
+    actionCount = 0;
+    startFail = true;
+
+    /* A keeps the actions task busy while B and C are queued */
+    actionDelayNs = 200000000;
+    reporterA.HealthCheck(HWManager::GetTime() + 10000000);
+    TEST_ASSERT_EQUAL(E_HMStatus::HM_DEGRADED, reporterA.GetStatus());
+    TEST_ASSERT_TRUE(waitActions(1, 1000000000));
+
+    reporterB.HealthCheck(HWManager::GetTime() + 10000000);
+    TEST_ASSERT_EQUAL(E_HMStatus::HM_DEGRADED, reporterB.GetStatus());
+    reporterC.HealthCheck(HWManager::GetTime() + 10000000);
+    TEST_ASSERT_EQUAL(E_HMStatus::HM_UNHEALTHY, reporterC.GetStatus());
+
+    /* B turns unhealthy while pending, its action is merged and raised */
+    reporterB.HealthCheck(HWManager::GetTime() + 20000000);
+    TEST_ASSERT_EQUAL(E_HMStatus::HM_UNHEALTHY, reporterB.GetStatus());
+
+    TEST_ASSERT_TRUE(waitActions(3, 2000000000));
+    actionDelayNs = 0;
+    HWManager::DelayExecNs(10000000);
+
+    /* Unhealthy first in request order, each reporter once */
+    TEST_ASSERT_EQUAL(3, actionCount);
+    TEST_ASSERT_EQUAL_PTR(&reporterA, actionOrder[0]);
+    TEST_ASSERT_EQUAL_PTR(&reporterB, actionOrder[1]);
+    TEST_ASSERT_EQUAL_PTR(&reporterC, actionOrder[2]);
+    TEST_ASSERT_EQUAL(1, degradedTimes);
+    TEST_ASSERT_EQUAL(2, unhealthyTimes);
+
+    pHM->GetActionStats(after);
+    TEST_ASSERT_EQUAL(3, after.executed - before.executed);
+    TEST_ASSERT_EQUAL(1, after.coalesced - before.coalesced);
+    TEST_ASSERT_EQUAL(0, after.dropped - before.dropped);
+    TEST_ASSERT_EQUAL(0, after.pending);
+    TEST_ASSERT_EQUAL(0, after.running);
+
+    startFail = false;
+}
+
+void test_action_cancel(void) {
+    HealthMonitor*  pHM;
+    S_HMActionStats stats;
+    Timeout         timeout(1000000000);
+    uint32_t        reporterId;
+    TestHMReporter  reporterA(S_HMReporterParam {10000000, 1, 100, "TestCancelA"});
+    TestHMReporter  reporterB(S_HMReporterParam {10000000, 1, 100, "TestCancelB"});
+
+    pHM = SystemState::GetInstance()->GetHealthMonitor();
+
+    actionCount = 0;
+    startFail = true;
+
+    /* A keeps the actions task busy while the action of B is pending */
+    actionDelayNs = 200000000;
+    reporterA.HealthCheck(HWManager::GetTime() + 10000000);
+    TEST_ASSERT_TRUE(waitActions(1, 1000000000));
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        pHM->AddReporter(&reporterB, reporterId)
+    );
+    timeout.Notify();
+    do {
+        HWManager::DelayExecNs(1000000);
+        pHM->GetActionStats(stats);
+    } while (0 == stats.pending && !timeout.HasTimedOut());
+    TEST_ASSERT_EQUAL(1, stats.pending);
+
+    /* The pending action is cancelled with the reporter */
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pHM->RemoveReporter(reporterId));
+    pHM->GetActionStats(stats);
+    TEST_ASSERT_EQUAL(0, stats.pending);
+    actionDelayNs = 0;
+
+    /* Once added again, the next failure schedules a new action */
+    TEST_ASSERT_EQUAL(
+        E_Return::NO_ERROR,
+        pHM->AddReporter(&reporterB, reporterId)
+    );
+    TEST_ASSERT_TRUE(waitActions(2, 2000000000));
+    TEST_ASSERT_EQUAL_PTR(&reporterB, actionOrder[1]);
+
+    startFail = false;
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, pHM->RemoveReporter(reporterId));
+}
+
+static volatile uint32_t wdFiredMask = 0;
+
+static void wdHandlingShort(void) {
+    wdFiredMask |= 0x1;
+}
+
+static void wdHandlingMedium(void) {
+    wdFiredMask |= 0x2;
+}
+
+static void wdHandlingLong(void) {
+    wdFiredMask |= 0x4;
+}
+
+static void wdHandlingNotified(void) {
+    wdFiredMask |= 0x8;
+}
+
+void test_wd_deadlines(void) {
+    uint8_t i;
+
+    wdFiredMask = 0;
+
+    {
+        Timeout timeoutLong(1000000, 3000000000ULL, wdHandlingLong);
+        Timeout timeoutShort(1000000, 200000000ULL, wdHandlingShort);
+        Timeout timeoutNotified(1000000, 300000000ULL, wdHandlingNotified);
+        Timeout timeoutMedium(1000000, 400000000ULL, wdHandlingMedium);
+
+        /* Only the expired watchdogs trigger, the notified one is rescheduled */
+        for (i = 0; i < 8; ++i) {
+            HWManager::DelayExecNs(100000000);
+            timeoutNotified.Notify();
+        }
+        TEST_ASSERT_EQUAL_UINT32(0x3, wdFiredMask);
+    }
+
+    /* Removed watchdogs no longer trigger */
+    wdFiredMask = 0;
+    HWManager::DelayExecNs(500000000);
+    TEST_ASSERT_EQUAL_UINT32(0, wdFiredMask);
+}
+
+void test_wd_capacity(void) {
+    HealthMonitor* pHM;
+    Timeout        timeoutWd(1000000, 1000000000, wdDummy);
+    E_Return       result;
+    uint32_t       ids[HM_MAX_WATCHDOGS];
+    uint32_t       count;
+    uint32_t       i;
+
+    pHM = SystemState::GetInstance()->GetHealthMonitor();
+    TEST_ASSERT_NOT_NULL(pHM);
+
+    /* Fill the registry */
+    count = 0;
+    result = E_Return::NO_ERROR;
+    while (E_Return::NO_ERROR == result && HM_MAX_WATCHDOGS > count) {
+        result = pHM->AddWatchdog(&timeoutWd, ids[count]);
+        if (E_Return::NO_ERROR == result) {
+            ++count;
+        }
+    }
+    TEST_ASSERT_EQUAL(E_Return::ERR_MEMORY, result);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, count);
+
+    /* Freed slots are reused */
+    result = pHM->RemoveWatchdog(ids[0]);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    result = pHM->AddWatchdog(&timeoutWd, ids[0]);
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+
+    /* The checks keep running while registering */
+    HWManager::DelayExecNs(200000000);
+
+    for (i = 0; count > i; ++i) {
+        result = pHM->RemoveWatchdog(ids[i]);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, result);
+    }
+}
+
 void HealthMonitorTests(void) {
     RUN_TEST(test_add_wd);
     RUN_TEST(test_remove_wd);
     RUN_TEST(test_exec_wd);
     RUN_TEST(test_clean);
+    RUN_TEST(test_wd_deadlines);
+    RUN_TEST(test_wd_capacity);
     RUN_TEST(test_reporter_standalone);
     RUN_TEST(test_reporter0);
     RUN_TEST(test_reporter1);
+    RUN_TEST(test_reporter_budget);
+    RUN_TEST(test_reporter_status);
+    RUN_TEST(test_action_coalescing);
+    RUN_TEST(test_action_cancel);
 }
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <cstdio>
+#include <version.h>
+#include "Bench.h"
+
+/** @brief Number of calibration measures. */
+#define BENCH_CALIBRATION_COUNT 64
+
+/** @brief Cycles spent reading the cycle counter. */
+static uint32_t sOverheadCycles = 0;
+
+void BenchCalibrate(void) {
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t i;
+
+    /* The fastest empty measure is the counter read cost */
+    sOverheadCycles = UINT32_MAX;
+    for (i = 0; BENCH_CALIBRATION_COUNT > i; ++i) {
+        start = HWManager::GetCycleCount();
+        cycles = HWManager::GetCycleCount() - start;
+        if (sOverheadCycles > cycles) {
+            sOverheadCycles = cycles;
+        }
+    }
+}
+
+void BenchStart(S_BenchResult& rResult, const char* pkName) {
+    rResult.pkName = pkName;
+    rResult.count = 0;
+    rResult.minCycles = UINT32_MAX;
+    rResult.maxCycles = 0;
+    rResult.totalCycles = 0;
+}
+
+void BenchAccount(S_BenchResult& rResult, const uint32_t kStartCycles) {
+    uint32_t cycles;
+
+    cycles = HWManager::GetCycleCount() - kStartCycles;
+    cycles = (sOverheadCycles < cycles) ? cycles - sOverheadCycles : 0;
+
+    ++rResult.count;
+    rResult.totalCycles += cycles;
+    if (rResult.minCycles > cycles) {
+        rResult.minCycles = cycles;
+    }
+    if (rResult.maxCycles < cycles) {
+        rResult.maxCycles = cycles;
+    }
+}
+
+void BenchReport(const S_BenchResult& krResult) {
+    char     pMessage[192];
+    uint32_t average;
+
+    TEST_ASSERT_NOT_EQUAL(0, krResult.count);
+
+    average = (uint32_t)(krResult.totalCycles / krResult.count);
+    snprintf(
+        pMessage,
+        sizeof(pMessage),
+        "BENCH name=%s build=%s iterations=%lu min=%lu avg=%lu max=%lu "
+        "avg_ns=%llu",
+        krResult.pkName,
+        BUILD_NUMBER,
+        (unsigned long)krResult.count,
+        (unsigned long)krResult.minCycles,
+        (unsigned long)average,
+        (unsigned long)krResult.maxCycles,
+        (unsigned long long)HWManager::CyclesToNs(average)
+    );
+    TEST_MESSAGE(pMessage);
+}
@@ -0,0 +1,55 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <cstdint>
+
+/** @brief Number of iterations of the fast benchmarks. */
+#define BENCH_ITERATIONS 256
+/** @brief Number of iterations of the benchmarks touching the storage. */
+#define BENCH_STORAGE_ITERATIONS 16
+
+/** @brief Benchmark accounting, in CPU cycles. */
+typedef struct {
+    /** @brief The benchmark name, reported as is. */
+    const char* pkName;
+    /** @brief Number of measured iterations. */
+    uint32_t count;
+    /** @brief Cycles of the fastest iteration. */
+    uint32_t minCycles;
+    /** @brief Cycles of the slowest iteration. */
+    uint32_t maxCycles;
+    /** @brief Cycles of all the iterations. */
+    uint64_t totalCycles;
+} S_BenchResult;
+
+/**
+ * @brief Measures the cost of reading the cycle counter, subtracted from all
+ * the measures. Must be called once before the benchmarks.
+ */
+void BenchCalibrate(void);
+
+/**
+ * @brief Starts a benchmark.
+ *
+ * @param[out] rResult The benchmark accounting to initialize.
+ * @param[in] pkName The benchmark name.
+ */
+void BenchStart(S_BenchResult& rResult, const char* pkName);
+
+/**
+ * @brief Accounts an iteration of a benchmark.
+ *
+ * @param[in, out] rResult The benchmark accounting.
+ * @param[in] kStartCycles The cycle counter read before the iteration.
+ */
+void BenchAccount(S_BenchResult& rResult, const uint32_t kStartCycles);
+
+/**
+ * @brief Reports a benchmark. The line starts with BENCH and is made of
+ * key=value fields: name, iterations, min, avg and max in cycles, avg_ns.
+ *
+ * @param[in] krResult The benchmark accounting.
+ */
+void BenchReport(const S_BenchResult& krResult);
+
+#endif /* #ifndef __BENCH_H__ */
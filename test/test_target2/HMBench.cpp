@@ -0,0 +1,107 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <cstdio>
+#include <Timeout.h>
+#include <version.h>
+#include <SystemState.h>
+#include <HealthMonitor.h>
+
+/** @brief Number of watchdogs of the largest benchmark. */
+#define BENCH_HM_MAX_WATCHDOGS 48
+/** @brief Measure duration of each watchdogs count in milliseconds. */
+#define BENCH_HM_DURATION_MS 2000
+/** @brief Timeout of the benchmark timeouts in nanoseconds. */
+#define BENCH_HM_TIMEOUT_NS 100000000000ULL
+/** @brief Watchdog of the idle watchdogs in nanoseconds, never expires. */
+#define BENCH_HM_IDLE_WD_NS 100000000000ULL
+/** @brief Watchdog of the expiring watchdogs in nanoseconds. */
+#define BENCH_HM_EXPIRED_WD_NS 10000000ULL
+
+/** @brief Number of executed watchdog handlers. */
+static volatile uint32_t sHandlerCount = 0;
+/** @brief The benchmark timeouts. */
+static Timeout* spTimeouts[BENCH_HM_MAX_WATCHDOGS];
+
+static void BenchWatchdogHandler(void) {
+    ++sHandlerCount;
+}
+
+static void BenchWatchdogs(const char*    pkName,
+                           const uint32_t kCount,
+                           const uint64_t kWatchdogNs) {
+    S_HMCheckStats stats;
+    HealthMonitor* pHM;
+    char           pMessage[192];
+    uint32_t       average;
+    uint32_t       i;
+
+    pHM = SystemState::GetInstance()->GetHealthMonitor();
+    TEST_ASSERT_NOT_NULL(pHM);
+
+    /* The timeouts register their watchdog on creation */
+    for (i = 0; kCount > i; ++i) {
+        spTimeouts[i] = new Timeout(
+            BENCH_HM_TIMEOUT_NS,
+            kWatchdogNs,
+            BenchWatchdogHandler
+        );
+        TEST_ASSERT_NOT_NULL(spTimeouts[i]);
+    }
+
+    /* The checks are run by the real-time task, only their cost is kept */
+    delay(HW_RT_TASK_PERIOD_NS / 1000000ULL);
+    pHM->GetCheckStats(stats, true);
+    delay(BENCH_HM_DURATION_MS);
+    pHM->GetCheckStats(stats, true);
+
+    for (i = 0; kCount > i; ++i) {
+        delete spTimeouts[i];
+    }
+
+    TEST_ASSERT_NOT_EQUAL(0, stats.count);
+    average = (uint32_t)(stats.totalCycles / stats.count);
+    snprintf(
+        pMessage,
+        sizeof(pMessage),
+        "BENCH name=%s.n%lu build=%s iterations=%lu min=%lu avg=%lu max=%lu "
+        "avg_ns=%llu events=%lu",
+        pkName,
+        (unsigned long)kCount,
+        BUILD_NUMBER,
+        (unsigned long)stats.count,
+        (unsigned long)stats.minCycles,
+        (unsigned long)average,
+        (unsigned long)stats.maxCycles,
+        (unsigned long long)HWManager::CyclesToNs(average),
+        (unsigned long)stats.events
+    );
+    TEST_MESSAGE(pMessage);
+}
+
+void test_bench_hm_watchdogs_idle(void) {
+    BenchWatchdogs("hm.check_watchdogs.idle", 1, BENCH_HM_IDLE_WD_NS);
+    BenchWatchdogs("hm.check_watchdogs.idle", 16, BENCH_HM_IDLE_WD_NS);
+    BenchWatchdogs(
+        "hm.check_watchdogs.idle",
+        BENCH_HM_MAX_WATCHDOGS,
+        BENCH_HM_IDLE_WD_NS
+    );
+}
+
+void test_bench_hm_watchdogs_expired(void) {
+    sHandlerCount = 0;
+    BenchWatchdogs("hm.check_watchdogs.expired", 1, BENCH_HM_EXPIRED_WD_NS);
+    BenchWatchdogs("hm.check_watchdogs.expired", 16, BENCH_HM_EXPIRED_WD_NS);
+    BenchWatchdogs(
+        "hm.check_watchdogs.expired",
+        BENCH_HM_MAX_WATCHDOGS,
+        BENCH_HM_EXPIRED_WD_NS
+    );
+    TEST_ASSERT_NOT_EQUAL(0, sHandlerCount);
+}
+
+void HMBench(void) {
+    RUN_TEST(test_bench_hm_watchdogs_idle);
+    RUN_TEST(test_bench_hm_watchdogs_expired);
+}
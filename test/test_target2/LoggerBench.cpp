@@ -0,0 +1,133 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <Logger.h>
+#include "Bench.h"
+
+/** @brief Size of the RAM journal reads. */
+#define BENCH_JOURNAL_READ_SIZE 1024
+
+/** @brief RAM journal reads buffer. */
+static uint8_t sJournalBuffer[BENCH_JOURNAL_READ_SIZE];
+
+static void BenchLogFrontEnd(const char*      pkName,
+                             const E_LogLevel kLevel) {
+    S_BenchResult result;
+    Logger*       pLogger;
+    uint32_t      start;
+    uint32_t      i;
+
+    pLogger = Logger::GetInstance();
+
+    /* Only the caller cost is measured, the ring is drained between logs */
+    BenchStart(result, pkName);
+    for (i = 0; BENCH_ITERATIONS > i; ++i) {
+        start = HWManager::GetCycleCount();
+        pLogger->LogLevel(
+            kLevel,
+            LOG_MODULE_DEFAULT,
+            __FILE__,
+            __LINE__,
+            "Benchmark log %lu value %d.\n",
+            (unsigned long)i,
+            -42
+        );
+        BenchAccount(result, start);
+        pLogger->Flush();
+    }
+    BenchReport(result);
+}
+
+void test_bench_log_levels(void) {
+    Logger*    pLogger;
+    E_LogLevel level;
+
+    pLogger = Logger::GetInstance();
+    level = pLogger->GetModuleLevel(LOG_MODULE_DEFAULT);
+
+    /* The benchmarks log from a single call site */
+    pLogger->SetRateLimit(false);
+    pLogger->SetModuleLevel(LOG_MODULE_DEFAULT, LOG_LEVEL_DEBUG);
+    BenchLogFrontEnd("logger.error", LOG_LEVEL_ERROR);
+    BenchLogFrontEnd("logger.info", LOG_LEVEL_INFO);
+    BenchLogFrontEnd("logger.debug", LOG_LEVEL_DEBUG);
+
+    /* The filtered logs only cost the runtime level check */
+    pLogger->SetModuleLevel(LOG_MODULE_DEFAULT, LOG_LEVEL_ERROR);
+    BenchLogFrontEnd("logger.info.filtered", LOG_LEVEL_INFO);
+    BenchLogFrontEnd("logger.debug.filtered", LOG_LEVEL_DEBUG);
+
+    /* Past the burst, the limited logs only cost the bucket check */
+    pLogger->SetRateLimit(true);
+    pLogger->SetModuleLevel(LOG_MODULE_DEFAULT, LOG_LEVEL_INFO);
+    BenchLogFrontEnd("logger.info.limited", LOG_LEVEL_INFO);
+
+    pLogger->SetRateLimit(LOGGER_RATE_LIMIT_ENABLED);
+    pLogger->SetModuleLevel(LOG_MODULE_DEFAULT, level);
+}
+
+void test_bench_log_sinks(void) {
+    S_BenchResult result;
+    Logger*       pLogger;
+    E_LogLevel    level;
+    uint32_t      start;
+    uint32_t      i;
+
+    pLogger = Logger::GetInstance();
+    level = pLogger->GetModuleLevel(LOG_MODULE_DEFAULT);
+    pLogger->SetModuleLevel(LOG_MODULE_DEFAULT, LOG_LEVEL_INFO);
+    pLogger->SetRateLimit(false);
+
+    /* The flush waits for the serial, RAM and persistent journal sinks */
+    BenchStart(result, "logger.info.sinks");
+    for (i = 0; BENCH_ITERATIONS > i; ++i) {
+        start = HWManager::GetCycleCount();
+        pLogger->LogLevel(
+            LOG_LEVEL_INFO,
+            LOG_MODULE_DEFAULT,
+            __FILE__,
+            __LINE__,
+            "Benchmark log %lu value %d.\n",
+            (unsigned long)i,
+            -42
+        );
+        pLogger->Flush();
+        BenchAccount(result, start);
+    }
+    BenchReport(result);
+
+    pLogger->SetRateLimit(LOGGER_RATE_LIMIT_ENABLED);
+    pLogger->SetModuleLevel(LOG_MODULE_DEFAULT, level);
+}
+
+void test_bench_ram_journal(void) {
+    S_RamJournalDescriptor desc;
+    S_BenchResult          result;
+    Logger*                pLogger;
+    size_t                 size;
+    uint32_t               start;
+    uint32_t               i;
+
+    pLogger = Logger::GetInstance();
+
+    /* The previous benchmarks filled the journal */
+    BenchStart(result, "logger.ram_journal.read_1k");
+    for (i = 0; BENCH_ITERATIONS > i; ++i) {
+        pLogger->OpenRamJournal(&desc);
+        start = HWManager::GetCycleCount();
+        size = pLogger->ReadRamJournal(
+            sJournalBuffer,
+            BENCH_JOURNAL_READ_SIZE,
+            &desc
+        );
+        BenchAccount(result, start);
+        TEST_ASSERT_NOT_EQUAL(0, size);
+    }
+    BenchReport(result);
+}
+
+void LoggerBench(void) {
+    RUN_TEST(test_bench_log_levels);
+    RUN_TEST(test_bench_log_sinks);
+    RUN_TEST(test_bench_ram_journal);
+}
@@ -0,0 +1,71 @@
+#include <BSP.h>             /* Hardware services*/
+#include <Logger.h>          /* Firmware logger */
+#include <Arduino.h>         /* Arduino library */
+#include <Storage.h>         /* Storage manager */
+#include <Settings.h>        /* Settings services */
+#include <MemoryPool.h>      /* Subsystem memory pools */
+#include <WiFiModule.h>      /* WiFi Module driver */
+#include <SystemState.h>     /* System state */
+#include <HealthMonitor.h>   /* Health Monitoring */
+#include <unity.h>
+#include "Bench.h"
+
+extern void LoggerBench();
+extern void SettingsBench();
+extern void HMBench();
+extern void PageBench();
+extern void ValidatorBench();
+
+/** @brief Stores the Health Monitor instance. */
+static HealthMonitor* spHealthMon;
+/** @brief Stores the WiFi module instance. */
+static WiFiModule* spWifiModule;
+/** @brief Stores the Settings instance. */
+static Settings* spSettings;
+/** @brief Stores the Storage Manager instance.  */
+static Storage* spStorage;
+/** @brief Stores the System State instance. */
+static SystemState* spSystemState;
+
+void setup(void) {
+    /* Init system state */
+    spSystemState = SystemState::GetInstance();
+    if (nullptr == spSystemState) {
+        PANIC("Failed to instanciate the System State.\n");
+    }
+    MemoryPool::Init();
+
+    /* Init system objects, the pages read the WiFi module */
+    spStorage = new Storage();
+    if (nullptr == spStorage) {
+        PANIC("Failed to instanciate the Storage Manager.\n");
+    }
+    spHealthMon = new HealthMonitor();
+    if (nullptr == spHealthMon) {
+        PANIC("Failed to instanciate the Health Monitor.\n");
+    }
+    spSettings = new Settings();
+    if (nullptr == spSettings) {
+        PANIC("Failed to instanciate the Settings.\n");
+    }
+    spWifiModule = new WiFiModule();
+    if (nullptr == spWifiModule) {
+        PANIC("Failed to instanciate the WiFi Module.\n");
+    }
+
+    BenchCalibrate();
+
+    UNITY_BEGIN();
+
+    LoggerBench();
+    SettingsBench();
+    HMBench();
+    PageBench();
+    ValidatorBench();
+
+    UNITY_END();
+}
+
+void loop(void) {
+    vTaskDelay(1000 / portTICK_PERIOD_MS);
+}
@@ -0,0 +1,70 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <PageSink.h>
+#include <WebServer.h>
+#include <PageHandler.h>
+#include <RequestArena.h>
+#include <AboutPageHandler.h>
+#include <IndexPageHandler.h>
+#include <MonitorPageHandler.h>
+#include <SensorsPageHandler.h>
+#include <SettingsPageHandler.h>
+#include "Bench.h"
+
+/** @brief Port of the benchmark server, never started. */
+#define BENCH_PAGE_PORT 8080
+
+/** @brief The benchmark server, the pages are sent to no client. */
+static WebServer* spServer = nullptr;
+/** @brief The benchmark request arena. */
+static RequestArena* spArena = nullptr;
+
+static void GeneratePage(S_BenchResult& rResult, PageHandler* pHandler) {
+    PageSink sink(spServer, 200, "text/html", spArena);
+    uint32_t start;
+
+    /* The sink is built before the measure like in the server handlers */
+    start = HWManager::GetCycleCount();
+    pHandler->Generate(sink);
+    sink.End();
+    BenchAccount(rResult, start);
+
+    spArena->Reset();
+}
+
+static void BenchPage(const char* pkName, PageHandler* pHandler) {
+    S_BenchResult result;
+    uint32_t      i;
+
+    TEST_ASSERT_NOT_NULL(pHandler);
+
+    BenchStart(result, pkName);
+    for (i = 0; BENCH_ITERATIONS > i; ++i) {
+        GeneratePage(result, pHandler);
+    }
+    BenchReport(result);
+}
+
+void test_bench_pages(void) {
+    if (nullptr == spServer) {
+        spServer = new WebServer(BENCH_PAGE_PORT);
+        spArena = new RequestArena(REQUEST_ARENA_SIZE);
+    }
+    TEST_ASSERT_NOT_NULL(spServer);
+    TEST_ASSERT_NOT_NULL(spArena);
+
+    /*
+     * The handlers live as long as the firmware, they are never released.
+     * The reboot page is not generated, it changes the mode.
+     */
+    BenchPage("page.index", new IndexPageHandler(nullptr));
+    BenchPage("page.monitor", new MonitorPageHandler(nullptr));
+    BenchPage("page.settings", new SettingsPageHandler(nullptr));
+    BenchPage("page.sensors", new SensorsPageHandler(nullptr));
+    BenchPage("page.about", new AboutPageHandler(nullptr));
+}
+
+void PageBench(void) {
+    RUN_TEST(test_bench_pages);
+}
@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <Errors.h>
+#include <Settings.h>
+#include <SettingsIds.h>
+#include <SystemState.h>
+#include "Bench.h"
+
+/** @brief Name of the setting modified by the commit benchmark. */
+#define BENCH_SETTING_NAME "bench_u32"
+
+void test_bench_settings_get(void) {
+    S_BenchResult result;
+    Settings*     pSettings;
+    E_Return      error;
+    uint32_t      value;
+    uint16_t      port;
+    uint32_t      start;
+    uint32_t      i;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    /* Named lookup, the value is cached */
+    value = 0;
+    error = pSettings->SetSettings(
+        BENCH_SETTING_NAME,
+        (uint8_t*)&value,
+        sizeof(value)
+    );
+    TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    BenchStart(result, "settings.get_by_name");
+    for (i = 0; BENCH_ITERATIONS > i; ++i) {
+        start = HWManager::GetCycleCount();
+        error = pSettings->GetSettings(
+            BENCH_SETTING_NAME,
+            (uint8_t*)&value,
+            sizeof(value)
+        );
+        BenchAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    }
+    BenchReport(result);
+
+    /* Identified lookup, served from the values array */
+    error = pSettings->GetSetting(
+        E_SettingId::SETTING_ID_WEB_PORT,
+        (uint8_t*)&port,
+        sizeof(port)
+    );
+    if (E_Return::NO_ERROR != error) {
+        /* Blank storage, the default value is cached */
+        error = pSettings->GetDefault(
+            E_SettingId::SETTING_ID_WEB_PORT,
+            (uint8_t*)&port,
+            sizeof(port)
+        );
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+        error = pSettings->SetSetting(
+            E_SettingId::SETTING_ID_WEB_PORT,
+            (uint8_t*)&port,
+            sizeof(port)
+        );
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    }
+    BenchStart(result, "settings.get_by_id");
+    for (i = 0; BENCH_ITERATIONS > i; ++i) {
+        start = HWManager::GetCycleCount();
+        error = pSettings->GetSetting(
+            E_SettingId::SETTING_ID_WEB_PORT,
+            (uint8_t*)&port,
+            sizeof(port)
+        );
+        BenchAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    }
+    BenchReport(result);
+}
+
+void test_bench_settings_commit(void) {
+    S_BenchResult result;
+    Settings*     pSettings;
+    E_Return      error;
+    uint32_t      value;
+    uint32_t      start;
+    uint32_t      i;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    /* Each commit appends one modified setting to the journal */
+    BenchStart(result, "settings.commit");
+    for (i = 0; BENCH_STORAGE_ITERATIONS > i; ++i) {
+        value = i;
+        error = pSettings->SetSettings(
+            BENCH_SETTING_NAME,
+            (uint8_t*)&value,
+            sizeof(value)
+        );
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+
+        start = HWManager::GetCycleCount();
+        error = pSettings->Commit();
+        BenchAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+    }
+    BenchReport(result);
+}
+
+void test_bench_settings_load(void) {
+    S_BenchResult result;
+    Settings*     pSettings;
+    E_Return      error;
+    uint32_t      value;
+    uint32_t      start;
+    uint32_t      i;
+
+    pSettings = SystemState::GetInstance()->GetSettings();
+    TEST_ASSERT_NOT_NULL(pSettings);
+
+    /* The first access after a cache clear loads the storage image */
+    BenchStart(result, "settings.load_from_storage");
+    for (i = 0; BENCH_STORAGE_ITERATIONS > i; ++i) {
+        error = pSettings->ClearCache();
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+
+        start = HWManager::GetCycleCount();
+        error = pSettings->GetSettings(
+            BENCH_SETTING_NAME,
+            (uint8_t*)&value,
+            sizeof(value)
+        );
+        BenchAccount(result, start);
+        TEST_ASSERT_EQUAL(E_Return::NO_ERROR, error);
+        TEST_ASSERT_EQUAL_UINT32(BENCH_STORAGE_ITERATIONS - 1, value);
+    }
+    BenchReport(result);
+}
+
+void SettingsBench(void) {
+    RUN_TEST(test_bench_settings_get);
+    RUN_TEST(test_bench_settings_commit);
+    RUN_TEST(test_bench_settings_load);
+}
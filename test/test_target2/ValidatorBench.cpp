@@ -0,0 +1,42 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <BSP.h>
+#include <WiFiModule.h>
+#include <WiFiValidator.h>
+#include "Bench.h"
+
+static void BenchIp(const char* pkName,
+                    const char* pkIp,
+                    const bool  kIsValid) {
+    S_WiFiConfigRequest config;
+    S_BenchResult       result;
+    bool                isValid;
+    uint32_t            start;
+    uint32_t            i;
+
+    /* A static address is always checked for its format */
+    config.isStatic.first = true;
+    config.isStatic.second = true;
+    config.ip.first = pkIp;
+    config.ip.second = true;
+
+    BenchStart(result, pkName);
+    for (i = 0; BENCH_ITERATIONS > i; ++i) {
+        start = HWManager::GetCycleCount();
+        isValid = WiFiValidator::ValidateIP(config);
+        BenchAccount(result, start);
+        TEST_ASSERT_EQUAL(kIsValid, isValid);
+    }
+    BenchReport(result);
+}
+
+void test_bench_ip_format(void) {
+    BenchIp("validator.ip.short", "1.2.3.4", true);
+    BenchIp("validator.ip.long", "192.168.254.254", true);
+    BenchIp("validator.ip.range", "192.168.256.1", false);
+    BenchIp("validator.ip.content", "192.168.1.a", false);
+}
+
+void ValidatorBench(void) {
+    RUN_TEST(test_bench_ip_format);
+}
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+# Load generator for the web and API servers.
+#
+# Runs closed-loop clients against the page and API routes at each requested
+# concurrency, and reports the client side throughput and latency
+# percentiles next to the device side counters read from the load API.
+#
+# Usage: python3 tools/loadgen.py 192.168.4.1 -c 1,2,4,8 -d 20
+import argparse
+import http.client
+import json
+import threading
+import time
+import urllib.parse
+
+DEFAULT_WEB_PORT = 80
+DEFAULT_API_PORT = 8333
+
+API_URL_LOAD = "/load"
+
+# Name, server, method, path and form body of each target
+TARGETS = {
+    "index": ("web", "GET", "/", None),
+    "settings": ("web", "GET", "/settings", None),
+    "ping": ("api", "POST", "/ping", None),
+    "wifi": ("api", "POST", "/wifi", {"mode": "getsettings"}),
+}
+
+PERCENTILES = [50, 90, 99]
+
+class Client:
+    def __init__(self, host, ports, timeout):
+        self.host = host
+        self.ports = ports
+        self.timeout = timeout
+        self.connections = {}
+
+    def request(self, server, method, path, form):
+        body = None
+        headers = {}
+        if form is not None:
+            body = urllib.parse.urlencode(form)
+            headers["Content-Type"] = "application/x-www-form-urlencoded"
+
+        # The connections are kept alive, a closed one is opened again once
+        for attempt in range(2):
+            connection = self.connections.get(server)
+            if connection is None:
+                connection = http.client.HTTPConnection(
+                    self.host, self.ports[server], timeout=self.timeout)
+                self.connections[server] = connection
+            try:
+                connection.request(method, path, body, headers)
+                response = connection.getresponse()
+                data = response.read()
+                if response.getheader("Connection", "").lower() == "close":
+                    self.close(server)
+                return response.status, data
+            except (http.client.HTTPException, OSError):
+                self.close(server)
+                if 1 == attempt:
+                    raise
+
+    def close(self, server):
+        connection = self.connections.pop(server, None)
+        if connection is not None:
+            connection.close()
+
+    def close_all(self):
+        for server in list(self.connections):
+            self.close(server)
+
+def percentile(samples, percent):
+    if not samples:
+        return 0.0
+    rank = max(1, (len(samples) * percent + 99) // 100)
+    return samples[rank - 1]
+
+def worker(client, targets, offset, deadline, results, lock):
+    latencies = {name: [] for name in targets}
+    errors = {name: 0 for name in targets}
+    i = offset
+    while time.monotonic() < deadline:
+        name = targets[i % len(targets)]
+        server, method, path, form = TARGETS[name]
+        start = time.perf_counter()
+        try:
+            status, _ = client.request(server, method, path, form)
+            if 200 == status:
+                latencies[name].append(time.perf_counter() - start)
+            else:
+                errors[name] += 1
+        except (http.client.HTTPException, OSError):
+            errors[name] += 1
+        i += 1
+    client.close_all()
+
+    with lock:
+        for name in targets:
+            results[name]["latencies"].extend(latencies[name])
+            results[name]["errors"] += errors[name]
+
+def read_device_stats(host, ports, timeout, reset):
+    client = Client(host, ports, timeout)
+    form = {"reset": "1"} if reset else None
+    status, data = client.request("api", "POST", API_URL_LOAD, form)
+    client.close_all()
+    if 200 != status:
+        raise RuntimeError("Load API returned {}".format(status))
+    return json.loads(data)
+
+def run_level(args, ports, targets, concurrency):
+    results = {name: {"latencies": [], "errors": 0} for name in targets}
+    lock = threading.Lock()
+
+    # The device window starts with the level
+    read_device_stats(args.host, ports, args.timeout, True)
+
+    deadline = time.monotonic() + args.duration
+    start = time.monotonic()
+    threads = []
+    for i in range(concurrency):
+        client = Client(args.host, ports, args.timeout)
+        thread = threading.Thread(
+            target=worker,
+            args=(client, targets, i, deadline, results, lock))
+        thread.start()
+        threads.append(thread)
+    for thread in threads:
+        thread.join()
+    elapsed = time.monotonic() - start
+
+    device = read_device_stats(args.host, ports, args.timeout, False)
+
+    level = {"concurrency": concurrency, "elapsed_s": elapsed, "targets": {}}
+    for name in targets:
+        samples = sorted(results[name]["latencies"])
+        entry = {
+            "requests": len(samples),
+            "errors": results[name]["errors"],
+            "rps": len(samples) / elapsed,
+        }
+        for percent in PERCENTILES:
+            entry["p{}_ms".format(percent)] = percentile(samples, percent) * 1000
+        entry["max_ms"] = (samples[-1] if samples else 0.0) * 1000
+
+        server, _, path, _ = TARGETS[name]
+        for handler in device.get("handlers", []):
+            if handler["srv"] == server and handler["path"] == path:
+                entry["device"] = handler
+        level["targets"][name] = entry
+
+    level["heap_free"] = device.get("heap_free", 0)
+    level["heap_min"] = device.get("heap_min", 0)
+    return level
+
+def print_level(level):
+    print("==== Concurrency {} ({:.1f} s)".format(
+        level["concurrency"], level["elapsed_s"]))
+    print("{:<10} {:>8} {:>6} {:>8} {:>8} {:>8} {:>8} | {:>8} {:>8} {:>8} {:>9}".format(
+        "target", "reqs", "errs", "rps", "p50ms", "p90ms", "p99ms",
+        "dev_avg", "dev_p99", "dev_max", "heap_low"))
+    for name, entry in level["targets"].items():
+        device = entry.get("device", {})
+        print("{:<10} {:>8} {:>6} {:>8.1f} {:>8.2f} {:>8.2f} {:>8.2f} | {:>8} {:>8} {:>8} {:>9}".format(
+            name, entry["requests"], entry["errors"], entry["rps"],
+            entry["p50_ms"], entry["p90_ms"], entry["p99_ms"],
+            device.get("avg_us", "-"), device.get("p99_us", "-"),
+            device.get("max_us", "-"), device.get("heap_low", "-")))
+    print("heap free {} bytes, lowest since boot {} bytes".format(
+        level["heap_free"], level["heap_min"]))
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Web and API servers load generator.")
+    parser.add_argument("host", help="Address of the station.")
+    parser.add_argument("--web-port", type=int, default=DEFAULT_WEB_PORT)
+    parser.add_argument("--api-port", type=int, default=DEFAULT_API_PORT)
+    parser.add_argument("-c", "--concurrency", default="1,2,4",
+                        help="Comma separated numbers of clients.")
+    parser.add_argument("-d", "--duration", type=float, default=10.0,
+                        help="Duration of each level in seconds.")
+    parser.add_argument("-t", "--targets", default=",".join(TARGETS),
+                        help="Comma separated targets: {}.".format(
+                            ", ".join(TARGETS)))
+    parser.add_argument("--timeout", type=float, default=5.0,
+                        help="Request timeout in seconds.")
+    parser.add_argument("-o", "--output", help="JSON report file.")
+    args = parser.parse_args()
+
+    ports = {"web": args.web_port, "api": args.api_port}
+    targets = [name.strip() for name in args.targets.split(",")]
+    for name in targets:
+        if name not in TARGETS:
+            parser.error("Unknown target {}".format(name))
+
+    report = []
+    for concurrency in [int(c) for c in args.concurrency.split(",")]:
+        level = run_level(args, ports, targets, concurrency)
+        print_level(level)
+        report.append(level)
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as file:
+            json.dump(report, file, indent=2)
+
+if __name__ == "__main__":
+    main()
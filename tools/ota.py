@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+# Firmware update client.
+#
+# Streams a firmware image to the OTA API of one or more stations. A dropped
+# transfer is resumed from the offset reported by the station, the image is
+# then verified and the station rebooted on it.
+#
+# Usage: python3 tools/ota.py .pio/build/<env>/firmware.bin 192.168.4.1
+import argparse
+import hashlib
+import http.client
+import json
+import time
+import urllib.parse
+
+DEFAULT_WEB_PORT = 80
+DEFAULT_API_PORT = 8333
+
+API_URL_OTA = "/ota"
+API_URL_OTA_DATA = "/ota/data"
+API_URL_REBOOT = "/reboot"
+
+OFFSET_HEADER = "X-OTA-Offset"
+
+def request(host, port, timeout, path, form=None, body=None, headers=None):
+    all_headers = dict(headers or {})
+    if form is not None:
+        body = urllib.parse.urlencode(form)
+        all_headers["Content-Type"] = "application/x-www-form-urlencoded"
+    connection = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        connection.request("POST", path, body, all_headers)
+        response = connection.getresponse()
+        data = response.read()
+    finally:
+        connection.close()
+    return data
+
+def call(host, port, timeout, path, form=None, body=None, headers=None):
+    data = request(host, port, timeout, path, form, body, headers)
+    return json.loads(data) if data else {}
+
+def update(host, args, image, digest):
+    status = call(host, args.port, args.timeout, API_URL_OTA,
+                  {"mode": "begin", "size": len(image), "sha256": digest})
+    if 0 != status.get("result"):
+        raise RuntimeError("Begin failed: {}".format(status.get("msg")))
+
+    attempts = 0
+    start = time.monotonic()
+    while status["offset"] < len(image):
+        offset = status["offset"]
+        try:
+            status = call(
+                host, args.port, args.timeout, API_URL_OTA_DATA,
+                body=image[offset:],
+                headers={"Content-Type": "application/octet-stream",
+                         OFFSET_HEADER: str(offset)})
+        except (http.client.HTTPException, OSError) as error:
+            attempts += 1
+            if args.retries < attempts:
+                raise
+            print("{}: transfer dropped at {} ({}), resuming".format(
+                host, offset, error))
+            status = call(host, args.port, args.timeout, API_URL_OTA)
+        if "failed" == status.get("state"):
+            raise RuntimeError("Transfer failed: {}".format(status))
+    elapsed = time.monotonic() - start
+
+    status = call(host, args.port, args.timeout, API_URL_OTA,
+                  {"mode": "finish"})
+    if 0 != status.get("result"):
+        raise RuntimeError("Verification failed: {}".format(status))
+    print("{}: {} bytes in {:.1f} s, {:.1f} kB/s".format(
+        host, len(image), elapsed,
+        len(image) / 1024 / max(elapsed, 1e-3)))
+
+    if not args.no_reboot:
+        try:
+            request(host, args.web_port, args.timeout, API_URL_REBOOT,
+                    {"mode": "0"})
+        except (http.client.HTTPException, OSError):
+            # The station may reboot before the response is sent
+            pass
+
+def main():
+    parser = argparse.ArgumentParser(description="Firmware update client.")
+    parser.add_argument("image", help="Firmware image file.")
+    parser.add_argument("hosts", nargs="+", help="Addresses of the stations.")
+    parser.add_argument("--web-port", type=int, default=DEFAULT_WEB_PORT)
+    parser.add_argument("--port", type=int, default=DEFAULT_API_PORT)
+    parser.add_argument("--timeout", type=float, default=30.0,
+                        help="Request timeout in seconds.")
+    parser.add_argument("--retries", type=int, default=5,
+                        help="Resumed transfers allowed per station.")
+    parser.add_argument("--no-reboot", action="store_true",
+                        help="Do not reboot the stations on the new image.")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as file:
+        image = file.read()
+    digest = hashlib.sha256(image).hexdigest()
+
+    failed = 0
+    for host in args.hosts:
+        try:
+            update(host, args, image, digest)
+        except (RuntimeError, http.client.HTTPException, OSError) as error:
+            print("{}: {}".format(host, error))
+            failed += 1
+    raise SystemExit(1 if failed else 0)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# Tasks stack sizes generator.
+#
+# Reads the stack peaks reported by the tasks API of a station built with
+# TASK_STACK_PROFILE=1, after it ran under load, and writes the tasks stack
+# table used by the next build. Each stack is the peak plus a safety margin,
+# rounded up and bounded to the sizes accepted by the task registry. The
+# tasks without a measured peak keep their current size.
+#
+# Usage: python3 tools/stacktune.py 192.168.4.1 -m 25
+import argparse
+import http.client
+import json
+import math
+import re
+
+DEFAULT_API_PORT = 8333
+
+API_URL_TASKS = "/tasks"
+
+STACKS_PATH = "include/Core/TaskStacks.h"
+
+# Bounds of the task registry, see TaskRegistry.h
+TASK_MIN_STACK = 2048
+TASK_MAX_STACK = 32768
+
+# Stack table define of each task
+TASKS = {
+    "LOGGER_TASK": "TASK_STACK_LOGGER",
+    "HW-RT_TASK": "TASK_STACK_HM_RT",
+    "HM_ACTIONS_TASK": "TASK_STACK_HM_ACTIONS",
+    "HM_CHECKS_TASK": "TASK_STACK_HM_CHECKS",
+    "HW-IO_TASK": "TASK_STACK_IO",
+    "SENSORS_TASK": "TASK_STACK_SENSORS",
+    "HTTP-SRV_TASK": "TASK_STACK_SERVERS",
+    "TLM_TASK": "TASK_STACK_TELEMETRY",
+    "TSDB_TASK": "TASK_STACK_TSDB",
+    "SYSMON_TASK": "TASK_STACK_SYSMON",
+    "OTA_TASK": "TASK_STACK_OTA",
+}
+
+def read_tasks(host, port, timeout):
+    connection = http.client.HTTPConnection(host, port, timeout=timeout)
+    connection.request("POST", API_URL_TASKS)
+    response = connection.getresponse()
+    data = response.read()
+    connection.close()
+    if 200 != response.status:
+        raise RuntimeError("Tasks API returned {}".format(response.status))
+    return json.loads(data)["tasks"]
+
+def read_stacks(stacks_path):
+    stacks = {}
+    with open(stacks_path, "r", encoding="utf-8") as file:
+        for match in re.finditer(r"#define (TASK_STACK_\w+) (\d+)", file.read()):
+            stacks[match.group(1)] = int(match.group(2))
+    return stacks
+
+def tune_stack(peak, margin, granularity):
+    size = math.ceil(peak * (100 + margin) / 100 / granularity) * granularity
+    return min(TASK_MAX_STACK, max(TASK_MIN_STACK, size))
+
+def write_stacks(stacks_path, stacks, peaks, margin):
+    with open(stacks_path, "w", encoding="utf-8") as file:
+        file.write(
+            "/*******************************************************************************\n" +
+            " * @file TaskStacks.h\n" +
+            " *\n" +
+            " * @see TaskRegistry.h\n" +
+            " *\n" +
+            " * @author Alexy Torres Aurora Dugo\n" +
+            " *\n" +
+            " * @date 14/10/2026\n" +
+            " *\n" +
+            " * @version 1.0\n" +
+            " *\n" +
+            " * @brief Firmware tasks stack sizes.\n" +
+            " *\n" +
+            " * @details Firmware tasks stack sizes. This file is auto-generated by\n" +
+            " * tools/stacktune.py from the stack peaks measured with TASK_STACK_PROFILE.\n" +
+            " *\n" +
+            " * @copyright Alexy Torres Aurora Dugo\n" +
+            " ******************************************************************************/\n" +
+            "\n" +
+            "#ifndef __CORE_TASK_STACKS_H__\n" +
+            "#define __CORE_TASK_STACKS_H__\n" +
+            "\n" +
+            "/*******************************************************************************\n" +
+            " * CONSTANTS\n" +
+            " ******************************************************************************/\n"
+        )
+        for name, define in TASKS.items():
+            if 0 != peaks.get(name, 0):
+                file.write(
+                    "/** @brief {} stack size, peak {} bytes, margin {}%. */\n".format(
+                        name, peaks[name], margin))
+            else:
+                file.write("/** @brief {} stack size, not measured. */\n".format(name))
+            file.write("#define {} {}\n".format(define, stacks[define]))
+        file.write(
+            "\n" +
+            "#endif /* #ifndef __CORE_TASK_STACKS_H__ */"
+        )
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Tasks stack sizes generator.")
+    parser.add_argument("host", help="Address of the station.")
+    parser.add_argument("--api-port", type=int, default=DEFAULT_API_PORT)
+    parser.add_argument("-m", "--margin", type=int, default=25,
+                        help="Safety margin over the peak in percent.")
+    parser.add_argument("-g", "--granularity", type=int, default=256,
+                        help="Stack sizes granularity in bytes.")
+    parser.add_argument("-o", "--output", default=STACKS_PATH,
+                        help="Generated stack table.")
+    parser.add_argument("--timeout", type=float, default=5.0,
+                        help="Request timeout in seconds.")
+    args = parser.parse_args()
+
+    stacks = read_stacks(args.output)
+    peaks = {}
+    for task in read_tasks(args.host, args.api_port, args.timeout):
+        name = task["name"]
+        peak = task.get("stack_peak", 0)
+        if name in TASKS and 0 != peak:
+            peaks[name] = peak
+            size = tune_stack(peak, args.margin, args.granularity)
+            print("{:<16} peak {:>6} stack {:>6} -> {:>6}".format(
+                name, peak, stacks[TASKS[name]], size))
+            stacks[TASKS[name]] = size
+        elif name in TASKS:
+            print("{:<16} not measured, kept {}".format(
+                name, stacks[TASKS[name]]))
+
+    write_stacks(args.output, stacks, peaks, args.margin)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,89 @@
+/* Logs lazy loading generic */
+function loadLogs(param, offset, update_item, item, url) {
+    var xhr = new XMLHttpRequest();
+    xhr.onreadystatechange = function() {
+        if (xhr.readyState === 4) {
+            update_item.innerHTML = xhr.responseText + update_item.innerHTML;
+            next = xhr.getResponseHeader('X-Log-Sequence');
+            if (next == null) {
+                next = parseInt(offset) + xhr.responseText.length;
+            }
+            item.setAttribute('loaded', next);
+        };
+    };
+    xhr.open('GET', url + '?' + param + '=' + offset);
+    xhr.send();
+}
+
+/* Logs clear generic */
+function clearLogs(logId) {
+    var xhr = new XMLHttpRequest();
+    xhr.onreadystatechange = function() {
+        if (xhr.readyState === 4) {
+            item = 0;
+            if (logId == 0) {
+                item = document.getElementById('load_more_ram');
+                update_item = document.getElementById('ram_logs');
+            }
+            else if (logId == 1) {
+                item = document.getElementById('load_more_journal');
+                update_item = document.getElementById('journal_logs');
+            }
+            update_item.innerHTML = '';
+            item.setAttribute('loaded', 0);
+        };
+    };
+    xhr.open('GET', '/clearlogs?logtype=' + logId);
+    xhr.send();
+}
+
+/* Document ready */
+document.addEventListener('DOMContentLoaded', function() {
+    /* Ram lazy loading */
+    loadMoreRam = document.getElementById('load_more_ram');
+    loadMoreRam.onclick = function() {
+        loadLogs(
+            'seq',
+            loadMoreRam.getAttribute('loaded'),
+            document.getElementById('ram_logs'),
+            loadMoreRam,
+            '/loadram'
+        );
+        return false;
+    };
+
+    /* Journal lazy loading */
+    loadMoreJour = document.getElementById('load_more_journal');
+    loadMoreJour.onclick = function() {
+        loadLogs(
+            'offset',
+            loadMoreJour.getAttribute('loaded'),
+            document.getElementById('journal_logs'),
+            loadMoreJour,
+            '/loadjournal'
+        );
+        return false;
+    };
+
+    /* Log Clear */
+    resetJour = document.getElementById('reset_file');
+    resetJour.onclick = function() { clearLogs(1); return false; };
+    resetRam = document.getElementById('reset_ram');
+    resetRam.onclick = function() { clearLogs(0); return false; };
+
+    /* Live RAM logs, appended right after the loaded ones */
+    if (window.EventSource) {
+        ramLogs = document.getElementById('ram_logs');
+        events = new EventSource(
+            '/events?seq=' + ramLogs.getAttribute('next')
+        );
+        events.addEventListener('log', function(e) {
+            ramLogs.appendChild(document.createTextNode(e.data + '\n'));
+        });
+        events.addEventListener('overrun', function(e) {
+            ramLogs.appendChild(
+                document.createTextNode('=== ' + e.data + ' logs lost ===\n')
+            );
+        });
+    }
+});
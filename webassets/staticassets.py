@@ -0,0 +1,147 @@
+import gzip
+import os
+import yaml
+
+BYTES_PER_LINE = 12
+
+FILE_HEADER = (
+    "/*******************************************************************************\n" +
+    " * @file {}\n" +
+    " *\n" +
+    " * @see StaticAssets.h\n" +
+    " *\n" +
+    " * @author Alexy Torres Aurora Dugo\n" +
+    " *\n" +
+    " * @date 14/10/2026\n" +
+    " *\n" +
+    " * @version 1.0\n" +
+    " *\n" +
+    " * @brief Weather Station Firmware static assets content.\n" +
+    " *\n" +
+    " * @details Weather Station Firmware static assets content. This file is\n" +
+    " * auto-generated from the webassets directory and contains the identity and\n" +
+    " * gzip encoded content of the static assets served by the firmware.\n" +
+    " *\n" +
+    " * @copyright Alexy Torres Aurora Dugo\n" +
+    " ******************************************************************************/\n" +
+    "\n"
+)
+
+def LoadAssets(assetsPath):
+    with open(assetsPath, 'r', encoding="utf-8") as file:
+        assets = {}
+        try:
+            assets = yaml.safe_load(file)
+        except yaml.YAMLError as exc:
+            print(exc)
+
+    baseDir = os.path.dirname(assetsPath)
+    for key, value in assets.items():
+        print("==== Static asset: {}".format(key))
+        with open(os.path.join(baseDir, value["file"]), 'r', encoding="utf-8") as file:
+            # Drop the indentation and the empty lines, the content is kept
+            lines = [line.strip() for line in file.readlines()]
+            value["data"] = "\n".join([line for line in lines if line]).encode("utf-8")
+
+        # A null modification time keeps the output stable between builds
+        value["gzip"] = gzip.compress(value["data"], 9, mtime=0)
+        print("     {} bytes, {} bytes compressed".format(len(value["data"]), len(value["gzip"])))
+
+    return assets
+
+def WriteArray(sourceFile, name, data):
+    sourceFile.write("const uint8_t {}[] = {{\n".format(name))
+    for i in range(0, len(data), BYTES_PER_LINE):
+        line = ", ".join(["0x{:02X}".format(b) for b in data[i:i + BYTES_PER_LINE]])
+        sourceFile.write("    {},\n".format(line))
+    sourceFile.write("};\n")
+
+def BuildHeader(headerFile, assets):
+    headerFile.write(FILE_HEADER.format("StaticAssetsData.h"))
+    headerFile.write(
+        "#ifndef __STATIC_ASSETS_DATA_H__\n" +
+        "#define __STATIC_ASSETS_DATA_H__\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * INCLUDES\n" +
+        " ******************************************************************************/\n" +
+        "#include <cstdint> /* Standard int types */\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * CONSTANTS\n" +
+        " ******************************************************************************/\n"
+    )
+    for key, value in assets.items():
+        macro = "ASSET_" + key.upper()
+        headerFile.write("/** @brief Content type of the {} asset. */\n".format(value["file"]))
+        headerFile.write("#define {}_TYPE \"{}\"\n".format(macro, value["type"]))
+        headerFile.write("/** @brief Identity size of the {} asset. */\n".format(value["file"]))
+        headerFile.write("#define {}_SIZE {}\n".format(macro, len(value["data"])))
+        headerFile.write("/** @brief Gzip encoded size of the {} asset. */\n".format(value["file"]))
+        headerFile.write("#define {}_GZ_SIZE {}\n".format(macro, len(value["gzip"])))
+    headerFile.write(
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * MACROS\n" +
+        " ******************************************************************************/\n" +
+        "/* None */\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * STRUCTURES AND TYPES\n" +
+        " ******************************************************************************/\n" +
+        "/* None */\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * GLOBAL VARIABLES\n" +
+        " ******************************************************************************/\n" +
+        "\n" +
+        "/************************* Imported global variables **************************/\n" +
+        "/* None */\n" +
+        "\n" +
+        "/************************* Exported global variables **************************/\n"
+    )
+    for key, value in assets.items():
+        symbol = "gkAsset" + "".join([part.capitalize() for part in key.split("_")])
+        headerFile.write("/** @brief Identity content of the {} asset. */\n".format(value["file"]))
+        headerFile.write("extern const uint8_t {}[];\n".format(symbol))
+        headerFile.write("/** @brief Gzip encoded content of the {} asset. */\n".format(value["file"]))
+        headerFile.write("extern const uint8_t {}Gz[];\n".format(symbol))
+    headerFile.write(
+        "\n" +
+        "/************************** Static global variables ***************************/\n" +
+        "/* None */\n" +
+        "\n" +
+        "#endif /* #ifndef __STATIC_ASSETS_DATA_H__ */\n"
+    )
+
+def BuildSource(sourceFile, assets):
+    sourceFile.write(FILE_HEADER.format("StaticAssetsData.cpp"))
+    sourceFile.write(
+        "/*******************************************************************************\n" +
+        " * INCLUDES\n" +
+        " ******************************************************************************/\n" +
+        "#include <cstdint>            /* Standard int types */\n" +
+        "#include <StaticAssetsData.h> /* Static assets content */\n" +
+        "\n" +
+        "/*******************************************************************************\n" +
+        " * GLOBAL VARIABLES\n" +
+        " ******************************************************************************/\n" +
+        "\n" +
+        "/************************* Exported global variables **************************/\n"
+    )
+    for key, value in assets.items():
+        symbol = "gkAsset" + "".join([part.capitalize() for part in key.split("_")])
+        sourceFile.write("/** @brief Identity content of the {} asset. */\n".format(value["file"]))
+        WriteArray(sourceFile, symbol, value["data"])
+        sourceFile.write("\n")
+        sourceFile.write("/** @brief Gzip encoded content of the {} asset. */\n".format(value["file"]))
+        WriteArray(sourceFile, symbol + "Gz", value["gzip"])
+        sourceFile.write("\n")
+
+def GenerateStaticAssets(assetsPath, sourcePath, headerPath):
+    assets = LoadAssets(assetsPath)
+
+    with open(headerPath, 'w', encoding="utf-8") as headerFile:
+        BuildHeader(headerFile, assets)
+    with open(sourcePath, 'w', encoding="utf-8") as sourceFile:
+        BuildSource(sourceFile, assets)